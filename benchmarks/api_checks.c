@@ -0,0 +1,499 @@
+/******************************************************************************
+ * File: api_checks.c
+ * Description: Checks of the parts of the library whose mistakes would not
+ * show up as a wrong score. parse_range() must produce exactly the combos and
+ * weights of a set of ranges, written out by rank and suit here, and refuse
+ * malformed ones. canonical_spot_key() must give the same key to random spots
+ * under all 24 relabellings of their suits and any order of their cards, and
+ * different keys to spots that are not relabellings of each other. With a
+ * fixed seed, the key must change with the seed and the relabelling. With few
+ * samples, the class averages of simulate_holdings() must only take the
+ * holdings that played some game. Every check prints its result and the
+ * program returns -1 at the first mismatch.
+ *
+ * Build and run from the root directory of the project:
+ *      gcc -O2 -o api_checks benchmarks/api_checks.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ *      ./api_checks
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "../src/simulation.h"
+#include "../src/hand_ranges.h"
+#include "../src/result_cache.h"
+#include "../src/preflop_tables.h"
+
+#define NUM_SUITS 4
+#define NUM_SUIT_PERMUTATIONS 24
+#define RANK_T 8
+#define RANK_J 9
+#define RANK_Q 10
+#define RANK_K 11
+#define RANK_A 12
+#define NUM_SPOTS 10000
+#define SPOTS_SEED 20230703
+#define HOLDINGS_PLAYERS 9      // Many opponents block many holdings in every sample
+#define HOLDINGS_SAMPLES 5      // Few samples, so some holdings are blocked in all of them
+#define HOLDINGS_SEED 20230704
+
+/* Expected combo of a range: ranks and suits of both cards, highest rank first, and its weight (0 if left out) */
+
+typedef double (*combo_weight_fn)(int high, int high_suit, int low, int low_suit);
+
+/* Spot of the result cache, with cards in [0,51] */
+
+typedef struct {
+    sim_mode_t mode;
+    int num_players;
+    int num_known_players;
+    int players_cards[MAX_PLAYERS][2];
+    int board_cards[5];
+    int num_board_cards;
+    uint64_t discarded_cards;
+} spot_t;
+
+/* Range to parse and the weight of every combo it must give */
+
+typedef struct {
+    const char *text;
+    combo_weight_fn weight;
+} range_case_t;
+
+int check_range(const range_case_t *range_case);
+double pairs_ten_or_better(int high, int high_suit, int low, int low_suit);
+double suited_wheel_aces(int high, int high_suit, int low, int low_suit);
+double offsuit_kings_ten_or_better(int high, int high_suit, int low, int low_suit);
+double ace_hearts_king_diamonds(int high, int high_suit, int low, int low_suit);
+double half_queens_and_suited_ace_king(int high, int high_suit, int low, int low_suit);
+double pairs_ten_or_better_but_jacks(int high, int high_suit, int low, int low_suit);
+int check_spot_keys(rng_t *rng);
+void random_spot(rng_t *rng, spot_t *spot);
+void relabel_spot(rng_t *rng, const spot_t *spot, const int permutation[NUM_SUITS], spot_t *relabelled);
+void spot_key(const spot_t *spot, result_cache_key_t *key);
+int parse_spot(const char *players, const char *board, spot_t *spot);
+int check_holding_classes();
+
+
+int main(){
+
+    if (init_simulator(NULL) == -1){
+        printf("Error initializing simulator.\n");
+        return -1;
+    }
+
+    /* Valid ranges: the combos and weights must be exactly the expected ones */
+
+    const range_case_t valid_ranges[] = {
+        { "TT+", pairs_ten_or_better },
+        { "A2s-A5s", suited_wheel_aces },
+        { "KTo+", offsuit_kings_ten_or_better },
+        { "AhKd", ace_hearts_king_diamonds },
+        { "kdah", ace_hearts_king_diamonds },
+        { "QQ:0.5, AKs", half_queens_and_suited_ace_king },
+        { "TT+,JJ:0", pairs_ten_or_better_but_jacks }
+    };
+    int num_valid = (int) (sizeof(valid_ranges) / sizeof(valid_ranges[0]));
+
+    for(int i = 0; i < num_valid; i++){
+        if(check_range(&valid_ranges[i]) == -1) return -1;
+    }
+
+    /* Invalid ranges: all of them must be refused */
+
+    const char *invalid_ranges[] = { "", "AKx", "ZZ", "TT+:", "AA:-1", "AA:inf", "AA:nan", "AA:0", "AhAh", "AhKx",
+                                     "A5s-A2o", "A2s-K5s", "AKs,,KQo", "AA+++" };
+    int num_invalid = (int) (sizeof(invalid_ranges) / sizeof(invalid_ranges[0]));
+    hand_range_t range;
+
+    for(int i = 0; i < num_invalid; i++){
+        if(parse_range(invalid_ranges[i], &range) != -1){
+            printf("Range \"%s\" should have been refused.\n", invalid_ranges[i]);
+            return -1;
+        }
+    }
+    printf("%d valid ranges parsed exactly and %d invalid ranges refused.\n", num_valid, num_invalid);
+
+    /* Keys of the result cache */
+
+    rng_t rng;
+    rng_seed(&rng, RNG_XOSHIRO256SS, SPOTS_SEED, 0);
+    if(check_spot_keys(&rng) == -1) return -1;
+
+    /* Class averages of simulate_holdings() */
+
+    if(check_holding_classes() == -1) return -1;
+
+    return 0;
+}
+
+
+/**
+ *  @brief  Parses a range and compares its combos and weights with the expected ones.
+ *
+ * @param range_case Range and expected weight of every combo.
+ * @return 0 if they match, -1 otherwise.
+ */
+int check_range(const range_case_t *range_case){
+    hand_range_t range;
+    double parsed[TOTAL_CARDS][TOTAL_CARDS] = {{0.0}};
+
+    if(parse_range(range_case->text, &range) == -1){
+        printf("Range \"%s\" was refused.\n", range_case->text);
+        return -1;
+    }
+
+    for(int i = 0; i < range.num_combos; i++){
+        int c1 = range.cards[i][0], c2 = range.cards[i][1];
+        if(c1 == c2 || parsed[c1][c2] != 0.0){
+            printf("Range \"%s\" has a repeated or invalid combo %s%s.\n", range_case->text, card_names[c1], card_names[c2]);
+            return -1;
+        }
+        parsed[c1][c2] = parsed[c2][c1] = range.weights[i];
+    }
+
+    int expected_combos = 0;
+    for(int c1 = 0; c1 < TOTAL_CARDS; c1++){
+        for(int c2 = c1 + 1; c2 < TOTAL_CARDS; c2++){
+            // Highest rank first, and for pairs the highest suit
+            int high = c1, low = c2;
+            if(c1 % NUM_RANKS < c2 % NUM_RANKS || (c1 % NUM_RANKS == c2 % NUM_RANKS && c1 < c2)){
+                high = c2;
+                low = c1;
+            }
+            double weight = range_case->weight(high % NUM_RANKS, high / NUM_RANKS, low % NUM_RANKS, low / NUM_RANKS);
+            if(weight > 0.0) expected_combos++;
+            if(fabs(parsed[c1][c2] - weight) > 1e-12){
+                printf("Range \"%s\" gives weight %g to %s%s instead of %g.\n", range_case->text, parsed[c1][c2],
+                       card_names[high], card_names[low], weight);
+                return -1;
+            }
+        }
+    }
+
+    if(range.num_combos != expected_combos){
+        printf("Range \"%s\" has %d combos instead of %d.\n", range_case->text, range.num_combos, expected_combos);
+        return -1;
+    }
+
+    printf("Range %-16s %4d combos\n", range_case->text, range.num_combos);
+    return 0;
+}
+
+
+/* Expected weights of the valid ranges. Ranks are in [0,12] (2 to A), suits in [0,3] (c, d, h, s). */
+
+double pairs_ten_or_better(int high, int high_suit, int low, int low_suit){
+    (void) high_suit;
+    (void) low_suit;
+    return (high == low && high >= RANK_T) ? 1.0 : 0.0;
+}
+
+double suited_wheel_aces(int high, int high_suit, int low, int low_suit){
+    return (high == RANK_A && low <= 3 && high_suit == low_suit) ? 1.0 : 0.0;
+}
+
+double offsuit_kings_ten_or_better(int high, int high_suit, int low, int low_suit){
+    return (high == RANK_K && low >= RANK_T && low < RANK_K && high_suit != low_suit) ? 1.0 : 0.0;
+}
+
+double ace_hearts_king_diamonds(int high, int high_suit, int low, int low_suit){
+    return (high == RANK_A && high_suit == 2 && low == RANK_K && low_suit == 1) ? 1.0 : 0.0;
+}
+
+double half_queens_and_suited_ace_king(int high, int high_suit, int low, int low_suit){
+    if(high == RANK_Q && low == RANK_Q) return 0.5;
+    return (high == RANK_A && low == RANK_K && high_suit == low_suit) ? 1.0 : 0.0;
+}
+
+double pairs_ten_or_better_but_jacks(int high, int high_suit, int low, int low_suit){
+    return (high != RANK_J) ? pairs_ten_or_better(high, high_suit, low, low_suit) : 0.0;
+}
+
+
+/**
+ *  @brief  Checks canonical_spot_key() on random spots and on pairs of spots written by hand.
+ *
+ * @param rng Random number generator of the spots.
+ * @return 0 if every key is as expected, -1 otherwise.
+ */
+int check_spot_keys(rng_t *rng){
+    int permutations[NUM_SUIT_PERMUTATIONS][NUM_SUITS], num_permutations = 0;
+    for(int a = 0; a < NUM_SUITS; a++)
+    for(int b = 0; b < NUM_SUITS; b++)
+    for(int c = 0; c < NUM_SUITS; c++)
+    for(int d = 0; d < NUM_SUITS; d++){
+        if(a != b && a != c && a != d && b != c && b != d && c != d){
+            permutations[num_permutations][0] = a;
+            permutations[num_permutations][1] = b;
+            permutations[num_permutations][2] = c;
+            permutations[num_permutations][3] = d;
+            num_permutations++;
+        }
+    }
+
+    /* Every relabelling of a random spot, with its cards shuffled, has the key of the spot */
+
+    for(int i = 0; i < NUM_SPOTS; i++){
+        spot_t spot, relabelled;
+        result_cache_key_t key, relabelled_key;
+
+        random_spot(rng, &spot);
+        spot_key(&spot, &key);
+        for(int p = 0; p < num_permutations; p++){
+            relabel_spot(rng, &spot, permutations[p], &relabelled);
+            spot_key(&relabelled, &relabelled_key);
+            if(memcmp(&key, &relabelled_key, sizeof(key)) != 0){
+                printf("Key mismatch in spot %d under suit relabelling %d.\n", i, p);
+                return -1;
+            }
+        }
+    }
+
+    /* Spots written by hand: the same key if they are relabellings of each other, different keys otherwise */
+
+    const struct { const char *players[2]; const char *boards[2]; int same; } pairs[] = {
+        { { "AH KH", "AS KS" }, { "2H 7C 9D", "2S 7D 9C" }, 1 },
+        { { "KH AH", "AS KS" }, { "9D 2H 7C", "2S 7D 9C" }, 1 },
+        { { "AH KH QS QD", "AC KC QH QS" }, { "2H 7C 9D", "2C 7D 9S" }, 1 },
+        { { "AH KH", "AH KH" }, { "2H 7C 9D", "2C 7H 9D" }, 0 },
+        { { "AH KH", "AH KD" }, { "2H 7C 9D", "2H 7C 9D" }, 0 },
+        { { "AH KH QS QD", "QS QD AH KH" }, { "2H 7C 9D", "2H 7C 9D" }, 0 },
+        { { "AH KH QS QD", "AH KH QH QD" }, { "", "" }, 0 }
+    };
+    int num_pairs = (int) (sizeof(pairs) / sizeof(pairs[0]));
+
+    for(int i = 0; i < num_pairs; i++){
+        spot_t spots[2];
+        result_cache_key_t keys[2];
+        for(int j = 0; j < 2; j++){
+            if(parse_spot(pairs[i].players[j], pairs[i].boards[j], &spots[j]) == -1){
+                printf("Invalid spot in pair %d.\n", i);
+                return -1;
+            }
+            spot_key(&spots[j], &keys[j]);
+        }
+        int same = (memcmp(&keys[0], &keys[1], sizeof(keys[0])) == 0);
+        if(same != pairs[i].same){
+            printf("Spots \"%s | %s\" and \"%s | %s\" should have %s keys.\n", pairs[i].players[0], pairs[i].boards[0],
+                   pairs[i].players[1], pairs[i].boards[1], pairs[i].same ? "the same" : "different");
+            return -1;
+        }
+    }
+
+    /* A fixed seed is part of the key, and a relabelled spot deals other cards from it */
+
+    spot_t spot, relabelled;
+    result_cache_key_t keys[3];
+    sim_options_t options;
+
+    parse_spot("AH KH QS QD", "2H 7C 9D", &spot);
+    parse_spot("AS KS QH QC", "2S 7D 9C", &relabelled);
+    sim_default_options(&options);
+    options.seed = 1;
+    canonical_spot_key(&keys[0], spot.mode, spot.num_players, spot.num_known_players, spot.players_cards, spot.board_cards,
+                       spot.num_board_cards, spot.discarded_cards, 10000, &options);
+    options.seed = 2;
+    canonical_spot_key(&keys[1], spot.mode, spot.num_players, spot.num_known_players, spot.players_cards, spot.board_cards,
+                       spot.num_board_cards, spot.discarded_cards, 10000, &options);
+    canonical_spot_key(&keys[2], relabelled.mode, relabelled.num_players, relabelled.num_known_players, relabelled.players_cards,
+                       relabelled.board_cards, relabelled.num_board_cards, relabelled.discarded_cards, 10000, &options);
+    if(memcmp(&keys[0], &keys[1], sizeof(keys[0])) == 0 || memcmp(&keys[1], &keys[2], sizeof(keys[1])) == 0){
+        printf("Spots with different fixed seeds, or relabelled with a fixed seed, should have different keys.\n");
+        return -1;
+    }
+
+    printf("%d random spots have the same key under all %d suit relabellings, %d pairs of spots and fixed seeds checked.\n",
+           NUM_SPOTS, num_permutations, num_pairs);
+    return 0;
+}
+
+
+/**
+ *  @brief  Random spot: 2 to MAX_PLAYERS players, some of them with known cards, 0 or 3 to 5 community cards and up
+ *  to 4 discarded cards.
+ *
+ * @param rng Random number generator.
+ * @param spot Where the spot is stored.
+ */
+void random_spot(rng_t *rng, spot_t *spot){
+    int cards[TOTAL_CARDS];
+    for(int j = 0; j < TOTAL_CARDS; j++) cards[j] = j;
+    for(int j = 0; j < TOTAL_CARDS; j++){
+        int k = j + (int) rng_bounded(rng, TOTAL_CARDS - j);
+        int card = cards[k];
+        cards[k] = cards[j];
+        cards[j] = card;
+    }
+
+    const int board_sizes[4] = { 0, 3, 4, 5 };
+    int dealt = 0;
+
+    memset(spot, 0, sizeof(*spot));
+    spot->mode = rng_bounded(rng, 2) ? SIM_MODE_SPECTATOR : SIM_MODE_PLAYER;
+    spot->num_players = 2 + (int) rng_bounded(rng, 8);
+    spot->num_known_players = (spot->mode == SIM_MODE_PLAYER) ? 1 : 1 + (int) rng_bounded(rng, spot->num_players);
+    spot->num_board_cards = board_sizes[rng_bounded(rng, 4)];
+    for(int i = 0; i < spot->num_known_players; i++){
+        spot->players_cards[i][0] = cards[dealt++];
+        spot->players_cards[i][1] = cards[dealt++];
+    }
+    for(int i = 0; i < spot->num_board_cards; i++) spot->board_cards[i] = cards[dealt++];
+    int num_discarded = (int) rng_bounded(rng, 5);
+    for(int i = 0; i < num_discarded; i++) spot->discarded_cards |= 1ULL << cards[dealt++];
+}
+
+
+/**
+ *  @brief  Relabelling of the suits of a spot, with the hole cards of every player and the community cards shuffled.
+ *
+ * @param rng Random number generator of the shuffles.
+ * @param spot Spot to relabel.
+ * @param permutation New suit of every suit.
+ * @param relabelled Where the relabelled spot is stored.
+ */
+void relabel_spot(rng_t *rng, const spot_t *spot, const int permutation[NUM_SUITS], spot_t *relabelled){
+    *relabelled = *spot;
+    relabelled->discarded_cards = 0;
+
+    for(int i = 0; i < spot->num_known_players; i++){
+        int swap = (int) rng_bounded(rng, 2);
+        for(int j = 0; j < 2; j++){
+            int card = spot->players_cards[i][j ^ swap];
+            relabelled->players_cards[i][j] = permutation[card / NUM_RANKS] * NUM_RANKS + card % NUM_RANKS;
+        }
+    }
+    for(int i = 0; i < spot->num_board_cards; i++){
+        int card = spot->board_cards[i];
+        relabelled->board_cards[i] = permutation[card / NUM_RANKS] * NUM_RANKS + card % NUM_RANKS;
+    }
+    for(int i = spot->num_board_cards - 1; i > 0; i--){
+        int k = (int) rng_bounded(rng, (uint32_t) (i + 1));
+        int card = relabelled->board_cards[k];
+        relabelled->board_cards[k] = relabelled->board_cards[i];
+        relabelled->board_cards[i] = card;
+    }
+    for(int card = 0; card < TOTAL_CARDS; card++){
+        if((spot->discarded_cards >> card) & 1){
+            relabelled->discarded_cards |= 1ULL << (permutation[card / NUM_RANKS] * NUM_RANKS + card % NUM_RANKS);
+        }
+    }
+}
+
+
+/**
+ *  @brief  Key of a spot with the default options and 10000 games.
+ *
+ * @param spot Spot.
+ * @param key Where the key is stored.
+ */
+void spot_key(const spot_t *spot, result_cache_key_t *key){
+    sim_options_t options;
+    sim_default_options(&options);
+    canonical_spot_key(key, spot->mode, spot->num_players, spot->num_known_players, spot->players_cards, spot->board_cards,
+                       spot->num_board_cards, spot->discarded_cards, 10000, &options);
+}
+
+
+/**
+ *  @brief  Spectator spot of 2 players from card names separated by spaces.
+ *
+ * @param players Hole cards of the players, e.g. "AH KH QS QD".
+ * @param board Community cards, e.g. "2H 7C 9D", or "" preflop.
+ * @param spot Where the spot is stored.
+ * @return 0 for success, -1 if a card name is not valid.
+ */
+int parse_spot(const char *players, const char *board, spot_t *spot){
+    int cards[2 * MAX_PLAYERS + 5], num_cards[2] = { 0, 0 };
+    const char *texts[2] = { players, board };
+
+    for(int t = 0; t < 2; t++){
+        for(const char *c = texts[t]; *c != '\0'; ){
+            if(*c == ' '){
+                c++;
+                continue;
+            }
+            char name[3] = { c[0], c[1], '\0' };
+            int card = -1;
+            for(int j = 0; j < TOTAL_CARDS; j++){
+                if(c[1] != '\0' && strcmp(card_names[j], name) == 0) card = j;
+            }
+            if(card == -1) return -1;
+            cards[(t == 0) ? num_cards[0] : 2 * MAX_PLAYERS + num_cards[1]] = card;
+            num_cards[t]++;
+            c += 2;
+        }
+    }
+
+    memset(spot, 0, sizeof(*spot));
+    spot->mode = SIM_MODE_SPECTATOR;
+    spot->num_players = 2;
+    spot->num_known_players = num_cards[0] / 2;
+    for(int i = 0; i < num_cards[0]; i++) spot->players_cards[i / 2][i % 2] = cards[i];
+    spot->num_board_cards = num_cards[1];
+    for(int i = 0; i < num_cards[1]; i++) spot->board_cards[i] = cards[2 * MAX_PLAYERS + i];
+    return 0;
+}
+
+
+/**
+ *  @brief  Checks the class averages of simulate_holdings() with so few samples that some holdings never play: every
+ *  class must average exactly the holdings of the class with at least one game.
+ *
+ * @return 0 if every class average is as expected, -1 otherwise.
+ */
+int check_holding_classes(){
+    sim_holdings_result_t *result = (sim_holdings_result_t *) malloc(sizeof(sim_holdings_result_t));
+    if(result == NULL) return -1;
+
+    sim_options_t options;
+    sim_default_options(&options);
+    options.num_threads = 1;
+    options.seed = HOLDINGS_SEED;
+
+    if(simulate_holdings(NULL, 0, NULL, 0, HOLDINGS_PLAYERS, HOLDINGS_SAMPLES, &options, result) == -1){
+        printf("simulate_holdings() failed.\n");
+        free(result);
+        return -1;
+    }
+
+    int num_holdings[SIM_NUM_HOLDING_CLASSES] = { 0 };
+    double sums[SIM_NUM_HOLDING_CLASSES][3 + NUM_OF_HAND_TYPES] = { { 0 } };
+    int num_blocked = 0;
+
+    for(int index = 0; index < SIM_NUM_HOLDINGS; index++){
+        if(result->num_games[index] == 0){
+            num_blocked++;
+            continue;
+        }
+        int c = preflop_class(result->cards[index][0], result->cards[index][1]);
+        num_holdings[c]++;
+        for(int j = 0; j < 3 + NUM_OF_HAND_TYPES; j++) sums[c][j] += result->probabilities[index][j];
+    }
+
+    if(num_blocked == 0){
+        printf("No holding was blocked in every sample, the class averages were not checked.\n");
+        free(result);
+        return -1;
+    }
+
+    for(int c = 0; c < SIM_NUM_HOLDING_CLASSES; c++){
+        if(result->class_num_holdings[c] != num_holdings[c]){
+            printf("Class %d averages %d holdings instead of %d.\n", c, result->class_num_holdings[c], num_holdings[c]);
+            free(result);
+            return -1;
+        }
+        for(int j = 0; num_holdings[c] > 0 && j < 3 + NUM_OF_HAND_TYPES; j++){
+            if(fabs(result->class_probabilities[c][j] - sums[c][j] / num_holdings[c]) > 1e-9){
+                printf("Class %d column %d is %f instead of %f.\n", c, j, result->class_probabilities[c][j], sums[c][j] / num_holdings[c]);
+                free(result);
+                return -1;
+            }
+        }
+    }
+
+    printf("%d holdings blocked in all %d samples left out of the class averages.\n", num_blocked, HOLDINGS_SAMPLES);
+    free(result);
+    return 0;
+}
@@ -0,0 +1,482 @@
+/******************************************************************************
+ * File: bench.c
+ * Description: Reproducible benchmark suite. Every measurement does the same
+ * work in every run, drawn from a fixed seed:
+ *  - get_score() over a random stream of 5-card hands and over all of them,
+ *    and get_score7() over a random stream of 7-card hands.
+ *  - init_simulator() latency, from the built-in tables and from the CSV.
+ *  - Games per second of simulate_player_ex() and simulate_spectator_ex()
+ *    in the A, B and C configurations of the README plus 6- and 9-handed
+ *    spots, always with the Monte Carlo method and one thread.
+ *  - Multi-core scaling of configuration C, from 1 thread to all the CPUs.
+ * Every measurement is repeated and its median is reported. The results are
+ * written as JSON, and can be compared against a previous run saved as a
+ * baseline: the exit code is 2 if any result is worse than the baseline by
+ * more than the threshold.
+ *
+ * Build and run from the root directory of the project:
+ *      gcc -O2 -o bench benchmarks/bench.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ *      ./bench --output baseline.json
+ *      ./bench --baseline baseline.json [--threshold 0.05] [--quick]
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../src/simulation.h"
+
+#define BENCH_SEED 20230701
+#define NUM_REPEATS 5
+#define NUM_5CARD_HANDS 2598960
+#define NUM_RANDOM_HANDS 1000000
+#define EVALUATOR_ROUNDS 10
+#define SIM_GAMES 1000000
+#define SCALING_GAMES 4000000
+#define QUICK_FACTOR 10
+#define MAX_RESULTS 64
+#define DEFAULT_THRESHOLD 0.10
+#define INIT_BUILTIN_CALLS 100     // init_simulator(NULL) is too fast to time a single call
+
+extern int deck[TOTAL_CARDS];
+
+/* Result of a measurement */
+
+typedef struct {
+    char name[48];
+    double value;
+    const char *unit;
+    int higher_is_better;
+    double check;           // Value that depends only on the work done, e.g. a checksum or a probability
+} bench_result_t;
+
+/* Spot from the player's perspective */
+
+typedef struct {
+    const char *name;
+    int num_players;
+    char *known_cards[7];
+    int num_known_cards;
+} player_spot_t;
+
+/* Spot from the spectator's perspective */
+
+typedef struct {
+    const char *name;
+    int num_players;
+    char *players_cards[2 * 9];
+    char *board_cards[5];
+    int num_board_cards;
+} spectator_spot_t;
+
+static const player_spot_t PLAYER_SPOTS[] = {
+    { "player_A_2p_preflop", 2, { "AH", "JS" }, 2 },
+    { "player_B_4p_river", 4, { "AH", "JS", "2C", "JD", "QH", "5S", "9C" }, 7 },
+    { "player_C_4p_preflop", 4, { "AH", "JS" }, 2 },
+    { "player_6p_preflop", 6, { "TH", "TD" }, 2 },
+    { "player_9p_flop", 9, { "AS", "QS", "2S", "7S", "JD" }, 5 }
+};
+
+static const spectator_spot_t SPECTATOR_SPOTS[] = {
+    { "spectator_A_2p_preflop", 2, { "AH", "JS", "QC", "QD" }, { 0 }, 0 },
+    { "spectator_B_4p_river", 4, { "AH", "JS", "QC", "QD", "8S", "9S", "3H", "3D" }, { "2C", "JD", "QH", "5S", "9C" }, 5 },
+    { "spectator_C_4p_preflop", 4, { "AH", "JS", "QC", "QD", "8S", "9S", "3H", "3D" }, { 0 }, 0 },
+    { "spectator_6p_preflop", 6, { "AH", "JS", "QC", "QD", "8S", "9S", "3H", "3D", "KC", "TC", "7D", "6D" }, { 0 }, 0 },
+    { "spectator_9p_flop", 9, { "AH", "JS", "QC", "QD", "8S", "9S", "3H", "3D", "KC", "TC", "7D", "6D", "4S", "4C", "AD", "2H", "5H", "6H" },
+      { "2C", "JD", "QH" }, 3 }
+};
+
+bench_result_t results[MAX_RESULTS];
+int num_results = 0;
+
+double now_seconds();
+int compare_doubles(const void *a, const void *b);
+double median(double values[], int n);
+void add_result(const char *name, double value, const char *unit, int higher_is_better, double check);
+void random_hands(int (*hands)[7], int num_hands, int cards_per_hand);
+void bench_evaluator(int quick);
+void bench_init();
+void bench_simulations(int quick);
+void bench_scaling(int quick);
+int write_json(const char *file);
+int compare_baseline(const char *file, double threshold);
+
+
+int main(int argc, char *argv[]){
+    const char *output = NULL, *baseline = NULL;
+    double threshold = DEFAULT_THRESHOLD;
+    int quick = 0;
+
+    for(int i = 1; i < argc; i++){
+        if(strcmp(argv[i], "--output") == 0 && i + 1 < argc) output = argv[++i];
+        else if(strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) baseline = argv[++i];
+        else if(strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) threshold = atof(argv[++i]);
+        else if(strcmp(argv[i], "--quick") == 0) quick = 1;
+        else {
+            fprintf(stderr,"Usage: %s [--output results.json] [--baseline baseline.json] [--threshold %.2f] [--quick]\n", argv[0], DEFAULT_THRESHOLD);
+            return 1;
+        }
+    }
+
+    bench_init();
+    bench_evaluator(quick);
+    bench_simulations(quick);
+    bench_scaling(quick);
+
+    printf("\n%-32s %14s   %s\n", "Benchmark", "value", "unit");
+    for(int i = 0; i < num_results; i++){
+        printf("%-32s %14.3f   %s\n", results[i].name, results[i].value, results[i].unit);
+    }
+
+    if(output != NULL && write_json(output) == -1) return 1;
+    if(baseline != NULL) return compare_baseline(baseline, threshold);
+    return 0;
+}
+
+
+/**
+ *  @brief  Current time of a monotonic clock.
+ *
+ * @return Seconds.
+ */
+double now_seconds(){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double) t.tv_sec + (double) t.tv_nsec * 1e-9;
+}
+
+
+/**
+ *  @brief  Comparison of two doubles, for qsort().
+ *
+ * @param a First double.
+ * @param b Second double.
+ * @return Negative, zero or positive if a is lower, equal or greater than b.
+ */
+int compare_doubles(const void *a, const void *b){
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+
+/**
+ *  @brief  Median of a set of values, which are sorted.
+ *
+ * @param values Values.
+ * @param n Number of values.
+ * @return Median.
+ */
+double median(double values[], int n){
+    qsort(values, n, sizeof(double), compare_doubles);
+    return (n % 2) ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2.0;
+}
+
+
+/**
+ *  @brief  Addition of a result to the list of results.
+ *
+ * @param name Name of the result, unique.
+ * @param value Measured value.
+ * @param unit Unit of the value.
+ * @param higher_is_better 1 for throughputs, 0 for latencies.
+ * @param check Value that only depends on the work done, so that runs doing different work are detected.
+ */
+void add_result(const char *name, double value, const char *unit, int higher_is_better, double check){
+    if(num_results == MAX_RESULTS) return;
+    bench_result_t *result = &results[num_results++];
+    snprintf(result->name, sizeof(result->name), "%s", name);
+    result->value = value;
+    result->unit = unit;
+    result->higher_is_better = higher_is_better;
+    result->check = check;
+    fprintf(stderr,"%-32s %14.3f   %s\n", name, value, unit);
+}
+
+
+/**
+ *  @brief  Random hands drawn from the fixed seed, Cactus Kev encoded.
+ *
+ * @param hands Where the hands are stored.
+ * @param num_hands Number of hands.
+ * @param cards_per_hand Cards of every hand, 5 or 7.
+ */
+void random_hands(int (*hands)[7], int num_hands, int cards_per_hand){
+    rng_t rng;
+    int cards[TOTAL_CARDS];
+    rng_seed(&rng, RNG_XOSHIRO256SS, BENCH_SEED, 0);
+    for(int i = 0; i < TOTAL_CARDS; i++) cards[i] = i;
+
+    for(int h = 0; h < num_hands; h++){
+        for(int i = 0; i < cards_per_hand; i++){
+            int j = i + (int) rng_bounded(&rng, TOTAL_CARDS - i);
+            int t = cards[i]; cards[i] = cards[j]; cards[j] = t;
+            hands[h][i] = deck[cards[i]];
+        }
+    }
+}
+
+
+/**
+ *  @brief  Throughput of the evaluator, in millions of hands per second: get_score() over a random stream and
+ *  over all the 5-card hands, and get_score7() over a random stream.
+ *
+ * @param quick Whether to do a tenth of the work.
+ */
+void bench_evaluator(int quick){
+    int rounds = quick ? 1 : EVALUATOR_ROUNDS;
+    int (*hands)[7] = malloc(NUM_5CARD_HANDS * sizeof(*hands));
+    if(hands == NULL){
+        fprintf(stderr,"Error allocating the hands.\n");
+        exit(1);
+    }
+
+    double times[NUM_REPEATS];
+    unsigned long checksum;
+
+    // Random stream of 5-card hands
+    random_hands(hands, NUM_RANDOM_HANDS, 5);
+    for(int r = 0; r < NUM_REPEATS; r++){
+        checksum = 0;
+        double start = now_seconds();
+        for(int round = 0; round < rounds; round++){
+            for(int i = 0; i < NUM_RANDOM_HANDS; i++) checksum += get_score(hands[i]);
+        }
+        times[r] = now_seconds() - start;
+    }
+    add_result("get_score_random", (double) NUM_RANDOM_HANDS * rounds / median(times, NUM_REPEATS) * 1e-6, "Mhands/s", 1, (double) checksum);
+
+    // All the 5-card hands
+    int n = 0;
+    for(int a = 0; a < TOTAL_CARDS; a++)
+    for(int b = a + 1; b < TOTAL_CARDS; b++)
+    for(int c = b + 1; c < TOTAL_CARDS; c++)
+    for(int d = c + 1; d < TOTAL_CARDS; d++)
+    for(int e = d + 1; e < TOTAL_CARDS; e++){
+        hands[n][0] = deck[a]; hands[n][1] = deck[b]; hands[n][2] = deck[c]; hands[n][3] = deck[d]; hands[n][4] = deck[e];
+        n++;
+    }
+    for(int r = 0; r < NUM_REPEATS; r++){
+        checksum = 0;
+        double start = now_seconds();
+        for(int round = 0; round < rounds; round++){
+            for(int i = 0; i < NUM_5CARD_HANDS; i++) checksum += get_score(hands[i]);
+        }
+        times[r] = now_seconds() - start;
+    }
+    add_result("get_score_exhaustive", (double) NUM_5CARD_HANDS * rounds / median(times, NUM_REPEATS) * 1e-6, "Mhands/s", 1, (double) checksum);
+
+    // Random stream of 7-card hands
+    random_hands(hands, NUM_RANDOM_HANDS, 7);
+    for(int r = 0; r < NUM_REPEATS; r++){
+        checksum = 0;
+        double start = now_seconds();
+        for(int round = 0; round < rounds; round++){
+            for(int i = 0; i < NUM_RANDOM_HANDS; i++) checksum += get_score7(hands[i]);
+        }
+        times[r] = now_seconds() - start;
+    }
+    add_result("get_score7_random", (double) NUM_RANDOM_HANDS * rounds / median(times, NUM_REPEATS) * 1e-6, "Mhands/s", 1, (double) checksum);
+
+    free(hands);
+}
+
+
+/**
+ *  @brief  Latency of init_simulator(), in milliseconds, from the built-in tables and from the CSV file. The
+ *  simulator is left initialized from the built-in tables.
+ */
+void bench_init(){
+    double times[NUM_REPEATS];
+
+    for(int r = 0; r < NUM_REPEATS; r++){
+        double start = now_seconds();
+        if(init_simulator("data/eq_classes.csv") == -1){
+            fprintf(stderr,"Error initializing simulator: Can't read file.\n");
+            exit(1);
+        }
+        times[r] = now_seconds() - start;
+    }
+    add_result("init_csv", median(times, NUM_REPEATS) * 1e3, "ms", 0, 0.0);
+
+    for(int r = 0; r < NUM_REPEATS; r++){
+        double start = now_seconds();
+        for(int i = 0; i < INIT_BUILTIN_CALLS; i++) init_simulator(NULL);
+        times[r] = (now_seconds() - start) / INIT_BUILTIN_CALLS;
+    }
+    add_result("init_builtin", median(times, NUM_REPEATS) * 1e3, "ms", 0, 0.0);
+}
+
+
+/**
+ *  @brief  Throughput of the simulators in every spot, in millions of games per second, with the Monte Carlo
+ *  method, one thread and the fixed seed.
+ *
+ * @param quick Whether to do a tenth of the work.
+ */
+void bench_simulations(int quick){
+    int num_games = quick ? SIM_GAMES / QUICK_FACTOR : SIM_GAMES;
+    double times[NUM_REPEATS];
+
+    sim_options_t options;
+    sim_default_options(&options);
+    options.method = SIM_METHOD_MONTE_CARLO;
+    options.seed = BENCH_SEED;
+
+    for(size_t s = 0; s < sizeof(PLAYER_SPOTS) / sizeof(PLAYER_SPOTS[0]); s++){
+        const player_spot_t *spot = &PLAYER_SPOTS[s];
+        double win = 0.0;
+        for(int r = 0; r < NUM_REPEATS; r++){
+            double start = now_seconds();
+            double **probabilities = simulate_player_ex((char **) spot->known_cards, spot->num_known_cards, spot->num_players, num_games, &options, NULL);
+            times[r] = now_seconds() - start;
+            win = probabilities[0][0];
+            free(probabilities[0]);
+            free(probabilities[1]);
+            free(probabilities);
+        }
+        add_result(spot->name, num_games / median(times, NUM_REPEATS) * 1e-6, "Mgames/s", 1, win);
+    }
+
+    for(size_t s = 0; s < sizeof(SPECTATOR_SPOTS) / sizeof(SPECTATOR_SPOTS[0]); s++){
+        const spectator_spot_t *spot = &SPECTATOR_SPOTS[s];
+        double win = 0.0;
+        for(int r = 0; r < NUM_REPEATS; r++){
+            double start = now_seconds();
+            double **probabilities = simulate_spectator_ex((char **) spot->players_cards, (char **) spot->board_cards, NULL, 0,
+                                                           spot->num_board_cards, spot->num_players, num_games, &options, NULL);
+            times[r] = now_seconds() - start;
+            win = probabilities[0][0];
+            for(int i = 0; i < spot->num_players; i++) free(probabilities[i]);
+            free(probabilities);
+        }
+        add_result(spot->name, num_games / median(times, NUM_REPEATS) * 1e-6, "Mgames/s", 1, win);
+    }
+}
+
+
+/**
+ *  @brief  Multi-core scaling of configuration C: games per second and parallel efficiency with 1, 2, 4, ...
+ *  threads and with as many threads as CPUs.
+ *
+ * @param quick Whether to do a tenth of the work.
+ */
+void bench_scaling(int quick){
+    int num_games = quick ? SCALING_GAMES / QUICK_FACTOR : SCALING_GAMES;
+    int num_cpus = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if(num_cpus < 1) num_cpus = 1;
+
+    const player_spot_t *spot = &PLAYER_SPOTS[2];
+    sim_options_t options;
+    sim_default_options(&options);
+    options.method = SIM_METHOD_MONTE_CARLO;
+    options.seed = BENCH_SEED;
+
+    double single_thread = 0.0;
+    for(int num_threads = 1; ; num_threads = (2 * num_threads < num_cpus) ? 2 * num_threads : num_cpus){
+        double times[NUM_REPEATS];
+        double win = 0.0;
+        options.num_threads = num_threads;
+
+        for(int r = 0; r < NUM_REPEATS; r++){
+            double start = now_seconds();
+            double **probabilities = simulate_player_ex((char **) spot->known_cards, spot->num_known_cards, spot->num_players, num_games, &options, NULL);
+            times[r] = now_seconds() - start;
+            win = probabilities[0][0];
+            free(probabilities[0]);
+            free(probabilities[1]);
+            free(probabilities);
+        }
+
+        double games_per_second = num_games / median(times, NUM_REPEATS) * 1e-6;
+        if(num_threads == 1) single_thread = games_per_second;
+
+        char name[48];
+        snprintf(name, sizeof(name), "scaling_C_%dt", num_threads);
+        add_result(name, games_per_second, "Mgames/s", 1, win);
+        snprintf(name, sizeof(name), "scaling_C_%dt_efficiency", num_threads);
+        add_result(name, games_per_second / (single_thread * num_threads), "ratio", 1, 0.0);
+
+        if(num_threads == num_cpus) break;
+    }
+}
+
+
+/**
+ *  @brief  Writing of the results as JSON.
+ *
+ * @param file Path of the JSON file.
+ * @return -1 if the file can not be written, 0 for success.
+ */
+int write_json(const char *file){
+    FILE *out = fopen(file, "w");
+    if(out == NULL){
+        fprintf(stderr,"Error when creating %s.\n", file);
+        return -1;
+    }
+
+    fprintf(out, "{\n  \"seed\": %d,\n  \"cpus\": %ld,\n  \"evaluator_isa\": \"%s\",\n  \"results\": [\n",
+            BENCH_SEED, sysconf(_SC_NPROCESSORS_ONLN), get_scores_batch_isa());
+    for(int i = 0; i < num_results; i++){
+        fprintf(out, "    { \"name\": \"%s\", \"value\": %.6f, \"unit\": \"%s\", \"higher_is_better\": %s, \"check\": %.6f }%s\n",
+                results[i].name, results[i].value, results[i].unit, results[i].higher_is_better ? "true" : "false",
+                results[i].check, (i < num_results - 1) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+
+    if(fclose(out) != 0){
+        fprintf(stderr,"Error when writing %s.\n", file);
+        return -1;
+    }
+    return 0;
+}
+
+
+/**
+ *  @brief  Comparison of the results against a baseline written by write_json(). The results are matched by name,
+ *  and a result is a regression if it is worse than the baseline by more than the threshold. A different check
+ *  value means that the run did different work, so its result is not compared.
+ *
+ * @param file Path of the baseline.
+ * @param threshold Relative change tolerated, e.g. 0.10 for 10%.
+ * @return 2 if there are regressions, 1 if the baseline can not be read, 0 otherwise.
+ */
+int compare_baseline(const char *file, double threshold){
+    FILE *in = fopen(file, "r");
+    if(in == NULL){
+        fprintf(stderr,"Error when opening the baseline %s.\n", file);
+        return 1;
+    }
+
+    int num_regressions = 0;
+    char line[512];
+    printf("\n%-32s %14s %14s %9s\n", "Benchmark", "baseline", "current", "change");
+
+    while(fgets(line, sizeof(line), in) != NULL){
+        char name[48];
+        double value, check;
+        const char *entry = strstr(line, "{ \"name\": \"");
+        if(entry == NULL || sscanf(entry, "{ \"name\": \"%47[^\"]\", \"value\": %lf", name, &value) != 2) continue;
+        const char *check_field = strstr(line, "\"check\": ");
+        if(check_field == NULL || sscanf(check_field, "\"check\": %lf", &check) != 1) continue;
+
+        for(int i = 0; i < num_results; i++){
+            if(strcmp(results[i].name, name) != 0) continue;
+
+            if(results[i].check != check && (results[i].check - check > 1e-3 || check - results[i].check > 1e-3)){
+                printf("%-32s %14.3f %14.3f %9s   (different work, not compared)\n", name, value, results[i].value, "-");
+                break;
+            }
+
+            double change = (value != 0.0) ? (results[i].value - value) / value : 0.0;
+            int regression = results[i].higher_is_better ? (change < -threshold) : (change > threshold);
+            num_regressions += regression;
+            printf("%-32s %14.3f %14.3f %+8.1f%%%s\n", name, value, results[i].value, change * 100.0, regression ? "   REGRESSION" : "");
+            break;
+        }
+    }
+    fclose(in);
+
+    printf("\n%d regression(s) beyond %.1f%%.\n", num_regressions, threshold * 100.0);
+    return (num_regressions > 0) ? 2 : 0;
+}
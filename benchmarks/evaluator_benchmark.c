@@ -0,0 +1,340 @@
+/******************************************************************************
+ * File: evaluator_benchmark.c
+ * Description: Microbenchmark of the 5-card hand evaluator. It compares
+ * get_score(), which finds the hands with repeated ranks with a perfect hash,
+ * against get_score_binary_search(), the original binary search lookup, over
+ * all the 2 598 960 possible 5-card hands, and checks that both return the
+ * same scores. It also compares get_score() against get_scores_batch(), which
+ * scores the same hands in structure-of-arrays layout with the vector
+ * instructions of the CPU. Over random 7-card hands, it checks get_score7(),
+ * get_scores7_batch() and eval_with_hole() on a board prepared with
+ * eval_prepare() against the best of the 21 5-card subsets scored with
+ * get_score(). Finally, it compares the Omaha evaluator
+ * omaha_eval_with_hole() against get_score_omaha(), the best of 60 calls to
+ * get_score(), over random deals of 4 hole cards and 5 community cards.
+ *
+ * Build and run from the root directory of the project:
+ *      gcc -O2 -o evaluator_benchmark benchmarks/evaluator_benchmark.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ *      ./evaluator_benchmark
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "../src/simulation.h"
+
+#define NUM_5CARD_HANDS 2598960
+#define NUM_ROUNDS 10
+#define NUM_OMAHA_DEALS 1000000
+#define OMAHA_SEED 20230701
+#define NUM_7CARD_HANDS 1000000
+#define SEVEN_CARD_SEED 20230702
+
+extern int deck[TOTAL_CARDS];
+
+double elapsed_seconds(struct timespec start, struct timespec end);
+double time_evaluator(unsigned short (*evaluator)(int cards[]), int (*hands)[5], int num_hands, unsigned long *checksum);
+double time_batch_evaluator(const int *hands_soa, unsigned short *scores, int num_hands, unsigned long *checksum);
+double time_omaha_evaluator(int use_reference, int (*deals)[9], int num_deals, unsigned long *checksum);
+void deal_random_cards(rng_t *rng, int cards[], int num_cards);
+unsigned short best_of_21(const int cards[7]);
+
+
+int main(){
+
+    if (init_simulator("data/eq_classes.csv") == -1){
+        printf("Error initializing simulator: Can't read file.\n");
+        return -1;
+    }
+
+    /* All the 5-card hands, and the subset of them with repeated ranks */
+
+    int (*hands)[5] = malloc(NUM_5CARD_HANDS * sizeof(*hands));
+    int (*paired_hands)[5] = malloc(NUM_5CARD_HANDS * sizeof(*paired_hands));
+    if (hands == NULL || paired_hands == NULL){
+        printf("Error allocating the hands.\n");
+        return -1;
+    }
+
+    int num_hands = 0, num_paired_hands = 0;
+    for(int a = 0; a < TOTAL_CARDS; a++)
+    for(int b = a + 1; b < TOTAL_CARDS; b++)
+    for(int c = b + 1; c < TOTAL_CARDS; c++)
+    for(int d = c + 1; d < TOTAL_CARDS; d++)
+    for(int e = d + 1; e < TOTAL_CARDS; e++){
+        int cards[5] = { deck[a], deck[b], deck[c], deck[d], deck[e] };
+        int rank_bits = (cards[0] | cards[1] | cards[2] | cards[3] | cards[4]) >> 16;
+        int num_ranks = 0;
+        for(int r = 0; r < NUM_RANKS; r++) num_ranks += (rank_bits >> r) & 1;
+
+        for(int i = 0; i < 5; i++){
+            hands[num_hands][i] = cards[i];
+            if(num_ranks < 5) paired_hands[num_paired_hands][i] = cards[i];
+        }
+        num_hands++;
+        if(num_ranks < 5) num_paired_hands++;
+    }
+
+    /* Both evaluators must agree on every hand */
+
+    for(int i = 0; i < num_hands; i++){
+        if(get_score(hands[i]) != get_score_binary_search(hands[i])){
+            printf("Score mismatch in hand %d.\n", i);
+            return -1;
+        }
+    }
+
+    /* Same hands in structure-of-arrays layout for the batch evaluator, which must agree too */
+
+    int *hands_soa = malloc(5 * (size_t) num_hands * sizeof(int));
+    unsigned short *batch_scores = malloc(num_hands * sizeof(unsigned short));
+    if (hands_soa == NULL || batch_scores == NULL){
+        printf("Error allocating the hands.\n");
+        return -1;
+    }
+
+    for(int i = 0; i < num_hands; i++){
+        for(int j = 0; j < 5; j++) hands_soa[(size_t) j * num_hands + i] = hands[i][j];
+    }
+    get_scores_batch(hands_soa, batch_scores, num_hands);
+    for(int i = 0; i < num_hands; i++){
+        if(batch_scores[i] != get_score(hands[i])){
+            printf("Batch score mismatch in hand %d.\n", i);
+            return -1;
+        }
+    }
+
+    unsigned long checksum = 0;
+    double hash_all = time_evaluator(get_score, hands, num_hands, &checksum);
+    double search_all = time_evaluator(get_score_binary_search, hands, num_hands, &checksum);
+    double hash_paired = time_evaluator(get_score, paired_hands, num_paired_hands, &checksum);
+    double search_paired = time_evaluator(get_score_binary_search, paired_hands, num_paired_hands, &checksum);
+    double batch_all = time_batch_evaluator(hands_soa, batch_scores, num_hands, &checksum);
+
+    printf("\n%-28s %16s %16s %9s\n", "Hands", "binary search", "perfect hash", "speedup");
+    printf("%-28s %12.2f ns %12.2f ns %8.2fx\n", "All 5-card hands",
+           search_all * 1e9 / ((double) num_hands * NUM_ROUNDS), hash_all * 1e9 / ((double) num_hands * NUM_ROUNDS), search_all / hash_all);
+    printf("%-28s %12.2f ns %12.2f ns %8.2fx\n", "Hands with repeated ranks",
+           search_paired * 1e9 / ((double) num_paired_hands * NUM_ROUNDS), hash_paired * 1e9 / ((double) num_paired_hands * NUM_ROUNDS), search_paired / hash_paired);
+
+    printf("\n%-28s %16s %16s %9s\n", "Hands", "get_score", "batch", "speedup");
+    printf("%-28s %12.2f ns %12.2f ns %8.2fx   (%s)\n", "All 5-card hands",
+           hash_all * 1e9 / ((double) num_hands * NUM_ROUNDS), batch_all * 1e9 / ((double) num_hands * NUM_ROUNDS), hash_all / batch_all,
+           get_scores_batch_isa());
+
+    /* Random 7-card hands: the 7-card evaluators must agree with the best of the 21 5-card subsets */
+
+    int *hands7_soa = malloc(7 * (size_t) NUM_7CARD_HANDS * sizeof(int));
+    unsigned short *batch7_scores = malloc(NUM_7CARD_HANDS * sizeof(unsigned short));
+    if (hands7_soa == NULL || batch7_scores == NULL){
+        printf("Error allocating the hands.\n");
+        return -1;
+    }
+
+    rng_t rng;
+    rng_seed(&rng, RNG_XOSHIRO256SS, SEVEN_CARD_SEED, 0);
+    for(int i = 0; i < NUM_7CARD_HANDS; i++){
+        int cards[7];
+        deal_random_cards(&rng, cards, 7);
+        for(int j = 0; j < 7; j++) hands7_soa[(size_t) j * NUM_7CARD_HANDS + i] = cards[j];
+
+        unsigned short reference = best_of_21(cards);
+        if(get_score7(cards) != reference){
+            printf("7-card score mismatch in hand %d.\n", i);
+            return -1;
+        }
+
+        // Cards 0 and 1 are the hole cards, the rest the board
+        eval_board_t board = eval_prepare(&cards[2]);
+        if(eval_with_hole(&board, cards[0], cards[1]) != reference){
+            printf("Score mismatch with a prepared board in hand %d.\n", i);
+            return -1;
+        }
+    }
+
+    get_scores7_batch(hands7_soa, batch7_scores, NUM_7CARD_HANDS);
+    for(int i = 0; i < NUM_7CARD_HANDS; i++){
+        int cards[7];
+        for(int j = 0; j < 7; j++) cards[j] = hands7_soa[(size_t) j * NUM_7CARD_HANDS + i];
+        if(batch7_scores[i] != best_of_21(cards)){
+            printf("7-card batch score mismatch in hand %d.\n", i);
+            return -1;
+        }
+    }
+    printf("\n%d random 7-card hands checked against the best of their 21 5-card hands.\n", NUM_7CARD_HANDS);
+
+    /* Random Omaha deals: 4 hole cards and 5 community cards. Both Omaha evaluators must agree on every deal. */
+
+    int (*deals)[9] = malloc(NUM_OMAHA_DEALS * sizeof(*deals));
+    if (deals == NULL){
+        printf("Error allocating the deals.\n");
+        return -1;
+    }
+
+    rng_seed(&rng, RNG_XOSHIRO256SS, OMAHA_SEED, 0);
+    for(int i = 0; i < NUM_OMAHA_DEALS; i++){
+        deal_random_cards(&rng, deals[i], 9);
+
+        omaha_board_t board = omaha_prepare(&deals[i][4]);
+        if(omaha_eval_with_hole(&board, deals[i]) != get_score_omaha(deals[i], &deals[i][4])){
+            printf("Omaha score mismatch in deal %d.\n", i);
+            return -1;
+        }
+    }
+
+    double omaha_reference = time_omaha_evaluator(1, deals, NUM_OMAHA_DEALS, &checksum);
+    double omaha_fast = time_omaha_evaluator(0, deals, NUM_OMAHA_DEALS, &checksum);
+
+    printf("\n%-28s %16s %16s %9s\n", "Hands", "60 x get_score", "omaha_eval", "speedup");
+    printf("%-28s %12.2f ns %12.2f ns %8.2fx\n", "Random Omaha deals",
+           omaha_reference * 1e9 / ((double) NUM_OMAHA_DEALS * NUM_ROUNDS), omaha_fast * 1e9 / ((double) NUM_OMAHA_DEALS * NUM_ROUNDS),
+           omaha_reference / omaha_fast);
+    printf("\n(checksum %lu)\n", checksum);
+
+    free(deals);
+    free(hands);
+    free(paired_hands);
+    free(hands_soa);
+    free(batch_scores);
+    free(hands7_soa);
+    free(batch7_scores);
+    return 0;
+}
+
+
+/**
+ *  @brief  Seconds elapsed between two instants.
+ *
+ * @param start Initial instant.
+ * @param end Final instant.
+ * @return Elapsed seconds.
+ */
+double elapsed_seconds(struct timespec start, struct timespec end){
+    return (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_nsec - start.tv_nsec) * 1e-9;
+}
+
+
+/**
+ *  @brief  Measures the time an evaluator takes to score a set of hands NUM_ROUNDS times.
+ *
+ * @param evaluator Evaluator to measure.
+ * @param hands Hands to score.
+ * @param num_hands Number of hands.
+ * @param checksum Sum of the scores, so that the compiler can not discard the evaluations.
+ * @return Elapsed seconds.
+ */
+double time_evaluator(unsigned short (*evaluator)(int cards[]), int (*hands)[5], int num_hands, unsigned long *checksum){
+    struct timespec start, end;
+    unsigned long sum = 0;
+
+    timespec_get(&start, TIME_UTC);
+    for(int round = 0; round < NUM_ROUNDS; round++){
+        for(int i = 0; i < num_hands; i++){
+            sum += evaluator(hands[i]);
+        }
+    }
+    timespec_get(&end, TIME_UTC);
+
+    *checksum += sum;
+    return elapsed_seconds(start, end);
+}
+
+
+/**
+ *  @brief  Measures the time get_scores_batch() takes to score a set of hands NUM_ROUNDS times.
+ *
+ * @param hands_soa Hands to score, card j of hand i at hands_soa[j * num_hands + i].
+ * @param scores Array where the scores are stored.
+ * @param num_hands Number of hands.
+ * @param checksum Sum of the scores, so that the compiler can not discard the evaluations.
+ * @return Elapsed seconds.
+ */
+double time_batch_evaluator(const int *hands_soa, unsigned short *scores, int num_hands, unsigned long *checksum){
+    struct timespec start, end;
+    unsigned long sum = 0;
+
+    timespec_get(&start, TIME_UTC);
+    for(int round = 0; round < NUM_ROUNDS; round++){
+        get_scores_batch(hands_soa, scores, num_hands);
+        sum += scores[round % num_hands];
+    }
+    timespec_get(&end, TIME_UTC);
+
+    *checksum += sum;
+    return elapsed_seconds(start, end);
+}
+
+
+/**
+ *  @brief  Measures the time an Omaha evaluator takes to score a set of deals NUM_ROUNDS times. The fast evaluator
+ *  prepares the board of every deal, so its time includes omaha_prepare().
+ *
+ * @param use_reference 1 to measure get_score_omaha(), 0 to measure omaha_prepare() and omaha_eval_with_hole().
+ * @param deals Deals to score: 4 hole cards and 5 community cards.
+ * @param num_deals Number of deals.
+ * @param checksum Sum of the scores, so that the compiler can not discard the evaluations.
+ * @return Elapsed seconds.
+ */
+double time_omaha_evaluator(int use_reference, int (*deals)[9], int num_deals, unsigned long *checksum){
+    struct timespec start, end;
+    unsigned long sum = 0;
+
+    timespec_get(&start, TIME_UTC);
+    for(int round = 0; round < NUM_ROUNDS; round++){
+        for(int i = 0; i < num_deals; i++){
+            if(use_reference){
+                sum += get_score_omaha(deals[i], &deals[i][4]);
+            } else {
+                omaha_board_t board = omaha_prepare(&deals[i][4]);
+                sum += omaha_eval_with_hole(&board, deals[i]);
+            }
+        }
+    }
+    timespec_get(&end, TIME_UTC);
+
+    *checksum += sum;
+    return elapsed_seconds(start, end);
+}
+
+
+/**
+ *  @brief  Deals distinct random cards from the whole deck.
+ *
+ * @param rng Random number generator.
+ * @param cards Where the dealt cards are stored, with the Cactus Kev encoding.
+ * @param num_cards Number of cards to deal.
+ */
+void deal_random_cards(rng_t *rng, int cards[], int num_cards){
+    int remaining[TOTAL_CARDS];
+    for(int j = 0; j < TOTAL_CARDS; j++) remaining[j] = j;
+    for(int j = 0; j < num_cards; j++){
+        int k = j + (int) rng_bounded(rng, TOTAL_CARDS - j);
+        int card = remaining[k];
+        remaining[k] = remaining[j];
+        remaining[j] = card;
+        cards[j] = deck[card];
+    }
+}
+
+
+/**
+ *  @brief  Reference score of a 7-card hand: the best score of its 21 5-card subsets, scored with get_score().
+ *
+ * @param cards Cards of the hand, with the Cactus Kev encoding.
+ * @return Best (lowest) score.
+ */
+unsigned short best_of_21(const int cards[7]){
+    unsigned short best = 0xFFFF;
+
+    for(int a = 0; a < 7; a++)
+    for(int b = a + 1; b < 7; b++){
+        int hand[5], n = 0;
+        for(int j = 0; j < 7; j++){
+            if(j != a && j != b) hand[n++] = cards[j];
+        }
+        unsigned short score = get_score(hand);
+        if(score < best) best = score;
+    }
+
+    return best;
+}
@@ -0,0 +1,158 @@
+/******************************************************************************
+ * File: qmc_convergence.c
+ * Description: Convergence study of quasi-Monte Carlo dealing against the
+ * shuffle-based sampler. For spots whose exact probabilities are enumerated,
+ * it measures the root mean square error of the win probability of player 0
+ * over independent seeds, for doubling numbers of games, with plain Monte
+ * Carlo (SIM_VR_NONE) and with the quasi-random sequence
+ * (SIM_VR_QUASI_RANDOM). The slope of log(error) against log(games) is
+ * -0.5 for plain Monte Carlo; the closer to -1, the better the sequence.
+ * It also reports the mean standard error that the quasi-random runs
+ * estimated from their shifted replicates, which should match their error.
+ *
+ * Build and run from the root directory of the project:
+ *      gcc -O2 -o qmc_convergence benchmarks/qmc_convergence.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ *      ./qmc_convergence [repeats]
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "../src/simulation.h"
+
+#define MIN_GAMES 1000
+#define NUM_SIZES 7             // MIN_GAMES, 2 * MIN_GAMES, ..., 64 * MIN_GAMES
+#define DEFAULT_REPEATS 32
+#define SEED 20230701
+
+/* Spot of the study, with known cards only so that it can be enumerated */
+
+typedef struct {
+    const char *name;
+    char *players_cards[6];
+    int num_players;
+    char *board_cards[4];
+    int num_board_cards;
+} spot_t;
+
+double exact_win(const spot_t *spot);
+double measure_rmse(const spot_t *spot, double exact, sim_variance_reduction_t method, int num_games, int repeats, double *mean_std_error);
+double fit_slope(const double games[], const double errors[], int n);
+
+
+int main(int argc, char *argv[]){
+    int repeats = (argc > 1) ? atoi(argv[1]) : DEFAULT_REPEATS;
+    if(repeats < 2) repeats = 2;
+
+    static const spot_t spots[] = {
+        {"AH KH vs QS QD, flop 2H 7C 9D", {"AH", "KH", "QS", "QD"}, 2, {"2H", "7C", "9D"}, 3},
+        {"AH KH vs QS QD, turn 2H 7C 9D JH", {"AH", "KH", "QS", "QD"}, 2, {"2H", "7C", "9D", "JH"}, 4},
+        {"AH KH vs QS QD vs 7S 6S, preflop", {"AH", "KH", "QS", "QD", "7S", "6S"}, 3, {NULL}, 0},
+    };
+    int num_spots = sizeof(spots) / sizeof(spots[0]);
+
+    init_simulator(NULL);
+
+    for(int s = 0; s < num_spots; s++){
+        double exact = exact_win(&spots[s]);
+        double games[NUM_SIZES], plain_errors[NUM_SIZES], qmc_errors[NUM_SIZES];
+
+        printf("\n%s: exact win of player 0 %.4f%%, %d repeats\n", spots[s].name, exact, repeats);
+        printf("%10s %16s %16s %10s %16s\n", "games", "RMSE shuffle", "RMSE QMC", "ratio", "QMC est. SE");
+
+        for(int i = 0; i < NUM_SIZES; i++){
+            double mean_std_error, unused;
+            games[i] = (double) (MIN_GAMES << i);
+            plain_errors[i] = measure_rmse(&spots[s], exact, SIM_VR_NONE, MIN_GAMES << i, repeats, &unused);
+            qmc_errors[i] = measure_rmse(&spots[s], exact, SIM_VR_QUASI_RANDOM, MIN_GAMES << i, repeats, &mean_std_error);
+            printf("%10d %16.4f %16.4f %10.2f %16.4f\n", MIN_GAMES << i, plain_errors[i], qmc_errors[i],
+                   plain_errors[i] / qmc_errors[i], mean_std_error);
+        }
+
+        printf("slope of log(RMSE) vs log(games): shuffle %.2f, QMC %.2f\n",
+               fit_slope(games, plain_errors, NUM_SIZES), fit_slope(games, qmc_errors, NUM_SIZES));
+    }
+
+    return 0;
+}
+
+
+/**
+ *  @brief  Exact win probability of player 0 of a spot.
+ *
+ * @param spot Spot.
+ * @return Win probability, in percentage.
+ */
+double exact_win(const spot_t *spot){
+    sim_options_t options;
+    sim_default_options(&options);
+    options.method = SIM_METHOD_EXACT;
+
+    double **probabilities = simulate_spectator_ex((char **) spot->players_cards, (char **) spot->board_cards, NULL, 0,
+                                                   spot->num_board_cards, spot->num_players, 0, &options, NULL);
+    double win = probabilities[0][0];
+
+    for(int i = 0; i < spot->num_players; i++) free(probabilities[i]);
+    free(probabilities);
+    return win;
+}
+
+
+/**
+ *  @brief  Root mean square error of the win probability of player 0 over simulations with different seeds.
+ *
+ * @param spot Spot.
+ * @param exact Exact win probability, in percentage.
+ * @param method Variance reduction of the simulations.
+ * @param num_games Games of every simulation.
+ * @param repeats Number of simulations.
+ * @param mean_std_error Where the mean standard error reported by the simulations is stored.
+ * @return Root mean square error, in percentage points.
+ */
+double measure_rmse(const spot_t *spot, double exact, sim_variance_reduction_t method, int num_games, int repeats, double *mean_std_error){
+    sim_options_t options;
+    sim_info_t info;
+    double squared_errors = 0.0, std_errors = 0.0;
+
+    sim_default_options(&options);
+    options.method = SIM_METHOD_MONTE_CARLO;
+    options.variance_reduction = method;
+
+    for(int r = 0; r < repeats; r++){
+        options.seed = SEED + (uint64_t) r;
+        double **probabilities = simulate_spectator_ex((char **) spot->players_cards, (char **) spot->board_cards, NULL, 0,
+                                                       spot->num_board_cards, spot->num_players, num_games, &options, &info);
+        double error = probabilities[0][0] - exact;
+        squared_errors += error * error;
+        std_errors += info.win_std_error[0];
+
+        for(int i = 0; i < spot->num_players; i++) free(probabilities[i]);
+        free(probabilities);
+    }
+
+    *mean_std_error = std_errors / repeats;
+    return sqrt(squared_errors / repeats);
+}
+
+
+/**
+ *  @brief  Least squares slope of log(errors) against log(games).
+ *
+ * @param games Number of games of every point.
+ * @param errors Error of every point.
+ * @param n Number of points.
+ * @return Slope.
+ */
+double fit_slope(const double games[], const double errors[], int n){
+    double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+
+    for(int i = 0; i < n; i++){
+        double x = log(games[i]), y = log(errors[i]);
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+
+    return (n * sum_xy - sum_x * sum_y) / (n * sum_xx - sum_x * sum_x);
+}
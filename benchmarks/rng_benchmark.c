@@ -0,0 +1,174 @@
+/******************************************************************************
+ * File: rng_benchmark.c
+ * Description: Benchmark of the random number generators used to shuffle the
+ * deck. It compares the libc rand() path the simulator used to have (rand()
+ * reduced with a division, which is biased) against xoshiro256** and PCG32
+ * reduced with Lemire's unbiased method, both for raw bounded numbers and for
+ * complete shuffles of a 50-card deck.
+ *
+ * Build and run from the root directory of the project:
+ *      gcc -O2 -o rng_benchmark benchmarks/rng_benchmark.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ *      ./rng_benchmark
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "../src/simulation.h"
+
+#define NUM_DRAWS 100000000
+#define NUM_SHUFFLES 2000000
+#define DECK_SIZE 50
+#define SEED 20230701
+
+double elapsed_seconds(struct timespec start, struct timespec end);
+double time_rand_draws(unsigned long *checksum);
+double time_rng_draws(rng_kind_t kind, unsigned long *checksum);
+double time_rand_shuffles(unsigned long *checksum);
+double time_rng_shuffles(rng_kind_t kind, unsigned long *checksum);
+
+
+int main(){
+    unsigned long checksum = 0;
+
+    double rand_draws = time_rand_draws(&checksum);
+    double xoshiro_draws = time_rng_draws(RNG_XOSHIRO256SS, &checksum);
+    double pcg_draws = time_rng_draws(RNG_PCG32, &checksum);
+
+    double rand_shuffles = time_rand_shuffles(&checksum);
+    double xoshiro_shuffles = time_rng_shuffles(RNG_XOSHIRO256SS, &checksum);
+    double pcg_shuffles = time_rng_shuffles(RNG_PCG32, &checksum);
+
+    printf("\n%-34s %18s %18s\n", "Generator", "Mdraws/s [0,n)", "shuffles/s (50)");
+    printf("%-34s %18.1f %18.0f\n", "rand() + division (biased)", NUM_DRAWS / rand_draws * 1e-6, NUM_SHUFFLES / rand_shuffles);
+    printf("%-34s %18.1f %18.0f\n", "xoshiro256** + Lemire (default)", NUM_DRAWS / xoshiro_draws * 1e-6, NUM_SHUFFLES / xoshiro_shuffles);
+    printf("%-34s %18.1f %18.0f\n", "PCG32 + Lemire", NUM_DRAWS / pcg_draws * 1e-6, NUM_SHUFFLES / pcg_shuffles);
+    printf("\n(checksum %lu)\n", checksum);
+
+    return 0;
+}
+
+
+/**
+ *  @brief  Seconds elapsed between two instants.
+ *
+ * @param start Initial instant.
+ * @param end Final instant.
+ * @return Elapsed seconds.
+ */
+double elapsed_seconds(struct timespec start, struct timespec end){
+    return (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_nsec - start.tv_nsec) * 1e-9;
+}
+
+
+/**
+ *  @brief  Measures NUM_DRAWS numbers in [0,n) with rand() and a division, as the old shuffle did.
+ *  The bound n cycles over the sizes of a deck during a shuffle.
+ *
+ * @param checksum Sum of the numbers, so that the compiler can not discard them.
+ * @return Elapsed seconds.
+ */
+double time_rand_draws(unsigned long *checksum){
+    struct timespec start, end;
+    unsigned long sum = 0;
+
+    srand(SEED);
+    timespec_get(&start, TIME_UTC);
+    for(int i = 0; i < NUM_DRAWS; i++){
+        unsigned int n = DECK_SIZE - (i % (DECK_SIZE - 1));
+        sum += rand() / (RAND_MAX / n + 1);
+    }
+    timespec_get(&end, TIME_UTC);
+
+    *checksum += sum;
+    return elapsed_seconds(start, end);
+}
+
+
+/**
+ *  @brief  Measures NUM_DRAWS numbers in [0,n) with a generator of the simulator and rng_bounded().
+ *
+ * @param kind Generator to measure.
+ * @param checksum Sum of the numbers, so that the compiler can not discard them.
+ * @return Elapsed seconds.
+ */
+double time_rng_draws(rng_kind_t kind, unsigned long *checksum){
+    struct timespec start, end;
+    unsigned long sum = 0;
+    rng_t rng;
+
+    rng_seed(&rng, kind, SEED, 0);
+    timespec_get(&start, TIME_UTC);
+    for(int i = 0; i < NUM_DRAWS; i++){
+        unsigned int n = DECK_SIZE - (i % (DECK_SIZE - 1));
+        sum += rng_bounded(&rng, n);
+    }
+    timespec_get(&end, TIME_UTC);
+
+    *checksum += sum;
+    return elapsed_seconds(start, end);
+}
+
+
+/**
+ *  @brief  Measures NUM_SHUFFLES shuffles of a deck with the old rand() based shuffle.
+ *
+ * @param checksum Sum of the first card of every shuffle, so that the compiler can not discard them.
+ * @return Elapsed seconds.
+ */
+double time_rand_shuffles(unsigned long *checksum){
+    struct timespec start, end;
+    int deck_cards[DECK_SIZE];
+    unsigned long sum = 0;
+
+    for(int i = 0; i < DECK_SIZE; i++) deck_cards[i] = i;
+
+    srand(SEED);
+    timespec_get(&start, TIME_UTC);
+    for(int s = 0; s < NUM_SHUFFLES; s++){
+        for(int i = 0; i < DECK_SIZE - 1; i++){
+            int j = i + rand() / (RAND_MAX / (DECK_SIZE - i) + 1);
+            int t = deck_cards[j];
+            deck_cards[j] = deck_cards[i];
+            deck_cards[i] = t;
+        }
+        sum += deck_cards[0];
+    }
+    timespec_get(&end, TIME_UTC);
+
+    *checksum += sum;
+    return elapsed_seconds(start, end);
+}
+
+
+/**
+ *  @brief  Measures NUM_SHUFFLES shuffles of a deck with a generator of the simulator and rng_bounded().
+ *
+ * @param kind Generator to measure.
+ * @param checksum Sum of the first card of every shuffle, so that the compiler can not discard them.
+ * @return Elapsed seconds.
+ */
+double time_rng_shuffles(rng_kind_t kind, unsigned long *checksum){
+    struct timespec start, end;
+    int deck_cards[DECK_SIZE];
+    unsigned long sum = 0;
+    rng_t rng;
+
+    for(int i = 0; i < DECK_SIZE; i++) deck_cards[i] = i;
+
+    rng_seed(&rng, kind, SEED, 0);
+    timespec_get(&start, TIME_UTC);
+    for(int s = 0; s < NUM_SHUFFLES; s++){
+        for(int i = 0; i < DECK_SIZE - 1; i++){
+            int j = i + (int) rng_bounded(&rng, DECK_SIZE - i);
+            int t = deck_cards[j];
+            deck_cards[j] = deck_cards[i];
+            deck_cards[i] = t;
+        }
+        sum += deck_cards[0];
+    }
+    timespec_get(&end, TIME_UTC);
+
+    *checksum += sum;
+    return elapsed_seconds(start, end);
+}
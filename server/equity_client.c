@@ -0,0 +1,395 @@
+/******************************************************************************
+ * File: equity_client.c
+ * Description: Command line client of the equity server (equity_server.c).
+ * It shows how to speak the protocol of equity_protocol.h, without linking
+ * the simulator, and measures the latency and throughput of a server by
+ * keeping several requests in flight.
+ *
+ * Build from the root directory of the project:
+ *      gcc -O2 -o equity_client server/equity_client.c
+ *      ./equity_client player 3 100000 AH KH 2C 7D 9H
+ *      ./equity_client spectator 100000 AH KH QS QC --board 2C 7D 9H
+ *      ./equity_client load 10000 32 20000
+ *      ./equity_client stats
+ ****************************************************************************/
+
+#include "equity_protocol.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define CARD_RANK_NAMES "23456789TJQKA"
+#define CARD_SUIT_NAMES "CDHS"
+#define LOAD_SEED 0x9E3779B97F4A7C15ULL
+
+
+int connect_server(const char *socket_path);
+int parse_card(const char *text);
+int send_request(int fd, uint16_t type, uint32_t id, const void *payload, uint32_t length);
+int read_response(int fd, eq_header_t *header, unsigned char payload[EQ_MAX_PAYLOAD]);
+int read_all(int fd, void *buffer, size_t length);
+int simulate(int fd, const eq_simulate_request_t *request);
+int print_stats(int fd);
+int run_load(int fd, int num_requests, int in_flight, int num_games);
+void random_request(eq_simulate_request_t *request, uint64_t *state, int num_games);
+double now_seconds();
+int compare_doubles(const void *a, const void *b);
+
+
+int main(int argc, char *argv[]){
+    const char *socket_path = EQ_DEFAULT_SOCKET;
+    int first = 1;
+    if(argc > 2 && strcmp(argv[1], "--socket") == 0){
+        socket_path = argv[2];
+        first = 3;
+    }
+
+    if(argc <= first){
+        fprintf(stderr,"Usage: %s [--socket path] player <players> <games> <card> <card> [board cards]\n"
+                       "       %s [--socket path] spectator <games> <cards of every player> [--board <board cards>]\n"
+                       "       %s [--socket path] load <requests> <requests in flight> <games>\n"
+                       "       %s [--socket path] stats\n", argv[0], argv[0], argv[0], argv[0]);
+        return 1;
+    }
+
+    int fd = connect_server(socket_path);
+    if(fd == -1) return 1;
+
+    const char *command = argv[first];
+    char **args = argv + first + 1;
+    int num_args = argc - first - 1;
+    int error = 0;
+
+    if(strcmp(command, "stats") == 0){
+        error = print_stats(fd);
+    } else if(strcmp(command, "load") == 0 && num_args == 3){
+        error = run_load(fd, atoi(args[0]), atoi(args[1]), atoi(args[2]));
+    } else if(strcmp(command, "player") == 0 && num_args >= 4){
+        eq_simulate_request_t request;
+        memset(&request, 0, sizeof(request));
+        request.mode = SIM_MODE_PLAYER;
+        request.num_players = (uint8_t) atoi(args[0]);
+        request.num_games = (uint32_t) atoi(args[1]);
+        request.num_board_cards = (uint8_t) (num_args - 4);
+        for(int i = 0; i < 2; i++) request.players_cards[0][i] = (uint8_t) parse_card(args[2 + i]);
+        for(int i = 0; i < num_args - 4 && i < 5; i++) request.board_cards[i] = (uint8_t) parse_card(args[4 + i]);
+        error = simulate(fd, &request);
+    } else if(strcmp(command, "spectator") == 0 && num_args >= 5){
+        eq_simulate_request_t request;
+        memset(&request, 0, sizeof(request));
+        request.mode = SIM_MODE_SPECTATOR;
+        request.num_games = (uint32_t) atoi(args[0]);
+
+        int i = 1, num_cards = 0;
+        for(; i < num_args && strcmp(args[i], "--board") != 0; i++, num_cards++){
+            if(num_cards < 2 * MAX_PLAYERS) request.players_cards[num_cards / 2][num_cards % 2] = (uint8_t) parse_card(args[i]);
+        }
+        request.num_players = (uint8_t) (num_cards / 2);
+        for(i++; i < num_args && request.num_board_cards < 5; i++){
+            request.board_cards[request.num_board_cards++] = (uint8_t) parse_card(args[i]);
+        }
+        error = simulate(fd, &request);
+    } else {
+        fprintf(stderr,"Error: unknown command or wrong number of arguments.\n");
+        error = 1;
+    }
+
+    close(fd);
+    return error;
+}
+
+
+/**
+ * @brief Connection to the server.
+ *
+ * @param socket_path Path of the socket of the server.
+ * @return Descriptor of the connection, -1 if it can not be established.
+ */
+int connect_server(const char *socket_path){
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if(strlen(socket_path) >= sizeof(address.sun_path)){
+        fprintf(stderr,"Error: the path of the socket is too long.\n");
+        return -1;
+    }
+    strcpy(address.sun_path, socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd == -1 || connect(fd, (struct sockaddr *) &address, sizeof(address)) == -1){
+        perror(socket_path);
+        if(fd != -1) close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+
+/**
+ * @brief Conversion of a card such as "AH" into an integer in [0,51], as cardtype_to_num() does.
+ *
+ * @param text Rank and suit of the card.
+ * @return Card, or TOTAL_CARDS (rejected by the server) if the text is not a card.
+ */
+int parse_card(const char *text){
+    const char *rank = (text[0] != '\0') ? strchr(CARD_RANK_NAMES, text[0]) : NULL;
+    const char *suit = (text[0] != '\0' && text[1] != '\0') ? strchr(CARD_SUIT_NAMES, text[1]) : NULL;
+    if(rank == NULL || suit == NULL || text[2] != '\0') return TOTAL_CARDS;
+    return (int) (suit - CARD_SUIT_NAMES) * NUM_RANKS + (int) (rank - CARD_RANK_NAMES);
+}
+
+
+/**
+ * @brief Sending of a request.
+ *
+ * @param fd Connection.
+ * @param type Type of the request.
+ * @param id Id of the request.
+ * @param payload Payload of the request.
+ * @param length Bytes of the payload.
+ * @return -1 if it can not be sent, 0 for success.
+ */
+int send_request(int fd, uint16_t type, uint32_t id, const void *payload, uint32_t length){
+    unsigned char frame[sizeof(eq_header_t) + sizeof(eq_simulate_request_t)];
+    eq_header_t header = { EQ_MAGIC, type, 0, id, length };
+
+    memcpy(frame, &header, sizeof(header));
+    if(length > 0) memcpy(frame + sizeof(header), payload, length);
+
+    size_t total = sizeof(header) + length, sent = 0;
+    while(sent < total){
+        ssize_t n = write(fd, frame + sent, total - sent);
+        if(n == -1 && errno == EINTR) continue;
+        if(n <= 0) return -1;
+        sent += (size_t) n;
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Reading of a response.
+ *
+ * @param fd Connection.
+ * @param header Where the header of the response is stored.
+ * @param payload Where the payload of the response is stored.
+ * @return -1 if the connection was closed or the response is not valid, 0 for success.
+ */
+int read_response(int fd, eq_header_t *header, unsigned char payload[EQ_MAX_PAYLOAD]){
+    if(read_all(fd, header, sizeof(eq_header_t)) == -1 || header->magic != EQ_MAGIC || header->length > EQ_MAX_PAYLOAD){
+        return -1;
+    }
+    return read_all(fd, payload, header->length);
+}
+
+
+/**
+ * @brief Reading of exactly length bytes.
+ *
+ * @param fd Connection.
+ * @param buffer Where the bytes are stored.
+ * @param length Number of bytes.
+ * @return -1 if the connection was closed before, 0 for success.
+ */
+int read_all(int fd, void *buffer, size_t length){
+    size_t received = 0;
+    while(received < length){
+        ssize_t n = read(fd, (unsigned char *) buffer + received, length - received);
+        if(n == -1 && errno == EINTR) continue;
+        if(n <= 0) return -1;
+        received += (size_t) n;
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Simulation of a scenario by the server, and printing of its result.
+ *
+ * @param fd Connection.
+ * @param request Scenario to simulate.
+ * @return 1 if the server could not solve it, 0 for success.
+ */
+int simulate(int fd, const eq_simulate_request_t *request){
+    eq_header_t header;
+    unsigned char payload[EQ_MAX_PAYLOAD];
+    double start = now_seconds();
+
+    if(send_request(fd, EQ_SIMULATE, 1, request, sizeof(*request)) == -1 || read_response(fd, &header, payload) == -1){
+        fprintf(stderr,"Error: connection lost.\n");
+        return 1;
+    }
+    if(header.status != EQ_OK){
+        fprintf(stderr,"Error: the server answered with status %d.\n", header.status);
+        return 1;
+    }
+
+    eq_simulate_response_t response;
+    memcpy(&response, payload, sizeof(response));
+    printf("%u games, method %d, %.3f ms\n", response.num_games, response.method, (now_seconds() - start) * 1e3);
+
+    for(int i = 0; i < response.num_rows; i++){
+        eq_row_t row;
+        memcpy(&row, payload + sizeof(response) + i * sizeof(eq_row_t), sizeof(row));
+        printf("row %d: win %.3f%% (+-%.3f)  defeat %.3f%%  tie %.3f%% (+-%.3f)\n", i, row.probabilities[0], row.win_std_error,
+               row.probabilities[1], row.probabilities[2], row.tie_std_error);
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Printing of the counters of the server.
+ *
+ * @param fd Connection.
+ * @return 1 if they can not be obtained, 0 for success.
+ */
+int print_stats(int fd){
+    eq_header_t header;
+    unsigned char payload[EQ_MAX_PAYLOAD];
+
+    if(send_request(fd, EQ_STATS, 1, NULL, 0) == -1 || read_response(fd, &header, payload) == -1 ||
+       header.status != EQ_OK || header.length != sizeof(eq_stats_t)){
+        fprintf(stderr,"Error: the server did not send its counters.\n");
+        return 1;
+    }
+
+    eq_stats_t stats;
+    memcpy(&stats, payload, sizeof(stats));
+    printf("uptime %.1f s, %llu connections\n", stats.uptime_us / 1e6, (unsigned long long) stats.connections);
+    printf("%llu requests (%.1f/s), %llu errors, %llu games\n", (unsigned long long) stats.requests, stats.requests_per_second,
+           (unsigned long long) stats.errors, (unsigned long long) stats.games);
+    printf("%llu batches, %.1f requests per batch\n", (unsigned long long) stats.batches, stats.mean_batch_size);
+    printf("result cache: %llu hits of %llu lookups\n", (unsigned long long) stats.cache_hits, (unsigned long long) stats.cache_lookups);
+    printf("latency: mean %.1f us, p50 <= %.0f us, p99 <= %.0f us, max %llu us\n", stats.latency_mean_us, stats.latency_p50_us,
+           stats.latency_p99_us, (unsigned long long) stats.latency_max_us);
+    return 0;
+}
+
+
+/**
+ * @brief Load test: random player's perspective scenarios (2 to 6 players, preflop or on the flop) with up to
+ * in_flight requests sent and not answered yet. The round trip of every request is measured.
+ *
+ * @param fd Connection.
+ * @param num_requests Number of requests.
+ * @param in_flight Maximum number of requests in flight.
+ * @param num_games Games of every request.
+ * @return 1 if a request fails, 0 for success.
+ */
+int run_load(int fd, int num_requests, int in_flight, int num_games){
+    if(num_requests < 1 || in_flight < 1 || num_games < 1){
+        fprintf(stderr,"Error: the requests, the requests in flight and the games must be positive.\n");
+        return 1;
+    }
+
+    double *sent_at = malloc(num_requests * sizeof(double));
+    double *latencies = malloc(num_requests * sizeof(double));
+    if(sent_at == NULL || latencies == NULL) return 1;
+
+    uint64_t state = LOAD_SEED;
+    int num_sent = 0, num_received = 0, error = 0;
+    double start = now_seconds();
+
+    while(num_received < num_requests && !error){
+        while(num_sent < num_requests && num_sent - num_received < in_flight){
+            eq_simulate_request_t request;
+            random_request(&request, &state, num_games);
+            sent_at[num_sent] = now_seconds();
+            if(send_request(fd, EQ_SIMULATE, (uint32_t) num_sent, &request, sizeof(request)) == -1) error = 1;
+            num_sent++;
+        }
+
+        eq_header_t header;
+        unsigned char payload[EQ_MAX_PAYLOAD];
+        if(error || read_response(fd, &header, payload) == -1 || header.status != EQ_OK || header.id >= (uint32_t) num_sent){
+            error = 1;
+            break;
+        }
+        latencies[num_received++] = now_seconds() - sent_at[header.id];
+    }
+
+    double elapsed = now_seconds() - start;
+
+    if(error){
+        fprintf(stderr,"Error: request %d failed.\n", num_received);
+    } else {
+        double total = 0.0;
+        for(int i = 0; i < num_requests; i++) total += latencies[i];
+        qsort(latencies, num_requests, sizeof(double), compare_doubles);
+        printf("%d requests of %d games in %.3f s: %.1f requests/s\n", num_requests, num_games, elapsed, num_requests / elapsed);
+        printf("round trip: mean %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us\n", total / num_requests * 1e6,
+               latencies[num_requests / 2] * 1e6, latencies[(int) (num_requests * 0.99)] * 1e6, latencies[num_requests - 1] * 1e6);
+    }
+
+    free(sent_at);
+    free(latencies);
+    return error;
+}
+
+
+/**
+ * @brief Random scenario of the load test: a random hand against 1 to 5 random opponents, with no board or a random
+ * flop.
+ *
+ * @param request Where the scenario is stored.
+ * @param state State of the random numbers (SplitMix64).
+ * @param num_games Games of the scenario.
+ */
+void random_request(eq_simulate_request_t *request, uint64_t *state, int num_games){
+    uint64_t used = 0;
+    int cards[5];
+
+    for(int i = 0; i < 5; i++){
+        int card;
+        do {
+            uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            card = (int) ((z ^ (z >> 31)) % TOTAL_CARDS);
+        } while((used >> card) & 1);
+        used |= 1ULL << card;
+        cards[i] = card;
+    }
+
+    memset(request, 0, sizeof(*request));
+    request->mode = SIM_MODE_PLAYER;
+    request->num_players = (uint8_t) (2 + cards[0] % 5);
+    request->num_board_cards = (cards[1] % 2) ? 3 : 0;
+    request->num_games = (uint32_t) num_games;
+    request->method = SIM_METHOD_MONTE_CARLO;
+    request->players_cards[0][0] = (uint8_t) cards[3];
+    request->players_cards[0][1] = (uint8_t) cards[4];
+    for(int i = 0; i < 3; i++) request->board_cards[i] = (uint8_t) cards[i];
+}
+
+
+/**
+ * @brief Monotonic clock in seconds.
+ *
+ * @return Seconds since an arbitrary origin.
+ */
+double now_seconds(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+}
+
+
+/**
+ * @brief Comparison of two doubles, for qsort().
+ *
+ * @param a First double.
+ * @param b Second double.
+ * @return Negative, zero or positive if a is lower, equal or greater than b.
+ */
+int compare_doubles(const void *a, const void *b){
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * File: equity_protocol.h
+ * Description: Binary protocol of the equity server (equity_server.c) over a
+ * Unix domain socket. Client and server run on the same host, so integers
+ * and doubles travel in the native byte order, and every message is a fixed
+ * header followed by its payload.
+ *
+ * A client sends EQ_SIMULATE requests, each with an id of its choice, and
+ * may send several of them before reading the responses. Each response
+ * echoes the id of its request, and responses can arrive in a different
+ * order than the requests. EQ_STATS returns the counters of the server.
+ ****************************************************************************/
+
+#pragma once
+#include "../src/simulation.h"
+#include <stdint.h>
+
+#define EQ_MAGIC 0x31535145u            // "EQS1"
+#define EQ_DEFAULT_SOCKET "/tmp/equity_server.sock"
+#define EQ_LATENCY_BUCKETS 32           // Bucket i of the latency histogram counts latencies in [2^(i-1), 2^i) microseconds
+
+/* Types of the messages. A response has the type of its request. */
+
+typedef enum {
+    EQ_SIMULATE = 1,        // Payload eq_simulate_request_t, response eq_simulate_response_t and its rows
+    EQ_STATS = 2            // No payload, response eq_stats_t
+} eq_message_type_t;
+
+/* Status of a response */
+
+typedef enum {
+    EQ_OK = 0,
+    EQ_ERROR_MESSAGE = 1,   // Unknown type or wrong payload length
+    EQ_ERROR_SCENARIO = 2,  // Invalid scenario: players, cards, board or games out of range, or repeated cards
+    EQ_ERROR_BUSY = 3       // Too many requests waiting, the request was not queued
+} eq_status_t;
+
+/* Header of every message */
+
+typedef struct {
+    uint32_t magic;         // EQ_MAGIC
+    uint16_t type;          // eq_message_type_t
+    uint16_t status;        // eq_status_t in responses, 0 in requests
+    uint32_t id;            // Chosen by the client and echoed in the response
+    uint32_t length;        // Bytes of payload after the header
+} eq_header_t;
+
+/* Scenario of an EQ_SIMULATE request, the same as a sim_scenario_t plus its method and precision. Cards are
+   integers in [0,51], see cardtype_to_num(). */
+
+typedef struct {
+    uint8_t mode;                       // sim_mode_t
+    uint8_t num_players;
+    uint8_t num_board_cards;            // 0, 3, 4 or 5
+    uint8_t method;                     // sim_method_t
+    uint32_t num_games;                 // Games to simulate (maximum games with a target standard error)
+    double target_std_error;            // See sim_options_t, 0 for a fixed number of games
+    uint64_t discarded_cards;           // Bit i set if card i was discarded
+    uint8_t players_cards[MAX_PLAYERS][2];  // Only players_cards[0] is used with SIM_MODE_PLAYER
+    uint8_t board_cards[5];
+    uint8_t reserved[5];
+} eq_simulate_request_t;
+
+/* Response of an EQ_SIMULATE request with status EQ_OK. It is followed by num_rows eq_row_t, the rows of the
+   matrix returned by simulate_player() (2 rows) or simulate_spectator() (one row per player). */
+
+typedef struct {
+    uint8_t method;         // sim_method_t used, see sim_info_t
+    uint8_t num_rows;
+    uint8_t reserved[2];
+    uint32_t num_games;     // Simulated or enumerated games
+} eq_simulate_response_t;
+
+typedef struct {
+    double probabilities[3 + NUM_OF_HAND_TYPES];
+    double win_std_error;   // Percentage points, 0 if the row does not belong to a player with known cards
+    double tie_std_error;
+} eq_row_t;
+
+/* Counters of the server since it started. Latencies go from the moment a request is received to the moment its
+   response is sent. */
+
+typedef struct {
+    uint64_t uptime_us;
+    uint64_t connections;       // Connections accepted
+    uint64_t requests;          // EQ_SIMULATE requests answered with EQ_OK
+    uint64_t errors;            // Requests answered with an error
+    uint64_t batches;           // Calls to simulate_batch() of the workers
+    uint64_t games;             // Games simulated or enumerated by the requests
+    uint64_t cache_lookups;     // Result cache, see result_cache_get_stats()
+    uint64_t cache_hits;
+    uint64_t latency_total_us;
+    uint64_t latency_max_us;
+    uint64_t latency_histogram[EQ_LATENCY_BUCKETS];
+    double requests_per_second; // Since the server started
+    double mean_batch_size;
+    double latency_mean_us;
+    double latency_p50_us;      // Upper bound of the histogram bucket of the percentile
+    double latency_p99_us;
+} eq_stats_t;
+
+#define EQ_MAX_PAYLOAD (sizeof(eq_simulate_response_t) + MAX_PLAYERS * sizeof(eq_row_t))
+
+_Static_assert(sizeof(eq_header_t) == 16, "eq_header_t must have no padding");
+_Static_assert(sizeof(eq_simulate_request_t) == 80, "eq_simulate_request_t must have no padding");
@@ -0,0 +1,843 @@
+/******************************************************************************
+ * File: equity_server.c
+ * Description: Long-running equity server. It initializes the simulator
+ * once, optionally loads the preflop tables and enables the result cache,
+ * and then answers the simulations requested over a Unix domain socket with
+ * the binary protocol of equity_protocol.h, so clients pay neither the
+ * initialization nor the table building of the library.
+ *
+ * The main thread accepts the connections and reads the requests, which are
+ * queued. A pool of workers takes the waiting requests with the same method
+ * and precision, up to --batch at a time, solves them with a single call to
+ * simulate_batch() and sends every response to its connection.
+ *
+ * Sockets are non-blocking: a response that does not fit in the socket of
+ * its client is kept in an output queue of the connection, which the main
+ * thread flushes when the socket becomes writable. A client that stops
+ * reading never blocks the main thread or a worker; it is disconnected when
+ * its queue reaches MAX_PENDING_OUTPUT bytes. Requests of more than
+ * --max-games games are refused.
+ *
+ * Build and run from the root directory of the project:
+ *      gcc -O2 -o equity_server server/equity_server.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ *      ./equity_server --socket /tmp/equity_server.sock --workers 4 --preflop data/preflop_tables.bin --cache 100000 --max-games 10000000
+ ****************************************************************************/
+
+#include "equity_protocol.h"
+#include "../src/preflop_tables.h"
+#include "../src/result_cache.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define MAX_CONNECTIONS 256
+#define MAX_QUEUED_REQUESTS 65536
+#define DEFAULT_BATCH 64
+#define POLL_TIMEOUT_MS 200
+#define MAX_FRAME (sizeof(eq_header_t) + EQ_MAX_PAYLOAD)
+#define MAX_PENDING_OUTPUT (4 << 20)    // Bytes of responses queued for a client before it is disconnected
+#define DEFAULT_MAX_GAMES 10000000      // Games of the largest request accepted, a few seconds of a worker
+#define FIRST_CONNECTION 2              // Position of the first connection in the poll set, after the listener and the wakeup pipe
+
+/* Connection of a client. It is referenced by the main thread while it is open and by every request of it not
+   answered yet, and the socket is closed when the last reference is released, so that a worker never writes to
+   a descriptor reused by another connection. */
+
+typedef struct {
+    int fd;
+    atomic_int refs;
+    pthread_mutex_t write_lock;     // Responses are written whole, by the main thread or by any worker
+    unsigned char *output;          // Bytes of responses not sent yet, flushed by the main thread (under write_lock)
+    size_t output_used;
+    size_t output_capacity;
+    int broken;                     // Set when the connection must be closed: error or too much output queued
+    size_t used;                    // Bytes of buffer received and not processed yet
+    unsigned char buffer[MAX_FRAME];
+} connection_t;
+
+/* Request waiting to be solved */
+
+typedef struct request {
+    connection_t *connection;
+    uint32_t id;
+    sim_method_t method;
+    double target_std_error;
+    sim_scenario_t scenario;
+    uint64_t received_us;
+    struct request *next;
+} request_t;
+
+/* Configuration of the server */
+
+typedef struct {
+    const char *socket_path;
+    const char *csv_file;
+    const char *preflop_file;
+    int num_workers;
+    int batch_size;
+    int cache_capacity;
+    int max_games;
+} config_t;
+
+
+int parse_arguments(int argc, char *argv[], config_t *config);
+int open_listener(const char *socket_path);
+void serve(int listener);
+int receive(connection_t *connection);
+void handle_message(connection_t *connection, const eq_header_t *header, const unsigned char *payload);
+eq_status_t parse_scenario(const eq_simulate_request_t *request, sim_scenario_t *scenario);
+void *worker_thread(void *arg);
+int take_batch(request_t *batch[], int max_requests);
+void send_result(request_t *request, const sim_result_t *result);
+void send_message(connection_t *connection, uint16_t type, uint16_t status, uint32_t id, const void *payload, uint32_t length);
+int flush_output(connection_t *connection);
+int has_pending_output(connection_t *connection);
+void wake_main_thread();
+void release_connection(connection_t *connection);
+void record_latency(uint64_t received_us, int ok);
+void fill_stats(eq_stats_t *stats);
+double latency_percentile(const eq_stats_t *stats, double fraction);
+uint64_t now_us();
+void stop_server(int signal_number);
+
+
+/* Queue of requests, shared by the main thread and the workers */
+
+pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t queue_not_empty = PTHREAD_COND_INITIALIZER;
+request_t *queue_head = NULL;
+request_t *queue_tail = NULL;
+int queue_length = 0;
+int stopping = 0;
+
+int batch_size = DEFAULT_BATCH;
+int max_games = DEFAULT_MAX_GAMES;
+
+/* Pipe written by the workers when they queue output, so that the main thread polls for it without waiting */
+
+int wakeup_pipe[2] = { -1, -1 };
+
+/* Counters of the server */
+
+pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+eq_stats_t stats;
+uint64_t start_us;
+uint64_t batched_requests = 0;
+
+volatile sig_atomic_t stop_requested = 0;
+
+
+int main(int argc, char *argv[]){
+    config_t config;
+    if(parse_arguments(argc, argv, &config) == -1){
+        fprintf(stderr,"Usage: %s [--socket path] [--workers n] [--batch n] [--cache entries] [--max-games n] [--preflop file] [--csv file]\n", argv[0]);
+        return 1;
+    }
+
+    if(init_simulator(config.csv_file) == -1){
+        return 1;
+    }
+    if(config.preflop_file != NULL && load_preflop_tables(config.preflop_file) == -1){
+        fprintf(stderr,"Error when loading the preflop tables %s.\n", config.preflop_file);
+        return 1;
+    }
+    if(config.cache_capacity > 0 && result_cache_enable(config.cache_capacity) == -1){
+        fprintf(stderr,"Error when enabling the result cache.\n");
+        return 1;
+    }
+
+    int listener = open_listener(config.socket_path);
+    if(listener == -1){
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, stop_server);
+    signal(SIGTERM, stop_server);
+
+    if(pipe(wakeup_pipe) == -1){
+        perror("pipe");
+        return 1;
+    }
+    fcntl(wakeup_pipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(wakeup_pipe[1], F_SETFL, O_NONBLOCK);
+
+    batch_size = config.batch_size;
+    max_games = config.max_games;
+    start_us = now_us();
+
+    pthread_t workers[config.num_workers];
+    int num_started = 0;
+    while(num_started < config.num_workers && pthread_create(&workers[num_started], NULL, worker_thread, NULL) == 0){
+        num_started++;
+    }
+    if(num_started == 0){
+        fprintf(stderr,"Error when creating the workers.\n");
+        return 1;
+    }
+
+    fprintf(stderr,"Serving on %s with %d workers.\n", config.socket_path, num_started);
+    serve(listener);
+
+    // The workers answer the requests already queued before they stop
+    pthread_mutex_lock(&queue_lock);
+    stopping = 1;
+    pthread_cond_broadcast(&queue_not_empty);
+    pthread_mutex_unlock(&queue_lock);
+    for(int i = 0; i < num_started; i++){
+        pthread_join(workers[i], NULL);
+    }
+
+    close(listener);
+    unlink(config.socket_path);
+
+    eq_stats_t final_stats;
+    fill_stats(&final_stats);
+    fprintf(stderr,"%llu requests, %llu errors, %.1f requests/s, mean batch %.1f, latency mean %.1f us, p50 %.0f us, p99 %.0f us, max %llu us.\n",
+            (unsigned long long) final_stats.requests, (unsigned long long) final_stats.errors, final_stats.requests_per_second,
+            final_stats.mean_batch_size, final_stats.latency_mean_us, final_stats.latency_p50_us, final_stats.latency_p99_us,
+            (unsigned long long) final_stats.latency_max_us);
+    return 0;
+}
+
+
+/**
+ * @brief Parsing of the command line arguments.
+ *
+ * @param argc Number of arguments.
+ * @param argv Arguments.
+ * @param config Where the configuration is stored.
+ * @return -1 if an argument is not valid, 0 for success.
+ */
+int parse_arguments(int argc, char *argv[], config_t *config){
+    config->socket_path = EQ_DEFAULT_SOCKET;
+    config->csv_file = NULL;
+    config->preflop_file = NULL;
+    config->num_workers = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    config->batch_size = DEFAULT_BATCH;
+    config->cache_capacity = 0;
+    config->max_games = DEFAULT_MAX_GAMES;
+    if(config->num_workers < 1) config->num_workers = 1;
+
+    for(int i = 1; i < argc; i++){
+        if(i + 1 == argc) return -1;
+        const char *value = argv[++i];
+
+        if(strcmp(argv[i - 1], "--socket") == 0) config->socket_path = value;
+        else if(strcmp(argv[i - 1], "--csv") == 0) config->csv_file = value;
+        else if(strcmp(argv[i - 1], "--preflop") == 0) config->preflop_file = value;
+        else if(strcmp(argv[i - 1], "--workers") == 0) config->num_workers = atoi(value);
+        else if(strcmp(argv[i - 1], "--batch") == 0) config->batch_size = atoi(value);
+        else if(strcmp(argv[i - 1], "--cache") == 0) config->cache_capacity = atoi(value);
+        else if(strcmp(argv[i - 1], "--max-games") == 0) config->max_games = atoi(value);
+        else return -1;
+    }
+
+    if(config->num_workers < 1 || config->batch_size < 1 || config->cache_capacity < 0 || config->max_games < 1) return -1;
+    if(strlen(config->socket_path) >= sizeof(((struct sockaddr_un *) NULL)->sun_path)) return -1;
+    return 0;
+}
+
+
+/**
+ * @brief Creation of the listening socket. A socket file left by a previous server is removed.
+ *
+ * @param socket_path Path of the socket.
+ * @return Descriptor of the socket, -1 if it can not be created.
+ */
+int open_listener(const char *socket_path){
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listener == -1){
+        perror("socket");
+        return -1;
+    }
+
+    unlink(socket_path);
+    if(bind(listener, (struct sockaddr *) &address, sizeof(address)) == -1 || listen(listener, SOMAXCONN) == -1){
+        perror(socket_path);
+        close(listener);
+        return -1;
+    }
+
+    return listener;
+}
+
+
+/**
+ * @brief Loop of the main thread: it accepts connections, reads their requests and flushes the responses queued
+ * for them until SIGINT or SIGTERM.
+ *
+ * @param listener Listening socket.
+ */
+void serve(int listener){
+    struct pollfd fds[MAX_CONNECTIONS + FIRST_CONNECTION];
+    connection_t *connections[MAX_CONNECTIONS + FIRST_CONNECTION];
+    int num_fds = FIRST_CONNECTION;
+
+    fds[0].fd = listener;
+    fds[0].events = POLLIN;
+    fds[1].fd = wakeup_pipe[0];
+    fds[1].events = POLLIN;
+
+    while(!stop_requested){
+        for(int i = FIRST_CONNECTION; i < num_fds; i++){
+            fds[i].events = POLLIN | (has_pending_output(connections[i]) ? POLLOUT : 0);
+        }
+
+        int ready = poll(fds, num_fds, POLL_TIMEOUT_MS);
+        if(ready == -1 && errno != EINTR){
+            perror("poll");
+            break;
+        }
+        if(ready <= 0) continue;
+
+        if(fds[1].revents & POLLIN){
+            char drain[64];
+            while(read(wakeup_pipe[0], drain, sizeof(drain)) > 0);
+        }
+
+        for(int i = num_fds - 1; i >= FIRST_CONNECTION; i--){
+            int closed = 0;
+
+            if(fds[i].revents & POLLOUT) closed = (flush_output(connections[i]) == -1);
+            if(!closed && (fds[i].revents & (POLLIN | POLLHUP | POLLERR))) closed = (receive(connections[i]) == -1);
+
+            pthread_mutex_lock(&connections[i]->write_lock);
+            closed = closed || connections[i]->broken;
+            pthread_mutex_unlock(&connections[i]->write_lock);
+
+            if(closed){
+                release_connection(connections[i]);
+                num_fds--;
+                fds[i] = fds[num_fds];
+                connections[i] = connections[num_fds];
+            }
+        }
+
+        if(fds[0].revents & POLLIN){
+            int fd = accept(listener, NULL, NULL);
+            if(fd == -1) continue;
+
+            connection_t *connection = malloc(sizeof(connection_t));
+            if(num_fds == MAX_CONNECTIONS + FIRST_CONNECTION || connection == NULL || fcntl(fd, F_SETFL, O_NONBLOCK) == -1){
+                free(connection);
+                close(fd);
+                continue;
+            }
+
+            connection->fd = fd;
+            connection->used = 0;
+            connection->output = NULL;
+            connection->output_used = 0;
+            connection->output_capacity = 0;
+            connection->broken = 0;
+            atomic_init(&connection->refs, 1);
+            pthread_mutex_init(&connection->write_lock, NULL);
+
+            fds[num_fds].fd = fd;
+            fds[num_fds].events = POLLIN;
+            connections[num_fds] = connection;
+            num_fds++;
+
+            pthread_mutex_lock(&stats_lock);
+            stats.connections++;
+            pthread_mutex_unlock(&stats_lock);
+        }
+    }
+
+    for(int i = FIRST_CONNECTION; i < num_fds; i++){
+        shutdown(connections[i]->fd, SHUT_RD);
+        release_connection(connections[i]);
+    }
+}
+
+
+/**
+ * @brief Reading of the available bytes of a connection, and handling of every complete message received.
+ *
+ * @param connection Connection with bytes to read.
+ * @return -1 if the connection was closed or sent an invalid message, 0 otherwise.
+ */
+int receive(connection_t *connection){
+    ssize_t n = read(connection->fd, connection->buffer + connection->used, MAX_FRAME - connection->used);
+    if(n <= 0){
+        return (n == -1 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)) ? 0 : -1;
+    }
+    connection->used += (size_t) n;
+
+    size_t start = 0;
+    while(connection->used - start >= sizeof(eq_header_t)){
+        eq_header_t header;
+        memcpy(&header, connection->buffer + start, sizeof(header));
+        if(header.magic != EQ_MAGIC || header.length > EQ_MAX_PAYLOAD) return -1;
+
+        size_t frame_length = sizeof(eq_header_t) + header.length;
+        if(connection->used - start < frame_length) break;
+
+        handle_message(connection, &header, connection->buffer + start + sizeof(eq_header_t));
+        start += frame_length;
+    }
+
+    memmove(connection->buffer, connection->buffer + start, connection->used - start);
+    connection->used -= start;
+    return 0;
+}
+
+
+/**
+ * @brief Handling of a message: simulations are queued for the workers, the rest are answered right away.
+ *
+ * @param connection Connection that sent the message.
+ * @param header Header of the message.
+ * @param payload Payload of the message, header->length bytes.
+ */
+void handle_message(connection_t *connection, const eq_header_t *header, const unsigned char *payload){
+    uint64_t received_us = now_us();
+
+    if(header->type == EQ_STATS && header->length == 0){
+        eq_stats_t current;
+        fill_stats(&current);
+        send_message(connection, EQ_STATS, EQ_OK, header->id, &current, sizeof(current));
+        return;
+    }
+
+    if(header->type != EQ_SIMULATE || header->length != sizeof(eq_simulate_request_t)){
+        send_message(connection, header->type, EQ_ERROR_MESSAGE, header->id, NULL, 0);
+        record_latency(received_us, 0);
+        return;
+    }
+
+    eq_simulate_request_t message;
+    memcpy(&message, payload, sizeof(message));
+
+    request_t *request = malloc(sizeof(request_t));
+    eq_status_t status = (request == NULL) ? EQ_ERROR_BUSY : parse_scenario(&message, &request->scenario);
+
+    if(status == EQ_OK){
+        pthread_mutex_lock(&queue_lock);
+        if(queue_length < MAX_QUEUED_REQUESTS){
+            request->connection = connection;
+            request->id = header->id;
+            request->method = (sim_method_t) message.method;
+            request->target_std_error = message.target_std_error;
+            request->received_us = received_us;
+            request->next = NULL;
+            atomic_fetch_add(&connection->refs, 1);
+
+            if(queue_tail != NULL) queue_tail->next = request;
+            else queue_head = request;
+            queue_tail = request;
+            queue_length++;
+            pthread_cond_signal(&queue_not_empty);
+        } else {
+            status = EQ_ERROR_BUSY;
+        }
+        pthread_mutex_unlock(&queue_lock);
+    }
+
+    if(status != EQ_OK){
+        free(request);
+        send_message(connection, EQ_SIMULATE, status, header->id, NULL, 0);
+        record_latency(received_us, 0);
+    }
+}
+
+
+/**
+ * @brief Validation of a requested scenario and conversion into a sim_scenario_t.
+ *
+ * @param request Scenario received.
+ * @param scenario Where the scenario to simulate is stored.
+ * @return EQ_OK, or EQ_ERROR_SCENARIO if the scenario is not valid or asks for more than --max-games games.
+ */
+eq_status_t parse_scenario(const eq_simulate_request_t *request, sim_scenario_t *scenario){
+    int num_players = request->num_players;
+    int num_board_cards = request->num_board_cards;
+
+    if((request->mode != SIM_MODE_PLAYER && request->mode != SIM_MODE_SPECTATOR) || num_players < 2 || num_players > MAX_PLAYERS ||
+       (num_board_cards != 0 && (num_board_cards < 3 || num_board_cards > 5)) || request->method > SIM_METHOD_PRECOMPUTED ||
+       request->num_games < 1 || request->num_games > (uint32_t) max_games || !(request->target_std_error >= 0.0) ||
+       (request->discarded_cards >> TOTAL_CARDS) != 0){
+        return EQ_ERROR_SCENARIO;
+    }
+
+    memset(scenario, 0, sizeof(sim_scenario_t));
+    scenario->mode = (sim_mode_t) request->mode;
+    scenario->num_players = num_players;
+    scenario->num_games = (int) request->num_games;
+    scenario->num_board_cards = num_board_cards;
+    scenario->discarded_cards = request->discarded_cards;
+
+    // Every known card must be a card and appear only once
+    uint64_t used = request->discarded_cards;
+    int num_known_players = (request->mode == SIM_MODE_PLAYER) ? 1 : num_players;
+    int known_cards[2 * MAX_PLAYERS + 5];
+    int num_known_cards = 0;
+
+    for(int i = 0; i < num_known_players; i++){
+        scenario->players_cards[i][0] = known_cards[num_known_cards++] = request->players_cards[i][0];
+        scenario->players_cards[i][1] = known_cards[num_known_cards++] = request->players_cards[i][1];
+    }
+    for(int i = 0; i < num_board_cards; i++){
+        scenario->board_cards[i] = known_cards[num_known_cards++] = request->board_cards[i];
+    }
+    for(int i = 0; i < num_known_cards; i++){
+        if(known_cards[i] >= TOTAL_CARDS || ((used >> known_cards[i]) & 1)) return EQ_ERROR_SCENARIO;
+        used |= 1ULL << known_cards[i];
+    }
+
+    // The deck must have enough cards for the unknown hole cards and the missing community cards
+    int num_unknown_cards = TOTAL_CARDS - __builtin_popcountll(used);
+    if(num_unknown_cards < 2 * (num_players - num_known_players) + (5 - num_board_cards)) return EQ_ERROR_SCENARIO;
+
+    return EQ_OK;
+}
+
+
+/**
+ * @brief Body of a worker: it solves batches of queued requests until the server stops and the queue is empty.
+ *
+ * @param arg Not used.
+ * @return NULL.
+ */
+void *worker_thread(void *arg){
+    (void) arg;
+    request_t *batch[batch_size];
+    sim_scenario_t *scenarios = malloc(batch_size * sizeof(sim_scenario_t));
+    sim_result_t *results = malloc(batch_size * sizeof(sim_result_t));
+    if(scenarios == NULL || results == NULL){
+        free(scenarios);
+        free(results);
+        return NULL;
+    }
+
+    int n;
+    while((n = take_batch(batch, batch_size)) > 0){
+        sim_options_t options;
+        sim_default_options(&options);
+        options.method = batch[0]->method;
+        options.target_std_error = batch[0]->target_std_error;
+
+        for(int i = 0; i < n; i++) scenarios[i] = batch[i]->scenario;
+        simulate_batch(scenarios, results, n, &options);
+
+        for(int i = 0; i < n; i++){
+            send_result(batch[i], &results[i]);
+            record_latency(batch[i]->received_us, 1);
+            release_connection(batch[i]->connection);
+            free(batch[i]);
+        }
+
+        pthread_mutex_lock(&stats_lock);
+        stats.batches++;
+        batched_requests += (uint64_t) n;
+        for(int i = 0; i < n; i++) stats.games += (uint64_t) results[i].info.num_games;
+        pthread_mutex_unlock(&stats_lock);
+    }
+
+    free(scenarios);
+    free(results);
+    return NULL;
+}
+
+
+/**
+ * @brief Taking of a batch from the queue: the first request and the next ones with the same method and target
+ * standard error, which can be solved with a single call to simulate_batch(). It waits while the queue is empty.
+ *
+ * @param batch Where the requests taken are stored.
+ * @param max_requests Maximum number of requests to take.
+ * @return Number of requests taken, 0 if the server is stopping and the queue is empty.
+ */
+int take_batch(request_t *batch[], int max_requests){
+    pthread_mutex_lock(&queue_lock);
+    while(queue_head == NULL && !stopping){
+        pthread_cond_wait(&queue_not_empty, &queue_lock);
+    }
+
+    int n = 0;
+    while(queue_head != NULL && n < max_requests &&
+          (n == 0 || (queue_head->method == batch[0]->method && queue_head->target_std_error == batch[0]->target_std_error))){
+        batch[n++] = queue_head;
+        queue_head = queue_head->next;
+        queue_length--;
+    }
+    if(queue_head == NULL) queue_tail = NULL;
+
+    pthread_mutex_unlock(&queue_lock);
+    return n;
+}
+
+
+/**
+ * @brief Sending of the result of a simulation to the connection of its request.
+ *
+ * @param request Request solved.
+ * @param result Result of the scenario of the request.
+ */
+void send_result(request_t *request, const sim_result_t *result){
+    unsigned char payload[EQ_MAX_PAYLOAD];
+    eq_simulate_response_t response;
+    int num_rows = (request->scenario.mode == SIM_MODE_PLAYER) ? 2 : request->scenario.num_players;
+
+    memset(&response, 0, sizeof(response));
+    response.method = (uint8_t) result->info.method;
+    response.num_rows = (uint8_t) num_rows;
+    response.num_games = (uint32_t) result->info.num_games;
+    memcpy(payload, &response, sizeof(response));
+
+    for(int i = 0; i < num_rows; i++){
+        eq_row_t row;
+        memcpy(row.probabilities, result->probabilities[i], sizeof(row.probabilities));
+        // Row 1 of the player's perspective gathers all the opponents
+        int known = (request->scenario.mode == SIM_MODE_SPECTATOR || i == 0);
+        row.win_std_error = known ? result->info.win_std_error[i] : 0.0;
+        row.tie_std_error = known ? result->info.tie_std_error[i] : 0.0;
+        memcpy(payload + sizeof(response) + i * sizeof(eq_row_t), &row, sizeof(row));
+    }
+
+    send_message(request->connection, EQ_SIMULATE, EQ_OK, request->id, payload, sizeof(response) + num_rows * sizeof(eq_row_t));
+}
+
+
+/**
+ * @brief Sending of a whole message to a connection, without blocking. What the socket does not take is appended to
+ * the output queue of the connection, which the main thread flushes when the socket becomes writable (see
+ * flush_output()). If the queue would exceed MAX_PENDING_OUTPUT bytes, or the socket fails, the connection is marked
+ * broken and the main thread closes it.
+ *
+ * @param connection Connection.
+ * @param type Type of the message.
+ * @param status Status of the message.
+ * @param id Id of the request answered.
+ * @param payload Payload of the message.
+ * @param length Bytes of the payload.
+ */
+void send_message(connection_t *connection, uint16_t type, uint16_t status, uint32_t id, const void *payload, uint32_t length){
+    unsigned char frame[MAX_FRAME];
+    eq_header_t header = { EQ_MAGIC, type, status, id, length };
+
+    memcpy(frame, &header, sizeof(header));
+    if(length > 0) memcpy(frame + sizeof(header), payload, length);
+
+    size_t total = sizeof(header) + length, sent = 0;
+    int queued = 0;
+
+    pthread_mutex_lock(&connection->write_lock);
+
+    // Messages already queued go first
+    while(!connection->broken && connection->output_used == 0 && sent < total){
+        ssize_t n = send(connection->fd, frame + sent, total - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if(n == -1 && errno == EINTR) continue;
+        if(n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if(n <= 0) connection->broken = 1;
+        else sent += (size_t) n;
+    }
+
+    if(!connection->broken && sent < total){
+        size_t needed = connection->output_used + (total - sent);
+        if(needed > MAX_PENDING_OUTPUT){
+            connection->broken = 1;
+        } else {
+            if(needed > connection->output_capacity){
+                size_t capacity = (connection->output_capacity > 0) ? 2 * connection->output_capacity : 4 * MAX_FRAME;
+                while(capacity < needed) capacity *= 2;
+                unsigned char *output = realloc(connection->output, capacity);
+                if(output == NULL) connection->broken = 1;
+                else {
+                    connection->output = output;
+                    connection->output_capacity = capacity;
+                }
+            }
+            if(!connection->broken){
+                memcpy(connection->output + connection->output_used, frame + sent, total - sent);
+                connection->output_used = needed;
+                queued = 1;
+            }
+        }
+    }
+
+    // The main thread must poll for the new output, or close the connection
+    if(connection->broken) shutdown(connection->fd, SHUT_RDWR);
+    int wake = queued || connection->broken;
+
+    pthread_mutex_unlock(&connection->write_lock);
+
+    if(wake) wake_main_thread();
+}
+
+
+/**
+ * @brief Sending of the output queued for a connection, as much as its socket takes.
+ *
+ * @param connection Connection whose socket is writable.
+ * @return -1 if the connection failed and must be closed, 0 otherwise.
+ */
+int flush_output(connection_t *connection){
+    pthread_mutex_lock(&connection->write_lock);
+
+    size_t sent = 0;
+    while(!connection->broken && sent < connection->output_used){
+        ssize_t n = send(connection->fd, connection->output + sent, connection->output_used - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if(n == -1 && errno == EINTR) continue;
+        if(n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if(n <= 0) connection->broken = 1;
+        else sent += (size_t) n;
+    }
+
+    memmove(connection->output, connection->output + sent, connection->output_used - sent);
+    connection->output_used -= sent;
+    int broken = connection->broken;
+
+    pthread_mutex_unlock(&connection->write_lock);
+    return broken ? -1 : 0;
+}
+
+
+/**
+ * @brief Whether a connection has output queued, so that the main thread polls its socket for writing.
+ *
+ * @param connection Connection.
+ * @return 1 if there is output queued, 0 otherwise.
+ */
+int has_pending_output(connection_t *connection){
+    pthread_mutex_lock(&connection->write_lock);
+    int pending = (connection->output_used > 0);
+    pthread_mutex_unlock(&connection->write_lock);
+    return pending;
+}
+
+
+/**
+ * @brief Wakeup of the main thread from its poll, so that it polls again with the output just queued. The pipe is
+ * non-blocking: if it is full, the main thread is already awake.
+ */
+void wake_main_thread(){
+    char byte = 0;
+    ssize_t n = write(wakeup_pipe[1], &byte, 1);
+    (void) n;
+}
+
+
+/**
+ * @brief Release of a reference to a connection. The last one closes its socket and frees it.
+ *
+ * @param connection Connection.
+ */
+void release_connection(connection_t *connection){
+    if(atomic_fetch_sub(&connection->refs, 1) == 1){
+        close(connection->fd);
+        pthread_mutex_destroy(&connection->write_lock);
+        free(connection->output);
+        free(connection);
+    }
+}
+
+
+/**
+ * @brief Recording of the latency of an answered request, from its reception until now.
+ *
+ * @param received_us Moment the request was received, see now_us().
+ * @param ok 1 if it was answered with EQ_OK, 0 if with an error.
+ */
+void record_latency(uint64_t received_us, int ok){
+    uint64_t latency = now_us() - received_us;
+    int bucket = 0;
+    while(bucket < EQ_LATENCY_BUCKETS - 1 && (1ULL << bucket) <= latency) bucket++;
+
+    pthread_mutex_lock(&stats_lock);
+    if(ok) stats.requests++;
+    else stats.errors++;
+    stats.latency_total_us += latency;
+    if(latency > stats.latency_max_us) stats.latency_max_us = latency;
+    stats.latency_histogram[bucket]++;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+
+/**
+ * @brief Current counters of the server, with the derived rates, means and percentiles.
+ *
+ * @param current Where the counters are stored.
+ */
+void fill_stats(eq_stats_t *current){
+    pthread_mutex_lock(&stats_lock);
+    *current = stats;
+    uint64_t total_batched = batched_requests;
+    pthread_mutex_unlock(&stats_lock);
+
+    current->uptime_us = now_us() - start_us;
+
+    if(result_cache_enabled()){
+        result_cache_stats_t cache_stats;
+        result_cache_get_stats(&cache_stats);
+        current->cache_lookups = cache_stats.lookups;
+        current->cache_hits = cache_stats.hits;
+    }
+
+    uint64_t answered = current->requests + current->errors;
+    current->requests_per_second = (current->uptime_us > 0) ? (double) current->requests * 1e6 / (double) current->uptime_us : 0.0;
+    current->mean_batch_size = (current->batches > 0) ? (double) total_batched / (double) current->batches : 0.0;
+    current->latency_mean_us = (answered > 0) ? (double) current->latency_total_us / (double) answered : 0.0;
+    current->latency_p50_us = latency_percentile(current, 0.50);
+    current->latency_p99_us = latency_percentile(current, 0.99);
+}
+
+
+/**
+ * @brief Percentile of the latencies, from their histogram.
+ *
+ * @param current Counters with the histogram.
+ * @param fraction Fraction of the latencies below the percentile, in (0,1).
+ * @return Upper bound of the bucket of the percentile in microseconds, 0 if there are no latencies.
+ */
+double latency_percentile(const eq_stats_t *current, double fraction){
+    uint64_t answered = 0, seen = 0;
+    for(int i = 0; i < EQ_LATENCY_BUCKETS; i++) answered += current->latency_histogram[i];
+    if(answered == 0) return 0.0;
+
+    for(int i = 0; i < EQ_LATENCY_BUCKETS; i++){
+        seen += current->latency_histogram[i];
+        if((double) seen >= fraction * (double) answered) return (double) (1ULL << i);
+    }
+    return (double) (1ULL << (EQ_LATENCY_BUCKETS - 1));
+}
+
+
+/**
+ * @brief Monotonic clock in microseconds.
+ *
+ * @return Microseconds since an arbitrary origin.
+ */
+uint64_t now_us(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000ULL + (uint64_t) now.tv_nsec / 1000ULL;
+}
+
+
+/**
+ * @brief Handler of SIGINT and SIGTERM: the main loop stops accepting requests.
+ *
+ * @param signal_number Signal received.
+ */
+void stop_server(int signal_number){
+    (void) signal_number;
+    stop_requested = 1;
+}
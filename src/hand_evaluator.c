@@ -6,6 +6,7 @@
  * Description: This file contains all the data structures and algorithms to
  * evaluate a Poker 5-hand. It implements the Cactus Kev design:
  * http://suffe.cool/poker/evaluator.html
+ * It also provides a direct 7-card evaluator built on top of the 5-card tables.
  ****************************************************************************/
 
 
@@ -34,14 +35,36 @@
 #define HIGHEST_ASCII_RANK (int)'T'
 #define HIGHEST_5CARD_BIT_RANK (0x1F00 + 1) 
 #define PRIME_PROD_TABLE_SIZE 4888
+#define PRIME_PROD_HASH_TABLE_BITS 13
+#define PRIME_PROD_HASH_BUCKET_BITS 11
 #define NUM_MAX_SHORT_HAND_NAME 3
 #define MAX_LINE_LENGTH 64
+#define NUM_OF_SUBSETS_5_OF_7 21
+#define FLUSH7_TABLE_SIZE (0x1FFF + 1)
+#define NOFLUSH7_NUM_KEYS 49205 // Number of multisets of 7 ranks with at most 4 cards per rank
+#define NOFLUSH7_TABLE_BITS 16
+#define NOFLUSH7_BUCKET_BITS 14
+#define MAX_PERFECT_HASH_ATTEMPTS 64
+#define OMAHA_RANK_PAIRS 91      // Multisets of 2 ranks
+#define OMAHA_RANK_TRIPLES 455   // Multisets of 3 ranks
+#define GATHER_PADDING 1 // Extra element of the tables read by 32-bit gathers, see get_scores_batch()
 
 
 
 #include "hand_evaluator.h"
+#include "instrument.h"
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+
+#ifndef NO_BUILTIN_TABLES
+#include "lookup_tables.h" // Generated by tools/generate_tables.c
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(NO_SIMD_EVALUATOR)
+#define HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
 
 
 /* Declaration of functions for look tables creation */
@@ -49,24 +72,53 @@
 void create_rank_lookup_table(unsigned short card_ranks[]);
 void create_flushes_lookup_table(char hands[NUM_OF_EQUIVALENCES][5], char short_hand_names[NUM_OF_EQUIVALENCES][NUM_MAX_SHORT_HAND_NAME],unsigned short flushes_table[], unsigned short coded_card_ranks[]);
 void create_unique5_lookup_table(char hands[NUM_OF_EQUIVALENCES][5], char short_hand_names[NUM_OF_EQUIVALENCES][NUM_MAX_SHORT_HAND_NAME], unsigned short unique5[], unsigned short coded_card_ranks[]);
-void create_prime_product_lookup_tables(char hands[NUM_OF_EQUIVALENCES][5], char short_hand_names[NUM_OF_EQUIVALENCES][NUM_MAX_SHORT_HAND_NAME], int prime_product_table[], unsigned short score_table[]);
+int create_prime_product_lookup_tables(char hands[NUM_OF_EQUIVALENCES][5], char short_hand_names[NUM_OF_EQUIVALENCES][NUM_MAX_SHORT_HAND_NAME], int prime_product_table[], unsigned short score_table[]);
+void create_flush7_lookup_table(unsigned short flush7[]);
+int create_noflush7_lookup_tables(unsigned short noflush7[], unsigned short displacements[]);
+void create_omaha_lookup_tables(unsigned short omaha[], unsigned short triple_ids[]);
+int load_builtin_lookup_tables();
+void select_batch_kernels();
 
 
 /* Support functions declaration */
 
-void quickSort(int arr[], int low, int high);
+int compare_prime_products(const void *a, const void *b);
 int binary_search(int v[], int To_Find);
+int build_perfect_hash(const unsigned int keys[], int num_keys, int table_bits, int bucket_bits, unsigned int *salt, unsigned short displacements[], int slots[]);
 
 /* Look up tables */
 
-unsigned short flushes_table[HIGHEST_5CARD_BIT_RANK];
-unsigned short unique5_table[HIGHEST_5CARD_BIT_RANK];
+unsigned short flushes_table[HIGHEST_5CARD_BIT_RANK + GATHER_PADDING];
+unsigned short unique5_table[HIGHEST_5CARD_BIT_RANK + GATHER_PADDING];
 int prime_product_table[PRIME_PROD_TABLE_SIZE];
 unsigned short prime_product_score_table[PRIME_PROD_TABLE_SIZE];
+unsigned short prime_product_hash_table[(1 << PRIME_PROD_HASH_TABLE_BITS) + GATHER_PADDING];    // Scores of hands with repeated ranks, indexed by perfect hash
+unsigned short prime_product_displacements[(1 << PRIME_PROD_HASH_BUCKET_BITS) + GATHER_PADDING];
+unsigned int prime_product_salt;
+
+/* Look up tables of the 7-card evaluator */
+
+unsigned short flush7_table[FLUSH7_TABLE_SIZE + GATHER_PADDING];                  // Best flush score of a 5, 6 or 7 bit rank mask
+unsigned short noflush7_table[(1 << NOFLUSH7_TABLE_BITS) + GATHER_PADDING];       // Best score of 7 cards without flush, indexed by perfect hash
+unsigned short noflush7_displacements[(1 << NOFLUSH7_BUCKET_BITS) + GATHER_PADDING];
+unsigned int noflush7_salt;
+
+/* Look up tables of the Omaha evaluator */
+
+unsigned short omaha_table[OMAHA_RANK_TRIPLES * OMAHA_RANK_PAIRS];  // Score without flush of 3 board ranks and 2 hole ranks
+unsigned short omaha_triple_ids[NUM_RANKS * NUM_RANKS * NUM_RANKS];  // Multiset of 3 ranks, indexed by 169 * r1 + 13 * r2 + r3
+
+/* Kernels of the batch evaluators, chosen for the CPU by select_batch_kernels() */
+
+void (*scores_batch_kernel)(const int *cards, unsigned short *out, size_t n);
+void (*scores7_batch_kernel)(const int *cards, unsigned short *out, size_t n);
+const char *batch_kernels_isa = "none";
+eval_batch_kind_t batch_kernels_kind = EVAL_BATCH_SCALAR;
 
 /* Array of full names of the equivalence table */
 
 char full_hand_names[NUM_OF_EQUIVALENCES][MAX_LINE_LENGTH]; // array[equivalence value - 1] = "name"
+const char *hand_names[NUM_OF_EQUIVALENCES];                // Names in use: the ones read from the CSV file or the built-in ones
 
 
 
@@ -75,6 +127,41 @@ char full_hand_names[NUM_OF_EQUIVALENCES][MAX_LINE_LENGTH]; // array[equivalence
 int PRIMES[NUM_RANKS] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41 };
 char CARD_RANKS[NUM_RANKS] = {'2','3','4','5','6','7','8','9','T','J','Q','K','A'};
 
+/* Base 5 weight of each rank. The sum over the cards of a hand identifies its multiset of ranks. */
+
+int RANK_KEYS[NUM_RANKS] = { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625 };
+
+/* Suit counter increment of every suit nibble of the encoding (one nibble of counter per suit) */
+
+unsigned short SUIT_COUNTERS[16] = { 0, 0x0001, 0x0010, 0, 0x0100, 0, 0, 0, 0x1000, 0, 0, 0, 0, 0, 0, 0 };
+
+/* All possible groups of 5 cards from a set of 7, without repetition. choose(7,5) */
+
+int groups_5[NUM_OF_SUBSETS_5_OF_7][5] =
+{
+    { 0, 1, 2, 3, 4 },
+    { 0, 1, 2, 3, 5 },
+    { 0, 1, 2, 3, 6 },
+    { 0, 1, 2, 4, 5 },
+    { 0, 1, 2, 4, 6 },
+    { 0, 1, 2, 5, 6 },
+    { 0, 1, 3, 4, 5 },
+    { 0, 1, 3, 4, 6 },
+    { 0, 1, 3, 5, 6 },
+    { 0, 1, 4, 5, 6 },
+    { 0, 2, 3, 4, 5 },
+    { 0, 2, 3, 4, 6 },
+    { 0, 2, 3, 5, 6 },
+    { 0, 2, 4, 5, 6 },
+    { 0, 3, 4, 5, 6 },
+    { 1, 2, 3, 4, 5 },
+    { 1, 2, 3, 4, 6 },
+    { 1, 2, 3, 5, 6 },
+    { 1, 2, 4, 5, 6 },
+    { 1, 3, 4, 5, 6 },
+    { 2, 3, 4, 5, 6 }
+};
+
 char* card_names[TOTAL_CARDS] = {   "2C","3C","4C","5C","6C","7C","8C","9C","TC","JC","QC","KC","AC",
                                         "2D","3D","4D","5D","6D","7D","8D","9D","TD","JD","QD","KD","AD",
                                         "2H","3H","4H","5H","6H","7H","8H","9H","TH","JH","QH","KH","AH",
@@ -84,17 +171,27 @@ char* card_names[TOTAL_CARDS] = {   "2C","3C","4C","5C","6C","7C","8C","9C","TC"
 
 /**
  * @brief Procedure for creating all the lookup tables for the hand evaluator from the CSV file
- * of hand class equivalence tables.
+ * of hand class equivalence tables, or for loading the built-in ones, generated from data/eq_classes.csv
+ * by tools/generate_tables.c, when no file is given.
  *
- * @param csv_file The location of the CSV file storing hand equivalence classes.
+ * @param csv_file The location of the CSV file storing hand equivalence classes. NULL for the built-in tables.
  * @param full_hand_names (Global) Full names of poker hands, indexed by score.
  * @param flushes_table (Global) lookup table containing scores for flush hands.
  * @param unique5_table (Global) lookup table containing scores for straight and high card hands.
  * @param prime_product_table (Global) Sorted array containing products of prime numbers for the hands with repeated ranks.
  * @param prime_product_score_table (Global) Array containing scores for hands with repeated hands.
- * @return -1 for failure opening the data file, 0 for success.
+ * @param prime_product_hash_table (Global) perfect hash table containing scores for hands with repeated ranks.
+ * @param flush7_table (Global) lookup table containing the best flush score of 7-card rank masks.
+ * @param noflush7_table (Global) perfect hash table containing the scores of 7-card hands without flush.
+ * @return -1 for failure opening the data file or building the perfect hash tables, 0 for success.
  */
 int create_lookup_tables(const char *csv_file){
+
+    select_batch_kernels();
+
+    if (csv_file == NULL) {
+        return load_builtin_lookup_tables();
+    }
     
     /* CSV file reading and storing its information into the different structures */
 
@@ -122,7 +219,9 @@ int create_lookup_tables(const char *csv_file){
                 } else if (i == 6) {
                     strcpy(short_hand_names[num_eq], token);
                 } else if (i == 7) {
+                    token[strcspn(token, "\r\n")] = '\0';
                     strcpy(full_hand_names[num_eq], token);
+                    hand_names[num_eq] = full_hand_names[num_eq];
                 }
                 i++;
             }
@@ -143,11 +242,95 @@ int create_lookup_tables(const char *csv_file){
 
     create_unique5_lookup_table(hands,short_hand_names,unique5_table,coded_card_ranks);
     
-    create_prime_product_lookup_tables(hands,short_hand_names,prime_product_table,prime_product_score_table);
+    if (create_prime_product_lookup_tables(hands,short_hand_names,prime_product_table,prime_product_score_table) == -1){
+        fprintf(stderr,"Error when building the perfect hash lookup tables.\n");
+        return -1;
+    }
+
+    // 7-card tables are derived from the 5-card ones, so they must be created last
+
+    create_flush7_lookup_table(flush7_table);
+
+    if (create_noflush7_lookup_tables(noflush7_table,noflush7_displacements) == -1){
+        fprintf(stderr,"Error when building the perfect hash lookup tables.\n");
+        return -1;
+    }
+
+    create_omaha_lookup_tables(omaha_table,omaha_triple_ids);
+
+    return 0;
+}
+
+/**
+ * @brief Loading of the built-in lookup tables, compiled into the program from the generated header
+ * lookup_tables.h. No file is read, and only the Omaha tables are derived from them, which takes well under a
+ * millisecond.
+ *
+ * @return -1 if the program was compiled without the built-in tables (NO_BUILTIN_TABLES), 0 for success.
+ */
+int load_builtin_lookup_tables(){
+#ifdef NO_BUILTIN_TABLES
+    fprintf(stderr,"Error: the hand evaluator was compiled without built-in lookup tables.\n");
+    return -1;
+#else
+    memcpy(flushes_table, builtin_flushes_table, sizeof(builtin_flushes_table));
+    memcpy(unique5_table, builtin_unique5_table, sizeof(builtin_unique5_table));
+    memcpy(prime_product_table, builtin_prime_product_table, sizeof(prime_product_table));
+    memcpy(prime_product_score_table, builtin_prime_product_score_table, sizeof(prime_product_score_table));
+    memcpy(prime_product_hash_table, builtin_prime_product_hash_table, sizeof(builtin_prime_product_hash_table));
+    memcpy(prime_product_displacements, builtin_prime_product_displacements, sizeof(builtin_prime_product_displacements));
+    prime_product_salt = BUILTIN_PRIME_PRODUCT_SALT;
+
+    memcpy(flush7_table, builtin_flush7_table, sizeof(builtin_flush7_table));
+    memcpy(noflush7_table, builtin_noflush7_table, sizeof(builtin_noflush7_table));
+    memcpy(noflush7_displacements, builtin_noflush7_displacements, sizeof(builtin_noflush7_displacements));
+    noflush7_salt = BUILTIN_NOFLUSH7_SALT;
+
+    for(int i = 0; i < NUM_OF_EQUIVALENCES; i++){
+        hand_names[i] = builtin_hand_names[i];
+    }
 
+    create_omaha_lookup_tables(omaha_table,omaha_triple_ids);
     return 0;
+#endif
+}
+
+
+/**
+ * @brief Hash function used by the perfect hash tables. It is the finalizer of MurmurHash3,
+ * a bijection on 32-bit integers. The low bits select the bucket and the high bits the slot.
+ *
+ * @param key Key to hash.
+ * @param salt Value mixed into the key, chosen when the table is built.
+ * @return Hashed key.
+ */
+static inline unsigned int mix_key(unsigned int key, unsigned int salt){
+    key ^= salt;
+    key ^= key >> 16;
+    key *= 0x85EBCA6BU;
+    key ^= key >> 13;
+    key *= 0xC2B2AE35U;
+    key ^= key >> 16;
+    return key;
 }
 
+
+/**
+ * @brief Slot of a key in a table built by build_perfect_hash().
+ *
+ * @param key Key to look up. It must be one of the keys the table was built with.
+ * @param salt Salt chosen when the table was built.
+ * @param displacements Displacement of each bucket.
+ * @param table_bits Logarithm in base 2 of the size of the table.
+ * @param bucket_bits Logarithm in base 2 of the number of buckets.
+ * @return Position of the key in the table.
+ */
+static inline int perfect_hash_slot(unsigned int key, unsigned int salt, const unsigned short displacements[], int table_bits, int bucket_bits){
+    unsigned int hash = mix_key(key,salt);
+    return ((hash >> (32 - table_bits)) ^ displacements[hash & ((1 << bucket_bits) - 1)]) & ((1 << table_bits) - 1);
+}
+
+
 /**
  * @brief Function that obtains the score from the equivalence table of a 5-card hand
  * using all the lookup tables.
@@ -155,17 +338,18 @@ int create_lookup_tables(const char *csv_file){
  * @param cards Array of cards, encoded with the Cactus Kev encoding.
  * @param flushes_table (Global) lookup table containing the scores of flush hands.
  * @param unique5_table (Global) lookup table containing the scores of normal straights and high card hands.
- * @param prime_product_table (Global) sorted array containing the products of the prime numbers of the hands with repeated ranks.
- * @param prime_product_score_table (Global) Array containing the scores of hands with repeated ranks.
+ * @param prime_product_hash_table (Global) perfect hash table containing the scores of the hands with repeated ranks,
+ * indexed by the product of the prime numbers of the hand.
  * @return Score or rank of the equivalence class to which the hand in cards[] belongs.
  */
 unsigned short get_score(int cards[]){
 
     if((cards[0] & cards[1] & cards[2] & cards[3] & cards[4] & 0xF000)){ // it is flush? SF, F
+        SIM_COUNT(score5_flush);
         return flushes_table[ ( cards[0] | cards[1] | cards[2] | cards[3] | cards[4] ) >> 16 ];
     } else if((( cards[0] | cards[1] | cards[2] | cards[3] | cards[4] ) >> 16 ) ==
             ((cards[0] >> 16) + (cards[1] >> 16) + (cards[2] >> 16) + (cards[3] >> 16) + (cards[4] >> 16))){ // ranks are unique?. S,HC
-        
+            SIM_COUNT(score5_unique5);
             return unique5_table[( cards[0] | cards[1] | cards[2] | cards[3] | cards[4] ) >> 16];
             
 
@@ -174,14 +358,767 @@ unsigned short get_score(int cards[]){
             int hand_prime_product = ((cards[0] & 0x00FF) * (cards[1] & 0x00FF) * (cards[2] & 0x00FF) *
                                      (cards[3] & 0x00FF) * (cards[4] & 0x00FF));
 
+            // Constant time perfect hash over the products of prime numbers
+            SIM_COUNT(score5_prime_product);
+            return prime_product_hash_table[perfect_hash_slot(hand_prime_product,prime_product_salt,prime_product_displacements,
+                                                              PRIME_PROD_HASH_TABLE_BITS,PRIME_PROD_HASH_BUCKET_BITS)];
+    }
+
+}
+
+
+/**
+ * @brief Reference version of get_score() that finds the hands with repeated ranks with a binary search
+ * over the sorted products of prime numbers, as in the original Cactus Kev evaluator.
+ * It is kept to validate and benchmark the perfect hash lookup of get_score().
+ *
+ * @param cards Array of cards, encoded with the Cactus Kev encoding.
+ * @param prime_product_table (Global) sorted array containing the products of the prime numbers of the hands with repeated ranks.
+ * @param prime_product_score_table (Global) Array containing the scores of hands with repeated ranks.
+ * @return Score or rank of the equivalence class to which the hand in cards[] belongs.
+ */
+unsigned short get_score_binary_search(int cards[]){
+
+    if((cards[0] & cards[1] & cards[2] & cards[3] & cards[4] & 0xF000)){ // it is flush? SF, F
+        SIM_COUNT(score5_flush);
+        return flushes_table[ ( cards[0] | cards[1] | cards[2] | cards[3] | cards[4] ) >> 16 ];
+    } else if((( cards[0] | cards[1] | cards[2] | cards[3] | cards[4] ) >> 16 ) ==
+            ((cards[0] >> 16) + (cards[1] >> 16) + (cards[2] >> 16) + (cards[3] >> 16) + (cards[4] >> 16))){ // ranks are unique?. S,HC
+            SIM_COUNT(score5_unique5);
+            return unique5_table[( cards[0] | cards[1] | cards[2] | cards[3] | cards[4] ) >> 16];
+    } else { // 4K,3K,2P,1P, FH
+            int hand_prime_product = ((cards[0] & 0x00FF) * (cards[1] & 0x00FF) * (cards[2] & 0x00FF) *
+                                     (cards[3] & 0x00FF) * (cards[4] & 0x00FF));
+
             // Binary search over the ordered vector of prime numbers
+            SIM_COUNT(score5_binary_search);
             int idx = binary_search(prime_product_table,hand_prime_product);
             return prime_product_score_table[idx];
+    }
 
-            
+}
+
+
+/**
+ * @brief Function that obtains the score from the equivalence table of the best 5-card hand
+ * that can be made with 7 cards, in a single pass over the cards.
+ *
+ * Flushes are detected with one 4-bit counter per suit. When there is a flush, no other hand
+ * of the 7 cards can beat it, so the rank bits of the flush suit index flush7_table. Otherwise
+ * the sum of the base 5 weights of the ranks identifies the multiset of ranks, which is looked up
+ * in noflush7_table through a perfect hash.
+ *
+ * @param cards Array of 7 cards, encoded with the Cactus Kev encoding.
+ * @param flush7_table (Global) lookup table containing the best flush score of a rank mask.
+ * @param noflush7_table (Global) perfect hash table containing the scores of hands without flush.
+ * @return Score or rank of the equivalence class to which the best hand in cards[] belongs.
+ */
+unsigned short get_score7(const int cards[7]){
+    unsigned int suit_counters = 0;
+    unsigned int rank_key = 0;
+
+    for(int i = 0; i < 7; i++){
+        suit_counters += SUIT_COUNTERS[(cards[i] >> 12) & 0xF];
+        rank_key += RANK_KEYS[(cards[i] >> 8) & 0xF];
     }
-    return -1;
 
+    // A counter has 5 or more cards if adding 3 sets its highest bit
+    unsigned int flush_suit = ((suit_counters + 0x3333) & 0x8888) >> 3;
+
+    if(flush_suit){
+        int rank_mask = 0;
+        for(int i = 0; i < 7; i++){
+            if(SUIT_COUNTERS[(cards[i] >> 12) & 0xF] == flush_suit) rank_mask |= cards[i] >> 16;
+        }
+        SIM_COUNT(score7_flush);
+        return flush7_table[rank_mask];
+    }
+
+    SIM_COUNT(score7_noflush);
+    return noflush7_table[perfect_hash_slot(rank_key,noflush7_salt,noflush7_displacements,NOFLUSH7_TABLE_BITS,NOFLUSH7_BUCKET_BITS)];
+}
+
+
+/**
+ * @brief Function that obtains the score of the best 5-card hand that can be made with 6 cards, such as two hole
+ * cards and the turn. It is the best of the 6 hands that leave one card out.
+ *
+ * @param cards Array of 6 cards, encoded with the Cactus Kev encoding.
+ * @return Score or rank of the equivalence class to which the best hand in cards[] belongs.
+ */
+unsigned short get_score6(const int cards[6]){
+    int hand[5];
+    unsigned short best_score = 0xFFFF;
+
+    for(int skip = 0; skip < 6; skip++){
+        for(int i = 0, j = 0; i < 6; i++){
+            if(i != skip) hand[j++] = cards[i];
+        }
+        unsigned short score = get_score(hand);
+        if(score < best_score) best_score = score;
+    }
+
+    return best_score;
+}
+
+
+/**
+ * @brief Preparation of a board for eval_with_hole(). It does once the work of get_score7() that only depends on
+ * the community cards: the sum of the base 5 weights of their ranks and the flush candidate. Among 5 cards at most
+ * one suit has 3 or more cards, and only that suit can make a flush with two more cards.
+ *
+ * @param board The 5 community cards, encoded with the Cactus Kev encoding.
+ * @return State of the board, shared by all the players of the game.
+ */
+eval_board_t eval_prepare(const int board[5]){
+    eval_board_t state;
+    unsigned int suit_counters = 0;
+
+    state.rank_key = 0;
+    for(int i = 0; i < 5; i++){
+        suit_counters += SUIT_COUNTERS[(board[i] >> 12) & 0xF];
+        state.rank_key += RANK_KEYS[(board[i] >> 8) & 0xF];
+    }
+
+    state.flush_suit = 0;
+    state.flush_count = 0;
+    state.flush_ranks = 0;
+    for(int i = 0; i < 5; i++){
+        int suit = (board[i] >> 12) & 0xF;
+        if(((suit_counters / SUIT_COUNTERS[suit]) & 0xF) >= 3){
+            state.flush_suit = suit;
+            state.flush_count++;
+            state.flush_ranks |= board[i] >> 16;
+        }
+    }
+
+    return state;
+}
+
+
+/**
+ * @brief Score of the best 5-card hand that a player makes with two hole cards and a board prepared with
+ * eval_prepare(). It is the same score get_score7() returns for the 7 cards, at the cost of two additions,
+ * the flush check of two cards and a single lookup.
+ *
+ * @param board State of the board, see eval_prepare().
+ * @param c1 First hole card, encoded with the Cactus Kev encoding.
+ * @param c2 Second hole card, encoded with the Cactus Kev encoding.
+ * @return Score or rank of the equivalence class of the best hand.
+ */
+unsigned short eval_with_hole(const eval_board_t *board, int c1, int c2){
+    if(board->flush_suit){
+        int in_suit_1 = ((c1 >> 12) & 0xF) == board->flush_suit;
+        int in_suit_2 = ((c2 >> 12) & 0xF) == board->flush_suit;
+        if(board->flush_count + in_suit_1 + in_suit_2 >= 5){
+            int rank_mask = board->flush_ranks | (in_suit_1 ? c1 >> 16 : 0) | (in_suit_2 ? c2 >> 16 : 0);
+            SIM_COUNT(score7_flush);
+            return flush7_table[rank_mask];
+        }
+    }
+
+    SIM_COUNT(score7_noflush);
+    unsigned int rank_key = board->rank_key + RANK_KEYS[(c1 >> 8) & 0xF] + RANK_KEYS[(c2 >> 8) & 0xF];
+    return noflush7_table[perfect_hash_slot(rank_key,noflush7_salt,noflush7_displacements,NOFLUSH7_TABLE_BITS,NOFLUSH7_BUCKET_BITS)];
+}
+
+
+/**
+ * @brief Preparation of a board for omaha_eval_with_hole(). An Omaha hand uses exactly 3 community cards, so the 10
+ * triples of the board are built once per game: the row of the Omaha table of each, with the triples of equal ranks
+ * kept once, and the rank bits of the triples of the only suit that can make a flush.
+ *
+ * @param board The 5 community cards, encoded with the Cactus Kev encoding.
+ * @return State of the board, shared by all the players of the game.
+ */
+omaha_board_t omaha_prepare(const int board[5]){
+    omaha_board_t state;
+    int suit_count[16] = {0};
+    int ranks[5];
+
+    state.num_triples = 0;
+    state.num_flush_triples = 0;
+    state.flush_suit = 0;
+    state.paired = 0;
+
+    for(int i = 0; i < 5; i++){
+        int suit = (board[i] >> 12) & 0xF;
+        if(++suit_count[suit] >= 3) state.flush_suit = suit;
+        ranks[i] = (board[i] >> 8) & 0xF;
+        for(int j = 0; j < i; j++) state.paired |= (ranks[i] == ranks[j]);
+    }
+
+    for(int i = 0; i < 5; i++)
+    for(int j = i + 1; j < 5; j++)
+    for(int k = j + 1; k < 5; k++){
+        if(state.flush_suit && (board[i] & board[j] & board[k] & 0xF000)){
+            state.flush_triple_ranks[state.num_flush_triples++] = (board[i] | board[j] | board[k]) >> 16;
+        }
+
+        int offset = omaha_triple_ids[NUM_RANKS * NUM_RANKS * ranks[i] + NUM_RANKS * ranks[j] + ranks[k]] * OMAHA_RANK_PAIRS;
+        // Only a paired board has triples with the same ranks
+        int repeated = 0;
+        for(int t = 0; t < state.num_triples && state.paired && !repeated; t++) repeated = (state.triple_offsets[t] == offset);
+        if(!repeated) state.triple_offsets[state.num_triples++] = offset;
+    }
+
+    return state;
+}
+
+
+/**
+ * @brief Score of the best Omaha hand of a player: exactly 2 of the 4 hole cards and 3 community cards of a board
+ * prepared with omaha_prepare(). It is the same score get_score_omaha() returns, without its 60 calls to get_score().
+ *
+ * Flushes are only looked for when the board has a suit with 3 cards, and only with the suited pairs of hole cards of
+ * that suit and the triples of that suit. On a board without repeated ranks no full house or quads can be made, so a
+ * flush is the best hand and the rest is skipped. Otherwise the score without flush of every pair of hole cards and
+ * every triple of the board is a single lookup in omaha_table, whose row is the triple and whose column is the pair of
+ * hole ranks.
+ *
+ * @param board State of the board, see omaha_prepare().
+ * @param hole The 4 hole cards, encoded with the Cactus Kev encoding.
+ * @return Score or rank of the equivalence class of the best hand.
+ */
+unsigned short omaha_eval_with_hole(const omaha_board_t *board, const int hole[OMAHA_HOLE_CARDS]){
+    unsigned short best_score = 0xFFFF;
+    int pair_ids[6];
+    int num_pairs = 0;
+
+    for(int i = 0; i < OMAHA_HOLE_CARDS; i++)
+    for(int j = i + 1; j < OMAHA_HOLE_CARDS; j++){
+        int r1 = (hole[i] >> 8) & 0xF, r2 = (hole[j] >> 8) & 0xF;
+        int high = (r1 > r2) ? r1 : r2, low = (r1 > r2) ? r2 : r1;
+        pair_ids[num_pairs++] = high * (high + 1) / 2 + low;
+
+        if(board->flush_suit && (((hole[i] & hole[j]) >> 12) & 0xF) == board->flush_suit){
+            int ranks = (hole[i] | hole[j]) >> 16;
+            for(int t = 0; t < board->num_flush_triples; t++){
+                unsigned short score = flushes_table[board->flush_triple_ranks[t] | ranks];
+                if(score < best_score) best_score = score;
+            }
+        }
+    }
+
+    if(best_score != 0xFFFF && !board->paired) return best_score;
+
+    for(int t = 0; t < board->num_triples; t++){
+        const unsigned short *row = &omaha_table[board->triple_offsets[t]];
+        for(int p = 0; p < num_pairs; p++){
+            if(row[pair_ids[p]] < best_score) best_score = row[pair_ids[p]];
+        }
+    }
+
+    return best_score;
+}
+
+
+/**
+ * @brief Creation of the lookup tables of the Omaha evaluator. omaha_table has a row per multiset of 3 board ranks and
+ * a column per multiset of 2 hole ranks (column high * (high + 1) / 2 + low), with the score of the 5 ranks without
+ * flush: unique5_table for 5 different ranks and the perfect hash of the prime products otherwise, as in get_score().
+ * Five cards of the same rank can not be dealt, so their entry is 0xFFFF. It must be created after the 5-card tables.
+ *
+ * @param omaha Omaha table to fill.
+ * @param triple_ids Row of every ordered triple of ranks, indexed by 169 * r1 + 13 * r2 + r3.
+ */
+void create_omaha_lookup_tables(unsigned short omaha[], unsigned short triple_ids[]){
+    int num_triples = 0;
+
+    for(int a = 0; a < NUM_RANKS; a++)
+    for(int b = a; b < NUM_RANKS; b++)
+    for(int c = b; c < NUM_RANKS; c++){
+        int triple[3] = { a, b, c };
+
+        // Every permutation of the triple has the same row
+        for(int p = 0; p < 6; p++){
+            int r1 = triple[p / 2], r2 = triple[(p / 2 + 1 + p % 2) % 3], r3 = triple[(p / 2 + 2 - p % 2) % 3];
+            triple_ids[NUM_RANKS * NUM_RANKS * r1 + NUM_RANKS * r2 + r3] = num_triples;
+        }
+
+        for(int high = 0; high < NUM_RANKS; high++)
+        for(int low = 0; low <= high; low++){
+            int ranks[5] = { a, b, c, high, low };
+            int counts[NUM_RANKS] = {0};
+            int rank_bits = 0, prime_product = 1, max_count = 0;
+
+            for(int i = 0; i < 5; i++){
+                rank_bits |= 1 << ranks[i];
+                prime_product *= PRIMES[ranks[i]];
+                if(++counts[ranks[i]] > max_count) max_count = counts[ranks[i]];
+            }
+
+            unsigned short score;
+            if(max_count == 5){
+                score = 0xFFFF;
+            } else if(max_count == 1){
+                score = unique5_table[rank_bits];
+            } else {
+                score = prime_product_hash_table[perfect_hash_slot(prime_product,prime_product_salt,prime_product_displacements,
+                                                                   PRIME_PROD_HASH_TABLE_BITS,PRIME_PROD_HASH_BUCKET_BITS)];
+            }
+            omaha[num_triples * OMAHA_RANK_PAIRS + high * (high + 1) / 2 + low] = score;
+        }
+        num_triples++;
+    }
+}
+
+
+/**
+ * @brief Reference Omaha evaluator: the best of the 60 hands of 2 hole cards and 3 community cards, each one scored
+ * with get_score(). It is kept to validate and benchmark omaha_eval_with_hole().
+ *
+ * @param hole The 4 hole cards, encoded with the Cactus Kev encoding.
+ * @param board The 5 community cards, encoded with the Cactus Kev encoding.
+ * @return Score or rank of the equivalence class of the best hand.
+ */
+unsigned short get_score_omaha(const int hole[OMAHA_HOLE_CARDS], const int board[5]){
+    unsigned short best_score = 0xFFFF;
+    int hand[5];
+
+    for(int i = 0; i < OMAHA_HOLE_CARDS; i++)
+    for(int j = i + 1; j < OMAHA_HOLE_CARDS; j++){
+        hand[0] = hole[i];
+        hand[1] = hole[j];
+        for(int a = 0; a < 5; a++)
+        for(int b = a + 1; b < 5; b++)
+        for(int c = b + 1; c < 5; c++){
+            hand[2] = board[a];
+            hand[3] = board[b];
+            hand[4] = board[c];
+            unsigned short score = get_score(hand);
+            if(score < best_score) best_score = score;
+        }
+    }
+
+    return best_score;
+}
+
+
+/**
+ * @brief Scalar kernel of get_scores_batch(), used when the CPU has no supported vector extension.
+ *
+ * @param cards Cards of the hands, card j of hand i at cards[j * n + i].
+ * @param out Scores of the hands.
+ * @param n Number of hands.
+ */
+static void get_scores_batch_scalar(const int *cards, unsigned short *out, size_t n){
+    for(size_t i = 0; i < n; i++){
+        int hand[5] = { cards[i], cards[n + i], cards[2 * n + i], cards[3 * n + i], cards[4 * n + i] };
+        out[i] = get_score(hand);
+    }
+}
+
+
+/**
+ * @brief Scalar kernel of get_scores7_batch(), used when the CPU has no supported vector extension.
+ *
+ * @param cards Cards of the hands, card j of hand i at cards[j * n + i].
+ * @param out Scores of the hands.
+ * @param n Number of hands.
+ */
+static void get_scores7_batch_scalar(const int *cards, unsigned short *out, size_t n){
+    for(size_t i = 0; i < n; i++){
+        int hand[7] = { cards[i], cards[n + i], cards[2 * n + i], cards[3 * n + i], cards[4 * n + i], cards[5 * n + i], cards[6 * n + i] };
+        out[i] = get_score7(hand);
+    }
+}
+
+
+#ifdef HAVE_X86_SIMD
+
+/*
+    Vector kernels. They follow the same steps as get_score() and get_score7(), but every lane scores a
+    different hand and the lookups are gathers. Gathers read 32 bits, so the unsigned short tables have
+    GATHER_PADDING extra elements and the upper 16 bits of every gathered value are discarded.
+*/
+
+/**
+ * @brief mix_key() of 8 keys.
+ */
+__attribute__((target("avx2")))
+static inline __m256i mix_key_avx2(__m256i key, unsigned int salt){
+    key = _mm256_xor_si256(key, _mm256_set1_epi32((int) salt));
+    key = _mm256_xor_si256(key, _mm256_srli_epi32(key, 16));
+    key = _mm256_mullo_epi32(key, _mm256_set1_epi32((int) 0x85EBCA6BU));
+    key = _mm256_xor_si256(key, _mm256_srli_epi32(key, 13));
+    key = _mm256_mullo_epi32(key, _mm256_set1_epi32((int) 0xC2B2AE35U));
+    key = _mm256_xor_si256(key, _mm256_srli_epi32(key, 16));
+    return key;
+}
+
+
+/**
+ * @brief Lookup of 8 keys in a table built by build_perfect_hash(), only in the lanes of mask.
+ *
+ * @param scores Scores of the lanes not in mask, kept as they are.
+ * @param mask Lanes to look up (all bits set).
+ * @return scores with the lanes of mask replaced by the values of their keys.
+ */
+__attribute__((target("avx2")))
+static inline __m256i perfect_hash_lookup_avx2(__m256i scores, __m256i mask, __m256i key, unsigned int salt, const unsigned short displacements[],
+                                               const unsigned short table[], int table_bits, int bucket_bits){
+    const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+    __m256i hash = mix_key_avx2(key, salt);
+    __m256i bucket = _mm256_and_si256(hash, _mm256_set1_epi32((1 << bucket_bits) - 1));
+    __m256i displacement = _mm256_and_si256(_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *) displacements, bucket, mask, 2), low16);
+    __m256i slot = _mm256_and_si256(_mm256_xor_si256(_mm256_srli_epi32(hash, 32 - table_bits), displacement), _mm256_set1_epi32((1 << table_bits) - 1));
+    __m256i value = _mm256_and_si256(_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *) table, slot, mask, 2), low16);
+    return _mm256_blendv_epi8(scores, value, mask);
+}
+
+
+/**
+ * @brief Storage of 8 scores as unsigned shorts.
+ */
+__attribute__((target("avx2")))
+static inline void store_scores_avx2(unsigned short *out, __m256i scores){
+    __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(scores), _mm256_extracti128_si256(scores, 1));
+    _mm_storeu_si128((__m128i *) out, packed);
+}
+
+
+/**
+ * @brief AVX2 kernel of get_scores_batch(), 8 hands per iteration.
+ */
+__attribute__((target("avx2")))
+static void get_scores_batch_avx2(const int *cards, unsigned short *out, size_t n){
+    const __m256i low8 = _mm256_set1_epi32(0xFF);
+    const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for(; i + 8 <= n; i += 8){
+        __m256i c[5];
+        for(int j = 0; j < 5; j++) c[j] = _mm256_loadu_si256((const __m256i *) (cards + j * n + i));
+
+        __m256i suits_and = _mm256_set1_epi32(0xF000);
+        __m256i ranks_or = zero;
+        __m256i ranks_sum = zero;
+        __m256i prime_product = _mm256_set1_epi32(1);
+        for(int j = 0; j < 5; j++){
+            suits_and = _mm256_and_si256(suits_and, c[j]);
+            ranks_or = _mm256_or_si256(ranks_or, c[j]);
+            ranks_sum = _mm256_add_epi32(ranks_sum, _mm256_srli_epi32(c[j], 16));
+            prime_product = _mm256_mullo_epi32(prime_product, _mm256_and_si256(c[j], low8));
+        }
+        ranks_or = _mm256_srli_epi32(ranks_or, 16);
+
+        __m256i flush = _mm256_xor_si256(_mm256_cmpeq_epi32(suits_and, zero), _mm256_set1_epi32(-1));
+        __m256i unique = _mm256_andnot_si256(flush, _mm256_cmpeq_epi32(ranks_or, ranks_sum));
+        __m256i repeated = _mm256_xor_si256(_mm256_or_si256(flush, unique), _mm256_set1_epi32(-1));
+        __m256i scores = zero;
+
+        if(_mm256_movemask_epi8(flush)){
+            scores = _mm256_mask_i32gather_epi32(scores, (const int *) flushes_table, ranks_or, flush, 2);
+        }
+        if(_mm256_movemask_epi8(unique)){
+            scores = _mm256_mask_i32gather_epi32(scores, (const int *) unique5_table, ranks_or, unique, 2);
+        }
+        scores = _mm256_and_si256(scores, low16);
+        if(_mm256_movemask_epi8(repeated)){
+            scores = perfect_hash_lookup_avx2(scores, repeated, prime_product, prime_product_salt, prime_product_displacements,
+                                              prime_product_hash_table, PRIME_PROD_HASH_TABLE_BITS, PRIME_PROD_HASH_BUCKET_BITS);
+        }
+
+        store_scores_avx2(out + i, scores);
+    }
+
+    // Remaining hands
+    for(; i < n; i++){
+        int hand[5] = { cards[i], cards[n + i], cards[2 * n + i], cards[3 * n + i], cards[4 * n + i] };
+        out[i] = get_score(hand);
+    }
+}
+
+
+/**
+ * @brief AVX2 kernel of get_scores7_batch(), 8 hands per iteration. The suit counter increment of a card,
+ * 1 << (4 * suit), is the fourth power of its suit bit, and the base 5 weight of a rank is taken from two
+ * 8-entry permutations instead of a gather.
+ */
+__attribute__((target("avx2")))
+static void get_scores7_batch_avx2(const int *cards, unsigned short *out, size_t n){
+    const __m256i low4 = _mm256_set1_epi32(0xF);
+    const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rank_keys_low = _mm256_loadu_si256((const __m256i *) RANK_KEYS);
+    const __m256i rank_keys_high = _mm256_loadu_si256((const __m256i *) (RANK_KEYS + NUM_RANKS - 8));
+    size_t i = 0;
+
+    for(; i + 8 <= n; i += 8){
+        __m256i c[7], suit_counter[7];
+        __m256i suit_counters = zero;
+        __m256i rank_key = zero;
+
+        for(int j = 0; j < 7; j++){
+            c[j] = _mm256_loadu_si256((const __m256i *) (cards + j * n + i));
+
+            __m256i suit = _mm256_and_si256(_mm256_srli_epi32(c[j], 12), low4);
+            suit = _mm256_mullo_epi32(suit, suit);
+            suit_counter[j] = _mm256_mullo_epi32(suit, suit);
+            suit_counters = _mm256_add_epi32(suit_counters, suit_counter[j]);
+
+            __m256i rank = _mm256_and_si256(_mm256_srli_epi32(c[j], 8), low4);
+            __m256i high = _mm256_cmpgt_epi32(rank, _mm256_set1_epi32(7));
+            __m256i key_low = _mm256_permutevar8x32_epi32(rank_keys_low, rank);
+            __m256i key_high = _mm256_permutevar8x32_epi32(rank_keys_high, _mm256_sub_epi32(rank, _mm256_set1_epi32(NUM_RANKS - 8)));
+            rank_key = _mm256_add_epi32(rank_key, _mm256_blendv_epi8(key_low, key_high, high));
+        }
+
+        // A counter has 5 or more cards if adding 3 sets its highest bit
+        __m256i flush_suit = _mm256_srli_epi32(_mm256_and_si256(_mm256_add_epi32(suit_counters, _mm256_set1_epi32(0x3333)), _mm256_set1_epi32(0x8888)), 3);
+        __m256i no_flush = _mm256_cmpeq_epi32(flush_suit, zero);
+        __m256i scores = zero;
+
+        if(_mm256_movemask_epi8(no_flush) != -1){
+            __m256i rank_mask = zero;
+            for(int j = 0; j < 7; j++){
+                __m256i in_flush = _mm256_cmpeq_epi32(suit_counter[j], flush_suit);
+                rank_mask = _mm256_or_si256(rank_mask, _mm256_and_si256(in_flush, _mm256_srli_epi32(c[j], 16)));
+            }
+            __m256i flush = _mm256_xor_si256(no_flush, _mm256_set1_epi32(-1));
+            scores = _mm256_and_si256(_mm256_mask_i32gather_epi32(zero, (const int *) flush7_table, rank_mask, flush, 2), low16);
+        }
+        if(_mm256_movemask_epi8(no_flush)){
+            scores = perfect_hash_lookup_avx2(scores, no_flush, rank_key, noflush7_salt, noflush7_displacements,
+                                              noflush7_table, NOFLUSH7_TABLE_BITS, NOFLUSH7_BUCKET_BITS);
+        }
+
+        store_scores_avx2(out + i, scores);
+    }
+
+    // Remaining hands
+    for(; i < n; i++){
+        int hand[7] = { cards[i], cards[n + i], cards[2 * n + i], cards[3 * n + i], cards[4 * n + i], cards[5 * n + i], cards[6 * n + i] };
+        out[i] = get_score7(hand);
+    }
+}
+
+
+/**
+ * @brief mix_key() of 16 keys.
+ */
+__attribute__((target("avx512f")))
+static inline __m512i mix_key_avx512(__m512i key, unsigned int salt){
+    key = _mm512_xor_si512(key, _mm512_set1_epi32((int) salt));
+    key = _mm512_xor_si512(key, _mm512_srli_epi32(key, 16));
+    key = _mm512_mullo_epi32(key, _mm512_set1_epi32((int) 0x85EBCA6BU));
+    key = _mm512_xor_si512(key, _mm512_srli_epi32(key, 13));
+    key = _mm512_mullo_epi32(key, _mm512_set1_epi32((int) 0xC2B2AE35U));
+    key = _mm512_xor_si512(key, _mm512_srli_epi32(key, 16));
+    return key;
+}
+
+
+/**
+ * @brief Lookup of 16 keys in a table built by build_perfect_hash(), only in the lanes of mask.
+ *
+ * @param scores Scores of the lanes not in mask, kept as they are.
+ * @param mask Lanes to look up.
+ * @return scores with the lanes of mask replaced by the values of their keys.
+ */
+__attribute__((target("avx512f")))
+static inline __m512i perfect_hash_lookup_avx512(__m512i scores, __mmask16 mask, __m512i key, unsigned int salt, const unsigned short displacements[],
+                                                 const unsigned short table[], int table_bits, int bucket_bits){
+    const __m512i low16 = _mm512_set1_epi32(0xFFFF);
+    __m512i hash = mix_key_avx512(key, salt);
+    __m512i bucket = _mm512_and_si512(hash, _mm512_set1_epi32((1 << bucket_bits) - 1));
+    __m512i displacement = _mm512_and_si512(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, bucket, displacements, 2), low16);
+    __m512i slot = _mm512_and_si512(_mm512_xor_si512(_mm512_srli_epi32(hash, 32 - table_bits), displacement), _mm512_set1_epi32((1 << table_bits) - 1));
+    __m512i value = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, slot, table, 2);
+    return _mm512_mask_mov_epi32(scores, mask, _mm512_and_si512(value, low16));
+}
+
+
+/**
+ * @brief AVX-512 kernel of get_scores_batch(), 16 hands per iteration.
+ */
+__attribute__((target("avx512f")))
+static void get_scores_batch_avx512(const int *cards, unsigned short *out, size_t n){
+    const __m512i low8 = _mm512_set1_epi32(0xFF);
+    const __m512i low16 = _mm512_set1_epi32(0xFFFF);
+    const __m512i zero = _mm512_setzero_si512();
+    size_t i = 0;
+
+    for(; i + 16 <= n; i += 16){
+        __m512i suits_and = _mm512_set1_epi32(0xF000);
+        __m512i ranks_or = zero;
+        __m512i ranks_sum = zero;
+        __m512i prime_product = _mm512_set1_epi32(1);
+        for(int j = 0; j < 5; j++){
+            __m512i c = _mm512_loadu_si512((const void *) (cards + j * n + i));
+            suits_and = _mm512_and_si512(suits_and, c);
+            ranks_or = _mm512_or_si512(ranks_or, c);
+            ranks_sum = _mm512_add_epi32(ranks_sum, _mm512_srli_epi32(c, 16));
+            prime_product = _mm512_mullo_epi32(prime_product, _mm512_and_si512(c, low8));
+        }
+        ranks_or = _mm512_srli_epi32(ranks_or, 16);
+
+        __mmask16 flush = _mm512_test_epi32_mask(suits_and, suits_and);
+        __mmask16 unique = _mm512_mask_cmpeq_epi32_mask((__mmask16) ~flush, ranks_or, ranks_sum);
+        __mmask16 repeated = (__mmask16) ~(flush | unique);
+        __m512i scores = zero;
+
+        if(flush) scores = _mm512_mask_i32gather_epi32(scores, flush, ranks_or, flushes_table, 2);
+        if(unique) scores = _mm512_mask_i32gather_epi32(scores, unique, ranks_or, unique5_table, 2);
+        scores = _mm512_and_si512(scores, low16);
+        if(repeated){
+            scores = perfect_hash_lookup_avx512(scores, repeated, prime_product, prime_product_salt, prime_product_displacements,
+                                                prime_product_hash_table, PRIME_PROD_HASH_TABLE_BITS, PRIME_PROD_HASH_BUCKET_BITS);
+        }
+
+        _mm256_storeu_si256((__m256i *) (out + i), _mm512_cvtepi32_epi16(scores));
+    }
+
+    // Remaining hands
+    for(; i < n; i++){
+        int hand[5] = { cards[i], cards[n + i], cards[2 * n + i], cards[3 * n + i], cards[4 * n + i] };
+        out[i] = get_score(hand);
+    }
+}
+
+
+/**
+ * @brief AVX-512 kernel of get_scores7_batch(), 16 hands per iteration. The base 5 weights of the 13 ranks fit
+ * in a single 16-entry permutation.
+ */
+__attribute__((target("avx512f")))
+static void get_scores7_batch_avx512(const int *cards, unsigned short *out, size_t n){
+    const __m512i low4 = _mm512_set1_epi32(0xF);
+    const __m512i zero = _mm512_setzero_si512();
+    int rank_keys[16] = { 0 };
+    memcpy(rank_keys, RANK_KEYS, sizeof(RANK_KEYS));
+    const __m512i rank_keys_vector = _mm512_loadu_si512((const void *) rank_keys);
+    size_t i = 0;
+
+    for(; i + 16 <= n; i += 16){
+        __m512i c[7], suit_counter[7];
+        __m512i suit_counters = zero;
+        __m512i rank_key = zero;
+
+        for(int j = 0; j < 7; j++){
+            c[j] = _mm512_loadu_si512((const void *) (cards + j * n + i));
+
+            __m512i suit = _mm512_and_si512(_mm512_srli_epi32(c[j], 12), low4);
+            suit = _mm512_mullo_epi32(suit, suit);
+            suit_counter[j] = _mm512_mullo_epi32(suit, suit);
+            suit_counters = _mm512_add_epi32(suit_counters, suit_counter[j]);
+
+            __m512i rank = _mm512_and_si512(_mm512_srli_epi32(c[j], 8), low4);
+            rank_key = _mm512_add_epi32(rank_key, _mm512_permutexvar_epi32(rank, rank_keys_vector));
+        }
+
+        // A counter has 5 or more cards if adding 3 sets its highest bit
+        __m512i flush_suit = _mm512_srli_epi32(_mm512_and_si512(_mm512_add_epi32(suit_counters, _mm512_set1_epi32(0x3333)), _mm512_set1_epi32(0x8888)), 3);
+        __mmask16 flush = _mm512_test_epi32_mask(flush_suit, flush_suit);
+        __m512i scores = zero;
+
+        if(flush){
+            __m512i rank_mask = zero;
+            for(int j = 0; j < 7; j++){
+                __mmask16 in_flush = _mm512_cmpeq_epi32_mask(suit_counter[j], flush_suit);
+                rank_mask = _mm512_mask_or_epi32(rank_mask, in_flush, rank_mask, _mm512_srli_epi32(c[j], 16));
+            }
+            scores = _mm512_and_si512(_mm512_mask_i32gather_epi32(zero, flush, rank_mask, flush7_table, 2), _mm512_set1_epi32(0xFFFF));
+        }
+        // Lanes without a flush, kept as a 16-bit mask: ~flush alone is an int whose upper bits are always set
+        __mmask16 no_flush = (__mmask16) ~flush;
+        if(no_flush){
+            scores = perfect_hash_lookup_avx512(scores, no_flush, rank_key, noflush7_salt, noflush7_displacements,
+                                                noflush7_table, NOFLUSH7_TABLE_BITS, NOFLUSH7_BUCKET_BITS);
+        }
+
+        _mm256_storeu_si256((__m256i *) (out + i), _mm512_cvtepi32_epi16(scores));
+    }
+
+    // Remaining hands
+    for(; i < n; i++){
+        int hand[7] = { cards[i], cards[n + i], cards[2 * n + i], cards[3 * n + i], cards[4 * n + i], cards[5 * n + i], cards[6 * n + i] };
+        out[i] = get_score7(hand);
+    }
+}
+
+#endif
+
+
+/**
+ * @brief Selection of the batch kernels for the CPU the program runs on: AVX-512, AVX2 or scalar.
+ * It is called once, when the lookup tables are created.
+ *
+ * @param scores_batch_kernel (Global) kernel used by get_scores_batch().
+ * @param scores7_batch_kernel (Global) kernel used by get_scores7_batch().
+ * @param batch_kernels_kind (Global) instruction set of the kernels, see get_scores_batch_kind().
+ */
+void select_batch_kernels(){
+    scores_batch_kernel = get_scores_batch_scalar;
+    scores7_batch_kernel = get_scores7_batch_scalar;
+    batch_kernels_isa = "scalar";
+    batch_kernels_kind = EVAL_BATCH_SCALAR;
+
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")){
+        scores_batch_kernel = get_scores_batch_avx512;
+        scores7_batch_kernel = get_scores7_batch_avx512;
+        batch_kernels_isa = "avx512";
+        batch_kernels_kind = EVAL_BATCH_AVX512;
+    } else if(__builtin_cpu_supports("avx2")){
+        scores_batch_kernel = get_scores_batch_avx2;
+        scores7_batch_kernel = get_scores7_batch_avx2;
+        batch_kernels_isa = "avx2";
+        batch_kernels_kind = EVAL_BATCH_AVX2;
+    }
+#endif
+}
+
+
+/**
+ * @brief Scoring of a batch of 5-card hands, several hands per instruction when the CPU supports it.
+ * Hands are stored as a structure of arrays: card j of hand i is cards[j * n + i].
+ *
+ * @param cards Cards of the hands, encoded with the Cactus Kev encoding.
+ * @param out Array where the score of each hand is stored, the same get_score() returns.
+ * @param n Number of hands.
+ */
+void get_scores_batch(const int *cards, unsigned short *out, size_t n){
+    SIM_ADD(batch_hands, n);
+    scores_batch_kernel(cards, out, n);
+}
+
+
+/**
+ * @brief Scoring of a batch of 7-card hands, several hands per instruction when the CPU supports it.
+ * Hands are stored as a structure of arrays: card j of hand i is cards[j * n + i].
+ *
+ * @param cards Cards of the hands, encoded with the Cactus Kev encoding.
+ * @param out Array where the score of each hand is stored, the same get_score7() returns.
+ * @param n Number of hands.
+ */
+void get_scores7_batch(const int *cards, unsigned short *out, size_t n){
+    SIM_ADD(batch_hands, n);
+    scores7_batch_kernel(cards, out, n);
+}
+
+
+/**
+ * @brief Name of the instruction set used by get_scores_batch() and get_scores7_batch().
+ *
+ * @return "avx512", "avx2" or "scalar".
+ */
+const char *get_scores_batch_isa(){
+    return batch_kernels_isa;
+}
+
+
+/**
+ * @brief Instruction set used by get_scores_batch() and get_scores7_batch(), for callers that choose between the
+ * batch evaluators and the single hand ones.
+ *
+ * @return EVAL_BATCH_AVX512, EVAL_BATCH_AVX2 or EVAL_BATCH_SCALAR.
+ */
+eval_batch_kind_t get_scores_batch_kind(){
+    return batch_kernels_kind;
 }
 
 
@@ -210,8 +1147,10 @@ void create_rank_lookup_table(unsigned short coded_card_ranks[]){
  * @param short_hand_names Array where abbreviated names of hands from the equivalence table are stored.
  * @param prime_product_table Sorted array that contains the products of prime numbers for the hands.
  * @param score_table Array containing scores for hands that do not have 5 different cards ranks.
+ * @param prime_product_hash_table (Global) perfect hash table with the same scores, indexed by the product of prime numbers.
+ * @return -1 if the perfect hash could not be built, 0 for success.
  */
-void create_prime_product_lookup_tables(char hands[NUM_OF_EQUIVALENCES][5], char short_hand_names[NUM_OF_EQUIVALENCES][NUM_MAX_SHORT_HAND_NAME], int prime_product_table[], unsigned short score_table[]){
+int create_prime_product_lookup_tables(char hands[NUM_OF_EQUIVALENCES][5], char short_hand_names[NUM_OF_EQUIVALENCES][NUM_MAX_SHORT_HAND_NAME], int prime_product_table[], unsigned short score_table[]){
     int prime_product_hand_rank[PRIME_PROD_TABLE_SIZE][2]; // [][0] -> Prime product,  [][1] -> Poker hand score
     for (int i = 0,  idx = 0; i < NUM_OF_EQUIVALENCES ; i++) {
         if(!(strcmp(short_hand_names[i],STRAIGHT_FLUSH) == 0) && !(strcmp(short_hand_names[i],FLUSH) == 0) &&
@@ -224,7 +1163,6 @@ void create_prime_product_lookup_tables(char hands[NUM_OF_EQUIVALENCES][5], char
                 }
                 res_number *= PRIMES[k];
             }
-            prime_product_table[idx] =  res_number;
             prime_product_hand_rank[idx][0] = res_number;
             prime_product_hand_rank[idx][1] = i + 1;
             
@@ -233,17 +1171,28 @@ void create_prime_product_lookup_tables(char hands[NUM_OF_EQUIVALENCES][5], char
         }
     }
 
-    quickSort(prime_product_table, 0, PRIME_PROD_TABLE_SIZE - 1);
+    // Sorting the pairs keeps every product next to its score
+    qsort(prime_product_hand_rank, PRIME_PROD_TABLE_SIZE, sizeof(prime_product_hand_rank[0]), compare_prime_products);
 
+    for(int i = 0; i < PRIME_PROD_TABLE_SIZE; i++){
+        prime_product_table[i] = prime_product_hand_rank[i][0];
+        score_table[i] = prime_product_hand_rank[i][1];
+    }
+
+    /* Perfect hash over the products of prime numbers, used by get_score() */
+
+    int slots[PRIME_PROD_TABLE_SIZE];
+    if(build_perfect_hash((const unsigned int *) prime_product_table, PRIME_PROD_TABLE_SIZE, PRIME_PROD_HASH_TABLE_BITS, PRIME_PROD_HASH_BUCKET_BITS,
+                          &prime_product_salt, prime_product_displacements, slots) == -1){
+        return -1;
+    }
 
+    memset(prime_product_hash_table, 0, sizeof(prime_product_hash_table));
     for(int i = 0; i < PRIME_PROD_TABLE_SIZE; i++){
-        for(int j = 0; j < PRIME_PROD_TABLE_SIZE; j++){
-            if(prime_product_table[i] == prime_product_hand_rank[j][0]){
-                score_table[i] = prime_product_hand_rank[j][1];
-            }
-        }
+        prime_product_hash_table[slots[i]] = score_table[i];
     }
 
+    return 0;
 }
 
 
@@ -294,6 +1243,123 @@ void create_flushes_lookup_table(char hands[NUM_OF_EQUIVALENCES][5], char short_
 }
 
 
+/**
+ * @brief Creation of the lookup table for the best flush of 7 cards. Given the rank bits of the
+ * cards of the flush suit (5, 6 or 7 bits), it stores the best score among all the 5-card flushes
+ * that can be made with them. Masks are processed in increasing order, so the masks with one bit
+ * less have already been computed.
+ *
+ * @param flush7 Lookup table that contains the best flush score of each rank mask.
+ * @param flushes_table (Global) lookup table containing scores for 5-card flush hands.
+ */
+void create_flush7_lookup_table(unsigned short flush7[]){
+    for(int mask = 0; mask < FLUSH7_TABLE_SIZE; mask++){
+        int num_bits = 0;
+        for(int b = 0; b < NUM_RANKS; b++) num_bits += (mask >> b) & 1;
+
+        if(num_bits < 5){
+            flush7[mask] = 0; // There is no flush with less than 5 cards
+        } else if(num_bits == 5){
+            flush7[mask] = flushes_table[mask];
+        } else {
+            unsigned short best_score = 0xFFFF;
+            for(int b = 0; b < NUM_RANKS; b++){
+                if(((mask >> b) & 1) && flush7[mask & ~(1 << b)] < best_score){
+                    best_score = flush7[mask & ~(1 << b)];
+                }
+            }
+            flush7[mask] = best_score;
+        }
+    }
+}
+
+
+/**
+ * @brief Recursive enumeration of all the multisets of 7 ranks with at most 4 cards of each rank.
+ * For each multiset it stores its key (sum of the base 5 weights of its ranks) and the score of its
+ * best 5-card hand, evaluated with suits assigned so that there is never a flush.
+ *
+ * @param rank Rank whose number of cards is being decided.
+ * @param remaining Number of cards left to reach 7.
+ * @param counts Number of cards of each rank already decided.
+ * @param keys Array where the keys of the multisets are stored.
+ * @param scores Array where the scores of the multisets are stored.
+ * @param num_found Number of multisets stored so far.
+ * @return Number of multisets stored after the enumeration of this branch.
+ */
+static int enumerate_rank_multisets(int rank, int remaining, int counts[], unsigned int keys[], unsigned short scores[], int num_found){
+    if(rank == NUM_RANKS){
+        if(remaining != 0) return num_found;
+
+        int seven_card_hand[7];
+        unsigned int key = 0;
+
+        // Cards of the same rank are consecutive, so cycling the suits never repeats a card and never makes a flush
+        for(int r = 0, n = 0; r < NUM_RANKS; r++){
+            for(int c = 0; c < counts[r]; c++, n++){
+                seven_card_hand[n] = PRIMES[r] | (r << 8) | (0x8000 >> (n % 4)) | (1 << (16 + r));
+                key += RANK_KEYS[r];
+            }
+        }
+
+        unsigned short best_score = 0xFFFF;
+        int cards[5];
+        for(int i = 0; i < NUM_OF_SUBSETS_5_OF_7; i++){
+            for(int j = 0; j < 5; j++){
+                cards[j] = seven_card_hand[groups_5[i][j]];
+            }
+            unsigned short score = get_score(cards);
+            if(score < best_score) best_score = score;
+        }
+
+        keys[num_found] = key;
+        scores[num_found] = best_score;
+        return num_found + 1;
+    }
+
+    for(int c = 0; c <= 4 && c <= remaining; c++){
+        counts[rank] = c;
+        num_found = enumerate_rank_multisets(rank + 1, remaining - c, counts, keys, scores, num_found);
+    }
+    return num_found;
+}
+
+
+/**
+ * @brief Creation of the perfect hash table for 7-card hands without flush. Each multiset of ranks
+ * is identified by its key, and the key is placed in the table with a perfect hash built
+ * for the NOFLUSH7_NUM_KEYS possible keys.
+ *
+ * @param noflush7 Perfect hash table containing the scores of 7-card hands without flush.
+ * @param displacements Displacement of each bucket of the perfect hash.
+ * @param noflush7_salt (Global) Salt of the perfect hash.
+ * @return -1 if the perfect hash could not be built, 0 for success.
+ */
+int create_noflush7_lookup_tables(unsigned short noflush7[], unsigned short displacements[]){
+    unsigned int *keys = malloc(NOFLUSH7_NUM_KEYS * sizeof(unsigned int));
+    unsigned short *scores = malloc(NOFLUSH7_NUM_KEYS * sizeof(unsigned short));
+    int *slots = malloc(NOFLUSH7_NUM_KEYS * sizeof(int));
+    int counts[NUM_RANKS];
+    int rtn = -1;
+
+    if(keys != NULL && scores != NULL && slots != NULL &&
+        enumerate_rank_multisets(0, 7, counts, keys, scores, 0) == NOFLUSH7_NUM_KEYS &&
+        build_perfect_hash(keys, NOFLUSH7_NUM_KEYS, NOFLUSH7_TABLE_BITS, NOFLUSH7_BUCKET_BITS, &noflush7_salt, displacements, slots) == 0){
+
+        memset(noflush7, 0, (1 << NOFLUSH7_TABLE_BITS) * sizeof(unsigned short));
+        for(int i = 0; i < NOFLUSH7_NUM_KEYS; i++){
+            noflush7[slots[i]] = scores[i];
+        }
+        rtn = 0;
+    }
+
+    free(keys);
+    free(scores);
+    free(slots);
+    return rtn;
+}
+
+
 /**
         *  @brief  Obtaining the full hand name from the score.
         *           
@@ -303,7 +1369,7 @@ void create_flushes_lookup_table(char hands[NUM_OF_EQUIVALENCES][5], char short_
         * @return Full hand name.
 */
 void get_full_hand_name_by_score(int score,char name[],int name_size){
-    strncpy(name,full_hand_names[score],name_size - 1); //Avoid overflow buffering
+    strncpy(name,hand_names[score - 1],name_size - 1); //Avoid overflow buffering
     name[name_size - 1] = '\0'; // Ensure null termination
 }
 
@@ -345,55 +1411,117 @@ int binary_search(int v[], int To_Find)
 
 
 /**
-        *  @brief  Given two integer pointer swaps its contents.
-        *  Extracted from https://www.javatpoint.com/quick-sort-in-c
-        * 
-        * @param  a value to swap
-        * @param  b value to swap
-*/
-void swap(int* a, int* b) {  
-    int t = *a;  
-    *a = *b;  
-    *b = t;  
+ * @brief Comparison of two (product of prime numbers, score) pairs by their product, for qsort().
+ *
+ * @param a First pair.
+ * @param b Second pair.
+ * @return Negative, zero or positive if the first product is smaller, equal or greater than the second.
+ */
+int compare_prime_products(const void *a, const void *b){
+    int product_a = ((const int *) a)[0];
+    int product_b = ((const int *) b)[0];
+    return (product_a > product_b) - (product_a < product_b);
 }
 
 
+/**
+ * @brief Construction of a perfect hash with the "hash and displace" method. Keys are hashed with
+ * mix_key(), grouped into buckets by the low bits of the hash, and each bucket, from the largest to
+ * the smallest, is assigned the first displacement that moves all its keys to free slots:
+ *
+ *      slot = ((hash >> (32 - table_bits)) ^ displacements[hash & (num_buckets - 1)]) & (table_size - 1)
+ *
+ * If some bucket can not be placed, the construction is repeated with another salt.
+ *
+ * @param keys Distinct keys to place in the table.
+ * @param num_keys Number of keys.
+ * @param table_bits Logarithm in base 2 of the size of the table.
+ * @param bucket_bits Logarithm in base 2 of the number of buckets.
+ * @param salt Salt of the hash function that succeeded.
+ * @param displacements Displacement of each bucket.
+ * @param slots Slot of the table assigned to each key.
+ * @return -1 if the perfect hash could not be built, 0 for success.
+ */
+int build_perfect_hash(const unsigned int keys[], int num_keys, int table_bits, int bucket_bits, unsigned int *salt, unsigned short displacements[], int slots[]){
+    int table_size = 1 << table_bits;
+    int num_buckets = 1 << bucket_bits;
+
+    unsigned int *hashes = malloc(num_keys * sizeof(unsigned int));
+    int *bucket_start = malloc((num_buckets + 1) * sizeof(int));
+    int *bucket_keys = malloc(num_keys * sizeof(int));
+    int *bucket_order = malloc(num_buckets * sizeof(int));
+    unsigned char *occupied = malloc(table_size);
+    int rtn = -1;
+
+    if(hashes == NULL || bucket_start == NULL || bucket_keys == NULL || bucket_order == NULL || occupied == NULL){
+        num_keys = -1; // Skip the attempts
+    }
 
+    for(int attempt = 0; num_keys >= 0 && attempt < MAX_PERFECT_HASH_ATTEMPTS && rtn == -1; attempt++){
+        *salt = attempt * 0x9E3779B9U;
 
-/**
-        *  @brief  Makes the partition from the Quick sort algorithm
-        *  Extracted from https://www.javatpoint.com/quick-sort-in-c
-        * 
-        * @param  arr array in which the partition is made
-        * @param  low low boundary from the partition
-        * @param  high high boundary from the partition
-*/
-int partition(int arr[], int low, int high) {  
-    int pivot = arr[high];  
-    int i = (low - 1);  
-  
-    for (int j = low; j <= high - 1; j++) {  
-        if (arr[j] < pivot) {  
-            i++;  
-            swap(&arr[i], &arr[j]);  
-        }  
-    }  
-    swap(&arr[i + 1], &arr[high]);  
-    return (i + 1);  
-}
-
-/**
-        *  @brief  Quick sort algorithm (recursive implementation). Sorts an array of ints.
-        *  Extracted from https://www.javatpoint.com/quick-sort-in-c
-        * 
-        * @param  arr array to sort
-        * @param  low low boundary to sort the array
-        * @param  high high boundary to sort the array.
-*/
-void quickSort(int arr[], int low, int high) {  
-    if (low < high) {  
-        int pi = partition(arr, low, high);  
-        quickSort(arr, low, pi - 1);  
-        quickSort(arr, pi + 1, high);  
-    }  
-}  
+        /* Grouping of the keys by bucket (counting sort) */
+
+        int max_bucket_size = 0;
+        memset(bucket_start, 0, (num_buckets + 1) * sizeof(int));
+        for(int i = 0; i < num_keys; i++){
+            hashes[i] = mix_key(keys[i], *salt);
+            bucket_start[(hashes[i] & (num_buckets - 1)) + 1]++;
+        }
+        for(int b = 0; b < num_buckets; b++){
+            if(bucket_start[b + 1] > max_bucket_size) max_bucket_size = bucket_start[b + 1];
+            bucket_start[b + 1] += bucket_start[b];
+        }
+
+        // bucket_order is used as the insertion cursor of each bucket until the buckets are sorted
+        memcpy(bucket_order, bucket_start, num_buckets * sizeof(int));
+        for(int i = 0; i < num_keys; i++){
+            bucket_keys[bucket_order[hashes[i] & (num_buckets - 1)]++] = i;
+        }
+
+        /* Buckets are placed from the largest to the smallest */
+
+        int num_ordered = 0;
+        for(int size = max_bucket_size; size > 0; size--){
+            for(int b = 0; b < num_buckets; b++){
+                if(bucket_start[b + 1] - bucket_start[b] == size) bucket_order[num_ordered++] = b;
+            }
+        }
+
+        memset(occupied, 0, table_size);
+        memset(displacements, 0, num_buckets * sizeof(unsigned short));
+
+        int placed_all = 1;
+        for(int o = 0; o < num_ordered && placed_all; o++){
+            int b = bucket_order[o];
+            int placed = 0;
+
+            for(int d = 0; d < table_size && !placed; d++){
+                int k = bucket_start[b];
+                for(; k < bucket_start[b + 1]; k++){
+                    int slot = ((hashes[bucket_keys[k]] >> (32 - table_bits)) ^ d) & (table_size - 1);
+                    if(occupied[slot]) break;
+                    occupied[slot] = 1;
+                    slots[bucket_keys[k]] = slot;
+                }
+                if(k == bucket_start[b + 1]){
+                    displacements[b] = d;
+                    placed = 1;
+                } else {
+                    // Undo the slots taken by this bucket with the current displacement
+                    for(int u = bucket_start[b]; u < k; u++) occupied[slots[bucket_keys[u]]] = 0;
+                }
+            }
+            placed_all = placed;
+        }
+
+        if(placed_all) rtn = 0;
+    }
+
+    free(hashes);
+    free(bucket_start);
+    free(bucket_keys);
+    free(bucket_order);
+    free(occupied);
+    return rtn;
+}
@@ -7,17 +7,61 @@
  ****************************************************************************/
 
 #pragma once
+#include <stddef.h>
 
 #define NUM_OF_EQUIVALENCES 7462
 #define NUM_RANKS 13
 #define TOTAL_CARDS 52
+#define OMAHA_HOLE_CARDS 4
+#define OMAHA_BOARD_TRIPLES 10  // Ways of choosing the 3 community cards of an Omaha hand
 
 
 /* These functions and structures are meant to be called from outside the current module. */ 
 
+/* Instruction set of the batch evaluators, see get_scores_batch_kind() */
+
+typedef enum {
+    EVAL_BATCH_SCALAR,      // One hand at a time: callers do better with eval_prepare() and eval_with_hole()
+    EVAL_BATCH_AVX2,        // 8 hands per instruction
+    EVAL_BATCH_AVX512       // 16 hands per instruction
+} eval_batch_kind_t;
+
+/* Work of the 7-card evaluator that only depends on the board, see eval_prepare() */
+
+typedef struct {
+    unsigned int rank_key;  // Sum of the base 5 weights of the ranks of the board
+    int flush_suit;         // Suit bits (cdhs) of the suit with 3 or more cards on the board, 0 if there is none
+    int flush_count;        // Cards of that suit on the board
+    int flush_ranks;        // Rank bits of the cards of that suit on the board
+} eval_board_t;
+
+/* Work of the Omaha evaluator that only depends on the board, see omaha_prepare(). Board triples with the same ranks
+   make the same hands without flush, so they are kept once. */
+
+typedef struct {
+    int num_triples;                            // Triples of the board with different ranks
+    int triple_offsets[OMAHA_BOARD_TRIPLES];    // Row of every triple in the Omaha table, see omaha_eval_with_hole()
+    int paired;                 // 1 if the board has repeated ranks, otherwise there are no full houses or quads
+    int flush_suit;             // Suit bits (cdhs) of the suit with 3 or more cards on the board, 0 if there is none
+    int num_flush_triples;      // Triples of that suit
+    int flush_triple_ranks[OMAHA_BOARD_TRIPLES];    // Rank bits of every triple of that suit
+} omaha_board_t;
+
 
 int create_lookup_tables(const char *csv_file);
 unsigned short get_score(int cards[]);
+unsigned short get_score6(const int cards[6]);
+unsigned short get_score7(const int cards[7]);
+eval_board_t eval_prepare(const int board[5]);
+unsigned short eval_with_hole(const eval_board_t *board, int c1, int c2);
+omaha_board_t omaha_prepare(const int board[5]);
+unsigned short omaha_eval_with_hole(const omaha_board_t *board, const int hole[OMAHA_HOLE_CARDS]);
+unsigned short get_score_omaha(const int hole[OMAHA_HOLE_CARDS], const int board[5]);
+unsigned short get_score_binary_search(int cards[]);
+void get_scores_batch(const int *cards, unsigned short *out, size_t n);
+void get_scores7_batch(const int *cards, unsigned short *out, size_t n);
+const char *get_scores_batch_isa();
+eval_batch_kind_t get_scores_batch_kind();
 void get_full_hand_name_by_score(int score,char name[],int name_size);
 
 extern char* card_names[TOTAL_CARDS];
@@ -0,0 +1,323 @@
+/******************************************************************************
+ * File: hand_ranges.c
+ * Description: Weighted ranges of hole cards. parse_range() turns strings such
+ * as "TT+,AKs,KQo:0.5" into weighted lists of combos, and
+ * build_range_sampler() removes the combos that use known cards and builds an
+ * alias table, so that simulate_player_ranges() deals every opponent a combo
+ * of their range in constant time, whatever the shape of the range.
+ *
+ * Range syntax, a comma-separated list of entries with an optional weight
+ * (":w", 1 by default, a later entry overrides the weight of an earlier one):
+ *  - "AA", "AKs", "AKo", "AK" (suited and offsuit).
+ *  - "TT+" (TT to AA), "A2s+" (A2s to AKs), "KTo+" (KTo to KQo).
+ *  - "22-55", "A2s-A5s", with the same high card and suitedness.
+ *  - "AhKh", a single combo (suits c, d, h, s).
+ *  - "random", all the combos.
+ ****************************************************************************/
+
+#include "hand_ranges.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+
+#define NUM_SUITS 4
+#define MAX_ENTRY_LENGTH 32
+#define ANY_SUITS 0
+#define SUITED 1
+#define OFFSUIT 2
+
+int parse_rank(char c);
+int parse_suit(char c);
+int parse_hand_class(const char *text, int *high, int *low, int *suitedness);
+int parse_range_entry(const char *entry, double weights[TOTAL_CARDS][TOTAL_CARDS], char in_range[TOTAL_CARDS][TOTAL_CARDS]);
+void add_hand_class(int high, int low, int suitedness, double weight, double weights[TOTAL_CARDS][TOTAL_CARDS], char in_range[TOTAL_CARDS][TOTAL_CARDS]);
+void add_combo(int card1, int card2, double weight, double weights[TOTAL_CARDS][TOTAL_CARDS], char in_range[TOTAL_CARDS][TOTAL_CARDS]);
+
+
+/**
+ * @brief Parsing of a range of hole cards, see the syntax at the beginning of this file. Spaces are ignored.
+ *
+ * @param text Range to parse, e.g. "TT+,AKs,KQo:0.5".
+ * @param range Where the combos of the range and their weights are stored. Combos with weight 0 are left out.
+ * @return -1 if the range is not valid or has no combo with a positive weight, 0 for success.
+ */
+int parse_range(const char *text, hand_range_t *range){
+    double weights[TOTAL_CARDS][TOTAL_CARDS];     // Weight of the combo [highest card][lowest card]
+    char in_range[TOTAL_CARDS][TOTAL_CARDS];
+    memset(in_range, 0, sizeof(in_range));
+
+    char entry[MAX_ENTRY_LENGTH + 1];
+    int length = 0;
+
+    for(const char *c = text; ; c++){
+        if(*c == ',' || *c == '\0'){
+            entry[length] = '\0';
+            if(parse_range_entry(entry, weights, in_range) == -1) return -1;
+            length = 0;
+            if(*c == '\0') break;
+        } else if(!isspace((unsigned char) *c)){
+            if(length == MAX_ENTRY_LENGTH) return -1;
+            entry[length++] = *c;
+        }
+    }
+
+    range->num_combos = 0;
+    for(int high = 0; high < TOTAL_CARDS; high++){
+        for(int low = 0; low < high; low++){
+            if(in_range[high][low] && weights[high][low] > 0.0){
+                range->cards[range->num_combos][0] = high;
+                range->cards[range->num_combos][1] = low;
+                range->weights[range->num_combos] = weights[high][low];
+                range->num_combos++;
+            }
+        }
+    }
+
+    return (range->num_combos > 0) ? 0 : -1;
+}
+
+
+/**
+ * @brief Building of the sampler of a range: the combos that do not use any dead card and an alias table over
+ * their weights (Vose's method).
+ *
+ * @param sampler Sampler to build.
+ * @param range Range of the sampler.
+ * @param dead_cards Bit i set if card i can not be dealt (cards of the known players, board and discarded cards).
+ * @return -1 if no combo of the range with a positive weight is left, 0 for success.
+ */
+int build_range_sampler(range_sampler_t *sampler, const hand_range_t *range, uint64_t dead_cards){
+    int n = 0;
+    sampler->total_weight = 0.0;
+
+    for(int i = 0; i < range->num_combos; i++){
+        uint64_t mask = (1ULL << range->cards[i][0]) | (1ULL << range->cards[i][1]);
+        if((mask & dead_cards) || range->weights[i] <= 0.0) continue;
+        sampler->cards[n][0] = range->cards[i][0];
+        sampler->cards[n][1] = range->cards[i][1];
+        sampler->masks[n] = mask;
+        sampler->weights[n] = range->weights[i];
+        sampler->total_weight += range->weights[i];
+        n++;
+    }
+    sampler->num_combos = n;
+    if(n == 0) return -1;
+
+    /* Vose's alias method: every column keeps a share of its combo and gives the rest to a heavier one */
+
+    double scaled[MAX_RANGE_COMBOS];
+    int small[MAX_RANGE_COMBOS], large[MAX_RANGE_COMBOS];
+    int num_small = 0, num_large = 0;
+
+    for(int i = 0; i < n; i++){
+        scaled[i] = sampler->weights[i] * n / sampler->total_weight;
+        if(scaled[i] < 1.0) small[num_small++] = i;
+        else large[num_large++] = i;
+    }
+
+    while(num_small > 0 && num_large > 0){
+        int s = small[--num_small], l = large[--num_large];
+        sampler->thresholds[s] = (uint64_t) (scaled[s] * 4294967296.0);
+        sampler->aliases[s] = (uint16_t) l;
+        scaled[l] -= 1.0 - scaled[s];
+        if(scaled[l] < 1.0) small[num_small++] = l;
+        else large[num_large++] = l;
+    }
+
+    // The columns left are full, up to rounding errors
+    while(num_large > 0){
+        int l = large[--num_large];
+        sampler->thresholds[l] = 1ULL << 32;
+        sampler->aliases[l] = (uint16_t) l;
+    }
+    while(num_small > 0){
+        int s = small[--num_small];
+        sampler->thresholds[s] = 1ULL << 32;
+        sampler->aliases[s] = (uint16_t) s;
+    }
+
+    return 0;
+}
+
+
+/**
+ * @brief Rank of a character of a range.
+ *
+ * @param c Character, '2'..'9', 'T', 'J', 'Q', 'K' or 'A' (case insensitive).
+ * @return Rank in [0,12], -1 if c is not a rank.
+ */
+int parse_rank(char c){
+    const char *ranks = "23456789TJQKA";
+    const char *found = (c != '\0') ? strchr(ranks, toupper((unsigned char) c)) : NULL;
+    return (found != NULL) ? (int) (found - ranks) : -1;
+}
+
+
+/**
+ * @brief Suit of a character of a range, in the order of cardtype_to_num().
+ *
+ * @param c Character, 'c', 'd', 'h' or 's' (case insensitive).
+ * @return Suit in [0,3], -1 if c is not a suit.
+ */
+int parse_suit(char c){
+    const char *suits = "CDHS";
+    const char *found = (c != '\0') ? strchr(suits, toupper((unsigned char) c)) : NULL;
+    return (found != NULL) ? (int) (found - suits) : -1;
+}
+
+
+/**
+ * @brief Parsing of a hand class at the beginning of a text: two ranks and, if they are different, an optional
+ * 's' or 'o'.
+ *
+ * @param text Text that begins with the class.
+ * @param high Where the highest rank is stored.
+ * @param low Where the lowest rank is stored.
+ * @param suitedness Where SUITED, OFFSUIT or ANY_SUITS is stored.
+ * @return Number of characters of the class, -1 if the text does not begin with a class.
+ */
+int parse_hand_class(const char *text, int *high, int *low, int *suitedness){
+    int r1 = parse_rank(text[0]);
+    int r2 = (r1 != -1) ? parse_rank(text[1]) : -1;
+    if(r2 == -1) return -1;
+
+    *high = (r1 > r2) ? r1 : r2;
+    *low = (r1 > r2) ? r2 : r1;
+    *suitedness = ANY_SUITS;
+
+    if(r1 != r2 && (text[2] == 's' || text[2] == 'S')){
+        *suitedness = SUITED;
+        return 3;
+    }
+    if(r1 != r2 && (text[2] == 'o' || text[2] == 'O')){
+        *suitedness = OFFSUIT;
+        return 3;
+    }
+    return 2;
+}
+
+
+/**
+ * @brief Parsing of an entry of a range, see the syntax at the beginning of this file, and addition of its combos.
+ *
+ * @param entry Entry without spaces.
+ * @param weights Weights of the combos, [highest card][lowest card].
+ * @param in_range Whether every combo has been given a weight.
+ * @return -1 if the entry is not valid, 0 for success.
+ */
+int parse_range_entry(const char *entry, double weights[TOTAL_CARDS][TOTAL_CARDS], char in_range[TOTAL_CARDS][TOTAL_CARDS]){
+    char body[MAX_ENTRY_LENGTH + 1];
+    double weight = 1.0;
+
+    const char *colon = strchr(entry, ':');
+    size_t body_length = (colon != NULL) ? (size_t) (colon - entry) : strlen(entry);
+    memcpy(body, entry, body_length);
+    body[body_length] = '\0';
+
+    if(colon != NULL){
+        char *end;
+        weight = strtod(colon + 1, &end);
+        if(end == colon + 1 || *end != '\0' || !isfinite(weight) || weight < 0.0) return -1;
+    }
+
+    if(body_length == 0) return -1;
+
+    // All the combos
+    if(strcmp(body, "random") == 0){
+        for(int high = 0; high < TOTAL_CARDS; high++){
+            for(int low = 0; low < high; low++) add_combo(high, low, weight, weights, in_range);
+        }
+        return 0;
+    }
+
+    // A single combo, e.g. AhKh
+    if(body_length == 4 && parse_rank(body[0]) != -1 && parse_suit(body[1]) != -1 &&
+       parse_rank(body[2]) != -1 && parse_suit(body[3]) != -1){
+        int card1 = parse_suit(body[1]) * NUM_RANKS + parse_rank(body[0]);
+        int card2 = parse_suit(body[3]) * NUM_RANKS + parse_rank(body[2]);
+        if(card1 == card2) return -1;
+        add_combo(card1, card2, weight, weights, in_range);
+        return 0;
+    }
+
+    int high, low, suitedness;
+    int length = parse_hand_class(body, &high, &low, &suitedness);
+    if(length == -1) return -1;
+
+    // A single class, e.g. AKs
+    if(body[length] == '\0'){
+        add_hand_class(high, low, suitedness, weight, weights, in_range);
+        return 0;
+    }
+
+    // The class and the better ones with the same high card, e.g. TT+ or A2s+
+    if(body[length] == '+' && body[length + 1] == '\0'){
+        if(high == low){
+            for(int r = high; r < NUM_RANKS; r++) add_hand_class(r, r, ANY_SUITS, weight, weights, in_range);
+        } else {
+            for(int r = low; r < high; r++) add_hand_class(high, r, suitedness, weight, weights, in_range);
+        }
+        return 0;
+    }
+
+    // The classes between two of them, e.g. 22-55 or A2s-A5s
+    if(body[length] == '-'){
+        int high2, low2, suitedness2;
+        int length2 = parse_hand_class(body + length + 1, &high2, &low2, &suitedness2);
+        if(length2 == -1 || body[length + 1 + length2] != '\0' || suitedness != suitedness2) return -1;
+
+        if(high == low && high2 == low2){
+            int first = (high < high2) ? high : high2, last = (high < high2) ? high2 : high;
+            for(int r = first; r <= last; r++) add_hand_class(r, r, ANY_SUITS, weight, weights, in_range);
+            return 0;
+        }
+        if(high == high2 && high != low && high2 != low2){
+            int first = (low < low2) ? low : low2, last = (low < low2) ? low2 : low;
+            for(int r = first; r <= last; r++) add_hand_class(high, r, suitedness, weight, weights, in_range);
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+
+/**
+ * @brief Addition of the combos of a hand class to a range.
+ *
+ * @param high Highest rank.
+ * @param low Lowest rank, equal to high for pairs.
+ * @param suitedness SUITED, OFFSUIT or ANY_SUITS.
+ * @param weight Weight of the combos.
+ * @param weights Weights of the combos, [highest card][lowest card].
+ * @param in_range Whether every combo has been given a weight.
+ */
+void add_hand_class(int high, int low, int suitedness, double weight, double weights[TOTAL_CARDS][TOTAL_CARDS], char in_range[TOTAL_CARDS][TOTAL_CARDS]){
+    for(int s1 = 0; s1 < NUM_SUITS; s1++){
+        for(int s2 = 0; s2 < NUM_SUITS; s2++){
+            if(high == low && s1 >= s2) continue;
+            if(suitedness == SUITED && s1 != s2) continue;
+            if(suitedness == OFFSUIT && s1 == s2) continue;
+            add_combo(s1 * NUM_RANKS + high, s2 * NUM_RANKS + low, weight, weights, in_range);
+        }
+    }
+}
+
+
+/**
+ * @brief Addition of a combo to a range, replacing its weight if it was already in it.
+ *
+ * @param card1 First card, in [0,51].
+ * @param card2 Second card, in [0,51].
+ * @param weight Weight of the combo.
+ * @param weights Weights of the combos, [highest card][lowest card].
+ * @param in_range Whether every combo has been given a weight.
+ */
+void add_combo(int card1, int card2, double weight, double weights[TOTAL_CARDS][TOTAL_CARDS], char in_range[TOTAL_CARDS][TOTAL_CARDS]){
+    int high = (card1 > card2) ? card1 : card2, low = (card1 > card2) ? card2 : card1;
+    weights[high][low] = weight;
+    in_range[high][low] = 1;
+}
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * File: hand_ranges.h
+ * Description: Header file for hand_ranges.c, which parses weighted ranges of
+ * hole cards and builds the samplers that deal them to the opponents.
+ ****************************************************************************/
+
+#pragma once
+#include "simulation.h"
+#include <stdint.h>
+
+#define MAX_RANGE_COMBOS 1326   // Combinations of two cards of the deck
+
+/* Weighted range of hole cards, e.g. "TT+,AKs,KQo:0.5". Cards are integers in [0,51], see cardtype_to_num(). */
+
+typedef struct {
+    int num_combos;
+    int cards[MAX_RANGE_COMBOS][2];
+    double weights[MAX_RANGE_COMBOS];
+} hand_range_t;
+
+/* Sampler of the combos of a range that do not use any known card, with an alias table (Walker/Vose) that draws
+   a combo with probability proportional to its weight in constant time */
+
+typedef struct {
+    int num_combos;
+    int cards[MAX_RANGE_COMBOS][2];
+    uint64_t masks[MAX_RANGE_COMBOS];       // Bits of the two cards of every combo
+    double weights[MAX_RANGE_COMBOS];
+    double total_weight;
+    uint64_t thresholds[MAX_RANGE_COMBOS];  // Combo i is kept if a 32-bit random number is below thresholds[i]
+    uint16_t aliases[MAX_RANGE_COMBOS];     // Otherwise aliases[i] is drawn
+} range_sampler_t;
+
+/* These functions are meant to be called from outside the current module. */
+
+int parse_range(const char *text, hand_range_t *range);
+int build_range_sampler(range_sampler_t *sampler, const hand_range_t *range, uint64_t dead_cards);
+
+/* Implemented in simulation.c */
+
+double** simulate_player_ranges(char* known_cards[], int num_known_cards, int num_players, int num_games, const hand_range_t *ranges[],
+                                const sim_options_t *options, sim_info_t *info);
+int simulate_player_ranges_into(char* known_cards[], int num_known_cards, int num_players, int num_games, const hand_range_t *ranges[],
+                                const sim_options_t *options, sim_arena_t *arena, sim_result_t *result);
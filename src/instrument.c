@@ -0,0 +1,194 @@
+/******************************************************************************
+ * File: instrument.c
+ * Description: Statistics of the opt-in instrumentation of the hot paths.
+ * Every thread counts in its own sim_stats_t, without atomics or locks, and
+ * adds it to the global statistics when it finishes its simulation. The
+ * hardware counters (cycles, instructions, cache and branch misses) are read
+ * with perf_event_open(), so they need Linux and a kernel that allows it
+ * (see /proc/sys/kernel/perf_event_paranoid); if they can not be opened the
+ * statistics simply report hw_counters = 0.
+ *
+ * Compile the whole simulator with -DSIM_INSTRUMENT to enable it:
+ *      gcc -O2 -DSIM_INSTRUMENT -DSIM_INSTRUMENT_PERF -o main main.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ ****************************************************************************/
+
+#include "instrument.h"
+
+#include <string.h>
+#include <pthread.h>
+
+#ifdef SIM_INSTRUMENT
+
+#include <time.h>
+
+#if defined(SIM_INSTRUMENT_PERF) && defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+void add_stats(sim_stats_t *to, const sim_stats_t *from);
+
+pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+sim_stats_t global_stats;
+_Thread_local sim_stats_t sim_thread_stats;
+
+#endif
+
+
+/**
+ * @brief Statistics of the simulations since the last sim_reset_stats(): those of the finished threads and the
+ * ones not yet added of the calling thread.
+ *
+ * @param stats Where the statistics are stored, all zeros if the simulator was compiled without SIM_INSTRUMENT.
+ */
+void sim_get_stats(sim_stats_t *stats){
+    memset(stats, 0, sizeof(sim_stats_t));
+#ifdef SIM_INSTRUMENT
+    pthread_mutex_lock(&stats_lock);
+    *stats = global_stats;
+    pthread_mutex_unlock(&stats_lock);
+    add_stats(stats, &sim_thread_stats);
+#endif
+}
+
+
+/**
+ * @brief Reset of the statistics, global and of the calling thread.
+ */
+void sim_reset_stats(){
+#ifdef SIM_INSTRUMENT
+    pthread_mutex_lock(&stats_lock);
+    memset(&global_stats, 0, sizeof(sim_stats_t));
+    pthread_mutex_unlock(&stats_lock);
+    memset(&sim_thread_stats, 0, sizeof(sim_stats_t));
+#endif
+}
+
+
+#ifdef SIM_INSTRUMENT
+
+/**
+ * @brief Adding of the statistics of the calling thread to the global ones. The statistics of the thread are reset.
+ */
+void sim_flush_thread_stats(){
+    pthread_mutex_lock(&stats_lock);
+    add_stats(&global_stats, &sim_thread_stats);
+    pthread_mutex_unlock(&stats_lock);
+    memset(&sim_thread_stats, 0, sizeof(sim_stats_t));
+}
+
+
+/**
+ * @brief Addition of two sets of statistics.
+ *
+ * @param to Statistics the others are added to.
+ * @param from Statistics added.
+ */
+void add_stats(sim_stats_t *to, const sim_stats_t *from){
+    to->games += from->games;
+    to->deal_cycles += from->deal_cycles;
+    to->evaluate_cycles += from->evaluate_cycles;
+    to->tally_cycles += from->tally_cycles;
+    to->enumerate_cycles += from->enumerate_cycles;
+    to->score5_flush += from->score5_flush;
+    to->score5_unique5 += from->score5_unique5;
+    to->score5_prime_product += from->score5_prime_product;
+    to->score5_binary_search += from->score5_binary_search;
+    to->score7_flush += from->score7_flush;
+    to->score7_noflush += from->score7_noflush;
+    to->batch_hands += from->batch_hands;
+    to->hw_counters |= from->hw_counters;
+    to->hw_cycles += from->hw_cycles;
+    to->hw_instructions += from->hw_instructions;
+    to->hw_cache_misses += from->hw_cache_misses;
+    to->hw_branch_misses += from->hw_branch_misses;
+}
+
+
+/**
+ * @brief Monotonic clock in nanoseconds, used for the phase timers where there is no time stamp counter.
+ *
+ * @return Nanoseconds since an arbitrary origin.
+ */
+uint64_t sim_clock(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+
+#if defined(SIM_INSTRUMENT_PERF) && defined(__linux__)
+
+/**
+ * @brief Opening and start of the hardware counters of the calling thread: cycles, instructions, cache misses
+ * and branch misses, in user space only.
+ *
+ * @param fds Where the file descriptors of the counters are stored, -1 for those that can not be opened.
+ */
+void sim_perf_begin(int fds[SIM_NUM_PERF_COUNTERS]){
+    static const uint64_t configs[SIM_NUM_PERF_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    for(int i = 0; i < SIM_NUM_PERF_COUNTERS; i++){
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        fds[i] = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if(fds[i] != -1){
+            ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+
+/**
+ * @brief Stop of the hardware counters opened by sim_perf_begin(), whose values are added to the statistics of the
+ * calling thread. They are only reported if all of them could be opened and read.
+ *
+ * @param fds File descriptors of the counters.
+ */
+void sim_perf_end(int fds[SIM_NUM_PERF_COUNTERS]){
+    uint64_t values[SIM_NUM_PERF_COUNTERS];
+    int all_read = 1;
+
+    for(int i = 0; i < SIM_NUM_PERF_COUNTERS; i++){
+        if(fds[i] == -1){
+            all_read = 0;
+            continue;
+        }
+        ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        if(read(fds[i], &values[i], sizeof(uint64_t)) != sizeof(uint64_t)) all_read = 0;
+        close(fds[i]);
+    }
+
+    if(all_read){
+        sim_thread_stats.hw_counters = 1;
+        sim_thread_stats.hw_cycles += values[0];
+        sim_thread_stats.hw_instructions += values[1];
+        sim_thread_stats.hw_cache_misses += values[2];
+        sim_thread_stats.hw_branch_misses += values[3];
+    }
+}
+
+#else
+
+void sim_perf_begin(int fds[SIM_NUM_PERF_COUNTERS]){
+    (void) fds;
+}
+
+void sim_perf_end(int fds[SIM_NUM_PERF_COUNTERS]){
+    (void) fds;
+}
+
+#endif
+
+#endif
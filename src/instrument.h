@@ -0,0 +1,85 @@
+/******************************************************************************
+ * File: instrument.h
+ * Description: Header file for instrument.c, the opt-in instrumentation of
+ * the hot paths of the evaluator and the simulator. It is compiled in with
+ * -DSIM_INSTRUMENT (and the hardware counters with -DSIM_INSTRUMENT_PERF);
+ * otherwise every SIM_* macro expands to nothing and the hot paths are the
+ * same code as without this module.
+ ****************************************************************************/
+
+#pragma once
+#include <stdint.h>
+
+/* Statistics of the simulations since the last sim_reset_stats(). Cycles are TSC ticks on x86, nanoseconds elsewhere. */
+
+typedef struct {
+    uint64_t games;                 // Games played by Monte Carlo or enumerated
+    uint64_t deal_cycles;           // Dealing the cards of the games
+    uint64_t evaluate_cycles;       // Scoring the hands of the players
+    uint64_t tally_cycles;          // Finding the winners and counting wins, ties and hand types
+    uint64_t enumerate_cycles;      // Exact enumerations, dealing and scoring included
+    uint64_t score5_flush;          // Branches taken by get_score() and get_score_binary_search()
+    uint64_t score5_unique5;
+    uint64_t score5_prime_product;  // Lookups of hands with repeated ranks by perfect hash...
+    uint64_t score5_binary_search;  // ... or by binary search
+    uint64_t score7_flush;          // Hands of get_score7() and eval_with_hole() with and without flush
+    uint64_t score7_noflush;
+    uint64_t batch_hands;           // Hands scored by get_scores_batch() and get_scores7_batch()
+    int hw_counters;                // 1 if the hardware counters below were read, see SIM_INSTRUMENT_PERF
+    uint64_t hw_cycles;             // Hardware counters of the simulation loops
+    uint64_t hw_instructions;
+    uint64_t hw_cache_misses;
+    uint64_t hw_branch_misses;
+} sim_stats_t;
+
+/* These functions are meant to be called from outside the current module. Without SIM_INSTRUMENT they report zeros. */
+
+void sim_get_stats(sim_stats_t *stats);
+void sim_reset_stats();
+
+
+#ifdef SIM_INSTRUMENT
+
+#define SIM_NUM_PERF_COUNTERS 4
+
+extern _Thread_local sim_stats_t sim_thread_stats;
+
+void sim_flush_thread_stats();
+uint64_t sim_clock();
+void sim_perf_begin(int fds[SIM_NUM_PERF_COUNTERS]);
+void sim_perf_end(int fds[SIM_NUM_PERF_COUNTERS]);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define SIM_CYCLES() __rdtsc()
+#else
+#define SIM_CYCLES() sim_clock()
+#endif
+
+/* Counters are kept per thread and added to the global statistics by SIM_FLUSH_STATS(), at the end of every thread */
+
+#define SIM_COUNT(field) (sim_thread_stats.field++)
+#define SIM_ADD(field, n) (sim_thread_stats.field += (n))
+#define SIM_TIMER_START(timer) uint64_t timer = SIM_CYCLES()
+#define SIM_TIMER_STOP(timer, field) (sim_thread_stats.field += SIM_CYCLES() - (timer))
+#define SIM_FLUSH_STATS() sim_flush_thread_stats()
+
+#if defined(SIM_INSTRUMENT_PERF) && defined(__linux__)
+#define SIM_PERF_BEGIN(fds) int fds[SIM_NUM_PERF_COUNTERS]; sim_perf_begin(fds)
+#define SIM_PERF_END(fds) sim_perf_end(fds)
+#else
+#define SIM_PERF_BEGIN(fds)
+#define SIM_PERF_END(fds)
+#endif
+
+#else
+
+#define SIM_COUNT(field) ((void) 0)
+#define SIM_ADD(field, n) ((void) 0)
+#define SIM_TIMER_START(timer)
+#define SIM_TIMER_STOP(timer, field) ((void) 0)
+#define SIM_FLUSH_STATS() ((void) 0)
+#define SIM_PERF_BEGIN(fds)
+#define SIM_PERF_END(fds)
+
+#endif
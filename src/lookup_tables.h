@@ -0,0 +1,15381 @@
+/******************************************************************************
+ * File: lookup_tables.h
+ * Description: Lookup tables of the hand evaluator, loaded by init_simulator(NULL).
+ * GENERATED by tools/generate_tables.c from data/eq_classes.csv, do not edit.
+ ****************************************************************************/
+
+#pragma once
+
+#define BUILTIN_PRIME_PRODUCT_SALT 0U
+#define BUILTIN_NOFLUSH7_SALT 3668340011U
+
+static const unsigned short builtin_flushes_table[HIGHEST_5CARD_BIT_RANK] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1599,
+    0,0,0,0,0,0,0,1598,0,0,0,1597,0,1596,8,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1595,
+    0,0,0,0,0,0,0,1594,0,0,0,1593,0,1592,1591,0,
+    0,0,0,0,0,0,0,1590,0,0,0,1589,0,1588,1587,0,
+    0,0,0,1586,0,1585,1584,0,0,1583,1582,0,7,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1581,
+    0,0,0,0,0,0,0,1580,0,0,0,1579,0,1578,1577,0,
+    0,0,0,0,0,0,0,1576,0,0,0,1575,0,1574,1573,0,
+    0,0,0,1572,0,1571,1570,0,0,1569,1568,0,1567,0,0,0,
+    0,0,0,0,0,0,0,1566,0,0,0,1565,0,1564,1563,0,
+    0,0,0,1562,0,1561,1560,0,0,1559,1558,0,1557,0,0,0,
+    0,0,0,1556,0,1555,1554,0,0,1553,1552,0,1551,0,0,0,
+    0,1550,1549,0,1548,0,0,0,6,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1547,
+    0,0,0,0,0,0,0,1546,0,0,0,1545,0,1544,1543,0,
+    0,0,0,0,0,0,0,1542,0,0,0,1541,0,1540,1539,0,
+    0,0,0,1538,0,1537,1536,0,0,1535,1534,0,1533,0,0,0,
+    0,0,0,0,0,0,0,1532,0,0,0,1531,0,1530,1529,0,
+    0,0,0,1528,0,1527,1526,0,0,1525,1524,0,1523,0,0,0,
+    0,0,0,1522,0,1521,1520,0,0,1519,1518,0,1517,0,0,0,
+    0,1516,1515,0,1514,0,0,0,1513,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1512,0,0,0,1511,0,1510,1509,0,
+    0,0,0,1508,0,1507,1506,0,0,1505,1504,0,1503,0,0,0,
+    0,0,0,1502,0,1501,1500,0,0,1499,1498,0,1497,0,0,0,
+    0,1496,1495,0,1494,0,0,0,1493,0,0,0,0,0,0,0,
+    0,0,0,1492,0,1491,1490,0,0,1489,1488,0,1487,0,0,0,
+    0,1486,1485,0,1484,0,0,0,1483,0,0,0,0,0,0,0,
+    0,1482,1481,0,1480,0,0,0,1479,0,0,0,0,0,0,0,
+    5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1478,
+    0,0,0,0,0,0,0,1477,0,0,0,1476,0,1475,1474,0,
+    0,0,0,0,0,0,0,1473,0,0,0,1472,0,1471,1470,0,
+    0,0,0,1469,0,1468,1467,0,0,1466,1465,0,1464,0,0,0,
+    0,0,0,0,0,0,0,1463,0,0,0,1462,0,1461,1460,0,
+    0,0,0,1459,0,1458,1457,0,0,1456,1455,0,1454,0,0,0,
+    0,0,0,1453,0,1452,1451,0,0,1450,1449,0,1448,0,0,0,
+    0,1447,1446,0,1445,0,0,0,1444,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1443,0,0,0,1442,0,1441,1440,0,
+    0,0,0,1439,0,1438,1437,0,0,1436,1435,0,1434,0,0,0,
+    0,0,0,1433,0,1432,1431,0,0,1430,1429,0,1428,0,0,0,
+    0,1427,1426,0,1425,0,0,0,1424,0,0,0,0,0,0,0,
+    0,0,0,1423,0,1422,1421,0,0,1420,1419,0,1418,0,0,0,
+    0,1417,1416,0,1415,0,0,0,1414,0,0,0,0,0,0,0,
+    0,1413,1412,0,1411,0,0,0,1410,0,0,0,0,0,0,0,
+    1409,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1408,0,0,0,1407,0,1406,1405,0,
+    0,0,0,1404,0,1403,1402,0,0,1401,1400,0,1399,0,0,0,
+    0,0,0,1398,0,1397,1396,0,0,1395,1394,0,1393,0,0,0,
+    0,1392,1391,0,1390,0,0,0,1389,0,0,0,0,0,0,0,
+    0,0,0,1388,0,1387,1386,0,0,1385,1384,0,1383,0,0,0,
+    0,1382,1381,0,1380,0,0,0,1379,0,0,0,0,0,0,0,
+    0,1378,1377,0,1376,0,0,0,1375,0,0,0,0,0,0,0,
+    1374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1373,0,1372,1371,0,0,1370,1369,0,1368,0,0,0,
+    0,1367,1366,0,1365,0,0,0,1364,0,0,0,0,0,0,0,
+    0,1363,1362,0,1361,0,0,0,1360,0,0,0,0,0,0,0,
+    1359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1358,1357,0,1356,0,0,0,1355,0,0,0,0,0,0,0,
+    1354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1353,
+    0,0,0,0,0,0,0,1352,0,0,0,1351,0,1350,1349,0,
+    0,0,0,0,0,0,0,1348,0,0,0,1347,0,1346,1345,0,
+    0,0,0,1344,0,1343,1342,0,0,1341,1340,0,1339,0,0,0,
+    0,0,0,0,0,0,0,1338,0,0,0,1337,0,1336,1335,0,
+    0,0,0,1334,0,1333,1332,0,0,1331,1330,0,1329,0,0,0,
+    0,0,0,1328,0,1327,1326,0,0,1325,1324,0,1323,0,0,0,
+    0,1322,1321,0,1320,0,0,0,1319,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1318,0,0,0,1317,0,1316,1315,0,
+    0,0,0,1314,0,1313,1312,0,0,1311,1310,0,1309,0,0,0,
+    0,0,0,1308,0,1307,1306,0,0,1305,1304,0,1303,0,0,0,
+    0,1302,1301,0,1300,0,0,0,1299,0,0,0,0,0,0,0,
+    0,0,0,1298,0,1297,1296,0,0,1295,1294,0,1293,0,0,0,
+    0,1292,1291,0,1290,0,0,0,1289,0,0,0,0,0,0,0,
+    0,1288,1287,0,1286,0,0,0,1285,0,0,0,0,0,0,0,
+    1284,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1283,0,0,0,1282,0,1281,1280,0,
+    0,0,0,1279,0,1278,1277,0,0,1276,1275,0,1274,0,0,0,
+    0,0,0,1273,0,1272,1271,0,0,1270,1269,0,1268,0,0,0,
+    0,1267,1266,0,1265,0,0,0,1264,0,0,0,0,0,0,0,
+    0,0,0,1263,0,1262,1261,0,0,1260,1259,0,1258,0,0,0,
+    0,1257,1256,0,1255,0,0,0,1254,0,0,0,0,0,0,0,
+    0,1253,1252,0,1251,0,0,0,1250,0,0,0,0,0,0,0,
+    1249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1248,0,1247,1246,0,0,1245,1244,0,1243,0,0,0,
+    0,1242,1241,0,1240,0,0,0,1239,0,0,0,0,0,0,0,
+    0,1238,1237,0,1236,0,0,0,1235,0,0,0,0,0,0,0,
+    1234,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1233,1232,0,1231,0,0,0,1230,0,0,0,0,0,0,0,
+    1229,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1227,0,0,0,1226,0,1225,1224,0,
+    0,0,0,1223,0,1222,1221,0,0,1220,1219,0,1218,0,0,0,
+    0,0,0,1217,0,1216,1215,0,0,1214,1213,0,1212,0,0,0,
+    0,1211,1210,0,1209,0,0,0,1208,0,0,0,0,0,0,0,
+    0,0,0,1207,0,1206,1205,0,0,1204,1203,0,1202,0,0,0,
+    0,1201,1200,0,1199,0,0,0,1198,0,0,0,0,0,0,0,
+    0,1197,1196,0,1195,0,0,0,1194,0,0,0,0,0,0,0,
+    1193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1192,0,1191,1190,0,0,1189,1188,0,1187,0,0,0,
+    0,1186,1185,0,1184,0,0,0,1183,0,0,0,0,0,0,0,
+    0,1182,1181,0,1180,0,0,0,1179,0,0,0,0,0,0,0,
+    1178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1177,1176,0,1175,0,0,0,1174,0,0,0,0,0,0,0,
+    1173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1171,0,1170,1169,0,0,1168,1167,0,1166,0,0,0,
+    0,1165,1164,0,1163,0,0,0,1162,0,0,0,0,0,0,0,
+    0,1161,1160,0,1159,0,0,0,1158,0,0,0,0,0,0,0,
+    1157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1156,1155,0,1154,0,0,0,1153,0,0,0,0,0,0,0,
+    1152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1150,1149,0,1148,0,0,0,1147,0,0,0,0,0,0,0,
+    1146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1144,
+    0,0,0,0,0,0,0,1143,0,0,0,1142,0,1141,1140,0,
+    0,0,0,0,0,0,0,1139,0,0,0,1138,0,1137,1136,0,
+    0,0,0,1135,0,1134,1133,0,0,1132,1131,0,1130,0,0,0,
+    0,0,0,0,0,0,0,1129,0,0,0,1128,0,1127,1126,0,
+    0,0,0,1125,0,1124,1123,0,0,1122,1121,0,1120,0,0,0,
+    0,0,0,1119,0,1118,1117,0,0,1116,1115,0,1114,0,0,0,
+    0,1113,1112,0,1111,0,0,0,1110,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1109,0,0,0,1108,0,1107,1106,0,
+    0,0,0,1105,0,1104,1103,0,0,1102,1101,0,1100,0,0,0,
+    0,0,0,1099,0,1098,1097,0,0,1096,1095,0,1094,0,0,0,
+    0,1093,1092,0,1091,0,0,0,1090,0,0,0,0,0,0,0,
+    0,0,0,1089,0,1088,1087,0,0,1086,1085,0,1084,0,0,0,
+    0,1083,1082,0,1081,0,0,0,1080,0,0,0,0,0,0,0,
+    0,1079,1078,0,1077,0,0,0,1076,0,0,0,0,0,0,0,
+    1075,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1074,0,0,0,1073,0,1072,1071,0,
+    0,0,0,1070,0,1069,1068,0,0,1067,1066,0,1065,0,0,0,
+    0,0,0,1064,0,1063,1062,0,0,1061,1060,0,1059,0,0,0,
+    0,1058,1057,0,1056,0,0,0,1055,0,0,0,0,0,0,0,
+    0,0,0,1054,0,1053,1052,0,0,1051,1050,0,1049,0,0,0,
+    0,1048,1047,0,1046,0,0,0,1045,0,0,0,0,0,0,0,
+    0,1044,1043,0,1042,0,0,0,1041,0,0,0,0,0,0,0,
+    1040,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1039,0,1038,1037,0,0,1036,1035,0,1034,0,0,0,
+    0,1033,1032,0,1031,0,0,0,1030,0,0,0,0,0,0,0,
+    0,1029,1028,0,1027,0,0,0,1026,0,0,0,0,0,0,0,
+    1025,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1024,1023,0,1022,0,0,0,1021,0,0,0,0,0,0,0,
+    1020,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1019,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1018,0,0,0,1017,0,1016,1015,0,
+    0,0,0,1014,0,1013,1012,0,0,1011,1010,0,1009,0,0,0,
+    0,0,0,1008,0,1007,1006,0,0,1005,1004,0,1003,0,0,0,
+    0,1002,1001,0,1000,0,0,0,999,0,0,0,0,0,0,0,
+    0,0,0,998,0,997,996,0,0,995,994,0,993,0,0,0,
+    0,992,991,0,990,0,0,0,989,0,0,0,0,0,0,0,
+    0,988,987,0,986,0,0,0,985,0,0,0,0,0,0,0,
+    984,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,983,0,982,981,0,0,980,979,0,978,0,0,0,
+    0,977,976,0,975,0,0,0,974,0,0,0,0,0,0,0,
+    0,973,972,0,971,0,0,0,970,0,0,0,0,0,0,0,
+    969,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,968,967,0,966,0,0,0,965,0,0,0,0,0,0,0,
+    964,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    963,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,962,0,961,960,0,0,959,958,0,957,0,0,0,
+    0,956,955,0,954,0,0,0,953,0,0,0,0,0,0,0,
+    0,952,951,0,950,0,0,0,949,0,0,0,0,0,0,0,
+    948,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,947,946,0,945,0,0,0,944,0,0,0,0,0,0,0,
+    943,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    942,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,941,940,0,939,0,0,0,938,0,0,0,0,0,0,0,
+    937,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    935,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,934,0,0,0,933,0,932,931,0,
+    0,0,0,930,0,929,928,0,0,927,926,0,925,0,0,0,
+    0,0,0,924,0,923,922,0,0,921,920,0,919,0,0,0,
+    0,918,917,0,916,0,0,0,915,0,0,0,0,0,0,0,
+    0,0,0,914,0,913,912,0,0,911,910,0,909,0,0,0,
+    0,908,907,0,906,0,0,0,905,0,0,0,0,0,0,0,
+    0,904,903,0,902,0,0,0,901,0,0,0,0,0,0,0,
+    900,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,899,0,898,897,0,0,896,895,0,894,0,0,0,
+    0,893,892,0,891,0,0,0,890,0,0,0,0,0,0,0,
+    0,889,888,0,887,0,0,0,886,0,0,0,0,0,0,0,
+    885,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,884,883,0,882,0,0,0,881,0,0,0,0,0,0,0,
+    880,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    879,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,878,0,877,876,0,0,875,874,0,873,0,0,0,
+    0,872,871,0,870,0,0,0,869,0,0,0,0,0,0,0,
+    0,868,867,0,866,0,0,0,865,0,0,0,0,0,0,0,
+    864,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,863,862,0,861,0,0,0,860,0,0,0,0,0,0,0,
+    859,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    858,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,857,856,0,855,0,0,0,854,0,0,0,0,0,0,0,
+    853,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    852,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    851,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,850,0,849,848,0,0,847,846,0,845,0,0,0,
+    0,844,843,0,842,0,0,0,841,0,0,0,0,0,0,0,
+    0,840,839,0,838,0,0,0,837,0,0,0,0,0,0,0,
+    836,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,835,834,0,833,0,0,0,832,0,0,0,0,0,0,0,
+    831,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    830,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,829,828,0,827,0,0,0,826,0,0,0,0,0,0,0,
+    825,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    824,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    823,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,822,821,0,820,0,0,0,819,0,0,0,0,0,0,0,
+    818,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    817,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    816,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,
+    0,0,0,0,0,0,0,815,0,0,0,814,0,813,812,0,
+    0,0,0,0,0,0,0,811,0,0,0,810,0,809,808,0,
+    0,0,0,807,0,806,805,0,0,804,803,0,802,0,0,0,
+    0,0,0,0,0,0,0,801,0,0,0,800,0,799,798,0,
+    0,0,0,797,0,796,795,0,0,794,793,0,792,0,0,0,
+    0,0,0,791,0,790,789,0,0,788,787,0,786,0,0,0,
+    0,785,784,0,783,0,0,0,782,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,781,0,0,0,780,0,779,778,0,
+    0,0,0,777,0,776,775,0,0,774,773,0,772,0,0,0,
+    0,0,0,771,0,770,769,0,0,768,767,0,766,0,0,0,
+    0,765,764,0,763,0,0,0,762,0,0,0,0,0,0,0,
+    0,0,0,761,0,760,759,0,0,758,757,0,756,0,0,0,
+    0,755,754,0,753,0,0,0,752,0,0,0,0,0,0,0,
+    0,751,750,0,749,0,0,0,748,0,0,0,0,0,0,0,
+    747,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,746,0,0,0,745,0,744,743,0,
+    0,0,0,742,0,741,740,0,0,739,738,0,737,0,0,0,
+    0,0,0,736,0,735,734,0,0,733,732,0,731,0,0,0,
+    0,730,729,0,728,0,0,0,727,0,0,0,0,0,0,0,
+    0,0,0,726,0,725,724,0,0,723,722,0,721,0,0,0,
+    0,720,719,0,718,0,0,0,717,0,0,0,0,0,0,0,
+    0,716,715,0,714,0,0,0,713,0,0,0,0,0,0,0,
+    712,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,711,0,710,709,0,0,708,707,0,706,0,0,0,
+    0,705,704,0,703,0,0,0,702,0,0,0,0,0,0,0,
+    0,701,700,0,699,0,0,0,698,0,0,0,0,0,0,0,
+    697,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,696,695,0,694,0,0,0,693,0,0,0,0,0,0,0,
+    692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    691,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,690,0,0,0,689,0,688,687,0,
+    0,0,0,686,0,685,684,0,0,683,682,0,681,0,0,0,
+    0,0,0,680,0,679,678,0,0,677,676,0,675,0,0,0,
+    0,674,673,0,672,0,0,0,671,0,0,0,0,0,0,0,
+    0,0,0,670,0,669,668,0,0,667,666,0,665,0,0,0,
+    0,664,663,0,662,0,0,0,661,0,0,0,0,0,0,0,
+    0,660,659,0,658,0,0,0,657,0,0,0,0,0,0,0,
+    656,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,655,0,654,653,0,0,652,651,0,650,0,0,0,
+    0,649,648,0,647,0,0,0,646,0,0,0,0,0,0,0,
+    0,645,644,0,643,0,0,0,642,0,0,0,0,0,0,0,
+    641,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,640,639,0,638,0,0,0,637,0,0,0,0,0,0,0,
+    636,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    635,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,634,0,633,632,0,0,631,630,0,629,0,0,0,
+    0,628,627,0,626,0,0,0,625,0,0,0,0,0,0,0,
+    0,624,623,0,622,0,0,0,621,0,0,0,0,0,0,0,
+    620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,619,618,0,617,0,0,0,616,0,0,0,0,0,0,0,
+    615,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,613,612,0,611,0,0,0,610,0,0,0,0,0,0,0,
+    609,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    607,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,606,0,0,0,605,0,604,603,0,
+    0,0,0,602,0,601,600,0,0,599,598,0,597,0,0,0,
+    0,0,0,596,0,595,594,0,0,593,592,0,591,0,0,0,
+    0,590,589,0,588,0,0,0,587,0,0,0,0,0,0,0,
+    0,0,0,586,0,585,584,0,0,583,582,0,581,0,0,0,
+    0,580,579,0,578,0,0,0,577,0,0,0,0,0,0,0,
+    0,576,575,0,574,0,0,0,573,0,0,0,0,0,0,0,
+    572,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,571,0,570,569,0,0,568,567,0,566,0,0,0,
+    0,565,564,0,563,0,0,0,562,0,0,0,0,0,0,0,
+    0,561,560,0,559,0,0,0,558,0,0,0,0,0,0,0,
+    557,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,556,555,0,554,0,0,0,553,0,0,0,0,0,0,0,
+    552,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    551,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,550,0,549,548,0,0,547,546,0,545,0,0,0,
+    0,544,543,0,542,0,0,0,541,0,0,0,0,0,0,0,
+    0,540,539,0,538,0,0,0,537,0,0,0,0,0,0,0,
+    536,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,535,534,0,533,0,0,0,532,0,0,0,0,0,0,0,
+    531,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    530,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,529,528,0,527,0,0,0,526,0,0,0,0,0,0,0,
+    525,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    524,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    523,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,522,0,521,520,0,0,519,518,0,517,0,0,0,
+    0,516,515,0,514,0,0,0,513,0,0,0,0,0,0,0,
+    0,512,511,0,510,0,0,0,509,0,0,0,0,0,0,0,
+    508,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,507,506,0,505,0,0,0,504,0,0,0,0,0,0,0,
+    503,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    502,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,501,500,0,499,0,0,0,498,0,0,0,0,0,0,0,
+    497,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    496,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    495,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,494,493,0,492,0,0,0,491,0,0,0,0,0,0,0,
+    490,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    489,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    488,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    487,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,486,0,0,0,485,0,484,483,0,
+    0,0,0,482,0,481,480,0,0,479,478,0,477,0,0,0,
+    0,0,0,476,0,475,474,0,0,473,472,0,471,0,0,0,
+    0,470,469,0,468,0,0,0,467,0,0,0,0,0,0,0,
+    0,0,0,466,0,465,464,0,0,463,462,0,461,0,0,0,
+    0,460,459,0,458,0,0,0,457,0,0,0,0,0,0,0,
+    0,456,455,0,454,0,0,0,453,0,0,0,0,0,0,0,
+    452,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,451,0,450,449,0,0,448,447,0,446,0,0,0,
+    0,445,444,0,443,0,0,0,442,0,0,0,0,0,0,0,
+    0,441,440,0,439,0,0,0,438,0,0,0,0,0,0,0,
+    437,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,436,435,0,434,0,0,0,433,0,0,0,0,0,0,0,
+    432,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,430,0,429,428,0,0,427,426,0,425,0,0,0,
+    0,424,423,0,422,0,0,0,421,0,0,0,0,0,0,0,
+    0,420,419,0,418,0,0,0,417,0,0,0,0,0,0,0,
+    416,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,415,414,0,413,0,0,0,412,0,0,0,0,0,0,0,
+    411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    410,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,409,408,0,407,0,0,0,406,0,0,0,0,0,0,0,
+    405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,402,0,401,400,0,0,399,398,0,397,0,0,0,
+    0,396,395,0,394,0,0,0,393,0,0,0,0,0,0,0,
+    0,392,391,0,390,0,0,0,389,0,0,0,0,0,0,0,
+    388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,387,386,0,385,0,0,0,384,0,0,0,0,0,0,0,
+    383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,381,380,0,379,0,0,0,378,0,0,0,0,0,0,0,
+    377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,374,373,0,372,0,0,0,371,0,0,0,0,0,0,0,
+    370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,366,0,365,364,0,0,363,362,0,361,0,0,0,
+    0,360,359,0,358,0,0,0,357,0,0,0,0,0,0,0,
+    0,356,355,0,354,0,0,0,353,0,0,0,0,0,0,0,
+    352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,351,350,0,349,0,0,0,348,0,0,0,0,0,0,0,
+    347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,345,344,0,343,0,0,0,342,0,0,0,0,0,0,0,
+    341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,338,337,0,336,0,0,0,335,0,0,0,0,0,0,0,
+    334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,330,329,0,328,0,0,0,327,0,0,0,0,0,0,0,
+    326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1
+};
+
+static const unsigned short builtin_unique5_table[HIGHEST_5CARD_BIT_RANK] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1608,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7462,
+    0,0,0,0,0,0,0,7461,0,0,0,7460,0,7459,1607,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7458,
+    0,0,0,0,0,0,0,7457,0,0,0,7456,0,7455,7454,0,
+    0,0,0,0,0,0,0,7453,0,0,0,7452,0,7451,7450,0,
+    0,0,0,7449,0,7448,7447,0,0,7446,7445,0,1606,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7444,
+    0,0,0,0,0,0,0,7443,0,0,0,7442,0,7441,7440,0,
+    0,0,0,0,0,0,0,7439,0,0,0,7438,0,7437,7436,0,
+    0,0,0,7435,0,7434,7433,0,0,7432,7431,0,7430,0,0,0,
+    0,0,0,0,0,0,0,7429,0,0,0,7428,0,7427,7426,0,
+    0,0,0,7425,0,7424,7423,0,0,7422,7421,0,7420,0,0,0,
+    0,0,0,7419,0,7418,7417,0,0,7416,7415,0,7414,0,0,0,
+    0,7413,7412,0,7411,0,0,0,1605,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7410,
+    0,0,0,0,0,0,0,7409,0,0,0,7408,0,7407,7406,0,
+    0,0,0,0,0,0,0,7405,0,0,0,7404,0,7403,7402,0,
+    0,0,0,7401,0,7400,7399,0,0,7398,7397,0,7396,0,0,0,
+    0,0,0,0,0,0,0,7395,0,0,0,7394,0,7393,7392,0,
+    0,0,0,7391,0,7390,7389,0,0,7388,7387,0,7386,0,0,0,
+    0,0,0,7385,0,7384,7383,0,0,7382,7381,0,7380,0,0,0,
+    0,7379,7378,0,7377,0,0,0,7376,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7375,0,0,0,7374,0,7373,7372,0,
+    0,0,0,7371,0,7370,7369,0,0,7368,7367,0,7366,0,0,0,
+    0,0,0,7365,0,7364,7363,0,0,7362,7361,0,7360,0,0,0,
+    0,7359,7358,0,7357,0,0,0,7356,0,0,0,0,0,0,0,
+    0,0,0,7355,0,7354,7353,0,0,7352,7351,0,7350,0,0,0,
+    0,7349,7348,0,7347,0,0,0,7346,0,0,0,0,0,0,0,
+    0,7345,7344,0,7343,0,0,0,7342,0,0,0,0,0,0,0,
+    1604,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7341,
+    0,0,0,0,0,0,0,7340,0,0,0,7339,0,7338,7337,0,
+    0,0,0,0,0,0,0,7336,0,0,0,7335,0,7334,7333,0,
+    0,0,0,7332,0,7331,7330,0,0,7329,7328,0,7327,0,0,0,
+    0,0,0,0,0,0,0,7326,0,0,0,7325,0,7324,7323,0,
+    0,0,0,7322,0,7321,7320,0,0,7319,7318,0,7317,0,0,0,
+    0,0,0,7316,0,7315,7314,0,0,7313,7312,0,7311,0,0,0,
+    0,7310,7309,0,7308,0,0,0,7307,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7306,0,0,0,7305,0,7304,7303,0,
+    0,0,0,7302,0,7301,7300,0,0,7299,7298,0,7297,0,0,0,
+    0,0,0,7296,0,7295,7294,0,0,7293,7292,0,7291,0,0,0,
+    0,7290,7289,0,7288,0,0,0,7287,0,0,0,0,0,0,0,
+    0,0,0,7286,0,7285,7284,0,0,7283,7282,0,7281,0,0,0,
+    0,7280,7279,0,7278,0,0,0,7277,0,0,0,0,0,0,0,
+    0,7276,7275,0,7274,0,0,0,7273,0,0,0,0,0,0,0,
+    7272,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7271,0,0,0,7270,0,7269,7268,0,
+    0,0,0,7267,0,7266,7265,0,0,7264,7263,0,7262,0,0,0,
+    0,0,0,7261,0,7260,7259,0,0,7258,7257,0,7256,0,0,0,
+    0,7255,7254,0,7253,0,0,0,7252,0,0,0,0,0,0,0,
+    0,0,0,7251,0,7250,7249,0,0,7248,7247,0,7246,0,0,0,
+    0,7245,7244,0,7243,0,0,0,7242,0,0,0,0,0,0,0,
+    0,7241,7240,0,7239,0,0,0,7238,0,0,0,0,0,0,0,
+    7237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7236,0,7235,7234,0,0,7233,7232,0,7231,0,0,0,
+    0,7230,7229,0,7228,0,0,0,7227,0,0,0,0,0,0,0,
+    0,7226,7225,0,7224,0,0,0,7223,0,0,0,0,0,0,0,
+    7222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,7221,7220,0,7219,0,0,0,7218,0,0,0,0,0,0,0,
+    7217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7216,
+    0,0,0,0,0,0,0,7215,0,0,0,7214,0,7213,7212,0,
+    0,0,0,0,0,0,0,7211,0,0,0,7210,0,7209,7208,0,
+    0,0,0,7207,0,7206,7205,0,0,7204,7203,0,7202,0,0,0,
+    0,0,0,0,0,0,0,7201,0,0,0,7200,0,7199,7198,0,
+    0,0,0,7197,0,7196,7195,0,0,7194,7193,0,7192,0,0,0,
+    0,0,0,7191,0,7190,7189,0,0,7188,7187,0,7186,0,0,0,
+    0,7185,7184,0,7183,0,0,0,7182,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7181,0,0,0,7180,0,7179,7178,0,
+    0,0,0,7177,0,7176,7175,0,0,7174,7173,0,7172,0,0,0,
+    0,0,0,7171,0,7170,7169,0,0,7168,7167,0,7166,0,0,0,
+    0,7165,7164,0,7163,0,0,0,7162,0,0,0,0,0,0,0,
+    0,0,0,7161,0,7160,7159,0,0,7158,7157,0,7156,0,0,0,
+    0,7155,7154,0,7153,0,0,0,7152,0,0,0,0,0,0,0,
+    0,7151,7150,0,7149,0,0,0,7148,0,0,0,0,0,0,0,
+    7147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7146,0,0,0,7145,0,7144,7143,0,
+    0,0,0,7142,0,7141,7140,0,0,7139,7138,0,7137,0,0,0,
+    0,0,0,7136,0,7135,7134,0,0,7133,7132,0,7131,0,0,0,
+    0,7130,7129,0,7128,0,0,0,7127,0,0,0,0,0,0,0,
+    0,0,0,7126,0,7125,7124,0,0,7123,7122,0,7121,0,0,0,
+    0,7120,7119,0,7118,0,0,0,7117,0,0,0,0,0,0,0,
+    0,7116,7115,0,7114,0,0,0,7113,0,0,0,0,0,0,0,
+    7112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7111,0,7110,7109,0,0,7108,7107,0,7106,0,0,0,
+    0,7105,7104,0,7103,0,0,0,7102,0,0,0,0,0,0,0,
+    0,7101,7100,0,7099,0,0,0,7098,0,0,0,0,0,0,0,
+    7097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,7096,7095,0,7094,0,0,0,7093,0,0,0,0,0,0,0,
+    7092,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    7091,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7090,0,0,0,7089,0,7088,7087,0,
+    0,0,0,7086,0,7085,7084,0,0,7083,7082,0,7081,0,0,0,
+    0,0,0,7080,0,7079,7078,0,0,7077,7076,0,7075,0,0,0,
+    0,7074,7073,0,7072,0,0,0,7071,0,0,0,0,0,0,0,
+    0,0,0,7070,0,7069,7068,0,0,7067,7066,0,7065,0,0,0,
+    0,7064,7063,0,7062,0,0,0,7061,0,0,0,0,0,0,0,
+    0,7060,7059,0,7058,0,0,0,7057,0,0,0,0,0,0,0,
+    7056,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7055,0,7054,7053,0,0,7052,7051,0,7050,0,0,0,
+    0,7049,7048,0,7047,0,0,0,7046,0,0,0,0,0,0,0,
+    0,7045,7044,0,7043,0,0,0,7042,0,0,0,0,0,0,0,
+    7041,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,7040,7039,0,7038,0,0,0,7037,0,0,0,0,0,0,0,
+    7036,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    7035,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7034,0,7033,7032,0,0,7031,7030,0,7029,0,0,0,
+    0,7028,7027,0,7026,0,0,0,7025,0,0,0,0,0,0,0,
+    0,7024,7023,0,7022,0,0,0,7021,0,0,0,0,0,0,0,
+    7020,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,7019,7018,0,7017,0,0,0,7016,0,0,0,0,0,0,0,
+    7015,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    7014,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,7013,7012,0,7011,0,0,0,7010,0,0,0,0,0,0,0,
+    7009,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    7008,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7007,
+    0,0,0,0,0,0,0,7006,0,0,0,7005,0,7004,7003,0,
+    0,0,0,0,0,0,0,7002,0,0,0,7001,0,7000,6999,0,
+    0,0,0,6998,0,6997,6996,0,0,6995,6994,0,6993,0,0,0,
+    0,0,0,0,0,0,0,6992,0,0,0,6991,0,6990,6989,0,
+    0,0,0,6988,0,6987,6986,0,0,6985,6984,0,6983,0,0,0,
+    0,0,0,6982,0,6981,6980,0,0,6979,6978,0,6977,0,0,0,
+    0,6976,6975,0,6974,0,0,0,6973,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6972,0,0,0,6971,0,6970,6969,0,
+    0,0,0,6968,0,6967,6966,0,0,6965,6964,0,6963,0,0,0,
+    0,0,0,6962,0,6961,6960,0,0,6959,6958,0,6957,0,0,0,
+    0,6956,6955,0,6954,0,0,0,6953,0,0,0,0,0,0,0,
+    0,0,0,6952,0,6951,6950,0,0,6949,6948,0,6947,0,0,0,
+    0,6946,6945,0,6944,0,0,0,6943,0,0,0,0,0,0,0,
+    0,6942,6941,0,6940,0,0,0,6939,0,0,0,0,0,0,0,
+    6938,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6937,0,0,0,6936,0,6935,6934,0,
+    0,0,0,6933,0,6932,6931,0,0,6930,6929,0,6928,0,0,0,
+    0,0,0,6927,0,6926,6925,0,0,6924,6923,0,6922,0,0,0,
+    0,6921,6920,0,6919,0,0,0,6918,0,0,0,0,0,0,0,
+    0,0,0,6917,0,6916,6915,0,0,6914,6913,0,6912,0,0,0,
+    0,6911,6910,0,6909,0,0,0,6908,0,0,0,0,0,0,0,
+    0,6907,6906,0,6905,0,0,0,6904,0,0,0,0,0,0,0,
+    6903,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6902,0,6901,6900,0,0,6899,6898,0,6897,0,0,0,
+    0,6896,6895,0,6894,0,0,0,6893,0,0,0,0,0,0,0,
+    0,6892,6891,0,6890,0,0,0,6889,0,0,0,0,0,0,0,
+    6888,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6887,6886,0,6885,0,0,0,6884,0,0,0,0,0,0,0,
+    6883,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6882,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6881,0,0,0,6880,0,6879,6878,0,
+    0,0,0,6877,0,6876,6875,0,0,6874,6873,0,6872,0,0,0,
+    0,0,0,6871,0,6870,6869,0,0,6868,6867,0,6866,0,0,0,
+    0,6865,6864,0,6863,0,0,0,6862,0,0,0,0,0,0,0,
+    0,0,0,6861,0,6860,6859,0,0,6858,6857,0,6856,0,0,0,
+    0,6855,6854,0,6853,0,0,0,6852,0,0,0,0,0,0,0,
+    0,6851,6850,0,6849,0,0,0,6848,0,0,0,0,0,0,0,
+    6847,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6846,0,6845,6844,0,0,6843,6842,0,6841,0,0,0,
+    0,6840,6839,0,6838,0,0,0,6837,0,0,0,0,0,0,0,
+    0,6836,6835,0,6834,0,0,0,6833,0,0,0,0,0,0,0,
+    6832,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6831,6830,0,6829,0,0,0,6828,0,0,0,0,0,0,0,
+    6827,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6826,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6825,0,6824,6823,0,0,6822,6821,0,6820,0,0,0,
+    0,6819,6818,0,6817,0,0,0,6816,0,0,0,0,0,0,0,
+    0,6815,6814,0,6813,0,0,0,6812,0,0,0,0,0,0,0,
+    6811,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6810,6809,0,6808,0,0,0,6807,0,0,0,0,0,0,0,
+    6806,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6805,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6804,6803,0,6802,0,0,0,6801,0,0,0,0,0,0,0,
+    6800,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6799,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6798,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6797,0,0,0,6796,0,6795,6794,0,
+    0,0,0,6793,0,6792,6791,0,0,6790,6789,0,6788,0,0,0,
+    0,0,0,6787,0,6786,6785,0,0,6784,6783,0,6782,0,0,0,
+    0,6781,6780,0,6779,0,0,0,6778,0,0,0,0,0,0,0,
+    0,0,0,6777,0,6776,6775,0,0,6774,6773,0,6772,0,0,0,
+    0,6771,6770,0,6769,0,0,0,6768,0,0,0,0,0,0,0,
+    0,6767,6766,0,6765,0,0,0,6764,0,0,0,0,0,0,0,
+    6763,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6762,0,6761,6760,0,0,6759,6758,0,6757,0,0,0,
+    0,6756,6755,0,6754,0,0,0,6753,0,0,0,0,0,0,0,
+    0,6752,6751,0,6750,0,0,0,6749,0,0,0,0,0,0,0,
+    6748,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6747,6746,0,6745,0,0,0,6744,0,0,0,0,0,0,0,
+    6743,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6742,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6741,0,6740,6739,0,0,6738,6737,0,6736,0,0,0,
+    0,6735,6734,0,6733,0,0,0,6732,0,0,0,0,0,0,0,
+    0,6731,6730,0,6729,0,0,0,6728,0,0,0,0,0,0,0,
+    6727,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6726,6725,0,6724,0,0,0,6723,0,0,0,0,0,0,0,
+    6722,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6721,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6720,6719,0,6718,0,0,0,6717,0,0,0,0,0,0,0,
+    6716,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6715,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6714,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6713,0,6712,6711,0,0,6710,6709,0,6708,0,0,0,
+    0,6707,6706,0,6705,0,0,0,6704,0,0,0,0,0,0,0,
+    0,6703,6702,0,6701,0,0,0,6700,0,0,0,0,0,0,0,
+    6699,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6698,6697,0,6696,0,0,0,6695,0,0,0,0,0,0,0,
+    6694,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6693,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6692,6691,0,6690,0,0,0,6689,0,0,0,0,0,0,0,
+    6688,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6687,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6685,6684,0,6683,0,0,0,6682,0,0,0,0,0,0,0,
+    6681,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6680,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6679,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1601,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1609,
+    0,0,0,0,0,0,0,6678,0,0,0,6677,0,6676,6675,0,
+    0,0,0,0,0,0,0,6674,0,0,0,6673,0,6672,6671,0,
+    0,0,0,6670,0,6669,6668,0,0,6667,6666,0,6665,0,0,0,
+    0,0,0,0,0,0,0,6664,0,0,0,6663,0,6662,6661,0,
+    0,0,0,6660,0,6659,6658,0,0,6657,6656,0,6655,0,0,0,
+    0,0,0,6654,0,6653,6652,0,0,6651,6650,0,6649,0,0,0,
+    0,6648,6647,0,6646,0,0,0,6645,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6644,0,0,0,6643,0,6642,6641,0,
+    0,0,0,6640,0,6639,6638,0,0,6637,6636,0,6635,0,0,0,
+    0,0,0,6634,0,6633,6632,0,0,6631,6630,0,6629,0,0,0,
+    0,6628,6627,0,6626,0,0,0,6625,0,0,0,0,0,0,0,
+    0,0,0,6624,0,6623,6622,0,0,6621,6620,0,6619,0,0,0,
+    0,6618,6617,0,6616,0,0,0,6615,0,0,0,0,0,0,0,
+    0,6614,6613,0,6612,0,0,0,6611,0,0,0,0,0,0,0,
+    6610,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6609,0,0,0,6608,0,6607,6606,0,
+    0,0,0,6605,0,6604,6603,0,0,6602,6601,0,6600,0,0,0,
+    0,0,0,6599,0,6598,6597,0,0,6596,6595,0,6594,0,0,0,
+    0,6593,6592,0,6591,0,0,0,6590,0,0,0,0,0,0,0,
+    0,0,0,6589,0,6588,6587,0,0,6586,6585,0,6584,0,0,0,
+    0,6583,6582,0,6581,0,0,0,6580,0,0,0,0,0,0,0,
+    0,6579,6578,0,6577,0,0,0,6576,0,0,0,0,0,0,0,
+    6575,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6574,0,6573,6572,0,0,6571,6570,0,6569,0,0,0,
+    0,6568,6567,0,6566,0,0,0,6565,0,0,0,0,0,0,0,
+    0,6564,6563,0,6562,0,0,0,6561,0,0,0,0,0,0,0,
+    6560,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6559,6558,0,6557,0,0,0,6556,0,0,0,0,0,0,0,
+    6555,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6554,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6553,0,0,0,6552,0,6551,6550,0,
+    0,0,0,6549,0,6548,6547,0,0,6546,6545,0,6544,0,0,0,
+    0,0,0,6543,0,6542,6541,0,0,6540,6539,0,6538,0,0,0,
+    0,6537,6536,0,6535,0,0,0,6534,0,0,0,0,0,0,0,
+    0,0,0,6533,0,6532,6531,0,0,6530,6529,0,6528,0,0,0,
+    0,6527,6526,0,6525,0,0,0,6524,0,0,0,0,0,0,0,
+    0,6523,6522,0,6521,0,0,0,6520,0,0,0,0,0,0,0,
+    6519,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6518,0,6517,6516,0,0,6515,6514,0,6513,0,0,0,
+    0,6512,6511,0,6510,0,0,0,6509,0,0,0,0,0,0,0,
+    0,6508,6507,0,6506,0,0,0,6505,0,0,0,0,0,0,0,
+    6504,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6503,6502,0,6501,0,0,0,6500,0,0,0,0,0,0,0,
+    6499,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6498,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6497,0,6496,6495,0,0,6494,6493,0,6492,0,0,0,
+    0,6491,6490,0,6489,0,0,0,6488,0,0,0,0,0,0,0,
+    0,6487,6486,0,6485,0,0,0,6484,0,0,0,0,0,0,0,
+    6483,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6482,6481,0,6480,0,0,0,6479,0,0,0,0,0,0,0,
+    6478,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6477,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6476,6475,0,6474,0,0,0,6473,0,0,0,0,0,0,0,
+    6472,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6471,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6470,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6469,0,0,0,6468,0,6467,6466,0,
+    0,0,0,6465,0,6464,6463,0,0,6462,6461,0,6460,0,0,0,
+    0,0,0,6459,0,6458,6457,0,0,6456,6455,0,6454,0,0,0,
+    0,6453,6452,0,6451,0,0,0,6450,0,0,0,0,0,0,0,
+    0,0,0,6449,0,6448,6447,0,0,6446,6445,0,6444,0,0,0,
+    0,6443,6442,0,6441,0,0,0,6440,0,0,0,0,0,0,0,
+    0,6439,6438,0,6437,0,0,0,6436,0,0,0,0,0,0,0,
+    6435,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6434,0,6433,6432,0,0,6431,6430,0,6429,0,0,0,
+    0,6428,6427,0,6426,0,0,0,6425,0,0,0,0,0,0,0,
+    0,6424,6423,0,6422,0,0,0,6421,0,0,0,0,0,0,0,
+    6420,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6419,6418,0,6417,0,0,0,6416,0,0,0,0,0,0,0,
+    6415,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6413,0,6412,6411,0,0,6410,6409,0,6408,0,0,0,
+    0,6407,6406,0,6405,0,0,0,6404,0,0,0,0,0,0,0,
+    0,6403,6402,0,6401,0,0,0,6400,0,0,0,0,0,0,0,
+    6399,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6398,6397,0,6396,0,0,0,6395,0,0,0,0,0,0,0,
+    6394,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6392,6391,0,6390,0,0,0,6389,0,0,0,0,0,0,0,
+    6388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6386,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6385,0,6384,6383,0,0,6382,6381,0,6380,0,0,0,
+    0,6379,6378,0,6377,0,0,0,6376,0,0,0,0,0,0,0,
+    0,6375,6374,0,6373,0,0,0,6372,0,0,0,0,0,0,0,
+    6371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6370,6369,0,6368,0,0,0,6367,0,0,0,0,0,0,0,
+    6366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6365,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6364,6363,0,6362,0,0,0,6361,0,0,0,0,0,0,0,
+    6360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6357,6356,0,6355,0,0,0,6354,0,0,0,0,0,0,0,
+    6353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,6349,0,0,0,6348,0,6347,6346,0,
+    0,0,0,6345,0,6344,6343,0,0,6342,6341,0,6340,0,0,0,
+    0,0,0,6339,0,6338,6337,0,0,6336,6335,0,6334,0,0,0,
+    0,6333,6332,0,6331,0,0,0,6330,0,0,0,0,0,0,0,
+    0,0,0,6329,0,6328,6327,0,0,6326,6325,0,6324,0,0,0,
+    0,6323,6322,0,6321,0,0,0,6320,0,0,0,0,0,0,0,
+    0,6319,6318,0,6317,0,0,0,6316,0,0,0,0,0,0,0,
+    6315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6314,0,6313,6312,0,0,6311,6310,0,6309,0,0,0,
+    0,6308,6307,0,6306,0,0,0,6305,0,0,0,0,0,0,0,
+    0,6304,6303,0,6302,0,0,0,6301,0,0,0,0,0,0,0,
+    6300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6299,6298,0,6297,0,0,0,6296,0,0,0,0,0,0,0,
+    6295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6293,0,6292,6291,0,0,6290,6289,0,6288,0,0,0,
+    0,6287,6286,0,6285,0,0,0,6284,0,0,0,0,0,0,0,
+    0,6283,6282,0,6281,0,0,0,6280,0,0,0,0,0,0,0,
+    6279,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6278,6277,0,6276,0,0,0,6275,0,0,0,0,0,0,0,
+    6274,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6273,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6272,6271,0,6270,0,0,0,6269,0,0,0,0,0,0,0,
+    6268,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6267,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6266,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6265,0,6264,6263,0,0,6262,6261,0,6260,0,0,0,
+    0,6259,6258,0,6257,0,0,0,6256,0,0,0,0,0,0,0,
+    0,6255,6254,0,6253,0,0,0,6252,0,0,0,0,0,0,0,
+    6251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6250,6249,0,6248,0,0,0,6247,0,0,0,0,0,0,0,
+    6246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6245,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6244,6243,0,6242,0,0,0,6241,0,0,0,0,0,0,0,
+    6240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6239,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6237,6236,0,6235,0,0,0,6234,0,0,0,0,0,0,0,
+    6233,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,6229,0,6228,6227,0,0,6226,6225,0,6224,0,0,0,
+    0,6223,6222,0,6221,0,0,0,6220,0,0,0,0,0,0,0,
+    0,6219,6218,0,6217,0,0,0,6216,0,0,0,0,0,0,0,
+    6215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6214,6213,0,6212,0,0,0,6211,0,0,0,0,0,0,0,
+    6210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6208,6207,0,6206,0,0,0,6205,0,0,0,0,0,0,0,
+    6204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6201,6200,0,6199,0,0,0,6198,0,0,0,0,0,0,0,
+    6197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,6193,6192,0,6191,0,0,0,6190,0,0,0,0,0,0,0,
+    6189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1600
+};
+
+static const int builtin_prime_product_table[PRIME_PROD_TABLE_SIZE] = {
+    48,72,80,108,112,120,162,168,176,180,200,208,252,264,270,272,
+    280,300,304,312,368,378,392,396,405,408,420,440,450,456,464,468,
+    496,500,520,552,567,588,592,594,612,616,630,656,660,675,680,684,
+    696,700,702,728,744,750,760,780,828,882,888,891,918,920,924,945,
+    952,968,980,984,990,1020,1026,1044,1050,1053,1064,1092,1100,1116,1125,1140,
+    1144,1160,1170,1240,1242,1250,1288,1300,1323,1332,1352,1372,1377,1380,1386,1428,
+    1452,1470,1476,1480,1485,1496,1530,1539,1540,1566,1575,1596,1624,1638,1640,1650,
+    1672,1674,1700,1710,1716,1736,1740,1750,1755,1768,1820,1860,1863,1875,1900,1932,
+    1950,1976,1998,2024,2028,2058,2070,2072,2079,2142,2156,2178,2205,2214,2220,2244,
+    2295,2296,2300,2312,2349,2380,2392,2394,2420,2436,2450,2457,2460,2475,2508,2511,
+    2548,2550,2552,2565,2574,2584,2604,2610,2625,2652,2660,2728,2750,2790,2850,2860,
+    2888,2898,2900,2925,2964,2997,3016,3036,3042,3087,3100,3105,3108,3128,3213,3220,
+    3224,3234,3250,3256,3267,3321,3330,3332,3366,3380,3388,3430,3444,3450,3465,3468,
+    3496,3588,3591,3608,3630,3654,3675,3690,3700,3724,3740,3762,3822,3825,3828,3848,
+    3850,3861,3876,3906,3915,3944,3978,4004,4060,4092,4095,4100,4125,4180,4185,4216,
+    4232,4250,4264,4275,4332,4340,4347,4350,4375,4408,4420,4446,4508,4524,4550,4554,
+    4563,4650,4662,4692,4712,4732,4750,4802,4836,4851,4875,4884,4940,4995,4998,5032,
+    5049,5060,5070,5082,5145,5166,5175,5180,5202,5236,5244,5324,5336,5355,5382,5390,
+    5412,5445,5481,5535,5550,5576,5586,5624,5643,5684,5704,5733,5740,5742,5750,5772,
+    5775,5780,5814,5852,5859,5916,5950,5967,5980,5985,6050,6076,6125,6138,6150,6188,
+    6232,6292,6324,6348,6370,6375,6380,6396,6435,6460,6498,6525,6612,6650,6669,6728,
+    6762,6786,6808,6820,6825,6831,6875,6916,6975,6993,7038,7068,7084,7098,7125,7150,
+    7192,7203,7220,7245,7250,7252,7254,7326,7436,7497,7540,7544,7546,7548,7605,7623,
+    7688,7749,7750,7803,7820,7866,7986,8004,8036,8050,8060,8073,8085,8092,8118,8125,
+    8140,8228,8325,8330,8364,8372,8379,8415,8436,8450,8470,8526,8556,8575,8584,8613,
+    8625,8658,8670,8721,8740,8788,8874,8918,8925,8932,9009,9020,9044,9075,9114,9135,
+    9176,9196,9207,9225,9250,9310,9348,9350,9405,9438,9486,9512,9522,9548,9555,9594,
+    9620,9625,9724,9747,9765,9860,9918,9945,9975,10092,10108,10143,10150,10168,10179,10212,
+    10250,10450,10540,10556,10557,10580,10602,10625,10647,10660,10725,10788,10830,10850,10868,10875,
+    10878,10881,10948,10952,10989,11020,11050,11115,11132,11154,11270,11284,11316,11319,11322,11375,
+    11385,11396,11492,11532,11625,11655,11662,11780,11781,11799,11830,11858,11875,11979,12005,12006,
+    12054,12075,12136,12138,12177,12236,12342,12350,12495,12546,12580,12628,12650,12654,12675,12705,
+    12716,12789,12834,12844,12876,12915,12950,12987,13005,13034,13156,13167,13182,13310,13311,13340,
+    13377,13448,13455,13468,13475,13671,13764,13794,13804,13875,13923,13940,13965,14014,14022,14025,
+    14036,14060,14157,14210,14212,14229,14260,14268,14283,14350,14355,14375,14391,14450,14535,14756,
+    14812,14875,14877,14924,14950,15004,15028,15125,15138,15162,15190,15225,15252,15318,15345,15375,
+    15428,15548,15561,15580,15675,15730,15778,15870,15884,15903,15925,15939,15950,16150,16182,16245,
+    16275,16317,16428,16492,16562,16575,16588,16625,16698,16731,16796,16820,16905,16965,16974,16983,
+    17020,17050,17204,17238,17298,17493,17595,17612,17732,17745,17787,17875,17908,17980,18009,18050,
+    18081,18125,18130,18135,18204,18207,18315,18326,18513,18525,18590,18634,18676,18772,18819,18837,
+    18850,18860,18865,18975,18981,19074,19220,19228,19251,19266,19314,19375,19425,19516,19550,19551,
+    19604,19652,19665,19684,19773,19844,19894,19964,19965,20090,20097,20125,20150,20172,20230,20295,
+    20332,20349,20350,20482,20570,20646,20691,20825,20956,21021,21033,21054,21125,21164,21175,21266,
+    21315,21402,21460,21483,21525,21645,21658,21675,21692,21812,21850,21879,21964,21970,22022,22185,
+    22218,22295,22425,22506,22542,22550,22707,22724,22743,22785,22878,22940,22977,22990,23125,23188,
+    23275,23276,23322,23375,23452,23548,23595,23667,23715,23751,23780,23805,23826,23828,23925,23985,
+    24050,24206,24225,24244,24273,24453,24548,24633,24642,24650,24794,24795,24843,25012,25025,25047,
+    25172,25230,25270,25375,25382,25389,25420,25461,25575,25625,25636,25641,25857,25916,25947,26026,
+    26125,26350,26404,26411,26450,26505,26588,26650,26862,26908,27075,27125,27195,27306,27380,27404,
+    27436,27489,27508,27531,27550,27625,27676,27716,27830,27885,27951,28126,28158,28175,28275,28305,
+    28322,28413,28611,28652,28730,28798,28830,28899,28971,29155,29282,29302,29325,29348,29406,29450,
+    29478,29575,29601,29645,29716,29766,29841,30015,30044,30135,30225,30258,30303,30340,30345,30525,
+    30628,30668,30723,30758,30855,30875,30932,30969,31059,31213,31262,31365,31372,31434,31450,31581,
+    31625,31635,31654,31790,31899,31977,32085,32103,32110,32116,32186,32375,32487,32585,32708,32725,
+    32775,32946,32955,33033,33201,33212,33275,33292,33327,33350,33418,33524,33579,33620,33759,33813,
+    33825,34276,34317,34485,34606,34684,34713,34850,34914,34983,35035,35055,35090,35150,35322,35378,
+    35525,35588,35650,35739,35836,35875,35972,36075,36125,36244,36309,36556,36575,36822,36946,36963,
+    36975,37004,37030,37076,37107,37191,37323,37375,37444,37468,37510,37518,37570,37791,37845,37905,
+    37975,38073,38295,38318,38332,38675,38709,38870,38950,38962,39039,39325,39445,39494,39525,39556,
+    39627,39675,39710,39875,39882,39886,39897,39975,40052,40204,40222,40293,40362,40375,40455,40508,
+    40817,40898,40959,41070,41154,41262,41325,41405,41492,41503,41574,41745,41876,42021,42050,42189,
+    42237,42284,42435,42476,42483,42550,42625,42772,42826,43095,43197,43225,43245,43263,43732,43911,
+    43923,43953,44109,44175,44198,44217,44252,44275,44289,44506,44649,44764,44770,44919,44950,44954,
+    45125,45254,45325,45356,45387,45619,45747,45815,46137,46475,46585,46748,46893,46930,47068,47125,
+    47138,47150,47151,47175,47212,47396,47481,47619,47685,47804,48050,48165,48279,48285,48314,48334,
+    48484,48668,48807,48875,49010,49036,49049,49077,49126,49130,49419,49610,49735,49818,49972,50025,
+    50127,50225,50286,50375,50430,50468,50575,50578,50692,50875,51129,51205,51425,51615,51646,51842,
+    51909,52173,52234,52275,52316,52325,52371,52390,52514,52598,52635,52725,52767,52972,52983,53067,
+    53165,53428,53475,53482,53505,53613,53650,53754,53958,53998,54145,54188,54418,54549,54625,54910,
+    54925,55055,55223,55233,55419,55506,55545,55594,55796,55825,55924,56265,56277,56355,56375,56525,
+    56637,57122,57188,57195,57350,57475,57477,57498,57681,57722,57868,57967,58190,58305,58311,58425,
+    58443,58870,59204,59241,59409,59450,59565,59644,59675,59774,59823,59829,60125,60236,60306,60333,
+    60515,60543,60775,61132,61226,61347,61364,61370,61605,61625,61642,61659,61731,61828,61893,61985,
+    62271,62361,62530,62678,62814,63075,63175,63206,63426,63455,63550,63825,63916,64124,64141,64158,
+    64239,64467,64676,65065,65219,65348,65366,65596,65598,65702,65875,65975,66033,66092,66125,66297,
+    66470,66625,66748,66759,66861,67146,67155,67270,67425,67431,67599,67881,67925,68265,68306,68324,
+    68425,68450,68590,68614,68770,68782,68875,68894,68913,69003,69290,69454,69575,69597,69629,69874,
+    69938,70315,70395,70525,70587,70602,70642,70707,70725,70805,71094,71188,71225,71668,71687,71825,
+    71995,72075,72261,72358,72471,72501,72964,73002,73036,73205,73255,73346,73515,73593,73625,73689,
+    73695,73964,74415,74431,74698,74727,74907,74958,75429,75645,75803,75850,75867,76342,76475,76874,
+    76895,77077,77121,77198,77372,77469,77763,77996,78039,78155,78166,78292,78351,78585,78625,78771,
+    78884,78897,78925,79135,79475,80073,80142,80223,80275,80465,80475,80631,80852,80937,80997,81466,
+    81548,81549,81627,82225,82251,82365,82418,82522,82654,82708,83030,83259,83375,83391,83398,83421,
+    83486,83545,83810,84050,84175,84249,84303,84721,85514,85683,85782,85918,86025,86247,86275,86428,
+    86515,86583,86756,86779,87125,87172,87285,87362,87412,87542,87725,87875,88102,88305,88412,88445,
+    88806,88825,88837,89001,89125,89175,89590,89661,89930,90117,90354,90364,90459,91091,91143,91234,
+    91839,92046,92055,92225,92365,92414,92463,92510,92575,93058,93092,93275,93357,93775,93795,93925,
+    94017,94178,94221,94622,94809,95139,95325,95571,95795,95830,95874,96026,96237,96278,96425,96596,
+    97006,97175,97375,97405,97526,97556,97682,98022,98049,98394,98397,98441,98494,98553,98716,98735,
+    99127,99275,99567,99705,99715,100510,100555,100719,100793,100905,101062,102051,102245,102459,102487,102557,
+    102675,102885,102921,103075,103155,103156,103173,103246,103341,103675,103935,104044,104181,104284,104690,104811,
+    104907,104975,105125,105154,105183,105524,105710,105754,105903,105963,106227,106375,106641,106782,106930,107065,
+    107525,107559,107653,107822,108086,108537,109089,109142,109174,109330,109388,109417,109503,109554,110019,110075,
+    110331,110495,110789,110825,110946,111265,111476,111910,111925,112047,112375,112385,112406,112437,112651,113135,
+    113553,113775,114057,114308,114513,115258,115292,115311,115797,116058,116242,116402,116522,116725,116932,116963,
+    117249,117325,117334,117438,117670,117711,117845,117875,118490,119119,119164,119187,119306,120125,120175,120213,
+    120785,120802,120835,121121,121670,121923,121975,122018,122199,122525,122815,122825,123025,123627,123783,123823,
+    123981,124025,124468,124545,124558,124775,124930,125097,125229,125426,125541,125715,125829,125902,125948,126075,
+    126445,127075,127426,127534,127738,127756,128018,128271,128673,128877,128986,129115,129311,129514,129605,130134,
+    130203,130585,130975,131043,131118,131285,131313,131495,132153,132158,132275,132618,133052,133133,133209,133342,
+    133570,133705,134113,134125,134162,134199,134385,134895,134995,135014,135531,135575,136045,136214,136325,136367,
+    136851,137275,137547,137566,137924,138069,138229,138621,138765,138985,139113,139564,139587,139601,139638,140714,
+    140777,141267,141933,142025,142228,142538,142766,142805,142970,143143,143375,143745,143811,144039,144279,144305,
+    144417,144925,145475,145509,145521,146234,146289,146334,146523,146566,146575,147033,147175,147436,147591,147706,
+    147741,147994,148010,148625,148666,148707,148925,149435,149702,149891,150183,150590,150765,150898,151294,151525,
+    151593,152218,152438,153062,153065,153410,153425,153729,154105,154652,154693,154869,155771,156066,156325,156426,
+    156674,156695,157035,157325,157339,157604,157731,158015,158389,158565,158631,158804,158875,159562,159790,160173,
+    160225,160395,161161,161253,161414,161733,161975,162129,162578,163370,163415,163713,163761,163990,163995,164169,
+    164255,164331,164738,164983,165025,165886,166175,166419,166634,167042,167214,167865,168175,168609,168674,169099,
+    169169,169756,170126,170338,170765,171125,171275,171462,171475,171535,171925,171941,171955,172235,172546,172822,
+    172887,172975,173225,173635,174087,174097,174363,174603,174685,174783,174845,174902,175491,175972,176001,176157,
+    176505,176605,177023,177489,177735,177970,178126,178334,178746,178802,178959,179075,180154,180761,180895,181203,
+    181447,181917,182505,182590,182666,182819,183027,183365,183425,183483,183799,184093,184382,184910,185725,186093,
+    186238,186694,186702,186745,186837,186998,187187,187395,187775,188108,188139,188518,188853,188922,188993,189625,
+    190333,190463,190855,191139,191301,191425,191607,191634,191675,192027,192185,192995,193325,193430,193479,194271,
+    194463,194579,194996,195201,195415,195730,196075,196137,196677,197098,197846,198237,198927,199082,199927,200013,
+    200158,200355,200725,201243,202027,202521,202612,203203,203319,203522,203665,204321,204425,205751,205942,206045,
+    206305,206349,206635,206886,207214,207575,208075,208444,208495,208658,208715,209209,209457,209525,210125,210749,
+    210826,211071,212602,213342,213785,213807,214149,214225,214291,214455,214774,214795,215747,215878,216775,216890,
+    217217,217341,217558,217906,218405,218530,218855,219351,219373,219501,219849,220255,221030,221122,221221,221559,
+    221991,222015,222111,222425,222999,223706,223975,224516,224553,224825,224939,225446,225885,225998,226347,226525,
+    226941,228085,228206,228327,228475,228657,228718,228781,229586,229593,229957,230115,230318,231035,231275,231725,
+    231978,232101,232562,232645,232730,232934,233206,233818,234025,234099,234175,234639,235011,235246,235445,235543,
+    235586,236406,236555,237429,237614,238206,239071,239343,239575,239685,240065,240149,240526,240695,240737,240994,
+    241129,242121,242515,243089,243815,243867,243890,244205,244559,244783,245055,245985,246123,246202,246235,247107,
+    247225,247247,248788,248829,248897,249067,249158,249951,250325,250563,250821,251275,252586,252655,253011,253175,
+    253253,254634,255189,255507,255626,256711,257193,258115,258819,258874,259233,259259,259325,259407,259666,260110,
+    260642,260678,260710,261326,261443,261725,262353,262885,263097,263302,264275,264385,265475,265727,265837,266955,
+    267189,267197,267325,267501,267674,268119,268203,269059,269555,270193,270215,270231,270802,272194,272855,272935,
+    273325,273581,273885,273999,274022,274846,275684,276573,276575,277365,277574,278018,278179,278369,278690,279357,
+    279775,280041,280053,280497,281015,282302,282777,283383,283475,284053,284258,284954,285131,285770,287287,287451,
+    287638,287738,288145,288463,288827,289289,290145,290605,290966,291005,291305,291893,292175,292201,292494,293335,
+    293595,293854,294151,294175,295075,295647,296225,296769,296989,297910,298265,298623,298775,299299,299367,300237,
+    300713,302005,303025,303646,303862,303918,304175,304606,305045,305283,305762,305767,305942,306397,306475,307582,
+    308074,308357,308913,309442,310329,310821,311170,311395,312325,312666,312987,313565,314019,314041,314171,314534,
+    314755,314870,315425,315514,316239,316342,316825,317471,318478,318565,318734,318835,318903,319319,319345,319390,
+    320013,320045,322161,322465,323449,323785,323817,324818,325335,325622,325703,325822,326337,326859,326975,327795,
+    328757,329623,330395,331075,331177,331298,331545,331683,331731,333355,333925,335405,335559,335699,336091,336743,
+    336774,336973,337502,337535,338169,338675,338997,339031,339521,340442,340535,341341,341446,341734,341887,342309,
+    343077,343915,344379,344729,344810,345477,347282,347633,347967,348725,348843,349095,349401,349525,349809,350727,
+    350987,351538,351785,352869,353379,353717,354609,355570,355946,356345,356421,356915,357309,357425,359414,359513,
+    360778,360789,361361,361491,361675,362674,363562,364021,364154,364994,365585,365835,366415,367114,368039,369265,
+    369303,369985,370025,370139,371665,371722,372775,373182,373737,374255,375193,375683,376475,377245,377377,378235,
+    378301,378879,378917,380494,380545,381095,381938,381951,381997,382075,382109,382655,383439,383525,384307,384659,
+    384826,385526,386425,386630,387686,388311,388531,389499,390165,390166,390963,391017,391065,391534,391685,391989,
+    393421,394010,394953,395937,397010,397822,397969,398866,398905,399475,400078,400673,400775,401511,401698,401882,
+    402866,403403,403535,404225,406203,406334,406445,406802,406847,407407,407827,408291,408425,409975,410669,410839,
+    411033,411845,412114,412269,413075,413526,413678,414715,415454,416361,416585,417027,417074,417175,417571,417605,
+    418035,419881,421685,422807,423243,423453,424390,424589,424762,424879,425258,425315,425546,425845,426374,426387,
+    427025,427063,427431,428655,429598,429913,430606,431365,431457,431607,432055,435638,435953,436449,437255,438741,
+    438991,440657,440781,440818,443989,444925,445315,445835,445991,446369,446865,447005,447083,447146,447811,447925,
+    448063,450262,450385,451451,453299,453871,454138,454181,454597,455469,455793,455877,456025,456475,456665,456909,
+    458643,458689,458913,458983,459173,460955,461373,462111,462275,462346,462553,462722,464163,465595,466697,466735,
+    466755,467495,468999,469567,470327,471295,471801,472305,472549,473271,474513,474734,476749,477158,477717,478101,
+    479085,480491,480766,481481,481574,482734,483575,484561,485537,486098,486266,487227,487475,487490,488433,488733,
+    489325,490637,491878,492499,492745,493025,494615,496223,496947,497705,497798,498883,499681,500395,501787,502918,
+    503234,505161,505325,506253,506530,507566,508079,508277,508805,508898,509675,510663,511819,512006,512169,512601,
+    512746,512981,514786,514855,516925,516971,517215,517979,518035,519622,520331,520421,520923,521110,521594,521645,
+    523957,527065,527307,528143,529529,531505,532763,533355,533533,533919,535717,536393,536558,536935,537251,539121,
+    539695,540175,541167,541282,541717,542087,542225,542659,543286,543895,544011,544765,544825,545054,545343,546231,
+    546325,547491,548359,550671,551614,552575,552805,555458,555611,555814,555841,557566,557583,558467,559265,559682,
+    559773,561290,562438,563615,563914,564775,564949,564995,567853,568178,569023,570515,570741,571795,572242,572663,
+    572907,573562,573965,574678,575795,576583,577239,578289,578347,579945,580601,581405,581529,581647,581825,582335,
+    582958,583015,583219,584545,584647,585249,585599,587301,588115,588965,590359,591015,593021,593929,594035,594146,
+    594473,595441,595515,596183,596733,598299,600117,600281,600457,600691,601315,602485,602547,602823,603725,603911,
+    604299,604877,605098,607202,609501,609725,610203,612157,613118,614422,615043,615505,616975,618171,618233,620194,
+    620289,620517,620806,620977,621970,622895,623162,623181,623441,624169,625611,625807,628694,630539,631465,633919,
+    634114,634933,636585,637143,637887,638319,639065,639331,639561,640211,640871,644397,644725,645337,645909,647185,
+    648907,649078,649165,650275,651605,651695,651775,651833,653315,653429,653457,654493,655402,656183,656903,657662,
+    658255,659525,659813,661227,662966,663803,664411,665482,669185,670719,671099,675393,676286,677005,677846,680485,
+    680846,681207,682486,683501,683675,684574,685055,685069,687115,687242,687401,689210,689843,692461,692714,693519,
+    693842,693935,694083,695045,696725,696787,700553,700843,701437,702559,702658,704099,705686,705755,708883,709142,
+    709423,709631,710645,712101,712327,712385,714425,715737,719095,719345,720575,720797,721149,722361,724101,724594,
+    725249,726869,727415,729147,729399,729554,730303,730639,730825,731235,733381,734635,734638,735034,737426,737817,
+    737891,742577,743002,743774,744107,744775,746697,748867,749177,751502,751709,754354,754377,754851,755573,756613,
+    757393,758582,759115,759655,759795,761349,761453,761515,762671,763347,764405,764855,768009,768955,769119,770185,
+    772179,773605,773927,774566,774706,775489,777925,779433,781665,782254,782391,782971,783959,785213,785519,785806,
+    786335,787175,788785,789061,790855,790993,791282,792281,793117,796195,796835,798475,798721,800513,803551,804287,
+    804837,806113,809042,809627,811923,812045,812383,813967,814055,814555,814929,815269,816221,817581,817663,818363,
+    818662,823361,824182,824551,827421,828134,828245,828269,828971,829226,829939,830297,830414,831575,831649,832117,
+    833187,833721,836349,836969,837199,838409,839523,839914,841841,841935,843479,843657,843755,845871,850586,851105,
+    852267,853615,854335,858363,858458,859027,860343,861707,862017,862025,866723,866822,868205,870758,872053,872275,
+    873422,874437,876826,877591,877933,878845,884051,884374,885391,886414,887777,888925,889778,889865,891219,893809,
+    894179,894691,896506,898535,898909,900358,901945,906059,906685,907647,908831,908905,910385,910803,912247,912373,
+    912485,914641,916487,917662,917785,918731,919677,921475,921557,921633,924482,926497,926782,927707,927979,929305,
+    930291,931209,932955,933658,934743,935693,936859,943041,947546,947807,949003,950521,951142,951171,951235,952679,
+    954845,955451,959077,960089,961961,962065,963815,964894,966329,966575,969215,971509,971618,973063,973617,975415,
+    978835,979693,980837,983103,983411,985025,986493,988057,988418,989417,990437,990698,990847,992525,994449,994555,
+    994903,997165,997339,997694,998223,998963,1000195,1004245,1004663,1004705,1005238,1006733,1007083,1007165,1012894,1013173,
+    1014101,1014429,1015835,1016738,1016769,1017005,1018381,1021269,1023729,1024309,1024426,1026817,1026861,1028489,1030285,1030863,
+    1032226,1033815,1034195,1036849,1037153,1038635,1039071,1040763,1042685,1049191,1053987,1056757,1057978,1058529,1058743,1059022,
+    1060975,1061905,1062761,1063145,1063517,1063713,1063865,1065935,1066121,1067857,1070167,1070558,1070797,1072478,1073995,1076515,
+    1076537,1078259,1083047,1083121,1084039,1085773,1085926,1086891,1088153,1089095,1094331,1094951,1095274,1096381,1099825,1100869,
+    1101957,1102045,1102551,1103414,1104299,1105819,1106139,1106959,1107197,1114366,1114503,1114673,1115569,1115661,1117865,1119371,
+    1121549,1121894,1123343,1125655,1127253,1131531,1132058,1132681,1133407,1135234,1135345,1136863,1137873,1139677,1140377,1146442,
+    1147619,1155865,1156805,1157819,1159171,1159543,1161849,1162059,1162213,1169311,1171001,1172354,1173381,1175675,1178709,1181257,
+    1182446,1183301,1186835,1186923,1187329,1191547,1192895,1195061,1196069,1196506,1196569,1198483,1199266,1201915,1203935,1206835,
+    1208938,1209271,1210547,1211573,1213511,1213526,1213563,1213682,1215245,1215487,1215665,1216171,1218725,1225367,1227993,1229695,
+    1230383,1234838,1236273,1239953,1242201,1242989,1243839,1244495,1245621,1245811,1255133,1255501,1257295,1257949,1257962,1258085,
+    1259871,1262723,1263661,1266325,1266749,1267474,1268915,1269359,1272245,1272467,1274539,1275879,1277479,1279091,1280015,1281137,
+    1281865,1281974,1282633,1284899,1285999,1286965,1287687,1292669,1293853,1294033,1295723,1299055,1300233,1301027,1302775,1303985,
+    1306137,1306877,1310133,1310278,1314542,1315239,1316978,1322893,1325467,1326561,1329621,1331729,1334667,1336783,1338623,1339634,
+    1340003,1341395,1344718,1344759,1346891,1349341,1349834,1350537,1351166,1353205,1354111,1354886,1356277,1356901,1358215,1362635,
+    1365581,1368334,1370369,1370386,1372019,1376493,1379035,1381913,1386723,1388645,1389223,1389535,1390173,1392377,1393915,1396031,
+    1399205,1400273,1400487,1403207,1403225,1405943,1406095,1406587,1409785,1410031,1412327,1414127,1414562,1416389,1420445,1421319,
+    1422169,1423807,1426713,1428163,1430605,1431382,1432417,1433531,1433729,1433905,1436695,1437293,1442399,1442926,1446071,1447341,
+    1447873,1448161,1448402,1454089,1457395,1457427,1459354,1459759,1465399,1466641,1468987,1469194,1472207,1482627,1483339,1485365,
+    1486047,1486667,1488403,1489411,1492309,1496541,1497067,1497238,1503593,1507121,1507857,1508638,1511653,1512118,1512745,1514071,
+    1515839,1516262,1518005,1519341,1519817,1524733,1525107,1526657,1529099,1531309,1532795,1533433,1536055,1536639,1542863,1544491,
+    1548339,1550485,1552015,1552661,1554925,1557905,1563419,1565011,1566461,1567247,1571735,1575917,1582009,1582559,1583023,1585285,
+    1586126,1586899,1586967,1588533,1589483,1600313,1602403,1604986,1605837,1608717,1612682,1616197,1616402,1617122,1618211,1619527,
+    1622695,1628889,1629887,1635622,1638505,1639187,1641809,1642911,1644155,1655121,1657415,1657466,1661569,1663705,1670053,1671241,
+    1671549,1675333,1681691,1682681,1682841,1685509,1687829,1689569,1690715,1691701,1692197,1694173,1694407,1694615,1698087,1698619,
+    1701343,1701931,1702115,1702851,1706215,1709659,1711435,1711463,1718105,1719663,1721573,1722202,1723025,1727878,1729937,1731785,
+    1734605,1735327,1739881,1742293,1750507,1751629,1753037,1756645,1758531,1760213,1761319,1764215,1769261,1771774,1772855,1773593,
+    1773669,1776481,1778498,1781143,1786499,1790921,1791946,1792021,1794611,1794759,1798899,1801751,1804231,1804786,1806091,1807117,
+    1811485,1812446,1813407,1818677,1820289,1820523,1822139,1823885,1825579,1826246,1834963,1836595,1837585,1843565,1847042,1847677,
+    1849243,1852201,1852257,1852462,1856261,1857505,1859435,1869647,1870297,1872431,1877953,1878755,1879537,1885885,1886943,1891279,
+    1894487,1896455,1901211,1901501,1907689,1908386,1910051,1916291,1920983,1922961,1924814,1929254,1930649,1933459,1936415,1936765,
+    1939751,1944103,1945349,1951481,1952194,1955635,1956449,1957703,1958887,1964515,1965417,1968533,1971813,1973699,1975103,1975467,
+    1976777,1978205,1979939,1980218,1982251,1984279,1987453,1988623,1994707,1999283,1999591,1999898,2002481,2002847,2007467,2009451,
+    2011373,2017077,2019127,2019719,2022605,2024751,2026749,2032329,2040353,2044471,2046655,2048449,2050841,2052501,2055579,2056223,
+    2060455,2062306,2066801,2070107,2070335,2071771,2073065,2076035,2079511,2092717,2099785,2100659,2111317,2114698,2116543,2117843,
+    2120393,2121843,2125207,2126465,2132273,2132902,2137822,2141737,2145913,2146145,2146981,2147073,2150477,2153437,2155657,2164389,
+    2167055,2167957,2170679,2172603,2172821,2176895,2181067,2183555,2188021,2189031,2192065,2193763,2200429,2203791,2204534,2207161,
+    2209339,2210351,2210935,2212873,2215457,2215763,2216035,2219399,2221271,2224445,2234837,2237411,2238067,2241265,2242454,2245857,
+    2250895,2257333,2262957,2266627,2268177,2271773,2274393,2275229,2284997,2285258,2289443,2293907,2294155,2301817,2302658,2304323,
+    2311205,2313649,2316955,2320381,2329187,2330038,2334145,2336191,2338919,2340503,2343314,2345057,2357381,2359379,2362789,2363153,
+    2363486,2367001,2368333,2368865,2372461,2377855,2379189,2382961,2386241,2388701,2396009,2397106,2399567,2405347,2407479,2412235,
+    2416193,2419023,2422109,2424499,2424603,2425683,2428447,2429045,2442862,2444923,2445773,2453433,2459303,2461462,2466827,2469901,
+    2471045,2473211,2476441,2476745,2481997,2482597,2486199,2494235,2497759,2501369,2501917,2505919,2513095,2519959,2532235,2536079,
+    2541845,2542903,2544971,2551594,2553439,2561065,2571233,2572619,2580565,2580991,2581934,2582827,2583303,2585843,2589151,2591817,
+    2592629,2598977,2600507,2603209,2611037,2612233,2614447,2618629,2618998,2624369,2630257,2631218,2636953,2640239,2641171,2644213,
+    2644945,2647555,2648657,2655037,2657661,2667747,2673539,2674463,2676395,2678741,2681195,2681869,2687919,2688907,2700451,2705329,
+    2707063,2707179,2709239,2710981,2711471,2714815,2718669,2732561,2733511,2737889,2738185,2739369,2750321,2758535,2760953,2764177,
+    2766049,2767787,2769487,2770563,2771431,2778693,2785915,2791613,2792387,2798939,2804735,2816033,2820103,2827442,2830145,2831323,
+    2831647,2838085,2857921,2861062,2862579,2865317,2866105,2868767,2884637,2886689,2887221,2893757,2893881,2898469,2902291,2904739,
+    2906449,2915674,2922029,2926703,2928291,2930885,2937874,2939699,2951069,2951897,2956115,2970327,2977051,2986159,2988073,2991265,
+    2997383,2997797,2998165,2999847,3004603,3005249,3007693,3022345,3022438,3025541,3027973,3033815,3033877,3034205,3047653,3055019,
+    3056977,3066613,3068891,3078251,3082729,3085771,3087095,3090277,3093409,3093459,3095309,3101527,3102449,3114223,3120469,3124979,
+    3130231,3137771,3140486,3144905,3147331,3151253,3154591,3159637,3160729,3168685,3170366,3172047,3192101,3197207,3199353,3204935,
+    3206269,3206733,3211817,3230882,3234199,3235687,3243737,3246473,3255482,3267803,3268967,3271021,3275695,3276971,3286355,3292445,
+    3295331,3299179,3306801,3307837,3308987,3316411,3328039,3328997,3332849,3339611,3346109,3349085,3361795,3363681,3372149,3374585,
+    3377129,3377543,3377915,3379321,3381487,3387215,3390361,3400663,3411067,3414433,3415997,3420835,3424361,3425965,3427391,3427887,
+    3445403,3453839,3453987,3457817,3459463,3467443,3479998,3487583,3487627,3491929,3494413,3495057,3502969,3514971,3516263,3518333,
+    3531359,3536405,3537193,3542851,3545129,3545229,3558583,3569929,3578455,3585491,3595659,3604711,3607315,3607426,3610477,3612791,
+    3614693,3617141,3621005,3624179,3628411,3637933,3646313,3648385,3651583,3655847,3660151,3662497,3664293,3665441,3672985,3683017,
+    3692193,3693157,3702923,3706577,3719573,3728153,3735407,3743095,3744653,3746953,3748322,3753673,3765157,3771595,3779309,3779831,
+    3780295,3789227,3790655,3800741,3809927,3816131,3817879,3827227,3827391,3833459,3856214,3860173,3861949,3864619,3872901,3881273,
+    3900281,3915083,3926629,3928497,3929941,3933137,3946813,3946827,3962203,3965315,3973319,3985267,3993743,3997418,4012465,4012547,
+    4024823,4031261,4031705,4035239,4039951,4040509,4041005,4042687,4042805,4050553,4055843,4081181,4086511,4089055,4090757,4093379,
+    4103239,4121741,4131833,4133261,4138561,4143665,4148947,4153546,4170751,4172201,4180963,4187771,4197431,4219007,4221811,4231283,
+    4241163,4247341,4247887,4260113,4260883,4273102,4274803,4277489,4291593,4302397,4305505,4309279,4314311,4319695,4321933,4325633,
+    4352051,4358341,4373511,4375681,4392287,4395859,4402867,4405999,4406811,4416787,4425499,4429435,4433549,4436159,4446245,4449731,
+    4458389,4459939,4467073,4479865,4486909,4502641,4509973,4511965,4531115,4533001,4533657,4554737,4560743,4565615,4567277,4574953,
+    4585973,4586959,4600897,4602578,4609423,4617605,4617931,4619527,4621643,4631155,4632959,4672841,4678223,4688719,4706513,4709861,
+    4710729,4721393,4721519,4724419,4729081,4739311,4742101,4755549,4757297,4767521,4770965,4775147,4777721,4780723,4789169,4793269,
+    4796351,4803821,4812035,4821877,4822543,4823135,4829513,4834531,4846323,4864057,4871087,4875277,4880485,4883223,4884763,4890467,
+    4893779,4903301,4930783,4936409,4940377,4950545,4950967,4951969,4955143,4999745,5009837,5034679,5035589,5047141,5050241,5069407,
+    5084651,5097301,5100154,5107739,5135119,5142179,5143333,5155765,5161217,5178013,5211503,5219997,5222587,5231281,5240333,5258773,
+    5271649,5276851,5280233,5286745,5292413,5296877,5306917,5316979,5321303,5323153,5332255,5343161,5343899,5344555,5357183,5382871,
+    5389969,5397691,5411139,5436299,5448839,5459441,5487317,5511335,5517163,5528809,5538101,5551441,5570917,5579977,5590127,5592059,
+    5606135,5617451,5621447,5622483,5634343,5635211,5644387,5651522,5656597,5657407,5659927,5677243,5690267,5699369,5713145,5724677,
+    5748431,5756645,5761691,5768419,5783557,5784321,5787191,5801131,5818879,5824621,5825095,5827289,5837009,5841557,5852327,5858285,
+    5888069,5891843,5896579,5897657,5898629,5908715,5920039,5964803,5972593,5975653,5992765,5996127,5998331,6009133,6024007,6024083,
+    6027707,6047573,6068777,6107155,6129013,6153655,6159049,6166241,6170417,6182423,6201209,6224743,6226319,6229171,6230319,6243787,
+    6244423,6247789,6268121,6271811,6298177,6305431,6315517,6316751,6322079,6343561,6378985,6387767,6391861,6409653,6412009,6424717,
+    6439537,6447947,6454835,6464647,6468037,6483617,6485011,6503453,6528799,6534047,6547495,6578045,6580783,6583811,6585001,6591499,
+    6595963,6608797,6649159,6658769,6674393,6675251,6679351,6704017,6709469,6725897,6736849,6752389,6791609,6832679,6876857,6883643,
+    6903867,6918791,6930763,6958627,6971107,6979061,6982823,6999643,7005547,7039139,7048421,7050857,7058519,7065853,7068605,7119281,
+    7132231,7139269,7152655,7166363,7172191,7206529,7218071,7229981,7243379,7289185,7292311,7296893,7344685,7358377,7359707,7367987,
+    7379021,7395949,7401443,7424087,7431413,7434817,7451873,7453021,7464397,7465157,7482377,7517179,7525837,7534519,7537123,7556095,
+    7563113,7620301,7624109,7650231,7653043,7685899,7715869,7777289,7780091,7795229,7800127,7829729,7848589,7851215,7858097,7867273,
+    7872601,7877647,7887919,7888933,7903283,7925915,7936093,7947563,7966211,7979183,7998403,8026447,8054141,8059303,8077205,8080567,
+    8084707,8115389,8138705,8155133,8155351,8176753,8201599,8234809,8238581,8258753,8272201,8297509,8316649,8329847,8332831,8339441,
+    8389871,8401553,8420933,8448337,8452891,8477283,8480399,8516807,8544523,8550017,8553401,8560357,8609599,8615117,8642273,8675071,
+    8699995,8707621,8717789,8723693,8740667,8773921,8782579,8804429,8806759,8827423,8869751,8890211,8894171,8907509,8909119,8930579,
+    8992813,8995921,9001687,9018565,9035849,9036769,9099743,9116063,9166493,9194653,9209263,9230371,9303983,9309829,9370805,9379019,
+    9389971,9411631,9414613,9472111,9478093,9485801,9503329,9523541,9536099,9549761,9613007,9622493,9640535,9649489,9659011,9732047,
+    9744757,9781739,9806147,9828767,9855703,9872267,9896047,9926323,9965009,9968453,9993545,10013717,10044353,10050791,10060709,10083499,
+    10158731,10170301,10188541,10193761,10204859,10232447,10275973,10282559,10309819,10314971,10316297,10354117,10383865,10405103,10432409,10482433,
+    10496123,10506613,10511293,10553113,10578533,10586477,10610897,10631543,10652251,10657993,10682755,10692677,10737067,10754551,10773529,10784723,
+    10891199,10896779,10938133,10991701,10999439,11096281,11137363,11173607,11194313,11231207,11233237,11308087,11342683,11366807,11386889,11393027,
+    11394187,11430103,11473481,11473589,11484911,11506445,11516531,11528497,11529979,11560237,11630839,11647649,11648281,11692487,11730961,11731109,
+    11758021,11780899,11870599,11950639,12005773,12007943,12023777,12041003,12124937,12166747,12178753,12179993,12264871,12311417,12333497,12404509,
+    12447641,12488149,12511291,12540151,12568919,12595651,12625991,12664619,12689261,12713977,12726523,12750385,12774821,12815209,12823423,12836077,
+    12853003,12871417,12888227,12901781,12999173,12999337,13018667,13055191,13119127,13184083,13306099,13404989,13435741,13438339,13482071,13496749,
+    13538041,13590803,13598129,13642381,13707797,13739417,13745537,13759819,13791559,13863863,13895843,13902787,13955549,13957343,13990963,14033767,
+    14088461,14128805,14200637,14223761,14329471,14332061,14365121,14404489,14466563,14471699,14537411,14575951,14638717,14686963,14742701,14854177,
+    14955857,14967277,15060079,15068197,15117233,15145247,15231541,15247367,15320479,15340681,15355819,15362659,15405791,15464257,15523091,15538409,
+    15550931,15581189,15699857,15735841,15745927,15759439,15878603,15881473,15999503,16036207,16109023,16158307,16221281,16267463,16360919,16398659,
+    16414841,16460893,16585361,16593649,16623409,16656623,16782571,16831853,16895731,16976747,16999133,17023487,17102917,17145467,17218237,17272673,
+    17349337,17389357,17437013,17529601,17546899,17596127,17598389,17769851,17850539,17905151,17974933,18129667,18171487,18240449,18285733,18327913,
+    18378373,18457339,18545843,18588623,18596903,18738539,18809653,18812071,18951881,18999031,19060859,19096181,19139989,19424693,19498411,19572593,
+    19591907,19645847,19780327,19805323,19840843,19870597,19918169,20089631,20262569,20309309,20375401,20413159,20452727,20607379,20615771,20755039,
+    20764327,20843129,20922427,20943073,21000733,21001829,21160633,21209177,21240983,21303313,21688549,21709951,21875251,21925711,21946439,21985799,
+    22135361,22186421,22261483,22365353,22450231,22453117,22619987,22772507,22844503,22998827,23207189,23272297,23383889,23437829,23448269,23502061,
+    23716519,24033257,24240143,24319027,24364093,24528373,24584953,24783229,24877283,24880481,24971929,24996571,25054231,25065391,25314179,25352141,
+    25690723,25788221,25983217,26169397,26280467,26480567,26694131,26782109,26795437,26860699,26948111,26998049,27180089,27462497,27566719,27671597,
+    27698903,27775163,27909803,27974183,28050847,28092913,28306813,28713161,28998521,29343331,29579983,29692241,29834617,29903437,29916757,30118477,
+    30259007,30663121,30693379,30927079,30998419,31083371,31860737,31965743,32515583,32777819,32902213,33059981,33136241,33151001,33388541,33530251,
+    33785551,33978053,34170277,34270547,34758037,35305141,35421499,35609059,35691199,36115589,36321367,36459209,36634033,36734893,36998113,37155143,
+    37438043,37864361,37975471,38152661,39121913,39458687,39549707,40019977,40594469,40783879,40997909,41485399,42277273,42599173,43105703,43351309,
+    43724491,43825351,44346461,45192947,45537047,45970307,46847789,47204489,47765779,48037937,48451463,48677533,49140673,50078671,50459971,52307677,
+    52929647,53689459,53939969,54350669,55915103,57962561,58098991,58651771,59771317,60226417,61959979,64379963,64992503,66233081,66737381,71339959,
+    73952233,76840601,79052387,81947069,85147693,87598591,94352849,104553157
+};
+
+static const unsigned short builtin_prime_product_score_table[PRIME_PROD_TABLE_SIZE] = {
+    166,322,165,310,164,2467,154,2466,163,3325,321,162,3324,2464,2401,161,
+    2465,3314,160,2461,159,2400,320,3323,153,2457,6185,2463,3303,2452,158,3322,
+    157,298,2460,2446,152,3292,156,2398,3321,2462,5965,155,6184,309,2456,3320,
+    2439,3313,2395,2459,2431,2335,2451,6181,3319,3281,2422,151,2391,2445,6183,2399,
+    2455,319,3291,2412,5964,6175,2386,3318,5745,150,2450,6180,3312,3317,297,6165,
+    2458,2438,5961,2430,2380,142,2444,3311,308,3316,318,286,149,6150,5963,6174,
+    3259,5525,3315,2421,2397,2454,5955,148,6182,2373,3302,6164,2437,5960,2411,5744,
+    2449,2365,3310,5945,6178,2429,6129,2334,2394,2453,6179,6101,147,141,3309,6149,
+    5741,2448,2356,2443,3215,2269,5930,2420,2396,5954,3290,3248,3280,2346,6065,6172,
+    2390,2410,3308,317,146,6173,2442,5944,3258,6128,3270,2393,6020,3301,6162,145,
+    3289,5735,2436,2385,5958,2447,6100,5909,2333,6169,6163,2428,2332,5881,5725,6177,
+    316,5929,3307,3300,6159,144,2435,6147,3204,285,3306,2379,6064,2441,2389,6148,
+    2427,5524,2329,2419,307,143,5845,3288,5952,3214,3257,2268,6019,5710,5962,3160,
+    2440,6144,2384,2409,5305,5908,3269,5800,3305,3287,6171,5942,5521,3299,6126,2418,
+    5743,2392,6155,5880,2372,2434,5949,6176,6127,6098,5959,3304,2331,6161,2364,2426,
+    315,2325,2408,3298,3094,6099,2378,5689,140,2433,6168,5939,3286,6123,5740,5927,
+    306,5661,5844,6140,2425,3213,2320,130,6095,3279,2328,6062,6158,2355,5515,2417,
+    2388,6146,5085,5304,2267,5799,3297,6063,3149,6170,6135,274,2432,5953,5924,5523,
+    6017,3247,2371,2345,5625,2407,5505,2416,2383,3285,2424,3278,6018,5906,2314,6059,
+    5742,3159,5935,6160,2363,6119,5734,2387,6143,5943,3237,3284,296,5878,5580,6167,
+    2406,3256,6091,3017,5520,2324,6125,6014,5957,6154,3083,3296,6114,5724,2382,314,
+    5490,5903,2415,6097,5739,2377,139,6157,3295,2354,5920,6086,6145,5084,2319,5738,
+    2423,129,3093,5928,2307,3283,5875,5842,3212,3277,6122,2405,2266,6055,3203,3246,
+    313,2344,2299,305,6139,5915,2203,6108,3282,5709,6094,2376,5522,3158,5797,138,
+    6061,3255,3294,5514,6010,6142,3276,5951,6050,3193,5303,5469,6080,284,2414,2370,
+    2313,5839,4865,2381,6134,262,5899,2263,5733,6124,5956,6016,6153,3236,5441,5907,
+    2413,3254,2362,3293,2290,5504,6005,5732,5941,5301,5871,2404,3006,6096,5519,5794,
+    6058,2330,6166,304,5879,6118,5894,5948,5723,2929,3092,3275,5688,2403,2369,6044,
+    2280,5722,6090,6121,2375,3016,5866,137,3202,6013,5737,6073,4645,5660,6156,2306,
+    5405,2361,6138,312,2353,6113,5729,5938,3253,5081,5489,6093,5999,2265,5835,2327,
+    5926,6060,3211,2830,2298,5843,2259,6085,5950,2374,5083,3226,136,273,128,5888,
+    5360,5708,2402,4864,2343,6133,5295,5719,5513,5790,6054,6015,5707,5830,3192,5302,
+    3157,3274,5860,3210,6037,5798,5624,2352,3148,2254,6141,5940,2137,2202,2368,6107,
+    2262,311,5923,6057,3268,3273,6029,5285,6117,2289,5947,6009,5503,5518,5785,5731,
+    3252,6049,3245,5468,6152,2360,6079,5992,303,5579,5905,135,2342,3138,5934,6089,
+    3015,2323,2367,6012,5704,3251,3156,295,2918,4644,5440,5687,5984,5824,5877,2279,
+    6112,3209,5937,6004,5721,5300,2248,4425,3091,2359,3267,5925,5686,5715,5853,3082,
+    5659,3272,2720,6084,3182,5728,6120,2318,5270,3201,6151,2928,5488,5902,5779,2351,
+    6043,5658,6137,5075,2819,2258,5919,6053,6092,5082,3225,2326,3250,6072,2366,3072,
+    3271,134,5404,5874,5975,3147,5841,5512,3244,5718,5080,2200,6106,3090,2341,5922,
+    5683,5998,2264,5706,2350,4861,2829,6132,2358,5065,5817,133,5623,6008,5700,2253,
+    3208,250,5914,6048,261,3249,2241,6078,2201,5359,5904,2312,5655,2599,4863,5796,
+    6136,5933,5622,5502,5294,5809,3243,3266,3207,5517,2340,5249,294,6056,3235,2233,
+    5467,5772,6036,5876,5578,5838,5509,3137,6116,6003,5695,5946,3155,2136,5298,5898,
+    4424,2261,5703,5221,4855,5577,302,6131,3081,5439,5764,6028,2349,5284,132,6088,
+    3265,3014,5050,2322,6011,2927,5299,2247,5870,5901,5991,3005,4641,6042,5685,5793,
+    5619,5499,5714,6111,2357,5936,3089,5918,2709,5679,5487,5893,3181,3206,5736,3242,
+    6071,4205,4643,2305,2224,5873,5983,2339,5657,131,6115,5840,3200,6083,301,5078,
+    2317,5651,5997,127,2995,5865,3154,5574,5185,2828,3071,2297,5403,5755,2719,6087,
+    238,5511,3013,5913,5674,2321,6052,3205,5269,5079,2199,2214,4635,3264,5682,5834,
+    3127,5795,3146,6110,5074,5292,3985,3199,2348,2257,118,5484,5699,6105,5029,5646,
+    2071,3191,5921,3224,6130,5140,2240,5887,6035,5358,5654,2588,5837,5974,4862,5621,
+    6082,6007,5501,2134,5293,2316,6047,2347,5897,126,5466,5789,6077,5001,5615,3241,
+    2311,5829,5495,4860,2232,5932,5859,2338,5064,6027,5282,2288,5508,2252,6051,5730,
+    5694,4845,2135,5297,5869,3088,272,5990,3004,5668,5438,3153,5792,2598,3240,3145,
+    5576,6002,2337,5283,2197,6104,5892,5570,4421,3198,5516,5784,5248,5610,4204,3061,
+    3263,5982,5640,3080,3152,2278,3012,5618,293,6006,5498,6046,5720,4625,5463,300,
+    5678,2926,4423,6076,5864,5486,5900,2310,6041,6109,5220,4965,4854,5931,2917,4642,
+    3262,2223,5823,5480,2718,5727,5917,5049,5565,5267,5077,3234,2246,5435,5650,6070,
+    5833,2994,4640,2304,4830,5402,5872,5573,6081,3011,5072,3239,3984,2315,5852,6001,
+    125,3171,2336,3765,2005,4415,5673,3180,5996,283,4920,5268,3087,5886,2907,2213,
+    3079,2827,5778,5973,3126,5604,2296,3151,5475,5073,5291,5717,2818,5912,2925,5788,
+    117,5483,3197,5645,5357,249,6040,5705,5828,4858,3238,3086,5184,5858,5633,5062,
+    292,2193,3261,6103,299,124,5916,5510,2133,3190,2198,6069,5465,4634,2597,2303,
+    5399,5559,3196,5614,6034,3150,5494,5836,4859,6045,2808,5063,5281,5816,5459,2131,
+    6075,226,5896,2309,5028,5995,2260,5783,5246,2070,3144,5139,2239,4610,2826,5667,
+    5437,3260,4809,2295,3545,6026,3136,2188,6102,2287,5911,5500,3233,5808,5431,2984,
+    2196,5868,5354,5569,5989,5702,3003,5000,5218,4852,5247,5609,5791,6000,2916,3060,
+    2231,3085,5639,5289,5771,5822,5597,4781,4405,5454,5507,6074,5047,5891,2308,4844,
+    260,5296,123,3078,5462,4201,4422,4638,6033,5684,5981,5219,3195,4853,2277,5713,
+    5851,106,2924,5763,5589,3232,5479,3764,5895,5426,6039,282,4420,5048,5863,5564,
+    5266,4203,3084,5434,5777,5552,4639,6025,5656,5279,3143,5401,2286,2717,4390,5071,
+    5497,2817,5726,6068,2182,3170,3010,4624,2708,2302,5395,5867,237,5988,3002,5485,
+    5832,3194,4964,5182,4589,2906,3070,5069,3981,2222,5544,5603,2923,5994,2256,4745,
+    5474,5890,6038,5076,271,2825,5448,3009,4195,4632,2294,5681,5885,5980,291,5356,
+    4829,2276,5972,4857,5910,4561,5183,3983,5632,5061,5815,2192,5716,5754,5350,6067,
+    5698,2698,2004,5026,4414,2068,2301,5390,5862,5787,4919,5137,3231,5827,122,5420,
+    3116,2212,4633,5653,5857,3544,5059,5398,5558,3125,4700,2716,5620,5993,2251,3189,
+    5290,2807,5807,5264,5458,2130,6032,1939,2824,116,5482,4998,5027,5831,2293,5245,
+    2069,2596,5138,121,2127,3077,5770,3975,3142,2587,2255,5535,2187,5345,5693,4842,
+    2132,3223,5782,2175,2922,5430,2983,6024,5884,5464,5275,3008,5353,4999,2285,5217,
+    5971,4851,5575,5493,3135,5762,4525,5288,3188,5280,5596,3141,5987,3001,5453,4418,
+    6031,5786,5046,5701,5826,4843,2896,2167,4849,6066,4609,2915,2300,4637,5384,5856,
+    2122,5436,4808,2577,5617,5821,5889,2250,5044,105,4185,4622,5588,2707,5677,5979,
+    2195,5425,3007,2245,2275,6023,4419,3050,2595,4962,3230,2284,5413,4202,2823,3059,
+    4480,5712,120,5850,2292,5551,4780,5278,4404,5861,3761,5986,3000,3179,5781,5243,
+    2181,4369,4623,5649,5461,5339,5394,4200,2993,4827,2715,5572,5776,3229,4963,3134,
+    5181,2797,3076,5260,5068,2816,5543,5753,5478,3763,4170,2002,3140,4412,5672,5978,
+    4917,3187,2274,5265,5215,214,3105,3965,5447,4341,2914,119,2158,4631,6030,5433,
+    281,3069,5820,4828,5400,4389,5070,3075,3222,3982,2116,5883,3169,5349,115,2244,
+    2697,2003,5025,5644,4413,5970,2067,4629,5389,5680,4918,2714,5136,2921,4588,5419,
+    3115,5711,290,5377,5849,6022,3980,5255,2586,5058,5814,2283,3139,3755,4744,5473,
+    5697,5825,259,5023,2065,5263,5855,2148,5055,4194,5985,2238,225,3950,4997,5613,
+    5775,5355,2249,5652,3541,4856,2822,4560,3228,2126,2291,5060,5369,2815,3221,2191,
+    5806,5534,5882,2594,5344,4995,5969,4841,2174,4149,4607,5179,5332,5666,5977,2230,
+    5274,3068,4806,4305,3543,5769,5397,2273,4699,5506,202,5780,5239,289,5692,3074,
+    5457,4839,2129,2194,1938,5854,5568,3039,4417,3186,5244,248,5608,2895,2166,280,
+    4848,3227,2920,4608,5324,5638,3974,5383,2121,4778,5813,4807,5761,4402,2713,2576,
+    2186,5696,2109,5211,2061,2593,2973,5043,2913,4621,5134,5429,2237,4198,2982,4260,
+    5819,5352,3185,3049,3535,5216,4961,4850,5412,5040,5616,3929,6021,5496,3073,5234,
+    4524,5287,2243,2282,2687,5805,4779,4403,5452,4619,2706,5676,5045,2101,5563,3220,
+    5242,3133,5848,4959,2919,2999,2229,5338,4199,4636,5768,5968,4826,2221,3745,4387,
+    3178,2796,5259,5691,2821,5206,4835,104,4184,3168,2281,3762,2912,2001,5774,5424,
+    4411,5648,2992,4916,5818,4824,5214,1873,3104,4586,5571,2814,2905,5976,2998,5035,
+    2157,3978,4479,2272,5315,5760,5602,5277,4742,2242,5752,3760,4388,1999,4409,5671,
+    2115,5175,4914,4192,2180,4368,3067,5847,5393,2592,2211,4628,3124,3730,3184,4121,
+    4558,5180,4587,5631,3177,2820,5376,5067,2190,3979,5254,2712,2271,4615,4169,2705,
+    5675,4743,5481,5773,5228,5022,5643,2064,2092,3964,5446,2147,5054,4340,4193,5812,
+    4630,2813,2566,2220,5557,4697,3132,2585,5019,94,3901,4559,2806,5368,5130,2236,
+    2128,2711,5170,1936,5348,288,5647,3525,236,5024,2991,3219,2066,5388,5200,4820,
+    4994,5612,3183,5135,2911,5492,4606,5178,5418,5331,3114,3972,5804,5967,4805,2997,
+    3542,5057,2185,5751,4698,3754,4991,1995,1807,2962,5238,5670,2082,2228,5262,4838,
+    279,5767,1937,3949,4604,2210,3038,4996,5665,5811,3218,3123,4803,3540,5690,5846,
+    5014,2056,4085,2125,5323,4522,5286,3973,5595,5966,4777,5125,4401,3709,2235,2270,
+    114,3176,5343,2108,5210,5642,2060,3510,5567,2972,4840,2173,5607,4148,5133,4197,
+    5759,3058,2591,2996,5273,4304,5637,5803,2584,4775,4399,5039,2812,4986,103,5233,
+    4182,4523,5587,2686,2227,4618,190,5460,5766,2885,4416,2100,5611,5491,5164,2894,
+    2165,4958,4847,4040,4477,3066,5550,2590,5382,3028,2120,5276,2704,3131,287,5477,
+    3758,4386,4955,3865,5042,5205,4834,5562,2179,4183,4366,4620,2219,4600,5664,4259,
+    5432,5758,5193,4799,3048,3534,4960,4823,3217,213,4585,5411,3928,4384,5066,5034,
+    3977,4478,5810,5542,5314,4167,3130,2710,4741,2990,270,5008,3759,2050,1998,5566,
+    4408,5241,5119,5174,5606,4913,3962,2234,4338,4191,3057,4367,4583,5337,2904,5636,
+    3489,5750,2786,4825,3744,4771,1990,4395,5601,2703,5669,2910,4557,4739,2795,5472,
+    4910,3820,5258,5802,4950,3681,2209,4614,2696,4168,2000,3175,4189,4410,247,4980,
+    2218,5227,4915,3216,5213,2091,1872,3103,2226,3113,3963,4339,5765,4555,2156,2565,
+    5630,5056,2589,4696,113,5476,3752,5018,5641,93,2811,2989,4815,2114,5129,5561,
+    5261,3645,5169,1935,3947,3174,2583,4627,5199,3538,4819,5396,5556,5749,5157,3729,
+    82,4694,4120,4380,2124,3065,3971,5375,5757,4905,2805,5253,5533,5456,258,3753,
+    4990,2208,3129,1994,1933,201,2961,3122,5021,2172,2063,2081,4146,4579,2146,5053,
+    2903,5272,3948,4603,4302,3969,178,4802,5600,3539,5149,4735,112,5471,3900,5013,
+    3064,2055,2909,4521,5367,4595,5124,2702,5663,5428,2874,2043,2981,3524,5351,2582,
+    4944,5112,4993,278,2164,4846,4147,4605,4551,5177,5330,2217,5629,2119,3461,4804,
+    4303,4519,2189,2575,5594,4774,3128,4398,5451,1806,5237,4985,5605,5041,5801,4181,
+    3056,4837,5635,4257,4973,1741,224,2035,3037,2884,2951,3047,3532,3173,5555,5104,
+    4690,2225,5163,3926,2908,4476,4084,5322,2804,3425,3027,4776,5748,5455,102,4179,
+    4400,3708,5586,1984,3757,1929,5662,5423,4794,2107,4899,5209,4954,5240,2059,3509,
+    2810,2971,4365,5132,2207,4196,4599,2775,4258,4474,3121,3742,5192,4798,5549,3533,
+    2184,277,5038,5560,5257,2676,3927,4383,5756,5232,3063,2685,4166,5427,235,111,
+    3600,2980,4363,4617,5007,5634,2049,5392,3172,4766,2099,5212,1870,4375,3102,5118,
+    3961,4957,4337,2155,4039,4582,4515,3167,2581,5593,2785,3743,4770,5541,1989,4394,
+    5450,4164,4385,4738,4909,2113,2809,3864,4574,5204,4949,4833,2701,2902,3959,5445,
+    4335,4188,4626,4979,5599,4937,2026,5470,3727,4118,4822,1871,4584,5095,2216,5033,
+    4554,3976,3062,5252,5313,4175,5585,3380,3751,4740,5422,5347,2695,1997,5020,4407,
+    2062,4814,5387,4546,5173,4912,2940,2700,2145,5628,5052,4190,3946,2988,5417,269,
+    4470,4788,5548,3488,4929,3537,3166,5156,3728,3898,81,4693,4119,3749,4556,4379,
+    2215,3819,4904,5747,3680,1977,2178,4359,4613,2901,3522,5391,5554,1932,3944,4892,
+    2016,4992,5226,5598,4145,4730,2090,2555,3055,5176,2206,4578,2803,2987,3120,2123,
+    4301,2564,4760,3968,5540,1675,1924,4695,4160,5148,5017,4734,1804,5532,5236,92,
+    3899,5342,5128,4836,5746,4594,3644,110,3955,5444,1969,5168,4143,1934,4331,2873,
+    5627,3036,2042,3523,4884,2183,4299,5198,4943,5111,4818,4082,2205,4550,3970,2580,
+    3119,2979,4518,3706,5346,2694,4989,1993,2106,5208,1805,2960,2058,3507,5386,5553,
+    2970,4685,2080,5131,2893,109,4510,5416,3112,4256,4972,189,5592,2802,4602,2034,
+    2950,5381,3531,5449,2118,4801,5103,4689,2574,1918,5037,2665,3925,5012,5231,2054,
+    4083,4520,2579,276,3165,5123,4178,3707,4616,1983,1928,3940,2098,4254,4793,4898,
+    3508,268,3529,4956,4568,4037,2900,5410,101,2863,3923,2774,5584,3460,4473,3741,
+    2986,5421,4724,2978,4773,5531,4397,5341,2675,4984,3862,5203,4832,4180,2171,4139,
+    4465,2699,5547,4362,1740,1960,5271,5336,2883,4295,5591,4765,4821,3739,1869,4374,
+    4875,3054,4540,5162,5626,5032,4038,2794,4475,4753,2204,2177,4514,3424,4354,3026,
+    3118,3756,4163,1996,4406,4953,5172,3863,4911,4573,2892,2163,1867,4364,3101,3958,
+    4598,5539,4334,3486,108,5380,2985,100,4155,5191,4936,4797,5583,4679,2025,3726,
+    2573,4117,3053,5094,3817,2801,4382,2764,5443,3678,2112,4326,4174,4612,4165,70,
+    2578,3599,1950,5006,4250,5546,5225,2048,3046,2544,2089,5117,4545,3960,3724,5409,
+    2939,4115,4336,3919,4581,275,4469,4787,5374,3487,3117,2784,4928,2176,2693,4769,
+    4348,1988,5016,4393,91,3897,5385,3748,4737,4908,5127,3818,3164,5415,4948,3642,
+    246,5167,3679,223,1976,4358,3521,107,5051,5335,4187,4978,3943,4891,5538,5197,
+    2015,4817,3735,2852,4729,212,2554,2793,3895,4504,5256,4553,5590,4759,5366,4717,
+    177,1923,3935,5442,3379,3750,4320,4159,4988,1992,1803,2959,3519,2079,4813,3163,
+    1863,257,3643,3954,1968,4142,3945,4601,4330,2154,5329,4883,5530,4800,4298,3536,
+    5340,4533,5155,2692,80,4692,2899,5011,4378,2053,4081,3052,1801,2170,99,4134,
+    4903,5582,5122,3705,4709,5414,3111,4290,1931,3506,3035,4684,3720,4144,4111,4577,
+    4459,4509,3458,5373,5545,4079,4300,5321,3967,4672,5251,1674,4772,4396,3703,1917,
+    2753,5147,2664,4733,2800,4983,2891,2105,2162,2057,3504,267,1911,4593,5379,1738,
+    2144,2117,2872,3939,2882,2041,2572,4253,4942,5110,5529,5161,3528,4567,4036,3891,
+    3051,5036,4549,2862,3922,3422,3025,5365,5537,3459,2169,4517,4664,4128,4245,4723,
+    2684,3045,3515,4284,4952,200,3861,5408,2097,3914,2977,1903,4138,4464,4597,3162,
+    5328,4034,4255,4971,1739,1959,5190,2033,4796,4294,2949,3530,3738,5102,4874,4688,
+    4539,3924,4381,1797,4497,5235,2898,4752,3423,3859,4353,2890,2161,4831,5334,3597,
+    4177,2691,1982,5005,1927,2047,2654,5378,256,4792,4897,2571,5116,2792,2976,3110,
+    1866,4580,4075,5320,3485,2773,5031,2783,4472,3740,4154,4768,1987,4678,5312,4392,
+    3699,4736,4239,4907,3816,4489,2674,98,5207,1858,234,245,3500,5581,4947,2969,
+    2763,3677,4325,5407,2153,3161,69,3908,4186,3598,4977,1949,4361,4249,3483,4764,
+    2543,1868,4373,3723,4452,2111,4114,4552,3918,2897,5230,3814,4513,3377,2683,5528,
+    3675,4347,4655,4611,5333,4162,4812,3715,97,4106,2168,2799,2841,4572,3641,5372,
+    2088,2791,4030,3957,5250,1894,4333,2563,4935,3734,5154,2024,3725,2851,79,4691,
+    4116,4377,5015,4444,5093,90,3894,5536,4902,4503,3855,5202,1852,2143,3100,4173,
+    4716,3934,3378,3639,4319,2152,1930,3518,3886,2889,2160,4816,4313,1862,4544,4576,
+    2938,5364,2975,2110,3966,4468,4786,1672,5311,2570,4927,5146,2533,4732,4532,3896,
+    3747,4987,1991,1800,2958,2798,4133,4592,2643,5171,5327,4100,2078,2690,4708,1975,
+    2871,4357,2040,1884,4289,5371,3520,3942,3044,4890,3479,4941,5109,2014,1792,5406,
+    3109,3719,4728,2742,4110,2553,4548,4458,3457,5010,3810,2052,4078,4516,4758,4671,
+    3671,1673,1922,2142,3034,4158,3702,2752,1802,5224,3503,96,4070,1910,5319,3880,
+    2689,3953,2974,1967,4970,1737,4141,4329,2032,5363,2948,3694,2562,3455,4882,4297,
+    5101,4687,2790,2104,3108,89,3495,3890,2968,4080,3421,4982,4435,5126,5527,4176,
+    4663,3704,4127,3635,1981,5166,4244,5326,1926,1735,3514,4791,4896,4283,3505,266,
+    5196,1845,3099,4683,3913,1902,1786,2151,5229,4277,4508,2772,4033,4471,2682,3419,
+    3024,1916,2663,2096,233,2673,1796,4496,255,4951,95,4025,3858,5526,3596,4360,
+    4064,5318,3938,2653,4596,4763,4252,211,4372,3688,2159,4795,4093,3527,4566,4035,
+    3850,5370,2103,5201,2051,4269,4074,2522,2861,4512,3921,2967,2569,5121,3698,4722,
+    4161,3594,4238,5004,4488,2046,1857,3860,3499,4571,2141,5030,4137,3956,4232,4463,
+    3907,4332,5310,188,3043,3451,1958,4934,4293,2023,2681,3482,2888,265,3737,4767,
+    4873,3873,1986,5092,4391,4538,4451,5362,3107,2095,4906,4751,3813,4172,2568,4352,
+    3376,4946,3674,4019,3474,4654,1731,2881,4976,3714,4105,4543,2840,2937,5160,3805,
+    5325,1865,4224,4029,4467,4785,3666,1893,3844,3484,3042,3415,3023,4926,4153,4677,
+    2789,3374,3746,1779,5223,4443,3815,2087,3854,2762,4811,3676,1851,1974,4324,4356,
+    68,2561,3638,3033,2688,3941,1948,4889,4248,2013,5309,5189,58,3098,2542,3885,
+    4727,2552,4312,2150,3722,4057,5317,78,3106,4113,3917,4376,4757,3630,5165,1671,
+    1921,4901,2632,4157,4346,2532,3590,199,2102,5195,2045,3468,222,2642,5115,3640,
+    4099,3952,1966,4140,4328,1883,4575,3799,4881,4296,3478,3660,2782,1837,3733,3097,
+    1985,1669,2850,1791,2957,2887,2741,2149,4731,2077,3893,5222,4502,3809,2680,2086,
+    3670,4715,3933,4591,2567,4318,2870,2560,2094,2039,3517,4682,4940,2140,5009,1861,
+    4012,88,4069,3879,4507,4547,5120,4215,3693,3454,3624,3041,2731,3370,1915,2662,
+    4531,3494,5361,3837,1799,5194,4810,4434,4132,3634,4707,3446,3937,4288,4251,4969,
+    1734,2031,2947,3526,1844,4565,5153,2886,3718,2139,4981,77,4686,4109,1785,2956,
+    2860,3920,4457,4276,3456,5308,4077,2076,4670,3418,4721,1726,176,1771,2880,3701,
+    2751,1980,1925,2788,5159,4790,4895,3502,4024,4136,4462,1909,3032,3410,1736,244,
+    4063,1957,2511,4292,2771,3040,1665,3736,4872,3687,4092,4537,5145,1828,5316,3096,
+    3889,3792,3849,4750,4268,2521,264,3420,4351,3653,4590,4662,4126,4243,46,254,
+    5188,2038,3593,3440,2966,3513,4282,2085,5108,4762,1864,3912,4371,1901,4231,3031,
+    2559,4032,3450,4152,4676,3585,4511,5003,87,3872,1720,4049,2787,2879,1795,4495,
+    5114,2761,2679,4323,3617,3857,5158,4570,67,3595,4018,1947,3473,4247,2093,1730,
+    2781,2652,2030,3404,232,2965,2946,2541,4933,5100,2022,1818,3095,3721,4112,3804,
+    3916,4223,2138,4945,4073,3665,3843,3414,4345,4171,3697,4975,1979,3373,1778,221,
+    4237,3829,5187,4789,4487,2075,1856,3498,2678,4542,3906,2936,253,3365,4466,3732,
+    4784,57,2849,3481,4925,3579,4004,5002,3892,4450,2044,4056,4501,2672,5307,3629,
+    3812,5113,4714,2631,3932,3375,4317,3673,1973,3589,4653,4355,3516,3467,1762,5152,
+    2780,4888,3713,4761,76,2012,4104,1860,4370,2839,4726,263,4900,4028,3433,3798,
+    1892,3030,3659,4756,1836,4530,1668,1920,4156,3784,4974,1798,4442,4131,2621,5306,
+    3853,4569,1850,4706,4287,1713,3637,3951,1965,2878,1660,4327,2084,5144,4880,2021,
+    3359,3717,2964,3884,4108,4311,4011,4456,5091,2558,4076,3397,3022,4669,4214,1670,
+    2869,3623,86,3700,2730,3369,2750,2531,1752,4939,5107,3836,3501,3609,5151,1908,
+    2641,4541,4681,4098,187,2935,3445,1882,4506,3029,5186,4783,3477,2083,1790,3888,
+    2740,1914,2661,3995,2557,3808,4661,4125,3669,4242,3572,4968,1725,1972,85,1770,
+    2955,243,3512,4281,3936,2074,5099,2011,1654,2963,3911,2610,5143,1900,4725,2551,
+    4068,3878,4564,4031,3409,2510,2859,2779,3692,4755,3453,1978,1664,1919,2868,4720,
+    2037,1827,4894,1794,4494,3493,3791,4938,5106,3856,4433,3652,2677,3633,2770,1964,
+    4135,4461,2651,45,2954,3439,1733,1956,2073,4291,1843,2671,4871,2500,1784,4536,
+    4072,4275,4749,3352,3584,3696,3417,4350,4236,4967,1719,2029,4048,4486,1855,2945,
+    3497,3775,5098,4680,3616,4023,1705,3905,210,4505,4062,3403,3480,5150,4151,3686,
+    75,4675,4091,1817,4449,1913,252,3848,3389,3021,4893,4267,3811,2520,2556,2760,
+    3672,4322,4652,66,4932,2769,3592,84,1946,3828,3712,4246,4103,2838,5090,2540,
+    4563,4027,1696,4230,2670,1891,2877,2858,3915,3449,1647,3364,5142,4719,3578,3871,
+    4344,4003,4441,2489,3020,3852,1849,2934,3564,3636,2867,4460,4017,2036,3472,1729,
+    4924,1955,1761,2953,5105,3883,3731,4310,2072,2848,4535,3803,4222,3432,2778,3664,
+    175,4748,3842,4500,1971,3413,4349,2530,4713,3931,4887,3372,83,1777,4316,3783,
+    4931,2020,2620,2550,2640,4097,3555,5089,1859,1881,4966,1712,2028,1659,220,3476,
+    4150,56,5097,4674,1789,3358,2739,4529,4055,3807,3396,198,3628,3344,2759,3668,
+    1963,4130,2630,4321,231,65,4705,3588,4879,1945,4286,4782,1751,2952,3466,4923,
+    3608,251,4067,3877,3716,4107,2768,3797,4455,3691,34,3452,2876,3658,74,4668,
+    1835,4343,1667,3492,2669,2749,4886,2010,3994,4432,3335,3019,3632,2549,3571,1907,
+    1732,4754,1842,1653,1912,2660,2847,2609,1783,4010,4274,3887,4499,1639,4213,3416,
+    5141,4712,3622,3930,73,4660,2729,4124,3368,4315,4241,4878,3511,3835,4280,4562,
+    4022,209,242,3910,4061,3444,1899,1686,4930,2875,2019,3685,4090,4528,5088,3847,
+    2499,4266,2519,1793,4493,1630,4129,3018,3351,2777,1724,4704,1954,1769,3591,4285,
+    2650,4870,3774,4534,219,2659,4229,2866,1704,2027,4454,3408,2944,3448,2509,4071,
+    4922,5096,4667,1663,3870,3695,2748,1826,3790,4235,3388,4485,1854,3651,3496,1970,
+    4016,1906,3471,2478,1728,44,2857,3904,4885,3438,2009,4718,2548,3802,4221,2767,
+    1695,241,4448,3663,3841,2943,3412,1646,64,2776,3583,4659,4123,1944,3371,4240,
+    1776,2668,1718,72,4651,4047,2539,4279,2488,3711,4869,4102,3615,3563,3909,1962,
+    2837,1898,4026,4747,4877,3402,55,1890,4342,1816,4054,197,4492,4440,3627,2629,
+    3851,1848,1620,3587,2667,3465,2649,3827,2846,4673,3882,3554,4498,4309,3796,2865,
+    2018,2758,3657,3363,1834,4314,1666,63,2658,5087,3577,71,2529,4002,4234,4484,
+    1853,2538,3343,2639,4096,3903,1880,1760,4527,3475,2933,4009,1788,4447,2856,2738,
+    3431,4212,4921,33,3806,2017,3621,22,2942,2728,3367,3667,5086,4650,3782,3834,
+    3710,2619,4101,230,2836,3334,4453,3443,4066,3876,1711,2864,1953,2008,1889,1658,
+    3690,4711,4868,2747,2547,3357,2932,4439,3491,4746,3395,1638,1905,2766,4431,1847,
+    1723,1768,3631,1750,186,3607,3881,1961,1841,4308,3407,2508,1782,4876,1685,4273,
+    2007,4122,2941,1662,4703,2546,2528,1825,4278,3789,3993,2757,3650,1629,1897,2638,
+    4095,4021,3570,43,1943,3437,1879,4060,4666,2537,1652,2608,3684,1787,4491,229,
+    4089,2737,3846,2765,4265,2518,3582,1904,2657,240,1717,4046,2666,3614,4065,3875,
+    2477,4228,3401,3689,3447,4658,2845,1815,4233,4483,208,3869,3490,2931,2498,4430,
+    4710,3902,3350,1896,2656,4015,3826,3470,1727,3773,1840,4446,1703,1781,1952,3801,
+    4272,4220,3362,3662,3840,4867,3411,2006,4526,3576,4001,2648,2545,2855,1775,3387,
+    2835,4020,4702,1619,1888,4059,1759,3683,54,4088,4438,2930,3430,1694,3845,1951,
+    4053,1846,4264,2517,4665,1645,3626,4866,2628,2746,3781,3586,2756,2618,2487,3464,
+    4307,62,3562,1710,1942,4227,1657,3795,2536,239,3356,3656,1833,4649,3868,174,
+    3394,2637,4094,4657,2834,21,1878,4014,3469,1749,1887,185,196,3606,2736,61,
+    3553,3800,1941,4008,4219,3661,3839,207,2535,4211,3620,2727,3366,1774,4490,3992,
+    2854,3833,3874,3342,4306,3569,2647,3442,1651,53,2607,2527,4052,4429,32,3625,
+    228,2844,2627,1722,1877,2655,1767,4482,1839,3463,4701,1780,3333,4271,2735,3794,
+    3406,2507,3655,1832,1661,4445,2497,1824,2853,3788,1637,3349,3649,4058,2745,4648,
+    42,3682,3436,4087,3772,218,2755,1702,4007,4263,2516,60,1684,1940,4210,3619,
+    3581,2726,2534,4437,3386,1716,4045,3832,4656,1838,1628,4226,3613,195,3441,4270,
+    3400,3867,1895,1693,1814,1644,4013,2526,1721,1766,2843,2486,3825,2636,2754,4086,
+    3561,4218,59,2646,3838,2476,3405,4262,227,2506,3361,173,1773,217,3575,1823,
+    4000,3787,3648,4225,41,4481,52,3435,1758,4051,3866,3552,2645,2626,3429,3580,
+    2842,3462,1715,4044,3780,4428,3341,2617,3612,4647,3793,1618,4217,1709,3654,2744,
+    1831,3399,1656,206,3355,1813,1772,1886,31,3393,4436,3824,1748,51,4006,3332,
+    3605,4646,4050,4209,3618,2725,3360,2625,2833,3574,3999,3831,1885,2515,1636,3991,
+    2525,20,3568,2743,1757,2635,1830,1650,1876,2606,1683,3428,184,1765,2734,3779,
+    1627,2616,2524,4005,2505,1708,1655,4208,2634,1822,2724,3354,3786,1875,3647,3830,
+    2496,3392,40,3348,3434,194,1747,4427,3604,3771,2475,1701,2644,50,1714,4043,
+    1764,2832,3990,3611,3385,216,3567,3398,2504,4426,1812,1649,2605,1821,3785,1692,
+    3646,1829,1643,3823,39,4261,2514,2485,1617,3560,2523,3573,3998,2831,183,4042,
+    2495,1874,3610,2723,3347,1756,2733,2513,3770,1811,3427,1700,3551,3778,4216,2615,
+    3822,3384,19,1707,3340,1763,172,3353,2633,3997,3391,1691,215,1642,30,1820,
+    1746,2732,3603,1755,2484,2624,3559,3331,38,3426,3989,3777,2614,49,3566,1635,
+    1706,4041,1648,2604,2623,2512,3550,3390,1682,1810,1745,4207,3602,205,3339,1626,
+    3821,2494,3988,3346,29,3565,3996,3769,4206,171,1699,2603,193,3330,2474,1754,
+    3383,2503,1634,48,3776,2613,1690,37,182,2493,1641,1681,3345,2483,2502,3558,
+    3768,1625,1698,1819,1616,1744,3601,3382,47,3987,3549,2622,1689,2722,2473,1640,
+    2602,3338,2482,3557,1809,18,28,1753,2492,3329,2501,3548,2721,1615,204,3767,
+    1697,1633,36,3337,3381,1680,1743,27,2612,1688,1624,170,3328,17,1808,2481,
+    3556,35,1632,2601,2472,1679,3986,3547,1623,192,203,3336,3766,181,26,1614,
+    2471,2491,3327,1742,1687,1631,2480,2611,1678,16,1613,180,1622,191,3546,2490,
+    2470,15,2600,25,3326,169,24,1612,2479,1677,1621,1676,14,168,2469,2468,
+    1611,23,1610,13,179,12,167,11
+};
+
+static const unsigned short builtin_prime_product_hash_table[1 << PRIME_PROD_HASH_TABLE_BITS] = {
+    2635,2333,2005,3140,45,4165,0,1663,5926,2265,0,0,5905,0,0,0,
+    3086,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    3641,4786,4889,2699,2970,4980,4483,4952,6154,231,293,2677,3037,223,5167,1917,
+    6100,5884,65,3077,5740,4504,1693,5556,2009,3709,6129,0,5422,2749,5399,5578,
+    0,5410,0,5231,2041,1946,5088,2809,1908,5465,0,5796,133,11,4655,205,
+    3457,4768,0,4074,5525,1833,2967,6180,0,3287,5745,6169,0,1976,2235,0,
+    3402,0,2094,5387,5522,3563,3031,1895,1659,0,3150,2216,0,3639,4802,4179,
+    0,0,0,0,4126,0,5486,137,3181,5093,0,0,2703,5963,0,0,
+    0,5182,0,4032,6122,2624,4733,2893,246,4176,86,5852,303,2788,1871,3689,
+    0,0,0,5715,0,306,2306,0,3054,2328,5012,4633,4565,0,0,3554,
+    0,0,5629,0,0,0,0,0,0,4542,2640,4093,3922,0,5152,4561,
+    1628,0,3688,0,4279,0,2461,0,0,0,0,0,4836,3733,0,4563,
+    0,3645,0,4574,0,4798,0,4349,3073,5848,0,4757,0,0,0,3148,
+    0,0,0,1873,0,3087,4369,0,4692,0,0,5493,0,0,0,0,
+    4812,5005,5725,4963,3358,0,3026,5096,5198,3575,6123,0,4803,0,0,3572,
+    3772,3593,0,5187,0,0,4076,0,0,0,0,229,2459,1652,1743,2695,
+    2949,2283,0,0,3190,3524,0,3757,0,0,1796,3338,4223,0,0,30,
+    4667,4776,5055,5414,0,0,0,5854,0,4160,0,2536,0,4696,2994,3907,
+    5864,5393,1632,0,0,2250,0,0,5807,4066,0,167,4075,0,2404,0,
+    0,0,5934,0,3630,6149,2301,3719,1748,2467,0,234,0,0,0,0,
+    3967,5681,0,0,4598,3484,4999,5072,4456,2991,2069,0,2258,1731,151,0,
+    4977,4291,139,202,0,3167,0,0,4663,0,3725,0,2522,2911,15,4280,
+    5775,3059,2546,3289,2937,5707,5370,3369,2892,4948,174,1850,1753,3337,170,2882,
+    3933,5364,1831,4921,3574,6170,2708,5537,3929,1879,3660,1933,4425,32,5534,4091,
+    0,4580,1841,1978,6131,5865,5582,6042,0,299,0,0,4079,0,0,0,
+    1954,3915,4288,3389,0,0,5271,4353,0,2757,0,0,2823,3214,3156,4033,
+    4452,1759,3664,6172,4195,2412,3248,5512,0,0,4630,5146,5871,5764,3972,0,
+    2453,3531,4325,0,0,2829,0,3343,0,5661,1745,5590,2264,2828,3947,5625,
+    3910,3836,270,4983,1678,5203,4779,258,0,2816,0,5937,3246,2195,2897,6151,
+    4308,282,0,0,6045,0,5577,4728,4910,0,0,6139,2219,6101,0,0,
+    0,0,4928,0,0,0,0,4356,4366,0,4878,3855,2874,3896,5899,5174,
+    6127,3043,2493,2405,0,0,0,0,0,3491,3506,1741,0,0,1643,0,
+    5099,3731,5955,1719,2811,2969,3990,3453,5666,129,5054,4428,2313,2437,5626,3318,
+    220,4028,5478,4841,6166,5705,3024,4641,136,0,5906,2489,0,0,4974,238,
+    0,0,4949,0,4267,3927,4327,0,5716,0,0,3234,0,0,0,0,
+    4700,0,0,0,0,0,0,0,4217,3884,1729,4155,2140,5010,0,5543,
+    0,0,4098,4382,2891,3451,0,0,0,4289,0,0,0,2562,5294,4053,
+    2735,0,0,0,5976,2288,6054,2951,2479,5568,0,0,0,0,0,0,
+    5746,0,0,0,0,0,2705,3903,0,0,0,0,0,0,0,2007,
+    2886,0,0,2480,5246,0,3197,0,4578,0,0,0,0,4397,0,5519,
+    0,3517,3704,3771,5327,0,145,1762,0,0,5731,5901,4105,2784,3894,256,
+    5593,3617,3729,5912,0,2701,5969,1844,0,0,0,0,0,0,4956,4937,
+    0,1667,5299,5649,5564,0,5037,6038,4293,0,0,0,0,3886,4659,5811,
+    0,0,0,2653,3601,3566,4052,3011,0,0,0,0,0,0,0,0,
+    2710,0,0,0,0,2732,0,0,0,0,4858,2824,1617,6146,0,0,
+    0,0,0,0,3576,0,4389,77,2903,0,0,2473,3959,3120,4884,0,
+    0,0,3001,0,4844,0,3240,0,0,0,0,0,0,5762,0,2190,
+    0,0,0,0,0,1836,0,0,0,0,1814,4320,1624,4358,3468,3964,
+    0,6119,5458,1703,0,5171,0,0,0,6008,0,0,0,0,0,4292,
+    5228,0,4254,2938,4514,5268,3117,4929,0,3339,3427,4038,2445,0,0,0,
+    240,298,0,0,0,2905,5788,0,0,3953,3628,6140,2683,5610,4676,0,
+    0,5627,0,0,0,1970,0,0,4807,0,0,1672,1893,0,0,0,
+    0,0,5230,4250,5297,0,1860,0,3124,4046,0,0,1926,4107,3707,0,
+    1636,5159,5487,206,3913,0,6023,4783,0,2637,3069,0,2337,5018,2790,0,
+    0,5826,0,0,5149,0,0,0,2754,0,6014,3715,4531,0,5463,1880,
+    2004,0,5752,4753,2968,2078,3476,2515,2297,2487,0,0,5604,0,0,235,
+    0,0,5461,5939,5735,0,0,5953,0,0,0,0,0,265,4720,0,
+    2373,0,0,0,6032,5183,2295,0,4049,0,4558,5947,0,0,0,0,
+    0,4951,2778,87,0,6051,5497,0,1892,319,5384,3616,1633,0,2055,6135,
+    5620,2334,4631,259,4281,3741,0,5494,0,0,0,5728,0,5677,2832,0,
+    2838,1804,4903,4813,0,0,5967,0,5917,309,0,0,4784,4806,5714,0,
+    0,0,2756,0,0,0,4859,0,0,0,0,0,3443,0,3412,0,
+    5317,6075,5120,4380,3341,0,0,0,3448,4418,0,2912,0,4177,4587,0,
+    0,0,0,2801,0,0,0,5485,2285,3021,4229,3029,2659,3306,3647,4025,
+    4278,140,4214,0,0,0,3882,1638,0,3558,2450,5814,0,5532,3058,0,
+    0,0,0,5407,0,0,0,4969,0,5845,3623,4219,3271,263,1967,2428,
+    5754,0,4210,5300,4182,4521,3299,0,0,0,0,5528,2888,3589,3003,0,
+    3436,0,0,2833,0,0,13,3408,1706,5324,4178,3762,4508,5583,0,6047,
+    4814,0,0,0,146,4285,1942,4892,5433,5783,5862,2980,0,5337,0,3815,
+    3356,2657,0,0,4759,3425,14,5043,1808,5281,3663,5303,5605,4379,3752,2267,
+    3446,2011,0,0,6175,2054,3172,4850,2737,0,0,3536,2257,0,0,5502,
+    4166,3361,4213,0,4311,4946,5786,3694,0,3350,0,0,0,0,4510,0,
+    0,2835,0,0,1790,0,3560,4269,2715,0,1671,2102,1968,0,23,0,
+    0,0,0,158,4520,4073,0,1800,0,3330,5218,4698,0,0,0,3143,
+    5254,5015,3559,3996,2584,4394,4886,3872,2998,2366,0,0,0,0,5850,0,
+    4475,1688,0,0,3282,0,0,3254,5600,1791,0,0,6085,5121,0,0,
+    0,0,0,0,3649,2024,2950,3820,0,0,3586,0,0,0,0,0,
+    0,0,0,0,2112,3236,5617,4007,4173,90,164,2782,0,0,0,172,
+    2698,6037,2959,5733,1910,1621,2885,2177,2091,2966,4457,3009,1901,4206,3141,0,
+    0,1739,5315,5424,3211,1774,5169,0,0,5319,0,0,3826,0,0,0,
+    0,0,0,0,0,1827,5329,5193,5621,153,0,2351,5368,0,5240,2586,
+    5290,5081,4825,99,0,0,0,0,0,0,3220,0,0,2554,0,0,
+    0,2666,0,6167,3697,5575,0,0,4734,0,4527,2152,3091,2365,0,5020,
+    5756,3673,2484,5094,5002,48,0,2454,2318,4732,5134,3122,5377,4122,4673,4404,
+    2814,2087,0,0,0,3527,6168,0,2876,4664,0,0,4242,0,5566,3038,
+    0,2243,0,3608,4925,0,0,3637,0,0,0,0,4231,3032,5805,4433,
+    0,5172,3674,5343,2322,0,0,0,0,0,3828,0,0,0,0,0,
+    0,0,0,0,0,3264,0,2580,0,0,0,3377,0,5931,3345,2063,
+    3260,0,2649,0,6143,0,0,5247,0,1778,0,2794,2138,2881,0,5513,
+    4315,3580,4408,49,3326,4055,2543,5190,5151,283,2034,3919,0,0,1964,3534,
+    5238,5737,3266,4184,4154,0,0,0,5046,0,2212,4919,2514,5768,1769,0,
+    2343,0,3060,0,0,4205,0,4550,3785,5806,2173,2987,182,2841,1773,0,
+    0,2812,3269,0,0,0,0,0,0,0,3970,0,2775,1864,5821,0,
+    322,3201,4629,218,1722,5948,4554,3900,3424,1922,171,5221,4605,5003,5124,1612,
+    0,0,1676,2806,4748,183,0,4863,0,0,0,0,0,2510,0,0,
+    4149,3515,5886,2797,1732,3918,0,0,3314,0,3937,1647,0,5222,5071,2575,
+    4265,75,0,0,0,0,3291,0,5490,0,0,4848,1711,4736,70,0,
+    5351,3280,2871,5696,301,5340,2014,0,0,2989,149,1669,56,4896,2316,4261,
+    18,5758,4888,278,0,5978,0,0,0,211,6088,3716,0,0,0,0,
+    3668,0,5799,0,0,4127,3611,0,3940,2118,2109,27,2409,4368,5492,3650,
+    0,0,0,2875,0,0,0,3595,0,2636,5229,0,0,4596,0,0,
+    0,0,2434,0,0,4461,4714,0,5974,0,2099,0,3553,6145,0,0,
+    2345,3712,0,0,2146,0,0,0,2551,3835,2186,2943,4532,3379,2451,3131,
+    2840,294,3098,3633,3538,2296,3821,3904,242,0,0,0,0,5766,1707,2166,
+    0,0,121,3308,2577,3938,3460,0,2222,4489,0,4731,0,0,0,3489,
+    2211,4790,1783,4942,5538,2696,2402,81,4024,5130,0,0,6113,0,3713,0,
+    2924,2520,5900,0,4526,2530,4835,0,0,2494,0,0,3249,0,0,4478,
+    0,5345,0,0,0,1816,0,6066,2641,2241,0,0,0,0,2189,0,
+    3227,0,5023,0,5996,269,0,2097,1961,6044,264,3012,4516,5047,1680,3354,
+    5879,4988,0,3311,4801,28,2780,67,4534,4944,5795,94,6109,5127,5943,4162,
+    4064,6132,1626,5501,2038,5844,5638,2513,5488,4227,3033,2669,3233,3322,3811,2448,
+    3790,4710,3690,0,281,267,3565,0,0,0,2457,3109,5227,0,3259,3634,
+    4972,0,5647,37,0,4407,3085,141,5314,0,0,0,0,0,0,0,
+    4623,0,4332,5263,0,5572,3923,0,5972,5867,2348,3502,4144,2567,6093,245,
+    3360,5679,0,3732,0,0,4646,59,0,0,0,225,2727,1685,1921,6043,
+    4296,2455,6095,3747,5683,2031,1949,279,0,3414,0,0,2392,0,5412,3547,
+    0,1987,0,5834,0,4588,0,0,0,3094,3301,0,54,3235,0,0,
+    0,209,0,0,0,0,3658,1648,0,3858,0,5633,0,0,2849,3347,
+    0,3042,2988,2244,0,255,4754,4502,2592,2772,0,4132,4463,2095,1936,3632,
+    0,0,5079,0,0,0,0,0,0,0,0,5765,3734,0,0,0,
+    201,5914,2672,5808,4141,4130,5569,0,0,34,4528,1749,0,194,0,0,
+    1843,5163,4998,249,3495,0,4965,0,0,102,3226,1885,0,5670,0,0,
+    5000,2433,79,0,0,0,2906,4059,4262,5019,116,4995,4147,0,4345,0,
+    0,0,0,0,0,0,2081,0,0,0,0,0,0,3999,0,0,
+    3626,2213,2900,0,0,2068,0,5244,4717,2771,5988,4699,0,0,2997,6185,
+    0,0,5041,3262,0,0,3272,0,2403,2879,0,4454,0,4657,5293,0,
+    4371,5585,0,5928,0,5851,0,3047,2910,5276,4087,4762,4567,4271,2356,5824,
+    3619,0,0,4034,0,0,0,0,0,0,0,0,80,122,0,4985,
+    0,3064,0,3512,0,2117,0,165,4411,3390,3418,2555,3724,5066,5938,4615,
+    3397,1782,0,0,0,0,4713,6086,0,4971,0,0,3520,0,1948,3675,
+    2085,4880,3313,0,3753,0,6161,0,5474,1653,3253,0,307,2665,3133,4445,
+    0,2843,0,0,113,2652,2946,0,2397,0,0,0,3239,0,2483,5057,
+    0,0,3459,3525,2163,1935,0,3485,0,0,0,0,0,0,3486,4751,
+    6148,2535,6152,0,5644,3413,2150,3816,0,0,3615,2820,2643,4642,3048,1939,
+    0,5331,6104,5694,3065,0,0,6046,1898,292,4334,3677,5429,0,5634,3518,
+    2690,0,4855,0,0,0,2501,2043,3991,5405,3794,2178,0,1674,0,1849,
+    4273,63,3231,4788,6050,3917,2291,4201,3415,2504,0,0,1845,6118,4608,4989,
+    5052,0,3997,6061,2207,3789,5376,4970,0,0,0,0,2411,0,4295,0,
+    0,5129,0,0,0,0,2681,3082,1751,2135,5477,5261,0,0,3564,2456,
+    4708,82,3530,2273,5831,5275,0,4512,0,2210,5794,3055,2606,2458,4417,5813,
+    5249,5056,4373,1916,5830,4473,3800,5655,44,5366,3422,4595,4976,0,177,4686,
+    4661,4816,0,2430,3985,0,4258,4503,2332,2002,127,0,4367,0,5918,0,
+    0,4837,125,3044,4833,120,195,3847,2762,6013,3002,5544,5237,4536,1755,4245,
+    2935,1792,0,3123,0,5310,0,4901,0,2745,0,3591,0,0,4496,0,
+    3435,4331,0,4220,4014,1750,5823,5563,3487,1915,3210,2477,4194,5103,5567,4609,
+    0,3215,0,0,2232,5434,4843,2954,3629,4958,5462,2533,5723,0,2030,0,
+    0,0,2046,4695,1670,3442,3888,3992,0,2171,5602,0,3723,5371,4750,0,
+    2080,3433,5650,0,3067,3841,5464,3297,20,0,1757,5413,64,4990,3384,4697,
+    4747,5935,5504,0,2655,5013,0,0,0,3763,0,0,2281,3305,4626,4678,
+    3625,4010,0,1677,0,4099,5196,3456,0,0,0,3245,2890,5983,4276,0,
+    0,0,0,0,3416,1616,0,0,5278,5695,5267,2476,0,5891,5911,0,
+    5516,5833,2523,3198,4388,3667,5173,0,271,4787,0,0,0,0,0,2721,
+    5029,0,3885,0,4509,0,4590,2420,3805,1882,2083,4050,4926,0,0,5115,
+    1666,0,3808,2362,2246,0,0,5358,0,4918,0,0,5531,0,4964,5197,
+    5686,6083,4612,5325,156,3775,0,4752,0,0,0,0,5648,6159,4912,117,
+    0,6177,4670,4270,0,5673,2642,4582,0,0,4704,6110,0,0,5654,3631,
+    4735,2410,2572,152,0,0,5258,3119,0,5105,0,0,4391,6165,0,0,
+    2549,3244,3778,1740,2644,5201,5495,5518,0,0,0,1834,0,1848,1856,0,
+    4443,3644,0,0,4656,4745,0,0,0,3579,5606,4908,5632,0,4395,1704,
+    0,0,2401,0,3588,3568,4426,4772,0,0,3921,6002,0,6157,162,0,
+    4400,4902,0,5168,1695,2439,4604,0,4535,4978,0,0,4885,0,0,0,
+    0,0,0,0,0,2105,0,0,0,2310,0,1799,0,0,3483,1738,
+    0,0,0,0,0,0,0,0,0,0,0,0,4853,0,3204,0,
+    0,0,2958,0,0,2894,0,0,0,4458,3007,1983,0,4188,5404,5576,
+    0,3773,5873,0,0,0,4555,3473,5748,1953,5318,0,4982,0,0,0,
+    2482,1940,4706,1735,5672,5491,5468,3505,0,0,3285,0,4485,3053,2340,3363,
+    0,4870,5755,0,5419,5849,2406,5989,2221,2481,1950,1787,3711,3827,2460,4749,
+    5904,4153,0,0,104,3230,2131,5858,0,0,5710,2581,2010,0,3068,2594,
+    0,0,5415,5546,0,3158,0,0,1725,3036,0,0,0,0,0,5829,
+    2815,0,0,0,192,3203,2862,0,0,1810,0,2394,0,5898,3499,0,
+    3066,0,0,0,4094,0,0,0,2416,4940,2399,5524,0,0,0,0,
+    0,5138,4437,0,5192,3388,5383,5832,0,0,0,0,1847,5662,0,0,
+    0,0,0,5265,3278,4868,0,0,4616,4303,0,1746,5177,0,4755,4991,
+    0,0,0,0,0,2517,2266,3444,0,6121,0,5669,0,0,2077,5949,
+    2632,0,5104,0,0,0,3371,0,0,0,4172,0,5730,0,0,2311,
+    5257,1863,4593,5913,3257,4255,4666,4041,4907,5651,5868,1620,4876,3867,4975,2225,
+    0,0,3653,2670,0,6005,2192,2527,3958,0,5771,3138,2512,4726,3108,0,
+    0,0,0,0,5449,4142,5700,3774,0,0,2679,0,0,0,3891,5825,
+    0,1974,5437,0,5252,1618,0,0,3328,0,0,3375,0,0,2776,2598,
+    0,3944,5009,2254,5339,5539,4434,4401,3400,5612,2357,2573,0,2927,3013,0,
+    2948,2850,0,0,0,3100,0,4344,2617,2922,4455,2308,2415,3787,2686,4763,
+    193,0,0,5397,0,0,0,0,0,0,0,3679,0,91,0,1710,
+    4941,0,0,0,0,0,4163,1960,0,6072,0,0,0,0,6071,0,
+    5843,0,3602,3465,5687,288,0,2191,2604,5341,3949,2383,3193,0,5506,2070,
+    0,0,4712,3103,0,4761,4359,0,0,5693,0,0,0,1965,6076,0,
+    0,0,1902,3759,0,5039,0,0,310,2783,3302,0,0,0,0,0,
+    0,0,0,0,0,0,1894,0,3916,130,0,0,0,0,1646,0,
+    0,3079,3105,0,96,0,4351,0,3174,4552,3357,2233,1865,4792,5874,1852,
+    4650,4067,4589,0,0,2227,4546,4119,0,2312,6182,3844,0,0,0,0,
+    6022,0,2503,0,0,0,1641,4770,3839,0,0,5373,0,260,0,5586,
+    4035,0,5975,0,0,0,4435,0,5053,3286,4577,3407,0,3463,2056,0,
+    0,0,4679,1943,0,4405,5296,3945,0,0,0,0,0,3974,4564,2524,
+    4338,3776,0,0,3104,0,6087,3971,4984,0,5870,0,5916,0,1861,3865,
+    0,2432,1705,0,0,4376,5895,0,0,4436,0,0,0,0,0,6078,
+    0,4688,3180,2521,5326,0,1754,0,5547,0,0,0,0,0,4652,0,
+    5334,3176,5678,2556,2462,6018,5142,5077,1622,74,0,0,2971,5875,2725,0,
+    0,5981,0,0,0,0,0,0,5828,3106,2358,0,4419,0,5722,2226,
+    2277,0,0,0,0,0,4621,0,0,0,5878,5809,6059,0,6060,4316,
+    2625,4186,0,5562,0,0,0,0,0,0,3592,4932,0,2560,5400,0,
+    2553,0,0,0,4157,2761,4282,5332,304,5204,4600,0,4036,0,3606,3189,
+    4029,6006,0,0,0,1781,0,0,0,4360,2639,0,0,3168,4721,2909,
+    0,5511,0,0,0,0,5721,0,3979,4239,0,6102,5188,3935,4893,5880,
+    2098,320,2847,5074,0,3398,5986,0,5116,103,2039,5045,0,2269,5611,2687,
+    0,0,268,2731,2977,0,0,0,0,0,0,0,0,0,5291,3362,
+    4365,1771,3200,2051,3062,3786,3676,0,4973,5436,4627,2290,0,0,0,6126,
+    5338,3854,3078,4420,88,1971,2660,3130,0,3481,5140,3901,0,4653,4011,5006,
+    5500,2960,4705,2851,4869,6004,2090,0,4693,0,0,3196,232,4020,0,0,
+    3403,2359,3008,0,0,0,0,2331,2228,4236,2729,0,2307,2249,0,0,
+    16,0,0,1956,0,0,4566,3860,2578,6082,5386,0,5667,0,4207,4994,
+    5311,5658,5223,5456,5702,1822,2327,1993,40,0,4834,0,1887,4048,5995,0,
+    5660,4789,3720,3497,0,0,0,5529,2286,6130,6117,4465,0,1900,4810,0,
+    3823,4592,1966,0,0,0,0,4727,0,6058,2930,4339,0,3829,2181,0,
+    0,0,6021,0,0,0,0,0,0,2813,2101,0,0,0,2748,4498,
+    0,3756,4441,4711,2156,0,3975,0,0,5044,5466,5872,1793,4804,3683,4027,
+    2023,0,0,0,0,0,0,0,4780,4148,4838,0,1736,5411,3700,161,
+    3905,2773,2107,0,2353,0,0,0,0,0,0,0,1649,2350,0,5126,
+    98,0,2022,0,0,0,0,4135,4811,2115,0,0,2183,5599,2300,0,
+    0,4831,0,0,0,2845,0,5336,0,3113,0,2984,0,0,3438,6162,
+    3014,5301,5803,4386,3946,0,4474,4323,0,4398,1909,5724,0,0,0,0,
+    3348,3522,5727,0,4022,19,0,0,4493,0,4403,0,3535,0,2062,0,
+    0,199,2661,0,3303,4375,2165,1905,297,6156,5248,2202,1997,2956,159,5394,
+    4906,5279,3209,5417,0,1657,6001,0,6063,4012,1857,5070,3792,2371,4824,4193,
+    5932,5162,0,0,0,3950,0,5421,0,0,0,0,3447,3831,2379,5861,
+    0,5954,3242,0,3542,0,2414,5966,2608,0,4101,5941,0,5635,0,0,
+    0,4114,3383,4112,0,4513,0,0,39,0,0,0,4476,0,0,0,
+    5191,0,0,0,2187,0,2292,3562,5907,3114,0,0,0,0,119,1991,
+    0,315,2360,3960,0,0,1982,2021,0,5812,3955,2979,3931,0,4934,142,
+    0,3496,0,5479,0,2141,5561,6115,4252,2744,5416,2113,4423,2647,3268,2490,
+    0,2431,4286,2519,5521,3521,0,4294,5447,5106,2673,0,5761,0,6027,2931,
+    0,0,5533,3880,3316,0,5401,0,51,5587,2859,190,0,0,0,3678,
+    3550,6073,5645,0,0,0,4490,0,0,3336,0,5704,4668,3549,4247,2271,
+    0,3962,6098,2193,0,0,0,1716,2385,4393,0,0,0,3142,0,0,
+    5791,5842,0,2182,0,3862,0,6028,0,0,5892,5565,2965,5855,3194,0,
+    0,0,0,4060,2305,5579,0,3691,0,5063,0,0,213,0,0,5143,
+    4200,5306,4372,5789,6142,2444,4672,5430,0,0,0,0,0,3607,4635,3801,
+    2855,3546,22,1854,0,5782,5689,4385,132,2739,4916,2620,5145,0,0,0,
+    0,0,0,0,4146,0,0,0,0,0,0,1820,2001,0,2154,1890,
+    2941,1819,2044,0,3102,4719,1734,5482,5382,4718,3005,203,5389,1903,4275,5441,
+    2218,3346,2860,0,5179,2449,5688,5959,0,6099,0,1870,5484,2323,0,0,
+    0,6064,2777,0,2452,0,0,5333,1899,4864,4819,1938,4581,0,1907,0,
+    5288,2805,4943,247,3015,5391,1789,69,3842,6133,0,4383,2272,4479,5767,5108,
+    0,2709,3508,5990,0,2247,0,2168,3019,3936,2253,2803,5592,4827,2842,0,
+    2126,4468,5597,0,0,251,2330,2282,2597,6144,0,0,4378,2396,0,0,
+    3265,254,0,0,4541,61,3666,3961,0,3295,0,0,2712,2060,5549,5781,
+    0,1927,0,3063,1931,3187,0,4690,3057,3281,0,5691,4687,0,5136,5073,
+    0,4392,0,0,0,3327,5881,0,0,0,0,3370,3818,3925,4481,3661,
+    2169,5128,0,0,2136,0,5859,0,2500,0,0,0,2615,4671,4297,0,
+    3160,5708,0,0,0,0,0,0,5379,3573,2981,5457,4062,0,5361,0,
+    47,0,4406,3804,5109,2929,227,2955,0,6026,3603,4290,2417,1918,3764,5282,
+    2662,3367,6141,3251,6179,3404,3528,5155,5439,138,200,2139,5646,3256,2534,4211,
+    1730,150,3750,0,5840,3657,3557,5021,4347,0,0,0,0,0,0,4361,
+    5741,285,2804,2336,2898,3744,3097,3440,4917,2111,4362,3462,2993,2585,5993,4054,
+    4537,4865,0,0,0,3315,0,0,3332,313,2447,2793,4818,0,4277,0,
+    3552,4640,2901,5542,4491,3420,4557,2626,2387,4654,1906,2276,0,0,0,0,
+    0,5909,2463,0,4450,0,0,0,5915,4005,5102,0,0,2953,6174,0,
+    3582,6128,0,0,5929,5269,5122,5603,0,0,0,0,0,0,3802,1919,
+    2600,0,0,3598,4820,0,4190,2518,4572,3213,5505,0,4891,0,0,0,
+    0,0,3769,0,0,0,0,0,2630,1744,5014,0,0,0,2008,0,
+    0,0,0,5380,0,0,0,2194,0,1650,0,4472,4113,4549,2736,110,
+    0,0,0,4225,3090,4544,5153,0,3115,0,4799,0,0,5527,0,2887,
+    3739,2963,0,3876,3516,5139,4082,5049,2817,3385,2676,3604,4313,0,4584,0,
+    5098,2116,4004,4336,5945,2084,5738,3577,6057,6116,4249,2436,3471,6062,5701,1972,
+    5362,2346,3509,4305,29,2347,0,2913,2753,3735,3976,3472,4080,3695,0,3192,
+    191,5692,0,2317,3010,3532,0,0,4208,5423,3651,4606,4057,2172,4703,4744,
+    3596,0,5676,3740,0,1989,2133,4777,1701,4000,5744,2026,4237,2770,6019,2352,
+    0,6017,0,4469,5863,5194,2248,5964,3784,5287,286,2990,0,0,0,3000,
+    0,5685,0,0,0,3493,0,0,5596,2908,1637,2723,4597,239,5309,0,
+    0,0,0,2607,4872,0,0,5957,2837,0,0,0,6041,5176,4431,0,
+    2718,3984,0,3241,3693,4674,0,4317,0,3845,4967,4109,4823,5459,2714,5068,
+    0,6125,0,0,5185,2488,2622,5473,0,3680,3083,3978,5958,262,2491,5042,
+    4343,4100,2377,4817,2492,0,4085,0,2384,4322,0,0,0,5847,0,3594,
+    21,3325,0,4044,0,0,0,3682,4760,0,0,0,295,0,0,0,
+    2389,3022,272,3969,4795,296,2006,4765,5030,3132,2252,5675,0,0,3478,3510,
+    2303,0,0,5283,4263,6097,0,2877,0,5636,5853,0,0,4518,0,0,
+    5589,4477,0,0,1656,0,0,0,5618,2895,0,1912,212,4202,4545,0,
+    0,6120,0,0,0,2321,0,0,0,0,0,0,0,1805,3503,3380,
+    4170,4335,3461,5427,0,4651,24,4175,3179,5713,0,0,5292,68,0,0,
+    3151,4164,0,0,1696,0,4181,0,0,0,0,0,0,4894,2027,0,
+    0,3824,4643,0,5350,0,5027,4871,1797,0,0,0,0,2541,0,3049,
+    0,0,5703,0,5770,2015,4306,3825,3898,92,5166,2176,0,2822,5927,3669,
+    0,4013,2561,3139,0,0,0,0,0,5919,0,0,4484,0,2939,3809,
+    0,1784,0,0,0,2704,0,2422,0,0,0,0,2865,2284,0,0,
+    0,0,2016,0,0,0,3569,0,0,5857,0,0,6065,5026,2650,5819,
+    0,4669,3127,1896,5438,3298,6000,4039,4413,0,0,1996,2259,0,0,0,
+    3405,2755,2127,0,5035,5374,0,0,0,3837,3856,1752,5581,5040,3391,4409,
+    0,4689,0,2203,5822,0,3911,1889,0,2419,1835,0,0,0,2427,0,
+    4097,0,0,2759,4414,0,3545,2648,0,5426,0,5133,0,0,0,0,
+    1733,2319,0,0,1691,3513,2381,0,5025,4992,0,0,2236,0,5609,2919,
+    4938,4030,1700,0,4117,2827,1715,5255,0,4037,0,0,0,5750,314,0,
+    5091,5321,0,4935,3871,2716,4264,4861,2702,4259,287,4530,0,4459,4867,5330,
+    2147,2836,0,1721,6138,0,0,0,4725,5467,3879,2654,1802,1994,0,2370,
+    4947,0,3355,0,0,0,0,0,5157,0,2215,0,0,0,0,1645,
+    3165,3166,0,0,0,3137,0,2559,2516,0,1962,4960,1958,3374,214,0,
+    0,0,3539,1914,2129,0,4680,0,1815,5711,4639,1697,0,3620,6056,3458,
+    2599,0,0,0,2298,0,0,3170,0,2544,0,2557,0,2621,3730,274,
+    5274,4174,2646,5836,3581,1858,0,0,0,0,3868,3419,0,2067,0,0,
+    3494,2114,4624,4471,4815,0,5903,4881,0,2240,0,3312,0,5719,4913,1851,
+    1886,2985,0,0,2151,3290,0,0,2158,0,3430,3329,4467,0,0,4480,
+    0,144,5517,0,1999,6090,0,0,1866,0,5893,0,0,0,2808,2758,
+    2656,3696,0,6003,2774,2326,0,0,3084,3754,1824,3372,2497,5962,1821,1812,
+    2342,3544,1806,5239,0,0,2907,0,4681,0,5189,0,0,0,257,3159,
+    0,0,5161,0,4857,0,0,5729,1709,5550,0,0,3909,0,0,0,
+    0,3838,5452,4095,1613,0,2746,25,0,97,4950,0,4996,4585,4684,0,
+    0,0,0,3238,0,0,4224,5022,2719,2952,4421,2162,5940,2618,0,6153,
+    2923,305,0,3074,0,0,5316,3843,0,0,0,0,0,0,0,0,
+    0,1840,0,0,2446,5180,1872,1842,5390,4377,0,4495,2538,0,5780,5663,
+    1698,0,2000,5680,0,2413,0,0,4854,4900,4092,2065,3670,2472,3982,0,
+    4136,6053,4444,5076,5591,233,0,6136,3989,5570,0,0,4209,0,0,3320,
+    0,3659,1625,71,5773,2915,0,2610,0,4124,3171,5671,3382,0,0,4442,
+    3511,0,3662,2315,78,2531,5763,2220,2583,3288,2082,3185,2380,3296,0,2209,
+    0,0,6096,0,0,4158,0,4677,5979,0,3030,0,2148,2299,0,5624,
+    1723,2570,0,0,4256,2684,5089,0,4507,4204,4737,4968,4355,4108,0,0,
+    3075,5273,2743,0,3890,2957,0,2928,3112,2763,2914,0,4051,0,1932,0,
+    0,3121,0,5747,0,3052,3096,2638,0,0,0,5199,0,0,0,5523,
+    2028,3116,2633,5860,0,0,0,5885,5800,0,173,4579,4415,2262,2314,5164,
+    5110,0,4570,0,3699,2119,5184,5075,4006,0,0,0,0,0,0,0,
+    3793,4374,3225,4241,5720,3551,3878,5980,0,0,5205,3788,1925,2658,2045,2145,
+    3340,0,0,0,0,5398,5698,0,126,0,5372,2613,5616,0,0,5251,
+    0,62,5062,3766,0,0,5548,6134,6081,0,0,0,0,0,2134,2579,
+    0,0,0,0,3684,3186,312,0,3410,3857,3749,0,1635,0,3523,3135,
+    0,0,2268,2861,0,0,0,0,0,0,0,0,0,2100,0,0,
+    5213,4648,3092,0,5460,0,4307,5080,0,3504,2485,3892,2588,0,0,0,
+    2591,3039,0,0,2933,0,2204,0,2338,4460,0,0,0,0,0,0,
+    0,0,0,0,4134,0,0,134,4111,5058,0,0,5048,4002,0,3780,
+    0,0,4402,0,0,2995,0,5551,3153,5498,0,0,0,0,0,0,
+    1911,4464,4540,2408,1630,4180,3590,5992,0,0,2469,4138,5515,2602,3957,0,
+    0,6035,0,0,0,5086,0,277,4412,0,0,169,3365,0,6112,0,
+    4890,4691,3046,2124,2616,1969,5665,4636,2962,5069,4620,3025,5084,0,4882,4603,
+    0,5835,4462,5181,0,0,3228,4860,3613,5712,2807,4568,3182,0,5359,0,
+    2088,0,1874,4758,0,3618,5977,5214,5455,4724,5352,5757,0,114,0,0,
+    5150,2017,0,2664,4440,0,1708,3376,0,1867,3145,0,3219,3705,5210,4121,
+    0,0,2369,0,3605,3671,3819,4548,204,0,4523,0,2973,0,0,2663,
+    4168,2407,2752,4895,3373,3072,176,4189,2037,5622,2853,3221,3571,4875,6024,2242,
+    3965,2568,5509,5684,5097,2722,5160,5367,1973,0,2902,0,5472,0,0,3861,
+    4429,0,0,0,0,0,0,0,0,2349,0,2468,0,0,5594,3851,
+    2185,3261,2161,3665,0,0,4081,1780,5256,0,5308,1610,5349,4842,4040,0,
+    0,6070,0,0,0,0,0,0,0,0,0,0,1986,3184,0,0,
+    0,0,0,1828,0,5810,3814,108,0,2707,3866,0,0,0,0,0,
+    0,5111,0,0,4773,2197,2740,5952,0,5454,0,1654,0,0,189,4576,
+    0,0,5774,0,2018,0,2925,76,1888,5100,2058,5101,5008,58,3099,4287,
+    0,0,0,3654,2179,0,0,3324,0,0,0,317,0,4662,0,4583,
+    0,1979,0,0,0,0,0,3335,0,0,0,2821,5114,0,5304,0,
+    4341,5215,4396,4849,5266,3263,2899,4920,0,0,0,0,4145,3169,0,2061,
+    3273,3359,2786,2093,2205,2103,5451,5598,4702,0,5772,2441,0,0,2053,0,
+    284,0,4922,0,0,2511,3692,4923,5639,4559,0,0,0,1884,0,0,
+    1928,1742,0,0,2596,0,0,4364,4221,188,0,1963,2231,0,4466,0,
+    3027,3500,0,0,0,0,3267,0,2668,5846,1795,0,3906,3519,5001,0,
+    2525,0,4115,4738,4260,219,6079,3897,3717,3126,0,5200,4852,4161,5260,0,
+    0,0,2671,0,0,2992,3850,4569,0,2764,5388,1859,0,5178,2471,2234,
+    0,6049,0,180,0,0,0,2395,3452,4879,0,0,276,0,0,2121,
+    5984,0,3224,4961,0,4298,0,0,4840,2724,2548,0,0,0,2542,0,
+    4026,0,0,2873,5348,6069,4191,1644,4151,0,6052,280,2765,4543,0,0,
+    4016,0,3393,4192,1694,4185,3870,0,3948,5158,1699,1825,0,0,5059,2720,
+    0,0,4300,0,0,2856,0,3466,0,4847,3889,0,4898,1998,5653,1952,
+    0,0,0,0,2270,0,5320,3993,3125,3799,0,1891,0,5726,4234,3597,
+    0,0,0,4997,2217,0,3344,0,0,5406,1788,5450,0,0,0,5369,
+    0,6105,4363,2144,0,4846,4061,5896,3294,2831,0,2498,0,0,0,0,
+    0,4102,2918,0,0,4424,0,3293,2529,0,5078,2047,4614,0,2612,4986,
+    5838,5302,0,0,0,2869,1658,0,0,3205,0,0,3006,4333,5921,0,
+    1809,5225,0,4993,2611,4522,0,0,0,5971,0,0,0,0,3173,0,
+    0,1728,0,1985,0,0,4042,3041,0,0,0,0,2470,0,3223,4387,
+    3687,5356,0,2889,0,5507,0,0,4272,0,0,4370,0,4529,0,0,
+    4632,17,0,0,4874,5631,244,0,0,2019,0,1984,186,6158,6178,3599,
+    3968,0,4354,0,0,3548,0,0,1818,2074,4216,3812,3050,0,2206,0,
+    0,0,2274,0,3020,4453,4826,3726,5259,5827,241,93,5328,5165,4741,2438,
+    5560,0,0,0,2917,5375,2830,3748,5619,4043,0,3188,4658,0,5024,5212,
+    0,1611,3423,5973,5894,5902,0,4809,0,0,0,0,0,0,5090,0,
+    4139,3128,5295,85,5793,2164,3134,0,0,0,4525,0,1747,0,5216,0,
+    1924,2996,4591,243,4137,3089,5409,4511,2167,5739,5540,2048,4830,6009,2075,5156,
+    6147,1786,0,3454,3333,4945,0,0,6036,5706,4936,1702,3807,1798,2239,4330,
+    4715,4845,5776,0,0,0,0,0,4104,0,3399,2614,2064,5514,0,5508,
+    3275,5440,5224,4133,2263,1813,0,1995,0,0,2787,0,0,0,5131,2825,
+    2779,6033,261,2155,2390,2526,0,184,5877,4274,3401,3541,4500,0,4430,5982,
+    0,0,0,0,0,0,0,2574,0,5004,0,3154,3428,3243,0,4215,
+    2223,0,0,0,2368,5630,0,0,0,0,0,0,0,0,0,4326,
+    2066,5031,5285,5643,3881,1811,2275,0,2418,3334,5312,3988,208,4203,1945,1878,
+    3852,0,2768,3450,53,5007,289,1977,0,0,2682,3570,0,0,0,3417,
+    55,4063,3728,6040,5085,4599,0,1675,0,0,2609,0,6084,1664,0,2076,
+    6020,5628,3434,0,3247,2623,0,5642,0,0,3252,0,5743,5910,2565,0,
+    0,0,3474,0,2025,4116,0,0,3578,4248,0,1823,3237,5245,0,3157,
+    2157,84,2325,0,1941,4634,95,5418,0,321,3304,4966,163,4905,0,6034,
+    4447,73,0,5987,0,3656,0,0,4422,0,0,5790,2499,2692,0,0,
+    3652,0,0,0,0,0,5869,0,0,2689,0,0,1772,2587,5289,2760,
+    0,0,5573,5749,5545,4709,0,0,6108,128,1764,2920,3342,0,3834,1904,
+    0,0,0,0,100,2122,3017,3070,0,2496,4707,3718,4304,1807,0,0,
+    2486,0,1662,5699,3755,0,0,0,0,0,0,0,0,308,0,5968,
+    5496,3490,2713,3543,3034,3703,6106,5050,6181,2059,5118,4887,2867,52,2287,2742,
+    0,4660,2426,0,5559,3883,3609,0,0,4438,2464,3994,5385,0,4023,2363,
+    0,5220,4785,3258,0,0,0,0,4257,0,2289,0,3895,4314,0,3977,
+    0,0,4644,0,0,5470,4090,0,0,250,0,0,3624,4931,0,0,
+    2072,42,0,291,1615,2391,0,0,0,5866,5815,0,0,0,0,3147,
+    4238,0,0,0,0,0,0,0,4602,0,0,0,0,4742,3743,0,
+    2978,0,0,5856,0,4486,6055,0,0,4601,0,3277,0,109,5119,4451,
+    0,4675,0,1913,0,0,0,0,0,210,5998,0,0,0,0,2376,
+    0,0,5481,1803,0,1837,0,5536,5448,1724,0,0,0,1690,0,5908,
+    2796,4031,5141,4233,6010,5243,179,4538,3951,3686,3795,4594,0,0,0,5690,
+    3439,0,5890,0,0,3323,0,0,4009,5475,3319,3321,4301,175,0,0,
+    228,3023,0,1839,0,5469,2344,3352,181,31,3636,2767,0,0,2866,0,
+    157,0,0,3111,2552,0,0,0,1897,0,6176,0,0,0,0,2159,
+    0,6137,0,5558,3745,2936,2293,0,1957,0,5946,3162,0,0,5965,0,
+    0,4482,89,2224,4222,0,4899,0,3381,0,2132,2781,4243,4246,0,5360,
+    5476,1838,4769,4086,3798,2421,1720,2125,4723,4774,3212,166,4399,5125,3488,2691,
+    0,1777,0,1756,2092,0,4571,0,2339,2883,4562,4089,5664,6012,4796,4384,
+    0,0,5816,3080,5709,0,0,0,2364,5092,0,0,2096,3482,2424,2870,
+    0,0,0,0,0,0,0,0,2789,4131,0,2986,0,0,4645,3229,
+    112,3973,0,0,2153,0,5353,4924,0,0,0,0,0,3274,0,0,
+    3621,0,0,0,5920,3833,5431,0,5064,0,0,0,0,0,3368,0,
+    0,3782,0,0,0,5933,0,2509,2728,3501,5032,5392,0,0,2378,4625,
+    3479,3817,4939,0,5357,0,2603,0,6030,3529,4199,4310,0,0,3467,5432,
+    1883,1951,3396,2309,2329,3088,0,5065,4930,3760,3152,0,5483,3222,0,2532,
+    1990,0,0,0,3638,0,5802,0,3643,3255,3912,6025,0,4685,2921,0,
+    0,0,0,5571,0,0,0,0,0,4268,3045,0,4167,4957,2184,2569,
+    3758,207,5637,2868,5446,4077,3445,3217,4150,2694,3998,3830,5607,3614,3864,4607,
+    1776,0,3455,5837,0,3437,3840,0,0,2582,0,4069,0,0,2629,0,
+    2142,3701,2678,4123,1713,3893,3199,3351,2799,0,4001,0,6124,6080,0,0,
+    3806,3409,5186,1689,4617,3232,4228,2680,5924,4140,115,5408,1875,4125,4084,5732,
+    5280,3283,5535,0,3395,1923,5355,2208,0,5036,5428,0,2188,4143,5016,6068,
+    2880,0,0,0,224,6077,0,4449,5985,135,3270,38,5209,3708,5553,5211,
+    0,0,4756,3118,0,0,3928,0,0,0,2766,5107,0,0,0,0,
+    0,0,0,0,197,0,0,4647,0,0,0,0,0,5028,3387,0,
+    0,0,0,5944,4793,4851,0,0,0,4410,2999,4766,4506,0,1846,0,
+    0,4169,3642,1955,3056,4068,0,3561,0,3635,0,0,0,0,0,0,
+    2180,3963,2033,3300,4909,3076,1623,3392,1651,5923,3848,2400,2747,6031,4328,5970,
+    5305,0,4212,6015,0,5613,3567,3727,0,0,0,0,2631,0,4120,5234,
+    0,0,2049,2013,4839,0,0,3738,0,1920,5778,3081,3627,0,1826,4539,
+    0,0,4302,0,0,2854,2926,0,2589,3587,0,252,3206,2537,5236,2238,
+    2341,6164,0,0,0,0,0,0,0,0,3742,2198,0,0,2564,0,
+    0,0,0,0,0,3995,0,0,5787,3514,0,0,0,0,5112,0,
+    5897,0,0,0,0,5217,0,1683,0,4427,4740,1714,4519,0,5346,60,
+    5354,0,4767,1717,0,3218,2465,0,3061,3441,0,302,0,5232,0,0,
+    2367,1673,0,0,0,0,6048,3853,0,1655,3980,0,3646,4350,3421,0,
+    0,196,3144,0,0,0,0,2478,2320,0,0,2802,0,0,5087,0,
+    2593,2079,2237,4775,5930,3983,5017,3737,3655,311,236,5999,1944,2706,3429,5253,
+    5557,5674,0,5067,5792,4829,3781,0,0,4470,2440,2386,0,0,0,0,
+    5961,3902,5554,3939,3480,0,0,0,0,3016,0,0,0,0,4524,0,
+    0,0,4071,5202,0,0,0,0,0,131,4822,1981,3722,2388,2818,2940,
+    0,0,1765,3987,4021,3202,2073,4152,0,0,0,0,221,0,0,0,
+    5623,237,2502,4337,5277,3051,1801,0,2878,2571,4954,1988,3146,2528,3207,5991,
+    0,5994,0,0,3648,0,0,4187,0,0,0,0,0,0,0,0,
+    0,4198,1661,1681,3942,2506,5797,2863,1634,3934,0,2086,2846,3177,5777,2505,
+    5241,2214,0,2934,4088,4018,0,2550,5588,0,50,2972,0,0,4340,4866,
+    168,0,5936,0,5471,4794,0,5956,3832,5284,1832,2474,3746,4128,4497,0,
+    2852,3163,2982,3411,5882,3470,1629,1770,0,5555,0,5147,0,2375,0,0,
+    0,4003,3797,0,4106,3386,3164,2324,5595,5272,0,0,5697,5365,3284,0,
+    123,5798,248,4357,0,0,0,0,0,0,0,0,5883,3349,3216,3930,
+    5818,4987,0,0,0,0,2003,0,0,5219,0,0,4665,6011,266,4746,
+    0,5033,0,0,3966,2256,5876,4240,0,0,0,2279,0,0,0,0,
+    0,5242,3791,3028,0,0,4329,1767,4008,2128,0,0,0,0,3310,0,
+    0,5113,0,0,0,0,0,0,0,0,5601,0,0,5323,5530,57,
+    0,198,1929,0,0,0,0,0,3943,2651,4183,6091,0,0,3822,5942,
+    0,3908,0,2627,0,1779,0,1631,0,5574,0,3941,0,2108,3110,4096,
+    5347,0,0,0,0,0,0,0,2576,1712,0,0,5206,0,5887,5363,
+    0,0,0,0,0,0,0,4586,5839,3498,4953,2675,5344,2104,46,2040,
+    0,4533,2872,5736,2429,105,4045,226,0,4883,0,0,0,2372,41,36,
+    0,4722,66,5226,4730,0,4342,3612,3721,4791,3394,3432,0,0,2974,2052,
+    0,0,0,0,2398,1761,0,0,0,5503,0,2826,5734,0,0,2795,
+    0,5208,2726,4352,1760,1660,1726,5270,0,0,0,5175,2810,5117,0,0,
+    0,0,0,0,3583,0,3175,0,5262,2884,5132,3366,0,0,0,0,
+    0,0,3681,0,2791,2260,2032,5250,3107,5489,4487,2354,2733,5154,4416,2688,
+    101,0,0,5235,6007,5614,0,1785,1768,0,0,0,0,0,216,0,
+    6114,0,0,0,2844,0,0,0,2645,4683,148,2605,2029,2200,3507,3378,
+    0,0,3585,0,0,0,0,0,5657,0,4251,3986,0,0,0,6092,
+    2199,5342,5435,2634,4797,1830,0,0,0,0,0,0,5841,2734,3331,4808,
+    1766,0,4312,2442,4959,2012,0,3475,0,4070,0,2143,0,0,4618,0,
+    0,4197,0,0,0,0,0,0,4575,0,0,0,4318,4873,0,2507,
+    2904,0,0,0,5640,0,1727,0,3932,1758,1763,6183,0,0,0,5580,
+    316,1869,290,3954,1980,3672,5083,5641,4637,4821,3710,1679,5322,318,1975,3178,
+    3533,5784,3846,5402,2693,5011,2120,2563,4649,0,0,2916,0,0,2294,4324,
+    5123,3796,275,0,0,4729,3767,4828,5615,0,0,0,3873,0,0,0,
+    4501,5420,0,0,2685,0,0,0,0,5233,0,0,4348,0,0,3956,
+    4622,3761,4619,6184,1930,5820,5960,2443,4015,3849,4078,4156,0,3040,2393,0,
+    2130,2619,5584,2035,222,6107,6039,3813,4553,1692,5526,4610,4266,5335,5051,3768,
+    3555,0,3095,2123,4432,3736,3877,0,2106,3406,5480,4232,4439,0,1737,3770,
+    217,0,0,0,2942,5170,0,0,4494,0,0,0,1876,3869,2819,0,
+    3364,2751,0,83,154,4129,6150,2280,0,0,0,0,0,4058,4017,3449,
+    2961,2717,5950,2839,4927,3537,5520,0,1937,2738,215,4694,5652,2769,0,2251,
+    0,3783,0,0,0,4083,0,4981,3469,4230,6094,2435,147,2174,4253,6074,
+    4283,2302,4218,0,2110,3622,0,3803,0,5779,3600,0,0,0,185,1862,
+    2361,5144,4505,2932,0,4448,1639,0,0,0,5442,4047,0,0,2674,0,
+    0,0,0,0,0,0,5889,0,2595,3875,0,4299,3779,2711,2382,3926,
+    6016,4515,118,0,3863,3610,106,0,0,2304,0,6111,5682,5922,2475,3464,
+    0,2423,1829,4056,0,0,3924,2355,3426,1877,0,0,0,3250,4979,0,
+    0,5951,3353,2730,0,0,3317,0,4103,4517,0,5443,6171,0,0,6029,
+    4739,3477,4781,1619,1794,4235,5148,0,0,0,0,0,5403,0,3307,4110,
+    0,5445,6155,5925,4904,3981,2545,4556,3526,5082,5453,178,0,1614,4488,5381,
+    2976,4560,2857,4196,3155,1687,3136,5742,1682,12,111,6160,2495,3004,5378,3899,
+    0,0,4716,0,0,4962,3195,1684,0,4611,0,3208,1665,2848,3765,0,
+    2201,2798,0,0,3887,0,3702,0,1718,0,2089,0,0,0,3071,5753,
+    6103,0,0,0,3777,2036,6067,5804,4832,4381,0,0,0,0,0,0,
+    3279,0,2944,2566,2170,0,0,0,0,0,2800,0,0,0,5656,2042,
+    2741,0,0,5060,3018,5195,0,4613,0,3698,0,0,0,3584,5541,0,
+    2508,124,0,0,4319,2261,2697,0,5510,155,5759,4446,0,0,0,0,
+    2335,3810,3640,3093,1868,1817,2628,187,0,0,2667,0,0,4800,0,1640,
+    0,0,2229,0,2245,0,3191,4911,4547,4072,0,0,2750,33,0,5307,
+    5659,4628,0,0,0,5425,1686,35,0,5769,4065,0,1992,2700,0,0,
+    0,3129,0,0,1853,0,0,4284,5608,3276,4244,2590,300,0,0,0,
+    4682,72,5552,2792,0,5718,0,0,4743,0,6163,143,0,0,0,0,
+    4019,5444,0,0,5061,0,3101,0,1934,0,5137,2858,2425,107,2558,0,
+    5286,253,1959,0,0,3706,5095,3874,0,0,4805,0,1881,4778,4764,0,
+    2964,4309,2149,0,0,0,0,0,0,3149,4771,0,0,0,0,0,
+    0,3952,5207,4897,0,4782,0,2601,2020,4638,3540,2196,0,0,5298,0,
+    1627,3492,2539,5888,5135,0,3309,0,0,1668,5264,4877,0,0,0,0,
+    4914,2983,0,3751,3920,0,0,0,0,0,2175,0,0,0,2057,0,
+    5395,0,0,0,0,160,2278,0,0,0,0,0,0,5751,4321,6173,
+    2137,2230,2864,0,0,0,0,4862,0,4159,2466,4390,5668,0,3431,0,
+    0,0,0,6089,5717,0,2374,0,273,4118,4955,5313,3556,0,5396,0,
+    0,0,5034,0,3859,4499,4492,2947,4573,0,0,5801,4701,0,0,0,
+    3685,2975,2540,1855,0,5997,0,5817,0,3161,0,0,0,0,0,5038,
+    2896,3035,0,0,0,26,3914,0,4171,2547,0,3292,0,0,4856,0,
+    4346,2945,0,2255,0,0,4933,0,0,230,2160,0,0,43,4226,2834,
+    0,0,0,2785,1642,1947,1775,3183,0,0,4915,0,4551,3714,0,0,
+    0,0,0,2050,2071,0,5785,0,0,0,0,0,0,0,5499,5760
+};
+
+static const unsigned short builtin_prime_product_displacements[1 << PRIME_PROD_HASH_BUCKET_BITS] = {
+    0,0,1,1,0,1,11,0,3,0,11,2,2,0,0,0,
+    3,0,3,1,1,0,1,0,3,3,2,0,2,1,1,0,
+    0,0,0,1,3,1,4,1,4,1,4,0,0,0,0,0,
+    0,16,0,4,0,0,2,2,0,2,3,0,1,0,5,0,
+    1,0,2,0,0,0,0,1,2,1,2,0,0,4,3,1,
+    0,0,0,1,0,0,7,3,0,8,7,0,14,0,3,8,
+    0,0,9,2,0,1,0,0,4,0,0,0,1,0,2,0,
+    2,4,0,0,0,0,1,1,0,0,5,0,0,0,1,3,
+    0,1,0,4,2,2,1,0,0,0,0,1,2,4,0,0,
+    4,1,10,0,0,0,0,6,0,0,0,3,0,3,0,0,
+    2,0,0,3,0,0,4,0,0,3,0,0,0,0,0,2,
+    1,2,0,0,3,0,0,0,0,6,1,0,0,1,0,0,
+    0,0,0,0,7,0,0,1,0,0,0,2,0,0,0,0,
+    0,0,0,0,0,18,0,0,2,7,0,1,0,2,0,5,
+    0,4,2,0,1,0,0,0,0,0,0,1,0,10,1,0,
+    0,3,0,0,0,3,0,0,3,10,0,0,2,1,0,1,
+    2,3,2,4,3,4,0,2,3,0,5,2,1,0,2,0,
+    0,5,0,1,4,0,1,2,0,0,0,26,0,1,0,0,
+    2,1,1,5,0,3,1,5,0,0,1,1,0,1,2,0,
+    8,0,1,9,4,0,7,2,0,0,3,3,0,0,2,0,
+    0,0,0,2,3,0,3,6,0,0,2,1,3,0,0,3,
+    1,0,0,1,6,0,1,0,4,2,7,0,3,1,2,3,
+    4,14,0,8,5,1,2,1,1,0,5,0,4,0,0,8,
+    0,0,0,0,2,2,0,9,0,1,16,0,1,2,8,9,
+    0,0,1,3,1,0,0,5,2,0,2,0,4,3,0,0,
+    0,6,5,0,4,0,0,0,7,1,18,2,2,0,8,0,
+    0,5,2,8,0,0,0,0,2,0,0,0,5,0,1,0,
+    5,0,0,0,0,0,0,7,0,1,14,1,0,2,0,4,
+    0,0,0,0,1,10,0,0,5,0,2,0,3,4,0,3,
+    0,9,0,3,0,0,0,9,0,0,0,6,5,0,18,1,
+    8,4,0,4,0,0,0,1,1,0,3,2,1,1,0,0,
+    0,0,2,5,7,0,2,7,3,1,8,2,0,2,2,2,
+    17,2,1,0,1,0,1,2,0,0,1,1,4,1,4,2,
+    0,0,0,4,0,0,0,4,9,0,3,1,0,3,6,1,
+    0,0,0,0,8,1,0,0,4,0,2,0,1,0,0,0,
+    0,0,0,1,0,9,5,0,1,3,1,0,0,4,17,0,
+    6,6,2,1,0,0,0,1,2,4,0,0,0,1,16,1,
+    1,3,0,1,1,0,0,1,0,0,5,1,0,0,0,2,
+    1,3,0,1,1,5,0,6,0,1,1,6,4,0,4,1,
+    0,9,0,0,1,8,5,1,1,0,0,0,6,0,2,4,
+    1,1,1,5,0,4,1,3,0,1,1,0,14,0,0,3,
+    0,0,10,2,0,0,0,3,1,0,0,0,1,0,1,0,
+    0,1,0,0,0,1,3,0,1,0,0,1,4,1,0,0,
+    1,8,0,2,2,0,4,1,0,0,0,0,0,0,0,4,
+    0,0,18,0,5,0,0,1,0,0,0,2,1,11,8,2,
+    0,0,4,4,2,1,4,7,6,0,2,19,0,0,5,0,
+    4,17,0,0,0,5,3,2,2,0,3,1,0,0,4,0,
+    0,1,1,0,2,0,1,3,0,7,1,1,2,0,2,2,
+    0,0,17,2,1,3,1,0,0,1,1,18,0,2,0,2,
+    0,1,4,7,0,0,2,0,1,2,14,1,3,0,2,0,
+    0,2,0,0,0,2,7,2,2,0,0,0,0,0,0,0,
+    0,0,12,0,2,0,1,2,0,7,2,1,1,1,0,2,
+    0,0,8,0,0,2,0,1,0,5,2,3,0,2,3,14,
+    0,0,0,1,9,2,2,2,6,0,1,2,2,1,1,0,
+    0,1,2,6,8,0,0,0,3,1,0,0,1,3,0,6,
+    0,0,0,11,2,0,0,0,10,0,0,0,0,1,0,0,
+    11,2,0,1,0,1,3,0,0,0,2,1,2,2,0,0,
+    1,0,0,1,0,1,0,1,4,1,9,0,2,1,0,2,
+    1,0,2,0,5,0,1,5,0,20,0,2,0,0,1,11,
+    0,8,0,0,0,0,0,0,1,0,6,1,4,1,16,0,
+    1,2,14,0,4,6,0,8,4,2,1,0,4,2,8,0,
+    0,1,2,2,2,0,4,1,0,2,0,1,0,6,0,0,
+    10,0,1,0,1,0,0,0,5,0,0,1,0,0,15,4,
+    0,0,2,0,0,1,3,0,0,6,2,16,4,2,0,0,
+    1,8,10,0,0,1,0,11,3,1,0,0,12,3,1,1,
+    0,1,1,0,2,2,1,3,0,0,2,0,0,0,0,1,
+    0,7,0,0,4,0,1,3,0,0,0,11,1,1,11,1,
+    0,0,0,0,2,4,1,0,0,6,1,4,1,0,0,2,
+    2,11,1,8,1,0,1,1,16,0,4,1,0,1,3,0,
+    0,33,4,2,0,0,4,1,4,3,5,9,0,3,1,3,
+    0,1,2,5,5,6,4,4,4,0,2,0,5,0,9,7,
+    3,3,0,1,0,13,0,1,7,0,0,0,1,1,0,5,
+    2,1,1,0,0,0,16,0,0,4,9,0,1,16,0,1,
+    6,6,0,1,1,0,0,5,6,1,0,0,1,2,3,3,
+    0,10,3,1,16,2,0,21,32,2,1,3,0,1,1,4,
+    0,0,9,7,3,4,2,0,12,0,0,1,1,0,0,3,
+    0,0,1,1,2,0,2,0,5,0,1,8,3,0,1,1,
+    5,0,13,0,3,0,4,18,0,3,0,1,0,1,1,1,
+    14,6,0,1,1,3,2,3,3,0,0,4,9,1,7,9,
+    0,2,0,13,6,0,2,0,16,1,6,4,2,1,4,16,
+    0,0,8,8,2,0,0,0,2,0,0,0,3,11,8,1,
+    2,11,1,1,13,5,1,0,2,1,0,0,2,1,1,4,
+    2,0,0,1,3,1,12,0,6,2,1,0,1,2,3,20,
+    1,0,2,3,0,0,0,3,4,3,6,9,0,18,1,1,
+    0,0,6,4,0,0,3,1,0,0,0,4,0,10,8,1,
+    0,19,4,2,0,0,3,0,8,0,0,5,0,1,10,0,
+    1,2,0,2,0,3,2,0,1,6,3,0,0,12,1,0,
+    1,0,2,1,1,0,4,1,0,1,18,2,5,0,6,1,
+    0,8,18,3,1,2,0,1,0,4,1,0,6,1,1,0,
+    1,5,2,8,2,0,5,4,6,6,0,2,2,1,0,7,
+    2,2,0,1,14,0,0,0,4,2,8,0,0,1,1,0,
+    1,0,0,14,0,5,1,1,2,3,1,0,1,2,0,1,
+    0,0,5,3,1,4,2,0,0,7,1,0,0,6,2,1,
+    0,2,9,1,0,6,0,4,2,2,0,3,6,2,0,8,
+    6,0,1,0,7,2,0,0,4,0,0,1,10,2,10,2,
+    3,3,0,1,0,0,5,4,0,1,0,0,4,2,9,0,
+    1,0,0,0,9,9,0,0,16,6,4,2,12,6,4,3,
+    2,4,4,0,0,2,2,0,0,1,0,6,3,5,8,1,
+    0,1,3,2,1,2,6,1,1,3,0,0,1,0,1,0,
+    0,0,0,1,0,0,0,0,1,8,3,2,0,3,3,2,
+    0,2,5,8,3,1,0,0,0,2,0,4,0,0,5,1,
+    0,0,5,0,0,1,2,2,1,1,2,6,1,0,3,1,
+    0,1,2,1,0,0,0,0,8,3,0,2,4,0,4,0,
+    2,0,1,0,0,5,0,1,0,1,32,0,0,1,0,0,
+    0,3,0,2,2,1,5,4,10,0,18,0,0,3,0,0,
+    4,0,0,2,0,3,4,6,0,3,0,3,9,0,0,0,
+    1,1,11,0,10,1,0,3,1,2,0,1,8,0,1,2,
+    1,3,0,0,3,0,4,32,0,6,15,0,2,1,2,2,
+    1,12,0,0,0,1,0,0,0,1,1,5,1,0,3,5,
+    2,1,0,0,1,1,4,0,0,1,7,1,11,16,0,3,
+    0,2,1,1,3,3,0,0,1,1,0,0,2,7,20,0,
+    0,7,3,9,2,0,3,0,0,1,8,0,5,0,4,1,
+    1,0,2,1,1,7,5,4,1,5,2,0,1,6,6,4,
+    0,25,1,0,9,5,2,0,0,1,2,0,0,0,5,2,
+    4,0,0,2,0,0,5,0,0,1,0,2,2,1,5,4,
+    7,3,0,3,0,2,4,0,9,0,0,0,0,1,1,0,
+    16,2,31,2,2,1,3,2,1,2,2,0,1,1,0,11,
+    0,3,0,13,0,5,2,3,0,3,3,1,2,3,0,6,
+    5,1,0,13,1,12,0,5,2,0,0,0,2,4,13,0,
+    24,0,0,18,3,6,1,3,0,0,3,0,11,13,5,11,
+    12,0,1,1,3,14,0,0,0,8,0,3,1,0,2,3,
+    5,0,2,0,2,0,0,1,1,0,1,2,2,0,9,1,
+    4,0,1,3,3,2,9,11,1,1,2,0,0,2,0,0,
+    0,1,1,2,0,2,23,1,0,1,0,8,9,44,2,0,
+    4,0,0,1,1,8,0,1,0,21,1,2,6,4,5,0,
+    13,4,0,2,35,4,2,1,1,5,3,1,0,1,6,1,
+    3,1,3,10,1,8,0,0,6,2,5,7,1,2,4,4,
+    2,6,0,3,2,0,0,16,2,3,3,4,4,11,2,4
+};
+
+static const unsigned short builtin_flush7_table[FLUSH7_TABLE_SIZE] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1599,
+    0,0,0,0,0,0,0,1598,0,0,0,1597,0,1596,8,8,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1595,
+    0,0,0,0,0,0,0,1594,0,0,0,1593,0,1592,1591,9,
+    0,0,0,0,0,0,0,1590,0,0,0,1589,0,1588,1587,1587,
+    0,0,0,1586,0,1585,1584,1584,0,1583,1582,1582,7,7,7,7,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1581,
+    0,0,0,0,0,0,0,1580,0,0,0,1579,0,1578,1577,9,
+    0,0,0,0,0,0,0,1576,0,0,0,1575,0,1574,1573,1573,
+    0,0,0,1572,0,1571,1570,1570,0,1569,1568,1568,1567,1567,8,8,
+    0,0,0,0,0,0,0,1566,0,0,0,1565,0,1564,1563,1563,
+    0,0,0,1562,0,1561,1560,1560,0,1559,1558,1558,1557,1557,1557,9,
+    0,0,0,1556,0,1555,1554,1554,0,1553,1552,1552,1551,1551,1551,1551,
+    0,1550,1549,1549,1548,1548,1548,1548,6,6,6,6,6,6,6,6,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1547,
+    0,0,0,0,0,0,0,1546,0,0,0,1545,0,1544,1543,9,
+    0,0,0,0,0,0,0,1542,0,0,0,1541,0,1540,1539,1539,
+    0,0,0,1538,0,1537,1536,1536,0,1535,1534,1534,1533,1533,8,8,
+    0,0,0,0,0,0,0,1532,0,0,0,1531,0,1530,1529,1529,
+    0,0,0,1528,0,1527,1526,1526,0,1525,1524,1524,1523,1523,1523,9,
+    0,0,0,1522,0,1521,1520,1520,0,1519,1518,1518,1517,1517,1517,1517,
+    0,1516,1515,1515,1514,1514,1514,1514,1513,1513,1513,1513,7,7,7,7,
+    0,0,0,0,0,0,0,1512,0,0,0,1511,0,1510,1509,1509,
+    0,0,0,1508,0,1507,1506,1506,0,1505,1504,1504,1503,1503,1503,9,
+    0,0,0,1502,0,1501,1500,1500,0,1499,1498,1498,1497,1497,1497,1497,
+    0,1496,1495,1495,1494,1494,1494,1494,1493,1493,1493,1493,1493,1493,8,8,
+    0,0,0,1492,0,1491,1490,1490,0,1489,1488,1488,1487,1487,1487,1487,
+    0,1486,1485,1485,1484,1484,1484,1484,1483,1483,1483,1483,1483,1483,1483,9,
+    0,1482,1481,1481,1480,1480,1480,1480,1479,1479,1479,1479,1479,1479,1479,1479,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1478,
+    0,0,0,0,0,0,0,1477,0,0,0,1476,0,1475,1474,9,
+    0,0,0,0,0,0,0,1473,0,0,0,1472,0,1471,1470,1470,
+    0,0,0,1469,0,1468,1467,1467,0,1466,1465,1465,1464,1464,8,8,
+    0,0,0,0,0,0,0,1463,0,0,0,1462,0,1461,1460,1460,
+    0,0,0,1459,0,1458,1457,1457,0,1456,1455,1455,1454,1454,1454,9,
+    0,0,0,1453,0,1452,1451,1451,0,1450,1449,1449,1448,1448,1448,1448,
+    0,1447,1446,1446,1445,1445,1445,1445,1444,1444,1444,1444,7,7,7,7,
+    0,0,0,0,0,0,0,1443,0,0,0,1442,0,1441,1440,1440,
+    0,0,0,1439,0,1438,1437,1437,0,1436,1435,1435,1434,1434,1434,9,
+    0,0,0,1433,0,1432,1431,1431,0,1430,1429,1429,1428,1428,1428,1428,
+    0,1427,1426,1426,1425,1425,1425,1425,1424,1424,1424,1424,1424,1424,8,8,
+    0,0,0,1423,0,1422,1421,1421,0,1420,1419,1419,1418,1418,1418,1418,
+    0,1417,1416,1416,1415,1415,1415,1415,1414,1414,1414,1414,1414,1414,1414,9,
+    0,1413,1412,1412,1411,1411,1411,1411,1410,1410,1410,1410,1410,1410,1410,1410,
+    1409,1409,1409,1409,1409,1409,1409,1409,6,6,6,6,6,6,6,6,
+    0,0,0,0,0,0,0,1408,0,0,0,1407,0,1406,1405,1405,
+    0,0,0,1404,0,1403,1402,1402,0,1401,1400,1400,1399,1399,1399,9,
+    0,0,0,1398,0,1397,1396,1396,0,1395,1394,1394,1393,1393,1393,1393,
+    0,1392,1391,1391,1390,1390,1390,1390,1389,1389,1389,1389,1389,1389,8,8,
+    0,0,0,1388,0,1387,1386,1386,0,1385,1384,1384,1383,1383,1383,1383,
+    0,1382,1381,1381,1380,1380,1380,1380,1379,1379,1379,1379,1379,1379,1379,9,
+    0,1378,1377,1377,1376,1376,1376,1376,1375,1375,1375,1375,1375,1375,1375,1375,
+    1374,1374,1374,1374,1374,1374,1374,1374,1374,1374,1374,1374,7,7,7,7,
+    0,0,0,1373,0,1372,1371,1371,0,1370,1369,1369,1368,1368,1368,1368,
+    0,1367,1366,1366,1365,1365,1365,1365,1364,1364,1364,1364,1364,1364,1364,9,
+    0,1363,1362,1362,1361,1361,1361,1361,1360,1360,1360,1360,1360,1360,1360,1360,
+    1359,1359,1359,1359,1359,1359,1359,1359,1359,1359,1359,1359,1359,1359,8,8,
+    0,1358,1357,1357,1356,1356,1356,1356,1355,1355,1355,1355,1355,1355,1355,1355,
+    1354,1354,1354,1354,1354,1354,1354,1354,1354,1354,1354,1354,1354,1354,1354,9,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1353,
+    0,0,0,0,0,0,0,1352,0,0,0,1351,0,1350,1349,9,
+    0,0,0,0,0,0,0,1348,0,0,0,1347,0,1346,1345,1345,
+    0,0,0,1344,0,1343,1342,1342,0,1341,1340,1340,1339,1339,8,8,
+    0,0,0,0,0,0,0,1338,0,0,0,1337,0,1336,1335,1335,
+    0,0,0,1334,0,1333,1332,1332,0,1331,1330,1330,1329,1329,1329,9,
+    0,0,0,1328,0,1327,1326,1326,0,1325,1324,1324,1323,1323,1323,1323,
+    0,1322,1321,1321,1320,1320,1320,1320,1319,1319,1319,1319,7,7,7,7,
+    0,0,0,0,0,0,0,1318,0,0,0,1317,0,1316,1315,1315,
+    0,0,0,1314,0,1313,1312,1312,0,1311,1310,1310,1309,1309,1309,9,
+    0,0,0,1308,0,1307,1306,1306,0,1305,1304,1304,1303,1303,1303,1303,
+    0,1302,1301,1301,1300,1300,1300,1300,1299,1299,1299,1299,1299,1299,8,8,
+    0,0,0,1298,0,1297,1296,1296,0,1295,1294,1294,1293,1293,1293,1293,
+    0,1292,1291,1291,1290,1290,1290,1290,1289,1289,1289,1289,1289,1289,1289,9,
+    0,1288,1287,1287,1286,1286,1286,1286,1285,1285,1285,1285,1285,1285,1285,1285,
+    1284,1284,1284,1284,1284,1284,1284,1284,6,6,6,6,6,6,6,6,
+    0,0,0,0,0,0,0,1283,0,0,0,1282,0,1281,1280,1280,
+    0,0,0,1279,0,1278,1277,1277,0,1276,1275,1275,1274,1274,1274,9,
+    0,0,0,1273,0,1272,1271,1271,0,1270,1269,1269,1268,1268,1268,1268,
+    0,1267,1266,1266,1265,1265,1265,1265,1264,1264,1264,1264,1264,1264,8,8,
+    0,0,0,1263,0,1262,1261,1261,0,1260,1259,1259,1258,1258,1258,1258,
+    0,1257,1256,1256,1255,1255,1255,1255,1254,1254,1254,1254,1254,1254,1254,9,
+    0,1253,1252,1252,1251,1251,1251,1251,1250,1250,1250,1250,1250,1250,1250,1250,
+    1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,7,7,7,7,
+    0,0,0,1248,0,1247,1246,1246,0,1245,1244,1244,1243,1243,1243,1243,
+    0,1242,1241,1241,1240,1240,1240,1240,1239,1239,1239,1239,1239,1239,1239,9,
+    0,1238,1237,1237,1236,1236,1236,1236,1235,1235,1235,1235,1235,1235,1235,1235,
+    1234,1234,1234,1234,1234,1234,1234,1234,1234,1234,1234,1234,1234,1234,8,8,
+    0,1233,1232,1232,1231,1231,1231,1231,1230,1230,1230,1230,1230,1230,1230,1230,
+    1229,1229,1229,1229,1229,1229,1229,1229,1229,1229,1229,1229,1229,1229,1229,9,
+    1228,1228,1228,1228,1228,1228,1228,1228,1228,1228,1228,1228,1228,1228,1228,1228,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,0,0,0,0,0,0,1227,0,0,0,1226,0,1225,1224,1224,
+    0,0,0,1223,0,1222,1221,1221,0,1220,1219,1219,1218,1218,1218,9,
+    0,0,0,1217,0,1216,1215,1215,0,1214,1213,1213,1212,1212,1212,1212,
+    0,1211,1210,1210,1209,1209,1209,1209,1208,1208,1208,1208,1208,1208,8,8,
+    0,0,0,1207,0,1206,1205,1205,0,1204,1203,1203,1202,1202,1202,1202,
+    0,1201,1200,1200,1199,1199,1199,1199,1198,1198,1198,1198,1198,1198,1198,9,
+    0,1197,1196,1196,1195,1195,1195,1195,1194,1194,1194,1194,1194,1194,1194,1194,
+    1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,1193,7,7,7,7,
+    0,0,0,1192,0,1191,1190,1190,0,1189,1188,1188,1187,1187,1187,1187,
+    0,1186,1185,1185,1184,1184,1184,1184,1183,1183,1183,1183,1183,1183,1183,9,
+    0,1182,1181,1181,1180,1180,1180,1180,1179,1179,1179,1179,1179,1179,1179,1179,
+    1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,1178,8,8,
+    0,1177,1176,1176,1175,1175,1175,1175,1174,1174,1174,1174,1174,1174,1174,1174,
+    1173,1173,1173,1173,1173,1173,1173,1173,1173,1173,1173,1173,1173,1173,1173,9,
+    1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,
+    1172,1172,1172,1172,1172,1172,1172,1172,6,6,6,6,6,6,6,6,
+    0,0,0,1171,0,1170,1169,1169,0,1168,1167,1167,1166,1166,1166,1166,
+    0,1165,1164,1164,1163,1163,1163,1163,1162,1162,1162,1162,1162,1162,1162,9,
+    0,1161,1160,1160,1159,1159,1159,1159,1158,1158,1158,1158,1158,1158,1158,1158,
+    1157,1157,1157,1157,1157,1157,1157,1157,1157,1157,1157,1157,1157,1157,8,8,
+    0,1156,1155,1155,1154,1154,1154,1154,1153,1153,1153,1153,1153,1153,1153,1153,
+    1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,1152,9,
+    1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,
+    1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,1151,7,7,7,7,
+    0,1150,1149,1149,1148,1148,1148,1148,1147,1147,1147,1147,1147,1147,1147,1147,
+    1146,1146,1146,1146,1146,1146,1146,1146,1146,1146,1146,1146,1146,1146,1146,9,
+    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,
+    1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,1145,8,8,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1144,
+    0,0,0,0,0,0,0,1143,0,0,0,1142,0,1141,1140,9,
+    0,0,0,0,0,0,0,1139,0,0,0,1138,0,1137,1136,1136,
+    0,0,0,1135,0,1134,1133,1133,0,1132,1131,1131,1130,1130,8,8,
+    0,0,0,0,0,0,0,1129,0,0,0,1128,0,1127,1126,1126,
+    0,0,0,1125,0,1124,1123,1123,0,1122,1121,1121,1120,1120,1120,9,
+    0,0,0,1119,0,1118,1117,1117,0,1116,1115,1115,1114,1114,1114,1114,
+    0,1113,1112,1112,1111,1111,1111,1111,1110,1110,1110,1110,7,7,7,7,
+    0,0,0,0,0,0,0,1109,0,0,0,1108,0,1107,1106,1106,
+    0,0,0,1105,0,1104,1103,1103,0,1102,1101,1101,1100,1100,1100,9,
+    0,0,0,1099,0,1098,1097,1097,0,1096,1095,1095,1094,1094,1094,1094,
+    0,1093,1092,1092,1091,1091,1091,1091,1090,1090,1090,1090,1090,1090,8,8,
+    0,0,0,1089,0,1088,1087,1087,0,1086,1085,1085,1084,1084,1084,1084,
+    0,1083,1082,1082,1081,1081,1081,1081,1080,1080,1080,1080,1080,1080,1080,9,
+    0,1079,1078,1078,1077,1077,1077,1077,1076,1076,1076,1076,1076,1076,1076,1076,
+    1075,1075,1075,1075,1075,1075,1075,1075,6,6,6,6,6,6,6,6,
+    0,0,0,0,0,0,0,1074,0,0,0,1073,0,1072,1071,1071,
+    0,0,0,1070,0,1069,1068,1068,0,1067,1066,1066,1065,1065,1065,9,
+    0,0,0,1064,0,1063,1062,1062,0,1061,1060,1060,1059,1059,1059,1059,
+    0,1058,1057,1057,1056,1056,1056,1056,1055,1055,1055,1055,1055,1055,8,8,
+    0,0,0,1054,0,1053,1052,1052,0,1051,1050,1050,1049,1049,1049,1049,
+    0,1048,1047,1047,1046,1046,1046,1046,1045,1045,1045,1045,1045,1045,1045,9,
+    0,1044,1043,1043,1042,1042,1042,1042,1041,1041,1041,1041,1041,1041,1041,1041,
+    1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,7,7,7,7,
+    0,0,0,1039,0,1038,1037,1037,0,1036,1035,1035,1034,1034,1034,1034,
+    0,1033,1032,1032,1031,1031,1031,1031,1030,1030,1030,1030,1030,1030,1030,9,
+    0,1029,1028,1028,1027,1027,1027,1027,1026,1026,1026,1026,1026,1026,1026,1026,
+    1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,8,8,
+    0,1024,1023,1023,1022,1022,1022,1022,1021,1021,1021,1021,1021,1021,1021,1021,
+    1020,1020,1020,1020,1020,1020,1020,1020,1020,1020,1020,1020,1020,1020,1020,9,
+    1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,0,0,0,0,0,0,1018,0,0,0,1017,0,1016,1015,1015,
+    0,0,0,1014,0,1013,1012,1012,0,1011,1010,1010,1009,1009,1009,9,
+    0,0,0,1008,0,1007,1006,1006,0,1005,1004,1004,1003,1003,1003,1003,
+    0,1002,1001,1001,1000,1000,1000,1000,999,999,999,999,999,999,8,8,
+    0,0,0,998,0,997,996,996,0,995,994,994,993,993,993,993,
+    0,992,991,991,990,990,990,990,989,989,989,989,989,989,989,9,
+    0,988,987,987,986,986,986,986,985,985,985,985,985,985,985,985,
+    984,984,984,984,984,984,984,984,984,984,984,984,7,7,7,7,
+    0,0,0,983,0,982,981,981,0,980,979,979,978,978,978,978,
+    0,977,976,976,975,975,975,975,974,974,974,974,974,974,974,9,
+    0,973,972,972,971,971,971,971,970,970,970,970,970,970,970,970,
+    969,969,969,969,969,969,969,969,969,969,969,969,969,969,8,8,
+    0,968,967,967,966,966,966,966,965,965,965,965,965,965,965,965,
+    964,964,964,964,964,964,964,964,964,964,964,964,964,964,964,9,
+    963,963,963,963,963,963,963,963,963,963,963,963,963,963,963,963,
+    963,963,963,963,963,963,963,963,6,6,6,6,6,6,6,6,
+    0,0,0,962,0,961,960,960,0,959,958,958,957,957,957,957,
+    0,956,955,955,954,954,954,954,953,953,953,953,953,953,953,9,
+    0,952,951,951,950,950,950,950,949,949,949,949,949,949,949,949,
+    948,948,948,948,948,948,948,948,948,948,948,948,948,948,8,8,
+    0,947,946,946,945,945,945,945,944,944,944,944,944,944,944,944,
+    943,943,943,943,943,943,943,943,943,943,943,943,943,943,943,9,
+    942,942,942,942,942,942,942,942,942,942,942,942,942,942,942,942,
+    942,942,942,942,942,942,942,942,942,942,942,942,7,7,7,7,
+    0,941,940,940,939,939,939,939,938,938,938,938,938,938,938,938,
+    937,937,937,937,937,937,937,937,937,937,937,937,937,937,937,9,
+    936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+    936,936,936,936,936,936,936,936,936,936,936,936,936,936,8,8,
+    935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,
+    935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,9,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    0,0,0,0,0,0,0,934,0,0,0,933,0,932,931,931,
+    0,0,0,930,0,929,928,928,0,927,926,926,925,925,925,9,
+    0,0,0,924,0,923,922,922,0,921,920,920,919,919,919,919,
+    0,918,917,917,916,916,916,916,915,915,915,915,915,915,8,8,
+    0,0,0,914,0,913,912,912,0,911,910,910,909,909,909,909,
+    0,908,907,907,906,906,906,906,905,905,905,905,905,905,905,9,
+    0,904,903,903,902,902,902,902,901,901,901,901,901,901,901,901,
+    900,900,900,900,900,900,900,900,900,900,900,900,7,7,7,7,
+    0,0,0,899,0,898,897,897,0,896,895,895,894,894,894,894,
+    0,893,892,892,891,891,891,891,890,890,890,890,890,890,890,9,
+    0,889,888,888,887,887,887,887,886,886,886,886,886,886,886,886,
+    885,885,885,885,885,885,885,885,885,885,885,885,885,885,8,8,
+    0,884,883,883,882,882,882,882,881,881,881,881,881,881,881,881,
+    880,880,880,880,880,880,880,880,880,880,880,880,880,880,880,9,
+    879,879,879,879,879,879,879,879,879,879,879,879,879,879,879,879,
+    879,879,879,879,879,879,879,879,6,6,6,6,6,6,6,6,
+    0,0,0,878,0,877,876,876,0,875,874,874,873,873,873,873,
+    0,872,871,871,870,870,870,870,869,869,869,869,869,869,869,9,
+    0,868,867,867,866,866,866,866,865,865,865,865,865,865,865,865,
+    864,864,864,864,864,864,864,864,864,864,864,864,864,864,8,8,
+    0,863,862,862,861,861,861,861,860,860,860,860,860,860,860,860,
+    859,859,859,859,859,859,859,859,859,859,859,859,859,859,859,9,
+    858,858,858,858,858,858,858,858,858,858,858,858,858,858,858,858,
+    858,858,858,858,858,858,858,858,858,858,858,858,7,7,7,7,
+    0,857,856,856,855,855,855,855,854,854,854,854,854,854,854,854,
+    853,853,853,853,853,853,853,853,853,853,853,853,853,853,853,9,
+    852,852,852,852,852,852,852,852,852,852,852,852,852,852,852,852,
+    852,852,852,852,852,852,852,852,852,852,852,852,852,852,8,8,
+    851,851,851,851,851,851,851,851,851,851,851,851,851,851,851,851,
+    851,851,851,851,851,851,851,851,851,851,851,851,851,851,851,9,
+    851,851,851,851,851,851,851,851,851,851,851,851,851,851,851,851,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,0,0,850,0,849,848,848,0,847,846,846,845,845,845,845,
+    0,844,843,843,842,842,842,842,841,841,841,841,841,841,841,9,
+    0,840,839,839,838,838,838,838,837,837,837,837,837,837,837,837,
+    836,836,836,836,836,836,836,836,836,836,836,836,836,836,8,8,
+    0,835,834,834,833,833,833,833,832,832,832,832,832,832,832,832,
+    831,831,831,831,831,831,831,831,831,831,831,831,831,831,831,9,
+    830,830,830,830,830,830,830,830,830,830,830,830,830,830,830,830,
+    830,830,830,830,830,830,830,830,830,830,830,830,7,7,7,7,
+    0,829,828,828,827,827,827,827,826,826,826,826,826,826,826,826,
+    825,825,825,825,825,825,825,825,825,825,825,825,825,825,825,9,
+    824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,
+    824,824,824,824,824,824,824,824,824,824,824,824,824,824,8,8,
+    823,823,823,823,823,823,823,823,823,823,823,823,823,823,823,823,
+    823,823,823,823,823,823,823,823,823,823,823,823,823,823,823,9,
+    823,823,823,823,823,823,823,823,823,823,823,823,823,823,823,823,
+    823,823,823,823,823,823,823,823,6,6,6,6,6,6,6,6,
+    0,822,821,821,820,820,820,820,819,819,819,819,819,819,819,819,
+    818,818,818,818,818,818,818,818,818,818,818,818,818,818,818,9,
+    817,817,817,817,817,817,817,817,817,817,817,817,817,817,817,817,
+    817,817,817,817,817,817,817,817,817,817,817,817,817,817,8,8,
+    816,816,816,816,816,816,816,816,816,816,816,816,816,816,816,816,
+    816,816,816,816,816,816,816,816,816,816,816,816,816,816,816,9,
+    816,816,816,816,816,816,816,816,816,816,816,816,816,816,816,816,
+    816,816,816,816,816,816,816,816,816,816,816,816,7,7,7,7,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,
+    0,0,0,0,0,0,0,815,0,0,0,814,0,813,812,9,
+    0,0,0,0,0,0,0,811,0,0,0,810,0,809,808,10,
+    0,0,0,807,0,806,805,805,0,804,803,803,802,802,8,8,
+    0,0,0,0,0,0,0,801,0,0,0,800,0,799,798,10,
+    0,0,0,797,0,796,795,795,0,794,793,793,792,792,792,9,
+    0,0,0,791,0,790,789,789,0,788,787,787,786,786,786,10,
+    0,785,784,784,783,783,783,783,782,782,782,782,7,7,7,7,
+    0,0,0,0,0,0,0,781,0,0,0,780,0,779,778,10,
+    0,0,0,777,0,776,775,775,0,774,773,773,772,772,772,9,
+    0,0,0,771,0,770,769,769,0,768,767,767,766,766,766,10,
+    0,765,764,764,763,763,763,763,762,762,762,762,762,762,8,8,
+    0,0,0,761,0,760,759,759,0,758,757,757,756,756,756,10,
+    0,755,754,754,753,753,753,753,752,752,752,752,752,752,752,9,
+    0,751,750,750,749,749,749,749,748,748,748,748,748,748,748,10,
+    747,747,747,747,747,747,747,747,6,6,6,6,6,6,6,6,
+    0,0,0,0,0,0,0,746,0,0,0,745,0,744,743,10,
+    0,0,0,742,0,741,740,740,0,739,738,738,737,737,737,9,
+    0,0,0,736,0,735,734,734,0,733,732,732,731,731,731,10,
+    0,730,729,729,728,728,728,728,727,727,727,727,727,727,8,8,
+    0,0,0,726,0,725,724,724,0,723,722,722,721,721,721,10,
+    0,720,719,719,718,718,718,718,717,717,717,717,717,717,717,9,
+    0,716,715,715,714,714,714,714,713,713,713,713,713,713,713,10,
+    712,712,712,712,712,712,712,712,712,712,712,712,7,7,7,7,
+    0,0,0,711,0,710,709,709,0,708,707,707,706,706,706,10,
+    0,705,704,704,703,703,703,703,702,702,702,702,702,702,702,9,
+    0,701,700,700,699,699,699,699,698,698,698,698,698,698,698,10,
+    697,697,697,697,697,697,697,697,697,697,697,697,697,697,8,8,
+    0,696,695,695,694,694,694,694,693,693,693,693,693,693,693,10,
+    692,692,692,692,692,692,692,692,692,692,692,692,692,692,692,9,
+    691,691,691,691,691,691,691,691,691,691,691,691,691,691,691,10,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,0,0,0,0,0,0,690,0,0,0,689,0,688,687,10,
+    0,0,0,686,0,685,684,684,0,683,682,682,681,681,681,9,
+    0,0,0,680,0,679,678,678,0,677,676,676,675,675,675,10,
+    0,674,673,673,672,672,672,672,671,671,671,671,671,671,8,8,
+    0,0,0,670,0,669,668,668,0,667,666,666,665,665,665,10,
+    0,664,663,663,662,662,662,662,661,661,661,661,661,661,661,9,
+    0,660,659,659,658,658,658,658,657,657,657,657,657,657,657,10,
+    656,656,656,656,656,656,656,656,656,656,656,656,7,7,7,7,
+    0,0,0,655,0,654,653,653,0,652,651,651,650,650,650,10,
+    0,649,648,648,647,647,647,647,646,646,646,646,646,646,646,9,
+    0,645,644,644,643,643,643,643,642,642,642,642,642,642,642,10,
+    641,641,641,641,641,641,641,641,641,641,641,641,641,641,8,8,
+    0,640,639,639,638,638,638,638,637,637,637,637,637,637,637,10,
+    636,636,636,636,636,636,636,636,636,636,636,636,636,636,636,9,
+    635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,10,
+    635,635,635,635,635,635,635,635,6,6,6,6,6,6,6,6,
+    0,0,0,634,0,633,632,632,0,631,630,630,629,629,629,10,
+    0,628,627,627,626,626,626,626,625,625,625,625,625,625,625,9,
+    0,624,623,623,622,622,622,622,621,621,621,621,621,621,621,10,
+    620,620,620,620,620,620,620,620,620,620,620,620,620,620,8,8,
+    0,619,618,618,617,617,617,617,616,616,616,616,616,616,616,10,
+    615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,9,
+    614,614,614,614,614,614,614,614,614,614,614,614,614,614,614,10,
+    614,614,614,614,614,614,614,614,614,614,614,614,7,7,7,7,
+    0,613,612,612,611,611,611,611,610,610,610,610,610,610,610,10,
+    609,609,609,609,609,609,609,609,609,609,609,609,609,609,609,9,
+    608,608,608,608,608,608,608,608,608,608,608,608,608,608,608,10,
+    608,608,608,608,608,608,608,608,608,608,608,608,608,608,8,8,
+    607,607,607,607,607,607,607,607,607,607,607,607,607,607,607,10,
+    607,607,607,607,607,607,607,607,607,607,607,607,607,607,607,9,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    0,0,0,0,0,0,0,606,0,0,0,605,0,604,603,10,
+    0,0,0,602,0,601,600,600,0,599,598,598,597,597,597,9,
+    0,0,0,596,0,595,594,594,0,593,592,592,591,591,591,10,
+    0,590,589,589,588,588,588,588,587,587,587,587,587,587,8,8,
+    0,0,0,586,0,585,584,584,0,583,582,582,581,581,581,10,
+    0,580,579,579,578,578,578,578,577,577,577,577,577,577,577,9,
+    0,576,575,575,574,574,574,574,573,573,573,573,573,573,573,10,
+    572,572,572,572,572,572,572,572,572,572,572,572,7,7,7,7,
+    0,0,0,571,0,570,569,569,0,568,567,567,566,566,566,10,
+    0,565,564,564,563,563,563,563,562,562,562,562,562,562,562,9,
+    0,561,560,560,559,559,559,559,558,558,558,558,558,558,558,10,
+    557,557,557,557,557,557,557,557,557,557,557,557,557,557,8,8,
+    0,556,555,555,554,554,554,554,553,553,553,553,553,553,553,10,
+    552,552,552,552,552,552,552,552,552,552,552,552,552,552,552,9,
+    551,551,551,551,551,551,551,551,551,551,551,551,551,551,551,10,
+    551,551,551,551,551,551,551,551,6,6,6,6,6,6,6,6,
+    0,0,0,550,0,549,548,548,0,547,546,546,545,545,545,10,
+    0,544,543,543,542,542,542,542,541,541,541,541,541,541,541,9,
+    0,540,539,539,538,538,538,538,537,537,537,537,537,537,537,10,
+    536,536,536,536,536,536,536,536,536,536,536,536,536,536,8,8,
+    0,535,534,534,533,533,533,533,532,532,532,532,532,532,532,10,
+    531,531,531,531,531,531,531,531,531,531,531,531,531,531,531,9,
+    530,530,530,530,530,530,530,530,530,530,530,530,530,530,530,10,
+    530,530,530,530,530,530,530,530,530,530,530,530,7,7,7,7,
+    0,529,528,528,527,527,527,527,526,526,526,526,526,526,526,10,
+    525,525,525,525,525,525,525,525,525,525,525,525,525,525,525,9,
+    524,524,524,524,524,524,524,524,524,524,524,524,524,524,524,10,
+    524,524,524,524,524,524,524,524,524,524,524,524,524,524,8,8,
+    523,523,523,523,523,523,523,523,523,523,523,523,523,523,523,10,
+    523,523,523,523,523,523,523,523,523,523,523,523,523,523,523,9,
+    523,523,523,523,523,523,523,523,523,523,523,523,523,523,523,10,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,0,0,522,0,521,520,520,0,519,518,518,517,517,517,10,
+    0,516,515,515,514,514,514,514,513,513,513,513,513,513,513,9,
+    0,512,511,511,510,510,510,510,509,509,509,509,509,509,509,10,
+    508,508,508,508,508,508,508,508,508,508,508,508,508,508,8,8,
+    0,507,506,506,505,505,505,505,504,504,504,504,504,504,504,10,
+    503,503,503,503,503,503,503,503,503,503,503,503,503,503,503,9,
+    502,502,502,502,502,502,502,502,502,502,502,502,502,502,502,10,
+    502,502,502,502,502,502,502,502,502,502,502,502,7,7,7,7,
+    0,501,500,500,499,499,499,499,498,498,498,498,498,498,498,10,
+    497,497,497,497,497,497,497,497,497,497,497,497,497,497,497,9,
+    496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,10,
+    496,496,496,496,496,496,496,496,496,496,496,496,496,496,8,8,
+    495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,10,
+    495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,9,
+    495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,10,
+    495,495,495,495,495,495,495,495,6,6,6,6,6,6,6,6,
+    0,494,493,493,492,492,492,492,491,491,491,491,491,491,491,10,
+    490,490,490,490,490,490,490,490,490,490,490,490,490,490,490,9,
+    489,489,489,489,489,489,489,489,489,489,489,489,489,489,489,10,
+    489,489,489,489,489,489,489,489,489,489,489,489,489,489,8,8,
+    488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,10,
+    488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,9,
+    488,488,488,488,488,488,488,488,488,488,488,488,488,488,488,10,
+    488,488,488,488,488,488,488,488,488,488,488,488,7,7,7,7,
+    487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,10,
+    487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,9,
+    487,487,487,487,487,487,487,487,487,487,487,487,487,487,487,10,
+    487,487,487,487,487,487,487,487,487,487,487,487,487,487,8,8,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    0,0,0,0,0,0,0,486,0,0,0,485,0,484,483,10,
+    0,0,0,482,0,481,480,480,0,479,478,478,477,477,477,9,
+    0,0,0,476,0,475,474,474,0,473,472,472,471,471,471,10,
+    0,470,469,469,468,468,468,468,467,467,467,467,467,467,8,8,
+    0,0,0,466,0,465,464,464,0,463,462,462,461,461,461,10,
+    0,460,459,459,458,458,458,458,457,457,457,457,457,457,457,9,
+    0,456,455,455,454,454,454,454,453,453,453,453,453,453,453,10,
+    452,452,452,452,452,452,452,452,452,452,452,452,7,7,7,7,
+    0,0,0,451,0,450,449,449,0,448,447,447,446,446,446,10,
+    0,445,444,444,443,443,443,443,442,442,442,442,442,442,442,9,
+    0,441,440,440,439,439,439,439,438,438,438,438,438,438,438,10,
+    437,437,437,437,437,437,437,437,437,437,437,437,437,437,8,8,
+    0,436,435,435,434,434,434,434,433,433,433,433,433,433,433,10,
+    432,432,432,432,432,432,432,432,432,432,432,432,432,432,432,9,
+    431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,10,
+    431,431,431,431,431,431,431,431,6,6,6,6,6,6,6,6,
+    0,0,0,430,0,429,428,428,0,427,426,426,425,425,425,10,
+    0,424,423,423,422,422,422,422,421,421,421,421,421,421,421,9,
+    0,420,419,419,418,418,418,418,417,417,417,417,417,417,417,10,
+    416,416,416,416,416,416,416,416,416,416,416,416,416,416,8,8,
+    0,415,414,414,413,413,413,413,412,412,412,412,412,412,412,10,
+    411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,9,
+    410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,10,
+    410,410,410,410,410,410,410,410,410,410,410,410,7,7,7,7,
+    0,409,408,408,407,407,407,407,406,406,406,406,406,406,406,10,
+    405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,9,
+    404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,10,
+    404,404,404,404,404,404,404,404,404,404,404,404,404,404,8,8,
+    403,403,403,403,403,403,403,403,403,403,403,403,403,403,403,10,
+    403,403,403,403,403,403,403,403,403,403,403,403,403,403,403,9,
+    403,403,403,403,403,403,403,403,403,403,403,403,403,403,403,10,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,0,0,402,0,401,400,400,0,399,398,398,397,397,397,10,
+    0,396,395,395,394,394,394,394,393,393,393,393,393,393,393,9,
+    0,392,391,391,390,390,390,390,389,389,389,389,389,389,389,10,
+    388,388,388,388,388,388,388,388,388,388,388,388,388,388,8,8,
+    0,387,386,386,385,385,385,385,384,384,384,384,384,384,384,10,
+    383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,9,
+    382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,10,
+    382,382,382,382,382,382,382,382,382,382,382,382,7,7,7,7,
+    0,381,380,380,379,379,379,379,378,378,378,378,378,378,378,10,
+    377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,9,
+    376,376,376,376,376,376,376,376,376,376,376,376,376,376,376,10,
+    376,376,376,376,376,376,376,376,376,376,376,376,376,376,8,8,
+    375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,10,
+    375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,9,
+    375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,10,
+    375,375,375,375,375,375,375,375,6,6,6,6,6,6,6,6,
+    0,374,373,373,372,372,372,372,371,371,371,371,371,371,371,10,
+    370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,9,
+    369,369,369,369,369,369,369,369,369,369,369,369,369,369,369,10,
+    369,369,369,369,369,369,369,369,369,369,369,369,369,369,8,8,
+    368,368,368,368,368,368,368,368,368,368,368,368,368,368,368,10,
+    368,368,368,368,368,368,368,368,368,368,368,368,368,368,368,9,
+    368,368,368,368,368,368,368,368,368,368,368,368,368,368,368,10,
+    368,368,368,368,368,368,368,368,368,368,368,368,7,7,7,7,
+    367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,10,
+    367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,9,
+    367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,10,
+    367,367,367,367,367,367,367,367,367,367,367,367,367,367,8,8,
+    367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,10,
+    367,367,367,367,367,367,367,367,367,367,367,367,367,367,367,9,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    0,0,0,366,0,365,364,364,0,363,362,362,361,361,361,10,
+    0,360,359,359,358,358,358,358,357,357,357,357,357,357,357,9,
+    0,356,355,355,354,354,354,354,353,353,353,353,353,353,353,10,
+    352,352,352,352,352,352,352,352,352,352,352,352,352,352,8,8,
+    0,351,350,350,349,349,349,349,348,348,348,348,348,348,348,10,
+    347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,9,
+    346,346,346,346,346,346,346,346,346,346,346,346,346,346,346,10,
+    346,346,346,346,346,346,346,346,346,346,346,346,7,7,7,7,
+    0,345,344,344,343,343,343,343,342,342,342,342,342,342,342,10,
+    341,341,341,341,341,341,341,341,341,341,341,341,341,341,341,9,
+    340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,10,
+    340,340,340,340,340,340,340,340,340,340,340,340,340,340,8,8,
+    339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,10,
+    339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,9,
+    339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,10,
+    339,339,339,339,339,339,339,339,6,6,6,6,6,6,6,6,
+    0,338,337,337,336,336,336,336,335,335,335,335,335,335,335,10,
+    334,334,334,334,334,334,334,334,334,334,334,334,334,334,334,9,
+    333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,10,
+    333,333,333,333,333,333,333,333,333,333,333,333,333,333,8,8,
+    332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,10,
+    332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,9,
+    332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,10,
+    332,332,332,332,332,332,332,332,332,332,332,332,7,7,7,7,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,10,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,9,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,10,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,8,8,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,10,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,9,
+    331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,10,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,330,329,329,328,328,328,328,327,327,327,327,327,327,327,10,
+    326,326,326,326,326,326,326,326,326,326,326,326,326,326,326,9,
+    325,325,325,325,325,325,325,325,325,325,325,325,325,325,325,10,
+    325,325,325,325,325,325,325,325,325,325,325,325,325,325,8,8,
+    324,324,324,324,324,324,324,324,324,324,324,324,324,324,324,10,
+    324,324,324,324,324,324,324,324,324,324,324,324,324,324,324,9,
+    324,324,324,324,324,324,324,324,324,324,324,324,324,324,324,10,
+    324,324,324,324,324,324,324,324,324,324,324,324,7,7,7,7,
+    323,323,323,323,323,323,323,323,323,323,323,323,323,323,323,10,
+    323,323,323,323,323,323,323,323,323,323,323,323,323,323,323,9,
+    323,323,323,323,323,323,323,323,323,323,323,323,323,323,323,10,
+    323,323,323,323,323,323,323,323,323,323,323,323,323,323,8,8,
+    323,323,323,323,323,323,323,323,323,323,323,323,323,323,323,10,
+    323,323,323,323,323,323,323,323,323,323,323,323,323,323,323,9,
+    323,323,323,323,323,323,323,323,323,323,323,323,323,323,323,10,
+    323,323,323,323,323,323,323,323,6,6,6,6,6,6,6,6,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+};
+
+static const unsigned short builtin_noflush7_table[1 << NOFLUSH7_TABLE_BITS] = {
+    0,0,0,237,113,1678,4543,0,278,316,119,0,0,0,0,271,
+    0,183,2875,3186,0,0,0,146,0,187,177,3391,5407,0,0,3272,
+    0,0,2616,0,3124,2242,248,2095,5342,101,306,3130,3392,311,2673,5690,
+    0,3043,0,2448,3649,4426,2568,6561,0,0,208,3249,3249,145,3194,0,
+    3689,2579,0,0,168,0,0,3398,0,0,261,0,0,0,0,0,
+    5142,3383,315,0,204,0,0,0,3129,2833,4042,0,3238,0,0,2403,
+    72,181,0,0,2375,0,2743,0,2636,0,3180,2539,0,7042,0,0,
+    2613,4103,0,5980,228,2945,206,5803,146,2832,297,2601,2733,1623,0,3132,
+    0,3382,4923,5529,269,2039,0,4461,3337,255,2479,5086,114,242,2847,2976,
+    246,95,2112,0,1840,3009,305,3106,2974,83,2471,6386,1810,0,0,2037,
+    35,249,2151,2295,0,0,3165,0,253,2495,4878,176,3107,298,2624,2149,
+    302,213,4974,3007,296,0,6187,0,6023,0,0,322,200,2338,4279,6039,
+    2707,3008,3095,2530,3096,304,179,88,285,4968,198,5986,6399,2103,235,2960,
+    0,0,3045,0,2809,0,5326,2944,180,2037,0,3559,199,0,252,0,
+    5752,0,87,2012,2530,168,3385,0,24,2548,175,2140,0,4376,210,95,
+    0,3231,4016,0,0,0,250,3184,2832,1920,0,1878,0,319,0,201,
+    4887,0,0,6247,319,0,225,212,252,2931,67,0,0,3035,2998,2836,
+    5329,0,275,119,0,1887,0,174,2767,3219,0,2546,3057,4219,0,132,
+    0,0,0,207,0,5976,2737,0,0,310,3177,2627,0,0,25,191,
+    5231,0,5306,0,0,0,0,5757,3184,297,5529,4981,2858,0,4014,0,
+    235,2006,2977,0,0,180,0,2711,41,310,281,95,220,0,265,2008,
+    190,0,1609,273,0,222,2943,1648,315,306,0,0,0,1961,0,3776,
+    0,0,2721,3200,3086,205,206,1607,0,2556,1971,215,2216,320,5370,5727,
+    261,2582,2447,0,0,0,3063,0,261,259,0,0,0,3041,0,239,
+    3793,4922,0,2677,193,4247,2557,2723,50,204,2668,2832,44,2626,3131,6904,
+    308,236,185,4646,2732,3298,1679,3272,1874,109,2699,104,3104,0,3795,1603,
+    2571,2142,2754,0,3785,0,5818,4307,0,4870,125,311,6186,0,1943,276,
+    193,0,0,2537,0,0,0,0,6560,3008,2506,0,0,15,3132,0,
+    2799,1772,5910,308,176,0,72,0,3825,2418,5020,248,0,6351,0,173,
+    0,71,2847,3830,3382,4098,35,2955,6195,3997,0,174,5446,0,209,2789,
+    303,1721,256,0,2161,3197,3851,122,2975,0,3354,3205,2856,0,2440,0,
+    0,1607,2169,0,229,2548,191,0,2765,84,3806,2722,2432,0,2783,0,
+    2274,2789,1832,3437,5976,0,2846,5098,59,3251,5536,197,134,4345,147,3233,
+    3272,4072,6196,2545,0,0,2352,0,0,4015,0,0,0,2747,276,25,
+    6358,2644,3262,212,2514,0,2545,1743,288,0,2168,0,0,4878,279,2017,
+    0,0,5370,0,3227,3239,0,0,4921,199,0,85,4526,313,0,0,
+    304,262,247,2768,4869,2037,3109,0,2589,3210,1961,2822,216,2567,2535,4446,
+    0,238,300,101,0,192,2729,3777,174,113,109,1878,316,5757,0,5802,
+    2008,1606,1608,2979,6352,7061,1677,63,250,232,295,2987,4938,238,2909,282,
+    0,3161,204,204,3546,274,3125,2669,6210,173,189,3228,62,0,2243,0,
+    309,5106,31,5365,5316,4749,3305,3903,1886,0,0,0,3064,3851,1821,0,
+    0,4065,1822,4426,1951,2831,2726,4271,6022,5585,0,6350,0,0,4370,1698,
+    2658,1913,2569,1945,5882,95,2820,2553,3996,3165,24,42,0,0,19,0,
+    0,3007,2735,2523,3085,2974,271,3294,38,2490,0,4052,3283,2524,256,233,
+    2943,4041,2739,2485,2491,284,3811,2644,2582,1677,302,274,3283,5759,264,4212,
+    6350,2932,2339,206,3227,2537,2696,1829,3121,0,6024,2618,0,0,2215,153,
+    2760,4529,255,3447,3317,4436,2821,2985,2281,221,191,2083,2738,3293,2809,198,
+    214,5194,3767,5378,2843,3151,6021,4754,2759,3316,3383,3114,3990,5316,4217,96,
+    187,2954,3279,2300,223,0,100,2625,3195,1609,11,0,204,193,0,0,
+    278,0,6137,0,3319,6399,1607,3191,2426,66,195,0,0,0,2503,6023,
+    0,2479,2943,1622,280,4656,4087,2681,1775,2225,4668,3172,2470,206,299,5758,
+    0,306,0,2557,2875,3287,5977,0,2864,2470,2184,3647,0,129,1602,2139,
+    193,0,2387,2084,0,3776,2490,0,3220,2936,0,3800,2558,3987,261,6023,
+    0,0,218,0,2798,7223,1941,0,0,4869,1743,185,2434,0,219,119,
+    2811,3657,5088,0,3032,0,0,0,230,28,0,1745,207,2357,2083,0,
+    283,271,2447,209,0,2589,135,3161,133,2998,132,63,0,2821,2094,2503,
+    0,0,223,280,12,3011,274,1942,2867,0,0,193,2957,188,3001,156,
+    0,220,2556,2688,0,3141,265,4876,2007,0,0,3821,3007,318,246,2900,
+    0,2150,305,208,0,2613,3001,179,2899,3185,265,2624,2820,0,0,0,
+    0,234,0,0,50,2701,0,0,3777,0,4648,204,0,0,2482,0,
+    2735,0,4877,2788,0,0,0,221,0,0,2809,0,2678,0,3227,0,
+    2964,3550,1722,0,11,183,147,247,2886,4314,281,4761,0,0,44,25,
+    5581,0,0,4646,297,0,0,0,4216,2272,0,1679,0,0,55,0,
+    36,0,239,3051,256,3065,3053,172,2945,0,230,5159,2967,3265,0,158,
+    62,0,5628,171,0,6203,2481,0,3779,224,5966,0,0,3250,11,144,
+    4701,2482,1613,295,2171,2651,2815,3002,35,2204,308,3602,217,2579,303,0,
+    0,0,0,3586,0,2516,3991,1610,0,0,3656,2809,5371,244,0,24,
+    4343,0,6359,312,0,50,71,167,35,2700,0,3161,0,0,3838,3294,
+    181,287,249,212,2833,1877,2327,3736,4088,2812,304,107,5966,3915,0,2567,
+    0,2938,299,2734,0,0,4711,121,39,223,3007,5968,3007,48,1780,1830,
+    0,0,0,274,189,4044,0,3686,0,0,1853,2617,3133,1661,0,216,
+    0,3260,242,96,0,5020,1890,0,5967,5328,0,0,1609,2215,5885,1628,
+    3173,3186,0,3208,3142,3249,2517,3273,0,3195,0,83,2776,0,276,2053,
+    171,2699,0,2802,229,3842,59,5371,5187,3075,4658,2423,2472,48,3019,3866,
+    0,0,1788,0,1600,2790,0,0,0,291,303,183,300,5979,2888,0,
+    0,3230,112,1943,3997,0,238,0,132,0,0,0,5993,0,0,5526,
+    0,0,98,0,0,2163,0,302,0,304,3580,0,0,0,2523,2887,
+    5526,201,1875,2507,0,0,3240,0,268,2942,2943,2922,200,2159,12,282,
+    219,264,169,2996,271,170,2777,3785,25,3161,4241,4783,6066,2300,3250,3469,
+    88,1640,0,0,3175,4261,4377,6246,2901,220,5746,5605,2754,245,0,109,
+    4951,5098,0,0,3272,0,234,3566,2757,3695,0,0,0,295,0,0,
+    245,4650,4430,0,2886,6215,0,3216,2761,1822,2933,3183,0,145,6000,193,
+    0,3271,0,0,223,3187,2303,3086,1605,6088,2591,99,4235,5819,2899,2378,
+    0,0,0,0,11,0,211,3184,2802,3683,131,1821,264,2095,3063,2832,
+    177,6504,108,2682,2617,0,5882,2482,6807,0,1605,2746,156,3131,4065,1809,
+    1811,2842,48,232,6863,3294,2810,3064,7217,2215,3989,2303,36,2754,2556,124,
+    0,3010,0,2789,2646,2996,5470,0,0,0,0,5152,2503,4208,5584,0,
+    5566,255,2591,2589,0,2491,0,0,252,2660,6051,0,4309,195,0,5526,
+    3023,1895,2667,2358,2626,314,2558,167,15,2106,2019,2765,0,0,236,205,
+    0,5224,2744,2545,0,6052,72,97,2589,2482,2270,136,4041,3220,60,2766,
+    3014,2989,24,309,5746,2151,1608,2779,2210,172,2868,3476,5386,143,2017,216,
+    313,3411,5086,2941,1606,6216,1764,191,2382,2408,3304,2569,1743,3008,261,2111,
+    0,3238,0,0,0,131,1823,155,119,0,122,1677,3208,0,3296,0,
+    2087,2611,23,7102,5363,2737,4454,6519,1608,256,0,172,4209,3866,111,212,
+    2958,2778,2776,262,2944,0,6479,5307,5757,2723,248,2548,1954,3120,3161,4445,
+    0,0,3108,2472,259,2550,2601,0,2046,2864,0,0,2881,2493,168,5601,
+    4272,0,1601,306,3767,2900,2767,0,0,0,0,2792,0,125,0,2943,
+    2678,4886,207,4426,3206,1820,0,3118,0,2721,0,0,0,0,1748,2702,
+    241,2502,179,182,2662,2601,2748,207,1896,298,226,3063,110,3106,0,225,
+    2138,74,0,0,2078,5107,5979,2879,5188,0,266,247,3210,4648,4207,4922,
+    3029,174,171,230,2490,3052,5262,5329,2524,3139,2869,157,131,5802,2913,5581,
+    0,4720,0,2648,0,37,0,0,0,270,2153,2437,299,0,0,2986,
+    0,0,0,0,0,0,0,0,0,269,2336,3154,280,1841,223,0,
+    5599,5306,2801,72,2900,2799,0,1706,0,296,2864,0,2007,2633,2036,2768,
+    2728,1688,0,2964,0,0,2822,4278,0,4361,0,2381,188,0,0,0,
+    2387,266,0,309,2788,3029,2945,191,0,71,0,3293,0,0,3269,3304,
+    3824,285,193,5980,48,4209,5527,227,218,2791,4646,4262,1951,3043,4016,2633,
+    0,1753,0,200,47,3106,3786,3328,40,2974,0,3115,2480,0,3012,5372,
+    2734,5910,2979,4108,320,1941,3064,2649,3384,0,1885,2748,260,1600,2358,2094,
+    0,3565,232,0,0,0,2737,155,249,2633,2670,1846,0,4314,1987,2281,
+    1746,0,4005,0,0,4235,0,234,3329,0,0,0,1899,5406,2737,6415,
+    187,111,1601,2626,2864,313,73,131,3054,3546,0,242,264,308,1651,7009,
+    3428,0,2603,0,3228,3172,0,0,2225,13,1876,4563,0,0,0,2481,
+    263,2138,2613,272,180,182,244,84,2469,48,4536,2579,3353,5142,2891,248,
+    0,0,2644,2503,0,195,0,0,2866,0,0,2645,61,2640,0,2944,
+    0,5159,0,222,74,133,0,0,3306,3274,256,0,260,3009,2559,0,
+    4447,0,6943,267,5427,0,208,5911,232,4050,1885,2038,65,2008,2743,1600,
+    3260,16,2975,2491,250,316,5810,2908,11,2792,2600,2703,0,175,0,1820,
+    3384,261,62,3435,4866,5847,3442,5086,2546,138,5627,6046,1962,14,3110,2812,
+    293,182,180,5012,0,1772,2875,0,301,263,3320,2162,254,63,4248,6273,
+    0,0,0,0,0,0,0,6230,0,0,3868,313,5087,6105,224,2482,
+    1601,0,3086,2722,4868,6110,211,83,5333,0,3141,262,282,4209,0,245,
+    263,1757,3197,0,5002,2835,2832,0,2892,60,168,4867,3347,1895,304,6130,
+    3044,3069,157,226,284,0,0,1601,6489,0,0,2798,0,0,13,302,
+    5230,235,2667,2842,0,62,0,144,0,273,2614,5370,185,0,4045,0,
+    314,209,2514,3272,5836,2592,1905,11,3150,2006,212,4209,14,3250,3261,3042,
+    276,1744,3173,2733,3167,6693,3098,2103,1944,4932,3205,2923,2859,0,3018,3338,
+    2612,0,4007,3263,0,1951,4901,4646,2584,0,2602,3029,1905,3567,0,0,
+    278,2638,145,0,0,0,0,0,0,2810,2572,2644,0,275,0,0,
+    2037,0,0,2756,171,4073,5150,2743,2502,2125,6470,131,2592,272,3327,4876,
+    0,0,6519,3098,2006,1606,0,3266,5407,286,112,2747,5110,199,3088,261,
+    4575,146,1753,3238,0,108,2677,3123,5757,0,6238,2853,0,0,177,4966,
+    4310,3018,321,159,5144,16,2432,3118,282,3227,4280,4921,2341,2111,0,2848,
+    48,299,1940,211,2501,59,3044,2987,0,2988,2908,2721,2572,170,2666,3580,
+    317,284,299,284,260,2534,3266,72,60,199,5145,150,3139,2567,304,244,
+    2935,1773,4879,3366,120,5536,3205,1711,3029,200,3251,3786,3120,182,2403,2206,
+    133,0,202,2206,4657,4278,0,3166,48,6350,3874,2468,1603,3399,2759,123,
+    25,0,0,5786,0,193,0,2745,0,0,286,3793,0,2978,0,0,
+    1641,207,2513,1716,2747,3121,36,5746,2611,3833,5987,2551,2853,2974,2834,2666,
+    3767,2094,234,6136,253,3990,6186,2833,3106,3272,2901,0,3345,132,2215,0,
+    0,245,0,2845,3838,0,175,0,5096,3052,2503,0,5872,5986,24,1613,
+    96,16,0,0,0,47,0,0,95,0,2744,2738,3220,0,0,0,
+    2743,172,3230,5976,0,0,2867,2217,0,0,228,3264,0,2402,1709,4870,
+    1621,2624,4534,73,2572,2282,313,1921,0,75,2976,2144,3318,5037,3139,123,
+    0,290,0,217,0,238,0,0,0,2531,2242,1962,4225,0,2567,23,
+    197,0,0,0,253,1991,177,3557,3122,3097,2902,2777,3229,7227,255,3391,
+    4922,4226,26,2749,2138,155,6687,3650,2228,289,2614,2810,4071,2744,259,3776,
+    5328,4208,2833,0,2405,2865,0,3064,2722,2648,47,0,252,0,220,2340,
+    0,0,2669,1808,5229,0,0,210,0,5847,0,0,0,4427,0,3239,
+    5161,0,107,0,7380,3337,3649,0,1610,0,0,3030,155,2405,2557,0,
+    0,2725,6231,6030,0,0,280,2601,3786,2176,5818,314,206,0,2974,3294,
+    2295,4067,6679,2377,293,3746,6763,0,0,0,1940,2967,0,1634,0,0,
+    0,0,0,0,1623,0,218,1697,2428,3128,1605,4675,2308,1609,0,0,
+    2549,88,0,2177,0,4430,0,74,2953,6075,0,4782,121,1698,1641,7147,
+    5900,2870,2843,2534,4657,3284,2756,294,121,4436,2590,3336,1666,2844,3633,2685,
+    0,3546,4701,3282,0,0,3173,186,4947,111,3019,221,1634,2636,213,0,
+    3222,1839,2975,3821,282,5162,5555,228,3183,1604,5977,0,219,285,2190,5746,
+    1728,6232,0,0,258,2767,3240,134,236,156,3096,6194,3023,1889,2656,3238,
+    213,4314,2898,60,3244,2844,0,0,3326,2710,2503,2495,5364,4890,3129,218,
+    2531,3845,2898,0,183,2963,305,0,1764,3394,3085,254,1830,3216,6067,2578,
+    257,0,0,0,288,50,2777,2844,4931,2645,301,3391,0,4177,0,0,
+    0,0,0,1810,0,0,1618,4096,100,3778,2824,314,2558,0,2593,0,
+    2044,2900,5406,0,5120,0,2348,2872,3295,309,157,5756,0,0,0,197,
+    5593,2952,148,4042,2996,309,4652,0,2274,0,1746,185,171,0,0,204,
+    7346,0,307,2919,0,0,6688,23,3119,3216,5988,0,98,2758,2866,5003,
+    0,2469,0,3936,0,0,5641,4122,0,2908,2856,7273,0,2897,0,0,
+    5031,0,2657,0,0,2715,263,190,2528,1753,2589,2515,0,2218,123,2996,
+    0,1600,1677,0,0,108,0,2953,3255,0,147,0,6102,0,6437,302,
+    3768,6202,1648,0,0,0,3546,0,3198,2403,4042,224,179,3263,1980,2875,
+    3276,2694,0,5967,2779,311,0,2471,2655,1612,1600,0,0,1819,2768,1602,
+    2472,1978,1636,2899,315,3218,2140,2833,98,5966,234,2162,6367,0,0,2083,
+    2580,2245,285,181,3009,253,3769,3133,5846,1698,4225,0,2770,2505,3129,4882,
+    0,3019,148,2250,2943,1623,278,0,0,3307,5333,0,254,168,2942,2479,
+    3075,0,320,4087,1970,0,268,0,0,2357,5187,6239,1676,2357,4754,282,
+    0,87,0,0,0,2649,0,2206,2490,2582,177,0,0,0,3588,79,
+    0,0,2875,44,0,1640,2957,1885,5370,35,2737,3156,0,1640,214,266,
+    2493,2019,178,5194,205,0,0,270,216,0,0,1886,187,0,4006,209,
+    6562,2934,0,2366,2301,5526,239,3328,0,5158,157,2934,247,0,0,2309,
+    312,282,2768,0,189,207,0,0,71,3187,191,2711,3315,3429,0,0,
+    2755,6386,3140,212,1621,1810,2370,5748,0,247,0,4327,3140,0,2791,4071,
+    0,2931,2083,4665,1755,5223,0,0,0,51,0,3002,5627,271,2745,310,
+    2600,2432,2864,203,2715,2535,5890,0,13,2757,2762,286,5222,1631,3197,3275,
+    2963,2524,271,5977,289,2107,2183,2985,13,182,3342,310,0,0,3020,0,
+    144,247,2601,3411,0,0,5380,2908,0,3206,4445,2179,2712,66,2275,3106,
+    2702,0,3326,201,0,0,0,0,6070,0,4216,6267,0,0,0,2494,
+    233,0,0,0,0,0,0,0,2633,85,2496,3162,0,0,5635,201,
+    2930,2747,233,0,0,6625,3139,201,228,0,3040,3264,247,0,2138,0,
+    4748,2798,0,0,0,0,2501,0,6721,2491,3153,0,0,3129,0,2006,
+    0,215,0,177,0,248,1952,278,0,1787,3271,5159,0,0,1961,0,
+    2933,167,0,321,2591,268,2402,2656,0,5536,0,0,0,0,6031,4153,
+    0,0,3002,4206,217,4226,0,3007,185,6066,5848,0,2757,2787,0,297,
+    0,0,3211,0,4714,3161,175,102,2743,188,257,0,205,221,3164,119,
+    2875,304,137,2970,3382,3120,3167,167,3271,2547,268,3100,1896,4952,155,235,
+    3166,2143,0,0,0,0,0,0,0,6320,0,5773,3683,2217,3040,5818,
+    3936,3383,1940,2513,4673,0,2243,298,1876,2956,291,291,7057,3261,260,101,
+    0,236,2548,2985,0,0,0,0,2513,1764,119,0,284,4975,1830,2525,
+    2496,5021,14,5099,240,0,2623,2084,3548,0,3033,6520,4505,0,4233,244,
+    0,0,226,2734,0,71,3021,5583,2017,235,3031,3825,0,3058,234,0,
+    2546,2149,50,2996,4867,2495,2469,2590,4992,2820,83,4216,286,3295,2721,5379,
+    139,213,5889,1765,6110,4226,5605,1905,2556,2534,317,3601,2607,124,2152,184,
+    3011,2666,0,4490,5408,1879,0,273,0,0,5527,1610,322,178,4080,7246,
+    5969,157,4065,4427,303,3042,1607,2611,0,0,0,294,3304,2189,2603,0,
+    321,6922,259,2625,59,268,2710,2602,2738,3201,5976,6104,4813,0,3184,2854,
+    2963,23,0,3167,248,0,317,0,4428,319,2539,4208,0,0,7218,4026,
+    99,0,3252,4065,5307,134,6067,2776,6031,2746,245,1606,309,0,230,4271,
+    5782,6203,2669,4460,4761,4136,2662,2843,187,132,2614,2997,3441,0,250,0,
+    4052,1955,95,0,5087,232,2624,2093,287,2835,2990,151,3261,23,5846,3088,
+    6360,4218,221,2282,202,0,243,5097,2337,1940,2086,4220,5968,5547,5582,2226,
+    0,3065,3219,0,171,2601,3821,4406,2646,0,5546,0,0,0,90,0,
+    0,1621,1755,4866,3840,16,2933,0,0,6284,0,0,224,2549,0,0,
+    0,0,71,4666,2711,2875,6238,0,1945,5105,4021,3023,0,6038,3601,4318,
+    294,2900,0,0,209,3011,0,0,5846,0,6977,5491,2801,225,1626,2281,
+    2921,12,287,0,50,295,2911,96,0,6386,177,2545,2339,2513,3229,3611,
+    5626,1611,252,3067,3337,3076,5526,2859,132,2476,256,314,187,276,0,192,
+    2423,258,5766,1874,4046,1773,207,0,0,5307,5230,272,0,228,0,12,
+    2075,71,4530,208,2337,0,71,75,230,0,235,273,5385,0,0,2679,
+    224,4528,2721,4360,232,5976,3574,2938,2593,0,2690,6041,47,5086,122,4428,
+    2558,2282,2921,0,4051,0,0,1605,0,143,7222,2751,0,4270,2635,0,
+    1941,5310,2502,0,133,5326,4446,0,6938,2677,273,6268,307,64,3682,0,
+    279,1886,42,2735,271,5811,2515,6196,186,179,41,279,101,97,108,0,
+    0,3602,0,2076,1810,2789,0,2520,2251,3427,2721,0,0,3167,1600,0,
+    2440,13,4428,0,313,2646,0,3821,2746,5306,0,0,3183,2699,0,0,
+    0,6315,0,4446,0,215,2754,208,3032,4453,6889,243,2072,0,2471,3788,
+    2468,0,0,2471,0,0,72,0,198,219,1600,2560,2405,167,0,1607,
+    0,0,3306,5601,2138,295,4065,0,4263,0,0,0,2629,2530,1606,177,
+    3140,0,0,1820,3162,2556,0,0,85,0,249,1780,3107,0,2635,5545,
+    169,3064,0,321,222,6031,1838,74,270,233,6187,2669,3065,2021,2541,6238,
+    268,23,1925,2881,0,1605,6275,5693,3227,0,0,0,3057,2045,0,0,
+    1649,0,271,2432,0,15,2853,0,2680,2150,0,143,0,0,0,0,
+    3648,3428,0,3293,5664,3309,0,2415,0,0,0,0,2746,0,0,3565,
+    5526,169,4235,229,2274,243,28,2519,3305,2624,48,0,0,3275,0,0,
+    0,48,2957,4466,0,1607,231,218,26,3142,107,320,123,2930,315,0,
+    2765,3040,2866,5897,2842,2270,121,3095,2591,172,3447,1606,2376,203,3337,3086,
+    2409,0,123,1601,2236,27,2176,4427,2083,3250,4992,109,2624,107,6209,233,
+    6704,0,0,1772,3018,2688,3682,3870,3057,97,3023,297,2957,0,18,240,
+    188,2170,3366,4225,0,167,2670,226,3140,217,216,0,292,289,0,0,
+    3031,2712,3032,5334,0,0,0,0,6366,0,3019,2734,1606,2809,0,0,
+    1632,0,6203,0,0,0,189,0,0,3036,4590,0,0,6699,0,0,
+    1819,0,6353,2776,3040,0,0,0,1925,0,1964,0,322,2578,0,3178,
+    2787,2593,143,0,3150,281,313,3128,1604,3208,0,3043,0,310,1600,5566,
+    0,4271,1874,0,0,0,5969,278,292,298,2889,6451,0,0,2798,1677,
+    1707,4921,5765,180,4674,4893,4879,0,0,0,0,2724,2012,0,2964,0,
+    3319,2705,6415,269,2744,3062,4087,4060,0,3132,4657,288,0,303,2611,0,
+    1626,2987,268,5847,221,285,0,6721,0,0,4541,199,302,275,2479,2655,
+    5967,0,1876,3205,2375,0,4445,2954,2441,1886,4344,201,2516,276,1602,0,
+    315,0,2242,1601,2779,288,5536,0,5526,0,0,0,2855,0,0,124,
+    4975,2479,1610,2655,4058,4938,4207,3987,3162,3293,312,3218,3216,264,5143,3183,
+    23,4701,289,2527,0,2986,5326,3320,231,3143,183,3099,265,16,2030,4867,
+    2726,6749,0,306,2106,225,254,258,1608,219,3057,5142,190,317,188,0,
+    3249,0,3109,3917,1819,0,6251,2723,284,4291,196,2556,3238,1689,270,299,
+    2787,111,6022,6068,40,2501,0,119,0,1955,6074,281,2996,0,2218,5541,
+    2558,0,2622,303,7102,5151,0,0,89,0,2922,0,1602,2076,0,0,
+    0,308,3041,3327,0,2084,3238,0,4490,178,2672,282,0,78,0,2766,
+    2890,2813,0,6386,294,1962,2678,2470,318,4754,1745,2616,6395,3030,0,2242,
+    0,4227,0,2849,0,0,4967,0,0,0,5361,0,0,290,2402,213,
+    107,2144,280,1606,3162,4307,0,2975,2479,3085,3062,0,0,5774,2952,4651,
+    5849,5884,1631,3042,6420,1706,0,2865,0,27,2534,35,161,2502,4701,292,
+    0,2975,2337,0,203,1783,2680,2952,3240,2168,2160,0,155,256,0,0,
+    3832,2985,1743,2754,3054,2736,5364,2748,0,0,181,5222,5224,158,3031,304,
+    292,174,3107,6714,0,2468,186,2470,2284,2234,0,0,2932,0,0,2028,
+    0,0,5581,182,0,0,301,196,3560,2887,0,0,3261,3336,2536,0,
+    5097,3097,2812,2821,2472,2987,2999,3329,254,3047,2976,1887,3062,2825,228,3151,
+    144,275,2799,0,1879,0,107,5968,0,190,0,2102,2155,0,262,3110,
+    71,0,3304,0,5539,0,6352,2956,0,0,0,2677,0,302,0,2149,
+    4921,0,2502,25,2585,1607,3106,23,2788,2513,2710,3565,2006,2578,36,2836,
+    155,3019,2644,3172,49,2836,218,2524,2821,2205,5414,2777,2627,183,3347,3443,
+    3987,293,4870,256,1940,59,1880,5002,2908,2844,2512,1941,2947,2977,2611,7008,
+    29,2898,0,0,3000,4921,304,4922,3113,37,5968,0,4042,2920,13,234,
+    295,0,168,5826,0,0,0,0,4052,0,3030,0,2704,3163,0,0,
+    170,0,4285,0,2529,2702,282,265,0,2479,198,2636,180,0,121,0,
+    3063,279,3010,0,2878,0,4647,0,3443,2659,2966,2073,0,3304,2898,0,
+    3986,0,2601,3043,2499,2963,276,3856,2856,0,3106,4271,134,2652,0,2209,
+    150,2815,74,156,258,247,3294,5326,0,0,0,218,35,0,0,0,
+    0,6847,0,4682,308,0,5922,168,3308,1715,120,0,25,2102,3262,4240,
+    0,2374,270,3007,2725,5155,4866,5223,3282,147,0,0,2780,0,303,217,
+    6743,0,243,2667,1874,2855,262,5634,0,5370,37,0,1678,2941,0,4438,
+    119,2407,3793,5758,3647,2150,1690,2074,2138,214,4349,3398,277,186,2932,3337,
+    267,0,3605,0,0,0,2492,1689,3151,2801,0,2658,2468,4867,0,2721,
+    3141,1945,2649,2084,240,299,3227,2513,278,3194,293,3308,5781,6130,3987,224,
+    4429,3030,2943,2688,100,1831,305,262,2150,5032,2845,5141,1633,2811,2672,3794,
+    6022,274,6234,5810,1600,1831,0,2931,0,113,2703,0,132,3073,261,6721,
+    275,2514,0,281,0,0,88,0,0,302,5120,2966,4047,24,285,35,
+    1622,304,2557,201,295,0,0,196,4665,2648,3654,121,2997,2593,177,0,
+    269,3144,3030,3767,2744,3239,3602,0,0,0,2640,3317,0,0,3194,5010,
+    159,2736,263,0,0,0,0,184,0,3178,2882,178,3034,0,4921,12,
+    2375,2426,3173,270,6470,0,2878,0,0,2898,84,4308,0,7025,5801,2787,
+    0,0,2046,3108,228,277,3184,2999,267,0,3040,289,244,3142,5528,2416,
+    213,2239,2699,5780,0,0,270,95,2876,0,0,2910,5092,1700,0,4877,
+    242,0,281,1603,0,204,277,232,185,0,1742,0,2138,0,0,2668,
+    4225,179,0,2545,3876,0,59,0,211,3309,2976,1830,4748,0,292,6205,
+    262,2901,5810,4483,2738,2969,4800,3161,2736,235,2846,279,2562,1603,2579,63,
+    5664,253,0,1764,4466,1947,0,0,0,2217,3393,131,2748,2887,183,2281,
+    0,270,2866,0,5194,2781,2978,167,0,292,2666,2669,0,3150,0,0,
+    0,0,0,0,2304,2072,2504,90,0,0,4782,2660,2633,1609,0,4044,
+    3832,0,1774,317,5421,111,5010,4450,0,4438,3811,4922,0,251,0,244,
+    3025,2486,0,2436,268,5450,0,2999,0,65,0,0,4427,0,2300,252,
+    0,245,312,2980,263,4225,5541,5319,5333,2523,5088,3315,218,2899,1602,0,
+    238,6715,197,5602,1885,3227,1676,3337,3075,2704,87,3197,0,1781,271,0,
+    268,2674,3689,2865,320,132,5758,3042,119,84,131,7008,2337,4462,2093,3986,
+    52,48,0,2117,306,4612,173,315,2151,0,0,187,197,87,222,6852,
+    2877,2835,4564,2789,2242,0,0,248,206,1710,2722,4021,0,192,3007,2743,
+    0,12,4506,1743,2857,1764,5189,301,5099,0,0,0,25,221,0,0,
+    2953,2505,5750,251,4207,2645,2337,2692,3227,2472,246,0,2963,2505,5309,147,
+    3902,6686,5751,294,2513,0,0,3558,1885,5406,2619,2006,2293,2646,0,2802,
+    137,5277,3776,2722,212,189,1964,5536,5527,2615,1978,4840,266,3030,2703,311,
+    3185,2879,218,3134,2272,197,16,2548,3161,206,2923,2680,288,4216,4322,1963,
+    3262,2561,2132,3183,309,3010,176,0,0,0,0,0,1606,3356,83,0,
+    86,5831,3217,1697,86,2952,4264,115,3009,6820,3612,3307,1698,5882,2161,6202,
+    0,2010,3066,289,2545,0,283,1808,0,0,212,0,87,108,0,3557,
+    3273,3282,3282,193,2479,1613,5546,91,1942,262,5143,5590,2589,3151,1716,2626,
+    0,0,0,4921,192,3453,301,2765,5150,0,235,3990,0,5090,3100,3162,
+    3207,0,0,0,0,3910,4210,5536,2777,303,7020,0,4967,2414,1606,0,
+    2513,4050,2658,0,2713,1753,0,4491,111,298,292,1877,0,2282,298,60,
+    0,0,2272,2579,37,4216,0,249,120,0,0,0,5196,261,3903,4007,
+    1887,2699,0,2507,0,245,2944,0,2787,0,3284,0,1811,306,2681,6069,
+    0,258,233,0,5605,170,0,2946,1940,3216,38,3107,2776,4534,7113,0,
+    179,2301,1823,3654,3177,0,4225,1763,5409,2487,263,2853,5378,4207,1631,6137,
+    0,0,0,0,0,219,4263,2207,4885,0,2176,271,0,0,0,3429,
+    4945,261,1747,2811,0,2579,3140,3250,2965,3079,2636,1744,2798,2168,2536,2483,
+    2937,0,7356,74,6087,1941,2018,5306,4847,2912,6030,250,3218,3231,200,2801,
+    2636,260,6848,0,3129,2085,3135,3546,3295,1602,211,59,2534,0,2974,0,
+    198,2545,0,304,210,0,6195,3164,3566,255,2831,222,3326,2935,3602,2402,
+    3556,1743,0,6056,0,233,3031,0,0,0,5087,2270,0,0,0,0,
+    2625,290,2847,13,6102,0,2699,2997,0,0,2888,2518,212,0,0,0,
+    3382,0,0,0,2801,313,4812,258,0,0,4719,2605,2534,0,0,5553,
+    5690,264,0,241,0,0,0,3128,184,0,1612,2954,4263,0,0,2725,
+    3096,0,265,3317,144,0,182,0,6387,0,2867,177,1698,0,2822,196,
+    2282,7092,225,2178,76,186,158,0,2781,3285,2670,2633,3866,4344,50,5370,
+    2526,0,0,2910,194,2921,5120,3196,0,62,3197,2788,2996,2974,1706,3669,
+    110,3243,5536,3230,2617,0,0,279,212,271,0,0,0,0,2777,0,
+    189,2073,0,2875,6025,14,3144,3566,232,2143,0,0,0,3187,3263,47,
+    5115,3683,2971,2957,2979,0,0,0,3620,0,285,4007,2220,2624,285,208,
+    2911,5599,221,108,2655,1640,219,195,170,2746,2008,2960,227,311,2600,7148,
+    2931,6238,3112,1606,307,3150,3294,120,222,3206,217,2581,4270,1622,314,2627,
+    2353,2765,3902,0,5936,301,3033,1677,0,15,271,233,2793,71,0,5416,
+    0,108,0,249,0,0,0,0,2737,290,0,260,0,0,0,0,
+    2603,303,83,137,0,223,0,0,5662,140,0,2516,3130,1819,5307,0,
+    0,2859,2168,121,2028,2926,2613,2701,258,3261,0,0,3253,0,4500,2930,
+    1874,0,2628,2870,3086,255,113,5481,3245,2777,7037,4262,2846,0,3085,0,
+    3449,2690,2547,236,135,3909,2027,5250,3052,0,178,0,2481,0,1608,2363,
+    5626,3168,3205,256,6498,0,2767,0,262,1978,0,2966,3042,3129,1641,149,
+    1607,0,0,0,0,0,0,5470,211,0,257,0,3382,0,131,0,
+    0,3129,2524,0,2853,168,38,2777,0,0,308,0,2998,2359,228,0,
+    266,2404,5636,5106,6033,2965,1970,2991,4906,0,4439,0,0,203,2028,12,
+    3298,4013,4981,262,2480,217,293,3547,3139,248,226,85,132,3007,2602,2645,
+    0,6416,0,310,236,0,1944,5253,0,109,316,2432,2645,2472,202,1853,
+    254,202,235,3372,3007,4218,4086,4263,202,322,0,1970,3033,168,6257,148,
+    2615,1875,6862,252,283,302,1912,1707,5421,175,301,2920,4665,188,1603,236,
+    4307,0,2271,2075,0,4123,2953,6748,0,288,0,1743,0,2894,3228,230,
+    2350,0,0,0,172,0,2480,304,2767,1838,3163,0,2997,210,0,2616,
+    4151,2072,197,134,5150,2044,226,1952,2871,1609,181,65,0,0,2910,0,
+    3766,0,0,3074,3250,3283,0,311,95,0,172,6203,3315,289,2480,252,
+    87,214,36,2931,2030,5782,5747,2357,3107,16,2063,2793,2524,11,2611,6800,
+    144,0,5825,7025,298,131,0,2113,40,133,2282,3251,171,3272,3264,202,
+    4960,0,0,0,2732,1904,0,0,1689,0,0,2468,3346,3122,3099,45,
+    4492,3196,0,4342,3150,0,0,0,120,0,0,2244,172,0,37,1600,
+    270,64,36,187,4050,0,3822,0,2338,295,122,3106,2730,2926,2952,1964,
+    175,291,0,2743,0,0,1609,2699,275,0,121,0,2076,5966,135,2736,
+    96,0,4264,3172,0,1602,6352,4713,243,96,3264,308,2790,1613,261,61,
+    3141,2013,3035,3196,207,2017,0,3997,0,270,2969,2832,0,72,0,181,
+    0,178,0,0,0,295,0,3249,6102,3091,0,0,315,0,14,71,
+    2545,2920,2468,160,1604,4483,2215,2250,2469,5309,209,0,181,0,2423,0,
+    4101,0,1971,1708,0,250,0,181,278,7237,1677,2550,3206,209,0,48,
+    3009,2581,110,0,0,2758,0,0,0,0,0,96,2691,0,2769,144,
+    1898,6273,251,23,271,2518,1688,2495,1600,78,3997,4669,3084,3239,5828,2472,
+    6700,0,0,1810,0,3057,3233,2778,2604,0,0,187,2017,5593,5811,5470,
+    1809,60,2270,0,243,2661,2853,262,157,260,206,3044,301,2822,2689,241,
+    1985,202,300,3041,228,2359,3875,188,3062,2006,3053,3996,2234,3887,2889,3228,
+    6954,0,0,0,0,273,0,263,5086,4262,3785,0,1812,2600,0,0,
+    255,5889,0,2514,5985,0,0,3229,0,304,0,3867,2205,0,37,2989,
+    2856,76,3150,52,279,143,4821,156,3020,133,3023,258,237,3839,6032,252,
+    6359,3272,18,2758,5141,316,4670,303,255,284,147,269,243,2811,214,2963,
+    0,0,4385,143,0,6316,0,2682,0,0,4020,2216,239,0,6295,229,
+    175,5526,309,51,4278,5985,311,2832,2608,254,1606,133,2798,0,3064,2483,
+    0,0,18,234,0,0,5810,315,2898,4483,0,308,0,0,48,3557,
+    2946,0,0,2848,2801,220,1896,6030,92,0,0,0,6366,5586,108,0,
+    147,2153,289,2425,0,3207,2867,182,3315,11,4437,3867,3997,180,4482,3030,
+    0,5781,3261,3452,0,282,0,5996,3548,167,2609,5884,233,3209,77,60,
+    198,182,101,3087,4218,0,5415,85,2678,168,307,0,0,1819,0,2886,
+    0,0,200,3992,0,0,0,300,2613,190,0,249,0,0,72,0,
+    0,0,158,2494,65,0,0,3234,1941,155,5641,167,2931,3106,4656,0,
+    5855,134,4015,2210,91,3839,3121,4967,2611,7346,256,2367,3142,306,3175,2767,
+    25,1879,4783,4528,3163,3176,3084,169,2865,3220,121,3546,2744,40,2679,2744,
+    47,2679,289,310,28,16,287,2996,2084,173,1605,2853,2669,2441,1715,14,
+    5862,2501,253,4441,4058,5091,172,85,2782,3010,0,121,2942,3143,4924,3274,
+    3230,0,0,3062,200,0,3316,235,0,3238,2482,3253,210,0,0,312,
+    2833,286,5108,2483,5536,51,2842,2582,269,4569,175,0,2823,2713,3023,0,
+    4816,3551,0,268,2798,0,0,36,5590,0,2688,0,0,0,0,282,
+    177,0,2646,1700,3228,1679,3119,5581,245,0,0,0,0,44,1678,96,
+    35,5716,0,2017,0,232,251,0,4314,0,2842,5985,0,0,3260,0,
+    0,26,5087,0,0,60,2151,0,0,0,0,285,2996,76,1811,1821,
+    0,0,6472,0,3241,0,0,2008,0,188,3196,0,7117,292,0,175,
+    3262,3079,0,0,4648,0,0,0,0,169,3989,2618,2546,3610,1608,3018,
+    0,3219,12,3041,2605,0,1677,4982,3626,0,3054,41,174,3558,4264,28,
+    0,0,0,2856,268,85,4617,224,3000,12,4878,285,0,0,6074,7217,
+    2504,3162,0,5780,310,0,3581,72,0,0,3208,25,0,0,3603,2612,
+    313,2627,264,3035,6115,0,210,3216,0,2965,3097,3662,0,0,148,1878,
+    219,171,35,2733,3988,0,293,156,3197,3195,2756,193,3152,2523,3119,0,
+    3780,31,3071,0,4482,2545,3689,187,5251,120,182,3305,1621,5600,2423,3631,
+    3619,23,281,6358,175,205,0,3009,0,231,54,1606,5774,238,3567,0,
+    3987,4481,1603,2712,3030,1692,4772,3383,304,5223,5547,181,50,2777,3128,193,
+    214,3881,0,1952,2668,0,194,1698,2194,0,102,0,0,0,108,0,
+    238,131,5230,2505,3144,5325,3405,3238,3628,222,229,4343,107,3309,3183,0,
+    1875,0,3035,4207,0,0,247,2889,4673,3111,0,0,3210,6295,3140,0,
+    2205,1985,2790,3354,266,212,0,174,73,177,3131,1819,0,2525,147,148,
+    3785,2358,32,315,2423,35,2842,256,3152,2496,2812,280,2673,2976,11,4261,
+    2921,0,4314,0,0,1951,3029,1603,182,2941,0,2893,279,2292,319,3266,
+    3882,2691,97,225,2515,0,50,315,1782,5749,4491,219,1600,1849,137,3216,
+    2150,0,124,4903,0,267,288,5756,280,6689,2590,2776,0,158,5306,172,
+    85,253,5971,0,3048,2974,3632,2484,5947,156,0,2510,4392,0,214,0,
+    17,5097,2655,5611,2835,0,237,0,226,0,0,2377,6109,2602,51,3612,
+    1699,108,41,2678,2206,201,0,59,5662,1812,1679,2743,2292,0,4536,0,
+    5711,74,143,6498,267,277,1687,1941,0,4702,3275,5223,4736,2018,2215,0,
+    2217,0,5096,3107,5749,180,2480,3102,0,0,3277,0,264,2139,86,27,
+    0,0,5088,0,3085,3271,201,2633,0,161,6136,2699,4428,5120,2987,0,
+    0,2021,27,2931,3272,1814,2337,2832,0,0,2072,3009,2666,6240,293,0,
+    4575,66,0,5036,0,0,0,0,2414,224,2856,294,5317,1772,4071,0,
+    0,3305,3205,0,0,260,2152,0,0,0,5371,0,2498,0,5567,2894,
+    0,279,1763,15,2754,208,0,2791,1982,2996,0,119,3031,3611,223,2788,
+    0,2835,196,27,198,3868,160,0,0,190,1611,0,1953,0,6215,181,
+    2046,3119,179,2722,0,2999,5711,2215,0,2975,1689,1808,0,4014,232,1772,
+    120,156,1819,25,2506,290,4977,1697,143,3045,2501,1941,5581,1697,2758,195,
+    39,3328,2766,5158,3043,3263,4482,1886,2644,2281,2423,0,2512,0,144,0,
+    301,0,5802,0,0,258,2018,0,0,107,23,2403,0,3220,258,3240,
+    0,1699,2205,0,1888,2551,0,1895,3285,3610,307,0,0,312,195,0,
+    2712,3778,4974,4584,0,2578,264,227,0,2138,0,0,2765,310,0,0,
+    3140,3042,0,6331,5051,4650,219,3030,2336,0,0,4712,2737,0,0,248,
+    200,0,6473,2473,5409,201,2939,6590,6350,5442,0,2039,51,5378,233,3776,
+    177,0,2810,6555,2711,262,5812,3311,2986,2349,3233,1600,0,0,0,1605,
+    2524,5340,3353,235,2787,3263,61,2722,2523,87,235,2655,2898,1602,2700,5626,
+    2353,5932,3124,3262,2831,2479,304,234,2835,6136,3260,255,5387,0,289,2630,
+    2523,2702,168,309,5530,2590,5529,5549,264,278,6351,3217,293,2517,47,3156,
+    4527,21,7016,49,40,278,2909,0,0,2337,194,0,2645,3111,6484,4439,
+    0,0,6189,2919,2832,0,0,240,3096,1606,5449,5087,4262,5966,5583,235,
+    2833,312,3174,119,189,109,0,14,2482,0,259,204,1886,3238,0,5786,
+    0,2138,0,3330,5549,282,0,0,317,0,0,0,3625,2875,2503,263,
+    269,3043,2930,176,2547,0,0,0,0,34,3218,2733,0,5971,2039,0,
+    3129,3668,2341,4124,126,1611,2242,5361,62,1849,4878,2291,3229,3041,2988,2526,
+    0,311,294,6023,0,2744,0,2802,2492,226,3164,2751,0,3238,5009,215,
+    29,6038,2969,1614,0,0,4087,0,2837,2403,5235,5805,2974,0,0,0,
+    3438,2512,176,4922,4968,2292,2546,2909,2559,5545,205,78,11,29,78,256,
+    75,311,110,191,4893,2656,214,3987,2893,4674,287,2205,4669,48,4096,226,
+    6240,4887,2028,5445,2783,2524,2204,2734,2556,2336,219,5969,2432,243,2799,6351,
+    3802,0,320,1604,5171,3128,0,1980,7346,2424,2974,3293,2145,3196,2616,0,
+    2634,0,3462,0,2006,2492,180,0,3019,2469,2481,3304,0,0,0,2894,
+    2468,0,0,318,2738,0,0,0,2151,0,0,0,206,0,0,4868,
+    3239,3573,2800,191,306,289,2944,0,0,3240,4570,0,2777,4878,0,3252,
+    2661,1661,4006,270,314,59,0,2481,0,4922,4710,0,2512,2754,1605,3305,
+    4321,215,2810,3238,0,319,3209,2898,3174,0,2886,3327,4543,3084,5746,1874,
+    3920,2878,293,4646,283,308,258,157,280,0,3824,0,47,5527,2999,0,
+    3076,84,5976,4646,1606,287,2622,258,320,2514,2596,6045,2921,2814,0,1601,
+    0,2914,3834,3662,3573,2909,0,0,1607,185,2812,2560,2625,0,2738,1941,
+    0,3052,292,199,3548,0,0,0,0,2711,0,5529,2835,2986,2901,1788,
+    0,2888,2831,201,0,2468,4241,3030,244,3296,0,2666,6388,2337,147,4429,
+    0,2945,0,243,0,0,2857,1612,320,4666,3078,2987,4490,236,1943,269,
+    0,2556,5308,262,3141,4381,4931,2402,3175,0,0,2644,0,3186,177,3613,
+    199,279,47,0,3163,0,0,239,199,4870,0,2737,91,3161,5765,3051,
+    2833,210,4966,2771,4923,256,3293,214,0,0,0,0,312,0,2538,2469,
+    241,6396,4868,158,3032,2490,48,233,98,2579,3097,176,219,2501,2842,294,
+    0,0,0,0,2964,0,0,220,2617,3051,2292,0,0,2666,0,298,
+    2941,0,201,248,0,267,283,2483,266,2711,0,251,2350,185,2273,2658,
+    0,3991,2017,0,0,221,0,0,2920,0,284,2567,293,2659,216,4569,
+    180,2308,131,0,2524,0,0,0,2581,315,3785,2875,0,205,0,0,
+    5787,76,4041,3053,283,6722,0,0,181,3227,171,4006,1601,6888,2964,2525,
+    2977,3271,4930,0,4895,0,0,1825,0,0,5776,0,279,0,0,4562,
+    5766,2602,293,2440,0,0,0,0,3271,0,5836,0,169,2501,0,2030,
+    251,2655,2492,1687,2073,5530,231,86,0,4234,7098,98,0,2336,0,0,
+    3030,2798,97,2469,5309,3219,127,252,20,3326,2404,180,0,308,4922,2936,
+    0,205,2831,0,0,0,0,0,199,4651,2864,0,194,2910,211,172,
+    143,0,2723,0,0,0,3794,0,244,2614,0,2689,2357,0,296,2226,
+    0,4482,5230,304,186,2847,2103,0,4449,301,186,220,0,299,3882,191,
+    0,4901,2545,2103,3355,2989,1880,2943,2913,38,136,3400,4446,192,235,2854,
+    0,0,0,77,0,1600,3777,0,3240,0,27,2670,214,3069,0,0,
+    2517,2527,2955,2404,2611,1966,2881,219,3056,178,7025,5151,314,0,146,313,
+    3174,319,0,2492,158,2959,2534,3172,2822,83,0,3603,2490,3041,303,3068,
+    0,0,0,6359,2716,6389,0,2768,2843,2589,2910,4287,260,155,2678,3274,
+    0,3383,313,1608,1610,0,3250,0,2470,3381,2644,2581,107,279,220,176,
+    0,5592,4945,2601,3044,3172,59,4923,2776,2523,6362,0,0,216,0,2936,
+    0,6827,0,87,0,42,0,2975,2956,0,198,0,278,0,0,0,
+    0,4225,319,0,0,227,4065,2910,0,26,2161,72,3124,0,2282,0,
+    5758,65,3217,3776,2710,2733,0,0,147,3989,239,186,5385,2543,192,186,
+    2350,2062,5363,294,4342,2953,249,3163,1600,1954,139,24,6131,4355,231,4482,
+    6729,2403,3315,0,0,2759,5545,175,0,4893,0,4934,3546,297,186,0,
+    0,3684,2242,60,3996,2831,147,258,0,4656,0,0,4130,2757,0,0,
+    2913,0,0,0,0,2159,0,0,0,0,0,2743,0,0,0,131,
+    2110,0,0,5316,0,168,0,0,0,6679,240,143,0,104,2831,110,
+    0,4702,3228,0,2185,0,0,301,0,2423,2226,0,0,2545,194,0,
+    2936,0,3276,3014,2644,0,4931,4483,300,0,155,2776,2546,266,2170,121,
+    12,2558,2876,2655,0,5108,4683,0,3066,2656,2615,0,313,0,0,3239,
+    2340,7098,5159,2482,2432,1953,0,3227,316,2612,2916,2502,3464,1743,175,4886,
+    0,0,2413,0,0,0,0,0,2416,0,0,0,0,4217,2507,3561,
+    2427,5362,0,0,0,5414,4058,181,1809,0,135,0,4427,1610,3261,0,
+    1840,2865,2339,2558,3117,184,195,4008,4648,4171,2964,5472,278,0,242,307,
+    1874,3091,3172,1744,2768,227,2713,2745,0,2768,2740,59,0,0,47,0,
+    220,3566,5560,48,0,5584,59,1608,6030,120,0,155,2514,0,0,207,
+    2481,5361,0,215,0,0,2802,298,2559,5311,0,2160,0,0,0,0,
+    2766,4498,3878,5097,317,1876,3117,208,4088,167,2800,2151,2623,1606,2375,2935,
+    2475,2523,3220,252,109,0,0,2474,2512,4426,5996,3766,2898,189,4547,4968,
+    2614,267,2760,2788,4436,0,183,0,0,2085,5886,61,2644,1624,2546,3088,
+    245,3231,0,3054,0,7015,4535,134,1773,4447,6033,3469,0,239,47,2483,
+    5591,253,0,294,5810,5312,2864,1754,4657,2722,2337,0,2884,5643,0,2644,
+    181,0,2271,3217,0,5286,0,225,3249,2524,0,2779,0,295,2757,0,
+    0,253,4923,175,0,2561,0,4482,0,0,249,0,126,0,0,0,
+    2754,87,2503,235,3121,2293,4089,2020,0,3107,3186,97,0,6074,0,2744,
+    3383,2666,3249,2153,310,48,3490,5415,2943,4285,2820,119,2701,3073,3092,3238,
+    2037,4227,3007,3175,4013,171,1810,248,2402,1700,49,2959,2243,294,2690,5442,
+    0,220,4272,0,2512,220,62,3626,95,3587,247,2769,203,3161,36,2657,
+    3063,3610,3832,0,0,1914,3989,1633,3140,2103,3240,5371,0,1687,6231,200,
+    2036,1744,2864,2737,2604,4005,3274,1874,0,0,5230,2869,2296,3074,0,2525,
+    0,2963,1941,2541,3110,279,235,0,2595,3128,2644,5820,1877,0,2103,0,
+    6560,4718,2490,2726,2336,3143,4112,2850,49,229,2204,2339,47,0,71,2501,
+    0,2667,2679,4974,1963,3338,0,5141,0,1765,0,0,0,232,0,6112,
+    3316,190,5976,0,5545,190,0,5361,4278,5825,2583,3073,197,4455,2404,249,
+    2627,264,0,0,2479,170,5224,278,2404,2965,2595,2716,1607,2953,2705,0,
+    2569,4152,143,2634,177,3095,6753,2979,0,2812,4426,0,265,2964,1633,1876,
+    33,3310,0,218,5765,134,3164,0,2887,1967,0,1715,0,75,0,3154,
+    0,2858,0,1611,2517,1831,2243,0,1600,0,2622,124,144,5611,5442,0,
+    5825,1677,3250,0,4564,31,132,279,3196,5985,2843,6479,299,5406,0,2611,
+    0,0,0,0,5528,0,0,0,5591,0,2433,0,4013,173,3306,3262,
+    181,5536,2931,2339,5995,3387,292,2534,246,2539,5160,2204,234,4042,0,322,
+    0,4272,2540,3838,4151,210,0,2546,0,2128,2337,6693,5582,2710,185,97,
+    246,227,0,314,2931,3721,2479,174,71,310,2612,0,4499,72,320,4014,
+    2086,2655,234,4321,1687,272,3253,3915,253,2272,2558,4656,2889,11,168,5967,
+    260,224,228,0,4657,2472,2667,2038,0,3780,0,2601,1868,0,0,0,
+    317,3957,0,0,4719,84,0,2985,29,268,3139,270,2675,6117,2402,4086,
+    0,3117,0,198,2441,190,6415,3195,0,3217,4371,3053,2513,285,207,210,
+    38,0,3098,2017,3793,307,4767,261,3117,2831,1970,2689,15,0,2282,0,
+    0,2414,83,2523,0,2823,3101,207,0,201,0,2933,2216,0,3216,0,
+    2909,2833,2525,2734,184,3319,4657,144,156,3556,2482,3043,0,256,309,0,
+    188,227,26,6576,5781,224,300,2920,249,3631,3328,298,0,36,0,1610,
+    0,301,99,2999,3274,0,208,3130,0,0,5308,3063,4526,1603,6030,0,
+    228,267,2941,0,0,197,86,2700,0,0,219,0,0,26,6555,1643,
+    232,1688,0,98,2832,0,0,3251,0,5555,3062,3601,0,0,0,2018,
+    0,283,0,206,2735,5811,319,5756,2952,5223,0,277,2778,0,0,0,
+    2205,2971,0,0,1603,0,7097,195,0,2611,2428,6500,2208,215,5539,3272,
+    3988,3032,2811,145,47,3066,3787,1603,302,2657,2802,287,2021,1970,3118,304,
+    0,3047,4095,2745,1956,288,5769,267,2293,123,0,0,275,1612,0,2909,
+    6109,47,173,2402,2084,3547,3022,267,2347,133,72,3222,1609,2727,3293,302,
+    319,184,4945,1812,4265,2507,2798,2988,2524,2613,3219,1875,2765,24,1754,71,
+    2548,6251,3220,3195,2889,282,2546,3062,2481,4746,2160,127,3184,309,3298,1601,
+    2357,2286,0,223,0,5803,5751,0,3284,0,311,5229,2699,3882,182,0,
+    2413,0,2788,221,0,241,1810,254,0,3195,2485,0,2626,0,298,2627,
+    2677,1605,0,284,0,201,2649,4096,2710,0,5896,6826,320,300,3381,0,
+    236,282,2084,233,6387,3548,208,3064,4527,1606,245,3993,192,285,5056,3304,
+    2029,3297,2638,195,5406,2205,0,3040,0,3251,271,257,0,0,4921,0,
+    86,0,1887,2339,0,223,2473,2759,0,0,0,0,299,218,0,0,
+    0,0,0,3556,2722,0,0,0,1663,3320,242,0,95,2656,3339,0,
+    0,300,262,1606,2084,221,1612,1885,251,36,4570,0,3986,3252,3260,1921,
+    2810,0,3285,0,2903,76,258,194,0,2678,2757,2560,0,2715,2933,3329,
+    3084,0,314,1756,3088,3207,2944,2514,4666,263,3036,1809,3276,64,1875,0,
+    253,1607,301,85,249,0,3162,2096,2072,4123,292,7217,0,307,5456,3181,
+    0,3275,220,2425,3305,0,303,2763,3029,6386,1744,0,2798,0,2366,0,
+    4436,2656,0,47,3029,291,2640,2712,52,2646,4454,3117,0,0,2441,2959,
+    2617,5372,0,2590,2792,0,256,0,3996,0,5641,2944,0,241,0,39,
+    2635,2017,4058,2402,3315,3114,1601,4885,3293,0,0,1853,6267,3434,4207,2276,
+    2341,2765,158,47,5584,2746,3011,3288,0,3084,0,0,170,2479,0,2990,
+    4345,181,3117,229,3129,2748,3231,1895,3546,2790,5747,279,3163,275,5775,1606,
+    3019,2540,0,3095,0,0,314,0,4208,107,3447,3042,2690,2226,2501,0,
+    2219,181,5910,3250,1808,0,111,245,2168,292,37,3300,3346,234,2688,2634,
+    261,3117,0,1687,5186,5847,3040,0,5781,2754,187,0,1755,3150,2844,3611,
+    2538,3022,2881,5450,2549,75,4755,16,1841,2168,3056,146,2601,64,1606,5803,
+    0,0,143,3778,2997,2616,224,238,1763,3106,0,2908,3168,0,173,2836,
+    2138,1744,1874,218,1955,276,1601,2820,1986,2745,3208,3273,27,280,3867,2666,
+    6715,1832,258,2141,0,0,194,125,131,2622,0,0,2966,5361,0,271,
+    3646,259,308,1831,2999,3307,302,84,2952,7217,2867,289,6811,3239,2291,2600,
+    4225,0,284,0,2814,5662,3077,3021,3117,311,3097,0,3078,3097,252,146,
+    2821,0,0,60,235,2756,3557,3569,0,6744,148,0,3936,4612,0,2255,
+    0,0,0,192,2515,3573,0,0,2519,2538,2771,6554,0,0,4938,2316,
+    6688,297,0,71,0,0,0,0,3068,0,0,0,0,1608,5143,157,
+    0,3302,2423,0,1966,2646,195,36,3096,2909,1687,2617,2725,2007,5592,5316,
+    3053,6001,3174,4656,230,2149,283,1847,2613,2766,3011,239,2600,4772,3294,6908,
+    4646,2496,2602,230,3188,2553,4447,2831,1609,162,131,2556,3073,3196,3096,2545,
+    97,4426,0,5810,2591,6188,5562,0,1722,4407,287,314,2139,0,2624,169,
+    3055,0,221,297,2534,0,112,224,0,4446,0,0,231,3262,2865,1954,
+    2243,2812,1775,3140,83,1874,258,0,5325,0,0,3140,0,0,2557,5969,
+    0,14,3273,0,2624,0,168,2177,0,180,0,3058,0,2469,7106,5159,
+    2140,0,0,4429,0,2789,0,188,3556,3045,2745,2513,0,0,2244,1621,
+    199,3601,2732,0,2861,243,2964,0,5009,2978,2589,0,1885,0,2093,1942,
+    0,0,0,0,0,0,2368,0,214,0,0,2534,0,0,260,0,
+    2865,0,0,1765,5316,0,5599,0,2782,306,2635,299,0,4505,38,2776,
+    84,2008,0,2414,0,0,0,223,1767,2876,0,0,0,3018,1625,27,
+    144,0,72,6194,2667,1940,180,14,0,0,2976,0,2733,239,219,129,
+    1951,231,2770,2932,1743,2981,5993,5406,3294,3162,176,3062,2623,303,2746,2968,
+    6680,75,2953,243,4087,0,0,1745,2270,2580,35,3996,305,2415,2974,3030,
+    2781,2806,231,3119,0,63,300,0,0,0,0,0,0,5526,312,3031,
+    0,2234,4661,0,3896,1953,3073,2802,2936,0,4816,3462,0,0,316,7021,
+    3007,76,2490,214,0,0,282,3710,0,4712,215,0,3103,5759,2942,0,
+    3796,208,2836,0,0,0,0,109,0,2538,0,2847,304,6194,0,0,
+    0,3491,0,0,239,0,0,199,0,13,2524,3128,0,0,3785,0,
+    3133,2402,214,216,86,3426,0,198,3931,2008,5553,1920,3384,3152,5751,0,
+    3316,110,276,0,274,0,2732,107,2788,2611,6279,0,2270,191,0,0,
+    0,0,0,0,0,0,0,0,0,2703,207,2724,144,2804,2595,2732,
+    177,0,0,0,270,197,0,243,4563,211,1607,2932,2281,4493,1679,4261,
+    0,0,2690,3283,0,2755,3217,3130,2996,6680,4712,109,0,261,184,0,
+    1754,0,144,261,1678,2789,3173,3141,0,3361,2700,2270,0,2800,2678,1854,
+    313,0,207,190,2989,6686,0,190,0,1839,5143,4161,3242,172,2504,2670,
+    3612,3601,2433,61,1896,2534,0,2684,275,197,227,0,2085,6365,2593,2006,
+    3219,269,1943,3619,299,3787,2975,5306,2301,189,71,3275,2348,1970,2546,2310,
+    3054,288,3007,179,3029,0,1821,0,1697,2903,5528,2821,1846,4150,3019,257,
+    4072,0,4754,4569,5765,2876,5553,277,12,2745,5848,2833,217,156,2471,3821,
+    92,194,2729,288,0,124,0,3128,1946,194,5746,0,0,0,262,2605,
+    4746,124,1607,0,4129,0,2771,2765,2908,0,274,119,2963,212,0,0,
+    0,2677,0,5765,2557,210,2404,2140,3042,2976,3153,3987,3621,206,2406,182,
+    2535,6806,2273,236,3029,4031,1885,3282,0,2864,2958,192,3052,2767,3319,6066,
+    288,0,0,6425,2886,2668,2163,0,6862,1821,2413,167,5002,2765,6232,297,
+    1742,2490,5105,110,2073,2985,2543,5831,0,0,6273,6372,135,2801,3096,2875,
+    59,3447,1944,0,0,3095,0,0,0,0,313,3184,179,6715,0,195,
+    1677,0,73,134,0,0,0,3989,1889,4051,0,0,3162,2483,5177,2282,
+    83,307,300,2921,186,3263,1941,2403,0,0,231,2724,2644,0,0,4271,
+    2150,1747,1607,2583,190,107,183,175,2930,232,2558,0,5159,203,2759,0,
+    3398,3142,0,5649,4866,0,3646,6196,190,2568,6001,2633,285,7092,0,2867,
+    5547,195,0,1690,3066,2813,1742,296,2941,222,0,211,0,0,4262,0,
+    0,0,2074,1942,4227,2501,0,0,234,214,0,6209,0,0,5747,2667,
+    0,319,4966,0,4482,77,4086,245,2405,79,0,123,3315,3109,1744,37,
+    5122,302,317,1753,2996,3184,5653,266,319,85,3067,2602,297,2887,285,2876,
+    303,313,5250,293,3227,4430,0,127,4646,119,0,0,2668,6354,0,5470,
+    5188,0,0,4791,2679,2490,262,3557,3066,4307,4218,266,2303,3426,0,272,
+    0,3041,3174,1700,0,1849,0,36,3565,0,40,228,3785,87,2787,2861,
+    2036,3060,0,158,1810,0,5634,0,242,63,249,0,1602,1904,3052,2782,
+    6829,199,110,185,0,2592,4316,259,0,207,310,0,2919,1722,197,297,
+    2561,51,2679,0,2853,4208,2600,0,0,0,3128,2272,0,0,305,0,
+    0,5746,0,3394,1603,1709,1860,3020,3835,6555,168,272,1783,3021,2300,0,
+    0,2526,170,2538,2677,3227,2748,2996,2138,3049,2591,0,2798,3305,4878,6246,
+    238,3227,0,4351,0,2504,2942,158,171,3099,0,0,48,2426,38,2433,
+    3767,0,96,0,0,0,0,6699,0,0,2216,2524,170,292,3283,1607,
+    158,4266,4506,224,4923,245,4370,14,317,3200,0,1904,0,2384,0,0,
+    0,0,4430,3207,0,0,5691,3874,309,5774,170,3333,3250,2900,4562,4315,
+    2869,264,2568,3109,0,263,2952,5151,278,2725,55,3427,123,264,0,2528,
+    2758,1972,4014,7035,5097,2700,2870,313,37,4275,2526,2249,5749,5756,2976,0,
+    2512,2417,3331,240,271,42,5768,6372,4782,1602,4658,6075,5885,2592,174,5382,
+    2545,4666,6022,2877,265,1753,132,235,273,5566,4216,5105,2779,2989,316,3043,
+    187,2206,3194,3527,3020,2321,2595,2357,98,3024,3294,2835,5186,1746,226,167,
+    5758,1887,303,2724,2538,2603,1808,2645,2864,4580,281,0,192,140,3018,4043,
+    167,209,5591,4646,0,2423,300,150,0,1612,3305,4124,280,2776,180,3055,
+    3064,5553,0,95,3174,71,287,38,3053,4123,3273,71,2666,4206,168,4811,
+    3808,0,197,2858,11,5756,0,2924,4042,0,0,3399,1707,5612,2470,1874,
+    3096,2721,0,4563,0,3123,1812,0,2479,2886,1698,3603,2164,4511,157,1621,
+    320,0,2539,0,320,4306,3020,2977,2348,193,1974,2338,4426,207,100,3194,
+    174,47,2996,223,5581,1602,3480,3712,306,220,144,1604,74,136,3229,63,
+    2300,2974,5165,3295,206,2699,315,5319,95,1727,2688,2890,2942,3316,1814,66,
+    0,2689,124,176,0,3186,0,1632,2603,0,0,1820,0,0,75,260,
+    0,0,2611,0,1809,0,0,0,1905,4718,2149,0,0,0,3824,0,
+    298,5096,0,0,0,5977,3426,0,5002,0,0,0,0,0,3195,0,
+    0,197,0,0,6699,2887,2946,0,0,2560,290,0,0,0,2883,4816,
+    2249,1985,3128,0,2074,2357,293,3097,5126,3173,0,3832,2921,3354,315,204,
+    247,74,127,5567,223,2844,3243,2679,14,144,2417,3172,2682,4885,84,251,
+    231,2216,4350,0,1951,2871,0,2608,212,1763,2810,3142,2579,2272,2810,0,
+    134,0,3207,2916,4711,5374,0,0,48,0,0,0,1753,3567,3062,5977,
+    2735,2987,280,2766,6534,3139,1677,3128,234,4526,301,305,2746,73,3288,6909,
+    0,0,0,2787,0,37,0,60,0,6371,3996,3044,0,6031,0,6231,
+    0,2547,0,0,5143,310,0,2834,3207,5547,2418,2706,2724,5189,208,0,
+    4059,1678,0,262,0,0,2710,4877,236,0,174,155,3052,282,0,247,
+    0,3066,0,1600,264,0,4575,2990,2944,1604,2821,0,0,0,73,0,
+    0,2615,1799,5190,4970,0,0,0,4668,5758,6974,2964,0,0,240,4877,
+    3139,272,16,284,0,262,0,3254,207,0,5159,1613,2567,207,4790,320,
+    134,2799,49,0,1607,3191,2735,0,0,0,3173,2778,0,232,2688,1951,
+    47,3051,1697,1604,3732,6202,3767,227,0,2216,1650,6723,4274,3040,4754,2847,
+    1603,4703,66,2468,5598,1611,144,2138,192,4931,196,5583,1744,240,3772,171,
+    2747,4005,2302,2899,0,318,3786,0,267,1875,2469,3121,0,178,243,0,
+    1879,224,2787,2689,2772,3084,319,2732,174,5141,2404,1634,275,2898,5087,2366,
+    2754,0,0,6699,2847,2920,268,0,2490,2008,2826,0,0,0,0,0,
+    2548,200,72,2820,2501,1622,62,2964,3194,2712,1605,2602,4278,0,0,259,
+    0,0,0,2869,2282,0,0,257,2272,0,3150,0,2936,0,0,0,
+    0,3831,282,260,147,2538,0,3229,1649,1810,2604,3010,139,3121,312,3022,
+    3084,268,2941,275,232,2689,2520,2969,2487,3085,3206,4749,3084,169,2493,2404,
+    52,5538,2789,1708,2760,3776,2832,1963,3084,62,1690,3271,3469,2540,4681,2638,
+    3767,281,0,2876,0,2349,13,214,0,2506,4768,4426,185,0,198,2956,
+    3062,0,0,3051,0,2921,3411,0,5752,305,182,2406,2875,253,177,288,
+    191,304,3327,247,195,321,155,2503,4605,253,5787,296,12,220,5825,221,
+    0,78,3185,99,169,0,4658,180,4123,201,186,2700,202,253,238,3603,
+    0,0,132,4124,2340,192,5861,1925,2721,0,2567,0,0,0,6472,5347,
+    0,3711,267,0,2909,2110,0,167,1757,64,0,215,276,0,5444,5554,
+    2513,1606,4490,3787,4094,2743,2974,180,2702,3118,2954,0,5590,279,3326,0,
+    4758,0,1602,3470,1971,4349,1608,4291,2823,60,0,183,4151,2941,2274,305,
+    215,0,0,0,0,3024,0,2855,285,3249,318,4902,3150,2999,64,3274,
+    3225,227,2270,3141,3141,1876,4349,213,6695,2947,5150,3317,200,1970,2494,4265,
+    0,2300,5664,0,306,0,242,2727,0,5665,0,1607,1621,2036,2308,5120,
+    0,3428,0,0,3264,274,3297,3074,0,2882,237,0,0,0,2168,0,
+    271,3144,0,0,204,87,0,0,5546,2491,261,228,0,0,4031,1793,
+    5889,1875,107,306,0,4187,228,4206,0,0,3089,3107,178,0,0,195,
+    0,6187,4719,0,0,123,25,1745,5105,0,2825,322,244,1688,73,2615,
+    0,5773,0,1925,4448,5351,0,0,0,5105,5773,0,0,321,0,199,
+    6682,0,2987,4135,2755,4466,234,2539,256,0,5106,2814,2899,209,119,0,
+    6566,3732,0,0,246,12,0,40,237,186,278,0,5121,1915,5967,200,
+    47,4466,242,145,2834,2615,5222,2479,3073,2138,1854,3845,2977,2315,2766,6082,
+    84,3294,3625,2721,6470,4218,61,3297,7162,2274,2093,2204,253,264,2423,251,
+    5766,204,144,3208,1600,2723,0,0,120,0,307,3040,3073,107,0,0,
+    2746,110,318,2493,308,2602,2470,5421,253,3490,2791,274,193,157,13,2534,
+    2779,167,2902,3834,3261,2671,121,2956,2760,0,0,1744,0,4713,2765,4982,
+    13,318,173,3139,0,143,0,4866,5319,2374,26,3110,250,157,1820,3183,
+    194,0,2574,0,3008,0,6209,0,61,2481,2725,236,3165,1941,0,5895,
+    3398,5379,0,0,0,169,2424,3022,6120,6031,3043,189,0,2039,0,0,
+    0,314,0,2468,5641,0,242,4647,5325,194,6166,2689,247,2550,2490,6715,
+    2492,0,0,3227,2491,175,1964,0,3120,0,0,0,3283,172,72,1605,
+    205,4216,280,2935,277,2956,312,0,0,2036,2628,1790,273,0,4534,2482,
+    3062,1763,0,0,4270,175,0,3345,0,180,0,3988,6197,3076,297,2512,
+    49,184,4656,60,270,191,4207,1697,244,7056,2468,2007,5591,0,6472,0,
+    182,74,73,0,2603,3271,0,0,162,3075,2755,0,146,320,0,2481,
+    319,73,147,2591,313,5966,1905,183,0,2557,1808,2490,0,0,300,0,
+    0,2635,178,2138,0,12,0,0,297,4725,0,241,4952,5087,0,0,
+    0,2667,0,0,89,4482,3408,4713,200,2993,3231,2502,2733,2347,4332,2734,
+    275,2723,1677,0,306,3427,2217,3902,272,2628,2799,4811,3272,3998,0,2790,
+    2029,2911,224,2413,200,2820,0,0,5970,0,2140,2150,1885,2492,0,1603,
+    3262,2512,145,0,143,4868,75,199,1940,285,0,3009,272,2897,2757,3107,
+    3232,4666,4042,2860,3052,4240,2023,3287,123,0,0,0,6715,0,0,208,
+    2501,2901,3086,108,259,2501,307,0,218,0,0,284,0,2988,37,2415,
+    2871,192,78,6000,177,0,212,2976,2733,4897,6087,2744,256,11,2996,5308,
+    0,266,2668,0,167,0,295,0,279,239,3902,0,3779,2414,0,3385,
+    3227,181,3194,0,63,0,186,3299,0,1743,1874,5195,2943,284,0,2692,
+    3296,4901,4966,2472,0,0,229,2688,5087,2626,174,4234,1676,284,193,300,
+    144,0,5308,170,55,6024,47,6557,2799,2601,2073,7014,41,6069,201,2952,
+    63,296,2710,2479,0,2952,0,1876,3163,2578,0,4659,240,5222,0,5379,
+    0,0,4445,3217,3304,2074,2611,1605,222,208,2744,2662,3328,1833,2693,0,
+    0,234,3821,3392,2624,0,0,198,3318,5801,206,1633,2887,0,1610,2337,
+    107,0,213,0,298,0,0,0,2602,0,4647,7237,188,2756,2811,0,
+    73,5757,0,5113,2140,1971,2963,4867,1600,295,5387,127,2257,3903,0,0,
+    4043,0,0,177,268,3931,17,0,0,2611,0,0,0,0,322,3109,
+    2149,4343,2925,2705,0,2748,201,171,3275,238,0,39,5910,4103,4088,194,
+    2711,3591,2602,3227,184,3986,2930,0,2765,0,3065,6695,0,109,0,0,
+    210,4264,220,2083,244,3041,0,2846,5385,0,185,5747,1840,0,218,0,
+    2567,311,89,3007,259,220,262,1978,0,2045,5766,0,2737,160,95,5599,
+    26,159,148,266,2664,0,72,1821,2473,0,2779,3019,3153,0,3205,181,
+    202,320,2745,0,0,171,0,2310,224,0,5805,6039,0,3988,2496,97,
+    5131,2800,3075,5105,3073,3330,2750,3566,243,2613,239,2561,2844,4437,175,229,
+    0,0,126,3075,3076,0,0,4871,0,2515,249,0,0,274,2755,1876,
+    0,0,2809,0,0,3490,321,4124,0,2594,84,2159,6023,2225,0,0,
+    0,0,97,300,0,4755,0,4935,124,2690,1940,13,4209,3240,11,2736,
+    0,299,3064,3466,5306,5581,278,0,2734,0,4656,198,1765,2704,2689,49,
+    312,244,176,0,5967,1809,0,4673,4866,0,0,0,217,150,2911,0,
+    0,0,3187,0,4209,276,2228,294,0,0,248,0,3194,2799,3384,2789,
+    2932,5628,0,6904,2970,3309,5598,1632,0,304,6305,0,2479,0,2141,1821,
+    136,0,2084,246,0,0,2765,3966,1610,1759,303,133,99,2696,214,5087,
+    0,2833,2710,208,2965,0,2825,0,2419,260,2914,280,312,0,5746,274,
+    0,0,3009,0,0,224,0,181,2072,35,2688,2425,0,228,0,5818,
+    295,4346,2538,4569,1608,2732,157,1600,2853,3008,2721,2897,2899,225,2074,144,
+    0,0,1605,258,1600,3272,0,0,74,3305,0,0,4054,296,4817,0,
+    5107,2559,38,1945,0,0,2809,2645,202,1831,204,0,101,1648,4208,2235,
+    2776,3556,2216,0,3368,2888,3022,0,220,0,273,6111,2886,2615,3293,1757,
+    2904,2215,107,5747,2052,2649,4877,1810,3129,3249,5223,3441,1742,1830,1825,2822,
+    235,1690,71,2810,234,84,1607,5408,2402,6045,5883,1635,177,4974,3207,7112,
+    2809,3150,0,287,5986,0,3360,6109,3056,2206,5415,2151,3250,0,2656,2349,
+    3240,97,2732,279,5746,2735,209,2802,5594,261,226,4058,222,170,5993,5818,
+    0,0,2788,49,0,175,0,0,3400,3075,2424,2151,3196,3247,2848,0,
+    2613,0,97,0,5362,171,86,2867,0,1955,0,0,0,0,0,0,
+    1756,175,1874,2736,0,0,2548,0,121,2315,6471,176,2526,262,0,2245,
+    2975,0,2734,0,2501,1890,2415,0,4876,0,3164,0,3114,274,2504,0,
+    3297,0,0,0,0,0,88,3345,59,0,1831,0,230,307,236,3059,
+    0,0,0,4712,242,4925,213,6883,2018,267,1601,3876,228,2783,267,247,
+    2029,109,2790,0,177,4377,109,3990,104,237,0,11,0,0,4722,0,
+    254,293,5051,260,4648,242,2772,0,3327,4261,0,0,167,4535,2336,5098,
+    4718,2880,98,3007,3073,2260,2776,0,6115,2724,2558,3294,0,138,241,0,
+    0,71,3089,5321,2291,0,2593,4783,2205,135,0,0,0,3283,0,17,
+    0,281,3246,288,0,2743,2338,239,89,3646,2613,6939,4107,3133,1631,12,
+    0,0,3319,3128,3106,125,0,3184,2986,288,4747,0,2657,4484,3063,0,
+    2608,179,170,0,1722,5670,2738,4229,210,2772,213,260,4076,235,253,6885,
+    2623,1886,2798,0,0,0,1610,5749,2433,0,1676,258,3025,1962,2876,135,
+    2661,0,0,0,2518,0,0,2732,2956,0,141,96,2424,183,3998,239,
+    2677,296,0,2492,3183,0,2902,276,0,225,3998,0,2677,0,3839,277,
+    184,0,133,1707,1679,1757,2886,0,0,222,155,0,2545,2085,2865,201,
+    0,3219,215,2920,3360,0,6575,206,3336,2506,2074,0,0,0,0,0,
+    0,0,218,0,0,0,0,5756,304,3085,262,6688,0,2948,0,1832,
+    0,0,6330,0,254,0,180,0,3260,0,0,0,0,0,210,4032,
+    1610,131,0,0,0,3987,2853,59,2810,0,0,3238,1906,0,0,3261,
+    1721,0,0,2426,3327,156,0,4014,0,2854,5222,223,0,5449,0,2273,
+    155,4243,4549,6294,2938,2888,164,315,0,0,2877,71,0,0,3260,0,
+    2843,2953,0,5540,5968,0,2976,2557,4718,0,2967,3229,0,6805,0,0,
+    0,96,3007,12,1604,2668,2886,0,195,0,2336,3106,0,1812,0,4747,
+    2339,7222,1832,2809,3315,1789,275,265,0,0,0,0,0,0,2774,2858,
+    1829,2009,3667,1631,2274,3023,7008,5801,5804,12,2593,0,3296,2651,1831,2722,
+    0,0,0,0,0,2534,0,0,4046,3360,0,0,0,0,2970,0,
+    5539,2073,4306,2666,3337,2628,279,0,250,0,251,0,0,4484,0,0,
+    2308,3336,4706,0,0,2600,0,0,2831,189,1607,1905,0,3130,3273,2496,
+    0,1742,5854,0,1605,0,2110,0,6069,0,0,0,266,4867,0,0,
+    41,250,0,2403,1808,4499,2347,0,0,4428,0,6826,266,290,1821,5591,
+    2605,0,0,2085,0,2646,318,1944,1754,210,295,2787,1745,0,0,0,
+    0,0,0,6102,6417,0,5590,2639,277,165,2218,3239,4094,3186,3646,2235,
+    0,0,1681,0,3892,36,2281,2902,2569,234,0,181,6022,314,6025,0,
+    2679,2740,47,3095,0,248,0,2051,5158,2402,2087,0,316,5473,72,147,
+    6279,2580,97,2607,3306,0,4686,4013,0,4086,75,0,2281,3293,0,0,
+    0,0,2628,124,5098,0,3086,2611,0,2615,0,0,0,244,0,0,
+    2936,0,3198,0,4483,195,4923,292,35,155,185,5109,5801,0,2735,2721,
+    1889,7350,2755,2459,2622,3304,3188,76,74,0,2272,0,0,4095,100,2483,
+    290,4481,196,4307,0,0,2094,3293,2542,61,194,0,2582,0,4206,158,
+    0,3125,0,0,0,4666,0,1753,0,6266,303,2776,261,0,2502,283,
+    1886,2866,0,0,4102,7062,2832,1608,2480,5318,2160,4122,286,1878,2976,2724,
+    2748,2919,2656,2357,35,120,2625,0,5916,0,0,2337,0,2855,308,59,
+    2800,293,2635,0,175,2367,86,191,3353,3427,50,2490,120,1603,2932,4866,
+    108,6230,222,2472,1601,4206,4701,4660,2339,3683,265,36,228,4651,2736,184,
+    2547,1812,3052,0,256,0,0,1631,0,6754,0,0,72,51,2106,0,
+    0,256,4391,5307,0,188,49,0,0,0,2967,0,0,1608,0,2207,
+    2073,0,0,0,4027,2529,2076,0,2504,3580,13,2825,2745,3990,2869,23,
+    194,3217,5978,6436,3770,4711,1605,2787,6693,0,27,187,0,6233,2405,2729,
+    284,3188,2423,0,0,0,2888,0,0,0,0,0,0,0,0,2977,
+    0,3216,0,3199,0,3040,4866,84,35,1610,0,3766,0,2745,109,0,
+    3194,240,5628,2281,2733,234,25,0,0,1606,0,2930,0,0,191,0,
+    291,2011,3019,3044,2406,2073,5329,5804,0,3326,0,3012,236,6395,1754,0,
+    2799,0,0,0,3952,0,1633,3573,0,1748,0,225,0,0,0,5113,
+    0,0,0,0,79,0,0,230,2737,6242,2770,1742,0,0,0,2591,
+    37,0,190,2966,2725,2776,2690,0,0,3172,0,0,3020,3098,3018,294,
+    4797,0,7186,2943,1602,2878,4710,4285,0,0,0,6371,4490,0,208,0,
+    24,1754,3107,2875,95,2658,1875,267,5629,217,107,3041,1895,3162,149,6231,
+    6693,2900,1811,2138,2275,2030,208,2942,1954,2616,4262,0,250,2878,176,2952,
+    3030,280,244,39,0,2647,1927,0,197,73,2225,1609,6251,247,0,2990,
+    5553,277,2271,5366,2835,0,0,6471,3183,43,2975,4328,2086,2886,208,6131,
+    3442,0,263,2732,2096,2549,0,0,5846,0,2743,2579,0,213,0,0,
+    2934,0,2273,0,4647,2292,28,1604,298,2349,265,0,4876,265,269,3107,
+    0,0,0,0,3766,4456,0,274,0,2961,0,4343,0,0,0,2854,
+    3040,4349,2548,0,3208,286,220,2690,0,0,0,3315,5146,308,0,2944,
+    0,233,2933,1610,95,119,288,2326,2315,2853,0,251,290,0,0,0,
+    0,0,3025,3567,0,0,4371,0,0,0,216,0,0,0,2853,5801,
+    0,3766,5545,6388,3217,2978,4107,0,182,2754,309,2733,2844,1611,2864,2677,
+    322,3547,192,4563,1812,2622,273,3294,3602,76,0,2017,0,3023,4261,289,
+    3383,0,199,0,190,0,0,295,47,2516,2469,2722,1609,6032,2592,2512,
+    47,0,192,0,0,0,2226,3173,0,0,308,199,241,2997,4782,283,
+    0,35,322,1809,0,2271,0,0,0,0,0,0,0,0,256,0,
+    2413,192,2505,3221,0,109,0,2964,0,0,0,5307,42,306,0,143,
+    3272,5202,1611,1941,4951,222,7075,0,210,0,2976,0,4229,26,2338,2006,
+    3194,5749,3033,187,2733,6827,2755,5327,0,119,2688,3018,2545,3289,209,1681,
+    0,5386,0,0,0,0,0,0,0,0,0,0,2732,0,3187,2027,
+    0,0,3271,2779,0,0,5815,0,0,2876,0,183,247,0,200,1840,
+    0,0,0,0,0,0,0,0,2516,3089,303,0,0,0,0,1623,
+    0,2614,0,4941,155,0,1613,83,3216,2072,3106,5976,313,2225,0,2633,
+    2769,3107,6240,250,3179,207,0,2492,160,0,0,0,0,161,264,4445,
+    245,2623,0,0,0,321,0,0,0,169,0,0,0,0,280,123,
+    3199,2688,4946,3177,25,5775,6686,5362,113,308,4150,2367,3390,0,0,2513,
+    1940,36,295,181,3032,4370,2886,155,143,3052,292,2919,5801,264,205,0,
+    244,0,2834,2591,264,5318,3217,6151,2898,229,2564,0,15,133,3048,5766,
+    3336,3218,3546,36,0,135,3165,2895,289,291,1754,5470,2705,0,268,2018,
+    2776,6088,237,5477,0,0,262,0,2649,5427,0,2095,2413,2006,6022,2251,
+    3336,0,0,2711,227,216,0,0,3619,59,5251,0,0,5432,2607,5635,
+    0,35,3346,4429,3153,0,2547,311,24,0,270,3051,5545,262,0,2931,
+    2898,215,3283,4058,3272,29,2921,1829,2019,23,208,2677,3011,0,2159,0,
+    3139,3267,95,5642,107,0,3209,2469,3998,2502,200,2273,6067,5096,1700,0,
+    3152,2413,3261,255,95,0,204,0,280,0,0,107,0,160,3251,199,
+    296,2625,47,2844,0,2208,251,2996,0,5371,2376,2483,4059,0,0,0,
+    175,240,2206,0,1678,0,2815,4646,2559,1608,0,0,5862,0,3143,5895,
+    0,0,215,1607,270,3129,2812,1941,292,2757,5415,2481,4933,2484,3003,3181,
+    0,83,0,0,4762,289,2281,3770,2204,281,3068,0,0,3123,4703,0,
+    0,0,3031,0,2790,244,245,4263,180,3109,2864,4376,5978,97,2351,190,
+    3293,0,0,2732,0,2284,5306,190,1940,3129,0,0,2534,0,0,4746,
+    3546,0,2347,0,2480,0,0,2219,0,2102,0,0,0,0,2941,0,
+    226,0,5583,0,4311,4053,0,0,5362,0,167,2677,299,3042,3557,1830,
+    3074,2864,0,2578,2936,313,95,2110,251,267,2636,108,2801,47,3336,5531,
+    0,1787,0,0,276,5539,0,149,0,2809,1697,3011,2694,5773,1608,0,
+    0,1699,3118,2888,245,2204,2934,5336,0,3084,315,0,5690,23,0,131,
+    266,3273,4107,4053,3692,2531,2766,0,3108,2144,0,4091,0,2734,240,2249,
+    2811,2569,0,0,0,0,6187,264,2513,5854,0,0,0,0,2660,2823,
+    5662,317,2888,0,2831,3229,167,172,0,212,0,0,0,2814,2724,2935,
+    0,0,0,0,0,0,0,2537,0,1606,277,7091,0,0,3938,0,
+    170,3096,3996,209,5616,0,3040,3087,1643,259,3866,0,1841,0,5391,2887,
+    2605,6350,3118,130,0,181,0,0,0,3228,0,0,0,0,0,3793,
+    0,2701,3807,0,108,0,3117,0,6000,3551,229,2954,6284,5801,261,0,
+    233,48,2846,1987,199,2590,1757,126,0,273,283,2700,256,2897,2140,2635,
+    252,1611,1952,2036,2523,2603,1820,0,4542,2930,5142,3022,2822,2900,2169,236,
+    0,3067,0,3328,0,0,0,271,0,3007,0,2690,300,0,0,288,
+    0,0,2140,223,2847,3034,0,0,3283,5889,251,0,0,6241,0,125,
+    3087,2031,301,0,2636,173,4005,0,2507,241,0,3173,2567,292,2578,0,
+    0,0,0,2216,303,0,314,205,282,5585,6230,2094,5370,3649,0,2853,
+    1605,49,0,0,3107,236,2479,0,6032,2626,2490,238,5107,2009,2609,12,
+    2283,223,123,180,2766,4570,0,4211,0,64,0,5664,2040,3152,2635,5967,
+    6565,5758,0,0,4206,241,3139,0,0,0,3148,4041,3655,0,2594,3831,
+    3223,3360,2339,7291,4718,5309,2590,3768,310,0,2496,2349,0,3627,2009,0,
+    0,133,2677,2338,6241,2586,0,0,4923,2204,35,5536,3560,5308,300,4877,
+    5031,2215,0,3132,0,0,0,2678,1877,4667,292,3085,2909,0,3956,234,
+    3288,0,2767,0,2483,0,1600,3875,0,3140,0,6103,4924,0,3315,0,
+    0,1677,5372,3052,7222,2546,5969,0,215,3318,258,184,6884,1940,3019,1742,
+    309,2349,3336,245,122,0,1603,236,196,3205,38,0,2746,0,2919,285,
+    3139,2834,4649,3112,4101,3130,183,2899,3106,2151,5981,4761,6837,217,4747,244,
+    0,2039,0,4087,3793,5581,0,0,268,6000,3260,38,5096,2556,0,2857,
+    176,300,6798,296,99,15,0,2656,0,0,2777,88,138,83,2713,2216,
+    2145,0,1839,3830,108,2160,0,1961,1940,3194,288,296,2219,0,0,0,
+    2668,1641,231,2370,4235,5966,5546,5159,5195,137,1600,3283,2778,2507,6714,1708,
+    4086,182,278,177,268,71,0,79,2513,0,0,0,0,0,3151,2659,
+    216,3839,0,5379,5362,4261,0,6699,0,2996,0,2722,0,3107,277,4494,
+    2902,0,5326,2151,1698,123,0,0,1965,3710,2636,185,1819,201,2027,3447,
+    3769,2560,0,3021,1631,0,4406,0,5810,282,119,224,30,237,6231,2338,
+    119,0,4314,4427,2149,3033,36,212,2998,4680,2725,2963,0,2504,3392,4008,
+    295,212,144,4042,185,189,3283,0,2933,2710,5895,2880,2878,3025,3315,29,
+    2769,5407,1608,1822,2590,159,278,3055,0,1600,1809,0,3120,0,2645,206,
+    2636,2908,5775,2418,314,169,3242,5113,1833,2528,2931,131,0,0,0,5316,
+    4351,75,2864,254,199,4013,232,4218,0,230,0,5802,0,0,83,0,
+    1676,0,3054,0,2518,2504,19,2679,0,5966,6066,319,4445,2787,3996,0,
+    240,2703,5087,134,4930,4656,2633,2554,2831,4922,2959,3558,119,6812,201,2498,
+    217,3812,2843,3932,2567,322,1744,5592,232,2604,196,1813,1922,3087,6717,206,
+    2723,3086,0,206,3768,2811,246,1978,0,6215,0,4343,0,5773,0,0,
+    3134,0,0,186,4101,2897,167,3353,4667,3274,5009,183,0,0,3073,6093,
+    2150,273,0,213,4701,2275,175,0,0,28,0,99,2095,78,3883,0,
+    1958,4342,1676,1604,0,3131,2681,3058,2270,0,0,0,2292,0,3309,2295,
+    0,0,2604,0,5636,2512,221,3381,5971,1877,289,3029,2017,5030,0,3567,
+    24,4701,5846,176,2138,1847,6386,2527,0,3881,3550,2877,2955,5556,233,182,
+    6688,0,0,0,0,242,2482,0,71,271,2592,3020,2781,5414,255,0,
+    176,1832,2988,2225,205,5545,298,184,171,2470,3234,2028,2523,5969,3109,2688,
+    2281,289,3174,0,0,5598,1607,2689,2556,0,5538,120,4665,4969,0,0,
+    0,4052,3163,224,0,11,0,2952,100,202,0,0,3029,0,0,277,
+    3152,0,3161,0,0,0,0,14,250,97,5528,0,2744,286,0,0,
+    2711,0,2860,4673,5406,2651,2270,3793,0,0,282,0,0,102,3452,0,
+    302,2932,3778,207,4000,2582,5883,3546,0,0,0,0,114,1874,3011,5141,
+    0,0,0,189,5113,5986,123,3078,2590,2723,0,0,84,2644,5316,0,
+    0,5165,2733,0,0,0,0,195,3117,3942,0,0,2572,2634,3106,4292,
+    3187,1915,3556,3304,1687,2403,2497,0,0,0,0,2637,0,146,98,4526,
+    5849,1727,0,2189,240,0,3317,53,209,247,0,2966,2337,0,4921,247,
+    0,2094,0,0,0,0,0,0,0,1604,5456,0,2747,2578,5067,265,
+    311,6943,0,3831,0,1944,0,2831,2799,1716,6315,225,175,304,221,2415,
+    2804,2835,3317,307,2964,3206,87,168,3254,220,0,4886,0,3695,0,5626,
+    0,0,0,3161,83,251,2960,2821,0,252,0,0,3095,3317,3241,3275,
+    0,278,2767,0,83,6202,1605,0,3173,3086,2625,0,0,300,206,1819,
+    0,3106,4271,2966,0,224,0,205,3823,5765,0,0,279,0,238,271,
+    0,2746,2876,110,206,3316,2028,6281,4428,0,2534,180,0,2744,0,0,
+    198,60,133,23,2964,3207,3216,2865,0,3084,1808,5106,64,36,2286,213,
+    0,226,2864,258,5847,1808,288,121,0,2924,199,95,3951,0,286,0,
+    51,0,1678,275,0,5150,0,0,214,6186,196,2682,2691,0,175,5750,
+    2831,187,315,2468,306,298,244,4426,35,1809,5099,0,6067,35,308,2932,
+    2678,2168,4940,3084,1996,3391,2823,286,2788,2933,2168,3367,209,2754,0,3117,
+    223,6351,5097,122,1846,4151,74,95,5862,2549,274,1606,296,2578,221,6404,
+    0,0,2350,6024,3195,2159,245,261,3581,63,276,242,3151,2480,322,1876,
+    1766,3328,0,2270,4650,2523,2493,0,3176,2649,6280,2943,3326,300,1811,95,
+    290,0,247,0,0,0,0,2022,4446,2204,2997,3787,2481,0,0,3139,
+    2281,2746,3162,1609,170,0,2832,261,2494,4646,5450,0,0,2497,0,3315,
+    0,0,2366,0,2496,291,0,0,2638,0,0,5442,0,0,2943,0,
+    0,176,294,211,2571,2027,257,0,0,2508,0,5966,144,1904,0,3163,
+    0,0,0,156,5326,77,191,0,3232,95,216,0,0,0,0,2648,
+    282,2624,0,0,249,0,3163,2897,288,2986,0,234,3261,5969,2549,3096,
+    2206,3020,3295,0,0,4360,0,3086,2780,2824,0,0,6686,2671,202,3076,
+    109,4125,239,4058,218,4086,25,1640,182,0,283,2814,0,0,318,211,
+    2524,201,0,2700,0,4789,2641,2405,5690,0,5662,2216,27,2811,3209,2721,
+    3297,0,5407,2611,0,0,0,38,0,2291,2359,5560,2468,6030,0,0,
+    2550,77,222,2102,0,3185,321,0,3056,3074,131,287,3220,287,3526,3434,
+    197,0,172,174,2405,5993,0,276,0,169,2536,179,309,254,0,0,
+    2952,0,2614,3512,2415,4867,276,0,246,3219,29,3044,0,6006,3822,0,
+    1840,37,2605,266,5748,170,5003,187,1604,264,0,0,2215,184,1956,78,
+    202,1721,0,0,2568,2601,304,2073,2406,38,237,5307,2787,2700,25,2348,
+    1930,1626,0,2967,2207,1688,1690,1690,3316,1847,5476,3091,3185,1603,1656,2519,
+    320,4901,3338,2963,2574,271,3315,3172,2966,89,95,0,1874,2497,3252,288,
+    11,3426,0,1973,1621,0,2294,3008,0,267,4281,0,0,3265,3793,3789,
+    0,0,0,2221,3550,0,3217,2503,2491,2743,1885,320,5545,272,0,2517,
+    3272,2809,3620,132,2018,5698,0,0,225,0,3128,1951,288,2207,2051,2749,
+    2381,300,2854,2876,3052,2978,2836,314,0,4938,2875,3172,86,0,2996,0,
+    5765,2909,5675,1820,306,2798,2402,0,0,2594,4107,0,2216,0,210,0,
+    5092,3196,179,5916,3183,2854,2876,0,0,2614,2770,0,73,0,0,2655,
+    3077,0,284,0,0,0,0,264,175,2361,4490,3271,1782,0,273,2612,
+    4987,0,0,5994,0,0,2569,0,0,4058,0,0,0,0,4901,131,
+    2656,175,252,3381,5869,0,307,0,2017,0,2756,257,0,0,24,3884,
+    2931,3183,202,293,5037,0,53,2088,0,2095,100,6075,0,2673,3185,0,
+    6031,2809,0,230,2822,146,2491,309,5608,3874,3602,316,2557,3188,260,2909,
+    6361,0,2845,2117,2964,2523,3169,0,23,2925,270,3108,2854,5560,3111,174,
+    2607,247,2117,2985,318,191,2711,3184,3218,0,0,318,188,0,278,283,
+    2635,3386,4050,265,2624,2579,2160,3282,2744,2475,121,223,250,3305,2743,2206,
+    5966,2679,2756,0,0,2601,4207,4321,4376,217,2234,2526,284,2767,2750,4646,
+    1747,0,0,0,3095,3166,2493,292,3008,0,321,0,2007,23,0,2799,
+    24,1676,2843,2922,3244,4436,2649,4495,152,2659,170,0,0,6484,236,3496,
+    0,4491,0,5045,4668,244,0,2712,236,170,3766,245,2766,194,1604,5272,
+    3700,0,0,0,0,1604,0,2473,0,6188,5066,2634,232,5307,2514,0,
+    175,7238,283,224,306,257,3108,1834,23,6217,107,2435,190,2855,1830,83,
+    6686,2581,2724,1624,2732,298,2749,198,2600,3274,5105,199,1608,3547,2308,1623,
+    271,4437,269,2989,6420,282,3085,238,2865,5460,3117,316,2897,1655,200,2072,
+    3117,3062,2941,200,316,120,5088,5372,2919,308,3255,89,1603,3986,2634,1875,
+    1978,3172,231,124,0,0,172,0,3480,0,3294,2040,0,3161,0,2935,
+    4924,0,0,0,0,1707,5257,1643,258,48,2721,247,3168,4438,3111,0,
+    3648,2490,0,0,0,0,0,0,2985,2616,204,192,210,5414,2614,272,
+    2767,205,322,2528,3136,2110,1608,209,1661,6006,0,4646,1677,121,5308,6681,
+    0,300,0,223,235,98,156,0,3264,3601,0,2810,4646,2622,2876,0,
+    0,0,0,0,0,0,0,1765,187,2953,6420,286,3031,2210,2701,2683,
+    246,2952,1632,197,206,141,264,2017,5987,3830,2848,5451,1879,212,1830,314,
+    1743,84,2570,2270,2017,144,6484,3029,7156,2159,1756,2404,4229,37,305,2308,
+    0,0,0,0,0,0,0,5994,1774,2733,0,0,0,2470,0,215,
+    0,0,0,0,0,0,3019,6826,2441,0,1744,0,0,0,2558,0,
+    2932,0,0,299,96,292,295,3040,1608,2508,0,3141,177,2810,2796,6074,
+    0,1606,5530,2376,2820,310,5362,3086,2579,0,0,0,35,2494,1641,0,
+    0,302,3299,0,3165,2821,226,6267,2859,3140,0,0,0,0,3682,6067,
+    0,0,0,0,0,3794,0,0,3033,6136,198,226,0,4527,1604,203,
+    3164,0,1604,233,0,0,0,2491,3462,6267,2914,6131,0,5985,3296,176,
+    3273,7008,0,195,5979,2832,2833,62,6103,11,213,247,2859,0,2958,2908,
+    2007,0,3053,0,213,2953,0,3117,2864,0,2471,0,0,0,6360,0,
+    0,60,183,280,3087,5312,3547,0,3076,2225,215,223,7026,304,0,0,
+    3210,45,5594,43,1962,1605,2271,3029,3640,1715,2602,3316,0,4233,3032,5374,
+    2623,168,262,0,1676,124,0,2357,0,0,0,2018,0,0,0,3875,
+    0,2470,2502,0,172,2551,5109,0,2537,0,0,2925,0,0,260,5378,
+    168,0,255,0,0,2095,254,2094,5114,0,215,2793,0,4226,3117,2468,
+    0,0,5804,23,0,7093,5461,0,0,99,0,2931,2735,0,0,0,
+    0,186,0,0,0,52,2713,2866,234,6351,0,0,2447,127,1876,0,
+    0,0,2732,0,0,108,0,0,2835,0,2433,5116,4968,15,270,3768,
+    0,0,3107,240,2756,0,2985,0,0,320,0,68,250,5883,0,1605,
+    3218,2009,0,0,6704,3261,0,2844,188,2865,2842,0,147,302,0,248,
+    3833,133,4460,2835,3019,2270,2757,2205,0,6722,0,0,3353,0,3097,131,
+    0,0,134,2150,71,3186,3146,85,1945,230,1604,3132,4906,2693,0,305,
+    185,3031,0,0,4885,3073,4499,4484,0,4437,71,134,3249,2678,6386,2578,
+    0,0,2347,6187,5554,2677,1607,1607,1604,2019,3340,301,3355,5976,0,50,
+    2809,4088,0,3304,3221,3768,176,0,2826,3298,4528,59,3150,309,227,0,
+    3294,3768,4974,2950,5801,2899,2767,0,5690,2723,3032,1759,0,97,2581,4782,
+    3262,238,2954,2072,2671,2666,5527,3611,1616,2902,276,3619,5362,0,4562,3053,
+    235,318,146,2751,2998,290,207,2140,3823,172,2426,3227,4646,3603,3230,0,
+    5537,322,5847,4761,0,306,3999,272,2778,181,3337,2711,66,305,0,316,
+    233,5527,6032,2568,5385,1895,3194,2083,6069,1645,5966,0,2877,0,2721,0,
+    6615,6498,275,2998,11,250,3282,270,240,6273,167,3200,236,3163,2933,0,
+    1952,2699,3253,5316,0,2402,263,240,2666,302,0,3206,2448,2535,0,5538,
+    227,5190,262,2700,6679,174,1954,240,314,0,1655,121,213,2614,3096,6046,
+    2204,2317,4089,293,3068,4701,152,4531,3228,210,1679,3252,3684,0,0,0,
+    0,0,0,0,200,1601,1678,2524,2612,2502,172,2693,0,253,248,266,
+    295,0,0,2309,0,203,0,315,0,0,0,2925,0,0,2578,0,
+    2512,0,5553,0,0,0,0,0,0,0,35,3051,0,177,0,0,
+    3646,2536,2292,6742,1846,161,2073,167,5977,2769,3139,3565,2963,5493,1876,2634,
+    0,243,2778,208,256,155,2768,306,0,0,227,0,0,0,236,291,
+    2339,4866,2292,1838,3174,149,2678,3205,0,3413,2749,1877,1606,114,186,2788,
+    196,168,5166,2637,65,2920,5819,5096,6798,2234,0,3099,4096,1895,134,5592,
+    1708,0,1642,2638,0,3260,14,0,0,2492,2517,0,3142,1602,2083,274,
+    244,2954,59,2953,2339,2480,7153,2072,2473,243,2772,0,0,3877,0,2627,
+    0,3106,2992,5846,1909,0,2547,0,231,61,2768,2556,2677,2458,2040,251,
+    0,1600,0,0,0,0,3261,2846,3099,3147,2602,211,0,2550,1609,2910,
+    1687,2722,2216,3874,2746,192,181,2536,2038,3232,2149,123,2754,0,2746,254,
+    2474,0,0,2624,12,275,185,4896,2515,2159,283,2270,305,1616,3231,2301,
+    6811,2700,2291,226,3271,184,0,2877,4656,4701,5526,1755,3032,6024,5598,2787,
+    2074,6498,2856,3712,186,3330,1742,0,0,3496,0,0,0,1745,2161,1945,
+    2007,2242,63,2977,2821,2479,5713,1702,5560,228,3646,39,6252,177,2897,2963,
+    157,2417,4945,62,2953,2648,198,112,4261,264,3084,242,3626,2271,2593,49,
+    5985,135,2568,220,179,5584,2986,37,7152,2713,317,4437,3902,2591,210,1609,
+    0,0,155,2787,0,0,0,1607,3339,2776,0,229,3722,2580,0,2955,
+    231,232,5113,2749,2968,0,2523,6717,192,0,203,2099,3546,0,1610,0,
+    0,283,4059,4647,182,0,0,108,297,0,177,3263,0,3916,219,2689,
+    5968,3435,0,0,4543,312,4877,0,1656,199,0,0,0,272,3085,0,
+    2655,122,276,3174,5746,195,0,0,1688,1606,2998,312,0,1745,3150,0,
+    4272,4505,305,2634,0,3202,2308,101,5333,322,3903,3198,1603,3074,294,5993,
+    5088,2732,167,228,289,5989,143,1644,2349,263,231,95,4483,1745,4900,124,
+    0,0,3406,3250,180,3610,0,4261,1839,2722,231,99,1607,243,294,3546,
+    2470,2525,2072,2897,0,186,0,0,0,201,246,3106,4437,3282,5308,0,
+    2616,2074,2759,237,2578,313,1604,100,1611,0,0,0,0,0,119,5189,
+    0,241,2172,5307,157,2637,2866,2901,0,3184,1854,2249,2580,2701,85,290,
+    2611,3140,2513,216,2854,2152,4646,174,3151,2868,3909,1606,301,3990,3076,2798,
+    0,4810,198,244,0,217,2787,2087,2294,2480,0,63,0,40,55,3305,
+    2894,0,2653,3282,2909,3381,1940,2590,87,273,196,5089,0,0,2645,1895,
+    3197,51,88,311,271,0,2470,2865,5814,4291,320,6231,231,4712,3080,0,
+    2537,243,0,0,0,0,3271,0,2271,96,0,0,0,0,2236,0,
+    0,3298,67,0,49,0,95,266,0,0,2799,2205,4877,0,0,0,
+    4498,2515,4490,0,0,5379,0,2589,2194,1940,243,2493,4216,0,2418,3776,
+    259,292,2525,2670,2094,95,3164,3152,0,0,2250,263,4307,0,97,120,
+    3040,7376,5986,2908,2954,4008,6021,3187,5257,5423,0,2739,0,1622,107,2072,
+    0,35,3691,4461,2580,4966,2991,29,237,2900,0,2402,2802,0,0,1895,
+    3988,3227,2309,3768,271,178,0,0,176,37,0,0,0,3244,5882,210,
+    3766,2911,290,3163,0,0,2523,4867,211,2302,0,5373,249,3294,3145,1953,
+    321,185,3647,1953,3023,6030,299,2754,223,2506,3558,183,2150,183,2799,74,
+    6188,1991,2535,0,6686,1831,2666,299,0,235,273,3315,170,3140,0,0,
+    0,0,277,3911,196,1813,0,5309,2669,2941,0,6940,2358,3272,1606,195,
+    0,2570,2007,2886,2781,83,0,0,0,0,4541,0,3547,0,3825,0,
+    0,1773,2472,84,2831,1899,108,4460,244,110,4436,169,1706,0,0,1600,
+    3162,2051,2831,2044,0,5361,2009,5626,0,5968,1622,2611,3032,242,3043,5526,
+    5819,2677,2952,285,178,2007,0,0,2801,1640,3070,6390,1602,2433,1661,7243,
+    2516,0,0,2281,0,3216,120,0,0,4321,232,1607,291,0,2943,2646,
+    4704,3796,23,134,118,212,3853,0,13,4430,184,62,3207,2271,2579,3015,
+    268,213,2234,83,3469,3029,4426,0,2846,0,2877,2919,2009,2374,6800,2724,
+    7147,6554,0,0,0,2868,0,0,2444,278,239,2006,2723,0,251,0,
+    300,3018,260,0,0,0,0,175,0,2723,2816,2614,3117,2901,28,3238,
+    0,297,5089,3336,107,0,0,0,0,0,3195,3250,0,0,3188,314,
+    2094,0,156,2769,250,0,0,235,126,2864,2524,169,3823,65,5746,293,
+    3767,0,95,297,0,0,0,0,0,0,2449,0,0,96,185,2725,
+    5967,0,258,3271,5986,2579,174,4014,228,1727,3227,5317,0,217,2870,2773,
+    277,2975,0,0,2435,107,146,2517,7360,2045,3217,0,0,3021,0,2636,
+    0,0,0,272,239,3119,3869,2592,0,0,5188,0,4976,3129,5810,2755,
+    4508,206,0,2723,59,1808,3185,2688,2217,3322,3263,5532,2722,3241,1607,165,
+    2567,4140,5802,3040,4306,2524,307,249,0,298,47,1643,0,218,2622,0,
+    3332,2866,5970,5855,205,2826,279,215,232,0,219,280,3470,5969,119,315,
+    2791,3328,0,1912,3239,167,3117,2514,306,243,3018,2093,3574,3018,2931,276,
+    0,3132,0,197,290,4876,3162,5536,2974,1706,1876,264,0,0,0,322,
+    238,176,0,3117,3240,2493,3063,0,0,1763,0,0,69,3205,178,5553,
+    201,2294,2637,2864,298,263,248,6388,191,3075,305,2578,1875,3308,2612,2226,
+    104,2647,2889,2009,249,2887,97,3183,2930,176,239,296,0,59,2611,3217,
+    2583,3252,6477,5187,3996,286,2656,3206,3315,5318,3310,1622,2589,288,0,0,
+    46,0,2757,0,0,2921,0,178,0,1755,14,236,286,87,0,0,
+    85,3155,0,0,0,4719,179,4135,0,0,6151,4101,5150,0,4942,0,
+    24,0,0,0,0,257,2271,7056,2601,49,3030,0,2785,0,3117,2508,
+    0,0,3030,0,2094,0,0,0,263,5526,0,11,2159,137,2168,2897,
+    0,0,0,3260,0,2292,0,200,0,4279,173,1623,0,0,0,0,
+    0,0,0,2943,0,4894,0,3282,4869,2877,0,2998,1610,4536,2570,261,
+    2622,143,302,4648,0,2866,3283,171,0,0,0,0,0,0,0,2727,
+    3307,4939,2074,6081,201,143,109,2989,5671,237,2534,0,7041,74,3143,6111,
+    0,3095,3172,3161,4764,3241,242,3283,0,35,4207,0,189,2920,5818,3684,
+    3249,2284,47,2441,312,3428,2881,3283,2602,2711,171,2858,5144,0,0,5091,
+    3106,4969,225,3194,5791,275,2759,2721,0,1611,3778,0,0,2801,0,185,
+    2474,270,304,2560,0,3206,314,4885,253,185,1874,0,4000,263,2777,2480,
+    2238,3185,3107,3284,2491,3175,0,3153,146,2567,3847,143,194,3704,5747,2389,
+    194,2416,3098,233,2622,6103,2470,4880,4887,0,40,0,6973,0,11,2037,
+    2730,199,132,3285,2205,5310,5407,309,5320,0,0,0,119,3284,267,3284,
+    86,100,3619,2843,5662,2713,84,0,2958,0,0,3085,0,163,252,2602,
+    0,4005,3227,4013,2516,2549,2614,280,97,23,2590,0,0,0,122,0,
+    2568,5386,107,225,2583,0,0,0,3553,0,0,2750,239,2963,95,254,
+    2743,3067,3601,0,0,304,195,308,2897,2534,0,0,0,7311,4725,5152,
+    2508,212,285,5011,2094,4591,122,4921,108,201,205,5096,3305,0,4431,0,
+    2502,278,0,2300,225,1954,0,202,2767,1809,314,53,5891,5553,3769,0,
+    1772,0,3951,297,4597,201,163,0,4657,253,4426,264,3549,0,2414,0,
+    3298,2833,3307,3131,6394,0,2044,2747,5325,253,2634,3327,136,2908,2921,215,
+    0,0,5307,6074,108,0,216,3176,0,0,2578,5150,2680,0,3198,2876,
+    0,0,0,2771,229,155,2512,0,2111,3306,0,0,2941,0,0,4051,
+    4706,288,168,2270,2473,265,3007,1888,2656,254,3252,0,1605,295,5407,0,
+    0,3326,0,294,5582,0,2347,0,1601,2165,0,0,4436,0,3020,232,
+    2176,2844,2668,2351,2900,0,254,3326,6888,222,0,4453,59,274,0,2628,
+    0,4043,2294,0,6011,3263,5848,2336,2139,1952,6115,13,0,0,0,0,
+    1955,177,2671,179,1742,0,6187,3229,281,0,0,2820,3244,0,279,0,
+    35,2468,0,0,4763,2700,5327,1972,1621,228,277,4274,3231,209,0,6742,
+    5361,60,160,5196,2832,2458,0,0,2336,1689,277,2556,0,2229,14,3222,
+    251,4043,2866,4271,0,3800,0,110,3662,0,304,0,0,6031,0,3139,
+    2272,218,5010,2519,0,0,0,209,61,2792,54,4930,0,0,2534,306,
+    4702,2513,298,5471,3262,2633,0,0,2974,4296,299,3272,2919,0,245,4705,
+    0,1632,5977,2648,3019,5115,2766,71,5537,0,4876,0,0,88,251,0,
+    0,0,2569,5825,3546,5207,2657,272,2750,280,66,24,2791,168,183,2359,
+    0,3251,193,2623,0,2357,5096,3207,0,2630,0,0,0,1605,209,2913,
+    2847,1941,3100,1606,0,5316,0,3034,0,198,2963,2483,0,25,5854,191,
+    0,0,273,0,3284,1772,0,5408,2602,0,3046,1875,63,2245,0,113,
+    0,29,2822,90,0,1899,2558,0,222,2699,83,0,4051,4483,0,4226,
+    3987,143,1666,99,2933,254,4247,0,2673,0,198,3384,4307,0,2525,1678,
+    186,221,3824,2492,3346,0,0,0,170,4136,2997,2304,5317,0,3197,5151,
+    0,0,0,170,1746,2749,0,0,2503,0,36,0,2921,5766,2029,0,
+    248,0,2251,2045,136,1608,169,196,0,3868,1624,205,2909,1602,0,191,
+    0,0,3866,0,0,0,4216,0,0,0,0,3209,298,4005,1962,3175,
+    2842,0,0,2170,0,5537,0,0,3062,0,0,4867,167,2649,0,0,
+    2678,2956,2480,71,2930,4439,2541,3057,72,206,2612,71,0,0,3786,0,
+    2843,2569,7121,3315,148,167,0,0,3249,187,124,0,0,0,2490,0,
+    2870,0,0,0,305,1624,2347,2898,0,1621,5747,166,194,2855,195,2690,
+    6103,5089,5758,0,2581,155,205,1648,0,155,4701,0,2985,3567,3647,287,
+    0,3151,2361,2998,4446,2601,3155,2337,2215,5208,3029,144,0,1979,5846,304,
+    2140,3025,5251,5347,5406,0,0,3989,1747,182,2757,2681,2663,1838,197,4209,
+    4013,2094,2691,1614,6102,47,250,2679,2519,2613,208,239,3065,2423,5120,124,
+    0,2661,261,0,169,238,3361,3251,0,5088,4206,2625,2811,4710,3106,2847,
+    176,4691,3084,2008,2569,0,3043,3294,1885,120,3647,0,1606,0,0,4150,
+    5107,2613,0,2591,0,5052,3307,122,3217,121,220,71,0,0,2810,4658,
+    33,2432,307,4676,311,2822,2790,266,2670,2450,215,7056,4732,2767,5147,108,
+    107,169,4180,306,268,5856,5202,2978,4430,4071,2977,0,1744,35,132,3217,
+    2989,75,4673,0,3022,2010,83,109,0,0,2612,4711,2453,5194,3210,0,
+    2149,0,3084,1632,267,151,3066,186,2811,246,302,5846,135,271,1605,0,
+    26,5444,6742,3337,0,2622,162,1887,3029,3133,3058,2031,3902,1875,2028,233,
+    5567,2027,1951,313,0,3180,2626,2845,56,5712,5774,3262,291,2865,3051,0,
+    3800,3951,2668,35,2581,5626,1896,0,0,2008,0,0,3777,4879,221,2572,
+    263,4053,2908,184,306,1631,1913,2490,6025,3876,3881,2647,280,1716,188,4526,
+    2930,2282,0,0,7036,218,2283,36,5003,236,0,269,4208,2358,147,294,
+    0,248,3217,0,1698,5749,0,0,1600,50,2449,304,2754,0,3988,4437,
+    0,3793,3097,2484,0,2954,203,0,0,0,2970,2864,3472,2580,0,223,
+    6694,190,3188,5756,5492,226,6852,2930,4556,0,244,0,1605,3272,2898,2637,
+    314,3776,3260,2623,1606,175,2794,2483,3096,2711,5100,37,38,0,5856,0,
+    4952,0,189,0,2568,133,2655,2402,2952,135,0,0,3185,2427,37,4755,
+    229,0,0,0,0,0,0,0,0,0,0,0,2603,0,4217,0,
+    0,3108,7014,0,0,0,2834,268,5627,2799,71,42,2476,0,1612,0,
+    0,0,2028,71,2842,0,88,1600,2513,14,0,100,47,2855,5528,254,
+    261,189,0,15,0,2754,3128,233,2965,3024,3107,96,0,2535,5229,1812,
+    2745,1611,0,3866,0,0,0,0,5158,5846,87,1625,238,0,4225,0,
+    235,0,0,0,3695,1859,249,160,4866,2677,1621,0,2767,203,2847,2864,
+    4096,4877,3087,224,288,5810,4430,119,6267,0,0,0,0,0,2493,0,
+    2657,308,0,2833,3260,0,4666,248,3328,2523,2647,3176,172,155,2669,2473,
+    0,6681,0,2102,2568,196,2924,178,0,6047,0,4218,204,0,3161,0,
+    5696,191,0,314,4427,11,4755,3610,169,286,0,198,3347,222,0,0,
+    3046,2935,2480,2523,2809,1895,5030,1606,2629,6230,3151,3654,2888,2074,1940,287,
+    4710,3086,2811,4286,2309,4500,278,289,1614,24,2836,4877,2657,3153,2138,5099,
+    3328,83,5114,3065,4976,2540,4800,1846,3207,1879,2150,59,2625,284,2820,187,
+    4791,265,4701,271,257,198,163,260,289,189,1600,2736,260,2502,241,71,
+    174,0,2766,5319,3064,311,1601,3227,124,3285,4207,2931,3996,0,2007,0,
+    260,3371,159,276,2699,173,2149,2721,242,3172,2347,4702,4453,2743,4647,317,
+    0,0,0,2142,0,0,0,0,5088,5821,3009,168,0,0,0,243,
+    0,239,3429,73,3205,2985,306,4005,2703,190,1602,2028,0,3361,0,0,
+    0,3205,2208,0,1846,5316,0,0,0,3163,2340,3262,3778,259,59,3085,
+    3273,3186,109,6387,4581,4877,4647,2151,205,4136,2682,170,3186,2281,2666,309,
+    3129,4978,2413,48,2502,218,2777,2930,4872,3141,5310,3345,2648,0,2732,248,
+    3106,3036,3252,2999,7014,0,2864,2493,2845,0,6021,0,175,1944,2888,284,
+    232,4526,145,51,2646,2669,3256,5361,311,3227,3062,3173,2176,4817,59,2876,
+    84,4233,6359,2963,2931,4710,245,3152,2727,190,2281,5151,2765,3051,2919,3098,
+    4893,2934,25,2628,30,2689,2722,3205,3400,218,1605,2479,255,2560,232,3151,
+    28,4726,60,2782,301,61,0,2787,285,6768,71,6360,291,0,59,2287,
+    3110,2768,3317,3198,0,2710,2613,50,240,3054,2620,316,0,2524,0,0,
+    2758,2877,3284,169,3566,0,0,281,2975,210,7057,2633,1961,2736,100,2998,
+    0,2889,2651,2547,252,2724,4438,5581,2524,2229,0,282,1876,0,60,0,
+    2865,2036,2517,3286,5854,3785,3140,3029,285,4264,0,0,2765,2800,0,0,
+    131,1607,2780,0,0,0,96,5969,232,0,0,0,0,2882,3249,136,
+    0,0,0,4866,0,0,1634,2255,2677,3152,7008,2845,0,1633,3097,2909,
+    2589,115,2537,5976,3119,321,5101,2661,239,49,2634,309,2547,26,191,265,
+    208,2637,4428,2302,1602,1809,2551,302,2976,23,215,3051,3166,1608,6483,4673,
+    6394,3769,2504,2922,0,0,3996,237,2271,0,263,5142,5188,0,2985,224,
+    2853,1640,2931,23,0,0,138,139,2692,1615,83,4536,1809,2938,2215,0,
+    4746,197,2611,2417,1820,2514,2897,1979,2759,2140,1886,59,1706,6238,265,1819,
+    2204,253,3294,6233,209,246,3041,3065,2644,0,0,3174,2737,1886,4102,2513,
+    3337,1888,13,281,1640,3285,286,109,0,0,5334,0,3095,1896,260,16,
+    1823,4590,0,147,218,2776,1810,319,2580,0,4836,272,4006,3574,0,0,
+    2758,2820,3164,161,3254,0,35,5756,6115,322,2787,4013,5347,2580,4762,2491,
+    279,2300,2019,4206,2963,2864,215,0,2727,0,0,201,2641,0,0,0,
+    214,0,2798,0,4702,3140,3274,5150,2485,0,2677,5153,0,5607,2831,243,
+    0,4811,0,0,1952,2931,4050,5207,1952,1714,0,0,0,0,4060,3176,
+    113,0,0,4233,169,0,196,2832,3151,4472,0,228,266,2977,2614,277,
+    3429,6852,2842,196,2603,23,317,268,13,0,259,3282,4279,5334,2678,4453,
+    0,2629,273,110,0,0,2931,4673,2779,0,0,275,2076,0,159,2479,
+    0,6615,220,169,303,1601,2953,5985,248,100,0,175,215,3184,3063,3239,
+    0,0,4596,5105,2767,2789,200,7183,2518,4050,0,5811,2504,207,0,285,
+    2892,1621,2336,165,0,2545,0,2518,0,0,4322,5341,3099,3167,5931,5761,
+    192,0,2579,0,0,0,2624,157,214,221,0,5967,2689,2722,306,0,
+    238,0,0,4242,3054,181,186,5408,181,0,0,2007,2996,2651,215,2545,
+    0,3770,3875,0,0,0,276,1603,3794,0,4563,0,248,0,0,0,
+    3053,216,2020,0,0,0,0,0,0,1810,0,239,296,0,2648,281,
+    2271,233,3088,2855,191,3098,3029,311,3611,0,5527,316,131,0,2534,2612,
+    2857,134,0,6294,2789,2726,0,5606,2854,3776,3033,2718,0,0,5150,3194,
+    3195,3613,0,0,52,0,0,0,3260,0,0,2349,1604,196,4534,252,
+    2640,282,1943,4650,5560,2414,1991,296,2766,25,0,2897,2215,3316,0,14,
+    0,2732,1819,2468,3118,2845,216,72,3999,176,3098,6524,2490,3089,229,2119,
+    4974,314,3603,2710,5758,275,2935,6687,1875,293,169,4436,259,3084,3205,2118,
+    0,0,2225,2432,3625,293,255,47,11,3002,0,3240,0,2482,2020,2769,
+    0,2644,178,184,1772,2236,259,0,265,4527,1604,0,0,3163,320,0,
+    245,2644,2529,0,122,71,299,96,2656,179,1753,5442,0,2737,3273,6067,
+    169,5203,4013,2645,237,3826,2975,208,3846,183,4226,5306,274,180,5591,6030,
+    3085,0,0,319,4649,5598,6687,59,4342,1650,0,2679,282,0,2447,0,
+    0,0,0,3162,3075,197,183,25,2074,4322,320,3030,4481,122,7014,2638,
+    0,226,4894,256,0,0,1608,0,242,5606,0,1655,3019,4945,2494,6066,
+    171,2471,3154,0,2600,11,3711,0,6688,0,4208,2932,2537,0,275,0,
+    143,2487,108,3008,318,39,2724,3316,2491,0,1941,0,0,0,2671,209,
+    2937,2009,2591,2547,2234,2276,2856,5883,1912,206,0,3074,27,2204,0,2645,
+    2809,3130,3283,121,2646,0,0,3824,2711,310,3556,3261,3152,1753,3285,0,
+    2470,62,3218,5629,227,2879,2864,2778,4065,3206,179,2613,30,108,3340,216,
+    2880,2746,319,272,2932,262,176,2556,236,5583,2234,1743,248,3175,2502,292,
+    3096,1603,3857,0,0,0,3611,0,5309,306,2966,3099,1676,0,5098,4322,
+    0,2778,4500,0,2403,191,0,0,2402,0,2974,0,0,1753,2176,2414,
+    282,0,297,2755,3131,0,0,0,0,2968,0,4596,2535,60,0,1603,
+    4015,0,231,12,2898,6367,290,3435,0,5201,5309,301,320,3041,2560,2835,
+    147,4400,2790,315,5165,2139,2368,6350,5801,3676,5818,237,304,4454,3251,4731,
+    2592,2732,188,2030,5374,6151,5782,3382,207,2348,300,2670,108,3040,0,4956,
+    3130,2765,5968,36,1746,254,2875,4484,146,2448,227,5363,269,307,1602,6748,
+    3841,0,5663,2473,24,3132,0,2569,0,3040,219,107,0,4468,53,6371,
+    1601,2084,282,2580,4427,3275,3051,0,1943,2924,0,0,0,121,0,0,
+    0,0,2977,186,119,5152,262,0,0,0,0,2471,2677,5195,0,289,
+    227,0,2699,2952,3771,2919,2647,54,0,2547,3119,2038,61,5471,5889,3426,
+    4481,171,5801,4885,2338,4534,172,3255,3128,2637,258,4156,271,1897,3619,2139,
+    87,0,4867,2292,0,146,74,1943,3013,2975,47,1930,0,0,2024,1691,
+    2590,2606,2517,2567,2552,2493,5316,5102,2755,3381,2627,206,5697,2413,2965,16,
+    3293,2236,2857,2930,0,2922,1759,120,1946,2701,216,2784,4207,4880,2682,3019,
+    0,3769,0,2733,0,5090,2688,0,0,0,278,0,3731,0,2711,0,
+    0,225,2666,6130,2702,108,0,2216,2732,0,0,88,132,3830,185,264,
+    5966,0,219,3845,0,0,192,66,0,0,0,1609,0,0,0,0,
+    5583,227,3054,0,2481,0,0,4656,59,6847,0,0,0,0,0,3082,
+    2955,2875,220,2293,1615,6038,3328,2469,218,133,2985,218,3262,2423,4541,3155,
+    312,0,2613,5626,3205,3997,2336,3187,2270,3217,299,4529,4278,216,5993,3162,
+    3227,100,6194,2756,4042,2217,249,148,183,6245,0,1606,3293,275,2549,197,
+    3023,2205,3126,2006,142,2504,216,60,2942,28,231,2889,4044,183,2987,2669,
+    2557,287,306,0,3327,0,76,0,2623,4461,301,3558,2911,4041,1678,3208,
+    4701,2856,0,229,0,0,0,3229,286,3108,5978,3118,222,0,3661,138,
+    1621,5780,3117,2242,0,0,0,1886,2625,0,1601,0,3295,2085,2975,60,
+    2585,4659,2897,2899,271,2215,2404,321,0,0,1822,1888,2989,2855,3382,297,
+    6253,4271,228,2337,2823,0,4014,1940,2656,311,237,273,0,6386,0,111,
+    0,223,3581,2755,191,2618,2832,2019,0,3163,282,2552,1602,2083,2855,4125,
+    0,6232,97,2704,1878,0,0,38,2853,0,0,254,110,312,0,29,
+    2919,281,171,4877,2868,2986,4933,3477,2516,318,91,1743,2570,4725,3293,293,
+    95,0,261,2559,0,206,275,242,2480,3162,5765,2625,2723,109,3997,182,
+    1609,2558,2405,160,2523,283,230,291,272,2149,0,60,3229,2947,2556,2561,
+    3077,7009,0,3769,0,4878,0,305,1746,3185,99,85,3287,3304,3085,1624,
+    29,3316,2633,2721,3338,2744,5407,3831,0,3111,2292,2726,2434,246,0,1608,
+    0,4065,1764,3145,0,276,258,0,1601,6352,0,244,95,2943,2611,2556,
+    2600,121,3294,249,0,0,4922,198,0,3823,5748,2594,217,0,2638,0,
+    284,0,2150,3029,0,73,131,2627,2434,3150,0,0,120,3282,0,2210,
+    0,6021,2110,2513,240,2769,0,2270,5598,3129,5115,5818,0,2150,0,0,
+    218,0,0,0,0,3317,4051,1897,0,238,0,2930,1901,0,0,4520,
+    2810,5590,0,4050,1842,1810,3256,207,239,277,2798,3063,0,0,2842,0,
+    1687,2690,233,30,3110,53,6414,0,2072,1874,1897,6238,2512,4264,5801,6687,
+    2635,2652,3070,3435,1601,0,301,2734,4236,1606,1912,2976,0,1689,302,2777,
+    107,2513,86,3610,6033,2812,2339,2557,208,26,202,205,0,4440,3307,121,
+    195,2271,2622,1808,1742,313,2283,108,1945,230,63,6556,2845,2970,1753,6471,
+    1601,2051,4006,6040,2581,265,6350,242,3346,5711,277,3128,2941,3063,3106,60,
+    2646,2282,2930,2649,229,49,2694,2613,2611,3107,3183,0,5031,172,0,62,
+    0,0,0,0,0,0,4264,11,7377,171,2832,3186,6722,3020,3435,3227,
+    4569,100,2281,0,1943,177,0,0,2833,230,2684,4371,2470,3098,2584,121,
+    3430,0,4529,2701,0,5536,30,0,1678,0,0,0,0,2688,0,1978,
+    0,0,97,222,0,0,3496,2768,256,4263,3119,195,0,2612,3155,235,
+    0,2145,86,296,207,0,256,4001,0,2006,4498,2836,238,4498,3220,0,
+    2283,125,1611,4570,3120,3345,2601,2440,2965,199,3271,2403,2858,1847,2536,311,
+    5526,259,0,3318,2712,252,0,112,0,0,0,84,1603,196,2095,0,
+    0,6256,4869,6239,2495,2362,2111,4055,3840,2567,2787,4668,0,3013,2567,155,
+    2547,2834,226,3229,6435,6450,0,0,2735,6199,285,4270,0,3777,0,1676,
+    0,4675,2582,0,0,3497,3139,229,5993,2493,0,318,3022,3441,0,4490,
+    2569,114,4692,320,2922,3284,0,3021,276,0,0,4001,198,5113,0,2712,
+    0,0,124,119,56,0,0,0,99,225,311,0,2622,0,3272,0,
+    189,2645,2723,3768,3952,0,3785,2480,212,271,2963,145,211,288,2512,0,
+    0,0,2883,0,0,248,2310,0,279,0,4702,0,0,0,0,0,
+    5307,211,220,95,0,0,0,3654,36,289,236,0,229,162,2727,7228,
+    4455,1774,6066,5976,0,1876,220,3304,0,0,0,6273,3029,0,249,38,
+    0,247,248,185,72,2358,0,0,0,0,0,0,2578,3172,0,6040,
+    1622,3777,2336,1830,164,4656,2869,2766,119,0,0,209,284,0,0,2976,
+    3165,0,0,6575,0,3008,0,3162,259,0,0,1878,2612,0,0,3010,
+    317,2340,0,5089,3143,3231,2668,239,2798,0,5776,0,3043,6832,2622,249,
+    2974,0,3174,198,322,4126,3569,3769,181,0,246,1658,4439,183,185,3106,
+    0,0,2722,2495,2688,1706,2667,179,2909,308,1604,0,0,2216,0,0,
+    72,2423,60,0,3549,5209,250,1942,2185,2277,5701,203,0,3151,2037,4226,
+    3412,2910,39,3557,38,2480,0,4666,3284,0,2270,0,5976,3282,2501,0,
+    4712,3251,4042,0,219,0,0,13,234,180,4218,2987,3285,6294,0,3118,
+    2215,2952,2660,28,3162,4702,4713,285,3304,222,6727,0,2529,3029,159,0,
+    3187,6361,3903,3152,3391,0,0,2639,228,1907,0,244,1756,2525,2682,237,
+    2843,4987,3309,1605,100,121,90,312,2592,0,3254,3172,0,0,2714,16,
+    2878,71,4225,0,301,0,3139,2336,0,0,2743,0,0,0,309,200,
+    5421,3293,3700,2842,3306,145,0,1744,204,2581,3032,3930,2615,274,0,0,
+    2206,0,2537,0,274,0,36,0,6368,0,4006,0,2667,6046,38,210,
+    5846,1787,5143,0,0,2891,0,3073,1622,1874,0,242,1613,2227,0,0,
+    2715,0,2301,0,0,244,2835,3463,3184,2578,2159,3128,71,3283,258,0,
+    2600,0,3556,5590,211,3095,2689,1742,289,0,270,2514,1689,2811,317,0,
+    0,0,0,0,0,1808,131,191,59,5746,5317,145,0,107,5527,3338,
+    191,2368,0,0,0,2897,5153,218,2556,0,2915,1611,6721,2767,2948,311,
+    2408,2286,0,3293,185,134,185,2435,0,3716,85,2985,2481,136,319,3020,
+    1942,6066,3041,2600,5422,4042,3558,2570,41,0,3287,0,2789,2759,2897,5252,
+    2982,2516,2601,231,2515,2656,302,51,0,0,2072,0,265,2189,0,3109,
+    3646,4866,0,0,107,3283,0,2480,0,2910,4208,23,2504,0,298,0,
+    0,0,1607,71,2571,0,0,0,3823,2908,0,2479,5858,1746,132,2745,
+    149,157,2535,2141,0,3250,0,2964,2864,3195,220,0,3317,1822,1940,313,
+    72,250,1874,2413,0,2538,0,85,0,0,1640,1875,3646,4429,3866,189,
+    1622,3470,0,72,0,4930,0,278,12,175,25,2902,2678,2635,3020,209,
+    5750,2693,180,2404,268,1814,5642,225,1602,157,74,209,189,206,67,272,
+    6904,3103,5307,2205,4925,1606,292,173,3184,1606,187,1608,1604,256,3887,182,
+    5581,2301,237,3327,2589,3173,319,21,2230,0,1756,2657,2644,320,65,2707,
+    2037,6478,2413,1829,3107,1820,3682,2631,3271,2897,2523,5363,1601,5583,2526,5057,
+    0,306,1600,3294,2898,4437,305,0,0,2756,1860,0,0,6102,6351,157,
+    1678,206,2743,6204,5362,5634,6239,267,2833,4485,169,5318,322,3382,2612,3329,
+    2490,0,2677,4885,2602,226,2843,268,157,2274,2558,2010,3085,131,186,279,
+    2908,0,0,0,0,245,0,4712,1809,126,2633,2556,238,3186,155,2678,
+    0,0,3731,2733,1775,2358,109,319,0,0,2889,0,0,191,0,2351,
+    0,2600,1714,207,1742,2271,0,1772,0,0,0,0,2205,0,3173,0,
+    3176,0,6197,124,17,0,3646,3781,0,0,317,5554,0,0,2667,0,
+    73,4900,0,204,3381,2667,4702,6714,1621,0,96,2237,3031,2668,0,2662,
+    2291,0,0,2423,3345,2897,2626,0,4648,5100,1974,4086,111,4132,185,2207,
+    145,1609,195,3216,0,0,4426,270,5895,0,119,0,2900,310,4436,3100,
+    0,2890,5584,293,2941,0,2935,178,2142,0,0,0,0,2540,4880,0,
+    5195,3029,2359,3031,290,5545,292,148,1676,2633,2963,3304,88,2605,2744,2336,
+    5803,2736,0,0,2492,3046,4007,0,2367,0,2655,0,4491,3317,0,3155,
+    4429,0,2516,0,2482,0,6399,0,2755,0,0,1979,1829,2138,2858,172,
+    3390,3656,0,3785,238,0,0,0,0,2225,0,0,0,0,3240,5995,
+    0,176,0,4293,2870,5378,256,240,5560,0,5429,4135,4426,276,233,1601,
+    0,245,2767,4323,2546,0,2357,117,0,314,318,0,0,0,4656,2765,
+    199,2781,2582,0,3250,112,158,2414,2637,6081,3625,214,2975,5152,279,6500,
+    3164,6038,2514,2998,2007,269,4876,0,0,0,0,0,2283,0,2670,291,
+    283,3232,2749,3206,2528,5186,2910,2550,2746,4876,0,271,2413,3293,0,2645,
+    0,0,0,3618,0,1953,0,3269,2931,2347,2242,63,0,310,0,6763,
+    1742,0,2835,2952,2567,12,3228,25,1632,11,5098,210,286,108,175,0,
+    0,188,3470,242,0,0,172,3054,120,2756,3238,0,1603,96,255,0,
+    2701,2337,2512,3319,5599,3018,5986,252,0,280,120,2748,4796,2943,2366,178,
+    0,2627,2569,0,2800,1941,3869,6030,305,0,1605,2615,0,0,204,171,
+    0,28,0,0,167,74,2739,210,0,2721,2688,0,3239,0,217,0,
+    264,2582,3260,250,4053,3051,3393,0,2787,318,2606,1612,4966,4888,3096,5097,
+    107,0,200,2611,263,2535,2556,3121,2271,201,0,3557,3318,2528,0,2405,
+    2899,158,1942,2622,1676,2721,176,2138,173,305,3603,4344,2138,4426,3130,2700,
+    0,0,3293,258,0,181,0,29,205,2658,0,4228,239,12,0,3997,
+    2442,3029,1906,227,192,4433,0,0,0,0,273,1608,0,0,304,4308,
+    0,3769,3243,287,0,4658,0,321,146,3062,5561,2658,0,6195,2821,61,
+    2787,0,0,300,5748,198,2965,2986,5977,1979,5414,3989,2691,2979,2596,2010,
+    0,267,261,0,2663,4789,2757,1823,0,2706,6156,226,0,4065,237,0,
+    3866,112,2761,2006,0,6626,6555,2866,0,3013,0,47,0,0,5310,5152,
+    5236,0,0,2859,0,3062,0,5195,0,5545,196,0,0,0,0,5675,
+    4315,6022,1764,0,281,0,0,3260,5669,3199,303,1885,4712,131,3308,169,
+    219,2855,297,3475,3073,101,2623,265,7117,2919,197,2207,16,0,4710,4482,
+    0,5087,2503,228,1763,0,4307,3550,185,0,26,2567,0,2583,0,122,
+    0,6686,0,4927,6376,1809,3175,0,5526,2613,6000,0,299,240,4282,2271,
+    5326,20,0,207,145,3295,84,2666,2525,3383,0,3986,7091,1632,3566,3228,
+    2686,4050,217,6252,313,3162,5250,3516,3054,47,2589,6565,2017,167,292,316,
+    3275,2284,2920,3427,2691,83,4448,214,203,256,13,3173,193,3386,3206,1706,
+    171,156,5832,71,1832,6693,1640,3390,159,279,239,72,48,2770,6196,3086,
+    1898,2878,2546,0,3206,0,0,0,1906,0,3151,0,0,2945,3337,4090,
+    0,2799,5883,2647,6694,0,50,2771,2073,2743,2685,3087,2866,296,0,0,
+    3830,4096,73,0,2865,2084,0,0,109,4866,2623,2997,3767,38,155,111,
+    2204,1687,2504,144,3227,2503,2952,253,4878,206,2957,0,2471,203,1963,3052,
+    2724,0,5801,0,0,76,0,0,4562,0,0,2735,4392,1953,0,4219,
+    212,1767,2359,2589,0,174,3018,3195,254,2558,245,3219,2072,0,5306,0,
+    222,2755,2550,3336,183,0,3797,2031,5319,2701,0,2501,256,0,0,6715,
+    0,7117,0,1600,3602,0,3395,2567,246,4428,203,0,3077,3250,0,0,
+    1896,260,2726,1606,2832,29,270,2779,0,0,214,0,0,3654,4227,0,
+    5780,5749,0,48,214,2690,2866,2986,284,4440,0,0,211,4314,0,0,
+    2867,0,189,6716,51,220,3316,0,0,3065,4152,5158,2512,140,14,2204,
+    2150,2826,2021,266,0,147,2601,2726,0,181,0,290,301,157,1690,48,
+    219,1769,0,2868,4208,47,3030,2792,2151,267,3153,3142,1885,259,7038,2965,
+    0,217,3195,314,4512,4966,208,3295,0,0,299,1886,180,95,0,2865,
+    143,2987,4482,61,23,48,2638,2216,4681,3436,120,5106,35,2678,221,302,
+    293,2745,196,5333,2920,3088,2469,2848,2601,2908,3075,5406,2482,1904,187,201,
+    3007,1609,2572,2637,2931,3172,2776,247,0,4207,214,0,2611,7035,4726,2592,
+    2205,190,6074,2102,0,0,0,1608,3109,0,3020,162,2864,2930,171,3102,
+    174,1885,3053,3151,3902,6763,143,2714,3839,0,261,0,271,5371,5391,96,
+    2694,2173,5969,228,43,2110,2756,0,232,4673,2403,3208,282,5642,262,5977,
+    114,285,2876,7092,3293,3051,229,2854,1600,3905,202,2754,2712,237,0,3035,
+    4665,86,2639,131,5449,2838,2914,2879,275,3767,169,0,199,2691,2618,285,
+    3106,0,1829,4611,188,0,213,0,231,2855,0,0,0,0,0,0,
+    3196,4674,158,0,2256,0,0,5854,2842,4536,2836,5455,36,0,6194,0,
+    0,0,81,0,4975,251,0,3306,0,0,0,6273,4810,4020,0,0,
+    0,0,5985,0,0,2176,226,4440,1808,2625,6088,169,4439,4893,0,318,
+    2087,5378,12,2668,234,3035,280,202,2766,3565,173,292,2669,2861,0,2678,
+    2634,3316,210,264,2494,2545,3155,3023,0,185,5222,1603,2085,0,2419,0,
+    2937,61,2641,168,315,5966,78,3548,3110,185,6799,5235,2746,5765,2899,295,
+    76,3041,2009,75,3117,0,5526,208,49,3163,2855,2985,0,0,4674,4869,
+    4591,1941,5966,5969,0,0,3110,0,0,5309,0,2756,2787,2497,0,3021,
+    1808,0,291,0,13,3142,0,2527,1839,0,1623,3119,0,4156,0,248,
+    4492,2652,3019,2604,261,3273,59,208,0,0,270,1877,2282,0,2963,4705,
+    2723,4704,150,4923,4172,2623,159,146,3309,6186,200,1689,14,1756,0,3165,
+    2836,4087,2645,1885,4747,213,4801,189,243,2945,5126,319,4756,203,5968,5527,
+    2678,261,252,3085,3218,0,235,3229,3998,2481,5194,322,2666,2780,211,245,
+    0,1607,0,5802,269,3128,0,4208,3294,243,0,0,2403,0,60,0,
+    3824,2347,2820,63,125,1742,160,2911,3040,2347,5154,7014,3565,4453,294,3470,
+    1986,4005,2353,6239,47,235,64,0,71,0,247,3055,145,5391,5855,6198,
+    3164,140,3102,0,3029,2765,2886,0,177,180,0,6694,3654,0,3107,2481,
+    0,1610,0,3173,5316,2419,2655,5786,267,216,7342,1678,0,2832,1985,3030,
+    89,2688,3001,2855,1896,2534,3007,199,0,1822,2484,0,296,111,5912,37,
+    0,182,3646,1623,0,0,1822,0,1877,2734,4669,2765,0,0,2667,50,
+    2982,2735,0,231,3029,313,267,3000,2849,0,177,1688,0,2415,0,5548,
+    3822,6021,0,5009,3250,6504,2291,2656,6042,0,199,1622,4376,2622,36,156,
+    0,231,4217,281,0,0,0,0,2743,0,0,48,2469,0,4562,0,
+    3491,6210,0,188,2854,2713,3307,0,2941,134,5545,240,0,0,2975,6195,
+    2838,286,5637,3218,0,196,4086,3294,7016,179,0,3074,0,5847,0,4485,
+    3383,179,260,2594,51,0,4041,6074,0,0,0,4437,247,2722,0,61,
+    0,0,0,0,157,0,0,184,310,2844,0,0,0,2504,0,219,
+    0,0,2611,2505,289,0,0,2833,2513,2019,199,3231,4130,2919,255,6230,
+    1920,3250,1952,4265,1606,0,3021,5890,24,184,6196,0,156,2623,6022,28,
+    3019,75,5607,2989,3826,38,218,0,3492,310,0,4447,2895,2869,0,0,
+    4711,4355,2524,4924,0,0,2008,0,3111,3405,31,23,273,107,0,3612,
+    242,3823,1607,2294,3051,1915,0,0,161,0,254,0,2217,2867,3046,241,
+    134,3095,6714,1676,221,219,4981,0,3111,4218,198,2545,220,5158,1962,3019,
+    1954,3710,155,0,0,0,0,0,2795,0,0,216,6359,2697,0,63,
+    204,3260,5662,5087,2062,3052,220,1819,2526,6074,119,4315,6799,11,6889,61,
+    49,274,0,0,3062,0,0,3496,0,0,272,5540,5105,6399,99,0,
+    5691,2432,3084,295,231,2867,2242,4280,0,0,3022,0,4113,3139,65,0,
+    2036,12,2747,2376,199,2768,4234,6498,5750,2936,2758,2617,0,62,1700,5819,
+    2011,2027,2745,3168,5086,2835,265,4650,1954,3195,2631,2820,277,245,204,3153,
+    2546,2074,4616,0,4286,0,2567,202,4321,272,3249,5422,3195,3870,288,0,
+    2274,2817,4156,3188,1601,3435,150,3271,2614,3174,2404,2688,297,188,6230,278,
+    2594,150,51,0,258,1876,2292,2525,3381,4901,3009,59,2473,0,0,5967,
+    0,0,0,0,3084,144,2496,3655,0,5626,4279,310,5002,0,0,0,
+    3007,3183,2892,2469,3063,2271,84,2272,3251,2743,2138,298,0,3604,3040,1603,
+    0,2073,1601,71,2228,178,2765,4569,86,271,290,2811,3172,5967,2600,226,
+    3175,1921,1985,5972,1813,1782,2160,2897,49,2270,5335,2804,3073,2367,5004,275,
+    15,0,2525,254,0,0,3096,2558,6006,3051,212,245,2714,2798,65,0,
+    3283,107,4060,2018,1676,3184,2020,3987,83,2492,5967,3041,316,0,0,4712,
+    2787,27,2207,0,1681,0,0,0,2790,4541,281,3098,89,0,5326,3881,
+    3141,2613,2017,230,2633,2308,11,2416,0,301,5317,208,3066,1781,3845,1602,
+    4321,240,3217,205,3697,2842,1838,138,0,71,2250,2095,71,5976,108,2141,
+    0,1876,210,2741,1763,3176,3998,215,0,2507,2084,0,3646,0,0,4211,
+    4263,2999,2549,2271,209,60,2501,0,0,5746,95,0,5363,0,0,3293,
+    0,6232,5311,2516,0,1808,0,4061,0,4534,0,0,5407,0,1745,0,
+    207,0,0,0,0,2523,0,0,0,2545,268,0,2644,2905,259,2727,
+    4151,6679,307,2646,164,0,309,232,0,2713,0,0,0,0,244,3767,
+    0,0,0,5086,0,0,0,74,0,2366,1829,0,0,0,1605,0,
+    2882,169,1707,3546,3161,63,283,2644,3308,3068,2270,2645,2692,0,73,35,
+    0,0,0,0,0,0,249,2075,2336,0,2846,2149,2058,4216,4674,48,
+    0,264,2028,0,3831,315,1648,311,0,5756,2612,0,38,240,5334,3794,
+    3030,0,132,3565,0,2661,263,0,0,2725,279,0,0,0,0,0,
+    119,0,299,2714,7008,2910,168,0,0,242,2235,47,92,271,0,4051,
+    6416,2668,0,0,259,5536,282,2502,119,3241,3611,274,311,6245,2339,14,
+    2075,0,73,0,2666,2876,193,0,2699,6435,0,35,0,0,5385,4868,
+    2795,178,0,1723,0,0,5995,3119,2793,1787,5766,4058,3285,322,2842,3073,
+    0,0,233,4768,226,1954,0,0,0,0,0,2502,0,0,1602,29,
+    3296,0,0,0,1655,3283,2908,191,3023,0,1979,0,0,0,0,0,
+    2285,2490,0,0,4975,7092,183,210,281,3830,2308,251,2568,1604,0,138,
+    0,2820,6471,0,0,2284,3031,235,0,4230,236,0,0,0,1600,0,
+    2493,2867,2486,1624,187,5325,185,3047,2787,249,5089,0,240,287,2093,289,
+    2985,1603,191,3010,2963,2051,310,133,2516,303,2590,1600,0,2479,2865,1607,
+    310,197,5985,0,237,268,0,217,2360,2614,5361,2670,0,0,284,2486,
+    0,147,221,0,4896,0,0,0,0,2337,1864,2160,3208,181,3140,0,
+    2630,2875,4364,106,3305,3250,3118,0,3736,0,212,1891,1772,0,0,2616,
+    232,25,3042,2810,234,3183,3228,19,2612,1885,2898,2623,0,72,2547,6404,
+    0,2628,188,7277,196,2941,3573,2809,4343,2649,2789,3382,2227,3036,2482,1838,
+    4667,0,240,1600,236,2493,4453,3024,2083,2527,0,2027,2867,2800,300,5491,
+    3031,2835,177,2471,180,1877,209,1745,2162,3174,3326,1615,143,2836,6679,4022,
+    2680,0,0,0,0,31,0,0,0,0,75,2848,0,0,0,5307,
+    1607,3162,3185,0,0,0,318,3030,2057,1609,0,182,2513,0,3778,3074,
+    0,4427,2424,108,0,3229,2712,19,5308,0,3250,244,4344,0,12,249,
+    0,5545,5985,298,4627,1699,192,0,0,0,0,6478,4225,2625,0,0,
+    3426,5545,0,2738,4436,0,0,0,0,80,272,2615,2996,3207,0,35,
+    2725,2505,0,0,299,0,2779,0,0,2336,6245,2660,3033,2273,1697,4597,
+    2559,5747,2678,3667,0,3018,6274,0,4867,2834,0,168,0,0,0,4370,
+    2746,1772,1601,35,2503,2715,147,272,2954,2527,1824,0,4426,3988,131,2668,
+    4013,2633,2425,2634,6209,2211,2777,247,249,4225,5643,318,1775,170,219,2518,
+    5527,5526,23,0,3126,285,2589,3216,4711,296,206,2569,138,3145,114,256,
+    1943,5325,0,2781,2947,2503,237,2901,0,2234,292,2029,125,98,2998,4094,
+    2744,2624,3177,3448,26,3785,59,2943,4511,283,2348,3188,248,3207,227,1819,
+    23,1907,2656,4687,3040,3282,2527,265,156,25,131,240,1951,4887,245,28,
+    4350,3987,2491,1641,2701,3173,1746,3018,1677,3242,2986,2866,3556,143,2985,82,
+    7056,234,4087,6077,74,234,3084,0,26,1811,2710,3998,2897,289,287,169,
+    2492,15,195,6074,3135,3838,4262,4123,273,2078,321,3216,5599,6561,278,181,
+    4491,3285,2559,273,75,215,1742,258,2996,3605,3832,169,0,0,3187,0,
+    1854,3231,3197,245,2669,6296,1972,2998,59,3240,4511,217,60,200,12,2418,
+    0,146,7072,2573,0,5105,3056,6679,0,0,3227,2898,2490,2171,1820,1782,
+    2623,213,5765,0,0,6440,0,2514,2581,2888,0,122,2843,3988,4210,121,
+    299,2647,4306,184,4870,287,210,174,0,7098,4711,2139,4665,0,2472,2537,
+    193,0,0,2954,2545,1611,280,0,0,0,0,0,2246,0,49,3339,
+    284,4426,145,201,1895,7042,3151,60,0,279,303,61,3042,3345,2589,4491,
+    0,2593,2545,5966,0,244,2837,71,2470,269,258,2086,5406,2037,1830,86,
+    232,2680,269,6681,7308,262,150,3101,0,303,183,0,2822,4490,3429,4270,
+    3216,4449,306,0,0,2768,64,239,5362,2546,5373,231,1600,4748,3052,265,
+    59,2981,50,2084,5222,3097,251,3349,2337,206,2843,0,0,2637,0,0,
+    0,2094,51,75,0,0,3241,0,0,5976,2349,0,315,143,3167,0,
+    0,1602,5370,0,6233,4050,0,4649,0,256,0,0,0,192,180,0,
+    0,5476,186,188,2480,0,0,0,47,0,0,2985,3295,252,108,2724,
+    0,0,2374,246,2085,2590,0,60,2776,3996,0,2864,0,0,4218,303,
+    6202,2888,228,1895,0,200,2503,2723,3767,203,122,0,2277,0,2875,285,
+    262,2169,2047,2347,2282,1874,2635,3307,1896,1607,2103,1697,5411,195,6686,2765,
+    4866,1613,0,0,3903,5030,0,0,0,202,0,2226,2953,186,135,2270,
+    2600,2837,254,2139,0,309,0,0,198,3077,240,2747,2842,157,0,4867,
+    155,301,2726,36,0,2755,4484,271,2272,180,3024,3055,0,315,6026,277,
+    0,1631,251,4123,3051,0,0,3097,1888,1781,6051,0,0,0,2301,5409,
+    2406,2965,3428,189,2140,3823,0,0,2657,4930,4656,2348,3042,6693,3558,0,
+    59,0,4527,2941,14,5417,3877,3308,0,0,0,0,0,0,173,220,
+    2798,3184,3218,0,0,0,2721,0,3252,5531,3317,2491,2206,3663,122,0,
+    3721,157,2208,295,2791,167,6104,196,0,5256,0,2900,299,4323,0,247,
+    3932,6006,2700,2955,3018,2974,5362,231,0,0,280,6103,293,0,5380,0,
+    2776,2996,0,0,2207,291,0,256,3921,4307,6109,2140,0,276,110,123,
+    5100,0,0,1657,0,0,3184,322,2944,0,0,318,2787,17,3434,2228,
+    71,0,2723,251,4207,0,257,1601,2679,4877,0,0,6715,2716,2755,310,
+    274,196,2650,2083,0,0,0,2243,4043,178,7014,0,3007,310,145,231,
+    290,3217,4462,133,155,3786,2757,2932,302,3293,4270,3066,3238,96,217,3272,
+    75,1820,203,194,6024,3311,2689,2515,3187,6026,315,1940,0,1692,1688,3874,
+    0,1636,3128,2966,2374,0,4076,0,3601,0,0,0,0,2296,3053,0,
+    2010,2557,2809,0,0,145,3200,2480,3022,2963,2999,0,235,2672,3150,3007,
+    3152,196,0,2919,285,254,274,4013,2898,2635,2908,0,0,3199,35,236,
+    2366,1682,211,155,269,1822,5195,159,6075,2549,1952,2700,290,107,2310,5756,
+    1602,185,59,297,5803,11,3242,169,3867,1607,4677,5802,121,2875,290,1606,
+    2746,2036,2726,0,2871,174,178,0,195,241,3986,250,122,3172,0,167,
+    6294,2376,0,2638,309,2772,1640,2722,184,218,5976,2700,3240,4812,283,5994,
+    0,0,0,0,0,0,3206,0,265,0,1688,4501,0,0,0,5747,
+    2490,3767,3021,2864,37,3833,2976,0,0,0,219,2547,3051,4216,1831,0,
+    0,2556,1698,2612,2754,271,0,5918,2990,0,234,2867,3618,191,2756,0,
+    3095,276,2206,3198,171,1839,2008,310,2633,0,0,2623,0,7047,2110,5096,
+    0,3095,0,0,3174,2613,2836,192,309,0,0,0,5885,0,6195,0,
+    239,2547,2682,215,1700,2479,2086,0,1606,0,2996,0,0,0,0,2487,
+    0,3767,3329,0,2291,245,0,0,2020,0,0,277,6038,1962,0,2820,
+    2857,0,0,0,0,0,2008,0,0,2300,0,311,0,2434,2710,1742,
+    125,306,231,284,314,4886,284,5443,180,2347,2235,302,2036,2714,3220,2875,
+    272,220,1621,3102,3025,0,2302,146,26,179,2780,3151,3030,231,2622,5307,
+    2215,3045,2558,3987,198,3390,2833,2474,86,3249,3086,5316,2942,2403,3062,6031,
+    192,2557,0,4866,168,0,2765,3567,3265,7035,3240,3238,178,2783,275,4355,
+    2832,4350,4887,4648,2820,0,5251,6387,3088,0,3614,5151,3620,3045,2988,3491,
+    0,0,5165,213,5590,190,5583,0,3054,2809,2744,1813,2062,183,242,3230,
+    2629,5089,189,1753,182,201,3682,3384,0,3293,1608,3078,0,24,3565,5101,
+    319,2779,0,0,2897,2667,306,0,2886,7009,1951,2933,1940,5318,4711,0,
+    98,0,227,216,4886,222,0,190,2701,1611,95,110,4234,251,5825,6024,
+    42,49,2007,2798,4832,210,1608,159,80,1941,3801,5995,2881,2651,230,3053,
+    282,0,5582,4498,3304,0,2440,5186,222,300,0,2733,2680,284,0,0,
+    311,4821,5555,0,2695,0,4059,0,2864,4486,2538,2424,2636,3271,0,3260,
+    2939,2913,95,2007,4322,1650,5141,2869,2996,270,2284,1753,5663,300,235,2072,
+    161,3121,2648,28,0,95,3130,5598,3627,2722,167,0,251,258,1940,213,
+    2573,3139,0,0,257,2425,208,0,1942,0,0,0,0,0,3074,6680,
+    123,172,5316,234,2326,0,185,0,2578,1940,2501,2545,1940,0,3559,212,
+    23,2579,0,0,262,2681,0,0,0,6805,3511,2656,0,273,0,0,
+    0,0,3162,2017,2374,2977,5969,0,0,112,0,0,0,0,0,233,
+    120,0,0,3195,1603,0,2647,160,2854,0,2545,255,0,2491,1600,0,
+    144,2798,2491,3029,220,131,0,225,0,0,2857,0,2659,5316,2858,1608,
+    0,114,2736,0,0,0,0,0,201,2474,0,0,0,5370,0,0,
+    190,221,1715,202,280,3316,1746,2483,2054,1764,5414,1742,264,4008,2691,247,
+    0,4850,5317,2919,5010,304,2117,0,3631,5537,0,2611,2375,0,3274,0,
+    5748,0,270,6032,235,0,1789,0,2627,0,0,2227,0,0,84,2097,
+    2722,5371,2032,4218,294,0,3077,0,3172,291,2027,0,2986,49,261,3327,
+    52,169,185,2770,254,0,0,2029,0,4463,3285,4240,5582,0,1925,2711,
+    3009,6233,2434,196,4206,5311,2854,2997,1634,4871,219,2729,3194,4747,1812,2085,
+    3566,0,5756,2996,183,0,0,3095,0,4755,0,5086,1787,4027,2913,2017,
+    0,137,242,0,0,0,3648,6718,0,120,170,0,0,2507,0,0,
+    197,0,3007,0,0,0,0,2542,2602,5529,0,2512,0,0,3051,2591,
+    308,2745,7016,2809,2534,240,0,0,6070,186,2776,2490,2809,3220,285,4906,
+    2986,1716,84,2604,0,2898,0,2516,263,5231,0,318,311,215,0,3289,
+    2403,0,181,0,0,3793,3847,2640,0,5584,0,223,0,0,275,0,
+    216,3573,3402,3119,3217,0,79,231,3002,1824,278,3129,0,0,3043,75,
+    2932,2656,233,2869,320,1602,1829,4701,229,276,60,3109,2524,0,3111,0,
+    296,2525,1955,5088,2033,254,2153,1604,2811,269,6361,0,3096,5087,0,2215,
+    0,2779,3176,167,2849,2204,219,0,0,2612,85,0,5371,216,0,230,
+    0,2702,0,0,0,0,0,0,2844,0,4498,0,2620,0,2614,0,
+    132,0,4946,0,0,3382,1683,0,38,3618,240,2468,310,71,133,0,
+    0,3263,5307,3227,3903,0,0,0,83,3406,0,4042,193,5306,2910,2788,
+    0,2481,285,0,294,2493,2139,0,0,3801,269,0,0,3227,0,0,
+    1961,6116,131,1897,0,2149,0,0,188,2636,0,0,1603,0,2604,0,
+    231,3161,3118,2790,3172,5449,6274,2732,285,3612,3084,2527,3306,3239,1722,0,
+    3143,2997,228,0,0,2710,3228,89,199,3548,215,3710,0,5716,250,0,
+    298,0,5804,4930,1830,2113,2672,2623,136,290,219,1878,0,272,1602,3034,
+    0,2493,3690,322,3717,318,1623,177,4966,270,0,0,5385,219,2704,3052,
+    253,217,98,3036,5100,5560,5527,6488,3320,107,0,3299,1648,225,0,5757,
+    1764,2507,0,5617,3106,2677,210,4050,0,172,6109,2956,0,4649,247,254,
+    3023,1821,110,0,0,4226,1840,0,4647,1808,4157,248,5969,5987,2800,6189,
+    4454,0,0,178,3304,3620,1819,2668,121,0,2629,0,0,3110,2413,59,
+    3654,6414,0,0,258,3284,0,0,28,159,0,0,175,2854,295,0,
+    3030,3180,4291,2534,5757,39,218,0,3129,0,276,190,157,0,0,0,
+    1755,1602,6723,317,4590,3250,2963,317,2600,5410,2093,2868,301,2746,4702,280,
+    2780,2848,220,2283,2627,1808,2468,2528,199,245,4885,2360,2975,1600,3063,311,
+    302,2281,5968,2124,3090,2539,2680,159,172,5634,61,83,3120,50,4673,289,
+    3042,252,3796,177,3304,238,176,4219,4041,23,2842,96,251,1602,2677,2512,
+    2282,2501,255,1609,3329,14,4009,5630,3261,2469,2348,2538,3151,299,2648,4042,
+    1689,257,2636,5867,1773,109,2788,2590,5873,3217,2046,4219,24,2915,6560,3320,
+    6032,4446,2681,23,3067,5414,2724,229,6610,2226,2270,1748,4498,205,201,2556,
+    3040,4784,174,1744,252,2505,2021,2545,2402,1603,3561,5406,3612,4968,4344,238,
+    0,0,0,3151,0,2348,2615,195,0,0,243,0,2845,0,0,274,
+    0,3131,4930,2578,0,0,4804,4481,3101,134,4563,3153,6888,211,0,0,
+    0,0,2898,192,272,6575,1697,2931,1676,3172,4646,0,2526,2072,191,0,
+    12,2997,6360,0,3102,0,0,0,0,201,2976,5980,4357,24,2944,0,
+    284,2516,5976,4453,0,2778,3230,0,3018,2234,0,6477,4007,0,5361,0,
+    0,0,0,0,0,0,0,249,2934,2530,2590,2514,0,67,0,0,
+    312,0,0,3216,2706,305,2569,16,0,3139,3399,2900,2087,0,2210,0,
+    3043,2207,3130,3434,1888,2756,6024,3063,1689,2723,103,88,3178,2997,2584,6083,
+    1600,2710,3937,2963,2603,170,2688,7217,2576,6279,151,4490,5774,2204,3786,2710,
+    2505,2702,2934,0,232,3251,1607,6717,0,298,0,3284,1878,0,2964,3625,
+    239,0,318,0,95,3287,1875,5121,187,202,1846,3777,0,0,6882,272,
+    3251,0,96,3345,0,1904,3040,0,284,237,112,2526,2622,0,2018,4176,
+    97,2968,5537,98,2162,203,2590,196,6358,26,1819,3206,2623,2300,250,3230,
+    3107,1601,2570,2873,3046,3074,6679,177,4649,5326,6021,1600,3031,5308,2617,2225,
+    245,5627,3691,3141,2877,3930,2776,6472,2866,29,2057,2846,5107,236,3108,274,
+    199,2844,2357,1808,2483,2272,170,5750,1602,5088,145,171,3184,3194,259,84,
+    105,5099,5750,3712,2886,3989,232,298,2854,3095,5143,3032,5408,1610,3053,5538,
+    3249,3517,2952,0,0,2945,5910,1606,6893,1879,23,1622,61,215,4001,178,
+    4481,0,207,268,1679,86,5966,4226,35,1747,234,5306,0,0,216,2495,
+    2710,0,0,5562,281,2570,0,2006,0,2669,169,5363,31,0,0,0,
+    0,2163,232,308,0,2919,101,2347,0,4667,209,2767,0,0,0,0,
+    2888,2527,5641,1607,301,159,37,1748,211,194,2788,224,0,196,4720,0,
+    0,0,0,2955,75,3251,3381,1824,0,3097,6279,1926,5422,0,244,2571,
+    0,0,2759,2084,3019,0,0,0,286,260,2022,3228,251,0,0,1971,
+    0,0,3417,0,0,2934,0,206,0,3067,0,229,174,0,0,0,
+    0,2660,72,177,2619,0,0,254,4240,143,254,1621,3655,287,16,4646,
+    298,2086,0,0,0,0,3241,0,2018,0,2700,4657,2636,2855,2474,0,
+    223,0,232,0,0,2837,3140,3097,2415,3294,72,3106,0,2336,1611,0,
+    2876,3130,0,3153,5810,4930,0,185,188,0,2930,133,0,0,0,2996,
+    132,2845,0,2722,0,0,0,299,0,0,0,144,0,0,0,5712,
+    2809,1742,321,3165,219,0,2776,0,1874,232,1606,181,1603,3575,0,206,
+    301,0,59,2997,110,5801,2414,0,3552,252,2886,2012,6215,4616,0,3229,
+    3018,2143,2225,2524,3119,261,2765,3997,3211,2846,288,2579,182,292,1612,1808,
+    6238,2560,178,2349,6483,2626,3612,291,288,4879,0,0,3228,4217,310,3650,
+    4006,294,317,2942,3118,2161,297,2119,3120,202,2561,3133,0,5186,3175,146,
+    38,3063,257,5527,4981,266,0,3150,1940,0,291,3336,4460,0,271,4710,
+    1606,211,0,4665,0,3602,0,2864,3682,0,188,2207,232,0,0,0,
+    0,1889,0,5882,5362,2724,0,218,0,4005,309,168,5126,5591,2468,1951,
+    0,188,59,2291,2218,3018,0,4094,0,0,3030,190,0,0,2908,277,
+    2140,2889,4447,0,216,2748,294,0,0,0,213,0,3830,2236,2645,0,
+    3903,4754,2490,4975,0,169,0,2402,0,0,27,4207,4219,4886,0,5325,
+    0,2711,0,0,173,2777,5581,3075,3128,0,0,3768,2748,4868,0,108,
+    5593,1608,0,3316,2589,0,6202,0,0,2833,2447,5097,2154,277,1881,15,
+    2567,4491,4262,3239,3031,276,83,0,0,0,5165,3128,0,4086,5758,2780,
+    0,0,5696,2997,193,0,0,0,2123,75,2909,0,0,86,0,3988,
+    107,225,0,3032,49,3161,3134,0,220,3117,221,0,205,3276,2407,2952,
+    2931,204,1823,4649,4885,2470,3008,0,5445,5236,300,2976,278,7097,5089,54,
+    176,6194,5381,0,3326,2864,2570,0,3951,0,0,202,0,0,0,143,
+    0,0,3124,0,3040,5002,2856,0,5757,3132,0,2733,5526,3055,170,2036,
+    4569,2291,2520,287,4042,0,0,0,155,2505,247,1610,39,4811,0,293,
+    3139,0,5972,0,0,256,0,216,3221,2644,4027,0,2888,3151,3106,4889,
+    3232,0,2480,0,2845,23,0,2725,3556,0,2965,0,0,0,0,0,
+    3327,60,48,2413,1942,0,2710,203,4527,1697,0,2387,2494,0,1763,5346,
+    3243,239,224,4460,285,6221,4240,0,28,248,303,0,2341,5317,238,2274,
+    4868,6472,6799,2997,6231,183,2605,208,5414,188,260,103,2679,3085,3262,137,
+    2761,59,1677,0,6300,3241,1727,3176,6317,2844,2473,2996,3785,1788,1604,4968,
+    222,0,2098,0,2759,0,5892,0,200,1605,4871,0,2504,0,2615,2273,
+    313,0,0,0,0,13,0,0,4264,1608,122,3283,5780,5443,0,0,
+    184,227,1602,2309,0,2754,4235,0,0,242,3262,2853,3194,289,167,2657,
+    2007,4659,0,0,0,6499,2823,0,2227,0,5361,2986,3205,2512,0,48,
+    5536,273,3008,3079,6021,263,3029,6524,3766,0,3437,4043,5361,194,192,4439,
+    3195,3776,198,2651,3219,84,216,2681,3205,4262,1838,131,1603,1691,4016,275,
+    2765,304,301,0,1710,3220,2152,3042,0,1824,0,3008,246,0,0,3073,
+    229,224,300,0,219,2656,0,3831,5746,0,0,5966,0,0,0,3260,
+    4454,4051,273,230,4266,0,204,3034,2735,0,14,96,3167,113,2848,7272,
+    0,4571,158,83,5591,259,172,0,3672,0,0,2076,0,2909,1991,4087,
+    2138,2361,2655,0,2405,2768,3821,2832,0,219,187,2996,151,185,260,3399,
+    0,1907,5096,3139,3558,2784,188,4528,2039,4930,2649,246,1609,313,2556,6501,
+    1641,235,0,0,4710,2602,2526,2493,0,3987,2952,223,47,2932,3869,4490,
+    0,0,0,4668,83,2162,2491,2502,2468,199,179,0,25,3701,0,4122,
+    2721,319,0,2914,5780,2911,26,224,2825,143,3096,197,3436,1944,178,2909,
+    252,5142,2672,246,2766,2958,206,3194,308,3501,4349,2474,3218,133,304,3076,
+    2600,310,0,0,2618,315,0,319,0,2952,5088,0,5586,2366,2236,5317,
+    0,0,0,0,168,0,1813,11,0,2856,0,316,3355,0,6132,0,
+    0,247,2235,2723,282,3185,311,2701,169,216,1604,2744,2152,0,1753,3031,
+    183,245,96,245,270,0,2602,1810,86,3128,2812,2534,302,322,3188,2736,
+    309,0,0,7015,4448,0,0,3141,0,155,0,0,5250,308,2714,120,
+    4656,6231,0,0,0,205,3161,2780,255,0,3621,4911,0,4500,2782,3271,
+    207,188,3221,4281,6195,2690,221,3040,5142,0,1615,0,285,1613,3052,2559,
+    0,3986,266,0,2908,0,3647,253,2931,0,107,0,0,316,1839,0,
+    2359,3185,28,5406,0,159,0,0,2964,0,6205,0,159,2853,1951,2578,
+    0,0,1621,2760,3243,1904,2153,0,0,0,0,0,73,186,282,2416,
+    1755,1905,190,0,0,204,2402,0,84,0,0,3054,0,135,1688,0,
+    0,3228,267,1965,2468,0,0,0,0,0,0,0,0,0,0,0,
+    318,0,2887,0,0,0,2361,276,258,3846,0,2988,3128,5024,1808,222,
+    2893,184,266,5662,160,0,2545,61,0,2603,2789,3206,0,0,5105,0,
+    47,1957,3185,3310,4711,0,0,0,284,0,143,2975,0,2491,0,0,
+    0,107,268,36,179,3602,5758,0,3511,2142,2919,2600,2704,3206,3238,3223,
+    0,1648,217,2291,3250,3988,0,2769,5197,125,5635,3152,0,2038,3207,4220,
+    0,5585,53,59,2691,3196,3833,0,4122,4933,4673,5629,0,0,3095,3076,
+    4572,4020,2505,2491,0,2865,48,293,309,1613,282,5251,0,2146,0,3298,
+    2791,3296,3781,2567,0,0,280,0,0,308,0,0,313,2875,2569,0,
+    3390,0,97,2406,0,0,0,5144,2988,199,3206,2733,219,0,0,313,
+    0,2987,2225,1611,3988,0,37,0,2923,0,11,0,2019,0,2404,0,
+    3392,0,263,0,0,0,231,3682,0,272,0,2866,3098,2142,0,2998,
+    6714,6816,4649,1864,4221,1951,287,0,3109,5414,286,2626,4471,2094,132,2765,
+    4262,2897,2759,3129,1625,1604,2606,2934,178,17,3823,2832,3710,2017,1604,3275,
+    2168,6808,1601,2151,4216,3120,286,3354,210,3108,2891,212,284,270,2340,3095,
+    2271,2534,0,0,3239,270,3315,1744,2562,2765,2655,6068,217,6188,249,2020,
+    16,0,0,2636,0,0,0,0,179,0,2986,0,0,183,246,4966,
+    0,3988,4095,5867,182,0,310,0,2837,203,245,5114,0,295,0,0,
+    2568,0,2468,5341,6743,3260,2507,2747,3087,3101,0,0,6477,6074,205,2747,
+    116,0,2963,1707,256,2754,0,71,0,136,122,36,260,2723,5407,3851,
+    239,0,4059,35,0,2234,0,0,0,258,1611,2834,2482,195,60,0,
+    167,2710,2074,2897,2402,2495,5803,173,3052,3391,2663,232,1754,2898,257,5141,
+    2942,2669,252,279,3227,2678,4490,2493,0,222,311,6827,2283,264,2976,2792,
+    292,6837,0,0,0,0,3100,3561,0,1758,0,148,0,0,0,0,
+    5160,1625,4006,3174,0,151,136,305,3172,24,0,111,2557,6130,0,5423,
+    132,0,256,0,2292,2029,5317,5308,1605,0,2944,3197,1602,0,0,1941,
+    221,3282,0,243,0,2710,182,2853,6102,155,4431,0,2636,0,2207,0,
+    298,1824,300,2897,0,0,3121,85,0,0,2732,0,317,3019,0,0,
+    0,2495,2606,190,0,6083,274,0,6210,3026,0,2645,0,0,3778,244,
+    0,3789,5172,0,3095,2483,279,1606,2424,3000,4306,0,0,0,190,0,
+    0,0,0,0,4150,2768,4428,280,298,3031,6203,6882,0,0,2405,2611,
+    74,1602,2590,0,203,0,215,2515,2432,2282,0,0,2633,3766,230,0,
+    0,1743,37,202,0,0,4273,0,2617,2017,0,2031,5675,0,0,1610,
+    2234,72,0,119,2854,0,4719,48,229,0,0,172,260,0,0,0,
+    0,4041,0,219,4210,4270,2922,3266,1963,0,2051,5549,2536,0,0,0,
+    3568,5890,3088,5378,2920,5966,112,0,3196,6187,288,2865,2545,2723,1609,2635,
+    5747,2854,3074,6051,4938,1810,1736,0,0,0,2017,2120,0,0,0,0,
+    4506,3030,3991,252,0,6267,1611,2572,2358,278,251,317,2416,4220,268,0,
+    5455,296,0,5003,0,259,0,0,2557,0,2611,4005,2524,0,0,0,
+    0,0,256,1885,0,0,250,269,275,3231,2605,224,0,0,321,257,
+    3183,2408,1601,2754,2919,0,1889,4646,4270,0,2617,6132,3095,2022,2633,218,
+    6302,300,5818,0,3833,3779,0,3682,3042,121,247,221,2206,241,254,71,
+    2528,2604,0,2601,2512,3118,1688,0,4484,269,5004,3997,2803,2505,2216,287,
+    0,5307,1810,0,3026,3602,0,0,0,5006,0,228,0,0,0,0,
+    1601,0,5114,102,3007,5406,2789,3577,2756,4217,11,2999,0,3881,2208,0,
+    232,2414,2732,0,3143,5186,3601,306,173,0,3141,1600,2095,2207,147,1877,
+    13,1707,235,3574,2623,1605,252,267,2352,2831,244,2688,2424,6021,1905,225,
+    2527,1755,2658,3033,2932,300,149,4564,2029,209,1681,3099,3253,5968,2501,3118,
+    0,5801,0,2614,1732,122,2169,2515,1601,3293,3924,5540,2820,176,298,3128,
+    2072,3132,2844,97,3173,0,0,0,0,1676,3026,3265,0,0,3436,0,
+    2699,112,0,97,322,0,0,2908,0,2286,3054,0,62,0,0,40,
+    4216,98,0,60,172,314,0,0,5406,224,248,0,260,4002,3185,3354,
+    290,5605,2760,134,108,3249,215,109,1885,4505,2177,3320,12,1747,0,1613,
+    227,301,5143,3966,2670,2281,0,4431,0,206,2947,2369,0,3463,287,47,
+    209,2909,2666,243,3497,18,3353,291,2875,0,1745,2976,0,0,5642,0,
+    5317,0,2947,0,0,6799,0,0,0,6425,1621,2994,2336,38,4713,0,
+    48,0,5848,0,2490,4666,271,253,194,206,0,0,309,2767,289,203,
+    3260,2846,2987,0,183,317,2138,2623,0,0,0,0,1600,2301,1887,0,
+    132,2875,284,0,2073,2997,0,2854,4234,0,1940,237,2996,3654,6209,2237,
+    270,318,2366,5538,2969,285,0,2018,5766,0,0,248,0,69,1898,302,
+    312,0,0,0,4878,0,2600,5590,0,2887,0,0,0,0,0,2644,
+    4210,2007,3141,2732,1808,3329,2908,1877,5846,182,1832,5861,2692,6051,3205,255,
+    2800,304,192,2338,242,266,2985,4731,277,4262,0,175,156,3153,3490,3118,
+    3770,116,3282,1906,1612,0,3195,115,185,1887,6022,0,4548,3305,273,0,
+    261,2964,3188,6269,3031,2765,152,306,314,2141,3150,0,0,6415,122,3750,
+    0,2454,3336,1775,0,2112,2537,4264,49,0,182,0,3282,317,2352,0,
+    0,0,0,0,2485,2810,0,0,7273,2237,2492,0,4438,227,0,4209,
+    0,2856,197,0,2541,1765,2866,1898,72,5041,6905,0,0,0,301,0,
+    2469,0,230,173,232,0,2943,4046,2579,2485,4286,252,0,7223,207,4436,
+    178,0,263,4438,3120,0,4013,3153,4687,1954,273,0,0,0,3383,3097,
+    2528,321,2491,24,0,48,18,277,168,4007,2977,0,0,1615,0,3476,
+    0,221,0,23,6021,84,4789,3196,2657,2933,3251,3161,0,0,0,0,
+    0,0,0,4150,0,0,0,1631,2472,2867,4438,3242,64,232,6110,2604,
+    224,2204,0,13,3205,212,2920,4878,2603,73,5150,3218,101,2657,134,3318,
+    2581,96,306,2281,1926,47,3716,1742,265,0,170,216,174,0,0,2407,
+    4747,3153,256,2636,248,144,0,0,24,0,119,1764,1816,1689,2821,3163,
+    200,4736,1601,90,23,4097,2482,2513,2834,210,6141,6190,206,3306,3347,3840,
+    0,195,310,2626,3345,3183,4534,2649,0,0,0,235,0,0,2608,168,
+    243,2504,0,3230,3054,321,1758,2650,271,0,2668,2711,2600,4101,2747,0,
+    0,0,3405,0,0,5392,3142,0,211,3183,0,2845,2527,0,2688,2227,
+    0,0,2512,2942,2683,30,0,2624,1721,4868,2864,0,0,5635,2420,2857,
+    2143,2514,198,195,204,2560,211,3307,137,4494,2822,83,2524,3117,4763,2470,
+    2405,300,0,0,0,5765,3101,304,189,212,315,2747,3151,6679,2667,0,
+    0,0,2760,2976,0,0,0,0,0,3338,285,0,0,0,3249,317,
+    2992,2545,3295,1743,2006,4873,0,0,3293,0,6757,0,0,0,4705,2605,
+    2469,316,4691,307,2788,175,250,49,256,247,0,266,179,4241,3074,2160,
+    1614,236,121,3153,3271,0,2669,4342,2757,2876,116,2293,305,3062,4926,60,
+    6483,236,1820,136,5442,26,0,0,2480,2757,4703,2866,2414,3513,41,0,
+    2570,37,0,0,120,0,185,2875,2292,108,322,0,155,3304,246,200,
+    2831,3186,2468,2622,0,273,2205,3228,5105,2809,85,6721,267,6021,5582,109,
+    4279,5539,2293,197,0,147,4440,1897,5977,3866,3133,0,262,5663,322,0,
+    0,3186,3130,316,0,13,0,0,1905,5826,3192,283,3338,3655,289,1753,
+    0,6039,0,2627,2722,5371,317,0,5492,114,0,2469,0,0,233,1889,
+    293,2678,4746,231,4926,5986,2210,3112,3550,2639,2160,150,2616,3381,321,286,
+    1874,4931,202,3120,222,2404,2019,321,279,188,3018,207,4051,7162,220,3200,
+    295,2691,2607,301,169,2879,5546,1688,3262,1677,3768,288,5590,109,2580,61,
+    6388,193,3073,3189,4516,4866,2492,2732,2945,3573,3152,2685,144,193,2252,3904,
+    2565,6002,289,0,5627,5767,1609,2843,186,3390,4867,4938,2684,2992,254,181,
+    234,0,170,2571,2273,173,2535,0,133,2058,48,3185,5528,249,6387,3097,
+    3055,3548,2374,196,1605,2823,2732,2855,1962,3066,171,4140,2503,52,0,74,
+    288,0,201,0,274,0,2288,3428,12,0,0,27,1819,0,307,2579,
+    3620,3139,5643,2645,2743,2953,0,0,2791,2933,5545,290,0,304,2495,0,
+    2838,3020,0,0,0,1875,1809,0,0,5317,3240,6805,0,0,222,2986,
+    6420,3101,73,189,64,2759,14,2473,2485,270,0,2209,12,168,2780,61,
+    5311,2822,227,0,283,265,3830,5005,4208,310,2568,5988,0,2868,6142,1906,
+    3264,3034,0,4562,0,0,2930,290,0,2812,0,0,6519,156,2178,3501,
+    2877,1608,3667,0,192,2810,1940,2426,6801,5113,3249,0,4647,4279,0,181,
+    1951,2809,2347,5900,2468,60,1970,190,280,2789,5450,78,6414,5628,3174,5319,
+    299,2528,2724,303,1780,0,265,2284,2485,4881,4931,0,0,12,1605,3110,
+    4866,179,2284,0,309,286,3063,2516,3462,0,2473,5121,0,0,0,210,
+    312,6425,207,1970,2204,227,2564,2656,0,0,183,135,3315,0,0,5677,
+    2657,1708,0,0,4783,2977,5364,3911,0,1607,248,0,228,144,5801,13,
+    3286,71,1992,3121,1961,2912,6202,2790,6420,186,2853,126,0,186,0,2471,
+    161,0,3119,2735,168,2494,0,0,0,2773,0,0,0,2898,0,2468,
+    2842,2072,148,5115,86,5883,244,85,3381,212,2768,5889,5933,0,5966,3906,
+    203,3052,172,3822,2732,5496,305,2093,92,2613,2800,128,3996,1913,2972,3778,
+    0,0,2225,119,298,203,2734,0,192,4087,35,219,2098,3285,6376,5648,
+    3283,158,4453,0,0,184,2688,2759,3583,6233,205,3249,3293,2866,3117,2757,
+    131,4662,0,0,56,95,60,2491,6007,248,0,2503,2407,1616,2834,283,
+    200,2681,3501,1895,5971,2691,3110,257,3205,5098,3328,2855,3141,3222,5582,3548,
+    0,0,3120,0,0,2857,320,199,47,0,5628,35,136,3331,1821,0,
+    5545,0,0,0,3174,5977,24,2470,0,3838,2933,0,5160,0,2085,4172,
+    2678,243,2878,3112,307,5553,2788,3284,3282,2922,0,306,2516,3284,226,6030,
+    2843,250,2721,2524,1962,1886,1617,3073,0,2843,2703,0,1676,2513,0,0,
+    1831,155,2876,0,220,24,0,3825,211,281,269,3042,110,2075,0,0,
+    0,0,3998,0,119,0,0,2779,0,0,1606,2102,3249,2820,261,2878,
+    2168,2932,2442,0,189,0,0,107,0,4648,2600,303,0,0,60,0,
+    2810,84,2666,3020,131,4922,2523,1788,2547,4680,3119,186,3153,0,2244,226,
+    3684,6256,0,85,2508,2835,3998,3217,2697,3470,0,0,0,2834,0,2204,
+    3412,0,0,132,3428,1608,2678,3217,2978,2235,1808,3008,176,5224,0,3056,
+    1688,319,2436,111,2226,2657,4217,231,3875,3273,0,2559,305,0,6611,2778,
+    2592,0,5680,0,0,0,0,0,0,1700,0,2073,0,208,290,297,
+    4151,2945,197,189,119,2377,226,0,0,2480,52,3250,5471,0,201,1879,
+    171,0,4867,221,0,5098,316,4968,3731,2956,1609,60,181,1706,156,4483,
+    3055,289,2887,2790,177,2943,0,209,184,256,0,2947,2558,2406,0,2773,
+    2778,2799,0,0,0,265,13,0,0,3567,0,0,4785,0,0,3154,
+    0,1600,1601,0,0,0,281,0,0,0,0,2603,3548,27,72,0,
+    1742,4880,0,0,305,6812,2546,264,0,0,2580,0,2433,0,0,0,
+    3766,119,2534,42,2491,26,2820,134,3035,3059,1604,3261,3185,3604,4968,3009,
+    199,24,26,5768,1768,5813,0,5106,1614,177,2756,2311,0,2813,225,72,
+    3238,0,4592,2843,0,4976,2875,0,0,1606,0,7035,0,0,269,162,
+    0,0,2667,0,0,2536,203,0,0,0,247,290,2527,53,284,2803,
+    71,0,5089,0,2474,2811,0,5096,0,2987,0,2848,0,0,2492,2953,
+    3173,2650,0,2347,2118,0,2526,1931,6268,3007,236,125,0,0,0,225,
+    184,2534,2833,240,0,6074,4210,83,0,2740,0,0,0,0,233,2270,
+    4746,221,2996,5186,6166,287,0,1981,2772,6801,3261,2658,3308,6189,1688,0,
+    290,312,236,68,2998,1687,4940,6721,2637,4226,2169,2996,0,0,0,2475,
+    0,245,175,258,1971,1811,196,174,1687,51,2083,2623,229,2825,0,2589,
+    2168,0,72,4564,3308,1874,5553,2524,6067,230,3184,1941,5362,3253,2856,3120,
+    0,50,0,3866,251,0,2008,3282,2184,150,0,0,148,3040,143,0,
+    0,4044,1812,0,4725,2859,3018,0,3173,187,273,204,6301,146,0,0,
+    184,300,203,0,2205,3183,0,32,134,2469,1631,0,2966,6068,0,3469,
+    0,0,2171,2019,2873,4821,2780,2886,2523,291,111,190,5976,252,2075,40,
+    3936,281,2480,1942,2275,2008,62,3565,65,1633,4437,2681,2152,2038,0,2909,
+    6499,1811,163,4703,2538,233,2849,2710,256,2612,4150,2909,3319,1602,88,2503,
+    2151,322,202,234,0,238,96,2512,1878,3770,0,4296,4261,4062,2501,0,
+    3051,230,0,0,0,284,5861,0,23,5171,0,2322,0,3603,0,3162,
+    2754,28,2766,2528,2693,6038,3117,0,0,6742,3062,4938,2924,83,35,1742,
+    0,2803,2358,2945,1753,0,286,0,4755,0,2724,0,94,2243,3286,3064,
+    266,75,1897,2504,132,3151,2012,2899,2670,4887,247,206,12,2567,3217,263,
+    4529,292,303,2758,225,3336,0,3019,2743,2526,3018,257,273,4933,0,0,
+    3587,0,313,0,5825,2647,0,299,0,0,0,2911,1676,0,0,2890,
+    318,0,2603,2366,0,99,2469,3173,3287,3548,2908,192,202,5098,4045,2525,
+    0,0,0,0,0,2966,2781,0,2937,0,0,3304,0,0,3260,0,
+    6727,2930,59,2578,202,7097,72,2601,0,286,6828,3075,5096,2573,0,0,
+    2596,5780,0,211,5891,0,0,297,291,215,299,2429,0,3195,2606,2745,
+    0,0,0,315,2997,2503,0,2979,0,2930,2529,0,2974,314,4207,192,
+    0,127,322,2502,2469,39,197,0,3304,3316,1970,3100,0,175,28,2485,
+    0,0,2946,5767,3318,233,4888,0,199,2887,6748,239,168,291,2018,2920,
+    0,3010,3271,6525,167,0,4867,3275,1809,0,5010,176,3078,53,0,0,
+    2743,2944,0,285,3172,0,0,0,2008,5306,1819,2524,0,182,0,259,
+    4831,0,171,0,5581,1808,3306,266,0,0,217,0,6436,219,0,0,
+    4130,2097,272,0,0,0,85,0,2526,2832,0,0,25,299,300,1952,
+    3239,4719,2537,315,2679,0,0,268,98,2072,0,5471,6504,5801,201,2170,
+    201,3228,5325,6441,185,3841,110,3627,176,2601,2635,71,2521,303,4009,170,
+    3776,210,2931,0,294,3318,1687,2783,0,4467,5333,236,119,274,0,4280,
+    0,4125,0,0,3295,4371,2997,2810,179,318,3721,4484,179,3618,238,6743,
+    0,4227,0,2755,3329,0,0,4867,0,3381,3074,4538,2204,3249,0,2744,
+    6387,3098,1753,0,0,0,0,293,0,2570,2945,0,285,1602,0,3227,
+    288,2402,1962,3920,3155,83,3075,145,226,296,5773,0,0,1835,3830,284,
+    0,2888,226,3095,0,5774,0,0,0,0,2235,86,6030,184,1819,2798,
+    2151,2823,4482,2604,2470,2711,2765,248,2736,304,146,1604,239,5626,6883,5306,
+    212,3113,87,257,2493,2404,169,2017,0,2612,2481,0,143,0,0,2755,
+    60,1861,6745,0,289,75,5452,2779,3209,1634,305,2504,4675,2930,2762,2639,
+    5545,119,2986,3183,2407,63,3398,3295,4261,2074,3228,2744,0,4306,306,3208,
+    195,0,297,0,223,0,0,0,4665,0,320,49,251,0,312,0,
+    4877,313,3909,0,0,0,279,2771,232,52,214,2963,0,156,1941,77,
+    2748,1602,143,3282,0,5167,2733,243,4272,5105,3779,2811,209,11,3786,223,
+    3838,0,2491,0,2272,2458,35,2880,0,0,0,3668,6470,2072,2855,6202,
+    0,0,2159,6358,0,194,3040,2770,2093,269,0,2633,0,3118,2668,0,
+    2843,0,6519,0,2683,2986,0,0,3771,195,5222,1819,0,2580,0,0,
+    0,260,0,2800,270,159,0,0,266,2270,0,0,0,0,6280,0,
+    0,4135,143,0,0,0,168,219,0,0,1635,3217,0,0,0,0,
+    0,5532,2523,2986,0,0,1793,2217,0,0,210,0,2515,319,2890,283,
+    6387,1611,265,5861,4881,192,0,0,5882,3262,181,3075,3636,1604,0,2581,
+    3008,59,83,4877,2754,2611,176,3997,257,62,299,4221,59,3567,244,2018,
+    0,2206,145,315,0,0,5635,0,2666,213,6477,3322,2666,5856,0,2659,
+    1609,3297,5626,296,3131,5968,88,89,7242,5676,1953,2853,3233,2535,4206,1766,
+    0,0,0,150,2469,5410,0,3085,0,0,0,2919,132,2767,2946,2681,
+    2959,2655,5443,62,0,0,0,0,0,0,0,0,5204,0,0,256,
+    6679,7274,2754,3119,3161,1608,1754,0,4206,0,0,192,2712,0,2981,2294,
+    0,275,2722,4789,0,0,2270,2615,251,0,0,0,0,0,2505,0,
+    1754,3010,3076,2053,24,230,2922,2512,5537,4877,0,2205,1649,2347,288,227,
+    296,3355,2843,2845,2768,3178,3297,2712,2159,2967,2094,290,0,0,315,2721,
+    308,0,4261,3218,2886,185,5751,0,6152,5967,25,268,0,0,101,2360,
+    1951,242,0,0,0,3304,175,3766,1942,5115,3207,1992,2073,2471,96,5372,
+    1683,0,3080,226,5271,2978,161,3337,0,0,96,2483,1745,0,0,0,
+    87,0,194,232,4236,6234,269,84,6764,0,251,212,0,0,2044,2901,
+    2285,264,3129,0,4660,241,3856,1601,2832,256,0,5526,4894,211,0,4596,
+    3052,0,318,4647,0,5367,1906,0,0,6724,1904,6248,90,3030,4535,4782,
+    3166,4051,2640,194,298,1603,5780,2393,5612,72,300,2891,1677,2677,2485,318,
+    0,2699,0,0,3216,0,190,0,2413,3426,0,3096,299,2721,0,0,
+    0,2710,0,4130,0,0,0,0,3054,0,3173,3001,0,0,209,5585,
+    4718,5590,284,5993,202,245,191,3767,0,5631,0,4967,203,0,219,264,
+    5306,0,0,0,5373,0,2878,1689,2139,3106,1829,3991,47,2474,3084,6047,
+    0,0,0,0,0,217,0,3304,0,0,0,5592,312,3084,5867,3657,
+    3207,1608,3392,228,2886,2755,143,0,3218,6353,2102,0,0,2843,0,3036,
+    3252,0,2800,3212,0,3068,0,3130,5086,0,0,0,222,171,230,0,
+    0,4710,2744,135,2728,2074,217,24,2944,3139,2941,0,0,0,2989,2502,
+    5560,0,52,1898,211,1875,2776,246,3106,2658,63,2124,211,2789,280,5371,
+    2529,2735,0,0,268,0,0,49,214,2711,253,2343,3010,0,2799,1808,
+    289,0,0,279,1888,3184,278,0,0,107,233,229,0,3229,0,6351,
+    1776,2930,3231,6030,4492,5327,3777,0,3852,2836,3031,2583,278,251,2569,2432,
+    0,3007,2985,317,263,131,0,5320,77,6805,3029,3337,4430,7114,137,178,
+    0,0,2534,269,0,0,3987,0,0,0,2124,5326,0,2274,0,261,
+    4428,2009,2603,167,195,4941,197,0,6393,6714,257,39,2432,2705,5837,11,
+    3131,315,196,2138,48,2669,317,2613,228,98,4691,2208,4704,108,121,3838,
+    0,203,0,5142,303,2052,5531,0,2724,0,0,2591,0,5819,3000,36,
+    0,1745,0,0,3282,239,2074,3366,0,0,2542,5781,2514,169,313,73,
+    3618,0,2017,3316,0,257,0,274,62,2769,0,0,3261,235,277,3175,
+    204,301,0,2782,3317,2204,1678,3173,2956,143,2568,171,6022,4043,3166,3771,
+    0,0,1963,0,86,88,107,3173,230,123,2537,5225,2767,0,0,0,
+    206,0,0,210,0,0,4714,148,2745,2886,0,254,229,2810,304,0,
+    0,3274,170,0,0,6266,5692,1961,5539,3073,107,12,3185,2859,1605,1632,
+    0,0,0,2844,135,298,2798,3141,303,0,0,2644,2052,0,0,3076,
+    3076,24,5235,296,2159,4484,2281,0,281,2336,5967,2644,2688,73,193,2493,
+    242,170,204,182,2271,2427,2350,258,2578,3108,2072,171,127,2691,1876,6700,
+    2958,180,182,6680,2747,3154,64,286,192,3108,4867,4217,0,3788,255,225,
+    2044,0,0,4436,295,209,3305,3008,0,212,2502,1633,61,3779,5443,2999,
+    173,219,3612,1605,3118,0,4491,4437,0,0,321,4868,174,0,4041,2699,
+    3100,72,5195,267,2998,5128,1763,6350,2509,205,1831,213,6827,218,2824,206,
+    181,3106,219,186,0,11,278,25,0,3023,0,2832,2669,5583,3207,4227,
+    189,2073,0,0,0,0,1631,0,143,2017,0,2072,0,0,83,2732,
+    298,5967,2272,238,0,2978,2159,2978,278,0,0,1772,12,2646,0,2595,
+    3173,1642,2534,4783,176,0,4888,3398,0,0,4410,257,0,6716,3185,2635,
+    5090,168,0,0,2491,0,0,0,0,0,3239,0,0,0,0,0,
+    0,3063,2317,4702,3986,221,168,4620,0,0,3062,0,5229,0,2975,2713,
+    35,2027,2208,239,3273,2746,1615,251,1820,3238,3631,2766,3175,2710,2892,7097,
+    3107,0,2350,0,1947,0,5748,6194,4571,3087,60,0,0,2523,3198,49,
+    294,2791,0,0,272,3062,257,2656,0,99,3064,0,3612,0,0,0,
+    0,1906,0,3766,0,3117,0,5089,2018,313,2083,3371,2646,6196,2525,186,
+    191,4122,50,2366,0,158,1635,217,0,230,2777,0,25,227,0,242,
+    319,0,0,2072,0,2347,0,1744,236,2493,185,0,4647,0,0,3086,
+    0,0,1678,0,2218,3559,201,3360,0,0,264,28,0,0,0,2725,
+    144,0,0,3146,0,2138,247,1615,2468,0,4748,0,239,1897,2534,2877,
+    0,2580,3580,0,0,4720,0,0,0,76,0,2226,0,3285,0,2810,
+    182,2969,291,3051,0,0,1623,5581,50,2714,2483,0,0,3238,0,3019,
+    4493,1677,295,3189,1623,2703,319,4665,5994,1603,2656,0,0,0,2953,172,
+    2470,5407,0,3077,2625,7020,5173,0,84,73,0,0,2249,0,5748,0,
+    0,6230,5978,3305,0,2625,3032,217,2626,287,2482,2757,5910,268,2755,5201,
+    1877,1612,4206,263,4866,2702,2075,2778,260,0,3845,146,2839,1890,0,2536,
+    0,0,1838,2614,0,1609,0,0,1676,0,0,3041,0,0,188,3381,
+    246,39,6031,4010,217,3253,2974,4466,1788,2813,197,4041,2839,0,1676,3185,
+    0,0,221,135,2871,265,2823,3042,2985,2768,0,0,0,0,2502,63,
+    0,3200,0,0,0,100,0,0,0,0,37,0,3059,80,0,6204,
+    192,3030,1838,5690,3746,124,2590,0,4710,3096,2635,0,214,0,0,203,
+    2102,0,0,3288,0,49,0,0,5748,176,3767,2945,0,0,3987,4158,
+    314,188,0,5097,0,0,4649,2728,0,177,0,0,0,3053,1964,112,
+    2782,2358,0,0,0,0,5361,2712,0,0,2761,1610,25,0,3547,2983,
+    3154,2636,3024,2285,0,5229,0,0,2886,2712,5989,2876,4526,315,4436,0,
+    0,0,2498,275,0,0,1600,6102,0,3134,1831,144,0,1874,310,0,
+    1610,189,4876,2447,182,5802,3101,1714,2493,5846,3029,0,0,0,5592,24,
+    0,0,2235,0,2660,0,0,313,280,242,3308,156,0,0,2726,281,
+    195,2468,2283,218,2036,4058,193,2743,2999,0,0,1943,141,2789,2019,2963,
+    1608,0,0,0,0,96,0,2270,3262,3032,0,0,4436,120,0,0,
+    4701,0,2754,5176,4922,4471,156,0,0,3085,35,2567,7091,5098,0,2897,
+    0,0,0,0,1886,3385,3297,2932,285,187,209,1953,0,0,112,2140,
+    1838,3362,0,2102,36,3001,0,0,11,0,176,156,2953,4866,172,2606,
+    0,2493,0,3021,4747,0,4342,48,2626,0,0,3029,187,0,48,1606,
+    2602,0,0,2358,273,78,3043,0,2644,3162,0,0,4426,243,1859,249,
+    0,134,5335,4653,5106,0,3239,180,5810,2809,0,0,120,0,0,2837,
+    3183,0,4058,2713,0,2958,0,3997,3095,0,0,0,2037,4906,3095,2911,
+    4876,43,6616,2468,266,48,298,319,252,2615,2888,0,2964,3989,2854,7152,
+    101,0,269,0,0,2104,5325,0,0,0,0,302,0,0,305,0,
+    0,0,2584,0,0,0,0,2910,0,60,0,2636,5931,184,1601,1912,
+    0,4511,246,1706,4233,282,0,3108,0,3141,0,0,293,275,87,0,
+    0,0,3194,0,196,37,0,3128,4086,0,230,178,5363,0,0,266,
+    0,0,4266,259,0,0,0,0,171,4426,2766,0,0,3845,309,2680,
+    0,2337,3390,0,2862,0,85,0,2935,291,283,307,2802,6884,5526,0,
+    245,0,0,3327,3163,0,248,0,0,0,249,0,6209,2845,0,5090,
+    0,0,3022,0,0,0,5605,3320,0,2986,0,2906,6918,6195,312,2413,
+    298,1765,0,2339,2879,3051,18,4727,6471,4646,2721,2809,4279,1677,0,3315,
+    297,2798,4327,1823,3766,2833,3052,285,6358,2470,148,2923,2712,4782,146,3228,
+    2739,215,0,96,0,1614,2602,1743,0,0,2744,0,3058,2512,0,60,
+    0,5016,0,2839,0,4923,0,1677,2681,0,2779,0,0,2645,0,2624,
+    2890,3029,181,2934,3119,120,2989,155,216,5087,222,2336,5555,2741,4102,139,
+    2854,0,273,0,249,4974,291,2662,2282,2975,320,1727,4711,2769,237,3672,
+    0,2526,255,203,0,0,2846,144,268,6805,2743,0,4044,0,0,0,
+    3118,77,0,5812,96,3286,2887,0,18,2486,237,0,174,0,2677,0,
+    3075,3771,251,13,2403,5203,0,2931,2899,2755,136,0,3822,2935,2633,2762,
+    5096,5371,6358,3261,2302,4020,2540,214,0,0,3077,3580,0,0,0,0,
+    6211,4315,2434,2423,2723,2425,3157,2473,2754,305,3216,3580,2723,3426,2516,177,
+    5392,2758,4877,6833,2879,4541,194,2149,2658,220,83,0,6266,15,3113,2722,
+    5397,5696,288,3077,2875,5086,2912,2754,0,4682,131,3904,1961,2479,0,2603,
+    295,2568,228,2998,316,2743,1809,2568,83,262,2103,232,2778,3230,5087,3295,
+    2073,321,2568,0,0,2932,289,0,2913,189,1604,303,0,6151,2160,5986,
+    3307,2602,0,0,0,3108,2149,95,271,2865,0,6753,266,0,0,249,
+    3190,2645,3271,0,0,0,0,1608,0,0,0,0,83,313,296,1780,
+    2321,2732,2622,4453,2936,0,168,6728,2769,0,6938,5581,65,254,2872,4349,
+    0,0,0,2911,0,0,4967,1606,0,2824,2272,0,213,0,0,6195,
+    3040,2208,2789,0,5802,2646,0,285,2821,5546,2712,2941,286,0,5541,0,
+    235,3197,1607,5546,2255,1765,275,0,3869,3065,2688,3174,226,3361,2572,174,
+    1744,4206,131,199,3008,2029,6102,269,0,1743,111,2897,113,2097,2787,2920,
+    0,4659,3024,88,0,2096,2350,1698,0,3095,191,2300,218,115,2281,0,
+    2607,0,3024,5647,3086,286,170,2872,0,0,1756,2084,0,3990,0,0,
+    5530,24,3823,2616,3366,0,0,4316,0,2468,0,2714,0,275,0,5760,
+    2512,61,5634,2886,0,2659,0,0,0,279,1948,2667,0,2634,2052,0,
+    2723,4328,0,3165,119,155,4946,0,0,0,76,212,0,0,3196,258,
+    0,0,3296,0,3265,3316,0,259,6953,0,0,5761,87,13,0,171,
+    0,0,177,4349,193,245,24,5450,5747,0,5627,0,288,0,0,0,
+    2931,120,2579,0,24,3546,241,2480,3031,3018,3173,2816,204,295,1978,0,
+    1607,212,5536,312,3096,3318,5207,4206,2578,4656,312,2369,3051,2006,1895,3019,
+    255,2767,261,188,2624,2749,84,3161,3012,0,3031,0,0,1644,2600,2744,
+    71,180,0,2351,107,219,2433,2602,0,2139,0,0,0,274,0,47,
+    6366,1708,86,0,3769,2832,1838,173,2568,3260,316,2700,2524,2601,0,5271,
+    3141,2052,0,0,2548,239,5222,310,3462,0,0,0,16,2484,193,0,
+    1641,1753,2591,85,3391,2936,5443,172,276,7148,5089,2842,2403,215,3008,2494,
+    2996,4548,3747,3118,71,3150,300,2480,5810,2613,252,5144,3340,156,1753,3294,
+    2624,2645,0,3241,0,274,6714,257,274,2433,2616,200,3064,2519,6046,2613,
+    0,3276,2802,180,0,2677,296,0,5380,2150,6070,1878,0,2468,1940,52,
+    0,2492,0,73,2291,116,2810,195,176,0,1682,1965,2592,3655,268,143,
+    4931,0,39,288,0,2959,0,0,5583,3427,205,0,5993,295,2657,214,
+    0,98,4751,4701,0,1692,232,2337,223,181,145,269,3331,311,1642,5346,
+    281,2865,317,0,2547,0,3933,144,3195,255,219,186,2946,2964,0,0,
+    180,205,6828,2833,5317,4263,2286,3274,2689,5813,316,1829,2483,5750,0,2735,
+    0,0,0,5855,2897,0,3000,3217,1846,4939,193,5968,0,0,161,3869,
+    2920,0,4060,236,295,2557,4925,0,4426,0,195,180,5814,287,309,0,
+    2921,2008,2087,1609,5912,202,2678,2754,172,266,2512,204,256,269,316,5146,
+    5590,257,6068,62,2425,2481,2282,1688,0,2674,3161,3305,5306,3284,244,3602,
+    5316,2844,0,121,3044,4306,0,0,5560,5052,11,2755,0,1743,3832,3097,
+    0,3766,2242,0,5746,289,4754,235,0,4430,5235,3216,5978,2859,0,2912,
+    3996,2250,1613,7065,1687,2827,2877,28,131,274,3986,4938,183,219,5096,255,
+    2403,2407,2900,146,2559,181,241,2897,4893,1605,2910,3551,135,178,104,2699,
+    124,0,136,2657,0,3999,71,315,313,5987,172,1609,99,4761,0,204,
+    2415,246,1679,1942,2838,3243,2649,208,300,2754,144,3355,83,181,5895,7009,
+    1941,2865,5188,6485,0,1706,0,221,2392,209,0,3556,0,5810,0,0,
+    2988,0,257,3238,2474,5229,6351,5442,3067,194,4657,5096,189,218,6393,4885,
+    2546,3163,2803,4021,5428,240,0,4703,1912,4376,0,0,63,4141,3129,264,
+    0,2097,2432,0,2347,1772,2215,0,0,297,1609,214,1602,4718,116,2921,
+    1602,0,256,1610,216,3249,0,1781,0,2799,0,0,0,0,5847,1605,
+    0,0,3241,0,5031,2944,4702,243,3330,3090,5031,2482,3173,1952,6470,2625,
+    4237,3557,73,1605,157,0,73,6082,1789,273,4086,0,0,4261,160,2496,
+    3022,3232,3626,6799,2845,0,2656,3197,310,235,3220,322,3052,2737,3117,5236,
+    205,0,2747,6695,2205,62,188,120,0,6187,0,0,0,3011,0,0,
+    156,5202,306,0,5100,2338,2482,2537,2618,5611,0,0,2215,2692,1757,1978,
+    0,195,0,2589,0,4428,255,2986,239,135,0,2470,0,5106,2735,235,
+    0,164,6393,292,2336,3195,1881,0,5804,0,0,0,75,0,2867,0,
+    202,0,297,5757,172,0,2919,6805,1605,203,59,1809,258,2842,0,5250,
+    37,0,1617,2738,37,5993,2601,247,108,0,239,2096,97,207,1876,2911,
+    0,2205,1970,0,3296,2980,133,4241,0,2552,25,2617,2216,6068,2496,3122,
+    226,0,2967,0,1742,0,0,2601,2624,47,0,299,3293,5977,0,2141,
+    2612,2524,5662,3164,2468,3330,261,2633,318,42,3150,2176,108,3306,159,1604,
+    297,1631,3345,6393,205,3085,3238,6470,3162,5153,128,188,255,3221,157,253,
+    2668,2517,2732,2794,3550,250,156,1706,0,172,2670,2424,0,0,299,2746,
+    1605,0,2688,4286,2077,4481,3029,3463,4571,5701,3022,304,5529,2027,224,2072,
+    0,88,67,306,1822,2677,3170,292,215,1623,3023,0,2006,170,109,2853,
+    2339,0,241,276,2739,0,2942,2976,3038,5747,2535,4767,307,0,2348,0,
+    3696,5537,2603,2480,6034,4526,7057,0,5143,3261,319,4310,1787,271,5561,15,
+    2965,3261,0,1963,5015,0,5016,0,2402,3132,0,0,0,2534,4665,2285,
+    1680,1612,212,2567,259,6198,237,2558,4498,0,204,5526,286,2405,236,2657,
+    47,11,0,279,2689,200,2923,18,2976,60,149,3317,2757,2702,0,4879,
+    2734,3019,95,176,4498,179,2987,1838,308,2347,2886,0,64,144,3129,263,
+    3003,2374,3151,2161,0,0,230,6274,3830,0,187,3022,0,2470,184,0,
+    227,2782,2012,6081,2658,0,3137,2529,0,183,185,2494,3611,2650,2769,1622,
+    6679,1605,5099,64,170,0,1941,1697,86,2614,174,1600,61,132,248,189,
+    0,2820,5526,3162,1944,121,2892,4122,2559,2996,271,0,0,2204,3153,0,
+    0,2921,0,6353,180,2847,0,0,3110,186,299,2678,0,259,2513,4481,
+    0,230,0,0,230,1763,7046,2338,0,2978,2028,4445,155,0,3139,0,
+    0,4122,0,3252,0,2149,3883,48,2497,2338,0,0,6066,2589,90,3117,
+    3206,1846,3991,2954,244,2403,1622,2283,2987,3009,2887,243,114,310,68,263,
+    2594,0,5626,2941,3010,1756,2008,228,0,2842,2611,1604,0,2481,265,2160,
+    3196,2590,1600,206,191,2006,2085,1602,1687,283,172,2604,2567,111,300,2780,
+    3822,2423,2470,3263,4711,2842,287,190,4061,1763,2920,2860,2491,5767,2172,2468,
+    3164,172,1961,193,24,2832,275,2031,35,234,302,5391,2432,1601,214,2997,
+    2811,1605,3198,6350,2837,95,2853,315,120,2921,5981,4592,2757,183,3110,5116,
+    1607,0,3146,0,3822,2601,0,0,2163,212,0,5966,2999,0,0,183,
+    2484,1689,2215,223,220,201,288,291,0,0,2085,0,6001,0,3037,216,
+    0,1912,4761,192,3073,1766,2513,0,5030,0,0,227,0,1855,235,5664,
+    2767,6687,185,0,2558,107,6209,23,1689,3099,2853,0,85,0,168,320,
+    186,4317,0,162,0,0,2843,3284,0,2367,2581,0,2998,0,61,202,
+    0,6186,1631,308,2094,4307,0,0,0,0,2892,4278,0,0,0,0,
+    315,5213,3129,6768,180,282,217,3441,51,314,155,1608,1643,3294,205,211,
+    156,274,194,257,214,5470,4220,6022,2936,1755,2151,199,0,5364,237,2864,
+    241,2985,269,186,5328,270,1820,5097,3175,307,4757,4053,2910,135,25,3317,
+    6371,267,3405,4272,1656,2316,308,2679,4014,1633,4351,2579,277,5318,2871,96,
+    2691,0,4648,0,0,0,0,5158,131,2493,2524,2864,226,4487,267,2821,
+    4460,6025,2448,0,53,267,0,0,1694,0,2677,132,0,178,1954,0,
+    53,271,296,2369,4646,4173,3546,4286,4869,3129,2118,3196,0,0,0,204,
+    4059,2479,2692,2153,5317,40,235,2810,1940,12,1888,0,240,0,2722,0,
+    0,3548,2008,155,122,0,2886,0,2139,0,0,0,3327,107,0,3184,
+    3244,0,1961,4967,0,0,0,4601,2946,0,0,0,0,6841,0,291,
+    5882,2600,135,3085,48,2590,2006,216,171,4103,5635,161,292,3826,3142,220,
+    0,0,0,232,2937,0,0,2104,186,237,2600,0,2805,48,0,4059,
+    6115,0,0,2701,3010,2904,273,83,5993,5172,299,2659,3915,4101,1940,2271,
+    3021,0,3007,0,0,0,7041,2894,0,1600,5917,0,0,3318,6203,4888,
+    0,0,3243,3240,0,2910,0,0,5361,2699,0,2349,0,0,41,0,
+    0,0,27,2986,3000,4922,0,0,245,0,0,1811,281,5662,0,0,
+    3662,3282,316,283,258,2789,3566,173,0,36,0,13,0,0,2776,0,
+    0,0,223,1829,0,0,2876,212,0,0,3128,0,0,3304,0,3245,
+    0,0,0,2886,2349,263,286,276,0,171,0,2527,2083,171,6232,2540,
+    2657,0,3317,2604,4569,1755,0,217,3010,0,5186,288,0,263,6742,0,
+    292,5882,279,1753,1830,2787,95,192,3009,0,0,0,3172,2149,54,0,
+    0,182,2404,5421,155,262,2528,243,0,0,0,0,0,1604,0,0,
+    0,314,220,2468,3123,2612,287,0,0,0,0,40,2481,2681,161,2738,
+    2755,30,72,0,0,2650,187,0,159,2921,4088,3558,3096,0,2614,3821,
+    0,2162,3184,2556,219,211,289,252,0,0,64,0,0,2183,264,1640,
+    0,2854,2677,2568,5088,2658,265,180,138,0,0,1919,2733,6499,4886,0,
+    242,2072,0,0,3101,4704,4868,2953,0,200,0,176,0,2667,301,174,
+    2088,258,187,2075,0,4137,0,61,0,0,5538,3095,3992,59,231,0,
+    0,0,3471,4737,0,0,4768,3184,0,3041,5317,0,0,0,0,3654,
+    2996,5749,3106,110,189,3490,1888,4226,177,2974,5996,0,2546,2481,1874,5309,
+    2480,3283,72,3356,5971,6040,169,277,2745,3282,4895,6721,2006,3349,1907,320,
+    266,2985,159,1693,178,2799,2833,289,303,6353,1970,220,4426,4704,4058,220,
+    0,0,0,0,1717,2796,2227,65,0,0,2183,0,0,0,0,0,
+    5529,4886,1846,0,71,237,0,5526,175,4782,0,5160,4885,3345,2791,0,
+    3296,0,2560,50,3023,6188,3549,274,1666,5681,5187,2019,310,4652,316,3463,
+    0,250,5561,2414,3822,2864,2754,2777,0,2633,2230,2007,2546,0,6727,0,
+    0,0,0,2216,3296,3174,187,197,227,0,206,0,2837,2603,2602,6068,
+    0,0,0,311,2635,232,4810,3034,0,4866,0,262,0,2603,0,2887,
+    0,2910,281,170,1648,0,294,230,217,309,81,3084,0,322,180,2476,
+    0,1943,4228,184,0,179,4966,318,215,3823,209,3063,0,2556,0,2536,
+    300,64,4535,3800,3868,246,233,4086,0,0,0,121,0,3566,0,0,
+    1600,3282,2656,2743,5086,0,294,2149,4043,0,0,0,0,37,0,4871,
+    1687,3295,299,2480,0,3852,1612,0,0,2057,0,0,0,2947,2221,0,
+    193,2856,4094,1607,3172,3184,2964,2271,2448,0,0,0,1621,288,0,2535,
+    4789,3162,0,274,0,0,2965,0,2876,3041,0,0,195,0,4938,0,
+    1607,0,231,2678,4309,3073,2578,4981,3308,233,160,2605,292,3271,3390,2030,
+    304,4206,0,38,272,2760,3019,5166,2843,0,3262,2468,2138,291,6798,0,
+    52,3646,3194,14,2480,2777,2754,2141,301,148,85,3120,24,3289,3767,4428,
+    110,3031,2494,4087,296,74,133,3777,1688,48,5421,2974,5819,2842,25,4315,
+    0,242,2684,5598,0,3129,1951,172,2611,3271,0,4102,3997,2270,0,2625,
+    182,11,210,4446,0,3216,298,2934,0,209,0,2028,2679,2590,0,2910,
+    295,0,0,240,4272,2833,214,2492,1697,2877,0,3394,2821,3261,2282,3253,
+    50,0,0,0,321,175,0,0,173,4934,0,175,313,4647,279,0,
+    0,4445,0,0,283,2218,0,312,1600,0,0,4439,131,0,3266,0,
+    0,3062,286,193,2551,6238,241,0,252,234,6615,0,0,2853,0,0,
+    3096,0,0,161,37,5801,4957,6056,0,2948,4987,3132,0,292,0,0,
+    0,0,2657,2853,0,0,2271,236,3118,2699,4219,0,1631,5086,0,0,
+    294,2118,3097,3009,3096,0,0,0,212,0,0,5669,27,0,95,0,
+    3111,71,0,0,6238,0,3180,238,0,2853,0,0,6194,4006,296,0,
+    222,0,3766,6471,6889,2028,0,0,0,0,0,3041,135,5306,2336,3345,
+    0,0,149,2912,6024,3231,0,2218,2778,2149,7342,0,181,3196,2528,4484,
+    2103,5381,2557,3252,6045,0,0,2013,300,67,0,3475,0,0,0,1693,
+    1820,174,2865,5554,6883,3055,61,5141,0,3085,2492,2505,304,4570,2952,171,
+    2880,2226,1676,226,3019,2846,1776,2218,3218,290,6506,187,5807,107,86,307,
+    252,2612,109,2854,4921,4360,5141,259,0,2998,2216,0,3547,0,3062,0,
+    241,0,3998,0,2475,5652,5635,3339,2889,5086,0,0,4885,0,0,0,
+    0,0,3229,0,0,0,0,0,258,3294,38,178,0,121,0,84,
+    2614,2472,5810,5333,2760,0,0,4482,221,2919,2204,0,1944,3646,228,2963,
+    0,0,243,3779,249,4058,299,0,3260,2546,3778,3012,282,3282,1972,2243,
+    293,1608,5811,2072,4391,0,0,0,0,3229,2504,0,2726,1649,2375,1632,
+    3464,2143,181,0,248,0,0,183,0,2611,0,2811,0,301,6478,4547,
+    4041,2998,3875,221,1621,2469,3909,2910,0,4436,2161,0,249,2655,0,2556,
+    4666,2483,0,0,5106,274,178,4869,5884,1888,144,3143,2118,23,3229,162,
+    0,3317,206,3128,2008,311,2539,0,298,3194,273,2415,2941,5318,175,51,
+    0,0,0,0,4647,5316,0,0,5309,3710,156,3915,241,3316,1765,2744,
+    2017,2878,2967,2567,2931,3398,2340,51,0,0,0,2924,3549,119,1601,152,
+    311,24,2009,3009,3197,3610,0,6001,2405,0,2536,0,111,242,2831,5528,
+    2250,3154,2754,187,2634,278,0,2912,0,4263,6021,0,3176,2963,3162,0,
+    47,5432,2954,2270,234,0,5759,2725,113,0,1603,205,2798,3122,2534,222,
+    0,0,3516,4089,0,0,0,0,0,4065,0,1798,122,0,0,230,
+    0,0,170,3305,265,263,0,0,241,4666,3074,1608,0,0,0,0,
+    0,0,0,0,0,6102,0,3095,3216,0,0,2866,182,1754,3282,3100,
+    184,0,4279,5554,2612,6194,3195,0,2469,5641,5801,2472,2899,201,302,1602,
+    3336,5537,312,196,263,295,2525,1614,0,0,5592,6186,2667,6077,5979,0,
+    5380,233,3997,0,2570,123,0,178,4261,3285,4790,5442,292,2930,2006,4273,
+    3296,217,3610,3546,1767,5340,3602,2152,215,2506,1602,2502,181,5600,2736,1973,
+    2189,6556,292,305,177,5582,253,2563,1609,4219,2072,3121,3122,0,2791,181,
+    3019,3392,2963,315,84,0,0,5911,0,5370,213,27,0,2515,192,0,
+    219,2848,3099,2958,0,73,1880,170,6045,3129,0,1605,215,6388,5847,305,
+    3130,2503,0,274,0,50,0,0,2336,2875,25,0,2023,2501,0,0,
+    0,5165,6351,2737,2889,0,6477,0,2075,0,177,185,3048,4216,2721,89,
+    0,0,0,7256,3013,2678,0,2997,3029,2963,2354,227,2469,1641,4207,1774,
+    0,2206,260,0,4490,6105,2535,5528,3163,2868,0,0,0,0,0,102,
+    3074,0,3175,1821,0,5773,0,5980,0,0,310,183,5011,242,287,111,
+    0,0,211,2692,2908,5363,315,195,25,39,3151,6749,0,0,2789,3779,
+    206,196,98,0,172,0,3249,0,4317,1605,5978,37,288,2567,0,0,
+    3997,0,294,3114,0,0,6693,0,0,193,230,3650,202,1808,2238,0,
+    213,146,6209,3207,2613,1688,0,2340,0,122,5316,171,153,3986,148,0,
+    3442,25,5966,1830,4094,2660,180,3315,3025,1604,3019,1605,286,2688,195,0,
+    228,243,298,2256,320,2723,6395,77,2581,51,156,2186,2787,4043,3987,2170,
+    2111,3260,217,2613,0,5470,219,2414,186,2535,4235,3044,2484,247,1885,6471,
+    195,296,40,244,3205,2523,111,2844,3074,2666,2880,155,2945,2601,4263,5670,
+    5091,0,5310,243,180,85,2644,0,0,6903,2414,5009,6704,105,0,1632,
+    300,0,2492,0,0,0,0,0,2891,0,0,0,224,7222,1895,0,
+    0,0,0,0,7036,0,1642,74,3866,2563,4761,4867,55,120,2645,0,
+    2996,2611,3382,0,95,3117,4490,2525,0,2877,0,3604,5317,2349,2084,1613,
+    5159,0,0,0,5537,304,28,148,0,3321,0,0,0,0,119,0,
+    0,5917,0,3874,2296,3172,0,0,2110,0,0,2593,3567,5581,0,2104,
+    236,0,2909,3272,0,0,2746,2754,2479,0,2548,4285,231,5442,272,158,
+    0,2954,3875,0,0,0,2484,0,184,0,2357,0,2228,293,0,2776,
+    5346,2743,207,216,60,306,1612,289,2897,4922,3084,6903,2996,147,3216,311,
+    202,0,2601,4445,3282,224,6811,0,0,3233,3096,62,3144,3909,321,3073,
+    4832,4931,288,2623,2536,2870,220,4657,226,2887,229,3018,1632,2589,4448,2996,
+    0,0,3206,2941,3194,2711,0,5967,3434,0,6694,0,2402,6686,2777,270,
+    0,2908,2142,0,5364,4534,0,0,0,0,2220,0,2776,0,224,285,
+    2877,2315,0,14,0,4930,2902,0,12,0,4095,280,0,3306,2980,0,
+    2593,2633,0,0,5774,0,0,2986,3327,0,0,185,0,0,3130,0,
+    3265,4930,5546,3119,24,0,2077,2689,3073,3065,246,4020,0,3064,2842,3882,
+    194,0,275,201,3794,2270,0,2777,24,284,3040,2604,2368,1607,110,2979,
+    0,0,48,0,0,0,3198,0,7222,38,268,0,0,0,0,0,
+    0,3133,0,269,0,3905,2766,6365,2748,1688,6022,3654,155,0,4355,2009,
+    319,2381,3866,277,2578,0,2644,14,0,1640,0,2351,3801,2909,228,86,
+    0,4626,2946,0,0,228,3346,6115,213,2721,1600,0,54,2578,0,72,
+    193,3272,0,217,245,5307,279,6006,0,3053,3067,0,0,229,3546,0,
+    2414,294,3381,3293,266,1697,3566,6230,2601,6474,0,0,2656,1604,61,0,
+    4226,2943,3261,3120,2514,5443,173,6520,1602,2799,3109,2876,2778,2856,2627,2930,
+    169,0,3034,2472,0,97,3078,2754,2803,0,0,0,1820,0,0,0,
+    0,2947,267,2677,0,2204,59,1763,0,2226,0,2415,3239,0,0,2812,
+    185,0,3806,2744,0,156,2569,0,0,0,0,2622,1900,4445,1621,0,
+    1874,3201,168,5319,2933,200,2948,250,2502,2932,3512,3778,2623,5775,0,3737,
+    3282,195,97,3384,3286,0,0,0,2206,2822,2215,2527,3117,4783,3839,0,
+    220,2208,3079,0,260,4285,220,265,3986,3151,2899,3019,1621,131,251,2667,
+    0,2778,72,0,0,16,0,0,2723,313,3261,0,228,2433,2628,1846,
+    232,5581,3131,283,2141,1706,2492,234,1601,0,3053,0,6023,188,298,32,
+    3240,3795,1611,0,6802,111,3074,4726,270,2735,114,167,2414,0,1699,155,
+    0,0,2777,0,2789,3128,5697,0,0,321,12,0,3932,2606,3163,2545,
+    3618,0,1632,6352,0,0,0,0,0,0,2637,0,2568,5229,3046,0,
+    19,1898,201,0,4453,0,2749,1607,0,227,3229,137,3318,0,1603,188,
+    2340,2482,0,0,2470,27,6919,3305,5818,3161,2300,4314,254,5746,3647,3776,
+    1608,0,4426,0,6202,3591,3264,0,264,3221,0,193,2275,131,2402,3275,
+    6897,2988,2842,190,2922,0,4868,5536,246,0,1607,143,5096,107,308,59,
+    0,0,3271,0,1875,2898,3360,0,2843,4906,5548,0,2853,98,0,3349,
+    0,0,0,0,0,161,2754,0,2875,0,2933,0,2521,2204,173,0,
+    3042,290,1913,5087,3772,3106,268,231,5536,5802,4481,0,0,320,0,237,
+    280,4541,4246,0,277,2725,0,76,280,1621,224,49,0,2865,1603,189,
+    2602,2879,99,5202,0,267,0,177,2550,321,5537,2518,0,201,291,2912,
+    0,59,131,0,108,2534,0,178,0,0,3239,3174,296,2891,172,5308,
+    2887,4262,2712,0,0,4261,131,0,0,2877,2988,1623,3183,202,302,1840,
+    0,4867,4956,1848,6076,0,1707,0,0,5746,2284,0,5750,4437,3618,1904,
+    3107,196,0,2947,285,2776,3502,0,73,302,2141,0,0,0,3228,2547,
+    185,4429,2860,183,4437,2954,300,2583,2671,319,3332,50,1709,38,253,314,
+    0,3069,111,2760,263,2578,1831,5361,253,0,1843,2010,222,47,4592,6067,
+    3997,198,6034,4506,0,3296,202,6723,4217,2572,2138,2211,50,2512,229,3777,
+    23,0,5630,62,287,4208,6477,3271,2964,6188,5336,0,4528,2976,3161,0,
+    0,220,187,5747,2169,0,3297,0,3089,0,2524,3055,7218,0,50,293,
+    2909,0,2738,0,0,122,3098,0,1974,239,0,2538,123,97,4656,5746,
+    2659,1677,49,287,0,2029,2281,0,134,4300,2507,2876,3282,3100,210,2831,
+    2629,157,171,2647,2882,266,1611,2546,3556,6853,6245,98,1912,1919,6092,2710,
+    36,1954,229,229,11,167,177,124,3108,1970,3184,272,123,2891,86,247,
+    206,0,0,0,230,1621,2567,1697,222,57,0,3875,4500,0,1840,222,
+    225,5804,99,2634,1605,291,2839,6681,171,3286,6576,132,2482,0,167,0,
+    0,0,2875,4228,102,0,0,6105,0,0,77,248,3316,1683,0,3262,
+    4355,2633,2271,0,3205,2966,7015,3580,162,3206,0,2073,3547,3161,2217,2184,
+    5422,111,271,191,2788,0,2559,3001,2600,1624,12,2711,2490,185,4754,312,
+    0,0,23,0,0,0,0,0,5191,2860,299,140,2534,0,3206,0,
+    3186,0,4876,0,2634,0,0,2887,0,251,3249,311,179,0,288,0,
+    3054,0,2601,2900,4315,3341,2484,4013,0,0,0,320,0,2209,294,0,
+    0,6798,0,185,221,0,2699,0,3107,0,0,4626,3610,12,0,0,
+    0,0,0,0,259,0,0,4315,0,220,3118,0,1765,0,0,3391,
+    2798,277,2006,2858,2359,2778,5141,6816,3434,0,0,0,3142,225,221,0,
+    3767,0,0,3099,0,2721,0,0,0,2018,1756,0,4711,308,223,0,
+    2638,2340,296,2754,5749,3001,5087,224,4591,3253,107,112,3766,86,312,217,
+    2685,2469,2562,3401,2571,4575,200,3051,1605,271,4907,2075,288,1773,108,2413,
+    0,1944,0,3043,0,4665,2761,0,3390,87,61,241,0,228,0,0,
+    0,2162,0,6212,0,2513,4783,0,3187,4112,1758,6041,303,6284,0,4461,
+    0,2734,2985,0,0,3867,252,2045,4314,194,271,225,0,0,3997,0,
+    298,270,202,2142,2282,5106,303,155,0,200,259,236,1875,1756,49,3096,
+    2291,0,2942,3902,167,207,221,5767,209,2920,283,120,2236,36,1603,5201,
+    278,0,0,177,61,2075,0,1874,4481,2724,162,0,3175,3941,257,3089,
+    210,0,0,201,0,1809,257,2557,3142,265,168,2677,3260,299,2579,2779,
+    16,0,4446,0,0,0,1985,2985,4262,1688,0,0,3208,320,3990,318,
+    2888,287,0,0,0,0,0,3736,207,5114,86,0,0,0,0,3605,
+    126,125,2799,3767,3183,4483,2834,289,0,2037,174,2072,261,2567,132,5931,
+    0,2823,3051,5746,2545,61,0,3030,133,0,284,1874,3315,1749,1848,3575,
+    214,1811,2923,6202,3055,170,2910,3053,0,3205,0,2710,3434,1688,1634,2494,
+    210,3778,2684,2282,3095,1820,169,1832,5746,5327,4651,2614,146,2282,0,1815,
+    1609,35,1682,0,0,0,0,3238,0,202,4661,2943,5857,272,2275,308,
+    250,3238,0,0,4577,0,5528,190,2567,0,0,0,3769,5861,0,2667,
+    4447,319,0,0,2760,0,214,0,210,36,2472,3183,1780,4438,4575,24,
+    0,0,2526,1971,0,203,0,0,2997,2111,0,0,88,3565,0,1743,
+    2853,315,249,1697,3766,0,4483,2935,0,2727,3392,4124,2735,3390,211,1808,
+    230,5598,2879,0,115,274,262,0,2965,0,5335,0,2836,5582,193,0,
+    4342,3930,3188,316,1607,107,2787,299,2732,3152,2955,2762,1981,1895,2083,6246,
+    0,2404,6231,5186,2347,250,0,1609,6081,2168,6022,2119,2667,0,25,262,
+    0,319,84,0,0,2623,2679,2139,126,0,4646,0,3131,0,0,0,
+    5726,3218,3442,2209,0,2138,0,205,0,3462,4162,3261,5328,0,2574,0,
+    0,0,1743,0,0,0,0,0,5187,5086,0,3241,108,178,271,3219,
+    109,0,6268,3557,0,75,2601,3218,0,0,0,2655,0,0,5105,2283,
+    3902,175,2919,0,5088,0,2979,5032,134,2550,264,225,3144,2700,5409,3225,
+    220,4746,5526,2591,2300,0,3029,4783,2987,0,4648,3001,2592,3987,150,0,
+    2072,1955,4499,2820,1603,4868,87,2481,5931,5316,0,0,2645,311,5086,218,
+    174,196,4448,2019,3240,2159,2821,5186,3219,3802,2867,2799,252,289,2732,2655,
+    0,30,6359,171,0,0,2723,6267,4315,0,0,2910,2493,23,2658,2072,
+    5756,2209,2479,5428,6246,1821,5316,1676,5308,174,190,7227,122,2688,3216,0,
+    5197,5325,163,5862,7010,290,2831,3769,2788,209,6499,194,0,270,2484,318,
+    62,270,2634,278,258,2512,1622,2348,252,0,249,199,244,0,2160,7035,
+    0,0,0,5748,2842,264,4886,2366,3109,3550,2508,3316,2957,0,120,0,
+    187,2578,0,2650,0,2417,0,2480,1600,0,1709,0,0,2703,0,174,
+    5780,2581,5122,2858,3345,2634,2637,2626,0,0,3276,2812,160,0,0,271,
+    0,0,0,2792,2493,2846,0,5372,2859,1886,5555,199,155,5545,138,254,
+    182,3239,0,0,6033,266,4966,2291,0,2140,3176,5089,5986,3661,3516,11,
+    2612,2425,218,170,155,194,4447,2514,6038,6358,6138,132,3277,3294,286,2440,
+    0,0,0,4894,3353,170,0,0,0,0,0,157,205,2409,1823,156,
+    0,2942,5765,2220,0,0,0,160,2283,0,0,3234,2552,0,6195,0,
+    3119,2160,3776,135,2920,1953,55,35,272,2802,2600,0,2690,4262,47,5408,
+    0,4058,2552,5527,5056,2105,2273,0,271,5455,3249,282,24,4498,239,3316,
+    2954,0,181,0,181,1829,184,0,192,2093,2964,1940,3049,2516,187,0,
+    2847,19,2965,1601,35,3030,237,2877,0,2503,266,4344,5187,4233,2776,290,
+    2813,6022,0,1895,300,0,1703,2945,3350,6769,0,198,2803,2679,3661,0,
+    6152,0,35,0,0,3152,4966,5144,0,107,268,1610,5194,2613,143,2527,
+    0,316,262,2348,0,132,6765,0,4651,0,307,2881,0,138,0,3353,
+    0,5186,0,0,0,0,3427,111,59,0,0,238,59,0,210,144,
+    0,0,1820,0,2650,0,0,0,0,274,2523,6365,113,191,6234,3098,
+    0,0,2692,237,278,212,0,0,0,6554,4795,6828,3307,0,2878,262,
+    2270,2552,2931,2423,2205,249,96,2879,204,1897,2891,0,0,0,2549,0,
+    0,0,3766,0,0,21,0,196,3253,266,2382,2501,284,134,1833,6832,
+    3175,2897,306,2273,49,1602,2606,2933,4656,26,3273,3315,1951,7061,5985,2660,
+    199,2998,292,285,3014,2579,281,2517,252,0,263,245,2699,178,2309,2414,
+    0,0,4052,0,2235,2523,2581,0,0,1798,3556,0,0,301,2316,0,
+    0,2153,6366,0,0,0,2831,0,2732,316,12,146,0,244,5556,2512,
+    0,4157,0,0,0,2670,1609,74,3260,1979,177,2357,1743,2909,4336,107,
+    0,0,0,6350,4703,290,89,2480,1742,185,0,205,185,2822,6067,2746,
+    0,23,2093,32,3128,0,0,2693,0,0,1753,0,0,2842,123,0,
+    2161,2799,1698,3194,23,0,2523,0,5105,268,2613,194,214,236,190,2747,
+    5529,0,0,0,3145,2142,3272,0,3020,0,0,0,0,0,0,3043,
+    0,212,12,5414,2271,236,230,4836,0,2857,209,2144,0,213,2679,3022,
+    1957,2722,5087,2603,277,96,243,4921,1604,0,1609,4226,2811,0,0,2471,
+    2633,1632,215,290,1830,2227,2787,3112,5751,205,2405,6939,4867,1612,228,3034,
+    4426,155,3216,3794,276,274,0,291,101,0,278,1934,3304,0,6130,3768,
+    2603,0,2484,2117,2611,6316,0,1904,2149,278,1691,198,0,3098,2207,2820,
+    3416,3336,2527,218,267,317,1608,2930,5987,3830,1952,5669,0,215,240,0,
+    1919,238,2482,2822,2838,0,0,5968,2556,2635,5756,0,3602,0,1607,0,
+    47,2495,2516,5691,1609,0,84,2655,5086,1606,5598,2300,3194,0,209,4439,
+    2978,167,2723,1793,2204,2472,0,309,254,2661,2454,2688,2584,2645,3084,2634,
+    223,4665,0,254,3151,3043,0,3172,2110,0,4227,238,0,0,0,0,
+    2879,0,0,2942,0,0,5669,5444,0,4445,2798,205,2680,2086,2964,5810,
+    0,2540,0,0,215,308,5536,3262,3306,143,167,2589,0,1622,0,3272,
+    3021,4526,7277,0,2616,1951,0,2562,2777,3053,3199,2275,4562,1706,50,4800,
+    0,2526,258,218,0,0,6026,0,0,268,0,0,0,5126,0,2044,
+    3152,1891,2680,3426,0,0,0,113,2019,1777,171,0,0,295,6052,3626,
+    2872,277,104,1942,207,1838,2942,2667,2721,2655,3175,3560,96,196,195,228,
+    234,6116,193,0,279,2375,3793,5142,3464,232,0,0,2740,2931,3125,260,
+    2842,2624,0,2712,3161,5827,2953,2534,0,0,5150,1700,0,0,3777,2816,
+    3294,4767,6358,5993,0,2524,3803,3165,0,2934,3251,0,37,0,0,5746,
+    233,2866,3348,2215,2898,2723,3081,208,2123,3559,301,5131,2367,3085,2556,14,
+    3184,266,148,2746,6748,169,213,175,3205,5759,3232,4680,2479,223,1875,3785,
+    3263,2285,2799,2535,180,2956,2823,5539,2887,4271,2593,131,12,6038,2644,145,
+    2890,249,208,2501,2965,246,262,2691,85,3448,185,1601,243,1811,30,2713,
+    183,245,0,5198,1753,0,0,121,1991,5749,6045,2844,1610,3557,219,122,
+    1875,2094,2366,156,0,157,259,134,4306,1965,0,3831,2845,207,4763,6216,
+    0,4426,0,0,0,2626,2413,2519,0,253,0,2850,4020,0,0,3298,
+    2535,1743,182,0,0,156,0,2749,0,4240,4660,0,201,2469,7092,3882,
+    5757,85,303,279,0,304,1632,2539,2853,3557,5546,0,145,206,2589,1649,
+    177,1691,99,214,0,254,2755,3029,2804,3164,5098,5223,163,6066,6189,0,
+    0,2276,4280,2169,1890,313,6187,0,1951,0,5097,155,0,0,2602,2791,
+    0,0,0,7050,0,7278,2813,0,227,1680,174,2963,237,3260,2844,144,
+    3128,0,3074,3140,0,2547,0,0,303,0,3219,5160,2644,2778,0,2977,
+    6690,0,5867,5675,111,0,0,256,3936,248,0,312,2836,1899,2473,0,
+    3176,3146,2139,146,2787,5106,2734,52,5528,2919,0,203,156,2965,2634,0,
+    2546,2799,5977,1608,0,2844,3367,3401,3229,5581,3044,196,0,3117,2416,5540,
+    238,168,2690,95,287,315,1677,85,2734,2648,6039,258,5015,2176,6068,1942,
+    4109,1897,100,5967,2622,301,2548,2920,7287,1963,3320,308,2997,25,84,1793,
+    3054,6478,6068,170,1832,3063,1676,1819,285,2734,2666,74,300,0,6021,5758,
+    68,3305,315,3107,2405,4725,4893,3195,3045,294,2271,155,3172,2666,2870,4756,
+    5166,0,209,2721,2854,0,0,3997,0,135,244,6694,0,2734,7056,3304,
+    0,0,3018,3057,6023,0,0,0,157,0,318,264,3330,0,2534,5896,
+    2914,2758,119,197,236,5445,274,2475,114,167,4453,48,5846,291,1780,2087,
+    2685,1838,3008,83,50,6354,2878,3024,2855,2405,1961,178,1904,3128,4426,2177,
+    0,3902,204,2028,3207,0,2919,41,2007,2662,2788,4265,236,191,1912,5855,
+    5849,281,108,281,5528,0,291,2616,136,0,280,214,312,85,0,2602,
+    227,4483,1821,2725,3996,2490,1679,2423,286,2809,2773,2822,6360,3020,3327,2579,
+    1970,2366,3989,2515,2691,5821,2473,49,2943,4988,2648,6365,4673,4066,3010,15,
+    163,2955,0,17,3165,0,259,0,2589,215,6944,1641,2351,256,11,11,
+    5241,0,2337,173,318,213,0,4427,2647,316,0,240,6007,3610,0,1698,
+    2215,0,2954,2677,0,144,0,2336,1600,2472,200,0,6351,222,0,4867,
+    2795,0,2338,5364,0,3203,5757,7113,171,3427,207,3122,1809,2468,143,193,
+    3098,0,2823,5364,6204,5593,0,2680,2474,2490,4491,170,2142,2689,4748,2798,
+    4921,2710,321,213,0,119,2974,4982,6816,0,2424,3689,3996,2413,2556,215,
+    3317,4702,4535,4895,2624,2413,6727,4493,234,5748,0,0,2348,4675,3345,1610,
+    0,29,5407,255,0,1774,0,0,223,3295,0,252,5583,5141,128,4701,
+    0,5311,4922,1978,2433,1914,2545,5158,3186,0,2912,1743,0,0,259,0,
+    0,37,3260,3834,189,0,0,0,2142,1714,1947,5190,1874,147,0,2780,
+    3265,0,0,171,2886,1886,302,3250,3606,1640,48,35,211,3020,2655,207,
+    134,2688,276,1941,3033,1773,2536,237,3295,1612,23,0,0,0,2781,0,
+    0,0,1809,0,3128,2921,3356,0,3249,3087,3062,3296,2471,4783,0,236,
+    6837,5554,1886,314,2102,5967,0,1774,4129,249,2580,3261,233,4316,4932,0,
+    5810,0,241,0,2845,0,0,0,1717,2801,3866,1609,5747,2627,5362,48,
+    0,24,2920,4748,2854,3586,0,0,4095,2788,0,5143,12,48,4981,0,
+    2776,3108,0,0,189,281,233,0,5691,231,204,3304,4206,6722,2348,257,
+    5364,3654,0,0,0,0,6075,2150,5988,2315,0,2923,2732,318,0,200,
+    2525,2723,272,86,2409,0,3782,0,0,233,0,3179,5325,0,2920,3293,
+    5746,2424,2358,170,1679,0,0,2975,0,5626,6294,260,204,2256,276,0,
+    3667,2523,297,2616,109,2732,3208,0,0,187,246,2932,5009,2614,2969,4216,
+    2468,2865,190,2041,1715,2635,2800,255,4893,1632,4041,143,2425,3275,2468,284,
+    5746,3194,78,2538,0,251,0,6838,2690,183,3009,5746,3361,0,5670,0,
+    2350,3240,311,1839,0,1760,0,2778,4005,4711,5696,47,180,5889,95,188,
+    2594,2815,234,3245,276,2468,49,2083,52,6075,187,2722,6505,1942,4951,171,
+    4836,4278,253,3310,283,0,2713,2625,6681,4015,2190,179,2882,2311,2780,2955,
+    6686,3852,0,2093,2529,5307,0,0,0,2494,0,72,0,50,266,108,
+    173,262,20,0,0,0,73,2689,2648,2083,3000,2570,255,4494,4094,6882,
+    308,5161,5202,5780,5449,0,2523,0,1962,173,0,1602,2612,0,260,4924,
+    3986,247,213,5091,2600,282,2651,4209,0,123,3682,311,0,0,3198,261,
+    3556,157,0,2139,299,3123,2546,232,2860,2515,2776,204,156,14,3911,2733,
+    5765,75,0,256,3113,3776,2985,2205,0,4280,2495,269,4746,7092,2601,0,
+    0,187,2886,169,2804,237,0,5116,3271,0,3073,5370,2760,1607,0,0,
+    3986,2559,3162,120,2560,2418,5189,309,2534,2713,265,5747,0,2919,2666,2469,
+    210,2582,2434,2644,2899,4026,2657,1605,2271,47,3319,132,3135,2470,2793,143,
+    2011,5308,5826,195,2864,3052,2898,3406,193,3711,178,2931,1600,2141,1808,2178,
+    119,216,6230,0,2766,1830,317,6245,6030,2812,245,262,290,4945,2699,253,
+    3002,0,3045,2336,241,188,235,2441,2831,1634,2985,1875,42,5985,284,0,
+    3135,4031,2831,3227,1690,1609,2756,4499,237,3173,191,5017,2787,0,6800,2414,
+    3603,3142,3044,261,4673,312,2272,160,219,3336,5537,4869,200,0,3107,241,
+    2357,5848,0,0,5415,2944,223,2111,2567,0,71,7035,0,5966,0,100,
+    2072,4454,5271,0,298,86,6269,1648,2747,231,1896,0,2425,5318,267,0,
+    6504,4438,97,76,96,137,291,2402,0,0,4527,6471,0,198,259,61,
+    321,0,249,0,2838,2494,23,1943,3118,213,1885,1811,2570,6893,2339,3667,
+    0,47,0,212,5581,0,2602,2149,0,4262,112,131,227,214,255,0,
+    1875,12,3143,4131,0,3293,84,0,3769,2360,245,0,0,2855,2573,0,
+    4750,0,3604,0,0,0,0,290,218,2787,0,0,3293,3316,2338,4437,
+    0,0,0,133,0,2028,198,2006,0,0,0,1944,253,4505,0,1676,
+    1753,5171,3199,308,2525,6556,2958,2613,3776,6196,3327,2779,281,0,4953,0,
+    2642,1622,251,0,1986,223,2842,2225,1754,0,5030,2336,203,2725,5849,0,
+    0,210,0,172,143,0,2977,0,0,303,4087,0,2501,4041,2963,5848,
+    5786,5002,0,0,2724,220,3244,248,0,6031,0,2103,6404,1697,2338,0,
+    197,192,2111,0,2747,0,5586,2469,2902,133,1808,0,0,0,2843,0,
+    2884,3117,2020,1607,4471,0,40,4869,0,90,0,289,2468,1609,0,0,
+    0,184,2057,0,305,5747,0,0,0,2505,0,0,3271,3228,0,0,
+    252,0,50,3999,0,0,2601,0,0,0,3240,0,0,3216,63,246,
+    1943,2560,223,2779,2183,258,108,205,2578,6625,5539,5229,4054,2628,272,3462,
+    2392,0,0,2579,0,2930,6679,2959,0,0,0,1876,42,119,112,3305,
+    192,3307,2006,145,1608,2893,4186,2846,5365,2744,203,3173,3120,3565,247,2777,
+    192,214,3074,0,281,3063,0,244,2941,137,0,245,5168,3881,113,88,
+    6387,2234,2909,6268,2578,1690,3382,3085,2679,1820,2342,1607,137,256,1606,6366,
+    2293,1846,209,0,2768,1602,2865,2605,12,3586,5811,2964,5105,202,95,4529,
+    2801,4872,2835,2010,27,0,2479,223,1698,244,2954,0,4217,224,0,3030,
+    2360,0,0,5717,0,2710,158,0,0,0,4270,26,0,1728,0,0,
+    3602,3347,157,293,0,3274,4066,1614,0,1667,2612,0,1690,2878,2825,3770,
+    168,0,183,238,0,203,0,170,2700,3174,0,1608,0,2942,0,193,
+    3264,5276,5979,239,3238,0,171,3620,0,0,1889,2490,4161,0,213,2732,
+    5746,2007,0,193,2638,0,1655,5547,2627,0,0,214,2908,0,2744,0,
+    202,2645,3242,0,2517,1677,0,0,3120,6682,0,4656,2930,0,53,3041,
+    0,0,0,198,2724,0,2519,3881,0,3096,0,0,0,2425,4376,0,
+    3228,112,0,1895,0,5812,3987,317,2534,2019,0,2301,0,4795,7036,2765,
+    5537,2170,5532,3187,5152,5224,3185,2604,220,3915,147,2745,6033,3009,3230,2512,
+    3264,1744,4393,3129,2758,3830,2955,273,2402,3020,174,2479,1839,2140,3347,5208,
+    2606,2348,0,6230,204,269,3229,2854,2772,47,205,2956,313,262,2666,6805,
+    0,2540,3261,0,0,288,3107,2746,132,2744,18,5208,2889,2754,0,236,
+    0,0,0,0,261,2748,0,143,2028,7093,2793,0,1754,4931,3118,2414,
+    3566,2047,303,238,3771,1609,0,253,3648,3260,255,314,186,255,35,108,
+    2545,3601,2491,4209,3614,2733,4000,2835,3073,83,2501,222,3062,1625,2787,1706,
+    2725,2177,2600,3441,2998,2892,5966,181,3282,4656,173,3475,245,240,5088,2205,
+    2545,1605,0,0,0,0,2234,4650,178,4754,0,0,5606,0,0,0,
+    2215,84,0,2658,0,2029,2506,2942,0,5187,2481,0,0,198,0,5143,
+    6957,3150,2912,6805,4246,5365,2900,4270,2724,2603,0,2952,2503,283,2415,229,
+    0,2955,5593,3150,201,0,0,4706,0,0,4701,0,3996,1875,297,282,
+    248,2915,0,1952,0,0,0,233,4272,1780,0,2281,72,2645,109,3285,
+    187,3021,2095,0,3129,4438,230,3110,2017,5004,79,3867,2724,0,257,0,
+    2710,108,123,3140,2789,229,2523,1689,311,2491,287,2493,223,2689,5316,3008,
+    225,3868,2613,2711,1886,0,2977,0,113,0,2965,2985,264,4499,2584,0,
+    5346,0,321,0,2834,23,3611,75,0,2547,2903,0,0,0,1888,2529,
+    276,3496,5373,261,0,3463,0,0,3002,14,0,2270,2680,3304,0,0,
+    2407,0,0,0,4563,2547,2601,288,3821,309,2491,2949,0,0,0,133,
+    230,0,2225,0,0,0,0,0,0,3206,2644,2661,175,2027,0,0,
+    196,248,3095,2613,3874,3547,4292,51,3020,0,6903,4186,0,0,36,0,
+    181,63,261,2886,175,312,2623,5847,2337,4210,2633,7009,4512,2559,2944,5634,
+    156,2673,2778,2206,2525,2732,2679,2880,6021,0,1626,220,0,0,200,100,
+    0,0,0,0,2734,284,250,0,0,83,3238,3119,2755,0,1885,0,
+    270,0,0,180,0,0,1833,2226,2971,2858,0,205,3062,0,3785,2515,
+    221,2517,3986,2044,86,224,242,3801,174,2834,17,3167,204,5004,6186,178,
+    2835,254,135,2658,84,218,5802,3152,2088,3031,5151,103,3110,5530,0,2482,
+    238,146,3086,4649,2712,2856,2798,37,222,17,2897,2954,109,3547,0,1887,
+    250,6130,269,144,2341,1952,3822,2820,0,2659,3175,2084,2557,207,5980,2921,
+    0,76,2953,314,2217,0,0,2234,2842,232,2302,92,290,2169,96,0,
+    2281,1953,1609,0,1776,3305,1603,5036,274,2843,135,4449,2150,304,0,5977,
+    2281,2798,4490,0,4966,51,3040,3194,6811,2179,221,61,0,2605,4718,2141,
+    0,235,6030,4721,0,3117,3801,2690,1687,3952,3187,260,2227,2006,0,2270,
+    194,3382,5526,2216,0,2336,253,111,5308,2667,0,235,0,2633,0,64,
+    5310,3551,6386,0,2536,2790,2955,2607,301,4492,2493,47,2604,174,315,4176,
+    4866,0,2283,2827,0,2542,0,0,5306,4445,5978,1605,3211,4526,35,2571,
+    299,0,0,4467,0,2784,0,0,0,0,0,2807,0,4251,0,2220,
+    51,3275,0,247,3475,0,0,5850,3216,1624,158,0,2843,3785,143,169,
+    12,285,1952,1608,2078,2897,2955,1648,15,0,2767,3690,313,3383,0,12,
+    172,0,2007,2657,6230,120,0,0,5528,274,158,4876,317,200,5318,177,
+    4647,0,2798,194,2514,5096,0,5186,0,0,0,2358,3766,0,1764,3304,
+    5004,2498,316,122,3581,3164,5803,230,5053,176,2865,6186,2701,11,2776,2215,
+    3260,0,0,0,2942,2658,0,13,295,0,5188,2845,6847,3064,3951,2900,
+    261,249,5536,198,4278,1608,4308,3769,3220,2523,2732,2093,0,190,6266,2089,
+    3307,0,109,258,206,174,2679,198,2702,3076,6039,1687,4372,2701,102,54,
+    0,0,2678,317,0,174,3766,3041,2750,3076,132,3549,4876,191,4940,2074,
+    2920,3336,3065,2591,4431,299,3318,295,317,2911,2529,244,1723,6939,243,3766,
+    3618,102,5231,0,2820,3029,2734,2831,23,0,3618,124,3305,1607,2636,4789,
+    4270,0,79,0,0,1742,42,3041,0,2485,0,3305,4506,3197,0,0,
+    3113,306,0,0,2729,173,3073,2787,3613,0,3085,0,4485,5748,0,0,
+    147,2805,0,0,3096,2820,0,0,178,0,3041,3272,2404,5318,2160,0,
+    2966,3106,2811,112,1887,2744,2985,322,2270,3074,2359,2724,0,1887,0,3340,
+    4705,159,291,2735,39,2469,280,4051,2788,3909,2469,0,0,3044,6204,0,
+    1607,2919,5540,4089,196,4044,2469,2007,2735,3052,2699,86,181,237,3041,2768,
+    310,211,2867,2636,210,2315,0,3152,2721,2646,0,0,0,2930,2755,4076,
+    0,0,0,0,1773,2851,5196,2008,0,252,6682,3682,0,2403,284,0,
+    0,0,120,0,4006,3217,0,5607,2580,0,0,0,131,253,1606,2754,
+    191,2585,2904,2139,44,3264,0,5584,232,0,4702,2648,197,2831,0,0,
+    295,3010,2967,2721,4308,2161,3164,2538,2779,284,0,255,0,6198,238,0,
+    0,0,3161,3065,4590,1898,50,2538,3930,2799,2526,2513,1876,2215,2614,0,
+    0,221,1848,1758,216,144,0,2143,0,0,212,217,11,2655,1601,3274,
+    6714,3347,36,1609,58,197,27,3216,2974,281,145,1615,36,217,2768,189,
+    0,318,0,0,2507,2824,0,2659,2635,3557,227,2481,2875,2093,6575,0,
+    4233,0,0,0,5756,1723,5746,2769,0,5994,1641,49,0,0,168,1944,
+    0,0,0,4306,2623,1607,226,3611,0,2480,5806,6238,1848,183,5306,0,
+    2546,0,3781,286,2010,0,0,0,0,0,0,66,2694,3464,0,0,
+    0,2007,0,0,298,3020,0,0,111,3319,3306,2515,286,4866,3546,0,
+    1951,3109,0,204,0,0,0,0,0,3603,0,194,307,317,2644,1829,
+    0,217,0,0,2743,2494,0,1822,272,2403,143,5811,289,2515,0,221,
+    2612,4208,3574,2713,5306,4052,2971,3052,256,5106,196,5415,4095,2677,49,1601,
+    3118,2798,55,2813,3904,2515,2226,209,2965,5122,4921,2469,2911,4206,136,3075,
+    1612,4427,3229,0,0,242,0,277,0,4924,6021,3239,96,3426,0,0,
+    131,2722,273,6216,3297,0,3241,4701,2875,3550,262,0,183,0,3241,2028,
+    2822,6109,0,2600,2710,3177,294,3018,3073,0,302,3085,4501,0,5327,2798,
+    5747,0,167,0,3559,193,50,266,3009,0,5968,0,3185,0,0,2835,
+    4931,0,0,0,3064,3046,1631,2703,0,0,1601,0,0,2713,6400,2866,
+    2699,3315,0,3043,0,119,0,2693,3067,4391,1900,3565,2471,132,222,2020,
+    257,5848,0,200,0,0,268,2535,2509,0,187,194,2218,85,0,2864,
+    3882,90,2743,3330,0,5757,0,0,3141,207,0,0,2734,287,5309,17,
+    2715,14,261,2655,227,2614,289,81,189,6239,108,4426,295,2958,3288,59,
+    2765,4242,191,2623,127,2128,4939,3301,2490,2876,181,12,38,3253,295,2942,
+    3222,3249,2922,2743,5921,0,0,0,110,2728,3166,0,0,0,4562,0,
+    292,2883,0,2691,0,2888,4602,0,0,278,0,3902,0,2887,0,2468,
+    2963,0,4107,5196,2315,180,0,4481,0,0,2934,1600,229,246,3040,2272,
+    170,1606,1616,4732,1677,2919,205,3139,0,0,2504,0,2560,4649,2809,2523,
+    2666,1829,4172,224,2890,97,2568,234,0,0,3987,6056,0,0,4218,195,
+    0,3074,0,5317,230,2569,5422,2504,2854,2794,0,169,0,180,1681,211,
+    3353,284,190,6708,59,3112,3097,134,2066,5626,6238,3077,0,5325,1780,3931,
+    7356,0,0,0,1772,0,2641,3315,3327,197,3465,0,1953,173,6266,234,
+    2901,178,0,2897,2954,289,2336,37,1603,3294,0,313,2568,1940,23,0,
+    3048,0,3328,4647,3084,242,249,207,3074,2930,0,2789,0,0,2833,0,
+    3150,2831,2721,2287,4726,3556,5365,3174,5980,0,2657,0,0,1603,0,2670,
+    1697,1676,1679,23,2938,3868,4207,3547,0,156,120,1961,254,0,1764,0,
+    3286,0,2536,235,3304,0,5774,3249,284,281,0,0,7020,0,1879,2243,
+    322,53,307,135,0,4216,0,257,291,95,3833,315,2833,0,3096,0,
+    0,4681,74,316,172,0,0,0,0,2547,2138,3381,2217,75,1904,3315,
+    211,208,2316,3032,4233,3018,0,282,73,0,3556,2901,147,270,2294,157,
+    0,306,0,0,109,0,0,156,5409,3305,0,5861,0,2898,3319,3241,
+    0,2479,295,2689,202,2007,1601,5711,107,3250,4659,251,1831,7127,2799,2820,
+    5812,6021,4007,3011,0,0,2229,3040,6882,23,0,0,3229,278,0,2966,
+    1742,2623,1895,169,316,2853,0,1886,0,0,1611,3689,158,2491,5711,4975,
+    3305,0,3162,1820,2624,2336,223,256,3275,1608,4922,241,1632,181,3242,168,
+    252,205,0,2469,71,3648,2754,0,2823,6295,4534,245,0,0,5546,3823,
+    3295,133,2154,3027,0,5033,2622,211,3175,0,0,6807,83,6679,0,0,
+    3656,3996,234,1612,3207,98,3151,2204,3710,1820,4983,2749,5408,1899,2832,7113,
+    2777,216,239,64,5527,0,0,0,244,2093,2967,234,279,0,302,287,
+    2604,4749,2779,2293,0,6273,3839,12,4493,222,0,0,2745,4060,303,11,
+    0,2483,234,5531,4676,2877,258,0,2933,1838,293,303,2536,161,4725,6721,
+    0,2979,1970,2495,237,2552,0,231,2381,3063,3019,0,0,72,0,231,
+    3018,0,0,3107,0,4966,2357,3074,1810,2659,3077,2942,4428,2083,220,3107,
+    0,283,2426,253,1640,2834,3845,1706,156,234,5144,4871,3547,0,2028,2765,
+    263,5326,0,108,3097,1953,3150,0,2160,253,1604,4491,2117,3118,2824,2505,
+    3161,5584,280,276,2480,2608,49,2789,311,0,3492,2813,2009,1743,5581,0,
+    6554,5591,2084,0,38,5978,0,0,225,3988,0,0,0,0,0,0,
+    2613,5442,0,5571,1604,2021,2932,223,0,3173,1813,1689,2159,3346,3196,0,
+    59,2375,273,3031,2911,2635,1609,170,0,202,3177,2647,0,312,0,319,
+    203,0,3228,5882,255,2528,2548,3186,293,6266,2942,214,2009,1953,5194,2548,
+    2502,5832,0,2890,3205,0,0,96,0,0,0,0,0,0,2722,0,
+    0,0,11,0,0,178,0,4886,145,6500,2666,0,4428,246,0,0,
+    1821,0,2139,216,0,0,0,0,317,0,1600,2991,2514,0,0,231,
+    3272,0,5197,206,4940,4893,0,0,4427,2855,3353,5317,2996,1603,4921,3095,
+    47,2018,3271,0,2535,0,3168,1687,0,189,2668,3286,0,0,0,0,
+    2096,0,5203,0,287,232,2857,0,2176,256,76,2810,3384,202,1812,2589,
+    6352,95,1611,2622,210,281,271,2634,4945,252,3315,2403,4501,102,2750,2338,
+    0,3084,2821,3565,2867,2890,273,2670,3041,110,3108,3052,2644,7091,240,174,
+    2947,4225,0,0,0,0,5634,0,0,0,286,2095,0,1682,0,6688,
+    0,3296,2497,213,0,0,5201,5150,3297,2536,2440,0,1810,181,2342,0,
+    0,1964,2703,0,41,122,6393,4285,3230,0,0,0,1742,0,4455,0,
+    3794,2932,158,3112,1853,2930,283,294,1912,2524,0,2909,3268,0,4932,3887,
+    3130,2876,1687,3390,306,4534,3194,0,1814,5663,3096,0,2659,6186,2986,2701,
+    4263,0,1942,225,0,189,1980,4701,1900,145,2822,3766,255,211,102,190,
+    0,2018,0,2756,4005,0,136,0,0,0,4448,3173,83,0,2502,2481,
+    283,0,2501,3549,0,3053,1602,2975,2515,120,1688,0,310,2857,0,1809,
+    1943,0,293,6953,0,0,0,2736,0,2982,4441,4327,0,0,0,0,
+    3428,50,268,5820,3249,0,229,2616,0,3087,0,0,0,0,0,2534,
+    2618,240,4868,0,99,2760,2647,129,2888,246,0,1600,5408,2727,2177,2600,
+    1701,2999,5628,194,24,5545,3336,238,0,283,2877,0,5387,1755,0,4438,
+    6187,1756,2776,2209,3163,2754,2840,201,3080,3271,3139,1679,289,2593,5161,2168,
+    5978,71,211,3249,188,0,3097,2504,2490,0,183,98,2743,5847,2798,3078,
+    3867,1782,0,270,3197,2799,169,1822,0,0,2244,0,2179,5309,3986,2953,
+    4211,288,175,7008,5805,214,2931,0,0,0,6798,0,0,0,0,0,
+    0,3336,0,3777,5560,0,0,0,4932,233,192,183,2823,3282,2935,4491,
+    6066,5528,0,308,0,2469,3131,0,0,2931,5408,5854,0,0,2821,246,
+    3217,3218,5757,0,2880,267,4951,0,0,0,109,3051,4665,2622,0,4930,
+    3328,3427,3773,0,0,3347,0,0,0,240,0,0,0,2150,2657,0,
+    2669,2843,0,0,2468,4900,2073,11,241,3041,5099,190,2474,121,285,1885,
+    0,200,190,246,5407,5967,2832,1904,90,2667,0,74,5985,2817,5786,3238,
+    2495,183,7128,223,2477,2700,1610,314,2341,3876,299,188,0,0,5746,301,
+    3337,5773,231,4278,0,5154,307,3582,0,2628,225,2513,3261,3265,0,2651,
+    1715,2788,3557,131,5598,2592,225,1821,2083,4342,3242,3874,2996,322,4754,0,
+    0,0,0,0,2472,160,0,50,1605,2725,1966,3175,235,3173,0,3875,
+    3283,24,0,226,25,103,3282,4934,4940,2007,2413,2701,2996,168,3239,2735,
+    2525,5455,0,291,114,2007,4272,286,5237,18,301,2834,2481,1946,2946,97,
+    2536,1855,6366,271,3173,2339,181,3107,2084,322,52,183,291,289,305,3549,
+    2480,6011,215,4216,2980,4150,5142,173,0,201,3249,3304,1742,0,5378,0,
+    5747,213,2270,3227,288,200,144,26,2815,6389,4810,1602,0,2083,2934,4052,
+    3117,3102,0,2300,225,3260,0,241,1602,1604,2946,177,2736,3205,237,269,
+    219,0,308,2974,2164,2150,4756,0,0,0,305,1606,5676,1773,301,2539,
+    2847,2077,3262,3326,2897,2117,6505,176,2952,5548,6847,2359,1941,2990,197,1689,
+    0,3205,0,1603,61,132,2690,231,72,215,4490,0,7112,0,0,19,
+    15,3218,3831,1681,37,0,4217,54,2044,5968,2601,0,2701,39,0,3197,
+    218,0,0,3212,0,2645,2980,3546,244,5911,0,0,188,292,3062,174,
+    3128,0,0,0,0,156,0,0,0,2647,6421,5527,3018,0,2865,0,
+    1941,7020,3357,0,0,0,0,2526,321,4930,0,4702,5307,16,48,1838,
+    175,212,3150,2655,3130,3172,308,1940,172,251,2590,2890,4440,2974,303,299,
+    5911,178,3264,301,5747,0,1709,2968,3632,5388,6023,232,3073,194,4350,6251,
+    285,312,4308,0,2152,26,3053,2848,2854,3778,5582,144,2776,6365,3020,273,
+    2589,1853,0,3329,0,1895,257,2647,2868,2991,3452,183,2813,1612,167,204,
+    3056,6195,187,217,1699,0,0,0,4343,296,231,2471,283,2414,2104,3208,
+    237,0,0,2677,5320,2309,108,2018,0,0,0,3077,195,0,0,0,
+    5097,1608,0,18,2867,0,0,0,2206,177,61,0,0,1603,0,76,
+    2603,0,241,97,0,189,1880,1640,1811,3437,145,7041,0,5142,173,174,
+    6763,0,1839,1603,0,0,2584,0,0,246,4042,2217,284,3888,6414,3218,
+    0,198,2806,2820,1605,0,5010,299,3287,1820,190,1813,1754,309,5803,2270,
+    3800,2149,3260,2077,2469,5151,3096,1962,2486,3136,2436,2537,2020,84,2237,5194,
+    0,0,48,0,242,0,1834,2149,2139,267,2022,0,0,2754,0,5187,
+    4580,5363,0,211,0,0,2875,0,2527,133,1848,0,322,3051,4537,2688,
+    168,2502,208,0,6266,2645,2820,2935,3801,0,0,207,1829,7015,2417,0,
+    6268,2406,4876,5746,1745,5810,1710,5812,0,38,4492,0,1607,2743,0,179,
+    6102,5107,7343,4041,1676,3113,0,0,0,3465,5335,2138,111,1633,4437,5977,
+    177,0,3228,6131,2138,3118,2886,4900,4322,0,0,4026,238,4432,64,0,
+    2745,2682,2217,254,0,0,2270,0,172,2801,3658,6045,7061,103,0,0,
+    4580,0,2657,204,0,246,3330,0,0,2624,0,3824,0,2517,0,0,
+    2722,0,6067,2169,2486,155,3550,2480,0,0,0,2237,290,0,0,2644,
+    232,181,253,35,4718,2545,245,132,226,2711,4666,4526,4922,238,2790,5746,
+    2982,0,0,0,2424,0,286,0,0,288,259,0,0,0,0,2923,
+    2809,0,5113,3097,1697,144,2512,1887,177,273,3205,0,174,0,0,1631,
+    2403,5856,276,84,1753,3008,0,3109,0,0,0,3051,2678,0,2897,6772,
+    2021,0,0,4246,0,4089,0,2423,3821,2292,0,4220,2835,4101,0,0,
+    0,0,0,0,120,4089,0,0,1602,2953,0,2038,0,2150,3392,2424,
+    0,0,0,0,2601,191,2183,3118,2858,2822,0,2523,2425,0,0,0,
+    47,14,245,5967,1680,2482,6023,2723,2318,3766,259,312,0,3118,167,1765,
+    4482,2270,0,97,0,0,0,2072,6477,42,0,113,0,0,2957,5423,
+    3283,0,289,293,0,7152,5117,5141,3240,3768,178,216,4886,2815,4428,2602,
+    2880,1965,0,0,0,309,3041,0,1625,1878,0,0,210,3155,5820,0,
+    0,1742,320,2235,2045,4161,4648,3219,0,5810,0,189,0,0,0,3868,
+    3090,1699,4527,4208,214,250,3107,1609,2854,2216,0,0,0,2820,0,0,
+    212,203,170,2281,318,0,143,0,1820,1942,158,3285,5152,0,1878,50,
+    60,186,277,0,0,234,309,18,313,3095,4005,0,173,1764,6031,0,
+    2998,0,0,287,0,193,2038,2030,3930,2141,0,315,2236,2341,2432,194,
+    0,205,72,1610,311,51,2020,137,3052,187,2567,184,2765,113,5590,0,
+    3007,0,0,0,159,3786,4868,253,2529,108,0,177,1965,172,3580,0,
+    1904,4660,1681,0,2423,0,0,0,0,4659,313,2274,72,1602,0,258,
+    1941,3053,111,239,2226,3175,2414,4657,155,7112,121,2953,221,185,296,2633,
+    2637,0,55,3106,4217,0,0,5612,291,0,3556,245,202,0,3208,121,
+    5765,4428,3251,2899,120,1609,73,0,0,0,2402,5373,0,35,302,0,
+    0,0,2159,0,228,2756,0,5141,2792,2864,2656,249,1886,0,197,3250,
+    0,188,220,3041,65,0,3140,1942,0,192,3549,224,6069,194,272,3013,
+    6025,2637,2490,31,2842,218,3337,0,216,2832,3018,237,0,119,0,0,
+    3036,2382,0,3144,2523,1611,0,0,202,0,0,0,3354,147,2952,2644,
+    1850,4665,0,24,0,0,2492,2548,5318,3573,1743,3345,303,2501,3260,2975,
+    0,3548,0,267,0,0,5308,3033,301,0,0,2484,181,3407,135,0,
+    2660,2809,304,4251,1688,3271,5328,3075,0,0,0,1622,0,5306,3030,2558,
+    247,3904,0,40,4887,2801,0,0,2858,0,0,0,2702,234,2724,2708,
+    3287,2367,0,0,0,0,2472,0,0,3614,0,0,202,0,0,2559,
+    5362,4317,3216,3042,0,3076,194,0,0,3869,0,0,0,5087,0,1742,
+    233,3144,168,28,0,3242,2689,0,1877,186,0,0,0,3441,6074,0,
+    0,0,2160,2402,0,234,168,3008,0,5634,0,4219,26,0,0,2336,
+    6498,2957,296,215,3064,1906,2699,2405,169,1677,3232,1963,258,273,1602,5142,
+    5325,4270,0,99,0,6032,0,0,1680,2981,3776,286,2270,80,3846,296,
+    1811,2204,0,3383,0,0,0,2347,0,2862,37,3019,2889,3196,3044,2283,
+    0,2943,0,0,0,0,2767,1636,236,3022,6197,211,0,3238,0,185,
+    275,5850,0,0,2653,3007,3398,3795,3142,6714,1677,98,2853,0,1831,3867,
+    0,6365,0,225,186,5086,191,134,2149,3056,109,2545,229,2498,243,2701,
+    3129,2655,1781,3086,0,2479,1919,2502,2168,2471,247,2977,2270,301,3106,2677,
+    3241,0,145,0,3329,0,25,181,2724,6700,0,0,282,0,219,250,
+    2301,195,0,0,2285,2967,0,0,0,0,4123,2073,0,0,4837,0,
+    3131,3426,0,24,2693,3195,241,3115,2338,2027,1605,2502,0,3095,0,0,
+    0,0,0,2924,1689,2871,0,3262,4720,0,4866,2941,241,184,0,1945,
+    0,0,3141,4310,252,1634,3041,5554,3221,3271,0,0,155,3776,311,2977,
+    5748,2755,2073,3806,2624,7037,184,3150,3151,2084,133,255,5334,203,290,4396,
+    2822,63,216,131,187,230,2612,0,68,0,0,2670,4439,3207,2666,2570,
+    187,5098,0,98,5336,3391,265,16,251,3272,0,176,2726,231,51,1975,
+    64,3018,315,3647,4534,0,0,5690,2810,3119,302,3211,2774,0,113,0,
+    2292,0,0,0,0,1614,264,0,0,3353,0,4869,3428,3140,0,2967,
+    6826,2677,3991,4207,5526,3007,1651,2206,0,6047,2405,0,40,2357,2908,2322,
+    2777,155,4817,0,186,0,3867,26,0,0,4657,4966,0,0,2888,7014,
+    271,259,239,207,7094,6450,66,6203,246,3205,3655,222,3821,199,1624,2999,
+    5987,100,0,1610,0,2424,3009,0,2506,3566,2809,0,3042,0,77,18,
+    0,241,3713,0,3435,3416,3029,4718,2809,151,2734,4866,2481,1815,187,180,
+    0,0,0,2930,2453,0,3299,1611,11,2701,2150,1963,133,1640,269,1753,
+    89,174,2366,3029,0,2666,5767,0,0,175,229,2590,2958,1604,131,0,
+    284,1715,180,0,0,2374,1875,2293,3339,3777,2941,260,0,97,0,3143,
+    2922,1766,2517,2506,5093,5470,224,1746,226,0,3086,2434,0,3150,3099,2920,
+    3227,2739,0,0,3106,213,293,3392,179,247,0,0,0,3367,3140,0,
+    6721,96,4755,222,121,4748,0,3337,3602,83,2657,227,5414,2634,2440,5471,
+    1681,3153,3183,3179,0,0,0,2799,0,0,289,6204,3125,2216,2771,319,
+    0,0,3117,0,0,0,4982,131,4345,3557,6000,5326,2680,4529,4711,315,
+    0,0,0,4976,0,2569,0,1979,0,0,0,0,4349,2590,0,0,
+    0,0,0,0,0,3266,54,1842,247,160,6022,3053,3271,4066,2751,2206,
+    2784,169,3249,194,3087,2541,2721,307,3575,2589,3881,2480,5820,268,181,2273,
+    0,0,6416,6848,133,1699,180,235,0,0,0,5976,4982,3725,6742,307,
+    0,0,6194,0,2309,0,1905,172,0,7029,0,96,191,5042,3164,3625,
+    289,2017,3785,249,1767,5363,2946,5748,2726,2274,3087,2647,1688,5127,2623,2505,
+    0,86,0,0,2699,109,2959,2988,244,187,3165,255,0,2484,228,2424,
+    3150,3282,0,1897,3140,63,3176,0,2866,3547,4436,3997,3086,5307,196,0,
+    233,4616,1606,2139,2710,2494,3056,4939,2810,0,263,3239,2349,2787,4279,5143,
+    2700,187,0,173,171,51,7347,0,0,2506,0,5087,2204,3272,221,233,
+    0,259,0,169,0,5341,2622,101,227,0,97,209,2612,2018,4233,0,
+    2818,1699,5088,213,2798,107,85,2876,1840,190,3216,7231,2114,286,3586,3230,
+    2602,1774,48,5320,6239,2347,5826,5113,254,5496,3034,5641,2036,5702,2487,2659,
+    0,0,0,0,297,3768,0,0,0,0,2558,97,0,0,3128,1961,
+    5361,244,3315,2778,4761,2506,2523,3848,3075,287,281,0,198,54,0,216,
+    0,0,2557,2934,0,2591,0,0,2293,3098,3401,3260,3937,63,0,4050,
+    0,2159,3162,3767,242,2952,3242,3294,0,4216,0,2538,2846,148,2534,0,
+    136,2614,5346,3293,145,2974,145,3045,226,3044,2794,297,2155,298,233,317,
+    316,2406,274,264,2408,3822,2349,2501,3025,197,2471,2744,5096,3337,202,2722,
+    6197,259,5781,303,178,2085,205,6359,6251,3183,2831,2625,4372,215,2348,2954,
+    1606,3336,243,5089,2282,2757,191,5529,2471,286,170,41,3210,285,1604,2622,
+    2046,0,52,0,2347,0,1919,2848,175,2684,282,5554,0,1721,1687,1743,
+    2085,6103,239,270,2700,0,52,3867,210,0,0,0,2351,0,3546,284,
+    0,0,0,37,4755,0,63,232,306,0,2387,155,4703,110,2933,1642,
+    0,3263,114,2493,6394,217,3306,3336,0,5361,0,0,2758,3261,309,0,
+    2767,0,0,2650,0,0,47,2366,0,4528,0,2525,0,0,0,3113,
+    0,0,202,2976,0,0,0,119,0,0,0,0,5528,0,4576,2909,
+    102,2557,2045,2655,5675,1885,186,0,0,0,219,0,0,0,2139,71,
+    219,2547,4278,2888,194,226,35,2501,3139,2525,0,2662,246,2103,2567,61,
+    3710,76,73,2754,2723,2225,3106,244,3443,3150,2589,4427,250,36,0,0,
+    192,2810,1744,2527,2856,2649,321,2689,0,2668,3277,5097,2800,6189,3315,1603,
+    193,6238,5186,3064,0,0,1767,316,2561,307,273,2866,3051,5090,1814,3087,
+    2471,0,226,2546,0,1676,5749,2006,3874,2727,3648,2859,2688,0,2443,0,
+    3221,39,0,4747,36,0,3042,3021,2407,136,282,5096,3228,0,4886,2293,
+    245,2644,0,247,279,0,297,2733,99,3209,0,5222,5641,180,1742,0,
+    3286,0,2149,2469,2792,0,2524,4784,0,0,0,0,0,0,2154,0,
+    40,2912,4816,6106,0,3018,2993,198,20,265,288,0,5680,3062,0,6350,
+    4005,2622,2634,0,2887,172,3831,204,2711,2983,2582,2205,197,2755,134,1604,
+    2440,196,3140,211,0,3067,51,150,6202,1610,1600,256,101,226,1972,210,
+    2573,0,2340,2526,190,1602,3139,232,120,186,6011,4811,266,2771,2942,0,
+    2578,2725,2374,0,2910,2909,1600,1680,168,3778,3178,11,5582,311,3239,2160,
+    0,0,13,0,0,0,5804,2590,221,2277,2468,1621,2141,260,0,2020,
+    5309,0,2935,174,6590,73,15,4321,2666,96,303,6040,2810,0,2007,2700,
+    5773,0,2722,2932,3568,245,259,2512,4790,305,2889,2622,298,3139,1809,296,
+    2227,2287,5087,294,226,3266,1839,148,2027,3996,107,227,3766,3317,195,5803,
+    2215,2968,170,261,2979,1621,5966,1608,276,2728,3306,2777,1609,3195,4208,2901,
+    2141,5406,2963,4951,4123,293,2282,0,2535,1721,2633,3930,3218,0,6351,0,
+    233,3573,3131,1600,3238,2582,182,173,2616,1606,0,0,212,2273,2172,0,
+    199,0,193,298,0,2468,4217,0,5410,225,0,0,3250,1610,0,3150,
+    59,319,259,0,294,2480,2017,2524,195,0,0,3776,3476,3172,2887,152,
+    188,159,1648,3172,3264,0,3416,0,3161,169,221,220,4307,2671,3822,224,
+    2791,0,0,0,37,135,1603,241,0,2486,5759,3398,297,3218,2879,2556,
+    0,301,2104,50,3190,1887,7035,2079,2358,1689,3228,1627,256,1972,0,4921,
+    5804,5966,47,3063,1953,1601,246,5016,5989,0,0,0,238,2656,2964,23,
+    0,0,2886,0,0,0,0,2413,1940,0,2492,253,0,0,3434,0,
+    0,0,0,225,0,2316,2854,13,0,5774,61,1809,0,2976,0,36,
+    302,3117,2615,3113,2579,230,218,3316,171,3110,0,0,278,0,197,0,
+    2800,2523,5970,3134,219,71,2435,2693,5325,3282,2853,87,2441,83,279,3227,
+    255,3128,5120,1962,2660,1953,1624,3188,3095,292,5385,1649,3777,1699,2723,1766,
+    233,3360,1607,2484,3556,241,275,2969,0,0,0,2886,0,2977,0,0,
+    0,2831,2887,298,3785,2073,0,3120,2788,2634,1812,3682,3498,5145,2987,274,
+    3610,5526,5627,1631,1764,3549,1808,79,305,149,2716,3207,5647,260,3716,3184,
+    2756,237,1808,4220,4945,314,145,198,5967,2952,5583,3129,4648,2844,3227,234,
+    102,2733,6053,2941,2589,2207,2776,5977,2756,184,4687,3238,4701,143,237,3143,
+    319,2570,2491,5581,3086,311,232,2600,1905,2528,1952,265,2571,11,2285,4144,
+    4129,2627,5036,0,5546,0,0,5666,2550,1743,269,2490,2975,2972,6798,2018,
+    1814,0,4754,95,246,169,0,4710,0,4262,5306,3029,0,0,0,2159,
+    35,0,0,0,0,307,6440,187,0,0,0,0,3111,3218,210,2625,
+    2965,181,2935,2021,0,0,5151,6470,4932,167,2956,0,77,2968,0,0,
+    0,0,2645,18,2611,5987,258,226,1880,0,312,223,2932,3201,0,2635,
+    4278,4922,101,2432,0,0,2142,1606,0,121,6575,1809,1678,3139,209,2403,
+    173,0,208,241,2618,2083,1895,136,311,0,259,5370,1941,225,6210,1830,
+    3316,246,4460,0,1755,0,281,3161,0,0,0,0,282,3096,3223,3150,
+    7010,0,0,2853,3625,2225,2204,0,2766,3227,0,1875,0,0,2747,0,
+    3298,3426,4947,263,2942,2638,4051,0,5636,3223,306,4086,0,2601,223,2030,
+    0,0,2853,0,207,2592,5257,286,0,2546,0,4748,0,0,0,3823,
+    69,0,3165,2844,2589,5311,2920,0,0,0,0,0,0,0,1943,0,
+    203,121,211,5378,12,1621,2177,186,2702,4050,0,2425,0,2215,180,0,
+    250,60,2989,6414,2169,120,1940,3400,5946,6189,2699,5455,0,218,0,187,
+    2337,4825,0,0,0,0,2724,1655,254,4206,3348,2837,2699,0,2922,2501,
+    0,0,277,0,0,175,0,2875,2367,155,313,131,0,2225,0,0,
+    5663,1754,2557,2044,6001,5976,33,0,0,1943,279,175,1687,2799,0,3936,
+    196,3210,4281,1624,3299,2494,2657,0,158,1780,167,206,2337,2912,4666,0,
+    0,2700,2688,224,0,5766,5361,3667,260,0,2834,2336,114,4273,0,3085,
+    2272,0,0,0,0,2537,6266,17,0,2580,23,0,6401,0,157,321,
+    2943,6806,3904,2557,2640,3207,2216,4718,2625,1764,2899,6103,0,0,2812,0,
+    1642,121,2492,307,6716,3546,108,0,2949,2535,259,2900,167,4674,2367,188,
+    4702,3345,2622,235,2010,0,2637,3230,235,211,2169,25,1603,299,199,2905,
+    2870,2639,0,7099,0,109,1697,1727,287,0,55,0,0,2469,278,0,
+    1607,0,0,4833,0,0,0,283,205,1808,0,186,0,0,3619,0,
+    2809,3275,84,270,4271,0,5581,2978,2425,0,0,2824,3120,3021,2149,2952,
+    0,0,0,216,0,0,2413,220,5811,1940,3831,0,217,0,64,2879,
+    0,2512,4355,2560,110,3354,6246,6694,0,0,245,156,0,203,2514,2909,
+    3063,310,0,248,1610,272,0,0,3565,3426,0,0,3063,290,0,0,
+    0,2908,0,2675,0,0,3592,144,2295,266,0,0,3305,3174,191,2513,
+    3042,2079,0,0,197,143,0,2695,2111,0,0,0,2766,1687,0,2578,
+    2842,0,0,2732,0,0,182,4505,2923,102,233,2988,156,3189,2987,3566,
+    0,0,13,6524,6742,149,26,3271,258,2205,3076,3053,3434,3153,6194,198,
+    253,297,2225,6359,0,271,0,208,3304,0,0,6764,128,2374,0,3558,
+    0,209,0,2518,3341,0,1608,4674,235,2604,0,150,3426,2492,2502,149,
+    143,0,5427,2623,1753,2677,320,248,3205,4970,3064,230,3209,167,134,1964,
+    5088,4796,1991,11,2139,278,0,0,237,2923,0,0,3569,2591,0,3277,
+    4822,229,84,3108,47,2516,238,266,163,0,5747,5760,238,1603,3315,5591,
+    26,2821,3999,1613,2942,2602,0,4795,197,1603,1892,0,206,0,198,2215,
+    1877,0,133,190,158,3822,1676,3909,3229,0,86,3272,0,0,0,2798,
+    0,85,3084,4718,1780,0,3315,2845,107,0,204,1963,214,0,0,168,
+    0,25,0,0,0,0,0,0,96,2875,2780,3029,286,0,2433,1809,
+    5636,2977,5086,5910,2703,37,5825,143,311,3986,2812,1763,2557,1676,209,1906,
+    2646,4893,0,0,236,3565,15,110,235,0,0,62,0,0,265,2547,
+    11,0,0,237,1693,0,315,1854,0,6389,0,240,3613,0,3120,0,
+    291,4140,196,3019,169,2953,4052,281,2338,0,0,4784,2911,98,268,293,
+    3184,3235,4088,2633,7182,1822,0,1662,5985,0,5530,0,2946,0,0,3550,
+    2095,0,0,2826,40,5582,247,0,0,1742,0,0,0,2936,0,2139,
+    0,173,1756,155,2505,277,2699,218,2471,4786,5378,2482,2920,5758,0,4350,
+    0,0,2536,6321,0,2027,0,2505,0,4565,0,1612,0,2732,1885,3207,
+    2979,0,2635,4190,0,0,223,217,3777,0,0,0,0,0,24,0,
+    308,2888,2725,2144,0,2831,2883,1753,2717,3206,0,271,0,3194,131,144,
+    0,3868,3556,3019,2613,3060,159,2844,5847,2546,5561,2369,2811,3663,6534,2472,
+    0,187,0,238,5189,237,2954,0,4306,0,4077,0,3831,2655,0,0,
+    0,0,4009,41,83,0,0,0,12,244,1940,2619,0,0,2495,4902,
+    3216,276,2535,3273,3065,243,0,0,2623,0,4967,1649,2908,2578,89,5802,
+    126,0,2603,6693,4895,3122,0,0,0,242,0,0,0,0,156,4041,
+    3154,3970,5768,0,302,2076,3077,3286,6714,2761,3240,0,0,3405,145,6483,
+    5526,6686,0,0,0,3400,195,0,276,180,2658,0,0,2591,0,2105,
+    0,3206,3019,2949,253,3318,0,0,5848,0,2909,2537,3055,2646,6943,0,
+    1743,37,5613,0,3064,0,265,3603,210,3381,5634,1606,3647,6399,3307,0,
+    2656,0,1600,0,0,0,2018,0,5186,3463,3211,35,2284,0,210,197,
+    2576,3172,100,2877,0,2953,155,226,2423,43,3910,0,0,0,0,0,
+    6300,0,262,4703,0,4569,2635,2558,0,2959,0,113,0,206,2944,2152,
+    143,2416,0,0,0,1601,0,0,0,2756,0,1640,280,143,2964,0,
+    0,2208,5756,2680,0,0,0,2963,2074,2008,3381,123,194,5144,1763,0,
+    179,2876,0,0,0,4498,110,317,0,188,0,0,83,0,156,4247,
+    0,5478,2887,4721,0,0,6021,0,182,3318,3020,6826,0,4306,275,1642,
+    0,206,0,2029,0,2628,2980,0,5665,1972,2366,2207,4482,2468,318,2546,
+    4208,190,5361,2638,3206,7219,2867,0,0,210,2481,0,3052,0,2780,2009,
+    213,318,0,230,0,4460,0,199,5187,2567,0,0,0,0,0,86,
+    3776,3654,0,172,2876,221,108,6111,0,0,4535,0,2546,0,306,312,
+    2501,274,2601,6686,2955,62,6156,3096,0,265,3161,2176,3107,6811,256,0,
+    3967,2501,4129,183,1744,309,3779,0,0,0,2613,190,0,0,200,0,
+    187,0,3573,191,256,2546,0,98,121,2865,0,228,242,4426,3220,0,
+    1680,5970,3058,3263,0,2991,2820,3603,0,0,0,206,1755,285,120,0,
+    194,0,0,4262,0,2966,231,0,0,0,0,0,0,3051,5201,2744,
+    0,0,3161,3252,3283,0,2930,0,3098,50,2535,2513,2810,2472,298,160,
+    2903,5379,2387,255,2919,322,305,321,0,0,0,88,3576,0,180,226,
+    2027,2227,4981,4939,3099,36,160,0,3856,0,3304,3547,0,212,316,2600,
+    0,145,0,2974,2614,2678,2583,2886,294,227,181,5628,36,5802,0,0,
+    0,6680,0,3241,4316,2086,6273,0,0,0,35,280,1600,185,0,0,
+    4270,1688,0,2501,293,3242,83,3162,4969,2887,3086,5385,3150,3044,4727,2534,
+    187,0,0,2502,0,5106,5096,253,2655,232,6894,3076,0,2490,2843,3152,
+    6040,2541,268,2228,3033,2191,241,4728,263,6274,4889,2358,2433,5644,3549,2857,
+    0,0,3426,204,4754,170,7357,0,5629,2286,0,0,2881,2921,0,123,
+    0,5307,2477,0,0,311,0,2537,223,3557,2615,0,0,237,3009,0,
+    2036,0,0,5186,5627,0,2712,0,2600,2908,0,290,5113,35,3307,2752,
+    0,2666,3100,235,192,0,0,3122,6076,281,2546,11,5548,4762,0,2877,
+    0,0,2887,248,59,2589,2911,1787,4566,4014,145,2374,237,2799,208,2097,
+    2842,200,2922,2777,0,0,60,5600,284,2997,2837,170,3260,2512,3196,0,
+    6188,0,287,2206,237,0,2921,3987,0,264,309,2670,4660,0,6230,4427,
+    2614,3426,2646,3206,0,0,0,0,3220,318,1601,2149,0,0,1606,232,
+    2149,0,238,155,268,263,1753,5846,5141,2898,3776,1886,0,3547,0,0,
+    217,0,0,61,1602,2639,1898,0,2986,6130,271,184,5601,2887,0,2578,
+    6196,302,2757,3867,2209,5531,0,3393,0,0,0,3560,2672,3161,278,98,
+    3490,2374,0,0,2096,0,0,0,0,0,0,0,0,2590,2142,0,
+    0,2920,0,0,2530,0,0,0,0,4446,2798,2546,1943,2692,1920,2680,
+    0,255,0,260,0,5969,0,2919,0,0,0,0,3234,184,5976,275,
+    3263,5380,157,3163,0,229,2601,6866,5120,2997,1971,0,0,1773,0,2668,
+    2083,251,189,3549,2672,3249,2659,5142,3326,133,3611,5979,3689,1878,100,3547,
+    0,0,270,0,0,145,2657,3219,0,2952,3986,2867,2018,225,0,0,
+    4666,174,316,2961,2083,2930,5528,3052,0,3033,310,247,270,0,2554,4879,
+    1608,3648,92,307,194,234,30,1941,2161,4285,2842,2898,38,177,3071,3139,
+    6414,3205,4596,78,3199,258,3195,95,2517,51,2988,2814,2583,308,2567,226,
+    2271,288,38,6350,2514,213,2956,2503,251,2743,3044,3151,2668,5195,274,2798,
+    183,2682,2104,2952,1822,0,2701,3241,243,168,2281,6103,145,307,0,3607,
+    284,310,304,2072,2601,39,7252,2205,3095,5546,2011,109,315,4206,2073,13,
+    0,0,2140,2832,2492,2855,1611,2208,1941,0,0,1691,2724,5627,0,2992,
+    134,0,5547,188,0,145,5662,0,0,2110,6031,2541,5591,0,0,0,
+    275,251,300,315,5985,3909,2357,97,2208,3119,2762,3385,2666,2037,173,3108,
+    316,1963,4436,1877,2831,3903,0,0,3130,2777,4087,4866,167,3556,268,251,
+    0,0,3198,3074,235,0,171,5417,0,6727,19,0,0,2700,179,0,
+    2291,0,3005,0,294,189,3069,0,0,197,0,4650,0,0,5229,0,
+    2937,4527,273,2998,6472,5109,53,1601,2723,0,3546,2568,2514,210,246,247,
+    3827,5333,182,0,0,0,5970,1986,1623,4217,4052,2220,0,0,190,3430,
+    6295,3318,0,0,2613,1754,0,277,2734,319,3053,0,0,0,3047,0,
+    0,6195,0,1642,0,131,0,221,207,4938,6241,0,2947,131,1874,2836,
+    0,0,5362,2710,1600,6087,284,131,3035,2490,107,1609,4453,3339,1608,7010,
+    240,0,0,0,2604,203,0,1874,2469,2889,2917,2072,23,0,244,203,
+    1886,107,0,2010,212,3089,168,1809,2084,255,0,0,1875,0,2424,0,
+    2734,2915,6727,2294,2699,224,0,3118,0,3007,0,0,212,0,0,2336,
+    2284,229,169,0,3074,0,1961,0,2846,0,0,0,0,156,3117,0,
+    0,5443,49,3238,0,47,19,207,0,2468,2281,0,0,1656,6779,209,
+    6351,0,2887,2945,5114,2176,2512,0,4710,5760,1812,2864,0,5086,1856,5748,
+    167,1823,2270,78,2534,232,3611,222,5634,2075,0,241,5581,236,2504,24,
+    3183,0,0,0,0,0,0,0,0,0,0,5144,4923,0,2842,0,
+    0,3194,2877,227,4094,0,2900,0,0,4176,3096,0,238,225,0,4286,
+    0,0,0,2853,2219,0,0,0,0,3566,4647,0,3795,2272,0,0,
+    0,0,2183,1838,1605,0,3145,284,14,2471,0,0,2637,3261,3304,4483,
+    251,254,249,2558,3053,2692,2138,3318,2890,4517,4542,3096,4020,143,3399,160,
+    0,2534,0,4646,0,2611,3178,35,229,2889,219,167,0,314,0,4042,
+    3110,3251,3033,2271,6031,3019,2169,2537,3823,2207,3064,2633,1602,6030,4108,1952,
+    3327,0,1601,2536,24,0,0,144,4308,40,2537,4499,5090,0,0,0,
+    1842,0,0,180,0,316,184,266,0,229,0,4922,0,2790,2667,5545,
+    0,0,0,5775,3316,0,0,59,0,259,3141,0,3382,0,0,0,
+    6076,1679,0,32,124,2302,3166,95,0,0,3986,0,4483,0,3559,0,
+    0,200,5634,0,0,3185,273,0,97,0,2655,2546,2986,1847,5477,6246,
+    0,3264,177,0,49,109,238,0,0,3824,0,0,3304,3601,0,2534,
+    2889,2535,0,0,3573,4967,0,2027,4969,4924,303,0,249,2860,0,0,
+    200,1877,2216,7058,146,2721,2902,2634,0,0,0,0,3219,2650,2664,0,
+    0,286,0,0,0,0,0,0,215,222,2788,0,0,0,0,0,
+    274,2159,185,6215,3101,2484,286,0,2930,2559,4094,0,145,0,319,0,
+    5449,2737,2204,171,0,277,0,4261,0,0,1643,4171,0,0,0,0,
+    3336,6187,5634,3098,3326,1604,2679,2096,2336,294,3062,0,0,1691,6908,285,
+    230,321,183,0,2679,132,0,23,2360,2622,200,3221,199,2965,2864,0,
+    1604,3029,2755,2568,6376,292,205,2641,123,4784,2579,293,214,286,3007,288,
+    1945,206,4878,4877,2945,223,5629,198,2622,238,2689,2667,176,319,3328,120,
+    221,4446,225,2791,0,190,222,100,4870,3085,1810,0,196,144,2471,3154,
+    3020,4445,1609,2721,2149,2029,239,2337,0,1914,0,2541,0,83,0,2537,
+    0,0,0,121,2736,111,3321,6051,27,312,2403,2655,3185,0,3315,2804,
+    5849,5150,0,3183,229,2941,0,0,0,0,3195,2952,6715,0,226,1955,
+    2644,0,0,167,6358,0,298,0,0,1942,2889,0,4876,211,0,0,
+    198,0,2506,0,246,5121,1603,0,311,227,3139,4307,3769,0,85,3120,
+    0,73,6035,258,216,2921,122,2847,3040,4746,3272,2946,6799,2481,0,2468,
+    6470,2798,1940,3030,1715,109,2834,2955,1602,5004,0,6023,3033,4932,195,3294,
+    276,4701,2076,5985,0,2037,0,0,3768,287,0,0,0,0,3405,0,
+    4921,2677,0,0,3271,203,4308,2736,0,0,263,0,0,0,0,0,
+    1878,242,0,6233,0,2020,267,0,0,199,2549,304,0,0,98,2655,
+    0,4611,3646,201,5476,0,0,0,1944,0,222,3008,0,295,2813,0,
+    2083,135,2855,235,65,2809,5759,170,2141,5820,5993,6372,292,3041,0,225,
+    0,5691,60,0,158,6686,2721,3556,4791,2589,0,321,2556,0,4430,5385,
+    2575,224,4930,2366,0,0,0,5526,2964,2097,0,217,1607,2589,0,2735,
+    2512,6689,3210,241,4095,2094,3326,2638,1604,4499,212,0,248,2865,2800,1826,
+    0,1687,6827,2747,3996,0,180,3084,2501,3277,1644,2162,178,6022,2495,0,
+    2601,0,2163,3286,258,0,2700,0,0,0,197,2085,0,3243,5756,1811,
+    2440,292,1763,3428,0,2086,5529,7041,0,0,0,2406,2557,2778,3338,3601,
+    0,0,1601,2176,0,0,2611,0,0,0,2470,229,1919,119,0,132,
+    0,172,210,0,2800,0,0,308,312,0,0,214,276,2315,2426,2514,
+    0,2075,0,3101,0,1874,2357,3780,144,0,303,0,0,2225,222,2622,
+    260,0,313,0,4436,0,2801,0,2073,184,0,2875,2624,0,0,0,
+    2721,3054,0,196,0,1930,0,3825,170,0,2669,3271,3151,2549,5598,0,
+    2645,2579,246,0,0,283,2453,2933,3042,5230,279,0,230,61,97,295,
+    306,245,0,4285,184,260,1794,1600,4921,319,2622,0,2336,157,2292,3274,
+    3315,251,0,4657,108,3689,77,74,192,5561,3382,110,1641,2763,2788,195,
+    6078,0,316,95,147,2359,261,6002,6066,3491,2844,2745,298,1773,167,2281,
+    0,0,1699,2949,6270,0,0,0,3141,6806,6109,3065,0,0,4481,4726,
+    0,0,2980,38,0,0,0,0,0,199,0,2710,3986,2481,228,315,
+    2469,6030,2337,2789,314,2113,0,207,3399,3261,0,101,198,255,6806,197,
+    3066,3346,2813,4704,1616,5985,1961,2557,0,0,2981,0,72,0,3656,63,
+    299,2152,2568,5766,5765,303,111,229,194,3047,2999,2473,2904,0,0,1606,
+    0,0,0,0,0,0,0,3953,2225,2648,0,275,3157,0,0,3606,
+    0,3490,2941,99,1819,0,1889,6211,216,30,203,3161,4710,0,0,0,
+    255,0,0,5759,41,0,0,0,2219,170,0,0,0,2218,0,0,
+    0,2381,2941,6394,4129,5526,2491,266,1753,0,4066,0,0,279,2139,6736,
+    0,317,2656,0,186,316,6358,3030,0,2504,2442,321,285,0,0,0,
+    2515,1622,3179,317,3178,4156,2843,2886,2404,0,47,2990,3238,223,188,4285,
+    4657,3122,3261,5121,3107,2007,3471,2218,0,3042,143,301,175,0,5665,3198,
+    3101,226,2798,0,6908,0,0,3548,0,2568,2483,4007,0,0,194,4350,
+    0,7008,182,201,241,2623,3088,2655,2479,267,3163,3740,0,219,181,0,
+    5086,212,0,3151,2564,235,4492,3328,2853,0,5591,1604,2534,1621,1676,257,
+    3186,2536,4060,3338,0,2497,5141,4705,267,322,3254,1876,0,115,173,193,
+    0,2502,47,189,1744,316,269,0,2535,0,0,198,0,2415,2571,178,
+    0,1941,2505,3565,0,170,2837,4206,2291,320,0,36,0,0,0,0,
+    0,3176,1887,2736,0,122,0,6377,200,0,0,1952,2435,0,3832,0,
+    1649,2776,247,1601,2496,3210,175,263,6186,0,0,5767,17,0,0,2557,
+    5287,0,2482,2988,176,6296,4466,2656,237,234,83,3172,2948,6231,4428,5804,
+    4876,6266,0,3581,0,41,3065,0,0,0,0,1605,0,0,4314,250,
+    0,0,0,1608,1691,206,0,4094,274,0,194,2634,5854,0,35,0,
+    2997,2336,2590,0,226,0,1605,0,0,0,0,2367,222,0,0,320,
+    173,83,2537,213,297,5096,3435,188,0,2672,0,2336,0,0,0,2688,
+    1708,2291,5967,2604,2756,262,87,0,2273,2650,250,3777,4271,5527,2854,4455,
+    3251,250,3877,2930,222,2512,221,2666,2644,175,3165,7020,2849,3407,219,6104,
+    98,2877,170,0,4939,186,242,3252,4924,2228,3602,5628,3602,3008,1603,296,
+    3010,2854,4288,2646,231,1687,2605,162,2036,3103,194,4878,3106,0,241,5606,
+    2138,2427,2714,180,288,3140,294,261,0,112,98,208,3073,3315,2822,255,
+    3346,5571,0,2480,4646,73,261,0,0,314,2942,313,0,3106,218,276,
+    6285,0,285,2831,0,0,2671,172,6240,2887,2473,53,5113,3646,283,11,
+    321,4485,6038,1621,199,233,2754,3464,6167,2506,5317,259,6186,293,2600,53,
+    272,1609,277,244,107,225,2876,282,188,4429,3184,176,3867,307,3786,259,
+    0,3162,2942,5536,0,2291,5605,2591,1609,0,2534,2300,2820,226,59,1692,
+    1621,2717,210,6030,95,5086,2591,2658,2879,3825,4123,259,2655,268,4967,1954,
+    2846,0,275,6102,6435,2557,211,5333,4329,0,3308,3547,96,2788,38,322,
+    1610,2604,84,185,0,6393,231,4321,0,1955,182,5746,5757,295,0,2283,
+    2869,0,5187,3249,0,1874,3551,0,2787,3276,2658,3153,1821,257,2337,3272,
+    2889,95,2734,189,6220,3840,1676,2821,0,4938,0,0,3339,0,3867,2140,
+    0,1640,0,80,0,0,0,159,0,0,0,133,0,0,0,0,
+    158,0,271,175,0,0,0,0,2074,88,311,2352,189,120,2509,3273,
+    313,2967,3196,3821,2710,232,0,226,6800,5457,0,0,291,0,2073,3656,
+    0,0,2846,26,0,3239,0,95,0,61,0,6230,279,2294,3133,3779,
+    280,266,5142,2759,132,0,2282,297,2207,0,3228,2347,4869,0,0,2176,
+    0,0,5416,0,3777,262,2714,206,3261,4371,2138,4287,0,0,2168,300,
+    3108,282,2747,2975,2480,267,6386,3192,170,5316,1631,2699,2468,122,188,200,
+    2161,3129,212,2991,205,2776,4227,197,2368,3084,2359,5335,225,4657,251,196,
+    2776,3156,0,4988,2611,6520,2160,3209,0,3154,285,84,5995,181,5009,242,
+    194,2611,205,5883,0,2170,0,320,98,4123,5409,0,121,2952,55,2612,
+    0,0,208,248,277,0,1600,2792,0,6203,2919,0,4217,0,3041,3097,
+    2668,2814,6103,2721,2869,2592,3085,0,5672,320,258,0,0,218,0,3603,
+    0,1608,2539,0,5212,3101,250,0,0,0,0,200,0,0,2162,243,
+    245,2891,2800,0,223,2633,5527,0,5545,1604,259,208,3024,89,0,6799,
+    5189,6230,294,124,6498,0,0,0,2336,0,314,0,197,2606,4866,2910,
+    3242,11,2941,0,2563,0,2085,0,2138,5003,0,0,2303,0,146,0,
+    2535,216,2273,5449,318,0,293,4088,6021,6580,319,0,2484,3619,0,3625,
+    1610,2093,2501,119,1742,3471,2898,2073,4044,110,0,3107,2803,6519,3304,84,
+    0,0,6778,0,6680,2747,2754,5171,109,0,5318,0,0,0,0,0,
+    0,3786,1600,3251,3150,2912,95,5590,0,1940,2622,2017,0,0,0,3646,
+    2678,0,2722,3821,219,0,4436,6120,0,3059,285,0,0,0,288,0,
+    0,0,2644,2009,2966,0,2810,0,0,3254,0,88,1709,5333,23,2617,
+    2381,134,0,178,0,60,11,0,169,2757,0,1609,4067,5813,1780,2612,
+    4528,109,1632,2468,0,2338,2787,2976,0,256,1656,0,198,143,245,4661,
+    2656,197,3062,3296,0,3647,322,61,146,3811,4241,5967,164,1605,2469,3183,
+    0,0,2732,5307,308,103,0,0,0,207,261,226,2710,0,0,0,
+    0,0,0,296,3090,3838,246,3337,0,1609,0,2581,0,2140,3511,152,
+    147,0,0,3661,0,1622,4931,2226,0,3008,2932,0,35,0,0,2615,
+    0,107,0,0,249,2536,2717,0,0,0,0,0,0,0,0,23,
+    4710,5194,2834,2901,222,2545,2491,4437,1609,5158,5979,6305,0,1859,2010,5760,
+    6800,0,0,221,5757,0,1612,2507,0,199,2603,278,0,0,0,2301,
+    3260,5822,3384,2922,2944,3141,2474,3636,1680,2471,3411,3143,201,3685,2842,2347,
+    4225,1874,292,213,95,2800,3547,2528,2703,4263,4280,168,167,3195,2678,4885,
+    202,2843,1676,3012,3822,1698,2524,3581,3355,2524,307,2470,3241,200,93,3219,
+    4112,0,0,1600,302,184,3140,281,2843,193,6273,4045,2580,2633,23,5527,
+    0,1942,2336,0,3099,2831,2433,194,2789,2292,1609,4659,54,286,2970,128,
+    3097,1612,2988,13,3200,143,169,4542,0,0,2997,2667,6505,2833,233,1604,
+    3130,0,0,319,3051,5587,2475,293,111,0,11,2604,0,0,2589,0,
+    0,277,197,0,237,3047,319,5774,0,0,0,25,220,3838,0,0,
+    3051,1609,0,5506,5317,238,318,191,189,0,0,3241,1996,3073,0,3648,
+    2740,234,251,0,2944,133,242,3845,0,13,0,37,2630,2869,2567,5854,
+    63,238,2795,3217,298,296,73,6052,0,3273,3096,3205,0,15,0,0,
+    0,0,0,0,0,171,2291,0,0,3139,2205,0,2505,184,0,305,
+    261,0,0,3194,3306,5307,271,0,0,0,0,0,209,1763,0,2337,
+    84,3162,2974,188,235,6353,2781,3117,5308,5627,249,4831,83,2102,2900,2952,
+    3227,3176,2038,2943,3053,225,2415,2787,2530,4921,4725,6103,2637,3282,212,2479,
+    2111,2405,0,0,96,3161,2481,2349,2624,3381,2974,306,0,1608,53,271,
+    3304,2783,1625,4885,5528,3217,3768,301,297,2094,3329,3787,1829,2550,0,2484,
+    318,3073,2669,2374,250,6728,319,0,0,4650,2821,2837,2301,5099,3306,2415,
+    2828,5861,262,296,2084,2656,180,321,0,0,248,177,2552,199,273,4426,
+    3285,319,0,6238,5326,0,5396,6687,4436,5416,207,2508,2770,2979,2569,3152,
+    0,2667,2603,2777,2589,2941,5538,2027,2792,0,0,1624,4876,2308,5765,0,
+    5105,0,2811,78,24,5855,0,70,2272,1656,0,0,3463,5194,1601,171,
+    3317,229,86,225,2352,5968,3018,158,2933,0,0,5096,2968,254,0,3284,
+    4059,1606,194,3172,4611,110,3052,278,314,3360,0,3447,297,2990,274,3062,
+    0,5670,6294,2281,2647,0,0,2492,0,0,2622,4647,262,310,2568,2778,
+    0,2865,28,3354,0,3051,90,196,2738,3330,0,0,3150,0,3157,2648,
+    0,2644,3194,0,188,2975,0,6000,2758,0,1890,4225,3242,2357,2766,293,
+    2514,3021,3074,2810,1616,2216,321,279,5086,5456,6239,3277,2802,2171,2657,3766,
+    5142,301,2974,2017,2470,3398,3276,2920,302,1605,5333,97,2892,3020,2777,0,
+    4933,2523,122,173,2662,277,5831,2413,4483,4719,2228,0,0,2027,2813,0,
+    0,4445,4050,2018,275,243,196,294,5527,3197,1622,1603,4658,3177,2516,2854,
+    4446,3143,145,1743,3305,0,1607,6187,0,2899,5470,96,4042,2348,0,0,
+    2503,3055,3556,226,2952,0,3610,0,2986,2887,294,121,5318,0,1721,285,
+    3172,144,3987,52,2854,1952,2743,0,0,263,3100,0,316,233,0,321,
+    3153,2843,73,6732,2141,3227,0,0,3238,4051,0,4438,0,4107,0,0,
+    3909,132,2942,2360,35,260,2788,252,5087,4462,0,0,5883,0,5202,5987,
+    0,2153,0,0,2603,266,3238,0,285,0,3348,0,4327,0,0,0,
+    3565,308,2605,5746,2402,0,5946,214,3807,144,3768,0,2678,0,0,2347,
+    0,0,0,267,4262,6813,0,73,2646,2623,5751,4332,2079,0,3790,3998,
+    0,0,2812,0,0,2103,3129,68,1699,22,2821,2211,224,0,0,234,
+    2986,1604,3053,2919,5375,133,1604,5818,0,6195,5766,3233,297,2776,133,248,
+    0,2578,3152,2206,306,290,3317,0,278,2479,2591,0,49,205,0,3211,
+    2813,25,199,0,2404,0,0,0,3052,0,16,0,3059,4309,0,0,
+    308,286,3905,3046,2434,2680,3073,2601,2096,123,1781,2700,313,285,1775,2723,
+    3767,2658,4747,2745,0,0,266,207,2528,295,3601,3051,2771,2083,0,0,
+    0,0,0,6137,144,168,3095,262,180,4785,145,0,5372,4216,175,3802,
+    3073,11,2985,4209,4648,196,2880,2636,2381,2403,322,5863,54,0,0,0,
+    2634,3000,0,146,5626,2875,2475,2771,2964,132,40,2007,0,5635,6782,0,
+    4278,275,2655,0,0,2636,2149,6232,0,0,0,3611,2855,3987,308,155,
+    3463,3338,0,3464,0,0,0,2619,0,0,3198,0,0,3040,2510,0,
+    0,0,6358,1886,4868,5194,3095,2453,95,3087,2085,2997,121,3611,0,2261,
+    3604,0,0,0,0,304,6021,238,0,2006,0,100,4044,0,225,0,
+    2937,2878,231,0,0,0,0,0,1914,299,180,313,0,0,4041,0,
+    3134,0,11,3381,0,2636,0,0,6032,0,234,6353,3216,222,3558,2560,
+    149,0,0,1763,6832,0,182,0,191,0,4445,3654,2886,2402,1808,2406,
+    176,2425,2558,276,2625,3074,3297,0,0,126,0,287,295,5030,7036,1633,
+    0,1604,0,123,2734,4457,4150,1980,48,240,279,293,2790,297,4565,2218,
+    1749,0,0,111,198,0,5712,3846,3786,300,197,3297,239,0,2781,3346,
+    3296,0,0,85,0,3647,0,0,0,0,2291,0,5188,4511,0,15,
+    3079,0,4426,4129,180,224,0,93,194,0,6295,3821,2403,4656,51,2647,
+    3304,26,3143,4534,24,39,188,4725,1706,4667,2432,1625,2022,171,208,214,
+    2529,3262,0,208,2530,304,1943,6509,5370,1905,2635,6477,74,2680,4429,120,
+    2779,173,3568,60,0,1887,3195,186,3284,191,3228,3559,6194,5756,296,2722,
+    180,2381,5966,3019,1971,74,1819,2668,2282,3435,1808,173,4908,267,5671,172,
+    56,257,6074,253,246,2600,281,1603,2922,1951,280,4086,5372,2540,169,3119,
+    0,0,0,2661,0,238,0,1601,0,0,2502,263,2235,189,0,3777,
+    0,0,0,0,1600,0,0,0,1604,319,0,169,0,3018,3084,2647,
+    5582,2870,221,0,225,200,5142,3282,3001,131,2743,2902,3162,6499,5590,238,
+    2909,0,0,0,5979,207,0,3565,5114,199,310,0,0,0,60,3830,
+    0,5554,2811,200,2657,0,4876,0,6074,2776,5186,3175,1698,2470,264,191,
+    120,2088,0,38,308,2699,3883,5757,3063,143,2006,3987,24,3183,5670,2624,
+    298,2733,3172,2919,2678,107,5530,4714,2611,2990,253,2562,0,3185,300,3683,
+    3496,235,0,253,38,2502,0,5003,3208,3316,2881,221,1919,5415,48,312,
+    0,0,3046,207,1997,0,2490,0,2479,2424,3161,3102,2967,2941,6748,157,
+    3161,248,2480,4667,2955,180,5537,2548,6230,6580,224,1609,6275,174,2645,0,
+    0,1610,0,0,2614,3051,3166,7036,2516,2123,0,230,169,5108,2315,2567,
+    5883,1602,0,2844,12,1603,0,310,0,0,2633,0,0,1919,3568,230,
+    4983,2008,182,1875,146,3841,3139,175,248,2988,121,1971,0,242,2607,2987,
+    317,2272,2028,2580,2832,5256,1604,3625,300,3336,211,6743,2083,201,2087,6245,
+    0,183,0,0,0,0,2491,0,3164,293,0,2472,2733,318,0,0,
+    265,155,2909,1602,2235,3051,2832,0,0,1609,3262,2526,280,0,241,0,
+    0,0,174,1992,2714,0,0,6301,3162,2612,0,317,2404,2920,272,3411,
+    2904,250,2209,241,2645,2550,4535,2536,252,3916,312,313,3348,2979,2532,0,
+    211,0,4017,71,2683,2769,0,293,3216,6352,0,0,0,0,115,64,
+    2681,3108,2876,3166,2505,3238,1908,0,7163,3164,290,2476,167,3064,192,4719,
+    6800,0,3441,0,0,183,0,5327,0,3268,2987,0,39,2998,5855,5536,
+    3221,0,4747,3548,4900,0,3030,3008,2952,2990,76,4907,3150,3249,257,3173,
+    0,2423,47,0,252,169,2724,3618,0,3163,2336,1742,52,3243,2537,208,
+    2766,3131,3222,3273,139,0,0,1951,131,240,0,0,3876,2734,0,2855,
+    4505,2788,3252,2336,0,318,216,0,6045,0,2525,0,2778,2933,1679,0,
+    2694,0,0,0,0,2611,2206,0,2371,0,2689,0,310,2710,133,0,
+    315,149,2689,292,4005,0,2745,0,318,315,0,2427,2342,98,222,223,
+    2536,1753,0,0,2831,95,242,2768,2780,2072,0,0,4565,2471,2205,3128,
+    0,4332,0,0,51,3239,75,0,194,4701,3916,305,0,0,0,2650,
+    4541,2548,3272,161,0,0,0,0,2448,0,0,1755,2634,2700,38,0,
+    3390,39,0,0,0,4946,0,0,4576,0,3668,0,0,2956,6186,50,
+    0,3020,2291,5811,1756,0,5371,159,5450,0,0,0,0,5976,0,0,
+    37,1768,263,257,289,201,253,2093,1680,1808,5088,0,0,0,5326,2878,
+    221,273,210,219,2832,3649,2512,5087,185,3239,73,4426,172,2149,2891,280,
+    0,5986,0,0,0,0,3085,209,6039,2292,0,301,5527,2820,3346,2809,
+    4306,2659,5966,6039,0,225,228,2882,2037,2744,3254,119,2501,175,2909,171,
+    0,2605,27,6315,109,4542,6024,0,6075,2569,267,0,247,307,4784,2567,
+    1913,5363,0,0,1847,112,0,0,2857,2408,3691,3066,2886,1819,225,179,
+    2525,1623,5256,0,2225,0,3296,2006,0,2713,4681,0,96,0,1603,0,
+    0,0,0,0,4939,6705,6300,4000,0,317,0,2963,5258,0,0,0,
+    3251,3646,112,2645,0,0,4656,236,0,2225,2711,6187,285,2600,2535,0,
+    2733,5150,310,292,107,4659,3276,2518,4206,2639,2913,3786,3263,3051,272,24,
+    0,1611,2930,0,4352,85,6721,66,313,0,2538,0,6680,233,192,2759,
+    6247,13,4270,237,2934,2910,1633,251,0,0,0,5538,108,0,2747,2493,
+    5536,0,143,2228,4287,0,64,3326,2691,0,0,0,0,0,206,3140,
+    0,205,0,0,0,0,168,2303,2557,2836,3095,2758,2672,4866,0,228,
+    307,5889,2491,1755,5307,3154,2562,4967,2902,2469,145,251,2824,309,3239,1970,
+    0,3123,3013,0,2301,0,170,0,171,5757,305,1888,2624,0,98,0,
+    3767,2083,3098,7272,3664,5868,1897,3119,61,1875,0,3682,87,3152,2876,134,
+    109,3152,2558,3173,1813,5334,175,3054,6203,3074,3582,2645,0,2943,3322,287,
+    0,184,0,277,276,2557,3172,255,206,0,307,0,1973,4701,291,2755,
+    0,0,2184,3586,0,252,109,5141,2406,287,282,198,310,1829,29,174,
+    2941,0,212,188,0,0,313,247,2615,1885,4932,5414,2559,3139,7238,2715,
+    2721,2721,3654,4941,2745,5089,1887,264,4516,0,2920,0,1699,1676,2985,181,
+    16,0,6415,214,0,0,3371,269,0,275,0,2875,2271,0,0,2646,
+    221,268,0,107,4225,2969,2788,2667,4426,0,241,0,322,211,2471,0,
+    4246,2930,294,2722,0,257,3062,1885,187,300,0,2154,1714,200,3945,2483,
+    2556,125,1810,3163,2427,3104,4707,2139,5819,85,62,0,292,0,3184,273,
+    1756,300,0,0,2965,2930,2953,2733,1847,2218,1819,3107,5756,281,288,2075,
+    97,4880,2888,4703,2989,267,2230,2858,2007,182,2908,5746,3197,1940,3434,2968,
+    0,205,60,2833,5141,2690,2878,4893,0,2493,0,5366,0,0,1602,7042,
+    2339,48,3183,5805,2821,2470,0,3045,5272,0,0,266,4349,0,3164,0,
+    0,3876,2302,301,119,3240,0,0,215,239,6732,5581,5977,0,2561,2623,
+    227,2138,4491,2846,7253,261,2905,0,229,0,5421,3172,2820,2139,2207,1623,
+    0,2010,187,248,2757,240,0,3795,228,0,0,2402,0,2711,2823,2772,
+    305,205,2735,194,203,2416,6194,2756,2623,317,3198,11,2603,2721,2402,0,
+    3009,0,1889,1691,273,4041,5527,0,1821,1602,3022,11,5088,284,35,272,
+    2726,1772,0,309,3021,4925,6296,184,0,1648,207,0,3999,1953,3250,3041,
+    3073,3293,0,0,131,2991,0,1608,85,3183,2600,2272,3056,2074,2524,218,
+    0,187,5141,317,2965,137,5916,0,0,0,0,5187,0,0,0,87,
+    244,1641,2666,47,3073,2086,233,2629,4051,2304,3034,4455,229,279,4872,0,
+    3274,2660,3294,199,274,1961,319,176,4042,2503,2754,5581,2360,1743,60,2672,
+    2656,0,320,3770,2589,3327,5691,2868,2006,2548,0,0,283,0,2370,3154,
+    2930,3065,1648,5145,4976,0,2567,0,0,0,0,0,0,2754,208,131,
+    0,4762,2838,3141,1854,5333,2559,20,4506,71,0,2809,1600,3261,1613,3316,
+    203,2965,3767,0,2834,0,6190,0,0,3272,15,2986,2932,0,0,233,
+    290,0,308,2667,5002,0,3242,2569,246,2976,2102,72,0,0,0,119,
+    212,2733,1608,193,5757,2051,1747,295,2820,214,0,0,2440,2833,1878,2337,
+    4868,3172,0,2683,6352,120,0,181,2935,2413,0,4530,2996,0,5316,2845,
+    3155,2525,0,0,0,0,0,199,0,3228,5539,91,4445,6195,0,2589,
+    2076,0,3109,2204,3305,97,2553,4206,3106,3202,2974,5526,3610,31,3786,3823,
+    320,3239,0,0,0,5481,2924,2704,3429,0,0,5803,2454,3711,5005,2974,
+    2516,0,2083,194,0,2482,2593,302,0,254,0,0,3239,4646,0,3613,
+    1603,3096,2271,1774,0,246,275,208,0,2535,4071,1905,0,0,2745,74,
+    158,2876,2724,5765,3196,0,0,0,1772,0,3273,119,202,294,3511,119,
+    0,2871,266,4426,2558,2270,1714,3685,2733,4431,5141,4732,2900,3381,0,3055,
+    40,3776,2766,0,5749,265,0,2801,2553,5127,0,1622,2614,179,1896,1604,
+    0,5036,176,4757,5141,5626,236,6186,3405,2923,262,5968,189,322,2568,298,
+    173,162,0,60,145,4553,6082,227,0,0,5142,0,179,0,301,5994,
+    6681,0,2271,213,3282,5316,0,2858,0,2942,201,1608,2536,91,2010,0,
+    305,157,2482,3336,3235,2551,2350,2571,272,197,5442,4090,3381,4660,5553,260,
+    2821,313,260,0,3462,186,0,0,284,2800,0,6045,2585,6268,5141,145,
+    2406,0,0,2470,0,0,91,2402,1754,0,3910,3262,192,132,3187,1721,
+    0,198,5986,0,1809,0,2997,5366,5967,5530,2591,0,0,0,3033,0,
+    3142,47,47,2526,2890,0,2985,1706,1607,312,0,1810,0,5606,3549,302,
+    2490,3087,0,2170,2655,61,13,194,4969,28,3073,252,2803,311,1819,4271,
+    2911,4866,2822,0,0,0,3196,25,0,5547,0,2204,293,1600,65,206,
+    0,2076,0,0,6414,2755,266,2428,5786,2309,313,125,5663,281,0,4682,
+    0,5146,1680,2848,312,2281,236,240,305,5590,4104,73,5599,1609,2611,2648,
+    3251,0,1904,193,2690,269,186,0,5363,2342,257,4005,2834,4746,1607,0,
+    2832,96,5827,2838,2481,0,3604,1678,2285,3110,5635,6295,3095,6294,2723,2561,
+    1600,312,2897,259,211,6394,2882,5097,3007,2755,2178,48,307,0,1904,3345,
+    0,3604,6194,2350,1951,2573,2622,249,0,27,0,2881,3606,80,3117,2404,
+    275,0,2512,286,238,23,2578,1886,0,2847,4680,0,1876,2435,0,157,
+    3295,0,2713,3185,2341,1742,241,0,4971,0,2138,0,5194,4713,0,2952,
+    1631,1602,2292,5373,2813,3851,281,2634,101,3034,2726,4993,3273,246,2833,0,
+    6834,3108,5547,6488,2283,4932,5451,2155,13,0,2710,235,297,2094,1606,212,
+    5527,83,6066,120,2547,75,4306,2468,2600,4227,252,198,3575,54,5556,0,
+    0,0,0,2642,0,0,2612,193,108,6393,3998,6888,5642,2908,2506,0,
+    0,0,0,0,0,2842,2810,201,3045,6030,2501,3768,0,0,3229,17,
+    5491,262,4562,2567,3261,14,175,0,0,256,0,0,2725,76,208,2340,
+    3183,2479,170,3260,157,286,4129,2919,2568,2932,62,2103,0,0,2645,1601,
+    221,286,5986,155,283,2944,2887,97,0,2110,183,6679,1886,39,2666,2570,
+    5748,122,3108,0,2625,0,0,188,0,318,2294,168,2674,3206,4427,207,
+    188,131,173,7015,259,0,228,2089,111,0,233,2029,23,215,2350,1679,
+    0,2666,2556,71,2624,0,3283,0,2479,2074,0,0,224,3086,0,2471,
+    0,0,0,3231,0,0,0,2515,295,0,0,0,3610,0,0,5416,
+    2793,247,2732,0,3077,3830,230,182,0,0,3777,2308,0,0,317,0,
+    0,0,0,0,0,0,0,2777,3779,0,0,0,0,2887,3124,0,
+    0,174,6360,6153,0,48,0,0,0,0,6232,179,0,225,0,6744,
+    3398,3030,2538,0,1604,3327,0,49,2601,0,3073,2889,0,198,213,4790,
+    3661,0,2205,0,320,0,0,0,0,4043,0,0,61,2690,2625,7277,
+    0,1895,3232,5590,4043,2805,2416,294,0,2997,2682,0,125,2539,133,6882,
+    2870,6031,315,3041,3044,4481,2527,3007,189,2073,3232,6581,5537,0,0,3315,
+    26,2710,227,5097,3838,2638,2369,0,0,1885,0,283,0,0,2888,2591,
+    2887,2470,265,4059,1681,239,307,5968,5226,218,287,3986,95,3219,6350,250,
+    4688,265,0,0,0,0,3034,6386,212,2615,0,3601,158,2691,0,0,
+    13,3316,0,3140,0,242,5818,1609,0,2880,0,5529,0,0,0,3063,
+    4647,0,6798,306,2523,4534,4647,3253,2919,2649,3030,4527,206,239,2612,2766,
+    119,5692,2844,2470,0,2545,5319,7118,4026,0,112,0,2580,4440,2820,0,
+    2765,275,2793,320,7008,6066,132,305,0,115,234,2953,1811,2590,0,2156,
+    3184,6000,0,0,5310,278,182,3574,5606,2802,1679,4649,243,210,2656,2058,
+    315,5167,172,4926,0,2529,2640,163,248,4715,2403,0,0,4818,0,229,
+    2997,2695,4309,0,209,3767,2859,265,263,197,3041,274,3840,3308,5862,4241,
+    1684,131,318,2760,3163,0,3097,5813,3208,2733,6399,1605,3150,5379,0,2383,
+    193,193,4228,3340,0,2745,3434,191,2953,2733,4020,3263,135,3283,6750,0,
+    0,0,5932,3184,4481,4894,6386,2744,0,0,64,3024,2701,2922,155,0,
+    306,2668,0,254,3283,67,2604,3338,0,107,1604,0,161,2986,4967,3249,
+    239,0,0,1606,3548,0,0,262,4702,0,0,4686,134,297,0,3026,
+    6202,5767,3309,3319,1601,5240,174,2853,220,0,5775,205,2751,2798,0,294,
+    2941,2509,16,2834,233,2879,2677,67,5801,1829,132,222,6230,0,0,0,
+    4206,1612,3042,30,4306,2552,1920,288,0,2876,3064,4006,0,7093,49,0,
+    3229,2953,0,3139,5537,5776,59,3222,2634,0,0,96,1810,0,3619,0,
+    3070,2637,1605,3021,0,310,2580,2963,3295,2139,0,3690,2876,0,0,1626,
+    245,0,213,316,0,224,0,147,2941,176,2612,272,237,2492,241,2646,
+    3582,4731,0,1680,2472,0,2669,3184,0,226,0,2989,0,4207,4022,2646,
+    0,2948,3283,278,3216,0,3208,4938,0,0,0,0,1677,2886,204,3490,
+    4646,0,270,0,2501,2645,2960,240,0,0,284,0,224,6023,2404,49,
+    2558,226,0,4211,2850,0,1781,6679,2573,193,302,0,2531,2309,2006,3000,
+    1601,2590,0,1624,0,0,4130,0,2666,0,0,100,121,310,318,265,
+    0,174,3041,2777,0,0,0,2810,1809,2481,3137,3063,1745,3262,3601,1743,
+    0,0,0,5150,0,0,2897,4630,5096,2880,0,0,188,5628,0,0,
+    284,0,0,0,3162,3382,4537,3056,1617,2491,2322,0,59,5101,3306,0,
+    3040,0,5086,148,3390,5867,189,84,0,0,232,6798,2997,2568,5379,0,
+    120,0,0,0,0,4437,2340,5757,6610,0,0,270,203,1733,4879,3989,
+    259,155,4750,2475,171,3097,5995,305,2570,2018,4658,52,2843,0,5087,3249,
+    2964,4491,6300,2185,3286,3062,5529,3197,144,3063,0,176,175,3870,5831,0,
+    2093,0,1631,2103,199,85,3205,0,2826,2217,5611,2912,13,1810,134,36,
+    5802,160,310,49,4528,2414,3161,4535,182,173,5507,2506,2967,2338,3080,229,
+    222,208,75,213,4265,190,1613,1602,0,16,263,2739,263,305,5088,2749,
+    2791,144,0,0,2204,0,2484,157,158,0,3134,0,0,158,2989,5143,
+    290,0,2831,0,3328,3064,3284,2724,1952,321,3163,313,36,2514,239,0,
+    4129,3151,0,0,2540,2468,3196,4051,2644,267,5232,265,3631,83,5158,2578,
+    2668,2284,317,196,197,309,2160,196,3007,4718,3098,2178,5327,2898,2987,303,
+    0,4547,0,0,0,0,0,0,2903,261,0,39,0,0,2759,262,
+    0,2271,1602,272,2755,184,218,0,0,0,3169,0,0,0,5811,0,
+    5166,0,2600,1687,0,39,4647,270,235,113,2338,3910,0,0,3174,2072,
+    88,2634,4702,2491,2481,5316,2502,220,2779,5528,3346,0,2613,3141,304,2998,
+    2919,246,267,1678,2104,2075,0,0,3547,1940,2721,266,273,87,2627,0,
+    3239,2747,2568,3317,0,95,0,2517,0,0,0,182,5370,0,4591,2783,
+    0,3612,318,0,39,0,161,5088,2482,2141,0,212,0,287,258,3129,
+    176,0,0,0,0,263,4648,0,5801,5818,2154,2735,2857,0,274,2724,
+    4461,191,2813,0,2471,1677,2572,249,2875,5416,305,223,250,40,145,3000,
+    4646,1763,2990,27,0,2077,2801,2886,41,2273,239,6084,2413,3610,0,186,
+    0,0,171,2215,297,2567,2745,84,0,3057,0,2975,0,0,0,2886,
+    0,175,1718,1973,125,0,260,4212,0,0,277,193,1611,4885,0,0,
+    3109,1912,2505,295,0,3490,2614,3076,213,60,4939,3031,2678,0,255,2870,
+    57,185,275,2506,1676,1765,6256,170,3267,6387,3026,2704,108,2856,3651,41,
+    2604,0,3095,5855,0,0,6267,3649,227,3382,223,145,119,3328,0,1885,
+    0,0,0,2447,1971,2783,1887,3021,280,2493,0,3183,2963,4646,221,3084,
+    4316,2624,0,0,6479,0,2375,284,0,231,0,5806,0,203,0,0,
+    3436,2669,0,27,2757,3129,0,2402,2969,2625,5158,0,0,0,2988,48,
+    3295,4705,3074,6753,217,0,4445,2604,132,3088,11,0,3218,2765,234,2526,
+    2534,0,4216,2903,2944,2160,281,4930,3090,6509,0,3999,2570,5099,210,4648,
+    6021,294,2490,3041,214,2868,0,1613,0,0,0,307,2093,0,0,3318,
+    0,0,1701,227,0,37,0,203,0,235,3152,0,0,0,0,1793,
+    0,4454,5086,3161,72,0,62,0,4931,0,0,4527,2674,0,5993,0,
+    2919,6021,310,119,156,3085,0,5803,5832,6188,0,0,0,0,171,0,
+    0,2570,2771,6239,0,0,4209,2987,2789,0,5969,3209,0,0,0,5857,
+    0,3436,5966,3400,0,2505,2159,0,0,3062,2503,0,229,2614,2843,182,
+    0,2337,59,307,2574,0,112,0,1691,3831,0,2044,158,283,1746,2362,
+    0,3088,3194,0,0,0,0,0,2854,0,0,246,0,2965,0,5801,
+    0,47,0,0,0,5976,0,5092,2754,7223,0,257,1764,0,2710,3832,
+    4456,5406,2766,2402,0,0,6305,247,2368,2283,4575,209,5222,223,0,0,
+    0,0,3163,175,108,5052,1607,183,0,0,259,24,2956,3128,2712,3299,
+    0,2514,3073,6805,2215,1920,5591,0,0,109,2536,5548,272,158,0,0,
+    0,5988,1885,0,3177,73,2105,251,5966,155,258,23,0,0,4657,0,
+    0,0,5582,0,282,131,2878,2468,214,0,2084,0,0,2833,0,0,
+    2964,2794,0,205,2690,2602,240,2644,1743,2906,2490,5114,228,5536,36,5142,
+    0,2483,4895,170,4675,1608,2357,0,1838,0,3173,0,3988,4491,6577,3348,
+    60,3988,5966,51,0,2866,2271,0,83,269,2494,4263,0,207,0,170,
+    1742,1768,272,3131,0,240,2996,59,4870,2733,182,2485,110,138,220,3217,
+    5599,2302,1942,1601,2799,3655,45,0,79,282,0,2423,0,131,0,0,
+    2503,5449,1677,1729,4315,298,151,2831,2515,3793,221,4021,0,0,6030,0,
+    241,1951,5581,107,2639,3874,2469,0,98,2965,2406,2073,5309,297,1745,25,
+    2864,0,0,43,235,258,2809,201,5861,145,2671,1885,5141,4370,71,2540,
+    4938,3547,146,3051,84,261,196,259,71,2744,123,1609,254,3032,3168,2727,
+    0,66,0,0,314,4667,0,0,2699,298,6912,3845,296,3152,2886,206,
+    1600,0,291,2878,0,2943,5051,2755,4756,220,6006,5970,2964,112,5333,3084,
+    3611,253,3271,2964,281,270,2204,184,1621,13,0,6478,0,5015,0,167,
+    2736,283,3043,1780,264,3040,1879,13,0,157,3337,0,136,2633,1601,3230,
+    3881,5583,2539,155,3591,0,2948,1631,2689,4156,201,318,3198,307,3186,210,
+    2534,35,2625,7021,0,2347,2481,4537,192,0,0,1962,3249,0,2765,6320,
+    2204,0,5626,3398,2602,2875,3052,3163,5536,0,6030,5801,0,180,3780,2011,
+    301,0,0,2716,122,229,107,4213,0,2891,0,0,0,2966,3199,3122,
+    47,71,2875,3040,4527,4006,3263,0,3988,6210,0,2051,7281,5895,0,1853,
+    49,0,50,201,0,0,2143,293,5317,2702,4749,196,2822,195,3052,1765,
+    3305,293,0,159,2011,264,0,2931,3208,0,182,0,0,2872,0,1602,
+    1702,1904,52,3990,2490,35,2403,4372,170,1603,4273,4505,250,237,310,171,
+    0,4271,4658,0,2770,2699,0,3088,37,4499,6499,231,2308,209,2217,2488,
+    0,5819,0,2545,249,5091,3052,219,0,2102,0,2512,213,6683,280,0,
+    3442,6074,251,2638,0,0,0,0,0,5362,6498,0,279,6680,2255,1829,
+    193,110,4428,99,0,315,119,0,2800,179,2204,0,84,302,243,0,
+    2668,0,3654,225,3106,204,1609,2084,4680,2721,211,0,3286,2930,312,3186,
+    0,4502,2347,0,2407,1841,2935,0,0,0,290,3839,0,2006,290,0,
+    0,2117,24,5662,0,0,2842,0,0,219,0,0,291,0,2600,0,
+    5846,3398,1979,0,0,2569,139,6888,0,0,156,0,0,2661,2483,208,
+    3260,6031,2074,0,0,0,0,6799,0,0,3084,2504,2941,0,5167,0,
+    0,0,2956,147,131,2234,241,3011,3140,2946,0,0,0,3318,205,2578,
+    4490,1602,0,0,0,262,0,4748,0,2469,0,0,2140,0,320,2909,
+    269,3293,2013,4467,35,0,2402,0,0,0,2783,0,0,3130,155,0,
+    0,3304,0,0,3166,0,0,257,4646,0,1606,0,0,5340,317,2535,
+    1605,0,1605,2736,294,263,186,2494,2820,5846,299,2887,2866,299,83,7020,
+    1604,305,1607,0,307,4233,3941,0,3306,2010,1896,194,2348,3021,0,2139,
+    0,0,182,1874,0,232,0,2646,0,36,1635,2515,0,0,2075,4225,
+    186,179,0,262,291,6805,3306,312,0,4867,2525,275,2545,0,190,302,
+    4867,73,0,0,131,12,6470,0,302,5810,1795,0,0,2231,4095,2743,
+    5526,3140,83,6806,3690,236,85,203,1602,3315,222,2714,6504,155,3084,3308,
+    265,3767,1706,2723,0,0,2512,0,311,0,0,0,199,261,3053,2765,
+    2634,195,3177,5321,0,0,3217,291,2957,0,2074,4446,2348,259,1600,1614,
+    291,2748,0,2215,267,277,1688,4481,0,3293,5891,0,0,1876,0,2357,
+    6687,265,184,2027,4930,2934,3186,297,3273,2351,3381,2019,310,258,298,95,
+    2503,2416,95,3183,3390,221,5363,248,62,219,222,6252,3326,213,3777,0,
+    0,4747,0,2827,2357,302,3086,4975,0,252,6081,299,0,214,0,3997,
+    0,0,3227,0,1951,0,0,0,0,2878,0,315,176,194,2801,0,
+    5647,63,0,168,2812,2844,1678,3282,0,3493,2921,3338,3249,0,0,3304,
+    0,4208,4156,2877,0,0,0,285,1742,2637,2754,1722,5097,3547,5442,0,
+    6801,280,5854,3052,3218,3065,139,6371,5086,2611,322,5443,5086,3007,2293,0,
+    2747,2249,205,2787,248,0,0,0,2513,0,2978,0,0,2479,0,0,
+    3285,0,36,0,2679,4490,0,0,0,3613,0,5748,4427,2996,2834,28,
+    124,286,3184,2205,264,1650,3029,5766,2776,3023,3085,2770,157,310,3086,226,
+    2823,0,6245,1615,208,192,0,235,2963,3150,0,1662,247,2579,2952,4974,
+    270,2952,2728,3832,5529,3040,6195,3931,3130,3228,1951,84,259,36,3930,174,
+    1609,6220,224,6076,0,209,0,2204,3154,222,2850,1699,137,2875,2943,2628,
+    248,0,3142,182,2755,3032,5443,0,288,293,2225,227,5970,3683,0,2898,
+    0,4381,0,4930,0,2882,227,0,308,0,0,273,0,0,0,2626,
+    0,5825,1753,1942,0,0,3295,3996,0,272,5143,0,0,0,0,0,
+    2416,1819,2611,2321,0,2006,37,4211,5307,0,2350,317,2952,6231,4870,0,
+    2936,0,181,5628,193,0,2349,0,0,5153,3288,0,0,39,0,4217,
+    277,222,1957,3261,0,4278,310,0,0,0,0,0,122,222,3088,0,
+    276,0,0,2834,50,0,7011,2735,0,3041,299,3217,4674,3328,0,2310,
+    220,0,2469,3133,2856,297,0,0,4701,1607,308,132,0,3118,4646,3194,
+    5819,133,2626,5141,6555,6373,0,4564,4217,0,5749,4975,231,2919,6102,0,
+    1953,2469,2733,107,24,227,3874,3768,6535,2019,4207,4977,15,71,1687,253,
+    5113,2749,1829,0,3294,0,2633,0,0,5967,242,2639,3183,2725,318,0,
+    0,3079,0,0,6045,0,2587,2207,84,19,182,2340,5756,2549,1808,121,
+    3345,2732,312,25,4885,257,5316,2038,5769,2535,6023,0,2758,2638,0,179,
+    3238,0,178,2683,0,1887,120,23,2777,4984,0,2837,2696,3273,3239,2813,
+    3618,23,0,3030,1601,0,0,0,0,2898,3273,0,216,0,2501,264,
+    0,1847,192,0,0,3087,2635,0,0,0,2622,307,2853,0,3040,1600,
+    0,0,4482,182,0,2017,2150,2953,5527,273,0,3224,2700,136,251,3661,
+    37,0,1819,5306,2633,143,0,0,2255,243,2782,5407,2845,3261,0,0,
+    3298,7222,0,0,119,3250,0,291,4428,282,0,2626,6352,2491,2600,1944,
+    0,2088,204,3788,0,5855,0,5767,0,0,5749,1830,3996,0,0,2547,
+    297,0,3004,0,0,2668,0,0,0,0,2007,0,0,3073,0,0,
+    5415,317,203,206,0,3020,0,2823,4876,5187,306,0,2934,5362,2141,283,
+    0,0,2875,2561,0,5766,250,2078,2343,15,77,6315,192,0,1896,76,
+    0,2970,250,5194,2985,2857,4938,154,0,3892,5605,0,1808,2634,0,0,
+    6186,60,3391,0,1744,184,6082,3390,0,0,0,3327,13,2615,3307,176,
+    1961,6716,4893,168,0,0,5757,2559,255,2561,2272,2855,189,4846,3206,0,
+    0,2546,99,0,5746,5750,2234,3098,4658,1603,3062,3078,4721,4740,1714,119,
+    0,0,0,0,0,5662,6156,2468,183,3766,0,3787,50,6689,0,0,
+    224,26,3793,2502,2868,3183,3649,1961,2009,261,51,1607,133,207,2571,0,
+    4885,2787,1608,1604,0,60,2747,3018,0,2824,3304,2865,0,48,0,0,
+    2831,2568,0,260,0,2844,0,12,0,0,0,234,5327,144,4701,280,
+    0,0,176,0,3205,269,2272,0,0,4989,2860,229,87,293,0,4893,
+    176,0,234,3587,2704,6470,5890,11,264,3051,0,1680,0,4658,216,23,
+    0,2778,0,2556,1830,0,1793,0,246,276,0,303,2162,0,0,4447,
+    1914,1876,216,3271,3205,1601,270,2975,0,2496,3139,254,2572,183,0,2514,
+    3230,2686,0,6716,3565,2908,211,0,0,236,0,308,5529,1764,120,0,
+    0,0,0,2006,179,2564,213,2177,0,0,2083,2341,59,188,1605,2520,
+    0,2085,5697,5306,3130,180,268,0,5765,2666,4006,192,3174,2047,202,0,
+    0,3345,3277,187,173,0,5537,3119,3067,316,3064,3012,2537,220,2788,3136,
+    0,2931,2888,0,255,3044,2908,190,0,2613,84,5325,2045,173,285,4681,
+    250,2812,2943,0,0,3390,2877,2957,2293,257,0,3055,250,3331,135,2308,
+    1951,4206,143,2655,249,0,0,26,2415,4021,239,4665,0,4894,6039,119,
+    1985,170,4321,225,2600,2512,5987,2601,218,3988,1603,3068,0,0,3023,2226,
+    2987,2842,0,13,0,119,0,2954,198,0,2623,0,0,0,3194,0,
+    15,2403,3399,287,36,250,87,2520,5820,3085,0,2513,2788,2434,0,6473,
+    4171,0,2535,0,184,4674,7015,2986,110,3887,2368,5757,3285,2671,0,1609,
+    12,0,275,0,238,0,0,0,0,0,0,318,1913,36,2539,236,
+    0,2800,77,0,4756,314,4659,0,6021,3130,2605,1608,2726,276,234,0,
+    186,217,276,208,2152,240,266,2671,35,1602,0,2937,5803,2899,3601,3786,
+    0,184,0,6388,0,2413,202,2504,5756,3012,3131,1885,0,2967,221,3062,
+    61,1742,0,155,278,4975,2589,0,2600,4924,2008,132,5591,215,1600,3336,
+    4680,2644,2515,3085,75,3381,193,1716,1819,0,7166,0,3128,2494,204,210,
+    3161,3548,3196,4966,5791,0,0,1952,3690,260,2338,0,2482,6191,2802,36,
+    265,172,0,3264,0,270,2361,1821,73,3989,5627,2006,1876,2777,2732,6220,
+    3000,3179,3250,3768,2447,292,1678,2027,5476,2832,2557,307,213,239,170,1633,
+    0,3045,275,6136,276,1601,0,0,2809,2897,4209,0,0,257,0,0,
+    2216,0,232,201,0,0,217,320,0,191,5165,193,5005,5747,122,1896,
+    0,3208,4816,0,4426,5115,271,136,2985,3205,73,3030,304,1687,95,4870,
+    0,2811,2935,176,6883,299,1603,259,1808,3018,2471,0,4052,2635,224,3655,
+    3117,4066,0,0,49,6591,2897,4769,0,217,0,0,66,0,0,0,
+    4234,4427,264,2965,0,0,241,0,2835,3117,0,47,267,3076,2985,2975,
+    0,228,27,6680,39,3034,156,0,4659,0,36,303,1951,5562,204,2093,
+    2713,2282,208,5222,182,3139,3393,103,5821,290,298,2234,1808,2623,2680,4135,
+    3139,3206,6230,3998,2944,5896,62,37,2471,66,2909,2974,312,234,3084,4646,
+    3648,3154,307,1944,3008,201,289,2691,2978,5627,263,1602,5916,4710,4436,183,
+    2674,0,0,0,246,3249,2368,2977,3029,2557,233,2502,2074,2347,2044,4648,
+    6884,2321,3306,126,157,2966,2974,0,2765,2639,0,4071,2204,108,3393,0,
+    155,3206,71,0,75,47,5773,4710,0,3018,2547,2423,5325,5276,0,2765,
+    107,227,5931,230,3838,0,296,297,3029,5098,254,5626,303,51,6002,4432,
+    3326,292,2110,1655,281,205,3172,3326,5801,2590,3272,0,2749,5460,288,195,
+    2204,0,5427,176,273,1811,3272,297,3636,0,1607,1810,0,2732,0,262,
+    0,1841,6267,1652,3282,200,0,6021,0,0,2480,173,0,2770,0,3731,
+    0,3154,0,0,0,2273,0,2359,0,177,4703,0,3462,0,2756,1745,
+    0,0,0,0,0,0,0,0,0,6714,3770,0,3073,0,5158,5307,
+    0,17,0,0,2820,0,172,3195,283,291,2992,0,0,0,0,0,
+    6275,0,0,0,2963,3009,0,0,2567,0,2679,281,2732,0,2954,242,
+    1962,7242,3284,0,0,2605,6039,2809,287,271,85,0,2843,5333,0,2721,
+    0,0,212,0,0,226,2229,0,257,5443,0,0,5528,84,0,0,
+    2578,1655,4868,2744,2590,145,0,3251,278,2527,0,0,2661,0,0,204,
+    3051,1717,3120,2311,3018,220,2843,2871,3716,0,3197,0,0,0,3866,2271,
+    291,2689,2635,65,0,0,2919,27,2867,2655,95,4291,0,296,2168,0,
+    3293,0,273,6365,0,2967,2677,4059,2503,0,181,24,5150,2766,23,243,
+    0,3339,0,0,3327,6186,0,5773,0,100,0,3283,184,146,0,2358,
+    2183,2897,3216,2568,2766,271,3263,2123,3293,6435,77,2493,3021,278,120,133,
+    3173,0,2666,0,1899,5976,0,5626,0,3296,262,0,203,0,231,1904,
+    1746,314,5306,107,212,3252,0,0,3018,2085,2358,0,0,3382,0,0,
+    4686,4054,2860,3308,75,2615,0,1809,1678,214,2964,2739,2831,2758,209,247,
+    2469,2339,0,0,2669,3382,2671,2102,3128,1952,2941,6245,83,194,2493,0,
+    249,3057,1787,17,1820,303,2711,0,0,0,2351,0,316,2637,0,3097,
+    0,0,193,0,184,4868,0,0,4221,233,60,0,208,2626,0,0,
+    2206,98,5306,1605,49,170,4482,3065,197,2767,3776,4658,3139,3156,223,3063,
+    2281,139,3040,287,65,4044,1606,3293,2074,2546,6827,4746,3031,0,3866,2736,
+    62,2605,322,2985,0,5342,3315,1608,276,14,296,43,254,4750,3096,0,
+    2606,2812,1640,3219,60,2072,2589,3251,322,277,1603,3475,0,5756,0,2072,
+    2470,4130,96,2771,6076,7252,5605,4043,11,2732,2480,4460,4530,2941,2514,298,
+    213,2472,2933,249,0,0,204,224,5256,6121,0,5091,1678,1657,2635,5378,
+    277,262,259,2677,143,1610,4867,4536,5422,2217,5142,4314,187,5196,195,7036,
+    4150,2765,274,5527,6197,2920,2523,5386,1621,2496,6742,1611,2645,199,211,279,
+    0,0,1607,237,2558,3326,2985,127,6022,265,2626,202,2578,49,3085,3462,
+    2834,2953,3004,3548,2548,108,2945,0,3559,3284,261,6764,245,3278,3989,131,
+    2766,0,3018,2404,201,3251,3205,221,1961,3851,2847,6038,3988,3851,5096,2523,
+    0,2275,3336,1707,206,3391,0,222,2781,0,2244,0,5598,5747,245,2338,
+    1745,193,1692,2688,2032,2578,2625,2479,1766,0,170,0,7014,2053,5993,5773,
+    4923,3051,272,2680,2238,72,5361,2556,0,0,4869,1609,319,2635,1970,207,
+    2083,0,2622,6209,3874,315,2093,3475,0,0,2886,0,85,2102,2556,4122,
+    133,0,0,224,277,3661,4876,0,4296,0,97,0,4101,1753,0,215,
+    0,0,146,0,3078,3251,1874,2501,2901,0,4396,1676,1609,2849,4900,200,
+    2679,2249,5696,0,3217,2168,2864,0,2546,0,0,2613,3117,1631,3096,176,
+    0,0,0,169,2886,2934,2490,1819,5553,4427,4656,5011,0,138,2491,2516,
+    2800,0,193,0,0,179,179,0,1943,2513,4492,0,0,2857,2846,0,
+    3048,264,5805,2913,0,5371,289,2647,2703,2150,2442,5759,4157,168,6186,1763,
+    2579,4921,255,0,6109,238,2736,264,1701,6400,5831,4218,2144,13,200,2074,
+    2480,0,0,4966,1614,3199,0,174,3031,5599,3097,198,1905,305,170,2937,
+    0,85,2744,4597,99,3131,1753,297,250,0,291,0,0,111,280,2831,
+    3695,2443,0,0,2963,174,0,0,2537,0,0,3229,6133,1744,0,3084,
+    0,258,208,0,0,0,1627,188,0,0,299,2104,315,0,2540,6893,
+    260,6420,6066,3806,243,2977,2219,2349,1605,1600,0,0,3265,207,5590,176,
+    4552,73,315,25,6000,1853,2295,213,0,2658,200,2688,5341,4970,5306,1824,
+    0,3845,35,2661,268,3284,3075,0,2985,1600,309,0,4271,149,1839,6365,
+    4013,4674,2975,87,5882,72,2645,0,3300,2491,6186,244,96,2110,11,226,
+    2524,4703,2473,286,2661,4900,309,4236,2475,4756,107,2613,3846,5546,2647,237,
+    235,2747,5362,2712,2688,2644,2887,2594,3830,2563,3008,3130,2919,4974,2556,1609,
+    36,107,257,2569,2930,0,0,2925,2087,5605,6687,5978,5634,242,2514,0,
+    230,2844,0,2501,231,26,0,0,3250,2623,0,0,1677,3119,215,275,
+    3042,2934,2856,0,2743,6798,178,1743,2985,0,2636,108,5889,2559,167,318,
+    2285,3033,206,1980,0,4308,0,1608,313,3018,3032,4879,5032,2403,0,0,
+    86,3330,2658,236,199,2968,0,206,36,203,3140,2897,312,269,3022,0,
+    2737,3252,0,1985,2613,206,38,2655,228,3610,264,2688,273,1951,245,2868,
+    1875,2415,4045,2183,1655,0,178,250,274,3216,5846,3187,0,3673,2933,2272,
+    4438,2579,2536,2612,2072,2758,2667,2622,4292,4321,2756,2865,7149,2468,26,1833,
+    4680,5416,2711,3276,2633,2590,87,6715,0,238,2206,288,2854,2633,0,3390,
+    2767,1746,62,2773,0,0,0,0,0,0,2518,1962,0,2799,145,2075,
+    253,122,2548,218,4885,0,2930,0,6883,1811,1614,6067,0,1609,0,0,
+    2048,235,3118,2495,2602,7411,2567,236,0,0,0,2057,290,2987,2733,96,
+    6235,192,2497,4921,2974,3427,2772,0,35,3902,300,3684,2652,2932,287,2834,
+    1897,1946,2059,215,4704,2590,2667,1697,2369,3018,2831,2848,6778,2657,6202,2468,
+    195,2864,71,206,2578,223,3888,1896,3618,2178,3142,2866,146,4900,2868,4746,
+    2692,1648,1809,192,3785,257,320,2559,250,191,3393,2601,184,308,4967,208,
+    4746,3183,4207,3434,5901,1774,0,2440,0,3176,0,3469,2227,2789,0,0,
+    301,2613,0,0,2825,237,5087,0,0,0,2788,1680,2602,0,0,201,
+    3111,0,2349,0,248,1634,5528,2492,205,2899,174,0,0,0,0,4948,
+    311,0,2440,6400,254,247,95,201,2281,3284,5598,1830,5854,2470,2235,0,
+    301,2865,0,280,1602,2073,2349,4704,0,0,1687,3987,2636,2908,0,238,
+    3996,4668,0,3941,0,4455,188,23,62,36,0,1637,0,261,0,158,
+    4773,0,185,1613,293,0,0,2769,3250,0,249,133,216,2408,3284,38,
+    184,6701,2537,1677,2403,4217,74,2788,2512,0,3881,1978,5811,198,2998,4216,
+    95,231,1772,1754,0,236,2622,3119,274,0,0,4309,0,0,5882,2735,
+    0,0,3194,4513,5087,221,5421,196,0,3186,3221,305,26,0,0,143,
+    0,259,0,3062,0,0,2625,0,3037,0,3150,0,0,301,2723,2689,
+    214,0,2836,3238,4261,2545,260,2954,172,149,3118,5372,1603,3252,5787,315,
+    0,3299,2403,3205,0,0,3095,305,2602,0,2151,1812,6132,4086,3152,0,
+    0,4646,5582,0,272,1956,2504,0,0,0,0,3661,179,0,2941,3831,
+    4210,0,0,4931,272,3317,4542,2866,250,3434,0,155,5194,144,0,1952,
+    189,0,0,2413,0,2989,2946,5548,0,2646,3260,216,208,5750,2985,6021,
+    191,306,2504,5638,6023,131,0,2301,2546,208,2149,254,2899,2616,109,0,
+    0,3436,213,3605,168,2542,2469,260,3902,3310,195,2846,0,2217,1954,134,
+    233,0,2957,2845,2798,4427,292,0,2646,0,181,3095,0,2655,1607,0,
+    2453,2611,2870,0,189,2941,0,196,0,0,0,2622,0,2899,180,0,
+    224,0,0,0,0,0,250,0,0,278,6232,2803,7342,0,2745,0,
+    1714,213,7009,269,0,3218,0,0,3218,17,1754,268,0,0,6033,2655,
+    0,3318,3206,3183,0,0,0,0,0,0,0,4165,5086,6034,321,6232,
+    4066,2516,1887,180,3040,1714,3767,4427,0,0,0,0,2615,5527,196,3197,
+    2712,267,2105,236,3164,4710,2875,2867,3264,2745,3035,2647,263,4703,3239,2736,
+    243,1755,3018,0,2601,5186,2887,0,2358,190,4647,0,188,86,2037,0,
+    3711,246,2838,0,0,62,4877,266,0,0,3042,2149,52,4866,0,2667,
+    229,191,2888,0,1609,3011,211,296,0,0,4810,0,0,2652,2857,282,
+    2582,0,0,3018,3062,5379,0,0,2557,3121,208,268,3128,4747,2831,272,
+    3174,2955,116,27,119,50,264,4050,289,2701,3099,3293,242,2942,2840,0,
+    0,4373,0,3100,3191,0,2281,2007,59,0,210,3186,291,207,2745,0,
+    0,272,3362,0,7103,0,4324,3239,2878,0,0,0,316,0,35,3040,
+    2701,0,27,2814,2017,32,2831,0,0,2963,5150,1971,5472,6301,0,3601,
+    0,6186,3029,0,0,6426,47,0,189,0,2479,86,5152,0,3227,304,
+    0,1607,2139,122,0,172,247,2611,2006,2898,1748,3326,23,2529,3263,6903,
+    246,4102,3271,240,0,2700,1821,322,3242,1772,0,0,0,0,182,4015,
+    5630,252,321,4356,3336,6230,4225,205,0,1601,160,71,6560,0,0,0,
+    5811,132,0,0,119,3860,261,209,128,5539,0,260,0,2470,2942,6194,
+    0,295,0,3684,0,2801,0,0,240,4894,170,3511,0,0,0,0,
+    0,3054,5328,0,0,0,0,5968,6104,179,2778,0,5334,2170,219,99,
+    0,73,0,2502,1608,3874,3036,2358,3066,1978,0,0,1755,0,284,3559,
+    0,0,0,0,0,0,43,2382,0,4720,1603,0,0,2360,6722,0,
+    131,2284,2988,6266,5362,313,3546,0,2358,113,0,0,197,2832,4246,212,
+    0,2083,0,0,3128,3480,0,0,61,0,3037,5768,0,0,2072,0,
+    3183,208,1877,2603,6110,2833,120,223,233,2569,276,318,2688,2944,2855,6903,
+    3682,25,0,263,2350,0,3032,0,2545,173,4974,168,244,0,5986,3062,
+    6039,3063,143,0,0,2545,0,3867,0,246,0,0,2766,2601,0,0,
+    0,304,3140,1829,2934,232,0,2275,0,1642,5967,0,313,0,0,1605,
+    0,2691,288,160,2944,0,3309,0,6480,2857,2658,110,2557,171,1649,2679,
+    303,136,4866,212,0,0,248,2710,1942,4746,293,0,294,224,0,1607,
+    2877,3576,2507,2138,245,4776,2117,5848,3307,2700,2645,3150,85,2988,193,2561,
+    3254,5165,72,1953,246,281,52,2205,182,277,162,2821,3140,2568,4887,3821,
+    4811,3444,2551,3427,2138,305,4498,2227,215,5585,133,184,187,2505,4885,2479,
+    2690,2490,275,42,2076,5086,3430,1707,5600,271,5582,29,5882,4453,3326,2530,
+    4216,5151,223,269,2072,2561,4333,2952,5756,2468,2469,4210,5371,5641,1971,287,
+    220,2820,5312,2680,77,5334,2515,2440,2976,2890,4868,0,0,0,272,3161,
+    272,0,2622,0,4041,2590,252,0,2836,167,2614,4772,2845,4015,256,2669,
+    0,2260,196,2903,4733,0,3185,0,210,3155,0,2242,83,1707,5760,4492,
+    4887,267,0,2821,6477,99,3098,0,0,83,0,249,0,0,0,0,
+    2974,294,6294,275,4041,3768,3316,2205,0,3435,51,0,247,0,37,0,
+    144,5802,2093,135,40,4512,6007,2634,2414,3184,3029,4527,0,0,228,2490,
+    6749,0,6354,0,1631,0,0,1602,2736,0,2999,2776,188,26,0,1603,
+    2159,164,2667,222,3095,0,4270,4262,0,0,2645,2602,0,1784,0,0,
+    0,0,272,198,3231,2689,0,0,2695,6847,4053,174,0,5636,2853,0,
+    1808,2123,2988,202,0,1811,0,3018,4570,294,0,2027,2512,320,2890,38,
+    5308,3150,0,290,2746,319,2790,2649,3260,0,1714,2883,4711,198,1808,59,
+    2112,5966,6748,191,0,6714,227,3574,168,259,216,2732,2831,0,146,3162,
+    295,1677,1697,2722,2757,270,2501,3195,225,1754,0,5273,1962,3558,2415,274,
+    6478,200,2402,255,2366,3990,7148,1698,245,2778,5806,1961,1707,206,200,2636,
+    4225,173,3098,2744,3787,1748,85,5201,282,1603,2472,2855,2865,2766,2782,298,
+    2757,1614,2994,3109,309,2853,3283,1754,182,2580,1829,274,4876,1802,310,2149,
+    268,2075,5037,1600,4252,0,2601,156,0,264,4023,3868,0,0,24,2236,
+    3910,3777,2875,3084,2084,3073,1896,1702,2614,3238,2338,1609,2019,314,218,3078,
+    71,3156,2637,2359,0,0,4656,1601,3426,5002,4314,169,0,3274,0,1898,
+    2623,4050,3381,0,2655,5386,146,3087,295,254,29,6358,204,292,1625,2704,
+    0,6300,0,144,5306,0,0,3095,2878,2075,229,1993,0,0,60,3999,
+    2336,2934,2589,3118,2504,3610,7022,2468,260,5036,2303,2657,6832,2869,192,6247,
+    5476,0,321,4832,272,2205,4485,1662,6554,3095,2492,5361,62,2864,6245,4087,
+    3696,2726,3025,61,2955,197,3150,143,0,0,0,316,0,0,0,1821,
+    1780,4431,2503,72,2769,5810,210,85,1755,287,209,177,322,189,79,0,
+    3637,0,0,250,3683,5370,0,305,5340,177,2666,2985,0,5240,0,3512,
+    284,0,0,0,0,2833,2482,0,0,1946,2644,0,4789,0,0,3068,
+    3075,5977,3021,1608,3832,204,3073,0,0,132,4727,235,5105,3128,2935,3169,
+    2824,0,2030,0,1891,23,0,5546,0,233,1783,84,2093,1781,0,0,
+    6833,2348,3822,0,2073,304,2138,4207,0,2806,88,6693,3118,1906,73,0,
+    1604,0,1608,2523,0,316,0,7041,0,2479,0,0,3272,3106,0,0,
+    2861,0,0,2093,3273,2733,5767,2018,5151,258,83,298,238,1612,3610,1607,
+    2816,2877,2955,2548,2342,0,0,3295,216,0,0,4542,3772,2406,1605,1697,
+    258,193,5320,71,0,0,0,241,0,192,188,0,232,2611,1964,0,
+    2837,3000,1895,5089,3170,2920,1600,209,0,2579,3029,73,5141,49,265,3074,
+    2732,0,3109,0,109,7112,96,133,2470,0,0,0,3648,3685,0,0,
+    2842,0,0,0,2842,184,5188,0,3284,0,266,0,2504,6849,2971,0,
+    0,2956,2539,4234,3406,115,0,27,76,2518,4601,6365,0,234,0,5911,
+    2142,253,3035,41,3217,4050,312,3838,6238,3230,243,272,2469,224,98,2689,
+    3073,4665,0,287,266,3018,2636,2152,220,6023,2152,2023,83,205,0,2615,
+    0,0,244,2336,0,0,3405,157,0,3196,0,213,4436,0,4887,2889,
+    5380,2660,2714,5966,0,0,2768,179,149,316,0,219,1605,194,0,0,
+    1907,3366,1874,2710,2941,2417,2036,226,2755,0,1610,2630,5801,0,176,2805,
+    0,96,183,41,0,0,0,317,3647,0,1631,0,6498,95,3304,0,
+    3051,2375,0,173,52,4094,1846,1829,2691,3139,3218,1913,2919,0,77,3062,
+    0,2638,2766,4710,0,2281,209,0,132,5912,0,5582,179,2020,3294,2856,
+    156,255,291,6693,0,4878,277,2898,0,2603,3018,2613,5150,0,0,0,
+    2502,2899,2975,1611,1943,6440,219,2853,2528,6190,157,3062,1913,2634,5985,3222,
+    4867,286,4747,2512,3573,2931,1632,2986,2524,2963,319,195,2216,4441,6422,208,
+    0,3610,215,3030,3041,4923,2785,4658,0,3021,259,3001,3166,3824,0,4535,
+    4211,186,2965,0,0,0,0,6000,0,0,0,0,3189,1601,0,0,
+    0,5600,228,3282,301,214,4226,6021,1764,119,3123,217,0,2692,0,47,
+    0,203,1822,139,195,1772,0,3037,1600,0,132,2765,186,84,4097,5392,
+    0,3209,2536,4050,5325,200,0,211,2756,7017,5113,3770,85,4240,3822,2846,
+    0,2788,1608,0,0,0,0,0,3095,2776,2208,0,0,2693,2821,0,
+    2470,0,3249,171,2235,182,172,2919,132,6152,5086,222,286,2721,3075,1601,
+    0,0,2765,0,0,0,3307,0,2711,0,0,0,197,239,178,0,
+    2580,4731,4481,3346,3209,197,2633,0,0,0,4492,2702,2699,39,0,0,
+    2920,0,0,6576,0,2622,317,2703,0,1956,6186,5761,2748,3141,310,0,
+    3469,2226,236,187,0,2514,273,5340,15,4526,2348,207,0,0,1896,2997,
+    0,2150,212,2770,0,0,0,2975,243,3318,3118,4930,3546,91,26,0,
+    4720,2546,0,0,0,5309,0,239,1859,263,0,0,0,0,0,0,
+    317,0,2744,3030,5096,3128,0,2809,143,2096,0,4867,0,0,168,0,
+    2690,2568,14,2787,62,5812,212,300,0,0,2249,59,0,5188,131,3008,
+    2103,39,5407,0,5096,3840,0,0,0,0,0,0,3056,0,0,0,
+    295,4983,3426,221,0,301,3615,0,5635,1603,97,0,2512,0,0,2755,
+    2234,249,2374,0,5972,2656,2215,3216,173,2955,87,26,1601,202,2908,2337,
+    185,2349,4217,49,4129,2710,2336,47,256,0,0,250,0,321,15,3209,
+    300,3427,2580,3053,0,2228,4263,2889,269,0,0,0,3391,0,6211,2954,
+    2243,206,5150,2525,299,5814,3317,2681,5107,2612,2578,6488,71,37,5003,2667,
+    0,237,2027,5153,48,312,2556,3198,0,6565,0,2765,2899,190,4885,3261,
+    277,0,5106,74,191,0,5773,1606,0,3209,3228,4279,294,3185,0,4342,
+    6001,2865,189,3189,5538,0,2787,1732,5252,0,0,5477,3183,49,3646,3143,
+    0,0,2761,214,2673,280,2382,0,0,0,0,3122,0,0,0,239,
+    243,0,2699,5406,3794,0,3339,290,54,300,83,234,269,0,0,0,
+    4270,5090,2692,0,0,2589,0,0,90,317,4876,0,2348,2886,195,181,
+    3109,209,120,1604,100,3007,170,225,1838,242,120,234,36,289,0,0,
+    0,174,0,1608,1623,2779,0,4020,3106,0,242,0,4396,0,3286,2086,
+    0,0,0,5748,0,2790,0,0,200,1773,17,274,0,0,5692,3087,
+    1978,0,0,0,2733,0,161,0,286,2833,125,5819,2603,2368,0,2153,
+    0,0,3047,4598,6266,297,14,145,0,87,0,0,96,0,2792,0,
+    0,1986,0,236,193,0,0,0,308,4226,2804,292,3074,0,3271,1615,
+    2152,0,0,3089,0,0,4761,2711,6560,0,2986,0,0,0,0,4316,
+    0,3960,2886,0,120,1747,0,0,244,4272,148,1952,2151,1941,0,5342,
+    1641,2876,0,0,5592,1701,179,0,3385,3282,4666,156,5910,2941,4719,1601,
+    0,4216,3788,0,4757,0,5310,0,1605,2758,97,3238,4309,133,2701,0,
+    12,0,3315,0,3163,0,0,4454,3011,187,1608,0,3130,2908,5854,2699,
+    4647,2273,4498,0,193,3345,0,0,0,195,0,184,2724,5364,0,2922,
+    48,1742,2776,2666,4446,0,2578,0,23,0,2102,246,6687,5256,0,1875,
+    2592,0,263,4490,0,3075,5414,110,0,0,4378,1600,3106,0,4206,2656,
+    2770,4673,0,3097,1721,1608,2076,74,3095,212,5921,3107,176,1970,237,227,
+    0,0,24,4263,110,237,2776,0,3262,276,0,0,3041,5647,0,2606,
+    3065,2690,0,0,0,0,275,2692,0,5937,2204,261,0,0,0,3173,
+    0,0,2582,6274,0,3319,4646,2688,1600,5334,6041,4008,5802,2910,2235,5340,
+    0,83,6230,0,312,6918,0,0,0,0,0,0,0,3228,0,2864,
+    0,0,0,0,0,65,3296,0,0,76,0,3573,0,3142,0,2931,
+    0,2831,170,0,0,0,0,0,2347,0,0,2930,0,0,0,0,
+    0,2217,5340,3130,145,221,74,0,38,0,0,2559,285,75,3009,1600,
+    0,0,5451,2506,5316,2711,310,263,0,0,0,0,0,0,2919,4657,
+    2853,0,2663,232,0,1622,3133,0,3390,6358,0,0,6045,0,87,5585,
+    0,0,3108,0,2426,0,0,0,2644,23,0,0,3306,3576,3822,0,
+    2755,6471,2900,3085,3042,319,2104,2849,1942,4207,3930,2138,119,110,3217,179,
+    2866,3556,6051,15,3989,2479,257,5981,1926,2923,3711,2996,2853,3010,3216,2072,
+    2074,316,3220,228,302,5529,2545,0,232,2502,169,2660,173,1745,2590,209,
+    3185,2799,209,0,0,3830,257,2911,237,207,5970,5584,3241,4261,2402,6231,
+    3164,4746,2770,2822,3276,5976,2722,3144,196,60,4896,262,223,3800,2486,1874,
+    2821,284,1822,2348,2925,3887,2140,5760,4022,5087,2441,2494,192,17,3315,2080,
+    0,0,0,0,24,2780,219,2733,3173,2623,0,0,6371,0,2625,321,
+    0,189,2547,2666,0,0,1839,1973,6355,3232,6883,5804,2976,291,178,2968,
+    3253,3766,2952,1829,3382,3830,6046,5527,4528,3113,1754,5105,0,0,0,2603,
+    2612,3224,0,5590,275,209,1746,0,6807,309,2688,2788,2803,2494,260,4930,
+    6082,0,2383,5545,5386,1601,3788,319,0,109,0,6025,2645,0,307,0,
+    186,229,1912,2809,1961,126,2524,2867,119,4270,0,5272,316,167,2732,1603,
+    2416,3838,2271,0,0,1895,6504,160,2688,4005,2168,2955,3162,0,0,0,
+    0,3789,2897,0,0,0,2468,0,0,207,262,2845,2715,0,3117,35,
+    0,2611,0,0,303,3088,0,228,0,0,47,0,4041,3003,0,0,
+    2693,85,0,3956,4482,0,1744,3346,2563,178,2473,288,2953,0,17,232,
+    4209,1743,2784,2800,0,1897,2009,4974,5599,249,0,3119,176,0,3109,0,
+    0,0,2405,282,0,0,245,4712,7237,1708,2347,0,2568,221,263,2073,
+    0,0,0,299,2756,5396,2888,30,251,1812,2644,2471,2688,0,3205,2823,
+    0,3150,0,181,0,3622,2910,0,240,2513,0,297,1700,3426,2348,221,
+    20,3278,3221,2633,209,1607,3306,2402,4526,3463,3305,0,2209,3207,269,7035,
+    1605,1623,0,131,2404,186,4921,40,174,60,2499,216,6510,315,59,0,
+    0,4206,0,3604,2417,5097,2523,107,3043,3295,6580,2556,249,132,1972,2221,
+    1610,2966,0,2728,2517,3040,0,2366,3399,2602,145,2754,204,5362,2953,230,
+    3195,0,0,0,273,5811,0,2589,0,259,3129,5340,0,3874,4886,1766,
+    2710,2857,0,7237,243,1904,0,2504,214,274,0,0,0,3051,5340,0,
+    2415,0,5308,0,4429,3548,3768,0,2207,0,138,3547,290,2821,3020,5371,
+    2735,225,3565,0,0,0,0,0,0,301,3108,3830,201,0,2273,318,
+    1676,5910,3081,158,3109,0,5471,4000,2591,3992,5976,5442,168,2788,5966,236,
+    0,2347,4789,5086,2481,64,5251,321,2009,2766,3008,1787,1612,5370,280,2494,
+    3293,1916,3045,2634,2028,293,5864,5846,171,1606,261,2824,6890,2974,258,4285,
+    2308,49,1774,1602,3321,3216,5861,2413,2512,200,267,2083,3381,5406,2626,182,
+    0,190,3240,0,0,0,173,320,109,3262,273,2921,0,202,5854,0,
+    0,204,0,0,4436,0,24,0,1746,228,0,72,2285,216,0,0,
+    4094,0,196,2140,2755,0,4482,177,0,0,0,2952,0,6194,52,0,
+    1780,0,0,3326,0,0,0,6856,267,322,2204,3236,0,15,297,1877,
+    308,23,3066,84,0,2381,2843,171,48,0,6696,6187,0,3800,217,0,
+    0,0,174,0,0,0,2077,2468,321,3327,0,0,2856,0,0,2699,
+    0,4453,110,313,2481,0,4439,2893,90,3307,87,1815,3546,3106,1605,0,
+    131,2492,225,314,7046,171,2736,0,238,258,0,2021,302,1610,3172,132,
+    175,2036,1864,2284,2367,194,5812,3032,0,2844,4381,1601,252,2358,0,0,
+    275,2480,0,0,2045,2359,278,2206,266,1701,0,2633,0,179,3008,2177,
+    3788,4665,6358,4343,0,2735,275,0,167,4442,5152,2963,239,2821,0,2159,
+    59,2798,3095,307,237,275,248,48,4240,3139,273,3717,2424,303,265,0,
+    0,0,0,2780,2093,2846,5108,1956,5088,0,2508,5748,0,0,4486,0,
+    3206,0,3030,4222,2682,3776,1607,23,288,3732,5166,310,0,3130,2943,0,
+    4922,1691,2868,242,2788,170,2094,5868,0,3032,1632,263,3196,0,2535,2953,
+    2726,2580,2903,297,214,0,305,0,121,1758,228,0,3043,6130,0,0,
+    0,0,3716,2810,183,1611,2855,53,4783,4541,0,227,277,2810,4866,2497,
+    3285,0,5890,320,0,0,14,6057,3102,2667,2807,1973,0,0,0,0,
+    4102,2798,160,85,0,0,0,0,314,2694,1765,0,0,2911,5598,187,
+    4050,157,2601,0,5108,240,2868,0,2765,0,5802,1612,2721,205,2930,1889,
+    84,2893,0,2549,3263,145,2820,1747,0,3205,0,3560,5449,1661,5351,2930,
+    135,194,4427,5132,0,210,1763,307,2801,0,0,0,0,231,181,0,
+    0,245,292,0,0,5172,2612,2085,0,0,6066,0,0,2824,1622,0,
+    191,0,0,4657,4704,3295,3361,3663,0,3001,0,2480,2622,3469,0,14,
+    0,1876,2083,5978,5415,1605,233,3161,0,3174,2348,3117,0,0,0,4528,
+    4005,5154,305,0,1874,0,0,5107,5158,6560,2545,280,2886,0,3151,0,
+    306,3129,258,1608,2480,1940,2402,4968,2853,2912,5223,2728,6393,0,4831,1956,
+    0,241,2734,2941,2856,2027,1608,3255,108,0,2787,2118,3106,2229,237,4328,
+    0,0,287,0,0,4426,1678,2633,0,2104,0,0,0,3106,1623,5151,
+    131,2615,4131,1972,25,4429,302,0,5151,2834,3317,0,100,0,2702,190,
+    2821,284,2481,3007,2468,3381,158,252,5378,3937,3731,84,2743,0,0,2744,
+    155,38,0,0,6267,0,2613,0,195,4427,3065,2932,2180,0,2557,2492,
+    0,0,1701,2647,0,2712,2051,0,0,0,98,257,0,0,0,2593,
+    4171,1772,3043,0,283,2022,0,173,0,0,0,2569,1810,0,3169,2880,
+    1895,2879,2735,3173,1687,53,2112,0,2413,0,35,2501,3031,0,1885,6387,
+    3391,2691,2140,0,40,6743,213,0,2559,120,2735,2656,2985,3252,5306,7043,
+    0,0,4095,0,2725,4233,84,2501,0,220,3135,0,3031,0,3354,0,
+    2074,0,3165,0,0,145,2750,0,0,0,0,0,0,0,0,0,
+    208,5361,0,2722,2839,5747,1601,1604,1707,276,31,2337,1754,5765,0,5363,
+    2140,2582,6477,1605,0,193,3341,2987,1961,6206,4308,31,3602,3327,3300,3626,
+    4427,5406,2557,300,3124,120,2234,0,2974,109,208,5235,2426,1813,229,173,
+    0,0,264,233,0,1988,0,4762,1839,6068,199,2845,277,72,1609,5097,
+    0,0,314,2442,0,0,234,122,0,0,0,303,0,2492,268,3099,
+    2655,2986,1744,144,5748,1606,2768,242,256,280,2856,0,6188,0,201,0,
+    158,2537,2615,26,5089,2481,1623,2821,2168,155,2667,259,172,1942,4593,2702,
+    1602,5988,4878,3161,3151,2714,2634,5967,2204,2207,3821,184,4043,0,3075,3297,
+    0,255,0,2611,108,2570,3305,0,2821,2086,3010,2946,1819,233,2677,1855,
+    0,5537,0,1610,0,0,2603,117,5977,1819,2556,301,187,0,2756,159,
+    0,63,5009,26,5756,240,167,2138,0,0,0,2011,226,290,109,1919,
+    0,0,0,2677,0,2579,0,0,2712,6022,276,0,311,0,0,11,
+    2633,131,0,239,198,0,302,3904,3558,251,5826,226,2468,3996,5988,2691,
+    4436,5872,1888,266,2482,290,0,5916,5758,5813,3158,6230,3111,3129,2343,4007,
+    12,5003,2743,1679,3216,0,0,2790,0,304,186,193,217,249,52,7046,
+    2732,3547,3161,258,5584,2699,2831,2295,97,1919,215,5105,2721,3305,73,1687,
+    298,193,132,3319,0,0,2514,197,1881,4656,2569,2625,182,5971,2790,2634,
+    2987,60,5979,119,182,6763,2993,5970,3228,2703,0,2524,2300,3557,108,0,
+    4701,0,187,3656,4564,245,0,271,3887,96,3062,0,2484,4429,0,2244,
+    2525,3063,258,2635,2347,23,3195,5250,4591,0,0,314,3683,3216,5527,24,
+    233,0,265,227,1979,2952,2637,234,3305,0,2877,2492,0,6947,0,39,
+    0,3329,2225,5086,3040,3227,4308,0,6826,0,1677,4921,2725,6280,3040,0,
+    5854,2765,0,4207,3109,241,3988,173,2821,1823,2479,0,2312,2877,307,0,
+    0,0,0,2689,3574,36,62,2743,0,2714,253,0,5442,0,3084,59,
+    2922,3172,5141,0,3930,1896,3441,112,159,2545,259,3035,0,3327,6393,0,
+    1794,272,159,2402,2545,2832,6067,2613,156,1601,251,3406,248,3132,5978,6210,
+    0,3406,0,198,2734,0,245,122,0,4006,3996,4667,5848,0,0,271,
+    3184,321,0,2077,3657,2955,2548,4045,2977,2483,0,0,2820,0,3240,0,
+    0,0,167,5979,0,125,0,167,2423,2878,3689,0,212,2801,0,0,
+    0,0,2648,61,83,2897,2800,0,3172,3207,0,2096,0,2846,2868,320,
+    2834,1896,172,1951,3718,271,2734,2159,0,0,206,0,237,5670,2471,1689,
+    4005,3602,2592,1688,3448,178,1604,3821,2547,1744,3574,3338,77,2879,7127,0,
+    0,313,208,2942,207,98,195,4493,1603,0,5364,3568,314,125,148,1905,
+    0,2604,0,236,2865,2815,2626,2922,2337,0,0,286,0,3549,6238,6351,
+    1978,0,0,0,0,2535,1687,25,2490,265,3329,0,0,2901,0,0,
+    225,2083,3427,3557,260,0,59,0,0,2143,2547,0,76,4547,3655,2756,
+    6022,0,0,5319,303,3120,2702,3785,2865,2692,2556,2980,2031,223,2980,6714,
+    305,0,0,4234,3251,193,2666,3274,0,0,0,3987,0,132,311,3195,
+    3326,270,208,0,0,0,4370,0,3147,0,1885,4021,177,2567,62,5936,
+    4889,2093,2565,2875,2595,0,4647,314,2098,4656,0,0,6151,1809,3031,25,
+    2569,0,3199,5365,3062,1728,2515,1631,0,0,3024,47,178,37,0,0,
+    0,256,1613,0,239,0,1706,0,287,6186,2930,2825,273,2471,2680,2523,
+    0,0,5846,277,1606,0,0,2404,5526,0,2820,59,0,3022,0,2504,
+    3220,0,0,0,283,2622,5802,187,0,0,0,0,0,4454,203,277,
+    3366,3339,5637,0,2154,5756,0,0,3998,4925,171,0,0,132,0,2571,
+    2297,3121,0,2338,2766,156,15,6197,2282,291,2625,0,0,5537,0,0,
+    1846,209,1622,0,2150,2424,0,4108,1829,96,186,4131,1622,2712,4274,3011,
+    0,1952,0,4877,3920,0,2767,2142,2300,0,247,1742,271,3076,61,41,
+    0,0,316,211,0,3108,0,0,1888,2513,0,0,25,5319,0,2748,
+    2941,0,2733,260,3407,3090,2681,2628,5647,4790,3089,2765,215,0,0,2964,
+    0,2492,0,0,2480,0,0,2655,3133,0,3271,226,2249,1820,0,1941,
+    98,4879,227,168,232,2220,0,5629,290,5372,260,2831,156,2974,1951,224,
+    3041,0,0,5862,0,257,3682,0,2470,0,179,2579,2954,5747,1963,0,
+    0,5320,0,2834,35,3100,3142,2479,3099,0,0,3316,0,2688,240,3166,
+    3131,289,2986,3326,1987,252,2357,4426,2402,2485,3265,3032,6038,4426,4866,2858,
+    169,3305,0,0,0,0,89,4736,278,0,180,182,112,0,1677,0,
+    0,3240,2139,0,0,210,0,3390,2759,12,3293,257,1657,2414,0,2842,
+    3411,3316,199,284,300,188,2637,0,0,279,253,3064,240,0,207,2237,
+    2227,1608,2573,72,2557,2432,2735,0,0,0,2007,0,0,0,0,6203,
+    4923,137,251,5773,6811,0,2490,6104,0,3822,0,0,0,1964,1875,180,
+    2875,2139,2788,0,0,0,0,2617,4042,2692,0,307,0,0,3108,0,
+    0,4485,2032,0,13,2219,6081,4212,0,37,0,1606,2605,4658,168,5391,
+    2479,2802,0,0,0,0,0,3227,196,2725,200,2513,5582,0,2949,5748,
+    5669,0,0,3097,0,151,0,2854,3165,0,5561,217,0,5747,0,180,
+    0,314,223,1882,2678,96,3434,2669,5444,2600,3427,5318,6089,3167,283,2581,
+    2976,0,0,0,185,1699,2647,0,0,167,0,3121,0,0,4507,0,
+    297,0,0,2492,2985,0,3618,0,263,0,207,0,0,95,0,3118,
+    2367,2898,280,1610,0,297,5590,215,2592,3986,1601,3295,282,2525,134,212,
+    0,217,3631,2864,26,3075,0,1633,0,1600,2920,3273,0,3605,2715,2982,
+    2075,0,1603,3384,1951,2574,1625,1661,0,3065,5985,204,6131,37,2948,2778,
+    3868,3260,1925,151,3296,3216,2019,283,2637,4511,0,109,2831,4649,286,156,
+    3029,191,0,3066,0,2512,5538,237,4878,5113,1613,0,2700,3216,260,3655,
+    144,2843,0,2861,0,0,0,3695,0,2549,88,4946,3075,2766,6415,3067,
+    143,5362,233,1601,3295,2580,4932,0,4966,171,0,4648,3295,0,0,0,
+    3986,205,0,5365,1707,2699,4552,316,143,2112,0,1970,3084,0,0,4482,
+    108,5145,0,1841,2568,194,3806,0,4650,0,0,312,2546,240,0,302,
+    2504,0,3233,0,2679,1606,2800,2366,1607,2668,0,2924,184,2567,2491,3283,
+    2076,0,3161,3065,2525,0,4207,95,0,180,2102,313,0,0,2975,304,
+    2291,3205,2274,167,279,2814,2209,84,3229,7273,6081,2541,3549,2700,1714,1979,
+    6612,3000,23,2568,2658,2809,2011,0,2635,251,0,5070,3238,287,2765,126,
+    3821,3121,194,0,322,2738,2591,0,2954,292,6351,5616,2677,4483,3108,0,
+    4767,3822,3035,5333,146,3821,3042,4931,2974,2723,0,1813,2864,0,0,1698,
+    64,0,1754,0,2655,5756,6202,5141,4088,0,0,0,3602,1874,5424,179,
+    6040,2300,2823,2479,89,74,3183,0,4881,6315,0,3018,2161,0,253,215,
+    5590,230,2750,0,2820,2504,2690,2492,155,2506,2843,3316,2754,1604,2968,2516,
+    2835,3218,184,6157,2942,4933,6136,2545,0,3462,179,2308,2858,2513,3285,0,
+    2000,2611,2842,241,273,0,3249,2036,3787,2737,168,3131,2725,2105,0,2138,
+    6320,1624,0,3011,147,5538,278,2659,1953,279,302,2481,2416,0,0,219,
+    0,1940,1640,0,2887,2854,2570,2046,3399,3573,3189,5636,3053,7239,2523,0,
+    195,0,2776,0,2357,228,2505,5758,1690,2746,180,4219,2317,3084,304,5831,
+    66,2942,6279,2745,1743,4427,303,217,0,3108,0,3206,0,0,0,274,
+    4648,1688,3114,5120,1908,2678,3353,2159,3112,4327,276,183,0,1876,5252,4261,
+    0,5088,0,2791,3807,2495,251,5123,0,0,1943,0,0,213,0,4261,
+    2646,0,4050,2953,0,290,0,3999,240,131,0,0,2639,2834,187,265,
+    287,146,0,276,5090,0,0,0,1606,2821,2548,190,2315,4527,2469,321,
+    5765,0,0,2616,0,4646,74,2095,5307,0,2908,302,5626,3573,0,178,
+    0,5747,0,0,284,2910,2877,3186,3661,2633,2611,73,2558,3063,53,4563,
+    297,3239,225,83,244,2491,0,0,2769,244,5261,2563,177,0,0,255,
+    2727,2832,6826,41,5538,0,3055,6038,5805,0,1650,0,0,0,2017,6116,
+    3128,3831,6027,169,316,1605,0,230,1940,0,3183,0,156,3032,0,0,
+    0,0,0,0,121,5600,0,0,0,4505,0,2275,0,4377,167,2727,
+    4516,4657,4051,0,0,7008,217,0,0,0,2924,6131,3125,0,39,3491,
+    72,220,3175,3164,5428,3462,2086,4939,2998,297,5379,2490,107,50,200,3830,
+    4382,2810,2571,0,1773,3253,242,259,0,0,4657,260,6350,2920,3556,4315,
+    2501,2777,178,4894,4648,2083,13,229,183,5663,295,3315,5310,119,5856,286,
+    2666,2997,2367,3162,3821,123,173,3716,243,0,2112,4650,3040,3605,318,2856,
+    0,210,277,2381,2891,258,2854,1744,1600,6021,5857,2622,2316,248,4658,173,
+    2011,3089,2572,233,3239,250,2824,168,2556,2832,7237,0,178,2822,0,227,
+    0,148,0,174,0,261,4647,277,2502,178,4273,269,2226,0,188,2666,
+    0,0,0,0,0,48,2891,0,0,0,6245,6081,1622,0,2018,2547,
+    2787,3601,307,296,227,3108,125,2671,309,305,1898,1781,7307,0,6817,2084,
+    2204,1798,0,0,269,3042,0,0,2169,169,0,214,0,0,190,12,
+    49,2987,0,0,0,2942,0,0,1605,83,0,0,0,0,3132,0,
+    0,0,2052,2964,5195,6610,0,283,0,0,0,2546,0,1834,0,3575,
+    4207,4987,1788,189,180,3033,11,289,241,88,6032,3097,277,3038,2635,2701,
+    0,292,3168,2535,2923,2536,155,4747,3646,232,4392,2716,2909,266,1604,3575,
+    283,4869,1981,3165,2778,146,4427,2075,3219,191,2583,86,167,3319,3646,0,
+    110,3321,3997,1742,2723,2908,2570,3785,2798,0,2713,0,47,2619,275,2932,
+    3152,0,0,1821,3112,159,1687,5803,0,0,1600,0,0,0,0,0,
+    0,1610,0,159,0,0,0,4013,5201,0,0,3250,0,302,252,0,
+    2350,3793,71,24,2765,5976,145,211,0,5144,0,2272,0,2536,0,213,
+    2877,1755,2612,2912,5627,3469,4208,0,0,2798,262,3251,3007,3297,0,2842,
+    3273,171,3252,0,202,185,204,4349,274,0,0,193,124,3151,2680,0,
+    0,3178,2987,0,2028,0,253,0,0,2722,2964,2735,0,208,5593,231,
+    2569,0,299,3353,186,0,2538,3710,0,0,2337,0,309,2513,3174,3189,
+    0,0,0,0,2512,3915,3079,0,240,319,6826,172,247,134,3029,1678,
+    2534,3063,0,2526,2535,95,172,2650,0,4493,263,0,2293,2293,307,5766,
+    1886,108,6188,204,181,0,3036,2139,0,1942,2791,0,1875,2853,0,4544,
+    4264,1697,2453,286,4094,6077,0,0,5361,2890,4216,2853,3241,5393,2424,1698,
+    2857,0,0,2700,294,183,180,2748,6509,3051,4876,2702,0,1611,25,3557,
+    300,3217,4428,2008,3088,0,168,4436,101,206,3076,0,0,0,0,12,
+    3556,2766,3084,255,0,6554,2743,0,0,0,198,3194,0,1600,0,0,
+    2159,2946,2639,2138,2416,198,3580,304,2480,72,2150,2964,176,3319,186,3331,
+    0,5652,5186,0,3354,224,5159,76,3064,3689,6686,3320,1773,5811,4969,207,
+    6483,107,4869,2283,189,2551,238,1649,5663,3311,98,4601,3306,5812,1697,4945,
+    321,6716,0,185,4206,217,3096,249,207,2415,3824,2629,133,255,322,3208,
+    0,3139,3326,0,6066,284,3054,3238,3547,266,14,2661,2549,271,4940,11,
+    3462,2501,72,3282,96,5143,5967,1608,5144,2622,199,3800,3007,6092,1603,169,
+    1689,4026,0,1829,195,2966,3062,2711,2875,288,2842,2323,6231,4044,194,7091,
+    0,290,0,3562,2847,6067,0,6067,0,0,0,0,2876,0,0,73,
+    3177,6832,2931,0,0,2442,2633,254,96,2010,5327,3177,0,2611,0,131,
+    132,0,246,0,4481,0,2963,0,294,2518,309,3195,0,1607,4596,230,
+    5966,2509,170,2469,13,260,4246,3462,2978,0,0,2946,246,5407,0,0,
+    3315,6744,5038,3560,219,2283,157,2503,114,0,0,3546,0,2190,2549,4866,
+    0,2501,2468,0,235,3227,0,3661,2479,2291,0,0,0,3019,149,0,
+    109,2942,278,1621,2480,2601,0,0,2923,2955,250,6066,287,0,0,3996,
+    4749,1839,1676,269,39,2769,0,2490,288,4267,245,5188,3287,4445,97,2580,
+    3822,183,2579,0,3230,5581,0,90,2735,2367,93,3280,3194,6109,2225,4242,
+    5060,7035,3405,193,5086,6087,2528,220,198,4208,3776,2911,2140,1631,6092,85,
+    0,257,2965,2545,61,0,2553,136,0,2722,286,1642,2644,0,3151,2953,
+    179,230,237,3793,2205,4210,6521,290,3117,304,0,3497,2027,2404,2513,0,
+    7037,1810,108,2072,2728,121,3249,3132,2633,0,0,290,0,0,0,0,
+    3785,215,2997,3194,3647,4591,5108,15,5884,2870,311,0,5316,3107,0,0,
+    6075,7287,3767,0,241,2809,236,37,0,4535,0,0,4923,0,0,0,
+    0,320,5528,0,2688,3190,86,5977,0,0,0,5326,0,0,2480,2073,
+    248,286,0,264,0,0,0,3320,2834,4987,2910,0,0,0,3273,0,
+    0,3183,0,244,0,0,2690,0,6826,99,5970,218,1613,5854,0,4967,
+    3009,6239,3317,6081,197,85,0,2020,83,0,1913,3012,6300,155,2545,213,
+    0,2085,2141,0,0,3255,2503,242,3340,1721,320,311,247,0,310,4534,
+    4481,225,0,3161,5361,2150,1742,2007,3144,241,203,250,3156,2602,0,3086,
+    3255,179,2967,2897,2488,2932,1608,6393,0,0,0,203,3141,3306,0,193,
+    3295,0,2662,6359,159,0,1609,1605,38,192,4447,3207,3267,0,0,2490,
+    2735,212,3142,4704,204,1681,223,72,5765,5611,0,4028,5223,244,3345,0,
+    143,2501,0,2551,0,0,144,0,4020,0,291,2810,1745,3106,27,300,
+    0,2985,5747,0,2888,0,143,5648,0,0,71,5151,0,0,0,2440,
+    0,0,181,2581,6561,3254,5917,5759,2141,173,3552,2443,203,0,0,144,
+    3075,2758,0,120,5847,2814,0,262,2958,1808,0,27,3123,5145,3232,250,
+    1756,2644,50,2743,291,3999,277,2689,2583,2798,2485,296,3328,2501,0,0,
+    3031,156,3263,0,217,3051,1714,2778,0,0,0,0,1627,3230,5341,2531,
+    300,2602,0,233,0,0,2765,2634,2859,2291,2606,2607,0,4681,0,0,
+    249,184,311,2093,3063,6109,4947,4498,2646,0,0,0,122,217,120,2844,
+    3043,2681,3556,1766,0,3031,181,2494,2624,84,4762,3022,287,75,191,3603,
+    1766,0,222,0,0,0,4217,250,0,0,2342,3888,227,143,2695,6021,
+    2799,2756,4490,1697,2592,5648,3326,222,4810,0,2974,144,2822,36,2536,2648,
+    0,234,0,5591,61,0,0,3229,3570,4590,2388,2291,2407,2357,211,0,
+    5003,5847,243,2470,2853,3117,3283,246,4686,0,6076,158,2153,0,107,5222,
+    254,0,2974,0,1676,2766,268,3128,2711,0,2535,2722,0,0,0,0,
+    0,1742,3228,119,2722,2481,2765,97,0,59,2562,289,194,5932,0,2490,
+    3010,2556,2625,2336,0,0,2525,5818,272,302,2441,24,3172,0,0,5966,
+    3066,0,0,240,2954,0,0,0,0,5096,293,0,5801,321,72,5883,
+    2673,0,0,3284,3434,5537,1942,5553,62,288,2084,3238,1895,264,2234,49,
+    230,1604,4306,312,3074,3267,2767,0,5363,5418,1840,287,2580,296,1820,2417,
+    2844,204,196,2105,1603,2944,2737,0,2623,74,1961,4135,0,0,0,223,
+    190,0,2835,3194,3018,157,2824,111,0,2281,0,0,0,0,241,2337,
+    120,2539,0,3172,157,2781,4271,2387,0,0,2447,5867,219,4152,2886,2832,
+    5444,2767,143,3216,0,2569,36,2820,0,5086,261,2470,2892,3548,2603,42,
+    3909,3690,0,35,239,196,0,0,0,3294,2616,1908,43,277,0,222,
+    0,211,0,74,0,0,0,0,172,221,0,0,0,4397,0,315,
+    176,2656,2644,191,4967,2027,36,108,267,4225,40,4703,4784,4649,2706,1823,
+    1757,214,2020,2723,5978,219,241,3317,283,2218,2581,2562,1877,182,4043,71,
+    167,2755,2291,2792,2856,5097,2866,2481,112,2560,263,2999,113,2215,4748,219,
+    218,5662,4974,190,3252,2648,269,37,2821,2930,2974,4880,1641,5863,2600,196,
+    4548,6024,268,1773,2027,2953,5536,184,2549,3151,3194,2514,77,5769,5306,102,
+    2276,3238,3216,197,3075,217,2423,3183,4749,2227,4647,1961,3227,2095,95,2501,
+    0,2018,5825,0,176,203,3052,6087,2659,3063,3008,2591,5105,1604,282,3986,
+    4437,223,5003,254,252,2921,2009,0,293,2941,0,0,4665,7242,3041,5746,
+    261,2532,1875,0,2525,1676,2769,0,1609,290,4481,156,4014,0,0,0,
+    1940,96,251,2219,2814,266,2195,2712,0,4050,3118,232,0,2361,0,107,
+    2953,193,3019,172,1763,3800,3074,1621,5813,2556,2700,5802,4870,3194,2523,1942,
+    1603,2809,2300,3213,72,5856,304,2300,187,99,183,209,275,3228,1763,5097,
+    5225,36,183,6141,179,285,5766,3383,2512,6699,197,3431,4725,1678,4731,3830,
+    135,202,2865,3717,209,2270,1885,3012,2991,235,224,2336,1782,2770,1810,3293,
+    3190,2744,194,6414,3130,2723,6023,2535,6316,2479,2854,2403,1766,6196,179,299,
+    192,156,5414,279,136,3822,2481,6075,2704,5096,3492,51,2932,147,174,1603,
+    253,2403,2637,2513,3053,4122,4427,5444,23,4307,195,1755,2649,4261,67,4240,
+    3055,49,2139,2614,2205,44,3263,2073,218,4492,2693,3988,3310,3988,3018,2036,
+    3150,272,0,0,5100,0,5097,0,2761,225,0,2799,3733,261,3526,215,
+    1955,4209,0,0,3360,167,0,0,3294,2833,2019,6068,2432,5748,0,229,
+    2139,2854,1952,3033,297,3265,2305,56,1859,291,14,2525,284,0,0,2310,
+    2910,0,3264,0,0,3250,6806,231,2666,312,4087,168,3206,172,3008,0,
+    2215,2733,2922,2526,0,0,2888,0,0,1964,0,30,0,322,0,2273,
+    0,0,0,2491,0,3272,281,3390,1951,2490,1600,4877,2617,3304,0,300,
+    0,4946,99,0,5015,271,0,0,0,215,2876,3103,2012,0,0,294,
+    3108,2927,7414,3008,71,6266,1781,2030,5306,3568,3030,4907,5884,3931,3297,5306,
+    0,4563,0,0,1838,0,4437,6733,3140,219,3212,5994,5605,3551,274,2900,
+    3139,148,0,269,4966,0,0,38,120,187,0,0,6240,3210,260,5335,
+    241,0,185,2143,0,0,2941,0,211,2768,0,0,5547,0,312,0,
+    0,3360,2942,6435,0,0,0,0,0,7227,2897,5752,218,222,3574,274,
+    3329,72,1607,0,3023,233,1811,210,5098,171,151,2578,1650,2941,2656,287,
+    4866,0,0,0,4067,40,0,0,5427,6195,83,0,2562,0,5537,0,
+    193,234,1755,1859,4240,216,2449,4686,4754,4356,3040,3224,3217,2623,177,2721,
+    0,0,157,321,185,0,0,0,0,0,0,5582,0,0,0,0,
+    4562,1808,4217,0,0,0,228,0,0,2274,1605,2338,4327,1714,0,3294,
+    0,2788,2864,4097,213,2790,36,283,2711,172,0,5977,2571,0,0,2912,
+    5759,0,132,0,227,0,0,0,2809,223,1606,3128,2908,195,2689,5530,
+    2339,2748,267,3228,1609,3771,1679,197,5528,2690,5482,3128,246,2804,302,269,
+    3767,0,5553,3321,4371,2535,240,1632,5530,0,2777,0,2650,0,0,0,
+    272,0,0,0,178,2811,2548,0,2942,3481,5114,228,62,62,3175,2613,
+    6022,172,2523,5634,4755,0,5472,0,0,24,0,0,3274,0,3140,5861,
+    5663,281,2492,202,2886,5810,3078,2990,0,3228,194,2483,157,0,2205,0,
+    1698,0,0,2414,225,1865,2291,4445,2646,2523,230,217,4000,254,3109,3185,
+    269,4045,171,4701,2744,6069,3051,4436,210,3035,2090,3348,264,0,1676,3556,
+    2535,3321,0,2417,3700,2934,2540,0,5811,229,5669,3262,0,0,1853,175,
+    2799,211,1940,0,2739,2694,1688,120,23,4088,2875,6352,2759,0,0,156,
+    2139,0,2780,3282,0,0,0,3307,2899,1611,3426,1980,4216,3254,2793,314,
+    1605,0,2095,0,6768,2338,3169,84,4251,0,289,59,2954,6728,6386,3009,
+    2204,243,0,0,0,0,0,0,248,273,0,6269,2485,0,0,0,
+    3109,209,0,0,2150,0,270,0,1602,258,0,2625,0,3347,297,1602,
+    0,1961,5150,248,184,1687,123,3020,233,0,199,309,23,0,3205,0,
+    4879,1912,173,3010,2954,36,4613,0,0,3102,3316,0,0,0,3317,3164,
+    2567,0,0,3776,285,119,196,227,0,0,3794,167,312,7147,2842,3236,
+    2649,0,238,3172,183,6196,0,3008,83,2189,278,3007,0,0,2646,0,
+    2523,248,2919,0,0,239,133,0,1808,264,3284,5850,6279,0,2996,220,
+    1697,0,3283,169,3318,4667,0,0,253,0,2842,2947,2864,0,4061,2670,
+    2803,48,2404,0,3271,3141,294,242,3293,2626,3987,265,0,0,3353,2506,
+    299,3249,0,319,2743,3621,0,288,3346,2957,188,1962,2985,4975,98,0,
+    2931,2889,0,0,2847,283,2908,250,0,211,4976,4912,0,270,1754,3547,
+    2943,5833,2624,4006,35,3065,0,3119,0,281,0,0,269,3243,202,24,
+    2801,2527,0,190,0,0,0,0,0,5767,0,2759,1680,3007,0,0,
+    6679,2646,289,233,0,3120,238,0,238,3121,2942,3604,3172,146,290,0,
+    0,0,0,39,0,2579,0,0,3328,17,4710,197,3007,5801,3383,4391,
+    0,3283,1853,2548,132,0,2683,3766,5414,0,0,0,305,223,3274,0,
+    216,211,2491,4867,2479,4974,248,0,3787,11,5041,2734,310,5592,27,77,
+    5166,3338,0,3219,2348,0,2805,0,185,2859,4438,2656,153,0,3260,2341,
+    314,0,179,4342,295,2600,2017,2600,0,0,3441,0,3463,2843,1602,74,
+    2850,263,5087,117,2629,2476,1890,195,6798,2966,2800,251,11,0,0,1609,
+    108,0,2952,6687,2589,0,0,185,0,172,0,1679,0,0,0,0,
+    3162,0,5756,0,0,3386,3130,2414,3024,0,135,2758,2602,0,189,0,
+    6882,0,168,2865,6032,2913,5626,2236,2702,5994,4437,2360,314,0,1819,0,
+    1604,2963,4755,207,43,2734,2622,5690,0,311,119,3164,4427,5307,2985,0,
+    1604,3063,4094,137,4982,2161,0,3062,2787,3327,56,4923,2799,216,5195,0,
+    4726,123,3287,2887,5749,0,189,15,4499,0,4902,3271,4646,4429,4265,1860,
+    240,5086,2868,2952,280,2931,2777,5547,5526,2635,161,296,3224,2483,0,4812,
+    144,2794,2869,2954,1732,1763,2650,5976,6194,1986,2633,0,0,2491,3806,268,
+    239,236,0,0,0,4228,5592,4307,186,0,1682,2161,2627,138,276,3821,
+    3903,2077,291,208,238,2088,7014,7014,1690,282,63,2612,276,3549,2508,2570,
+    5546,0,4968,26,4996,4703,3194,6202,5433,7071,267,2776,5121,246,5913,311,
+    229,2853,1742,3095,3019,4911,2492,316,1604,3086,2008,3619,255,12,16,140,
+    0,2535,3051,6848,194,0,0,3601,6722,2941,2681,173,0,3108,278,0,
+    2633,5310,0,4043,0,3839,1875,7272,0,14,4939,3118,4233,3218,0,39,
+    0,4484,1601,0,0,0,0,5142,6743,0,0,5566,1607,3278,120,286,
+    0,0,2701,0,4270,0,3096,2184,0,3271,83,3326,173,5985,0,2141,
+    0,0,5526,0,2216,0,3839,0,2612,2683,255,157,0,0,0,0,
+    0,143,2171,0,3305,3099,0,6231,5801,7071,0,3122,0,4007,73,2415,
+    3604,0,48,2470,4754,0,0,4218,0,0,279,0,5321,5361,2948,0,
+    309,0,0,0,0,1832,2348,132,5526,0,5378,2933,0,3174,0,0,
+    306,2274,298,0,0,6186,6483,228,2858,1952,208,2580,2351,4491,2638,0,
+    2974,11,1724,3382,5664,255,276,216,1754,321,2556,3871,2503,193,2581,2930,
+    149,4596,3296,3230,2934,4868,2625,0,0,0,0,0,4122,0,1945,3176,
+    1609,213,5187,0,0,0,2781,2536,0,2655,0,0,0,2901,0,0,
+    5361,3306,83,5207,1609,1610,2914,296,0,5889,2455,0,322,0,2820,262,
+    3087,3216,2834,89,2556,4981,4171,3073,2834,2076,0,3009,0,3265,0,296,
+    0,0,2571,18,84,3260,280,0,2424,4876,11,0,3770,206,3240,2724,
+    1606,2779,54,0,3316,0,0,7217,0,2677,0,196,0,2930,3399,212,
+    0,0,265,0,0,0,249,0,268,2765,0,0,1896,211,3132,184,
+    2087,284,2768,2206,173,167,251,5583,2812,2721,2710,167,209,2403,3008,2754,
+    1607,2968,2688,188,3227,5976,2755,2484,1682,4445,2493,5031,85,0,223,211,
+    2571,11,3219,2276,5882,0,213,5378,1972,3108,0,284,0,110,2592,3076,
+    0,0,2528,0,0,2513,76,280,5594,1954,0,3548,2943,2898,297,2845,
+    1635,177,6066,0,0,0,6799,0,2557,1874,247,0,1600,0,36,6414,
+    3121,0,0,2017,0,297,6274,2963,3987,296,312,0,4925,2756,2622,0,
+    2711,2890,74,3074,0,0,2492,3996,2007,0,3329,269,224,3469,13,2689,
+    0,280,2473,0,3199,5325,162,6799,0,107,2855,2812,5306,0,0,2009,
+    2206,0,0,0,0,4207,2594,2139,2934,2858,0,5421,4270,2853,3986,224,
+    2183,2550,204,0,5406,5634,2626,4210,2958,0,2505,2755,4436,5415,4547,2284,
+    267,0,264,2152,0,2771,6187,0,1874,5540,272,2171,0,5261,0,3559,
+    0,3131,4789,0,2942,1876,2273,0,1772,5986,60,185,0,3163,1610,0,
+    2495,223,3027,13,5187,3327,0,1848,6048,203,2600,35,5225,2639,0,0,
+    2634,63,3145,2682,246,0,1631,179,2626,0,281,0,0,61,0,2667,
+    2339,289,0,4391,0,5669,5756,5595,1951,4651,1679,0,0,0,0,160,
+    0,2787,4702,1970,252,202,0,1963,123,1604,2019,191,0,0,0,5341,
+    0,156,0,0,0,5370,2668,0,4552,4116,202,0,0,3032,265,0,
+    2076,0,2571,1825,0,1887,1601,2933,2868,3260,306,5153,5370,4541,119,74,
+    6046,0,4981,2550,2750,59,0,3286,3118,242,2986,2600,2523,2006,5566,107,
+    0,176,0,2975,5098,2073,67,4718,3219,0,0,2413,0,5812,0,0,
+    262,0,0,3353,110,96,158,0,273,0,105,270,5553,2225,14,2865,
+    1690,11,0,2413,0,0,0,4456,1810,99,0,65,0,72,0,2658,
+    6306,0,213,2649,4900,0,0,0,0,289,186,2854,0,230,0,320,
+    0,0,0,0,0,0,0,0,275,0,2495,0,0,0,3662,0,
+    0,86,204,1912,3107,132,2362,3260,298,0,4894,5186,0,3119,2503,3037,
+    2941,2901,4647,2702,3293,268,2677,3427,5911,190,224,2811,3309,260,192,1706,
+    2702,0,6209,241,4088,2846,2604,0,2471,255,1635,2811,3780,2946,5676,11,
+    3150,260,2822,0,0,1833,0,3405,3003,0,218,1961,300,3986,2558,1677,
+    2733,6386,5196,107,1757,0,4101,0,3095,6555,0,0,171,85,3385,5827,
+    3107,0,1819,0,98,1794,0,173,0,2761,0,162,1953,158,1874,4924,
+    1708,0,0,0,5308,2879,0,0,0,2045,2283,2423,5987,1757,3144,4967,
+    0,2271,0,270,0,0,0,0,96,0,0,0,0,173,4219,2974,
+    253,0,227,0,0,2526,0,0,169,3205,230,2957,6194,0,202,2637,
+    6038,307,0,2879,168,0,3047,2942,292,2483,201,2809,3095,0,148,0,
+    0,0,2888,1877,62,3052,4702,300,3087,2273,287,2413,2789,0,253,6421,
+    0,6022,3893,299,4008,13,4966,0,4042,3242,0,0,2679,1764,0,272,
+    292,0,0,6266,5773,296,5803,3086,13,1614,3035,3063,0,221,6405,1687,
+    2800,2953,2357,1985,5994,310,311,1753,2974,4876,3042,0,3892,1764,255,0,
+    0,0,0,0,189,279,0,0,0,0,29,137,2044,1809,4665,2997,
+    0,0,263,2690,2966,7224,0,3363,0,0,0,0,5863,3031,28,0,
+    97,101,4673,3398,5642,226,61,88,5536,3800,184,0,3021,4675,6294,299,
+    0,249,147,1608,4500,3139,5590,156,182,102,252,3315,157,12,6030,2659,
+    3180,3298,2947,180,222,0,6394,2671,2757,2149,3689,4090,2875,0,0,98,
+    251,2600,5212,3552,2600,3051,5527,6680,3054,2102,272,220,2568,2955,2618,73,
+    1750,4871,314,48,5802,2659,1600,3040,310,2820,2644,5690,2283,53,312,2086,
+    280,199,1897,7102,150,1946,3558,7097,0,0,2625,2014,1820,0,1758,5536,
+    245,0,3847,0,2007,0,257,223,4447,2556,0,295,3121,3846,0,2771,
+    0,0,95,0,5325,169,3043,2700,0,4921,2601,2886,4438,3244,2222,52,
+    2006,0,216,3066,296,3337,0,2960,2292,59,316,110,2184,240,1651,0,
+    51,273,2301,0,291,2932,218,3231,319,3294,258,2913,2492,3161,273,1971,
+    3838,7218,3274,160,0,103,4931,2866,0,0,0,1680,0,3874,1811,0,
+    0,0,2974,1600,1763,0,207,0,28,1606,2855,84,0,1754,3337,4427,
+    3217,236,2340,0,182,0,222,196,1853,4072,124,0,12,2748,0,0,
+    3831,2283,287,243,2846,73,3998,247,0,0,221,0,0,2502,2934,0,
+    2517,0,2930,4932,0,2634,1763,286,4291,314,312,0,2999,4507,4667,4262,
+    6071,5868,0,0,0,0,2575,3580,0,0,2898,3243,0,2673,0,0,
+    5768,2726,0,2899,0,322,3020,0,0,0,71,0,0,2226,0,3362,
+    2713,6104,0,149,97,6087,0,0,121,3931,228,2965,3150,2648,182,6611,
+    2140,4988,211,5306,184,1819,2492,4207,2501,0,2139,5327,3021,2801,5126,314,
+    3695,224,2677,26,174,2589,1605,179,5583,1830,3107,2142,2163,3381,5890,1648,
+    194,1676,281,2535,4876,2159,253,2908,157,96,245,5201,4041,3187,3000,6888,
+    3293,3338,0,2908,0,0,149,0,5537,0,2634,4974,1877,0,2579,0,
+    4429,3610,2886,1600,2633,11,281,187,2975,1603,0,0,3274,0,317,3271,
+    171,2999,5308,294,2017,1764,3776,1819,1963,320,1971,1896,2077,2705,2663,311,
+    3986,1914,4876,2911,59,2011,4129,4886,2655,3227,0,2083,2606,3008,2743,5127,
+    167,2866,218,2831,297,99,196,260,179,2008,6075,149,75,0,2978,2831,
+    3084,11,168,5669,0,211,3227,0,0,111,0,305,14,4486,2933,0,
+    4895,5223,183,321,3986,317,0,218,3077,4719,3822,6714,3073,282,214,3610,
+    1622,3164,3556,0,0,2215,3547,3557,0,236,0,4095,0,2842,2468,199,
+    5176,0,0,5884,1604,2402,3074,3823,262,319,0,193,0,1787,0,0,
+    0,7091,0,224,0,2413,6812,0,2988,0,175,0,4893,3875,0,3465,
+    2138,2073,0,3106,0,3129,74,2854,0,2602,0,0,4068,0,0,3209,
+    3769,223,169,281,0,280,0,0,0,3238,0,0,2835,0,3647,2732,
+    5497,3240,248,198,2899,3051,0,236,216,275,3194,3021,0,3912,3491,158,
+    2958,0,3184,0,4680,0,2931,0,1633,5318,0,2159,6194,3260,2734,13,
+    0,6473,234,0,4323,47,3838,0,99,1603,95,3077,2853,6732,2660,214,
+    0,2526,279,0,4428,2413,2996,0,0,0,0,0,0,2383,3084,0,
+    0,72,3219,1887,4866,3019,0,4228,0,6141,1692,0,2502,0,0,0,
+    2502,2736,2946,1708,2578,123,0,98,0,3052,0,0,302,5531,5417,0,
+    190,0,0,0,99,0,0,5152,2219,0,0,4206,2842,247,0,0,
+    3183,311,322,3012,2864,1604,3391,2626,6194,5090,4227,2556,3256,3989,241,6330,
+    267,0,0,272,2492,252,2975,203,5812,0,0,4234,2880,6833,4262,0,
+    0,0,0,0,0,25,0,2985,0,213,301,6120,220,3602,2006,267,
+    2908,3683,2732,1604,5768,3231,0,3054,4792,3632,4782,285,134,3250,0,0,
+    2227,207,5361,2627,0,2766,221,137,119,4795,1847,3194,0,133,298,3283,
+    3304,3315,2164,2078,3062,2530,0,309,189,3098,1820,6359,5582,3194,1698,12,
+    232,5207,202,0,174,4922,3177,211,0,0,0,3084,2657,133,320,1610,
+    0,0,2705,0,4782,6194,0,1614,3230,0,0,0,2965,3010,0,112,
+    4234,0,2640,3601,285,0,35,2622,5555,0,0,0,0,0,246,2673,
+    2738,0,0,2414,5582,2647,4481,6266,303,50,4527,301,2491,5538,0,0,
+    3132,0,0,6471,0,3020,282,0,5009,173,2589,1621,3442,3184,6742,3029,
+    2494,2402,1885,0,5150,5627,298,1609,0,0,1886,4649,5160,3047,4482,4437,
+    206,2270,226,2832,2803,15,6232,2734,3103,3306,2321,0,2953,143,2688,1601,
+    3557,3398,2350,196,2919,267,6038,2743,72,2787,2855,0,3117,2027,5637,2790,
+    254,189,273,0,0,0,4432,0,0,5201,2036,1676,3207,0,0,2923,
+    1678,3412,3064,1941,0,4307,3075,2997,221,0,169,2388,6239,0,0,0,
+    0,225,0,1676,4767,30,1754,3250,0,2945,1913,3195,3618,0,306,0,
+    0,0,0,0,2767,204,2699,3696,5802,5408,3383,2612,3007,2945,1767,4216,
+    95,2276,36,119,3558,0,0,57,74,0,0,0,0,6215,0,0,
+    0,294,0,0,2866,4676,0,0,0,6066,5002,2494,2490,0,279,5627,
+    197,283,3910,5854,0,0,122,0,2721,3097,2952,3063,4297,0,0,4314,
+    0,275,3548,0,0,2776,278,6130,2766,0,5306,0,0,0,2777,1745,
+    0,0,259,5581,0,4867,2745,3150,0,15,302,85,2890,6646,0,168,
+    0,0,0,1602,255,2733,234,2809,0,0,0,126,1743,0,0,0,
+    0,0,3095,7021,0,0,5536,0,0,0,0,0,1603,35,1996,0,
+    169,59,2078,63,217,3987,0,5370,2140,2338,2843,3129,3830,1611,2149,5803,
+    83,2008,3223,174,167,89,4461,3040,2824,3316,3153,4680,225,2073,5114,2954,
+    5015,2159,6297,3253,17,0,4612,2482,0,0,145,0,0,5669,0,0,
+    2302,4526,203,169,4977,0,3101,0,0,6276,5855,87,7112,0,0,0,
+    1847,95,13,0,208,1608,0,0,2093,5106,279,249,0,0,1907,271,
+    1626,3206,6611,2270,2836,2683,3315,3331,0,0,2842,1676,1604,2021,0,119,
+    4273,2899,0,5378,97,214,0,103,176,299,0,0,7097,1621,6367,3238,
+    6110,7238,0,2479,0,1624,0,2432,3055,6082,2699,2624,2161,5325,0,0,
+    300,0,0,4790,3075,155,0,2931,4747,0,2790,2655,2853,122,2615,2218,
+    2471,2681,2963,259,0,0,2479,2208,2503,2802,3391,131,2921,1962,2143,2480,
+    0,0,0,243,2970,4343,2376,2978,3024,0,4886,4869,2647,0,4658,0,
+    305,0,0,2897,267,0,4482,0,0,96,2388,83,5538,3064,0,0,
+    2368,0,3174,206,0,3647,48,95,0,3073,0,0,0,0,163,0,
+    2957,0,2518,2514,0,2752,4921,194,0,2474,0,246,185,0,148,0,
+    4429,0,3662,1829,3045,156,4124,3392,0,0,4576,0,89,0,0,83,
+    3145,2504,0,1809,0,124,2480,0,65,293,0,0,0,3347,0,2721,
+    2776,322,2151,2578,5849,225,203,3308,177,125,311,2795,4526,2347,159,2689,
+    4343,0,6436,2678,2151,168,3020,247,3046,2624,2667,243,146,2987,6038,6832,
+    1714,273,5538,1895,2084,5325,1888,2551,2601,2623,2170,0,3117,159,2225,2941,
+    1612,2534,2006,0,2876,5158,5851,1757,0,252,292,2007,227,4894,1606,5847,
+    3603,5669,2988,3131,3132,3195,2481,3119,2514,101,3787,3228,3150,2952,2382,3230,
+    0,0,2950,290,2966,2842,2845,0,2689,303,136,175,2217,107,3230,2624,
+    0,0,2733,0,1714,257,2715,2869,3040,4665,4703,0,4795,0,0,3020,
+    2536,1880,0,2557,2811,302,0,1897,320,0,214,1609,1874,0,2755,4507,
+    89,91,3168,0,0,76,0,253,2600,0,0,5756,2480,2490,0,183,
+    2169,6365,5107,0,0,0,276,5308,3295,0,2270,2515,215,184,2044,15,
+    220,281,0,177,0,2657,186,0,0,0,0,2908,0,2701,0,5747,
+    0,2517,0,3099,210,0,0,5846,0,5985,0,2921,6081,0,268,6645,
+    2743,0,3889,0,0,0,0,216,0,143,3315,2519,2998,2930,0,3902,
+    0,271,88,0,0,3197,64,5334,203,0,3441,2726,2975,5492,2029,2878,
+    0,0,1742,0,3052,208,5916,2778,2567,2855,3327,2611,5381,0,2689,0,
+    275,287,2337,1604,0,317,197,222,0,97,2272,0,0,91,2242,301,
+    2723,161,197,261,5746,4921,209,115,121,2831,2800,6715,167,6102,62,1678,
+    286,310,4218,132,6251,2743,103,2242,209,1808,316,317,2743,6358,5663,4710,
+    4930,3778,97,5882,0,181,2352,2089,2677,2006,2602,1780,1747,4657,4314,306,
+    2226,2486,224,1809,259,295,3196,2864,3196,2986,5978,3069,3194,258,5165,6350,
+    5994,2506,3390,53,4647,5317,3336,5099,0,2831,99,12,2077,63,4233,185,
+    3586,4481,254,6273,3216,4233,4026,0,2072,2219,2347,132,2897,0,4876,1886,
+    3074,2975,1678,0,0,2977,222,5171,2272,207,0,86,1846,3000,14,195,
+    297,230,2622,3176,2217,2849,0,317,0,0,289,3216,2851,3183,0,208,
+    2468,0,291,1623,2668,195,5554,199,0,1602,5224,4590,1603,1749,218,234,
+    264,1602,2743,0,6204,1655,3019,6351,3867,6240,0,3142,0,2737,39,2513,
+    2825,2858,5370,0,0,4454,0,0,5086,0,3161,2534,27,2945,250,2523,
+    6021,123,0,1606,0,4649,0,0,2966,3018,0,0,1715,3547,4216,0,
+    5142,261,257,1611,0,229,1602,0,0,0,0,3601,0,0,292,3625,
+    0,2468,0,0,0,6083,314,3205,0,23,5186,4888,0,6421,0,0,
+    2868,2964,0,2710,316,309,1690,5370,1609,0,0,2469,0,0,3332,7288,
+    265,159,2433,4652,0,2655,2699,2926,7041,3239,2447,0,0,0,2482,2291,
+    2560,2102,1904,0,174,2208,2921,2888,5968,3205,0,0,0,3282,2646,4796,
+    2970,274,2612,4208,4921,3096,2743,0,208,4702,156,2086,144,4888,2849,0,
+    1680,2777,0,4656,3241,198,1744,3097,3064,0,2968,5141,2348,1830,158,0,
+    0,0,2169,202,2789,5641,2512,60,0,0,0,0,231,199,0,2177,
+    29,4647,1941,295,3683,4785,6066,6686,134,0,0,4648,0,200,5826,0,
+    2941,2547,183,3174,3795,0,285,3956,0,0,261,313,4042,0,5090,3672,
+    0,2516,5151,0,2579,0,276,0,3140,0,3618,1765,0,244,2413,254,
+    0,2876,0,2908,0,0,110,0,0,0,2964,4547,0,5671,0,6067,
+    4058,1763,4356,5222,4563,5978,3131,173,215,1875,227,2745,246,0,6110,4868,
+    5107,4005,0,231,2151,2981,228,133,2006,3111,2480,2727,6205,311,0,0,
+    2986,2582,308,2603,252,2908,2638,2920,0,1809,90,5145,2229,27,0,2867,
+    122,315,278,7131,2680,198,6231,3165,5818,16,312,263,2847,4656,3284,2006,
+    4261,133,0,4101,0,0,2129,0,2690,4094,219,0,0,0,313,2479,
+    176,2699,4270,2556,1612,0,2823,2647,206,3273,3273,2600,1690,0,289,2601,
+    1962,198,233,5187,0,0,0,250,193,0,0,0,0,3780,3100,3042,
+    235,6938,186,0,0,0,0,0,0,0,0,0,179,3271,4702,0
+};
+
+static const unsigned short builtin_noflush7_displacements[1 << NOFLUSH7_BUCKET_BITS] = {
+    0,7,1,1,4,14,0,2,1,0,7,0,2,0,0,7,
+    6,5,0,1,0,0,10,7,1,8,1,6,4,4,17,12,
+    20,2,4,11,0,0,4,0,1,4,0,4,3,5,11,3,
+    0,6,0,0,1,1,0,0,10,0,6,1,1,6,0,0,
+    1,1,1,11,17,1,19,6,2,0,4,4,0,4,2,5,
+    7,0,9,3,0,9,6,1,1,0,16,5,4,1,1,6,
+    8,4,0,4,5,2,1,4,24,29,15,6,4,0,8,1,
+    0,4,5,3,0,0,1,2,0,4,5,14,2,1,16,1,
+    4,1,0,0,6,2,31,11,0,4,1,2,25,1,0,0,
+    5,2,12,9,1,2,9,12,1,9,15,0,4,0,12,1,
+    1,0,3,1,22,8,0,0,1,1,2,5,0,0,1,2,
+    9,4,0,0,26,7,0,2,40,0,9,4,3,0,11,5,
+    2,0,7,10,0,6,0,1,5,4,0,0,3,0,9,6,
+    0,12,4,0,0,4,0,2,7,0,2,4,0,9,23,29,
+    0,2,0,0,0,0,6,3,36,8,18,4,0,2,9,24,
+    0,1,16,0,0,9,0,0,2,28,0,0,0,5,0,3,
+    2,2,0,0,2,6,0,3,0,8,2,1,1,2,2,5,
+    1,5,2,1,0,13,0,0,3,0,6,1,7,3,1,3,
+    0,26,0,5,0,0,0,0,8,1,0,4,6,4,6,0,
+    4,25,2,8,3,0,3,15,1,2,7,22,0,0,1,0,
+    0,16,1,11,0,2,0,0,0,0,2,0,0,1,0,1,
+    0,0,0,3,3,1,0,7,0,5,9,0,3,3,0,0,
+    8,5,14,6,17,2,2,0,6,9,1,21,3,0,1,1,
+    1,5,0,17,2,0,1,8,4,4,6,1,0,2,0,0,
+    3,17,0,2,6,1,1,0,0,0,8,0,1,1,3,3,
+    0,1,14,14,4,0,8,7,0,0,0,0,11,0,12,1,
+    2,0,11,0,0,0,2,1,0,5,13,0,7,6,1,0,
+    0,1,12,3,0,1,1,15,10,12,0,2,0,1,12,1,
+    0,5,3,2,8,0,2,6,28,4,0,1,0,5,11,1,
+    0,0,8,0,8,5,3,0,1,5,0,3,7,1,5,4,
+    3,0,4,7,2,0,1,15,2,1,2,0,0,0,4,6,
+    3,0,1,1,0,0,0,4,0,0,1,7,1,0,4,10,
+    1,9,0,9,4,7,0,1,11,4,6,2,0,2,0,3,
+    0,0,3,1,7,1,2,3,1,8,2,0,2,1,0,3,
+    9,2,2,6,1,6,42,2,1,0,2,1,0,0,0,0,
+    4,9,8,14,0,6,0,1,0,8,0,7,1,0,9,3,
+    1,1,8,21,4,1,1,3,3,0,0,0,0,11,5,2,
+    13,13,20,3,6,2,4,0,0,0,2,3,5,1,3,0,
+    2,2,1,0,5,0,0,0,0,6,0,7,11,3,0,23,
+    2,2,0,4,1,0,0,1,3,3,8,5,0,2,1,2,
+    5,5,0,2,3,0,0,11,2,5,7,1,11,8,2,4,
+    3,3,2,5,7,12,11,2,17,0,8,2,2,0,62,1,
+    0,9,17,11,1,0,7,10,1,12,0,22,2,9,1,0,
+    1,3,0,8,14,1,4,1,3,0,2,2,5,5,12,7,
+    0,12,2,0,0,0,2,4,6,6,0,2,2,2,19,1,
+    2,2,1,10,1,16,1,4,0,3,1,16,22,0,1,0,
+    3,7,0,1,3,5,2,7,8,34,17,5,3,0,0,3,
+    0,1,0,0,0,0,10,3,1,2,3,0,3,0,7,4,
+    0,4,0,4,1,4,2,2,6,11,2,8,0,1,2,0,
+    0,0,1,6,1,2,1,25,2,3,11,4,2,27,6,3,
+    5,1,1,0,8,4,5,0,11,4,0,0,0,5,21,2,
+    1,0,0,0,3,2,7,0,4,1,4,0,16,0,2,2,
+    1,0,1,0,7,0,0,4,1,2,5,2,0,2,3,0,
+    6,0,0,0,3,4,1,7,12,7,4,0,8,6,3,0,
+    8,11,0,0,3,3,3,0,2,2,0,1,1,1,3,2,
+    0,4,3,10,22,0,1,5,1,4,0,1,0,1,0,3,
+    3,0,1,2,0,1,0,0,10,3,1,16,3,3,0,2,
+    10,12,0,0,0,0,2,0,0,0,4,5,1,5,1,2,
+    0,14,7,0,0,46,16,0,0,2,0,1,2,4,5,9,
+    0,0,1,9,3,2,3,1,4,2,27,2,3,0,1,2,
+    0,1,5,2,2,0,0,0,3,3,0,4,8,0,2,14,
+    18,13,0,2,0,30,0,0,0,20,0,3,2,3,10,0,
+    3,2,0,2,3,0,0,7,4,0,0,2,0,0,0,4,
+    3,0,0,8,2,6,0,36,0,29,8,3,12,0,2,3,
+    4,2,4,0,5,0,1,2,3,53,0,0,3,2,18,10,
+    25,0,6,4,0,0,0,1,0,7,10,0,6,0,3,1,
+    0,24,3,0,0,0,4,10,2,0,22,2,2,3,0,1,
+    17,0,0,0,1,1,1,1,1,1,2,3,1,18,7,0,
+    3,2,0,0,4,1,0,0,0,2,4,0,0,0,7,0,
+    12,1,5,0,0,15,0,8,0,20,0,5,1,2,0,12,
+    2,4,7,8,0,0,2,7,5,10,2,0,3,1,2,1,
+    15,1,0,2,4,1,2,0,1,1,2,20,1,0,7,0,
+    2,20,10,5,3,2,2,7,2,4,0,0,4,21,0,0,
+    4,0,18,0,20,0,1,11,0,1,7,3,5,11,3,2,
+    0,30,1,2,4,0,6,10,0,3,32,13,2,1,6,4,
+    8,0,5,0,2,8,2,1,0,0,1,3,1,10,26,0,
+    5,1,0,0,1,0,6,0,8,5,0,9,15,0,3,14,
+    0,0,1,2,2,2,0,9,5,1,3,0,10,1,2,1,
+    1,0,0,2,6,9,0,0,0,13,4,0,0,3,4,4,
+    13,36,0,0,5,4,0,3,0,0,3,0,29,3,15,0,
+    1,3,2,0,1,2,0,16,2,0,0,31,1,8,0,1,
+    9,0,3,4,4,1,0,1,0,2,0,0,5,42,9,9,
+    0,2,5,2,0,12,8,1,5,1,0,15,0,0,0,15,
+    0,3,6,1,4,6,0,0,7,7,3,9,0,2,21,0,
+    3,11,1,0,1,4,3,1,1,1,11,0,0,1,1,1,
+    2,4,1,3,0,14,14,1,0,4,18,1,1,12,14,4,
+    2,1,5,14,3,1,0,3,12,9,4,0,10,4,0,1,
+    13,36,0,2,0,0,0,16,12,1,15,0,18,0,1,0,
+    3,0,7,2,2,1,4,4,4,0,0,2,21,5,0,9,
+    26,8,1,21,0,2,41,0,7,0,0,0,0,2,0,3,
+    3,0,2,0,0,3,3,2,0,5,0,2,0,3,0,2,
+    0,5,0,8,1,0,1,0,2,6,2,0,0,0,19,2,
+    2,0,7,13,3,0,0,0,6,4,5,4,7,3,4,1,
+    3,0,4,0,3,1,4,5,0,2,0,0,0,4,1,0,
+    0,1,0,3,1,7,1,4,8,1,3,1,3,10,0,16,
+    3,0,6,13,4,0,0,1,3,0,7,0,0,0,3,9,
+    3,0,7,2,14,3,18,1,40,0,3,3,0,13,0,1,
+    2,4,0,0,6,0,37,8,2,1,1,4,9,11,1,3,
+    1,1,8,0,9,5,1,4,0,0,2,0,2,1,0,3,
+    5,1,0,0,7,9,7,1,0,0,0,1,6,0,4,0,
+    0,1,0,0,0,6,1,1,17,8,0,3,31,5,38,1,
+    0,0,6,11,5,4,2,2,18,8,3,0,0,8,1,15,
+    5,3,5,11,1,12,1,16,2,10,12,1,2,6,0,0,
+    0,0,6,3,0,10,6,4,1,0,1,1,0,2,0,19,
+    0,0,2,0,2,14,0,2,1,3,0,6,1,2,1,19,
+    11,0,0,0,3,11,27,0,0,36,1,2,0,1,1,2,
+    1,10,2,1,4,0,6,26,2,1,1,21,11,1,0,15,
+    4,1,0,0,9,1,2,0,1,1,9,0,4,1,3,0,
+    0,0,10,5,0,3,4,5,0,1,0,26,0,0,0,0,
+    6,7,0,0,5,3,15,6,3,10,8,8,2,10,0,15,
+    15,0,0,1,0,0,5,0,1,12,13,0,2,5,2,7,
+    2,1,7,5,3,1,1,0,0,0,9,1,1,3,2,21,
+    2,4,2,3,0,0,2,1,0,3,0,2,7,1,3,0,
+    0,0,5,0,0,2,0,3,1,3,2,16,0,2,0,5,
+    3,0,0,2,3,0,3,4,1,10,2,0,3,8,0,4,
+    7,0,17,11,3,1,5,0,2,10,0,6,0,0,0,3,
+    10,0,1,2,1,9,0,2,3,9,4,4,1,0,0,0,
+    1,3,2,4,2,0,3,1,7,12,1,3,12,0,1,7,
+    17,4,0,0,0,6,0,7,5,4,0,6,1,2,3,3,
+    7,4,0,0,0,7,11,7,3,4,6,12,0,25,2,20,
+    0,17,16,15,0,3,5,15,6,3,0,6,0,6,5,0,
+    10,9,0,0,2,2,1,0,25,1,2,1,23,10,2,0,
+    0,5,12,1,2,7,0,1,21,0,9,0,0,0,2,1,
+    0,4,3,13,1,2,0,4,7,3,9,1,2,5,1,2,
+    9,0,6,3,1,1,9,0,0,0,1,8,0,33,0,5,
+    2,1,0,8,8,5,3,0,0,4,3,4,0,0,11,0,
+    0,1,2,29,0,0,1,0,0,18,0,0,19,1,12,11,
+    9,0,36,0,1,5,1,7,0,51,2,4,11,0,0,2,
+    1,30,1,0,1,2,0,9,1,0,3,2,2,0,3,3,
+    10,10,6,13,3,8,0,8,0,1,1,4,0,6,3,1,
+    10,1,0,0,12,4,1,1,3,16,20,2,6,49,17,0,
+    8,5,0,6,5,0,0,2,3,0,3,3,0,9,4,2,
+    2,0,0,3,4,7,2,1,4,0,3,6,1,6,0,9,
+    11,0,28,3,1,2,1,3,0,0,3,1,15,3,0,5,
+    1,0,13,2,0,2,2,10,1,1,7,2,5,2,18,6,
+    9,0,4,0,4,0,2,3,3,10,2,9,0,0,3,0,
+    5,4,0,1,0,0,0,3,8,1,1,5,15,2,8,2,
+    2,0,24,4,3,0,2,4,1,0,1,27,4,4,36,2,
+    0,0,3,32,4,1,0,7,0,1,26,0,0,0,2,10,
+    0,2,12,6,3,8,0,3,16,17,1,1,1,8,20,10,
+    11,1,9,1,9,1,1,1,8,0,0,0,8,1,0,1,
+    2,0,5,3,14,6,0,16,17,6,2,2,2,0,0,0,
+    17,2,3,0,6,10,0,0,1,10,5,0,0,0,9,0,
+    2,3,6,7,18,0,0,5,5,9,0,5,2,18,0,4,
+    0,27,6,0,3,1,0,8,0,1,2,0,0,0,1,11,
+    0,0,1,6,0,6,1,5,20,0,4,0,5,1,0,1,
+    1,0,3,0,15,0,2,6,1,5,0,0,4,0,1,0,
+    0,12,0,11,1,8,6,0,1,0,3,23,1,0,0,2,
+    0,18,2,4,2,10,3,3,1,13,6,5,9,3,0,0,
+    8,3,6,1,0,2,2,8,5,12,0,3,0,5,0,4,
+    0,3,6,0,0,1,10,0,0,12,1,4,0,3,11,11,
+    0,0,1,3,0,0,35,36,10,0,1,0,2,1,3,2,
+    19,0,1,1,9,2,0,0,4,10,4,3,0,3,0,0,
+    2,0,0,2,0,6,8,6,6,1,0,1,2,4,3,0,
+    6,0,0,0,10,0,2,0,0,0,2,2,1,2,4,0,
+    8,5,7,1,0,0,7,0,2,0,8,17,2,4,2,1,
+    4,2,0,3,0,10,6,3,0,8,0,1,1,1,2,5,
+    6,6,5,1,0,0,2,21,4,0,13,0,8,1,6,3,
+    0,30,4,4,2,0,2,0,1,2,2,16,0,13,4,0,
+    3,2,2,1,0,0,6,0,36,0,5,0,3,1,0,1,
+    3,13,0,0,0,1,8,3,24,2,9,2,0,3,3,1,
+    1,7,7,2,10,15,0,1,0,0,0,11,11,0,4,0,
+    6,0,1,0,1,26,2,0,0,0,0,0,3,9,4,36,
+    0,0,0,9,7,14,0,14,0,4,9,1,10,1,0,1,
+    10,24,5,1,1,0,0,2,0,0,1,6,0,0,0,0,
+    0,0,26,1,2,0,1,1,9,0,0,9,8,4,6,1,
+    5,0,1,0,0,8,1,11,15,2,2,3,10,2,0,1,
+    11,2,6,0,1,3,13,0,2,4,0,1,11,1,0,5,
+    16,9,0,0,16,35,16,0,3,2,2,2,0,0,1,3,
+    1,9,2,1,5,0,3,5,18,6,1,0,1,0,0,17,
+    0,16,1,5,5,25,0,3,8,12,1,0,12,1,10,18,
+    19,20,0,0,2,3,3,7,6,0,4,4,7,1,8,1,
+    6,5,0,1,2,0,3,0,1,5,2,0,8,5,10,0,
+    1,0,5,0,0,25,0,8,2,15,2,1,1,0,0,1,
+    0,4,1,7,1,0,0,2,15,4,4,4,0,13,1,6,
+    0,0,3,2,0,7,0,1,1,0,39,0,15,5,22,43,
+    0,0,6,0,0,6,3,3,0,6,2,6,3,4,15,1,
+    4,14,6,1,4,4,0,11,0,1,3,4,11,8,7,0,
+    0,10,6,5,0,2,10,11,20,0,31,0,35,4,8,0,
+    0,2,9,2,0,6,0,12,8,4,10,2,0,7,16,0,
+    2,5,3,1,10,0,1,31,18,27,1,1,7,2,0,0,
+    0,3,1,0,3,0,4,2,2,1,1,2,7,7,4,9,
+    7,4,2,2,0,2,0,9,0,4,2,0,1,0,2,0,
+    9,5,18,1,38,21,0,0,2,0,2,0,2,4,0,3,
+    6,19,2,8,1,9,36,8,1,3,0,5,0,0,0,6,
+    3,1,24,53,2,0,3,5,3,9,4,4,0,0,0,2,
+    0,0,0,4,0,1,1,0,2,4,0,4,1,0,8,0,
+    1,0,0,1,0,3,1,0,3,0,5,6,0,1,0,1,
+    2,0,15,0,0,1,12,1,0,2,0,3,2,13,8,0,
+    1,0,0,0,19,7,5,5,0,10,2,0,7,0,3,0,
+    0,0,0,3,5,11,25,8,2,15,10,2,0,4,1,0,
+    1,2,0,3,1,0,2,14,0,1,2,8,1,11,0,1,
+    0,1,1,4,0,3,1,0,4,11,1,2,0,6,23,22,
+    1,0,9,0,0,0,1,1,0,6,4,8,12,1,5,0,
+    16,13,1,0,2,63,3,13,8,6,9,2,16,18,7,0,
+    8,1,23,1,1,1,9,9,16,0,2,1,2,1,3,3,
+    0,5,0,0,2,0,48,1,3,1,3,16,5,0,9,4,
+    5,0,2,1,4,3,0,4,2,1,18,6,5,2,6,0,
+    9,7,6,2,13,5,1,3,3,6,1,0,1,0,2,4,
+    0,3,10,1,10,0,0,1,0,9,10,19,0,5,19,4,
+    0,0,2,0,1,0,3,2,4,3,1,0,3,4,13,8,
+    1,1,4,0,5,4,11,11,0,21,1,0,6,0,3,9,
+    0,3,32,0,1,0,1,4,0,0,3,28,2,0,1,4,
+    6,15,1,1,0,0,33,0,13,6,0,4,1,1,0,0,
+    0,5,12,8,7,0,10,3,0,6,6,1,25,3,2,3,
+    10,16,4,1,25,10,0,2,9,1,1,0,0,5,3,3,
+    0,5,5,8,0,5,9,1,0,0,1,0,0,28,2,19,
+    0,0,12,3,2,8,5,6,0,0,7,0,4,0,0,1,
+    16,23,5,2,2,2,2,0,2,1,9,11,1,3,9,1,
+    1,5,1,8,1,3,2,0,7,21,0,2,14,1,0,11,
+    0,0,1,12,0,4,12,0,9,2,0,1,2,0,18,2,
+    1,0,4,0,0,3,0,1,0,7,0,4,3,1,1,0,
+    0,0,9,2,0,5,3,0,4,2,11,9,1,0,3,1,
+    1,0,9,6,2,0,0,0,9,1,0,0,4,4,2,10,
+    5,5,0,4,0,0,3,3,22,0,5,5,1,0,0,0,
+    13,1,2,5,0,0,0,0,5,0,2,7,10,3,12,1,
+    1,6,8,0,0,1,9,20,0,0,1,0,3,0,0,1,
+    11,5,2,1,2,0,0,0,0,0,7,0,0,2,3,4,
+    9,0,0,1,7,2,2,7,2,0,1,0,0,0,0,3,
+    0,6,1,1,15,19,8,14,0,14,10,1,15,4,1,2,
+    10,2,6,6,2,1,7,8,0,10,0,2,5,1,9,12,
+    18,4,10,11,5,13,1,0,0,0,0,3,9,1,1,5,
+    1,0,2,3,1,3,8,0,1,3,4,2,2,6,4,7,
+    11,3,22,1,4,0,9,7,3,6,1,13,1,0,10,1,
+    1,4,0,1,39,10,3,1,1,4,1,6,9,19,2,0,
+    16,2,0,7,5,12,1,4,1,6,15,4,5,11,0,5,
+    0,10,0,23,2,10,0,1,0,9,1,18,3,0,15,4,
+    11,1,13,5,5,3,1,0,4,0,19,2,0,4,0,13,
+    2,7,3,4,5,0,1,1,0,18,17,4,2,24,0,0,
+    13,2,4,0,0,1,0,1,0,11,3,3,3,4,11,5,
+    0,3,13,1,8,5,1,1,2,5,10,8,0,1,8,11,
+    0,0,3,1,6,1,4,4,12,3,2,3,2,9,6,0,
+    0,0,4,6,0,0,3,2,7,1,2,0,1,1,0,0,
+    2,0,2,0,0,6,29,5,2,17,2,8,2,9,5,2,
+    2,1,2,0,0,0,0,6,2,0,1,0,6,31,2,59,
+    0,1,5,0,0,0,0,0,0,6,3,2,6,2,2,1,
+    0,3,0,0,13,0,5,0,3,7,0,14,24,0,1,11,
+    0,2,26,1,0,9,0,4,2,2,0,0,10,2,21,0,
+    4,3,3,8,6,0,18,0,0,4,6,34,0,7,2,7,
+    1,32,0,38,15,0,4,20,1,3,6,17,2,5,13,0,
+    0,12,25,2,4,0,5,1,4,0,16,42,2,0,5,4,
+    4,18,1,3,14,1,5,1,0,6,3,4,10,0,1,1,
+    0,18,0,1,2,1,1,0,39,0,29,8,0,6,0,3,
+    3,0,7,2,2,7,3,1,8,3,1,1,0,0,4,3,
+    19,1,1,0,4,6,6,12,0,0,8,2,17,0,0,0,
+    6,0,17,0,2,1,10,1,0,5,1,0,0,10,1,4,
+    3,1,2,0,4,9,2,0,2,4,7,1,0,0,17,3,
+    4,0,4,8,19,54,0,1,2,3,8,0,3,4,5,6,
+    3,1,2,3,6,6,1,7,3,27,0,4,6,2,3,1,
+    0,0,1,0,4,1,2,13,21,1,2,4,1,7,0,11,
+    2,0,5,0,0,5,1,8,8,1,1,2,0,2,1,0,
+    3,2,3,17,2,20,2,2,0,15,1,0,4,5,2,1,
+    2,0,1,49,1,0,3,5,0,4,3,12,1,2,4,32,
+    0,1,0,1,5,1,2,3,3,1,7,3,1,18,3,4,
+    0,12,3,5,0,13,3,6,1,0,21,5,1,6,0,5,
+    17,19,19,25,14,7,1,1,3,1,2,0,1,0,0,8,
+    4,0,2,5,1,1,0,1,9,2,18,5,0,5,6,15,
+    0,8,5,3,5,10,2,0,1,5,0,4,41,3,1,1,
+    0,1,0,10,0,6,0,0,0,0,1,1,16,4,1,0,
+    6,1,5,6,0,0,0,4,9,6,4,9,2,16,3,13,
+    0,9,4,5,18,0,0,7,0,10,0,2,0,0,1,1,
+    0,2,2,0,1,1,4,8,1,4,1,1,2,1,0,0,
+    7,0,3,1,1,1,0,2,7,1,4,1,4,8,0,9,
+    7,19,10,1,5,0,5,4,4,0,1,0,7,2,13,1,
+    0,4,7,0,5,0,1,1,0,9,11,1,11,9,23,17,
+    0,6,0,4,1,5,15,2,39,0,2,1,3,0,0,3,
+    0,6,19,0,3,0,0,8,9,9,2,2,0,26,0,4,
+    5,1,19,1,2,2,2,3,5,0,1,0,2,1,21,0,
+    0,0,5,0,4,8,1,2,1,3,0,2,0,7,66,22,
+    3,1,1,2,0,0,12,14,0,4,2,0,12,1,3,1,
+    0,1,1,0,0,4,16,1,9,7,0,2,11,17,0,11,
+    2,0,2,4,2,11,0,6,3,0,2,0,0,3,0,4,
+    1,0,0,0,14,14,4,2,0,0,4,6,0,2,1,0,
+    2,2,0,8,0,9,15,0,10,3,4,3,8,2,7,7,
+    3,6,14,6,0,60,11,3,16,2,1,1,14,6,10,0,
+    2,2,0,0,6,0,0,6,3,1,4,0,3,2,8,0,
+    0,0,2,0,2,0,6,4,10,0,10,19,2,0,0,2,
+    0,1,0,9,10,0,4,3,12,2,23,3,0,0,3,2,
+    10,2,0,4,0,1,1,5,0,4,0,0,4,6,1,5,
+    1,13,4,2,0,2,5,11,0,1,13,0,1,5,7,5,
+    0,34,4,1,58,12,8,9,0,8,0,8,17,7,20,8,
+    6,0,2,4,1,2,1,1,2,4,12,2,0,3,1,1,
+    0,1,0,3,1,0,0,0,0,0,3,4,10,0,0,0,
+    13,0,0,0,0,13,12,5,3,0,0,2,0,1,1,0,
+    4,30,0,9,9,0,3,4,1,10,2,26,6,0,0,3,
+    0,0,0,2,6,8,23,9,4,0,3,0,0,1,4,6,
+    0,1,7,0,7,9,4,1,3,0,7,0,0,3,14,3,
+    1,18,0,13,0,23,2,0,1,7,1,2,3,0,7,0,
+    5,3,4,0,0,1,2,3,18,2,1,0,1,4,4,8,
+    9,21,5,1,0,3,4,7,5,0,5,4,8,1,9,6,
+    5,1,0,1,2,2,1,8,7,0,0,1,3,0,0,0,
+    5,0,2,0,2,2,4,9,1,22,22,0,0,1,0,2,
+    1,0,1,11,0,1,9,0,0,1,1,6,2,4,0,0,
+    8,9,0,1,5,2,37,4,3,1,4,3,1,0,0,19,
+    2,1,10,0,1,2,0,0,0,2,4,2,2,0,1,4,
+    0,8,0,1,10,8,5,1,6,1,0,22,14,1,0,2,
+    0,2,10,26,0,14,6,0,0,5,3,0,11,0,0,2,
+    8,0,4,0,0,10,1,1,0,4,4,5,0,2,2,0,
+    1,1,0,5,0,0,0,10,0,0,4,13,1,0,5,0,
+    6,2,17,6,9,3,1,2,20,6,8,5,26,2,0,1,
+    33,0,2,2,18,19,2,1,2,6,5,1,15,0,2,4,
+    0,28,1,9,0,0,11,0,0,18,3,0,1,5,49,0,
+    8,4,4,2,1,0,0,1,1,0,13,3,0,3,3,0,
+    0,6,5,8,0,4,0,0,9,4,2,0,0,7,1,9,
+    5,2,12,0,0,14,8,0,0,1,0,3,2,0,0,1,
+    1,33,4,0,5,0,0,3,0,0,0,2,0,12,0,1,
+    0,2,24,0,5,2,1,4,8,0,2,0,4,3,7,1,
+    1,0,0,1,12,1,23,21,2,4,1,2,0,2,0,4,
+    0,9,0,1,2,0,4,2,12,18,3,8,2,2,0,16,
+    0,3,0,0,0,31,0,4,0,2,6,16,0,0,2,4,
+    19,0,0,3,5,6,1,2,11,19,0,0,0,1,1,2,
+    6,0,4,0,11,14,27,1,7,0,5,1,3,1,0,0,
+    0,0,2,4,6,10,4,0,5,0,6,0,3,14,0,0,
+    3,0,0,0,1,0,0,4,0,0,3,4,0,23,3,3,
+    0,0,4,0,4,10,1,0,8,14,1,13,2,1,2,5,
+    1,1,1,7,7,1,0,5,2,1,8,1,1,3,4,2,
+    0,17,0,1,3,13,16,3,3,0,8,2,2,5,0,2,
+    18,5,2,4,0,2,16,3,2,2,3,1,7,19,17,1,
+    1,1,1,0,13,2,0,3,1,7,0,0,4,9,7,0,
+    31,8,23,0,0,2,10,0,0,3,6,0,4,21,5,3,
+    0,3,4,8,4,25,1,7,3,1,13,32,0,1,1,0,
+    3,0,11,1,2,0,19,2,9,0,5,0,6,4,4,5,
+    0,6,0,0,1,39,11,4,4,4,5,5,13,3,15,4,
+    1,0,5,8,5,0,11,2,2,10,5,1,1,4,1,0,
+    1,2,11,0,0,13,1,3,8,1,1,5,0,10,21,8,
+    11,1,19,8,4,16,0,0,2,9,0,5,1,4,1,4,
+    9,8,2,1,3,3,1,12,0,0,2,1,8,10,15,3,
+    0,0,3,0,9,7,0,2,3,10,4,1,9,13,13,0,
+    0,5,0,0,1,8,6,1,1,2,0,1,0,0,14,5,
+    2,5,3,3,7,5,0,8,64,0,5,0,4,0,10,12,
+    1,0,2,10,24,3,0,0,0,11,0,0,4,16,3,0,
+    0,0,1,14,0,0,4,0,8,15,4,0,2,0,16,5,
+    0,0,4,6,0,0,0,27,0,2,40,1,3,0,12,0,
+    1,0,2,25,1,2,2,7,3,0,0,4,28,0,1,0,
+    0,3,7,1,0,1,0,2,1,0,0,0,7,0,19,25,
+    5,1,6,11,5,6,16,0,2,1,0,8,14,0,7,0,
+    4,17,1,1,13,1,2,7,13,26,0,0,4,1,1,4,
+    1,0,0,3,4,14,0,1,4,7,0,7,3,4,1,0,
+    0,2,0,7,1,8,2,1,6,0,13,0,7,0,10,19,
+    0,3,3,14,3,0,3,0,3,3,0,0,3,1,0,3,
+    0,1,1,35,1,1,2,0,2,8,4,0,0,0,2,0,
+    0,0,5,11,5,23,0,1,4,4,0,9,0,8,6,10,
+    19,4,25,0,0,1,5,14,0,3,5,3,0,0,5,12,
+    1,2,3,3,8,0,4,8,5,9,0,5,11,0,2,4,
+    2,12,7,0,1,3,1,5,0,0,25,6,2,3,0,6,
+    6,3,2,0,1,10,0,0,0,12,3,11,0,4,23,0,
+    0,1,20,2,0,12,2,5,0,0,7,1,0,32,0,6,
+    13,0,2,0,13,1,0,13,19,0,1,19,0,1,15,0,
+    0,0,18,1,2,6,1,11,0,1,0,1,8,0,6,1,
+    3,2,1,5,9,3,1,4,0,0,4,0,2,2,4,10,
+    4,4,27,14,2,6,6,0,2,10,0,7,3,9,7,29,
+    9,0,2,0,0,1,1,20,19,0,0,0,16,12,1,6,
+    5,1,5,0,0,3,0,1,3,5,17,1,9,4,0,6,
+    0,0,6,12,1,39,1,3,6,12,2,0,3,1,4,0,
+    0,0,16,0,0,6,4,0,0,10,0,9,3,14,1,0,
+    5,21,4,0,4,0,28,26,0,2,0,1,0,0,11,1,
+    8,5,4,0,0,8,0,13,1,0,11,1,0,19,0,2,
+    16,3,0,6,26,15,0,2,0,8,11,1,0,18,0,0,
+    8,12,0,1,1,0,0,0,5,22,6,1,0,0,9,0,
+    7,0,3,6,7,8,8,6,3,0,5,6,5,18,4,4,
+    0,36,3,19,0,0,0,3,0,11,0,3,2,6,1,10,
+    1,0,14,5,8,0,0,2,0,11,2,46,17,13,8,6,
+    4,0,0,49,7,9,0,43,0,19,1,0,0,1,0,13,
+    1,0,2,0,17,1,0,6,6,1,0,15,4,2,0,0,
+    4,6,2,1,10,2,16,1,7,12,0,11,7,9,0,9,
+    1,3,2,1,3,13,6,1,2,10,1,2,0,18,17,6,
+    0,0,0,3,1,4,1,1,0,0,8,0,2,2,17,1,
+    1,1,27,0,0,10,4,25,9,6,0,20,0,14,0,3,
+    2,0,12,4,9,0,6,3,3,0,0,0,7,0,0,25,
+    21,0,0,0,0,0,5,12,14,0,1,1,7,0,0,40,
+    0,1,0,2,18,0,4,4,0,5,5,2,1,2,2,9,
+    2,0,0,0,0,13,2,7,0,5,4,0,1,4,24,2,
+    0,6,1,0,0,0,0,14,0,1,20,11,9,9,0,10,
+    0,6,0,1,4,15,21,53,0,0,3,13,19,2,8,9,
+    0,7,0,10,91,5,2,0,6,4,7,3,32,3,6,7,
+    4,0,0,2,9,0,2,2,2,21,1,0,4,9,2,1,
+    0,8,0,0,2,0,8,11,1,4,57,54,1,21,0,2,
+    0,9,7,1,10,9,7,2,6,16,4,19,6,3,11,15,
+    0,11,0,0,14,0,0,53,1,0,5,0,4,1,3,1,
+    1,1,16,3,0,11,0,3,3,4,2,1,7,18,13,1,
+    0,3,4,4,14,0,4,2,0,7,1,0,1,0,1,7,
+    2,10,0,0,0,11,7,4,7,2,6,2,2,30,1,19,
+    5,0,6,0,5,4,1,0,9,2,10,3,21,0,12,1,
+    0,3,0,0,0,5,13,0,10,4,1,2,0,8,0,4,
+    0,8,3,0,2,11,5,4,5,1,0,1,11,0,8,0,
+    7,22,7,9,18,4,1,0,0,3,0,5,2,8,7,1,
+    32,0,0,1,18,14,2,0,1,1,22,1,2,0,15,0,
+    0,23,1,2,0,7,1,0,1,3,3,7,0,0,0,0,
+    0,4,10,0,21,2,6,7,5,4,7,2,1,0,7,2,
+    0,4,4,1,0,0,0,0,0,2,4,7,16,20,2,4,
+    10,0,2,21,1,1,4,5,5,2,17,0,2,0,7,1,
+    1,2,0,19,5,0,1,22,18,7,0,0,0,39,6,0,
+    2,1,0,0,18,0,6,6,5,2,8,2,0,10,12,11,
+    4,17,27,3,2,0,13,3,1,3,6,9,0,8,3,2,
+    12,0,2,0,4,13,7,15,12,11,9,2,6,1,4,3,
+    3,0,1,5,0,3,0,2,21,5,2,0,1,18,16,2,
+    1,0,55,1,4,7,12,0,0,6,1,19,1,0,6,17,
+    4,3,0,1,0,0,18,1,6,7,2,3,4,8,0,6,
+    2,25,1,2,1,36,0,1,1,0,1,4,16,7,0,1,
+    3,0,4,10,5,9,30,8,17,0,4,0,10,18,1,4,
+    0,3,0,1,8,23,10,1,1,0,5,7,4,4,2,0,
+    5,8,20,0,18,3,9,4,7,0,1,0,7,2,9,0,
+    1,26,2,1,2,4,3,1,0,0,0,15,5,5,10,61,
+    8,0,1,9,2,1,1,0,1,10,5,4,10,11,0,6,
+    24,1,5,3,1,6,4,0,5,6,0,19,2,0,3,2,
+    0,3,1,37,18,2,1,2,3,6,2,3,1,0,4,9,
+    0,0,0,13,2,1,13,1,10,52,2,0,24,1,9,12,
+    17,1,0,3,7,1,4,0,17,2,11,9,7,1,1,4,
+    21,0,7,1,1,0,33,6,2,1,2,19,0,0,0,1,
+    3,0,0,4,0,1,10,6,0,0,0,3,0,10,9,12,
+    0,4,1,1,1,2,6,4,3,0,1,6,0,2,0,0,
+    3,0,4,0,1,0,0,0,4,2,7,0,13,1,3,8,
+    15,8,3,2,19,1,57,5,5,7,1,1,0,3,11,1,
+    12,4,1,3,1,1,2,51,0,7,5,1,7,20,11,3,
+    0,7,0,2,34,32,0,15,0,0,0,10,0,1,4,1,
+    0,0,2,9,19,0,0,10,1,18,1,7,3,20,2,0,
+    0,5,6,2,12,55,0,3,0,25,1,5,2,0,2,6,
+    2,0,11,1,2,1,0,9,0,0,2,18,16,2,8,0,
+    3,1,1,0,13,0,47,1,0,4,18,4,8,1,0,3,
+    0,13,6,16,2,1,0,6,2,1,1,2,3,1,0,10,
+    1,0,5,2,1,10,0,0,25,1,4,3,0,17,6,5,
+    7,1,4,4,37,6,0,12,0,2,4,16,16,2,6,0,
+    0,4,0,4,8,0,23,4,2,6,11,0,0,0,1,11,
+    1,9,1,2,25,6,0,0,9,4,0,15,0,0,2,0,
+    27,1,9,0,1,0,0,13,1,0,0,9,0,7,3,4,
+    0,9,6,5,5,17,4,5,1,6,2,0,7,2,1,1,
+    55,7,2,0,0,2,0,10,0,1,4,2,6,2,5,3,
+    3,10,0,1,1,33,22,3,3,4,6,4,0,0,9,0,
+    4,8,17,1,0,11,2,3,2,5,1,11,9,11,0,0,
+    1,11,1,0,3,13,11,2,20,3,0,0,3,12,0,1,
+    0,1,3,1,1,5,2,5,3,1,10,4,2,4,0,0,
+    0,16,2,1,16,3,9,0,12,1,0,3,23,2,0,0,
+    0,2,0,0,8,4,4,7,18,1,20,29,0,3,2,19,
+    0,4,3,10,4,0,0,2,2,18,6,0,0,7,37,5,
+    0,24,20,0,4,0,1,12,12,0,0,7,30,2,10,7,
+    0,6,12,1,3,11,1,8,0,11,7,0,8,14,0,34,
+    0,0,0,20,5,5,0,5,36,0,0,0,9,24,2,37,
+    2,0,0,0,0,11,4,1,0,3,16,1,1,16,1,7,
+    0,9,0,0,1,0,3,25,0,11,1,2,7,1,4,0,
+    0,9,3,2,2,0,0,16,0,27,20,0,25,0,22,17,
+    1,1,1,8,19,2,1,22,2,11,2,1,0,11,0,4,
+    0,2,8,1,0,10,1,44,0,4,2,1,4,0,10,0,
+    6,7,64,11,33,5,11,12,1,13,0,4,16,8,0,0,
+    0,5,1,12,3,2,6,0,14,3,9,8,17,0,1,10,
+    11,1,2,4,7,1,1,4,0,39,3,25,2,12,0,5,
+    4,1,12,3,11,22,7,0,2,1,29,0,34,15,1,1,
+    5,3,0,6,1,6,26,2,28,6,1,2,1,3,7,33,
+    8,0,5,0,0,33,0,8,0,0,2,6,1,28,0,5,
+    0,12,15,0,1,2,0,11,0,1,4,0,4,0,2,0,
+    3,1,0,5,9,0,0,21,6,0,5,1,0,0,0,1,
+    19,0,36,2,2,5,12,6,3,34,13,5,12,3,9,3,
+    2,13,40,0,0,0,0,29,0,5,5,8,2,0,2,11,
+    0,3,4,2,0,4,0,14,4,1,14,13,4,0,27,1,
+    10,4,15,0,30,1,0,0,0,15,21,4,2,58,0,5,
+    46,4,0,1,1,0,2,1,16,7,5,7,26,2,1,10,
+    1,1,6,2,0,2,11,6,3,0,2,14,2,5,0,18,
+    2,1,2,0,18,3,0,2,4,8,5,6,0,10,6,0,
+    0,6,0,0,1,0,0,5,14,0,5,13,1,6,8,3,
+    2,4,26,8,3,37,0,1,0,0,3,0,2,0,6,2,
+    1,32,0,3,2,6,16,1,0,4,0,1,1,3,7,2,
+    0,2,11,15,0,6,0,7,1,2,13,4,0,2,12,6,
+    6,2,17,2,2,0,18,2,8,3,5,1,15,0,0,7,
+    8,1,0,1,12,4,0,2,0,1,1,16,0,1,0,4,
+    12,3,13,1,4,7,2,0,7,6,1,15,10,0,99,6,
+    5,0,4,34,1,5,0,19,2,2,0,12,3,14,0,9,
+    4,0,5,2,3,18,12,1,0,1,0,0,5,1,0,6,
+    0,0,0,64,1,11,9,4,3,4,8,2,4,6,0,7,
+    3,7,3,15,23,6,1,1,41,4,13,7,19,0,4,3,
+    1,38,8,0,4,4,2,29,7,2,0,2,1,6,11,4,
+    8,16,12,10,1,8,0,1,0,2,30,0,1,9,8,2,
+    1,0,0,3,34,1,0,0,1,16,0,0,2,12,21,1,
+    1,8,7,0,0,14,1,31,1,1,5,0,17,2,7,0,
+    1,0,10,3,2,0,0,0,2,11,23,2,7,3,0,0,
+    4,0,4,56,0,0,6,0,22,49,33,3,0,13,2,1,
+    1,0,1,13,2,13,0,7,5,23,5,1,19,8,0,0,
+    38,0,4,2,1,1,0,13,8,8,24,0,0,36,1,18,
+    13,1,0,1,0,6,20,5,8,0,0,3,0,7,2,1,
+    0,0,0,16,12,10,24,12,0,33,8,0,0,1,5,0,
+    1,5,12,39,4,1,0,5,3,7,1,0,0,2,1,0,
+    9,0,1,50,0,0,4,0,3,2,1,29,4,0,1,10,
+    0,1,2,0,23,0,4,13,39,1,34,4,13,0,4,0,
+    0,17,5,1,2,14,3,0,0,0,0,2,13,0,8,11,
+    1,0,0,1,0,7,12,15,11,1,1,7,7,0,0,5,
+    1,0,2,1,12,1,2,21,0,1,0,0,3,3,0,6,
+    14,1,7,1,2,21,17,10,6,5,8,11,19,0,0,13,
+    0,3,1,4,0,3,3,32,3,7,0,8,0,0,1,0,
+    11,4,0,20,15,16,15,6,3,0,1,3,0,9,2,0,
+    1,16,27,11,0,3,3,3,0,5,3,0,3,6,0,22,
+    2,0,0,10,15,0,1,0,0,5,4,0,17,5,0,2,
+    8,0,8,4,0,3,13,7,0,1,0,3,2,11,4,1,
+    1,4,0,12,3,19,33,0,5,0,0,0,6,27,19,7,
+    0,3,0,1,2,49,11,4,13,14,2,4,6,0,2,3,
+    0,0,4,0,1,0,7,3,0,6,0,47,1,0,1,0,
+    5,0,4,0,0,0,0,37,28,4,12,1,0,21,2,15,
+    6,12,4,0,1,14,0,43,0,2,0,3,6,8,0,8,
+    3,4,2,0,3,5,0,1,11,0,1,1,9,14,11,2,
+    15,18,4,8,0,0,14,0,0,17,5,13,5,3,9,3,
+    0,2,0,3,0,1,0,7,1,0,1,0,21,13,1,2,
+    0,3,1,0,0,13,33,1,3,14,1,3,40,2,4,9,
+    3,0,7,3,0,1,2,0,15,0,1,3,0,0,8,0,
+    5,33,3,1,1,2,4,11,1,8,18,5,19,0,0,6,
+    2,4,5,1,12,0,5,5,1,0,0,1,8,4,0,1,
+    6,2,6,0,3,0,2,6,33,0,5,7,4,0,5,0,
+    0,1,0,9,0,1,0,1,27,0,1,3,2,2,9,0,
+    7,2,7,6,0,10,0,0,17,1,10,8,6,29,0,32,
+    0,1,2,2,7,3,10,3,3,9,2,0,6,6,1,5,
+    0,0,1,85,2,1,1,3,7,6,8,4,2,4,18,0,
+    1,4,1,2,1,0,0,0,1,0,1,4,5,2,0,1,
+    0,1,0,1,0,5,0,0,0,40,3,1,1,0,3,4,
+    8,1,18,6,1,1,4,2,4,0,27,5,1,0,22,18,
+    5,2,14,1,3,3,0,0,5,3,0,0,9,0,1,0,
+    26,0,0,0,13,5,0,1,0,5,7,9,30,33,9,0,
+    2,6,6,10,32,0,2,1,12,0,5,3,21,0,21,3,
+    0,3,9,3,11,2,11,0,4,4,5,0,0,9,38,1,
+    0,9,0,0,3,0,0,2,3,12,28,7,1,1,6,0,
+    35,10,0,1,1,5,0,9,0,1,2,8,0,2,14,2,
+    2,0,32,11,1,2,2,4,14,45,1,2,53,14,0,7,
+    1,4,9,59,0,3,1,9,1,0,0,2,17,0,5,0,
+    2,0,26,3,0,11,1,0,15,0,27,16,1,16,25,4,
+    0,1,12,0,11,3,5,5,26,0,1,7,19,11,19,0,
+    0,16,1,0,25,15,31,1,3,17,0,0,3,2,0,0,
+    0,0,23,4,0,1,24,10,6,0,3,8,0,1,51,26,
+    0,0,0,3,4,20,2,6,8,1,1,29,8,5,0,0,
+    10,6,1,8,1,6,0,0,0,0,5,19,37,10,16,11,
+    3,0,3,0,8,0,13,27,1,0,1,0,30,0,3,7,
+    2,0,1,34,0,2,0,2,1,0,1,1,0,58,0,4,
+    0,3,2,0,2,0,6,16,3,2,21,6,1,7,2,5,
+    3,7,5,1,0,2,1,3,16,0,0,2,1,29,5,1,
+    2,2,13,2,7,27,0,2,0,30,17,0,17,2,0,1,
+    7,9,4,0,5,0,32,11,7,1,8,3,14,1,5,3,
+    0,0,1,0,0,16,3,13,16,4,32,0,1,9,0,0,
+    14,3,2,2,13,0,7,6,17,0,4,0,0,2,0,0,
+    2,6,12,23,1,0,8,5,1,0,4,9,0,6,0,24,
+    0,6,7,13,1,17,6,10,4,2,2,9,5,0,13,13,
+    0,58,12,11,0,2,2,12,4,8,39,8,0,13,19,1,
+    0,10,0,17,0,7,1,43,1,7,0,5,16,10,7,4,
+    20,0,2,1,0,14,1,11,1,4,1,56,32,3,1,22,
+    0,16,0,7,0,7,1,1,2,0,27,0,2,1,0,9,
+    0,0,3,0,6,0,3,13,64,1,0,0,0,6,1,10,
+    0,0,1,1,4,8,2,6,18,7,1,2,1,3,4,0,
+    6,1,2,4,1,4,14,0,0,16,2,2,3,0,0,17,
+    2,0,0,46,11,0,0,22,8,5,2,9,8,6,9,4,
+    3,0,4,14,0,0,1,39,8,8,2,0,2,4,1,12,
+    1,4,0,6,8,5,10,0,38,0,10,0,1,3,1,3,
+    3,0,3,7,6,6,4,0,0,2,8,3,2,0,0,0,
+    0,12,3,44,6,0,7,1,38,0,4,0,5,4,0,0,
+    2,2,14,15,3,1,2,4,0,2,3,4,28,7,2,26,
+    8,17,74,6,30,2,1,4,16,6,0,6,58,0,15,6,
+    0,6,15,10,8,5,13,2,7,1,3,2,0,1,0,3,
+    1,3,16,5,4,2,4,17,8,3,0,1,9,10,0,18,
+    1,1,0,0,7,0,0,0,4,1,26,2,3,3,12,3,
+    0,17,0,12,3,2,4,4,2,6,0,10,2,1,93,0,
+    15,1,8,1,38,0,14,4,1,5,6,2,6,5,46,25,
+    11,0,0,0,9,4,6,3,10,0,3,0,3,2,7,3,
+    10,0,0,4,8,31,12,11,5,15,3,0,12,0,26,1,
+    14,0,26,0,0,12,2,4,6,7,3,1,6,0,4,13,
+    5,0,3,0,0,37,0,31,2,3,3,3,29,1,11,2,
+    42,1,4,3,1,2,10,10,10,0,2,0,3,1,0,2,
+    1,0,0,4,0,0,23,1,0,17,5,0,10,3,9,0,
+    1,0,1,16,1,0,3,8,15,19,0,6,2,0,1,1,
+    0,6,5,1,0,0,8,0,0,0,3,0,13,0,0,2,
+    11,4,0,0,3,1,10,7,32,4,1,1,1,6,4,4,
+    8,1,9,3,0,0,5,7,30,0,16,0,5,1,0,0,
+    17,5,2,2,1,0,4,0,6,0,0,8,4,6,2,0,
+    40,9,11,0,17,3,3,0,19,5,7,3,1,68,3,2,
+    0,6,1,15,0,1,34,0,16,7,4,18,11,2,1,3,
+    5,8,0,4,1,1,0,22,2,5,7,0,2,5,19,2,
+    15,2,4,2,2,13,8,2,0,8,2,0,0,1,8,0,
+    0,2,1,1,0,6,72,2,0,3,0,9,5,5,3,16,
+    1,1,0,0,0,6,2,4,17,10,0,10,25,0,5,8,
+    0,0,11,0,12,0,4,8,5,0,6,30,3,0,0,1,
+    7,0,9,2,5,3,2,1,3,19,19,4,0,1,31,5,
+    7,1,1,3,5,18,2,5,0,4,32,9,13,2,16,2,
+    22,62,2,3,5,0,1,10,15,1,0,5,3,0,3,4,
+    4,5,7,11,7,8,13,1,4,0,1,5,8,5,0,10,
+    2,24,3,3,14,0,0,6,0,6,35,2,1,2,0,0,
+    5,1,9,1,5,0,5,7,0,0,0,5,2,2,2,0,
+    0,9,4,0,3,2,3,5,3,7,50,1,21,1,0,0,
+    11,5,0,2,0,0,0,23,1,1,6,1,0,3,8,3,
+    2,5,1,1,2,0,3,6,3,0,3,6,1,5,3,4,
+    4,0,35,0,3,2,1,1,0,7,6,17,2,0,0,35,
+    13,6,5,9,2,14,0,0,0,2,0,0,7,12,1,5,
+    0,1,0,7,0,0,9,0,1,6,3,15,4,0,3,3,
+    2,33,0,1,2,5,10,25,17,1,0,19,2,1,4,31,
+    4,13,1,27,0,7,1,10,1,1,4,3,11,5,0,7,
+    4,26,11,10,0,2,14,9,8,3,12,3,6,0,2,0,
+    3,0,8,0,0,10,0,0,0,1,4,3,0,3,1,5,
+    2,0,3,2,1,3,22,0,5,13,1,3,70,0,7,2,
+    16,2,0,1,10,0,1,28,3,0,0,2,1,0,14,1,
+    5,1,6,50,1,8,13,0,14,2,0,52,9,2,4,0,
+    0,14,1,3,7,1,22,2,4,0,2,4,0,0,1,0,
+    2,9,1,3,0,5,11,1,0,2,8,1,1,20,6,11,
+    2,0,10,3,0,0,9,0,1,6,28,3,4,1,0,4,
+    4,9,24,18,0,2,2,0,10,0,17,1,2,10,4,20,
+    0,5,2,0,0,3,2,0,3,11,1,9,1,3,6,17,
+    0,12,1,1,0,2,0,0,2,1,1,0,1,8,17,5,
+    19,0,1,21,1,1,6,3,1,4,6,0,0,5,21,9,
+    17,2,5,8,6,0,10,0,8,10,3,5,64,4,6,3,
+    0,13,3,1,14,5,18,0,0,5,9,9,4,5,2,3,
+    14,7,3,22,15,29,3,0,1,0,55,40,1,18,9,0,
+    9,10,0,12,11,0,0,0,4,9,3,0,0,6,0,0,
+    18,2,0,1,7,0,6,0,9,13,8,3,14,17,31,2,
+    17,5,4,0,2,1,0,4,0,3,7,0,9,11,0,0,
+    26,0,0,5,6,0,2,1,3,0,0,0,1,2,0,28,
+    2,12,1,12,4,8,3,10,0,0,0,1,1,16,16,1,
+    6,0,1,1,0,1,45,3,68,0,2,0,1,3,0,5,
+    2,3,9,14,0,12,1,0,17,23,8,0,0,2,35,0,
+    5,3,0,5,5,5,0,0,13,1,0,1,3,1,1,2,
+    0,0,0,48,1,3,28,4,6,37,9,1,0,3,0,1,
+    1,3,3,59,0,23,4,12,4,1,24,40,2,1,5,29,
+    2,8,0,10,5,1,1,2,2,0,6,3,6,0,1,9,
+    3,26,13,6,1,14,2,14,3,0,5,29,3,1,0,20,
+    0,1,0,0,2,5,5,1,3,3,9,1,10,0,10,1,
+    3,0,1,2,2,0,0,0,0,6,5,0,0,1,8,44,
+    0,1,4,1,14,41,3,0,1,0,6,0,3,1,5,0,
+    16,18,4,3,4,8,3,4,13,2,4,1,2,10,31,0,
+    0,1,0,0,8,36,3,2,83,1,55,2,0,0,2,82,
+    1,0,1,0,1,9,0,8,1,8,37,2,8,17,0,1,
+    9,0,4,0,0,1,5,0,2,2,3,5,11,3,13,0,
+    69,1,1,4,6,33,3,3,13,1,0,19,1,2,1,1,
+    0,0,8,0,10,27,9,0,2,3,13,4,8,0,4,1,
+    0,4,42,2,1,1,8,12,8,0,17,21,0,5,0,0,
+    2,4,15,1,1,0,1,1,2,4,0,21,5,9,3,1,
+    15,3,3,0,1,4,3,4,0,1,0,11,1,4,6,6,
+    3,11,4,2,7,8,1,10,23,16,9,7,3,4,0,5,
+    0,1,21,69,0,2,27,5,1,6,4,1,17,11,3,12,
+    17,30,20,25,4,37,1,0,9,0,0,2,0,7,1,8,
+    8,0,0,5,2,12,4,0,32,23,12,5,9,4,0,12,
+    50,1,0,1,6,1,5,4,0,2,0,23,3,3,3,12,
+    0,0,0,0,15,3,2,1,0,6,2,0,1,0,0,2,
+    0,9,0,9,0,37,11,48,2,7,15,0,9,5,2,107,
+    1,9,32,20,61,2,0,2,17,3,5,2,5,2,0,39,
+    0,4,16,9,17,0,0,2,0,17,13,2,11,11,16,2,
+    3,2,25,3,24,15,0,29,6,0,42,1,0,25,75,15,
+    6,3,12,28,2,12,4,29,7,2,2,0,5,1,18,2,
+    16,3,36,4,17,1,16,3,2,9,18,0,0,10,0,8,
+    3,6,0,1,3,1,2,4,1,2,4,12,0,3,0,18,
+    3,9,7,0,19,1,23,3,0,3,1,13,9,7,0,18,
+    10,9,2,0,0,21,13,0,0,50,18,2,16,25,1,4,
+    6,7,7,2,3,4,5,4,0,8,1,1,12,2,3,0,
+    8,1,0,1,0,3,8,0,8,7,6,10,6,0,6,45,
+    17,2,3,0,11,0,35,1,0,1,2,2,14,0,2,18,
+    7,4,0,1,21,0,0,0,0,30,7,1,25,4,4,1,
+    1,2,2,27,0,5,2,1,7,6,5,3,1,0,0,1,
+    0,12,8,5,1,2,1,0,1,1,0,0,0,1,8,16,
+    33,24,1,2,1,0,1,5,5,0,2,1,0,3,0,2,
+    9,3,1,0,11,0,13,0,5,2,0,15,2,0,1,0,
+    21,1,2,3,3,21,1,31,6,28,0,4,0,1,16,15,
+    7,0,7,65,0,24,7,0,19,14,52,0,3,0,7,0,
+    8,14,9,1,31,1,5,27,1,16,0,2,7,0,9,0,
+    5,2,0,1,0,1,19,0,0,16,0,23,9,0,7,4,
+    31,1,7,2,4,14,8,14,0,3,0,8,8,0,4,17,
+    39,15,30,0,4,10,9,1,19,4,7,9,6,10,5,1,
+    2,20,12,20,97,1,7,4,12,49,7,1,4,21,0,12,
+    1,2,6,2,1,4,7,14,0,1,11,1,1,0,5,54,
+    1,4,9,43,34,42,1,5,6,0,8,19,0,0,5,3,
+    11,1,3,0,1,2,0,18,4,0,1,1,7,4,13,17,
+    3,12,81,7,8,14,49,8,0,25,8,2,12,3,0,0,
+    1,0,3,5,7,4,3,13,17,0,0,12,0,1,10,1,
+    0,5,1,4,5,0,1,2,5,3,0,0,0,8,5,6,
+    3,20,8,22,4,1,13,10,12,1,6,3,0,5,1,0,
+    9,6,42,0,5,2,0,3,6,28,18,0,2,7,27,0,
+    0,23,16,2,11,3,1,4,5,0,15,0,6,15,0,16,
+    10,35,14,10,1,12,42,16,1,9,7,1,1,1,10,2,
+    0,1,7,5,2,0,1,16,5,0,2,0,13,0,34,3,
+    10,41,5,0,3,0,7,3,1,0,0,9,2,0,8,1,
+    2,4,0,1,0,2,4,13,1,0,2,0,0,5,0,2,
+    2,1,0,2,1,2,17,0,1,4,2,8,4,42,6,6,
+    4,0,0,2,0,2,4,0,7,1,10,1,1,4,1,0,
+    0,2,8,7,2,3,5,1,20,10,0,0,1,8,15,3,
+    8,5,14,5,41,0,0,3,5,0,3,0,0,0,29,43,
+    0,33,0,47,5,25,20,0,3,0,0,2,4,0,5,4,
+    2,72,1,0,3,1,9,8,12,1,9,0,25,7,15,29,
+    1,4,0,4,4,5,0,4,0,1,5,9,3,8,13,4,
+    38,34,0,8,0,6,1,57,16,8,2,20,9,2,9,1,
+    12,0,8,10,0,11,4,7,7,7,1,0,2,5,1,19,
+    5,0,5,16,0,1,38,3,4,1,4,0,2,1,2,24,
+    6,4,0,25,1,40,6,0,1,0,0,0,22,8,80,5,
+    2,10,2,1,0,2,3,2,19,4,0,1,4,0,5,1,
+    8,43,30,0,0,1,0,3,76,0,4,5,3,13,1,1,
+    1,4,2,0,2,0,3,0,0,0,1,4,0,1,0,10,
+    27,3,26,0,4,1,0,0,4,18,16,3,1,1,17,22,
+    0,8,10,8,1,4,10,19,2,0,0,16,0,0,0,30,
+    8,2,4,1,0,35,6,0,50,0,23,1,2,17,9,37,
+    57,2,0,5,1,2,4,5,1,18,14,0,8,3,32,1,
+    0,1,8,0,2,15,32,15,64,9,12,10,22,0,1,14,
+    24,3,0,1,0,7,8,3,12,3,0,4,2,5,2,11,
+    25,7,26,14,33,0,3,16,3,0,19,27,5,1,0,1,
+    1,15,2,36,0,24,21,10,0,1,0,9,0,2,61,6,
+    3,6,1,21,0,1,0,7,10,0,2,7,5,0,2,3,
+    1,5,1,2,21,0,0,4,8,40,0,2,0,8,34,4,
+    2,6,0,20,3,11,8,21,0,3,1,33,4,8,9,0,
+    0,1,5,10,0,2,20,1,8,0,67,0,6,1,3,13,
+    11,2,18,0,28,15,1,7,23,5,7,0,7,13,0,0,
+    0,0,2,1,9,0,3,9,7,0,3,9,2,22,0,2,
+    3,0,25,16,13,64,0,3,5,0,8,14,5,0,4,12,
+    5,10,0,0,9,0,7,1,20,0,1,0,6,27,5,4,
+    1,2,8,6,32,2,1,0,13,17,24,8,1,0,10,1,
+    1,0,1,1,34,12,0,5,38,2,3,18,4,0,5,2,
+    0,0,7,54,0,11,3,8,18,0,0,11,6,7,1,8,
+    21,8,11,2,20,0,0,43,14,23,9,0,23,10,0,38,
+    0,3,1,11,0,0,0,2,1,1,12,2,16,14,3,10,
+    13,12,12,0,3,28,5,37,2,1,0,0,0,14,0,0,
+    0,1,9,18,0,0,18,5,1,0,6,1,2,7,0,10,
+    16,1,5,6,7,0,15,0,0,3,7,12,12,5,2,0,
+    1,0,2,3,0,0,5,1,16,0,2,15,7,0,19,9,
+    11,3,0,13,0,3,1,5,7,0,8,34,7,2,1,11,
+    0,25,0,13,6,25,0,6,2,8,0,21,1,3,2,1,
+    8,0,1,1,0,2,1,1,7,0,8,1,8,8,0,1,
+    31,1,0,5,0,4,3,8,0,4,5,0,2,5,6,2,
+    0,0,1,5,22,2,2,0,7,0,32,13,38,11,2,0,
+    4,13,3,0,25,1,4,0,8,2,4,6,18,11,0,0,
+    0,2,7,4,7,14,1,1,0,14,2,3,0,8,26,21,
+    9,0,11,2,1,2,7,0,18,3,0,4,26,2,1,10,
+    0,11,0,16,13,0,0,5,50,7,0,1,26,22,0,30,
+    1,1,2,0,2,0,1,0,1,14,7,22,8,10,5,0,
+    7,5,1,6,0,3,9,1,4,0,0,4,3,15,9,16,
+    22,13,55,5,4,13,0,6,0,33,1,2,2,3,4,5,
+    10,0,71,1,3,33,2,3,0,5,3,0,7,1,2,4,
+    4,1,14,17,18,16,2,25,4,0,20,4,42,7,3,84,
+    0,9,11,3,7,0,6,6,49,10,0,0,4,3,10,4,
+    6,11,0,6,35,0,6,6,0,2,1,3,0,4,0,3,
+    7,4,0,6,1,2,9,1,1,1,0,13,10,8,5,0,
+    1,6,27,2,0,6,4,14,0,0,10,68,0,2,0,0,
+    3,37,0,0,30,25,21,1,0,7,5,4,0,3,0,0,
+    15,0,8,52,1,3,2,1,0,0,1,7,0,1,14,0,
+    1,10,0,0,5,1,2,30,0,0,2,2,0,31,2,1,
+    0,11,7,6,4,13,0,1,21,8,0,3,10,6,1,32,
+    0,1,7,2,8,41,44,6,4,23,3,1,0,0,3,1,
+    18,11,47,7,22,2,12,2,19,4,3,2,1,0,8,6,
+    38,6,1,6,27,0,0,5,5,5,64,8,12,3,3,4,
+    0,0,10,3,13,8,0,7,1,8,0,38,0,3,9,6,
+    0,0,4,3,12,8,1,1,0,0,6,100,12,14,4,0,
+    2,5,0,18,18,10,4,0,8,0,2,9,5,1,10,0,
+    22,2,4,17,40,5,47,5,8,0,10,23,17,9,11,0,
+    23,1,3,0,4,0,34,6,4,1,1,0,1,11,0,18,
+    2,0,0,5,1,0,5,1,2,5,0,11,0,15,1,8,
+    0,0,4,1,14,19,0,0,18,2,12,8,1,0,3,14,
+    32,1,6,3,8,6,5,1,1,17,0,17,1,1,20,0,
+    100,6,11,2,7,4,22,0,32,6,4,12,0,5,3,3,
+    4,0,8,9,10,1,0,5,17,8,0,10,0,5,21,0,
+    7,1,8,6,10,0,0,0,1,0,0,17,0,13,0,19,
+    7,6,2,39,13,6,27,2,2,6,8,17,9,8,7,7,
+    0,51,8,3,0,0,0,17,19,1,0,12,16,3,13,46,
+    2,11,25,0,9,0,0,11,2,0,1,1,34,6,3,31,
+    0,0,0,19,6,2,3,28,5,2,0,0,19,7,47,15,
+    0,6,8,7,1,1,10,1,3,22,0,10,0,1,0,0,
+    44,31,1,6,65,6,3,39,6,4,0,30,0,11,25,2,
+    8,1,4,2,5,4,0,0,18,18,1,1,4,4,19,5,
+    1,23,10,57,4,0,9,13,0,4,2,3,3,12,3,1,
+    0,6,1,6,1,1,5,0,45,5,1,3,0,11,7,19,
+    18,4,8,4,6,0,0,3,3,1,7,11,4,4,0,4,
+    0,22,54,7,0,3,0,3,3,0,36,10,4,0,8,6,
+    23,2,1,21,7,4,47,0,11,0,13,0,0,7,4,0,
+    27,1,11,7,14,59,21,3,0,16,5,0,4,12,19,40,
+    10,8,17,51,0,0,0,2,2,0,5,3,0,1,8,19,
+    4,0,25,23,3,0,4,8,5,8,8,10,1,1,7,0,
+    11,1,1,1,14,5,0,1,2,3,10,0,4,6,6,48,
+    0,80,0,3,1,6,15,0,0,3,3,6,22,1,0,5,
+    2,8,5,0,0,0,3,13,5,78,0,7,0,0,1,8,
+    8,36,5,17,5,1,0,0,4,0,3,1,2,67,29,26,
+    1,0,2,42,49,4,1,0,7,1,17,14,4,10,4,0,
+    0,10,17,12,8,1,29,1,8,3,5,0,8,4,0,1,
+    44,48,2,2,2,20,1,3,24,5,0,21,4,7,9,1,
+    15,16,2,2,40,2,0,17,5,0,2,0,1,3,0,34,
+    2,6,1,19,4,0,0,0,5,6,7,4,5,0,4,7,
+    0,23,5,5,0,2,0,7,6,4,2,11,20,1,0,0,
+    4,5,2,1,1,11,6,8,1,49,5,75,0,1,8,7,
+    0,2,0,1,3,6,2,0,2,1,0,21,6,2,0,6,
+    0,0,2,1,5,4,3,15,0,5,27,15,5,5,8,22,
+    0,8,7,0,1,2,7,2,0,7,20,6,0,0,35,5,
+    58,19,4,2,1,25,0,0,1,4,0,7,1,0,2,1,
+    13,8,2,22,9,0,0,1,15,3,1,1,14,1,7,15,
+    12,5,1,2,8,1,0,0,0,3,18,1,1,6,4,0,
+    2,6,17,8,1,4,0,2,22,3,23,1,8,13,21,4,
+    14,1,37,7,5,26,8,1,5,5,4,6,2,0,6,4,
+    9,18,1,3,0,0,3,1,3,12,4,0,3,0,0,2,
+    6,0,0,0,22,1,1,9,2,19,22,0,11,2,2,33,
+    2,1,0,1,0,6,20,11,5,25,20,4,2,4,20,52,
+    0,0,1,2,8,2,11,3,2,0,1,13,11,0,3,4,
+    6,1,3,16,9,1,10,14,4,5,8,0,2,15,0,0,
+    5,5,25,0,1,59,6,3,0,8,14,13,3,0,3,5,
+    0,6,23,4,11,7,1,46,2,8,0,2,2,5,2,2,
+    10,0,2,0,18,4,3,0,8,1,7,61,0,1,11,5,
+    0,8,9,3,0,0,0,17,16,26,0,6,6,2,0,3,
+    0,3,0,3,50,8,0,10,75,11,15,3,0,0,3,2,
+    50,3,14,0,4,1,5,3,0,2,0,6,1,0,4,12,
+    0,3,0,28,8,2,0,11,1,0,1,2,0,19,13,3,
+    28,37,4,1,9,0,2,0,0,11,9,11,41,3,6,7,
+    1,5,39,0,2,7,1,0,0,4,0,3,5,5,3,2,
+    2,10,6,2,5,4,0,0,40,12,19,2,3,0,0,15,
+    6,2,26,1,5,9,12,1,4,0,0,5,4,2,0,27,
+    0,0,0,0,0,1,31,19,9,2,1,4,2,15,3,1,
+    32,3,5,20,8,3,5,0,3,2,31,25,14,11,4,2,
+    2,10,3,33,5,7,9,2,31,1,20,9,19,1,0,0,
+    14,2,22,13,3,20,8,6,8,1,28,2,4,12,18,9,
+    0,13,0,0,3,8,16,11,1,0,1,30,2,3,0,6,
+    15,10,1,20,1,2,2,0,0,9,8,41,1,1,9,0,
+    6,46,3,0,6,10,5,15,1,4,5,5,3,0,1,1,
+    3,3,0,1,2,22,7,0,15,17,64,3,21,9,2,17,
+    0,1,2,3,5,64,2,0,5,7,5,7,1,48,12,0,
+    10,5,22,9,0,34,58,2,2,6,3,17,15,8,0,46,
+    20,4,25,10,5,8,1,8,7,22,7,19,0,4,21,12,
+    16,2,1,1,0,0,33,5,6,5,12,4,2,0,41,16,
+    17,1,3,14,18,9,12,10,35,0,0,0,10,30,8,0,
+    10,0,0,5,5,16,1,0,24,25,1,6,11,0,22,0,
+    6,5,11,8,19,27,4,0,0,10,12,12,4,18,2,2,
+    17,5,4,6,1,7,8,24,11,16,4,1,1,1,12,3,
+    4,11,3,30,1,26,1,0,55,67,5,0,35,4,4,8,
+    12,1,0,7,4,8,1,1,0,3,16,40,8,3,10,13,
+    2,16,17,7,5,2,11,2,23,12,4,10,24,13,11,0,
+    2,5,2,4,1,4,5,5,8,2,10,16,20,18,11,2,
+    0,0,7,0,12,34,6,27,40,1,3,52,5,30,8,4,
+    0,16,0,22,1,10,24,3,0,7,2,13,13,7,3,0,
+    1,0,4,0,5,40,11,0,0,5,8,2,2,4,2,2,
+    74,3,5,0,9,2,3,6,3,15,2,10,16,5,14,8,
+    10,4,2,3,2,0,4,10,4,12,7,15,5,0,4,0,
+    16,10,0,0,0,12,5,27,8,0,15,3,8,0,0,6,
+    36,3,0,23,0,18,0,21,1,5,0,15,4,1,8,7,
+    2,4,6,8,1,9,21,49,0,1,3,0,8,0,3,11,
+    23,0,0,1,0,0,0,0,29,2,1,0,0,1,6,0,
+    7,2,33,6,6,2,0,49,2,0,2,1,5,0,22,0,
+    13,12,1,0,1,0,0,0,0,6,7,8,0,0,7,74,
+    9,1,2,3,7,7,6,6,1,25,13,0,5,2,18,1,
+    21,6,7,1,7,50,0,0,3,2,1,0,0,0,15,65,
+    2,49,11,4,2,7,8,2,0,9,2,4,1,0,7,3,
+    6,3,15,0,1,4,9,74,2,4,26,68,0,6,2,32,
+    10,0,4,5,3,1,107,19,1,2,6,22,0,2,2,2,
+    0,4,15,0,5,0,0,6,22,9,68,0,15,44,4,0,
+    1,5,1,1,1,20,0,12,12,0,0,1,98,15,6,0,
+    5,0,20,10,0,33,7,0,2,0,5,16,3,1,9,16,
+    3,0,10,8,32,4,0,2,5,9,15,1,3,0,2,7,
+    6,13,1,3,0,0,3,0,9,16,9,8,1,0,10,0,
+    4,0,3,4,9,0,0,0,30,18,6,45,1,8,4,1,
+    11,0,5,3,14,1,10,17,13,3,1,0,4,8,3,1,
+    5,0,3,0,15,21,0,3,6,0,16,12,7,10,2,0,
+    1,0,9,5,3,7,2,3,1,0,19,14,5,10,4,0,
+    6,5,8,15,0,0,3,7,4,1,0,0,4,0,4,4,
+    16,2,17,0,1,21,3,11,1,0,0,3,0,3,4,24,
+    10,9,2,3,4,18,10,14,0,31,9,0,46,0,0,24,
+    13,1,0,3,0,0,17,7,3,50,7,1,0,7,6,33,
+    0,2,1,16,43,1,0,1,14,0,0,2,39,1,9,2,
+    0,3,6,4,15,6,0,2,0,4,49,0,13,0,0,26,
+    4,0,10,0,2,19,6,6,4,16,5,1,0,8,6,0,
+    0,1,9,2,2,0,1,61,1,2,0,0,11,0,0,15,
+    17,0,33,14,2,0,1,3,1,28,2,1,0,0,6,6,
+    11,3,4,6,0,0,11,0,2,9,17,1,31,8,0,0,
+    0,22,1,4,1,0,26,14,2,2,2,21,25,1,0,0,
+    5,11,4,2,13,0,3,0,19,8,9,2,10,4,0,8,
+    0,6,35,50,6,23,4,0,2,11,2,4,0,27,6,1,
+    24,14,5,12,0,5,0,24,9,2,17,4,0,0,12,15,
+    5,1,3,14,0,23,9,2,2,2,1,3,0,2,8,0,
+    8,0,2,1,0,20,0,3,0,12,3,4,6,9,11,1,
+    1,3,0,1,12,4,5,9,17,23,0,1,6,4,0,15,
+    0,2,9,0,0,2,3,18,0,2,11,27,0,2,24,0,
+    8,0,0,0,2,8,5,0,0,5,2,1,3,17,55,8,
+    17,0,4,8,0,22,0,15,21,23,9,3,4,4,0,1,
+    0,0,10,1,38,12,0,6,0,3,1,9,3,1,0,89,
+    0,2,4,1,4,0,23,8,3,8,5,4,0,1,0,3,
+    1,0,0,2,2,9,0,13,2,1,21,10,0,0,3,62,
+    6,9,21,7,1,12,8,1,12,10,43,3,20,1,2,6,
+    3,0,2,36,8,0,7,8,1,77,1,19,0,6,0,14,
+    8,27,0,0,8,11,33,0,5,12,19,14,7,3,11,3,
+    1,24,14,4,1,32,0,6,0,1,37,0,23,11,2,8,
+    7,1,0,6,2,0,14,8,0,21,0,2,2,4,0,0,
+    0,0,1,0,23,0,16,1,0,3,0,3,0,5,1,16,
+    7,6,4,7,3,51,1,5,8,10,17,0,4,0,5,2,
+    7,13,0,7,9,25,2,4,16,2,8,7,5,0,18,0,
+    34,0,32,2,18,6,0,0,29,0,1,2,16,21,0,0,
+    0,3,54,3,5,2,1,48,1,0,1,0,3,20,40,3,
+    0,7,0,10,0,0,0,7,3,2,0,0,1,0,5,0,
+    0,9,1,8,24,5,32,9,37,5,7,2,5,1,3,2,
+    0,50,0,3,21,2,4,12,5,38,75,25,6,3,9,44,
+    9,35,23,22,1,1,2,0,17,4,3,0,4,27,1,23,
+    0,12,18,0,1,3,54,17,5,0,6,0,0,5,20,10,
+    0,4,5,10,2,4,1,2,0,0,1,99,17,2,0,0,
+    9,1,54,14,25,1,3,13,19,1,14,6,1,2,0,16,
+    1,3,7,31,1,2,29,0,33,2,17,3,5,0,1,0,
+    1,32,0,0,36,5,8,2,14,25,3,3,7,2,8,4,
+    8,0,22,2,9,5,17,6,13,8,3,0,4,8,41,0,
+    1,26,9,0,115,10,28,0,2,1,15,0,4,3,6,2,
+    17,3,1,17,15,8,12,6,0,3,40,46,1,0,0,12,
+    10,0,12,3,0,3,0,2,1,13,4,2,2,0,8,4,
+    5,27,0,5,22,0,0,5,0,9,2,1,12,3,5,2,
+    2,2,1,6,0,2,5,28,16,1,0,5,12,19,4,0,
+    0,17,16,0,2,1,3,7,0,31,6,0,2,1,1,4,
+    1,0,7,5,0,2,0,1,26,4,1,12,2,4,4,0,
+    2,0,1,0,13,0,0,4,3,11,13,39,3,9,3,8,
+    2,0,4,0,2,0,3,27,44,6,3,64,0,2,18,11,
+    0,56,7,0,2,17,20,10,13,0,0,0,7,5,3,30,
+    1,3,1,6,15,20,12,35,2,0,30,18,38,3,1,2,
+    0,4,0,0,7,5,0,9,63,8,0,8,3,16,8,2,
+    0,0,6,2,0,3,20,0,34,3,14,15,0,0,13,6,
+    38,0,15,0,2,8,0,1,0,13,32,0,42,2,0,15,
+    6,1,17,24,9,3,1,6,0,1,11,10,8,2,9,17,
+    0,0,0,4,16,9,7,0,0,19,2,3,0,0,13,54,
+    1,0,3,15,1,0,0,0,2,0,0,13,1,8,1,7,
+    0,0,1,1,35,1,0,0,4,64,0,23,6,20,2,9,
+    4,33,2,9,14,7,0,8,7,0,1,4,21,14,4,5,
+    5,5,45,0,3,9,0,10,103,12,2,3,1,0,11,18,
+    0,5,1,0,23,3,1,15,0,1,69,0,21,23,7,12,
+    14,20,72,6,4,13,3,32,0,2,4,0,0,9,99,17,
+    1,8,1,9,0,21,37,13,2,39,8,10,2,10,13,0,
+    3,33,3,2,2,3,0,4,12,21,9,16,1,6,2,17,
+    14,1,0,9,3,0,1,62,0,18,8,1,1,2,0,4,
+    10,6,4,16,11,2,0,6,22,7,10,1,0,27,0,16,
+    3,4,2,9,2,4,0,3,0,2,17,2,0,22,2,0,
+    3,9,0,5,2,3,9,2,0,37,1,3,0,6,0,7,
+    0,2,1,1,8,6,11,16,10,0,4,13,0,4,0,1,
+    3,7,1,50,1,8,1,0,16,3,1,13,0,2,9,13,
+    1,29,0,7,5,0,11,0,10,1,1,1,2,4,8,5,
+    1,19,27,0,17,27,9,5,33,3,32,8,28,13,7,46,
+    3,5,21,5,1,32,2,3,5,5,33,6,0,2,0,18,
+    56,10,4,0,8,35,4,0,0,9,5,0,39,0,10,5,
+    7,29,0,4,0,64,51,3,13,14,9,2,22,6,11,0,
+    2,12,12,15,0,24,1,7,5,15,3,1,7,0,4,1,
+    16,1,8,6,4,9,3,17,30,0,0,7,3,0,53,4,
+    6,28,3,0,3,1,0,0,25,0,1,1,5,64,2,73,
+    0,1,3,13,0,1,0,15,1,1,8,5,7,9,8,24,
+    10,14,0,39,10,0,51,0,1,8,4,70,1,38,10,0,
+    13,0,38,2,6,4,30,39,5,14,2,16,32,8,22,1,
+    6,6,20,1,42,10,0,6,7,3,4,0,12,8,0,0,
+    33,4,2,0,6,5,12,5,4,0,0,24,17,3,8,11,
+    1,46,7,0,28,2,0,8,0,40,25,12,1,3,5,5,
+    2,2,67,21,2,7,3,14,25,0,0,1,8,12,6,1,
+    0,9,60,3,7,3,12,8,1,3,6,2,5,16,2,0,
+    13,1,9,8,3,21,2,0,22,7,1,10,19,0,6,42,
+    8,3,0,26,9,34,15,41,21,0,3,23,3,5,14,18,
+    4,15,0,12,11,7,2,11,0,8,2,2,0,34,1,1,
+    20,7,12,6,5,18,4,8,0,46,1,7,1,24,0,32,
+    0,65,0,5,11,12,1,0,14,25,7,16,7,0,58,2,
+    19,1,1,3,2,3,2,0,2,17,2,2,4,1,34,33,
+    3,21,1,3,33,12,1,5,0,6,0,0,2,11,4,3,
+    2,5,0,0,7,12,12,21,6,9,7,28,3,0,6,4,
+    5,3,16,10,13,0,18,17,2,1,25,1,2,1,0,0,
+    1,0,18,0,5,13,4,12,5,0,1,1,10,2,0,0,
+    30,4,39,10,7,1,3,3,3,0,2,0,9,10,1,37,
+    3,13,2,1,0,18,13,10,1,8,0,4,0,3,16,6,
+    26,2,0,0,5,1,2,1,3,0,2,55,0,2,12,2,
+    0,0,33,0,2,7,9,0,2,0,0,8,1,7,25,67,
+    14,41,11,7,9,11,0,18,3,18,3,0,7,1,8,16,
+    13,2,9,5,21,0,29,22,12,0,15,0,72,20,20,36,
+    0,5,4,0,35,0,5,2,2,5,7,1,10,0,2,20,
+    13,3,0,5,26,0,1,0,1,0,5,68,0,10,8,16,
+    2,0,28,9,0,0,0,0,0,1,0,4,5,2,0,1,
+    2,4,1,20,1,14,1,0,0,1,2,0,4,0,11,1,
+    5,2,7,4,3,0,10,8,39,8,17,0,1,3,0,7,
+    7,33,3,8,3,7,3,0,40,0,25,1,8,4,5,4,
+    0,17,5,2,1,0,6,0,10,10,2,3,1,1,8,2,
+    0,58,0,0,32,1,13,17,0,19,4,8,6,0,11,21,
+    2,15,3,17,6,0,5,0,0,0,10,1,31,2,1,2,
+    28,16,0,10,6,0,0,7,0,19,0,3,0,0,2,4,
+    4,7,7,1,22,0,3,27,0,10,7,1,0,10,9,8,
+    0,12,8,0,11,2,7,2,1,0,9,0,12,5,1,5,
+    5,20,0,4,8,1,119,10,10,6,47,11,6,6,5,0,
+    17,5,5,12,0,1,1,6,0,5,1,4,21,5,2,1,
+    1,0,11,2,10,1,8,0,16,5,16,16,3,6,52,42,
+    16,5,1,10,4,9,6,7,6,6,2,0,0,9,16,1,
+    19,3,0,8,33,6,5,2,1,8,4,23,0,11,0,1,
+    26,6,56,21,1,11,0,14,10,9,14,4,0,16,45,3,
+    2,21,4,18,5,0,3,8,0,16,27,0,0,8,1,15,
+    3,3,1,0,32,2,0,8,12,3,48,1,0,0,5,2,
+    5,7,0,1,0,4,2,3,4,2,0,7,11,1,0,2,
+    10,2,0,15,0,0,0,6,9,21,42,5,0,3,5,2,
+    4,2,0,15,1,5,0,0,0,0,3,6,0,13,0,7,
+    0,2,1,0,1,15,0,10,0,1,0,0,2,0,24,7,
+    4,6,3,1,30,1,3,0,0,12,3,11,5,19,0,25,
+    25,15,4,40,69,32,7,0,0,100,12,22,2,16,36,0,
+    0,4,3,7,25,0,20,0,7,9,1,26,17,0,0,31,
+    24,58,8,14,6,5,4,1,2,7,4,3,0,6,21,8,
+    24,1,0,4,27,19,0,0,0,2,9,13,5,0,0,0,
+    2,6,0,4,1,8,26,4,48,0,1,21,3,5,4,15,
+    4,1,0,9,2,8,29,52,1,0,1,8,1,2,2,0,
+    12,0,10,6,22,19,16,12,13,26,5,0,11,19,6,34,
+    1,1,4,0,14,2,4,4,4,6,1,9,0,1,28,0,
+    4,7,12,26,16,3,0,19,23,15,12,9,0,1,0,1,
+    6,5,25,10,1,2,0,13,12,49,1,13,25,33,0,2,
+    1,4,41,0,5,38,12,7,0,7,2,3,0,0,3,3,
+    14,1,18,2,34,20,2,0,3,1,37,4,3,15,3,0,
+    22,0,12,2,3,9,40,2,66,0,1,18,0,4,26,0,
+    1,17,15,4,37,4,16,3,0,9,8,10,2,3,0,10,
+    0,9,5,0,16,0,9,0,0,35,23,2,20,10,1,44,
+    1,0,0,4,18,7,8,3,12,13,15,33,3,0,0,13,
+    5,11,8,5,0,2,3,0,0,34,51,23,28,6,6,8,
+    7,1,42,4,42,45,9,19,16,26,9,24,2,38,32,36,
+    5,0,21,0,1,2,3,10,44,41,2,0,2,0,33,4,
+    0,0,0,13,1,8,0,1,25,10,2,1,0,0,6,4,
+    2,0,20,16,9,0,1,34,0,16,0,18,0,4,4,17,
+    5,9,9,0,10,1,8,2,32,11,1,0,15,8,1,2,
+    2,12,4,9,7,25,4,32,1,1,5,2,0,26,4,14,
+    22,1,7,16,9,18,1,3,0,0,3,0,1,6,1,0,
+    3,5,7,7,9,29,8,12,3,12,6,0,5,1,4,0,
+    6,14,25,2,0,1,2,14,0,17,0,4,67,1,0,0,
+    4,0,18,12,13,11,1,10,2,40,14,6,7,2,78,0,
+    7,42,0,7,0,10,0,28,1,22,2,0,0,18,1,7,
+    8,31,29,30,3,3,0,0,0,0,3,9,5,2,0,1,
+    19,24,1,26,14,0,1,0,29,3,56,7,62,15,2,0,
+    10,0,1,9,2,18,2,15,20,7,0,4,0,4,13,12,
+    0,7,0,1,13,1,17,57,4,2,2,2,11,9,8,1,
+    10,0,14,3,5,5,3,6,3,8,16,2,22,6,0,0,
+    14,1,44,6,14,0,7,25,1,9,2,1,41,4,14,0,
+    3,0,3,20,0,24,19,0,23,0,4,0,65,1,0,8,
+    11,1,62,3,3,2,24,16,0,4,1,0,0,3,3,17,
+    9,2,2,0,13,8,32,12,2,5,4,65,21,7,2,3,
+    1,0,1,14,22,24,6,1,32,2,10,2,7,4,3,19,
+    2,1,6,25,3,28,6,0,12,2,0,14,0,2,18,7,
+    4,22,13,8,4,2,3,1,7,11,16,0,2,17,46,4,
+    1,2,0,41,13,6,1,29,1,11,64,25,0,2,1,1,
+    5,0,4,25,5,13,1,64,2,2,0,2,2,1,1,0,
+    80,4,20,27,5,6,1,21,0,1,5,74,3,0,6,2,
+    4,2,16,6,1,16,8,8,12,3,12,0,6,27,0,2,
+    1,6,0,20,5,0,8,7,0,0,25,1,0,9,9,5,
+    6,4,4,2,1,36,7,0,15,2,0,0,12,0,8,2,
+    1,23,2,5,4,21,13,2,8,3,3,0,46,1,3,0,
+    33,64,4,2,1,0,50,0,0,3,3,5,20,0,0,24,
+    14,5,7,3,9,3,1,1,4,23,28,0,6,2,24,12,
+    3,17,1,3,33,3,6,6,4,6,0,12,37,8,1,6,
+    11,0,0,6,0,28,0,27,24,5,11,76,13,4,1,3,
+    23,2,11,0,11,0,77,21,4,3,0,0,1,0,0,0,
+    20,0,4,17,6,4,13,3,2,3,0,5,7,1,6,7,
+    0,3,0,0,44,3,29,6,24,4,15,1,2,7,15,10,
+    3,2,3,17,50,27,31,4,3,0,6,0,1,9,2,5,
+    0,0,8,27,0,0,11,29,7,11,14,0,12,36,2,1,
+    1,0,0,1,29,0,5,0,12,16,2,3,1,4,11,2
+};
+
+static const char *const builtin_hand_names[NUM_OF_EQUIVALENCES] = {
+    "Royal Flush",
+    "King-High Straight Flush",
+    "Queen-High Straight Flush",
+    "Jack-High Straight Flush",
+    "Ten-High Straight Flush",
+    "Nine-High Straight Flush",
+    "Eight-High Straight Flush",
+    "Seven-High Straight Flush",
+    "Six-High Straight Flush",
+    "Five-High Straight Flush",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Aces",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Kings",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Queens",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Jacks",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Tens",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Nines",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Eights",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sevens",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Sixes",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fives",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Fours",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Treys",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Four Deuces",
+    "Aces Full over Kings",
+    "Aces Full over Queens",
+    "Aces Full over Jacks",
+    "Aces Full over Tens",
+    "Aces Full over Nines",
+    "Aces Full over Eights",
+    "Aces Full over Sevens",
+    "Aces Full over Sixes",
+    "Aces Full over Fives",
+    "Aces Full over Fours",
+    "Aces Full over Treys",
+    "Aces Full over Deuces",
+    "Kings Full over Aces",
+    "Kings Full over Queens",
+    "Kings Full over Jacks",
+    "Kings Full over Tens",
+    "Kings Full over Nines",
+    "Kings Full over Eights",
+    "Kings Full over Sevens",
+    "Kings Full over Sixes",
+    "Kings Full over Fives",
+    "Kings Full over Fours",
+    "Kings Full over Treys",
+    "Kings Full over Deuces",
+    "Queens Full over Aces",
+    "Queens Full over Kings",
+    "Queens Full over Jacks",
+    "Queens Full over Tens",
+    "Queens Full over Nines",
+    "Queens Full over Eights",
+    "Queens Full over Sevens",
+    "Queens Full over Sixes",
+    "Queens Full over Fives",
+    "Queens Full over Fours",
+    "Queens Full over Treys",
+    "Queens Full over Deuces",
+    "Jacks Full over Aces",
+    "Jacks Full over Kings",
+    "Jacks Full over Queens",
+    "Jacks Full over Tens",
+    "Jacks Full over Nines",
+    "Jacks Full over Eights",
+    "Jacks Full over Sevens",
+    "Jacks Full over Sixes",
+    "Jacks Full over Fives",
+    "Jacks Full over Fours",
+    "Jacks Full over Treys",
+    "Jacks Full over Deuces",
+    "Tens Full over Aces",
+    "Tens Full over Kings",
+    "Tens Full over Queens",
+    "Tens Full over Jacks",
+    "Tens Full over Nines",
+    "Tens Full over Eights",
+    "Tens Full over Sevens",
+    "Tens Full over Sixes",
+    "Tens Full over Fives",
+    "Tens Full over Fours",
+    "Tens Full over Treys",
+    "Tens Full over Deuces",
+    "Nines Full over Aces",
+    "Nines Full over Kings",
+    "Nines Full over Queens",
+    "Nines Full over Jacks",
+    "Nines Full over Tens",
+    "Nines Full over Eights",
+    "Nines Full over Sevens",
+    "Nines Full over Sixes",
+    "Nines Full over Fives",
+    "Nines Full over Fours",
+    "Nines Full over Treys",
+    "Nines Full over Deuces",
+    "Eights Full over Aces",
+    "Eights Full over Kings",
+    "Eights Full over Queens",
+    "Eights Full over Jacks",
+    "Eights Full over Tens",
+    "Eights Full over Nines",
+    "Eights Full over Sevens",
+    "Eights Full over Sixes",
+    "Eights Full over Fives",
+    "Eights Full over Fours",
+    "Eights Full over Treys",
+    "Eights Full over Deuces",
+    "Sevens Full over Aces",
+    "Sevens Full over Kings",
+    "Sevens Full over Queens",
+    "Sevens Full over Jacks",
+    "Sevens Full over Tens",
+    "Sevens Full over Nines",
+    "Sevens Full over Eights",
+    "Sevens Full over Sixes",
+    "Sevens Full over Fives",
+    "Sevens Full over Fours",
+    "Sevens Full over Treys",
+    "Sevens Full over Deuces",
+    "Sixes Full over Aces",
+    "Sixes Full over Kings",
+    "Sixes Full over Queens",
+    "Sixes Full over Jacks",
+    "Sixes Full over Tens",
+    "Sixes Full over Nines",
+    "Sixes Full over Eights",
+    "Sixes Full over Sevens",
+    "Sixes Full over Fives",
+    "Sixes Full over Fours",
+    "Sixes Full over Treys",
+    "Sixes Full over Deuces",
+    "Fives Full over Aces",
+    "Fives Full over Kings",
+    "Fives Full over Queens",
+    "Fives Full over Jacks",
+    "Fives Full over Tens",
+    "Fives Full over Nines",
+    "Fives Full over Eights",
+    "Fives Full over Sevens",
+    "Fives Full over Sixes",
+    "Fives Full over Fours",
+    "Fives Full over Treys",
+    "Fives Full over Deuces",
+    "Fours Full over Aces",
+    "Fours Full over Kings",
+    "Fours Full over Queens",
+    "Fours Full over Jacks",
+    "Fours Full over Tens",
+    "Fours Full over Nines",
+    "Fours Full over Eights",
+    "Fours Full over Sevens",
+    "Fours Full over Sixes",
+    "Fours Full over Fives",
+    "Fours Full over Treys",
+    "Fours Full over Deuces",
+    "Treys Full over Aces",
+    "Treys Full over Kings",
+    "Treys Full over Queens",
+    "Treys Full over Jacks",
+    "Treys Full over Tens",
+    "Treys Full over Nines",
+    "Treys Full over Eights",
+    "Treys Full over Sevens",
+    "Treys Full over Sixes",
+    "Treys Full over Fives",
+    "Treys Full over Fours",
+    "Treys Full over Deuces",
+    "Deuces Full over Aces",
+    "Deuces Full over Kings",
+    "Deuces Full over Queens",
+    "Deuces Full over Jacks",
+    "Deuces Full over Tens",
+    "Deuces Full over Nines",
+    "Deuces Full over Eights",
+    "Deuces Full over Sevens",
+    "Deuces Full over Sixes",
+    "Deuces Full over Fives",
+    "Deuces Full over Fours",
+    "Deuces Full over Treys",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "Ace-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "King-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Queen-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Jack-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Ten-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Nine-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Eight-High Flush",
+    "Seven-High Flush",
+    "Seven-High Flush",
+    "Seven-High Flush",
+    "Seven-High Flush",
+    "Ace-High Straight",
+    "King-High Straight",
+    "Queen-High Straight",
+    "Jack-High Straight",
+    "Ten-High Straight",
+    "Nine-High Straight",
+    "Eight-High Straight",
+    "Seven-High Straight",
+    "Six-High Straight",
+    "Five-High Straight",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Aces",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Kings",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Queens",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Jacks",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Tens",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Nines",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Eights",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sevens",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Sixes",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fives",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Fours",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Treys",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Three Deuces",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Kings",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Queens",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Jacks",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Tens",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Nines",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Eights",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sevens",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Sixes",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fives",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Fours",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Treys",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Aces and Deuces",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Queens",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Jacks",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Tens",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Nines",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Eights",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sevens",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Sixes",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fives",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Fours",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Treys",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Kings and Deuces",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Jacks",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Tens",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Nines",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Eights",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sevens",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Sixes",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fives",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Fours",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Treys",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Queens and Deuces",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Tens",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Nines",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Eights",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sevens",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Sixes",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fives",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Fours",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Treys",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Jacks and Deuces",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Nines",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Eights",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sevens",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Sixes",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fives",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Fours",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Treys",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Tens and Deuces",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Eights",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sevens",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Sixes",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fives",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Fours",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Treys",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Nines and Deuces",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sevens",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Sixes",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fives",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Fours",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Treys",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Eights and Deuces",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Sixes",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fives",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Fours",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Treys",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sevens and Deuces",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fives",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Fours",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Treys",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Sixes and Deuces",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Fours",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Treys",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fives and Deuces",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Treys",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Fours and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Treys and Deuces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Aces",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Kings",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Queens",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Jacks",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Tens",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Nines",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Eights",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sevens",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Sixes",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fives",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Fours",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Treys",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Pair of Deuces",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "Ace-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "King-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Queen-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Jack-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Ten-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Nine-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Eight-High",
+    "Seven-High",
+    "Seven-High",
+    "Seven-High",
+    "Seven-High"
+};
+
@@ -0,0 +1,213 @@
+/******************************************************************************
+ * File: preflop_tables.c
+ * Description: Precomputed preflop probabilities. Preflop queries always have
+ * the same answers, so they are computed once by tools/generate_preflop.c and
+ * stored in a binary file, which is mapped into memory by
+ * load_preflop_tables(). Once loaded, simulate_player() answers preflop
+ * queries and simulate_spectator() answers heads-up preflop matchups from
+ * the tables instead of simulating games.
+ *
+ * There are two tables:
+ *  - Starting hand classes (169) against 1..9 random opponents, simulated.
+ *  - Heads-up matchups of two known hands, enumerated exactly. Matchups that
+ *    only differ by a permutation of the suits have the same probabilities,
+ *    so only one of each is stored, identified by preflop_matchup_key().
+ ****************************************************************************/
+
+#include "preflop_tables.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+#define NUM_SUITS 4
+#define NUM_SUIT_PERMUTATIONS 24
+
+
+/* Mapped file and its tables, NULL when no file is loaded */
+
+void *preflop_file = NULL;
+size_t preflop_file_size = 0;
+const preflop_header_t *preflop_header = NULL;
+const preflop_entry_t *preflop_class_entries = NULL;
+const uint32_t *preflop_matchup_keys = NULL;
+const preflop_entry_t *preflop_matchup_entries = NULL;
+
+/* All the permutations of the 4 suits */
+
+int SUIT_PERMUTATIONS[NUM_SUIT_PERMUTATIONS][NUM_SUITS] =
+{
+    { 0, 1, 2, 3 }, { 0, 1, 3, 2 }, { 0, 2, 1, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 0, 3, 2, 1 },
+    { 1, 0, 2, 3 }, { 1, 0, 3, 2 }, { 1, 2, 0, 3 }, { 1, 2, 3, 0 }, { 1, 3, 0, 2 }, { 1, 3, 2, 0 },
+    { 2, 0, 1, 3 }, { 2, 0, 3, 1 }, { 2, 1, 0, 3 }, { 2, 1, 3, 0 }, { 2, 3, 0, 1 }, { 2, 3, 1, 0 },
+    { 3, 0, 1, 2 }, { 3, 0, 2, 1 }, { 3, 1, 0, 2 }, { 3, 1, 2, 0 }, { 3, 2, 0, 1 }, { 3, 2, 1, 0 }
+};
+
+
+/**
+ * @brief Loading of a file of preflop tables, generated by tools/generate_preflop.c. The file is mapped into
+ * memory, so loading it takes no time and several processes share it. A previously loaded file is unloaded.
+ *
+ * @param file Path of the file.
+ * @return -1 if the file can not be read or is not a valid file of preflop tables, 0 for success.
+ */
+int load_preflop_tables(const char *file){
+    unload_preflop_tables();
+
+    int fd = open(file, O_RDONLY);
+    if(fd == -1){
+        fprintf(stderr,"Error when opening the preflop tables %s.\n", file);
+        return -1;
+    }
+
+    struct stat file_stat;
+    void *mapped = MAP_FAILED;
+    if(fstat(fd, &file_stat) == 0 && (size_t) file_stat.st_size >= sizeof(preflop_header_t)){
+        mapped = mmap(NULL, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if(mapped == MAP_FAILED){
+        fprintf(stderr,"Error when reading the preflop tables %s.\n", file);
+        return -1;
+    }
+
+    const preflop_header_t *header = (const preflop_header_t *) mapped;
+    size_t num_class_entries = (size_t) PREFLOP_NUM_CLASSES * header->max_opponents;
+    size_t expected_size = sizeof(preflop_header_t) + num_class_entries * sizeof(preflop_entry_t) +
+                           (size_t) header->num_matchups * (sizeof(uint32_t) + sizeof(preflop_entry_t));
+
+    if(memcmp(header->magic, PREFLOP_MAGIC, sizeof(header->magic)) != 0 || header->max_opponents > PREFLOP_MAX_OPPONENTS ||
+       (size_t) file_stat.st_size != expected_size){
+        fprintf(stderr,"Error: %s is not a valid file of preflop tables.\n", file);
+        munmap(mapped, file_stat.st_size);
+        return -1;
+    }
+
+    preflop_file = mapped;
+    preflop_file_size = file_stat.st_size;
+    preflop_header = header;
+    preflop_class_entries = (const preflop_entry_t *) (header + 1);
+    preflop_matchup_keys = (const uint32_t *) (preflop_class_entries + num_class_entries);
+    preflop_matchup_entries = (const preflop_entry_t *) (preflop_matchup_keys + header->num_matchups);
+
+    return 0;
+}
+
+
+/**
+ * @brief Unloading of the preflop tables. Simulations stop using them.
+ */
+void unload_preflop_tables(){
+    if(preflop_file != NULL){
+        munmap(preflop_file, preflop_file_size);
+    }
+    preflop_file = NULL;
+    preflop_file_size = 0;
+    preflop_header = NULL;
+    preflop_class_entries = NULL;
+    preflop_matchup_keys = NULL;
+    preflop_matchup_entries = NULL;
+}
+
+
+/**
+ * @brief Starting hand class of two cards, as a position in the 13x13 grid of ranks: pairs on the diagonal,
+ * suited hands with the highest rank as the row and offsuit hands with the highest rank as the column.
+ *
+ * @param card1 First card, in [0,51] (see cardtype_to_num()).
+ * @param card2 Second card, in [0,51].
+ * @return Class in [0, PREFLOP_NUM_CLASSES - 1].
+ */
+int preflop_class(int card1, int card2){
+    int rank1 = card1 % NUM_RANKS, rank2 = card2 % NUM_RANKS;
+    int high = (rank1 > rank2) ? rank1 : rank2;
+    int low = (rank1 > rank2) ? rank2 : rank1;
+
+    if(card1 / NUM_RANKS == card2 / NUM_RANKS){
+        return high * NUM_RANKS + low;
+    }
+    return low * NUM_RANKS + high;
+}
+
+
+/**
+ * @brief Key of a heads-up matchup, the same for all the matchups that only differ by a permutation of the suits.
+ * The cards of each hand are sorted, and the key is the smallest one over the 24 permutations of the suits of
+ * (hero high card, hero low card, villain high card, villain low card), 6 bits per card.
+ *
+ * @param hero1 First card of the hero, in [0,51] (see cardtype_to_num()).
+ * @param hero2 Second card of the hero.
+ * @param villain1 First card of the villain.
+ * @param villain2 Second card of the villain.
+ * @return Key of the matchup.
+ */
+uint32_t preflop_matchup_key(int hero1, int hero2, int villain1, int villain2){
+    int cards[4] = { hero1, hero2, villain1, villain2 };
+    uint32_t best_key = UINT32_MAX;
+
+    for(int p = 0; p < NUM_SUIT_PERMUTATIONS; p++){
+        int c[4];
+        for(int i = 0; i < 4; i++){
+            c[i] = SUIT_PERMUTATIONS[p][cards[i] / NUM_RANKS] * NUM_RANKS + cards[i] % NUM_RANKS;
+        }
+        uint32_t hero_key = (c[0] > c[1]) ? ((uint32_t) c[0] << 6 | c[1]) : ((uint32_t) c[1] << 6 | c[0]);
+        uint32_t villain_key = (c[2] > c[3]) ? ((uint32_t) c[2] << 6 | c[3]) : ((uint32_t) c[3] << 6 | c[2]);
+        uint32_t key = hero_key << 12 | villain_key;
+        if(key < best_key) best_key = key;
+    }
+
+    return best_key;
+}
+
+
+/**
+ * @brief Precomputed probabilities of a starting hand against random opponents.
+ *
+ * @param card1 First card, in [0,51] (see cardtype_to_num()).
+ * @param card2 Second card, in [0,51].
+ * @param num_opponents Number of opponents.
+ * @param num_games Where the number of games simulated for the entry is stored. It can be NULL.
+ * @return Entry with the rows of simulate_player(), NULL if there are no tables loaded for num_opponents.
+ */
+const preflop_entry_t *preflop_class_entry(int card1, int card2, int num_opponents, int *num_games){
+    if(preflop_header == NULL || num_opponents < 1 || num_opponents > (int) preflop_header->max_opponents){
+        return NULL;
+    }
+    if(num_games != NULL){
+        *num_games = (int) preflop_header->class_games;
+    }
+    return &preflop_class_entries[preflop_class(card1, card2) * preflop_header->max_opponents + (num_opponents - 1)];
+}
+
+
+/**
+ * @brief Exact probabilities of a heads-up preflop matchup, found by binary search over the sorted keys.
+ *
+ * @param hero1 First card of the hero, in [0,51] (see cardtype_to_num()).
+ * @param hero2 Second card of the hero.
+ * @param villain1 First card of the villain.
+ * @param villain2 Second card of the villain.
+ * @return Entry with the rows of simulate_spectator() (hero, then villain), NULL if there is no matchup table loaded.
+ */
+const preflop_entry_t *preflop_matchup_entry(int hero1, int hero2, int villain1, int villain2){
+    if(preflop_header == NULL || preflop_header->num_matchups == 0){
+        return NULL;
+    }
+
+    uint32_t key = preflop_matchup_key(hero1, hero2, villain1, villain2);
+    int lo = 0, hi = (int) preflop_header->num_matchups - 1;
+
+    while(lo <= hi){
+        int mid = lo + (hi - lo) / 2;
+        if(preflop_matchup_keys[mid] == key) return &preflop_matchup_entries[mid];
+        if(preflop_matchup_keys[mid] < key) lo = mid + 1;
+        else hi = mid - 1;
+    }
+
+    return NULL;
+}
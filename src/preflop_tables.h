@@ -0,0 +1,40 @@
+/******************************************************************************
+ * File: preflop_tables.h
+ * Description: Header file for preflop_tables.c, which loads the precomputed
+ * preflop probabilities generated by tools/generate_preflop.c.
+ ****************************************************************************/
+
+#pragma once
+#include "simulation.h"
+#include <stdint.h>
+
+#define PREFLOP_NUM_CLASSES 169     // Starting hand classes: 13 pairs, 78 suited and 78 offsuit hands
+#define PREFLOP_MAX_OPPONENTS 9
+#define PREFLOP_MAGIC "PFEQTBL1"
+
+/* Probabilities of a preflop entry, with the rows of the matrix returned by simulate_player() (starting hand
+   classes) or simulate_spectator() (heads-up matchups) */
+
+typedef struct {
+    float probabilities[2][3 + NUM_OF_HAND_TYPES];
+} preflop_entry_t;
+
+/* Header of a file of preflop tables. It is followed by the class entries [PREFLOP_NUM_CLASSES][max_opponents],
+   the sorted keys of the matchups [num_matchups] and the matchup entries [num_matchups]. */
+
+typedef struct {
+    char magic[8];              // PREFLOP_MAGIC
+    uint32_t max_opponents;     // Class entries per class, for 1..max_opponents opponents
+    uint32_t class_games;       // Games simulated for every class entry
+    uint32_t num_matchups;      // Heads-up matchups, 0 if the file has no matchup table
+    uint32_t reserved;
+} preflop_header_t;
+
+/* These functions are meant to be called from outside the current module. */
+
+int load_preflop_tables(const char *file);
+void unload_preflop_tables();
+int preflop_class(int card1, int card2);
+uint32_t preflop_matchup_key(int hero1, int hero2, int villain1, int villain2);
+const preflop_entry_t *preflop_class_entry(int card1, int card2, int num_opponents, int *num_games);
+const preflop_entry_t *preflop_matchup_entry(int hero1, int hero2, int villain1, int villain2);
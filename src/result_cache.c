@@ -0,0 +1,512 @@
+/******************************************************************************
+ * File: result_cache.c
+ * Description: Bounded LRU cache of simulation results. Many queries are the
+ * same spot under a relabelling of the suits ("AhKh on 2h7c9d" is the same as
+ * "AsKs on 2s7d9c"), and relabelling the suits does not change any
+ * probability. Spots are mapped to a canonical key, the smallest of the keys
+ * of their 24 suit relabellings, and once the cache is enabled with
+ * result_cache_enable() the simulators answer repeated spots from it.
+ *
+ * The cache is shared by all the threads and protected by a mutex. It can be
+ * saved to disk and loaded back, so that it survives restarts.
+ ****************************************************************************/
+
+#include "result_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+
+
+#define NUM_SUITS 4
+#define NUM_SUIT_PERMUTATIONS 24
+#define SUIT_MASK 0x1FFFULL
+#define FNV_OFFSET_BASIS 0xCBF29CE484222325ULL
+#define FNV_PRIME 0x100000001B3ULL
+
+extern int SUIT_PERMUTATIONS[NUM_SUIT_PERMUTATIONS][NUM_SUITS];
+
+/* Entry of the cache, in its hash bucket and in the list of entries ordered by last use */
+
+typedef struct cache_entry {
+    result_cache_key_t key;
+    sim_info_t info;
+    struct cache_entry *bucket_next;
+    struct cache_entry *newer;
+    struct cache_entry *older;
+    int num_rows;
+    double probabilities[][3 + NUM_OF_HAND_TYPES];
+} cache_entry_t;
+
+/* Header of a saved cache. It is followed by the entries from the least to the most recently used, each one as
+   its key, its sim_info_t, its number of rows and its rows. */
+
+typedef struct {
+    char magic[8];              // RESULT_CACHE_MAGIC
+    uint32_t num_entries;
+    uint32_t key_size;          // Sizes of the structures, a cache is only loaded by the build that saved it
+    uint32_t info_size;
+    uint32_t row_size;
+} cache_file_header_t;
+
+
+/* State of the cache, disabled while capacity is 0 */
+
+pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+cache_entry_t **cache_buckets = NULL;
+int cache_num_buckets = 0;
+int cache_capacity = 0;
+int cache_num_entries = 0;
+size_t cache_memory_bytes = 0;
+cache_entry_t *cache_newest = NULL;
+cache_entry_t *cache_oldest = NULL;
+uint64_t cache_lookups = 0;
+uint64_t cache_hits = 0;
+uint64_t cache_insertions = 0;
+uint64_t cache_evictions = 0;
+
+
+uint64_t hash_key(const result_cache_key_t *key);
+cache_entry_t **find_entry(const result_cache_key_t *key);
+void unlink_entry(cache_entry_t *entry);
+void push_newest(cache_entry_t *entry);
+void remove_all_entries();
+uint64_t permute_suits(uint64_t cards, const int permutation[]);
+
+
+/**
+ * @brief Enabling of the result cache, or resizing of it if it is already enabled, which empties it. The simulators
+ * then answer the spots already solved with the same precision from the cache, without calling the progress
+ * callback of the options. Calls with a fixed seed are only answered by the same seed, see canonical_spot_key().
+ *
+ * @param capacity Maximum number of entries. When the cache is full, the least recently used entry is evicted.
+ * @return -1 if capacity is not positive or the cache can not be allocated, 0 for success.
+ */
+int result_cache_enable(int capacity){
+    if(capacity < 1) return -1;
+
+    // Twice as many buckets as entries, a power of two
+    int num_buckets = 1;
+    while(num_buckets < 2 * capacity) num_buckets <<= 1;
+
+    cache_entry_t **buckets = calloc(num_buckets, sizeof(cache_entry_t *));
+    if(buckets == NULL) return -1;
+
+    pthread_mutex_lock(&cache_lock);
+    remove_all_entries();
+    free(cache_buckets);
+    cache_buckets = buckets;
+    cache_num_buckets = num_buckets;
+    cache_capacity = capacity;
+    cache_memory_bytes = num_buckets * sizeof(cache_entry_t *);
+    cache_lookups = cache_hits = cache_insertions = cache_evictions = 0;
+    pthread_mutex_unlock(&cache_lock);
+
+    return 0;
+}
+
+
+/**
+ * @brief Disabling of the result cache. All its entries are freed.
+ */
+void result_cache_disable(){
+    pthread_mutex_lock(&cache_lock);
+    remove_all_entries();
+    free(cache_buckets);
+    cache_buckets = NULL;
+    cache_num_buckets = 0;
+    cache_capacity = 0;
+    cache_memory_bytes = 0;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+
+/**
+ * @brief Whether the result cache is enabled.
+ *
+ * @return 1 if it is enabled, 0 otherwise.
+ */
+int result_cache_enabled(){
+    pthread_mutex_lock(&cache_lock);
+    int enabled = (cache_capacity > 0);
+    pthread_mutex_unlock(&cache_lock);
+    return enabled;
+}
+
+
+/**
+ * @brief Removal of all the entries of the result cache. The statistics are kept.
+ */
+void result_cache_clear(){
+    pthread_mutex_lock(&cache_lock);
+    remove_all_entries();
+    pthread_mutex_unlock(&cache_lock);
+}
+
+
+/**
+ * @brief Statistics of the result cache since it was enabled.
+ *
+ * @param stats Where the statistics are stored.
+ */
+void result_cache_get_stats(result_cache_stats_t *stats){
+    pthread_mutex_lock(&cache_lock);
+    stats->lookups = cache_lookups;
+    stats->hits = cache_hits;
+    stats->insertions = cache_insertions;
+    stats->evictions = cache_evictions;
+    stats->hit_rate = (cache_lookups > 0) ? (double) cache_hits / (double) cache_lookups : 0.0;
+    stats->num_entries = cache_num_entries;
+    stats->capacity = cache_capacity;
+    stats->memory_bytes = cache_memory_bytes;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+
+/**
+ * @brief Saving of the entries of the result cache into a file, from the least to the most recently used.
+ *
+ * @param file Path of the file.
+ * @return -1 if the file can not be written, 0 for success.
+ */
+int result_cache_save(const char *file){
+    FILE *out = fopen(file, "wb");
+    if(out == NULL){
+        fprintf(stderr,"Error when creating the result cache %s.\n", file);
+        return -1;
+    }
+
+    pthread_mutex_lock(&cache_lock);
+
+    cache_file_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, RESULT_CACHE_MAGIC, sizeof(header.magic));
+    header.num_entries = cache_num_entries;
+    header.key_size = sizeof(result_cache_key_t);
+    header.info_size = sizeof(sim_info_t);
+    header.row_size = sizeof(double[3 + NUM_OF_HAND_TYPES]);
+
+    int error = (fwrite(&header, sizeof(header), 1, out) != 1);
+    for(cache_entry_t *entry = cache_oldest; entry != NULL && !error; entry = entry->newer){
+        error = fwrite(&entry->key, sizeof(entry->key), 1, out) != 1 ||
+                fwrite(&entry->info, sizeof(entry->info), 1, out) != 1 ||
+                fwrite(&entry->num_rows, sizeof(entry->num_rows), 1, out) != 1 ||
+                fwrite(entry->probabilities, header.row_size, entry->num_rows, out) != (size_t) entry->num_rows;
+    }
+
+    pthread_mutex_unlock(&cache_lock);
+
+    if(fclose(out) != 0 || error){
+        fprintf(stderr,"Error when writing the result cache %s.\n", file);
+        return -1;
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Loading of the entries saved by result_cache_save() into the result cache, which must be enabled. They
+ * are added to the current entries, and if there are more than the capacity the oldest ones are evicted.
+ *
+ * @param file Path of the file.
+ * @return -1 if the cache is disabled or the file can not be read or is not a valid result cache, 0 for success.
+ */
+int result_cache_load(const char *file){
+    if(!result_cache_enabled()) return -1;
+
+    FILE *in = fopen(file, "rb");
+    if(in == NULL){
+        fprintf(stderr,"Error when opening the result cache %s.\n", file);
+        return -1;
+    }
+
+    cache_file_header_t header;
+    if(fread(&header, sizeof(header), 1, in) != 1 || memcmp(header.magic, RESULT_CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+       header.key_size != sizeof(result_cache_key_t) || header.info_size != sizeof(sim_info_t) ||
+       header.row_size != sizeof(double[3 + NUM_OF_HAND_TYPES])){
+        fprintf(stderr,"Error: %s is not a valid result cache.\n", file);
+        fclose(in);
+        return -1;
+    }
+
+    double probabilities[MAX_PLAYERS][3 + NUM_OF_HAND_TYPES];
+    double *rows[MAX_PLAYERS];
+    for(int i = 0; i < MAX_PLAYERS; i++) rows[i] = probabilities[i];
+
+    int error = 0;
+    for(uint32_t e = 0; e < header.num_entries && !error; e++){
+        result_cache_key_t key;
+        sim_info_t info;
+        int num_rows;
+        error = fread(&key, sizeof(key), 1, in) != 1 ||
+                fread(&info, sizeof(info), 1, in) != 1 ||
+                fread(&num_rows, sizeof(num_rows), 1, in) != 1 ||
+                num_rows < 1 || num_rows > MAX_PLAYERS ||
+                fread(probabilities, header.row_size, num_rows, in) != (size_t) num_rows;
+        if(!error) result_cache_put(&key, num_rows, rows, &info);
+    }
+    fclose(in);
+
+    if(error){
+        fprintf(stderr,"Error when reading the result cache %s.\n", file);
+        return -1;
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Canonical key of a spot: the smallest of the keys of its 24 suit relabellings, so all the spots that only
+ * differ by a relabelling of the suits have the same key. The order of the hole cards of a player and the order
+ * of the community and discarded cards do not matter, the order of the players does.
+ *
+ * A call seeded from the clock accepts any result of the same precision. A call with a fixed seed expects the very
+ * probabilities that seed gives, so its seed, generator and number of threads are part of the key, and the suits
+ * are not relabelled: a relabelled spot deals different cards from the same seed.
+ *
+ * @param key Where the key is stored.
+ * @param mode Perspective of the spot.
+ * @param num_players Number of players.
+ * @param num_known_players Players with known cards, players [0..num_known_players-1].
+ * @param players_cards Hole cards of the players with known cards, integers in [0,51] (see cardtype_to_num()).
+ * @param board_cards Community cards.
+ * @param num_board_cards Number of community cards.
+ * @param discarded_cards Bit i set if card i was discarded.
+ * @param num_games Number of games requested.
+ * @param options Options of the simulation, only their precision and a fixed seed are part of the key. NULL for the
+ * default options.
+ */
+void canonical_spot_key(result_cache_key_t *key, sim_mode_t mode, int num_players, int num_known_players, const int players_cards[][2],
+                        const int board_cards[], int num_board_cards, uint64_t discarded_cards, int num_games, const sim_options_t *options){
+    uint64_t board_mask = 0;
+    for(int i = 0; i < num_board_cards; i++) board_mask |= 1ULL << board_cards[i];
+
+    result_cache_key_t candidate;
+    memset(&candidate, 0, sizeof(candidate));
+    candidate.mode = (uint8_t) mode;
+    candidate.num_players = (uint8_t) num_players;
+    candidate.num_known_players = (uint8_t) num_known_players;
+    candidate.num_games = num_games;
+    candidate.method = (options != NULL) ? options->method : SIM_METHOD_AUTO;
+    candidate.target_std_error = (options != NULL) ? options->target_std_error : 0.0;
+    candidate.variance_reduction = (options != NULL) ? (uint8_t) options->variance_reduction : SIM_VR_NONE;
+
+    int fixed_seed = (options != NULL && options->seed != SIM_SEED_FROM_CLOCK);
+    if(fixed_seed){
+        candidate.seed = options->seed;
+        candidate.rng = (uint8_t) options->rng;
+        candidate.num_threads = (options->num_threads < 1) ? 1 : options->num_threads;
+    }
+
+    // The first permutation is the identity
+    int num_permutations = fixed_seed ? 1 : NUM_SUIT_PERMUTATIONS;
+    for(int p = 0; p < num_permutations; p++){
+        const int *permutation = SUIT_PERMUTATIONS[p];
+
+        candidate.board_cards = permute_suits(board_mask, permutation);
+        candidate.discarded_cards = permute_suits(discarded_cards, permutation);
+        for(int i = 0; i < num_known_players; i++){
+            int c1 = permutation[players_cards[i][0] / NUM_RANKS] * NUM_RANKS + players_cards[i][0] % NUM_RANKS;
+            int c2 = permutation[players_cards[i][1] / NUM_RANKS] * NUM_RANKS + players_cards[i][1] % NUM_RANKS;
+            candidate.players_cards[i][0] = (uint8_t) ((c1 > c2) ? c1 : c2);
+            candidate.players_cards[i][1] = (uint8_t) ((c1 > c2) ? c2 : c1);
+        }
+
+        if(p == 0 || memcmp(&candidate, key, sizeof(candidate)) < 0){
+            memcpy(key, &candidate, sizeof(candidate));
+        }
+    }
+}
+
+
+/**
+ * @brief Search of a spot in the result cache. A hit makes the entry the most recently used.
+ *
+ * @param key Canonical key of the spot (see canonical_spot_key()).
+ * @param num_rows Rows of probabilities of the spot.
+ * @param probabilities Where the rows are copied, with 3 + NUM_OF_HAND_TYPES columns.
+ * @param info Where the information of the simulation that solved the spot is copied. It can be NULL.
+ * @return 1 if the spot was found, 0 otherwise or if the cache is disabled.
+ */
+int result_cache_get(const result_cache_key_t *key, int num_rows, double *probabilities[], sim_info_t *info){
+    pthread_mutex_lock(&cache_lock);
+
+    if(cache_capacity == 0){
+        pthread_mutex_unlock(&cache_lock);
+        return 0;
+    }
+
+    cache_lookups++;
+    cache_entry_t *entry = *find_entry(key);
+    int found = (entry != NULL && entry->num_rows == num_rows);
+
+    if(found){
+        cache_hits++;
+        for(int i = 0; i < num_rows; i++){
+            memcpy(probabilities[i], entry->probabilities[i], sizeof(entry->probabilities[i]));
+        }
+        if(info != NULL) *info = entry->info;
+        unlink_entry(entry);
+        push_newest(entry);
+    }
+
+    pthread_mutex_unlock(&cache_lock);
+    return found;
+}
+
+
+/**
+ * @brief Storing of the result of a spot in the result cache, as its most recently used entry. If the cache is
+ * full, the least recently used entry is evicted. Nothing is stored if the cache is disabled.
+ *
+ * @param key Canonical key of the spot (see canonical_spot_key()).
+ * @param num_rows Rows of probabilities of the spot.
+ * @param probabilities Rows of probabilities, with 3 + NUM_OF_HAND_TYPES columns.
+ * @param info Information of the simulation that solved the spot.
+ */
+void result_cache_put(const result_cache_key_t *key, int num_rows, double *probabilities[], const sim_info_t *info){
+    size_t entry_size = sizeof(cache_entry_t) + num_rows * sizeof(double[3 + NUM_OF_HAND_TYPES]);
+
+    pthread_mutex_lock(&cache_lock);
+
+    if(cache_capacity == 0){
+        pthread_mutex_unlock(&cache_lock);
+        return;
+    }
+
+    // A spot already cached is replaced
+    cache_entry_t **slot = find_entry(key);
+    if(*slot != NULL){
+        cache_entry_t *old = *slot;
+        *slot = old->bucket_next;
+        unlink_entry(old);
+        cache_memory_bytes -= sizeof(cache_entry_t) + old->num_rows * sizeof(double[3 + NUM_OF_HAND_TYPES]);
+        cache_num_entries--;
+        free(old);
+    }
+
+    if(cache_num_entries == cache_capacity){
+        cache_entry_t *oldest = cache_oldest;
+        cache_entry_t **oldest_slot = find_entry(&oldest->key);
+        *oldest_slot = oldest->bucket_next;
+        unlink_entry(oldest);
+        cache_memory_bytes -= sizeof(cache_entry_t) + oldest->num_rows * sizeof(double[3 + NUM_OF_HAND_TYPES]);
+        cache_num_entries--;
+        cache_evictions++;
+        free(oldest);
+    }
+
+    cache_entry_t *entry = malloc(entry_size);
+    if(entry != NULL){
+        memcpy(&entry->key, key, sizeof(entry->key));
+        entry->info = *info;
+        entry->num_rows = num_rows;
+        for(int i = 0; i < num_rows; i++){
+            memcpy(entry->probabilities[i], probabilities[i], sizeof(entry->probabilities[i]));
+        }
+
+        uint64_t bucket = hash_key(key) & (uint64_t) (cache_num_buckets - 1);
+        entry->bucket_next = cache_buckets[bucket];
+        cache_buckets[bucket] = entry;
+        push_newest(entry);
+
+        cache_memory_bytes += entry_size;
+        cache_num_entries++;
+        cache_insertions++;
+    }
+
+    pthread_mutex_unlock(&cache_lock);
+}
+
+
+/**
+ * @brief Hash of a key, FNV-1a over its bytes.
+ *
+ * @param key Key to hash.
+ * @return Hash of the key.
+ */
+uint64_t hash_key(const result_cache_key_t *key){
+    const unsigned char *bytes = (const unsigned char *) key;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for(size_t i = 0; i < sizeof(result_cache_key_t); i++){
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+
+/**
+ * @brief Search of a key in its hash bucket. The cache lock must be held.
+ *
+ * @param key Key to search.
+ * @return Pointer to the link that points to the entry of the key, which points to NULL if the key is not cached.
+ */
+cache_entry_t **find_entry(const result_cache_key_t *key){
+    cache_entry_t **slot = &cache_buckets[hash_key(key) & (uint64_t) (cache_num_buckets - 1)];
+    while(*slot != NULL && memcmp(&(*slot)->key, key, sizeof(result_cache_key_t)) != 0){
+        slot = &(*slot)->bucket_next;
+    }
+    return slot;
+}
+
+
+/**
+ * @brief Removal of an entry from the list of entries ordered by last use. The cache lock must be held.
+ *
+ * @param entry Entry to remove.
+ */
+void unlink_entry(cache_entry_t *entry){
+    if(entry->newer != NULL) entry->newer->older = entry->older;
+    else cache_newest = entry->older;
+    if(entry->older != NULL) entry->older->newer = entry->newer;
+    else cache_oldest = entry->newer;
+}
+
+
+/**
+ * @brief Insertion of an entry as the most recently used. The cache lock must be held.
+ *
+ * @param entry Entry to insert.
+ */
+void push_newest(cache_entry_t *entry){
+    entry->newer = NULL;
+    entry->older = cache_newest;
+    if(cache_newest != NULL) cache_newest->newer = entry;
+    else cache_oldest = entry;
+    cache_newest = entry;
+}
+
+
+/**
+ * @brief Freeing of all the entries of the cache. The cache lock must be held.
+ */
+void remove_all_entries(){
+    cache_entry_t *entry = cache_newest;
+    while(entry != NULL){
+        cache_entry_t *older = entry->older;
+        cache_memory_bytes -= sizeof(cache_entry_t) + entry->num_rows * sizeof(double[3 + NUM_OF_HAND_TYPES]);
+        free(entry);
+        entry = older;
+    }
+    if(cache_buckets != NULL) memset(cache_buckets, 0, cache_num_buckets * sizeof(cache_entry_t *));
+    cache_newest = NULL;
+    cache_oldest = NULL;
+    cache_num_entries = 0;
+}
+
+
+/**
+ * @brief Relabelling of the suits of a set of cards.
+ *
+ * @param cards Bit i set if card i is in the set.
+ * @param permutation New suit of each suit.
+ * @return Relabelled set.
+ */
+uint64_t permute_suits(uint64_t cards, const int permutation[]){
+    uint64_t permuted = 0;
+    for(int s = 0; s < NUM_SUITS; s++){
+        permuted |= ((cards >> (s * NUM_RANKS)) & SUIT_MASK) << (permutation[s] * NUM_RANKS);
+    }
+    return permuted;
+}
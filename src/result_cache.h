@@ -0,0 +1,62 @@
+/******************************************************************************
+ * File: result_cache.h
+ * Description: Header file for result_cache.c, a bounded LRU cache of
+ * simulation results keyed on suit-isomorphic spots.
+ ****************************************************************************/
+
+#pragma once
+#include "simulation.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define RESULT_CACHE_MAGIC "RSCACHE2"
+
+/* Key of a spot, the same for all the spots that only differ by a relabelling of the suits (see canonical_spot_key()),
+   plus the precision requested and the variance reduction. A call with a fixed seed is only answered by the same
+   seed, generator and number of threads, so that it stays reproducible. It has no padding, so keys are hashed and
+   compared as bytes. */
+
+typedef struct {
+    uint64_t board_cards;               // Bit i set if card i is on the board
+    uint64_t discarded_cards;           // Bit i set if card i was discarded
+    double target_std_error;
+    uint64_t seed;                      // 0 (SIM_SEED_FROM_CLOCK) for any seed, see canonical_spot_key()
+    int32_t num_games;
+    int32_t method;
+    int32_t num_threads;                // Only with a fixed seed, 0 otherwise
+    uint8_t players_cards[MAX_PLAYERS][2];  // Hole cards of the players with known cards, highest card first
+    uint8_t mode;                       // sim_mode_t
+    uint8_t num_players;
+    uint8_t num_known_players;
+    uint8_t variance_reduction;         // sim_variance_reduction_t
+    uint8_t rng;                        // rng_kind_t, only with a fixed seed
+    uint8_t reserved[1];
+} result_cache_key_t;
+
+/* Statistics of the cache since it was enabled */
+
+typedef struct {
+    uint64_t lookups;
+    uint64_t hits;
+    uint64_t insertions;
+    uint64_t evictions;
+    double hit_rate;            // hits / lookups, 0 without lookups
+    int num_entries;
+    int capacity;
+    size_t memory_bytes;        // Memory held by the entries and the hash table
+} result_cache_stats_t;
+
+/* These functions are meant to be called from outside the current module. */
+
+int result_cache_enable(int capacity);
+void result_cache_disable();
+int result_cache_enabled();
+void result_cache_clear();
+void result_cache_get_stats(result_cache_stats_t *stats);
+int result_cache_save(const char *file);
+int result_cache_load(const char *file);
+
+void canonical_spot_key(result_cache_key_t *key, sim_mode_t mode, int num_players, int num_known_players, const int players_cards[][2],
+                        const int board_cards[], int num_board_cards, uint64_t discarded_cards, int num_games, const sim_options_t *options);
+int result_cache_get(const result_cache_key_t *key, int num_rows, double *probabilities[], sim_info_t *info);
+void result_cache_put(const result_cache_key_t *key, int num_rows, double *probabilities[], const sim_info_t *info);
@@ -9,18 +9,277 @@
  ****************************************************************************/
 
 #include "simulation.h"
+#include "preflop_tables.h"
+#include "result_cache.h"
+#include "hand_ranges.h"
+#include "instrument.h"
 
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
 #include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+
+#define CACHE_LINE_SIZE 64
+#define RANGE_PROBE_DEALS 100000    // Deals of the ranges tried to check that they can be dealt, see ranges_dealable()
+#define RANGE_MIN_ACCEPTED 100      // Accepted deals needed among them: an acceptance rate of at least 1 in 1000
+#define RANGE_PROBE_SEED 0x52414E4745ULL
+#define MAX_STRATA TOTAL_CARDS      // Strata of the variance reduction: next community card, or hand type of a player
+#define QMC_REPLICATES 16           // Independently shifted copies of the quasi-random sequence, see SIM_VR_QUASI_RANDOM
+#define QMC_MAX_DIMENSIONS (5 + 2 * MAX_PLAYERS)   // One dimension per dealt card
+#define TYPE_CACHE_SIZE 4096        // Entries of the cache of hand type distributions, a power of 2, see hand_type_probabilities()
+#define NUM_SUITS 4
+#define NUM_SUIT_PERMUTATIONS 24
+
+extern int SUIT_PERMUTATIONS[NUM_SUIT_PERMUTATIONS][NUM_SUITS];
+uint64_t permute_suits(uint64_t cards, const int permutation[]);
+
+
+/* Setup of the games of a simulation, shared (read only) by all the simulation threads */
+
+typedef struct {
+    int num_players;
+    int num_known_players;              // Players [0..num_known_players-1] have known cards, the rest receive random cards
+    int players_cards[MAX_PLAYERS][2];  // Cards in [0,51] of the players with known cards
+    int board_cards[5];
+    int num_board_cards;
+    int unknown_cards[TOTAL_CARDS];     // Deck with all the cards that are not known
+    int num_unknown_cards;
+    int num_ranged_players;             // Players with unknown cards that receive a combo of their range
+    const range_sampler_t *ranges[MAX_PLAYERS]; // Range of every player with unknown cards, NULL for random cards
+    sim_variance_reduction_t variance_method;   // Only set for Monte Carlo, see prepare_variance_reduction()
+    double preparation_games;           // Cost of preparing the technique in games of plain Monte Carlo, see fill_info()
+    double type_probabilities[MAX_PLAYERS][NUM_OF_HAND_TYPES]; // SIM_VR_CONTROL_VARIATE: exact hand types of the known players
+    int qmc_multipliers[QMC_MAX_DIMENSIONS];    // SIM_VR_QUASI_RANDOM: digit scrambling of every dimension
+    double qmc_shifts[QMC_REPLICATES][QMC_MAX_DIMENSIONS];  // SIM_VR_QUASI_RANDOM: random shift of every replicate
+} game_setup_t;
+
+/* Counters of the games. Aligned to the cache line so that the counters of different threads never share one. */
+
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) int num_of_games;
+    int num_of_wins[MAX_PLAYERS];
+    int num_of_draws[MAX_PLAYERS];
+    int num_of_hand_types[MAX_PLAYERS][NUM_OF_HAND_TYPES];
+    // Variance reduction, only for the players with known cards
+    int stratum_games[MAX_PLAYERS][MAX_STRATA];     // Stratified, control variate and quasi-random: games of each stratum
+    int stratum_wins[MAX_PLAYERS][MAX_STRATA];
+    int stratum_draws[MAX_PLAYERS][MAX_STRATA];
+} game_counters_t;
+
+/* State of the exact enumeration of all the games of a setup */
+
+typedef struct {
+    const game_setup_t *setup;
+    int players_cards[MAX_PLAYERS][2];  // Cactus Kev encoded cards of the current game
+    int board[5];                       // Cactus Kev encoded community cards of the current game
+    uint64_t used;                      // Positions of setup->unknown_cards dealt in the current game
+    eval_board_t board_state;           // Current board prepared for eval_with_hole()
+    unsigned short scores[MAX_PLAYERS]; // Scores of the players whose cards are already decided
+    game_counters_t *counters;
+} enumeration_t;
+
+/* Entry of the cache of hand type distributions, keyed on the canonical spot of a player, see type_cache_key() */
+
+typedef struct {
+    uint64_t hole_cards;    // 0 if the entry is empty
+    uint64_t board_cards;
+    uint64_t dead_cards;    // Known cards of the other players and discarded cards
+    double probabilities[NUM_OF_HAND_TYPES];
+} type_cache_entry_t;
+
+/* State of a simulation thread */
+
+typedef struct {
+    game_counters_t counters;
+    const game_setup_t *setup;
+    int num_games;
+    long first_game;            // Number of the first game of the thread in the whole simulation
+    rng_t rng;
+} simulation_thread_t;
+
+/* Share of a thread started by run_threads(): the first member of the state of every such thread */
+
+typedef struct {
+    const void *work;           // Setup of the work, the same for all the threads
+    int exact;                  // 1 to enumerate the share of the thread, 0 to simulate num_games games
+    int thread;                 // With exact, the thread enumerates the items whose index modulo num_threads is thread
+    int num_threads;
+    int num_games;
+    rng_t rng;
+} thread_share_t;
+
+/* Body of a thread started by run_threads(), and addition of the counters of a thread into those of another one */
+
+typedef void *(*thread_body_fn)(void *thread);
+typedef void (*thread_merge_fn)(void *total, const void *thread);
+
+/* State of a thread of simulate_spectator_streets(). With exact enumeration every counter counts ordered runouts
+   (turn, river), so the games of all the streets are the same. The work is the game_setup_t of the spot, and exact
+   enumerates flops. */
+
+typedef struct {
+    thread_share_t share;
+    game_counters_t counters[SIM_MAX_STREETS];  // counters[s] for the street with 3 + s community cards
+    int num_runouts;            // Different complete boards scored
+} streets_thread_t;
+
+/* State of a thread of simulate_player_sweep(). The counters are those of the whole table, except the wins and ties
+   of the player, which are counted against the first k opponents for every k. The work is the game_setup_t of the
+   largest table. */
+
+typedef struct {
+    thread_share_t share;
+    game_counters_t counters;
+    int sweep_wins[MAX_PLAYERS];    // sweep_wins[k] with k opponents
+    int sweep_draws[MAX_PLAYERS];
+} sweep_thread_t;
+
+/* Setup of an Omaha spot, see simulate_player_omaha(). The hole cards of game.players_cards are not used. */
+
+typedef struct {
+    game_setup_t game;      // Players, community cards and deck of unknown cards
+    int players_cards[OMAHA_MAX_PLAYERS][OMAHA_HOLE_CARDS];    // Cards in [0,51] of the players with known cards
+} omaha_setup_t;
+
+/* State of a thread of an Omaha simulation. The work is the omaha_setup_t of the spot, and exact enumerates
+   boards. */
+
+typedef struct {
+    thread_share_t share;
+    game_counters_t counters;
+} omaha_thread_t;
+
+/* Hero holdings of simulate_holdings(): those that do not use a known card */
+
+typedef struct {
+    const game_setup_t *setup;          // The opponents, all of them with unknown cards
+    int num_holdings;
+    int index[SIM_NUM_HOLDINGS];        // Index of every holding, see holding_index()
+    int cards[SIM_NUM_HOLDINGS][2];     // Cactus Kev encoded cards of every holding
+    uint64_t masks[SIM_NUM_HOLDINGS];   // Bits of the two cards of every holding
+} holdings_t;
+
+/* Counters of a hero holding, see simulate_holdings() */
+
+typedef struct {
+    int num_of_games;
+    int num_of_wins;
+    int num_of_draws;
+    int num_of_hand_types[NUM_OF_HAND_TYPES];
+} holding_counters_t;
+
+/* State of a thread of simulate_holdings(). The work is the holdings_t. */
+
+typedef struct {
+    thread_share_t share;
+    holding_counters_t counters[SIM_NUM_HOLDINGS];  // counters[i] for the holding i of the holdings_t
+} holdings_thread_t;
+
+#define LOCKSTEP_GAMES 16          // Games dealt together and scored with a single call to get_scores7_batch()
+#define ADAPTIVE_MIN_CHUNK 2000   // Games simulated before the first check of the standard errors
+#define PROGRESS_DEFAULT_MS 100.0 // Interval of the progress callback when neither progress_games nor progress_ms is set
+
+/* Batch of scenarios, shared by the threads that solve it. Each thread takes the next scenario not taken yet. */
+
+typedef struct {
+    const sim_scenario_t *scenarios;
+    sim_result_t *results;
+    int num_scenarios;
+    sim_options_t options;      // Options of the batch, with the seed already resolved
+    int fixed_seed;             // Whether the seed was given by the caller rather than taken from the clock
+    atomic_int next_scenario;
+} batch_t;
+
+#define GOLDEN_GAMMA 0x9E3779B97F4A7C15ULL  // Distance between the seeds of consecutive scenarios of a batch
+
+/* Bases of the dimensions of the Halton sequence, the first QMC_MAX_DIMENSIONS primes */
+
+static const int QMC_PRIMES[QMC_MAX_DIMENSIONS] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101,
+    103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211,
+    223, 227, 229, 233
+};
 
+/* Scratch space of the simulations that is too large for the stack, see sim_arena_create() */
 
-#define PERMUTATIONS 21
-#define NUM_OF_HAND_TYPES 9
+struct sim_arena {
+    range_sampler_t samplers[MAX_PLAYERS];  // Samplers of the ranges, samplers[i] for player i
+};
 
 
-void shuffle(int *array, size_t n);
+void deal_cards(int *array, size_t n, size_t k, rng_t *rng);
+void build_unknown_cards(game_setup_t *setup, uint64_t known_mask);
+void build_spectator_setup(game_setup_t *setup, char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players);
+int valid_board_size(int num_board_cards);
+int setup_dealable(const game_setup_t *setup);
 void init_deck(int deck[]);
 void init_score_to_hand_num();
+void run_simulation(const game_setup_t *setup, int num_games, int num_threads, rng_t rngs[], game_counters_t *counters);
+int run_adaptive_simulation(const game_setup_t *setup, sim_mode_t mode, int max_games, const sim_options_t *options, int num_threads, rng_t rngs[], game_counters_t *counters);
+int report_progress(const game_setup_t *setup, sim_mode_t mode, const game_counters_t *counters, const sim_options_t *options);
+double games_for_std_error(const game_setup_t *setup, const game_counters_t *counters, double target_std_error);
+void seed_generators(const sim_options_t *options, rng_t rngs[], int num_threads);
+void *run_threads(size_t thread_size, const void *work, int exact, int num_games, int num_threads, const sim_options_t *options,
+                  thread_body_fn body, thread_merge_fn merge);
+void add_counters(game_counters_t *total, const game_counters_t *counters, int num_players);
+uint64_t resolve_seed(uint64_t seed);
+void player_probabilities(const game_counters_t *counters, int num_players, double *probabilities[2]);
+void spectator_probabilities(const game_counters_t *counters, int num_players, double *probabilities[]);
+void *batch_thread(void *arg);
+sim_arena_t *thread_arena();
+void create_arena_key();
+void solve_scenario(const sim_scenario_t *scenario, sim_result_t *result, const sim_options_t *batch_options, int fixed_seed, int index);
+void fill_info(sim_info_t *info, sim_method_t method, const game_setup_t *setup, const game_counters_t *counters);
+const preflop_entry_t *find_preflop_entry(const game_setup_t *setup, int requested_games, const sim_options_t *options, int *num_games, int *exact);
+void precomputed_probabilities(const preflop_entry_t *entry, int num_games, int exact, int num_rows, double *probabilities[], sim_info_t *info);
+void setup_cache_key(const game_setup_t *setup, sim_mode_t mode, int num_games, const sim_options_t *options, result_cache_key_t *key);
+void *simulation_thread(void *arg);
+void play_games(const game_setup_t *setup, int random_vec[], int num_games, rng_t *rng, game_counters_t *counters);
+void play_variance_reduced_games(const game_setup_t *setup, int random_vec[], int num_games, long first_game, rng_t *rng, game_counters_t *counters);
+static inline void place_dealt_cards(const game_setup_t *setup, const int dealt[], const int map[], int players_cards[][2], int board[5]);
+static inline void deal_quasi_random_cards(const game_setup_t *setup, uint64_t index, const double shifts[], int dealt[]);
+static inline double scrambled_radical_inverse(uint64_t index, int base, int multiplier);
+void prepare_variance_reduction(game_setup_t *setup, sim_variance_reduction_t method, rng_t *rng);
+void *streets_thread(void *arg);
+void merge_streets(void *total, const void *thread);
+void enumerate_runouts(const game_setup_t *setup, const int board_cards[], const int remaining[], int num_remaining, streets_thread_t *thread);
+void play_runouts(const game_setup_t *setup, int random_vec[], int num_games, rng_t *rng, streets_thread_t *thread);
+void *sweep_thread(void *arg);
+void merge_sweep(void *total, const void *thread);
+void play_sweep_games(const game_setup_t *setup, int random_vec[], int num_games, rng_t *rng, sweep_thread_t *thread);
+void *holdings_thread(void *arg);
+void merge_holdings(void *total, const void *thread);
+int run_omaha(const omaha_setup_t *setup, int num_games, const sim_options_t *options, game_counters_t *counters, sim_info_t *info);
+void *omaha_thread(void *arg);
+void merge_omaha(void *total, const void *thread);
+void play_omaha_games(const omaha_setup_t *setup, int random_vec[], int num_games, rng_t *rng, game_counters_t *counters);
+void enumerate_omaha_boards(const omaha_setup_t *setup, omaha_thread_t *thread);
+static inline void tally_omaha_game(const omaha_setup_t *setup, int players_cards[][OMAHA_HOLE_CARDS], const int board[5], game_counters_t *counters);
+void play_holdings(const game_setup_t *setup, const holdings_t *holdings, int random_vec[], int num_games, rng_t *rng, holding_counters_t counters[]);
+void hand_type_probabilities(game_setup_t *setup);
+void type_cache_key(const game_setup_t *setup, int player, uint64_t key[3]);
+static inline int type_cache_slot(const uint64_t key[3]);
+double estimator_variance(const game_setup_t *setup, const game_counters_t *counters, int player, int draws);
+double stratified_estimate(const game_setup_t *setup, const game_counters_t *counters, int player, int draws, double *variance);
+void apply_stratification(const game_setup_t *setup, game_counters_t *counters);
+static inline void deal_game(const game_setup_t *setup, int random_vec[], int num_dealt_cards, rng_t *rng, int players_cards[][2], int board[5]);
+static inline void deal_ranged_game(const game_setup_t *setup, int random_vec[], unsigned char positions[], int num_dealt_cards, rng_t *rng, int players_cards[][2], int board[5]);
+static inline void draw_range_combos(const game_setup_t *setup, rng_t *rng, int combos[]);
+static inline int draw_alias(const range_sampler_t *sampler, rng_t *rng);
+static inline int try_range_combos(const game_setup_t *setup, rng_t *rng, int combos[]);
+int ranges_dealable(const game_setup_t *setup);
+static inline void tally_game(const unsigned short player_i_best_score[], int num_players, game_counters_t *counters);
+static inline void tally_weighted_game(const unsigned short player_i_best_score[], int num_players, int weight, game_counters_t *counters);
+int compute_counters(const game_setup_t *setup, sim_mode_t mode, int num_games, const sim_options_t *options, game_counters_t *counters, sim_info_t *info);
+double count_exact_games(const game_setup_t *setup);
+void enumerate_board(enumeration_t *enumeration, int board_pos, int start);
+void enumerate_players(enumeration_t *enumeration, int player);
+static inline uint64_t rotl64(uint64_t x, int k);
+static inline uint64_t splitmix64(uint64_t *x);
 
 /* Deck of cards */
 
@@ -30,33 +289,14 @@ int deck[TOTAL_CARDS];
 
 unsigned char score_hand_to_num[NUM_OF_EQUIVALENCES + 1];
 
-/* All possible groups of 5 cards from a set of 7, without repetition. choose(7,5) */
+/* Cache of the hand type distributions of SIM_VR_CONTROL_VARIATE, direct mapped, see hand_type_probabilities() */
 
-int groups_5[PERMUTATIONS][5] =
-{
-    { 0, 1, 2, 3, 4 },
-    { 0, 1, 2, 3, 5 },
-    { 0, 1, 2, 3, 6 },
-    { 0, 1, 2, 4, 5 },
-    { 0, 1, 2, 4, 6 },
-    { 0, 1, 2, 5, 6 },
-    { 0, 1, 3, 4, 5 },
-    { 0, 1, 3, 4, 6 },
-    { 0, 1, 3, 5, 6 },
-    { 0, 1, 4, 5, 6 },
-    { 0, 2, 3, 4, 5 },
-    { 0, 2, 3, 4, 6 },
-    { 0, 2, 3, 5, 6 },
-    { 0, 2, 4, 5, 6 },
-    { 0, 3, 4, 5, 6 },
-    { 1, 2, 3, 4, 5 },
-    { 1, 2, 3, 4, 6 },
-    { 1, 2, 3, 5, 6 },
-    { 1, 2, 4, 5, 6 },
-    { 1, 3, 4, 5, 6 },
-    { 2, 3, 4, 5, 6 }
-};
+type_cache_entry_t type_cache[TYPE_CACHE_SIZE];
+pthread_mutex_t type_cache_lock = PTHREAD_MUTEX_INITIALIZER;
 
+/* Key of the arena of every thread, see thread_arena() */
+
+pthread_key_t arena_key;
 
 /**
  * @brief Calculation of the user's probability of winning, losing, and tying in poker games by simulating them.
@@ -72,11 +312,79 @@ int groups_5[PERMUTATIONS][5] =
  * and the probabilities of obtaining various poker hands. [0..1][3..11].
  * [0][...] represents the user's probabilities, and [1][3..11] represents the opponent's probabilities.
  * [1][0..2] are not used because they are the complementary of the user's.
+ * NULL if the number of players or known cards is out of range or there are not enough cards to deal the games.
  */
 double** simulate_player(char* known_cards[], int num_known_cards, int num_players, int num_games){
+    return simulate_player_ex(known_cards, num_known_cards, num_players, num_games, NULL, NULL);
+}
+
+
+/**
+ * @brief Multi-threaded version of simulate_player(). The games are split across num_threads threads, each one with
+ * its own copy of the deck, its own random state and its own counters, which are merged at the end.
+ *
+ * @param known_cards Cards that are known, including both user's and community cards.
+ * known_cards[0..1] = player's cards, known_cards[2..n] = community cards.
+ * @param num_known_cards The number of known cards, i.e., the sum of the user's cards and the cards that have been revealed on the table.
+ * @param num_players The number of players.
+ * @param num_games The number of games to be simulated.
+ * @param num_threads The number of threads that simulate the games. With 1 the games are simulated in the calling thread.
+ * @return The same matrix returned by simulate_player().
+ */
+double** simulate_player_mt(char* known_cards[], int num_known_cards, int num_players, int num_games, int num_threads){
+    sim_options_t options;
+    sim_default_options(&options);
+    options.num_threads = num_threads;
+    return simulate_player_ex(known_cards, num_known_cards, num_players, num_games, &options, NULL);
+}
+
 
+/**
+ * @brief Version of simulate_player() that takes the options of the simulation: number of threads, random number
+ * generator, seed and method. With the same seed and number of threads the results are reproducible.
+ *
+ * By default (SIM_METHOD_AUTO) the games are enumerated exactly, instead of simulated, when the number of
+ * possible games is not greater than num_games, e.g. heads-up on the turn or on the river.
+ *
+ * @param known_cards Cards that are known, including both user's and community cards.
+ * known_cards[0..1] = player's cards, known_cards[2..n] = community cards.
+ * @param num_known_cards The number of known cards, i.e., the sum of the user's cards and the cards that have been revealed on the table.
+ * @param num_players The number of players.
+ * @param num_games The number of games to be simulated.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param info Where the method used and the number of games are stored. It can be NULL.
+ * @return The same matrix returned by simulate_player().
+ */
+double** simulate_player_ex(char* known_cards[], int num_known_cards, int num_players, int num_games, const sim_options_t *options, sim_info_t *info){
+    return simulate_player_ranges(known_cards, num_known_cards, num_players, num_games, NULL, options, info);
+}
 
 
+/**
+ * @brief Version of simulate_player_ex() where every opponent can hold a weighted range of hole cards (see
+ * parse_range()) instead of random cards. In every game each opponent with a range receives one of its combos
+ * with probability proportional to its weight, among the combos that do not use any known card.
+ *
+ * The combos of all the ranges are drawn at once from alias tables, in constant time per opponent, and the deal
+ * is rejected and drawn again if two opponents share a card, which gives exactly the joint distribution of the
+ * ranges conditioned on their cards being different. Ranges so narrow and overlapping that fewer than 1 in 1000
+ * deals are accepted (see ranges_dealable()) are refused. The cards of the combos are then moved to the front of
+ * the deck and the rest of the game is dealt as usual. Ranges are always simulated with the Monte Carlo method.
+ *
+ * @param known_cards Cards that are known, including both user's and community cards.
+ * known_cards[0..1] = player's cards, known_cards[2..n] = community cards.
+ * @param num_known_cards The number of known cards, i.e., the sum of the user's cards and the cards that have been revealed on the table.
+ * @param num_players The number of players.
+ * @param num_games The number of games to be simulated.
+ * @param ranges Range of every opponent, ranges[i] for opponent i + 1, NULL for random cards. NULL if no
+ * opponent has a range.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param info Where the method used and the number of games are stored. It can be NULL.
+ * @return The same matrix returned by simulate_player(), NULL if no combo of a range is left after removing the
+ * known cards or the ranges can (almost) never be dealt together.
+ */
+double** simulate_player_ranges(char* known_cards[], int num_known_cards, int num_players, int num_games, const hand_range_t *ranges[],
+                                const sim_options_t *options, sim_info_t *info){
 
     /*  
         [0][...] User player
@@ -105,12 +413,74 @@ double** simulate_player(char* known_cards[], int num_known_cards, int num_playe
     probabilities[0] = (double*) malloc((3 + NUM_OF_HAND_TYPES) * sizeof(double));
     probabilities[1] = (double*) malloc((3 + NUM_OF_HAND_TYPES) * sizeof(double));
 
+    sim_result_t result;
 
-    srand (time(NULL));
+    if(simulate_player_ranges_into(known_cards, num_known_cards, num_players, num_games, ranges, options, NULL, &result) == -1){
+        free(probabilities[0]);
+        free(probabilities[1]);
+        free(probabilities);
+        return NULL;
+    }
+
+    for(int i = 0; i < 2; i++){
+        memcpy(probabilities[i], result.probabilities[i], (3 + NUM_OF_HAND_TYPES) * sizeof(double));
+    }
+    if(info != NULL) *info = result.info;
+
+    return probabilities;
+}
+
+
+/**
+ * @brief Version of simulate_player_ex() that writes the probabilities into a result owned by the caller instead of
+ * allocating a matrix: rows 0 and 1 of result->probabilities are the rows of the matrix of simulate_player().
+ * The scratch space of the simulation (setup, deck, scores and counters) lives on the stack, so with one thread
+ * and the result cache disabled the call never touches the heap.
+ *
+ * @param known_cards Cards that are known, including both user's and community cards.
+ * known_cards[0..1] = player's cards, known_cards[2..n] = community cards.
+ * @param num_known_cards The number of known cards, i.e., the sum of the user's cards and the cards that have been revealed on the table.
+ * @param num_players The number of players.
+ * @param num_games The number of games to be simulated.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param result Where the probabilities, their number of rows and the information of the simulation are stored.
+ * @return 0 for success, -1 if the number of players or known cards is out of range or there are not enough cards
+ * to deal the games.
+ */
+int simulate_player_into(char* known_cards[], int num_known_cards, int num_players, int num_games, const sim_options_t *options, sim_result_t *result){
+    return simulate_player_ranges_into(known_cards, num_known_cards, num_players, num_games, NULL, options, NULL, result);
+}
+
+
+/**
+ * @brief Version of simulate_player_ranges() that writes into a result owned by the caller, see simulate_player_into().
+ * The samplers of the ranges are built in an arena, the caller's or one of the calling thread that is allocated by its
+ * first simulation with ranges and freed when the thread exits.
+ *
+ * @param known_cards Cards that are known, including both user's and community cards.
+ * known_cards[0..1] = player's cards, known_cards[2..n] = community cards.
+ * @param num_known_cards The number of known cards, i.e., the sum of the user's cards and the cards that have been revealed on the table.
+ * @param num_players The number of players.
+ * @param num_games The number of games to be simulated.
+ * @param ranges Range of every opponent, ranges[i] for opponent i + 1, NULL for random cards. NULL if no
+ * opponent has a range.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param arena Arena created by sim_arena_create(), NULL for the arena of the calling thread. It must not be used by
+ * two simulations at the same time.
+ * @param result Where the probabilities, their number of rows and the information of the simulation are stored.
+ * @return 0 for success, -1 if the number of players or known cards is out of range, no combo of a range is left
+ * after removing the known cards, the ranges can not be dealt together or the arena of the thread can not be
+ * allocated.
+ */
+int simulate_player_ranges_into(char* known_cards[], int num_known_cards, int num_players, int num_games, const hand_range_t *ranges[],
+                                const sim_options_t *options, sim_arena_t *arena, sim_result_t *result){
+    double *probabilities[2] = { result->probabilities[0], result->probabilities[1] };
+
+    memset(result->probabilities, 0, 2 * sizeof(result->probabilities[0]));
+    result->num_rows = 0;
+    if(num_players < 2 || num_players > MAX_PLAYERS || !valid_board_size(num_known_cards - 2)) return -1;
+    result->num_rows = 2;
 
-    
-    int num_unknown_cards = TOTAL_CARDS - num_known_cards; 
-    
     int known_cards_num[num_known_cards];
 
     /* We transform the cards from 3 char string to [0,51] integers */
@@ -120,397 +490,2923 @@ double** simulate_player(char* known_cards[], int num_known_cards, int num_playe
     }
 
 
+    /* Only the user's cards are known, the opponents receive random cards in every game */
+
+    game_setup_t setup;
+
+    setup.num_players = num_players;
+    setup.num_known_players = 1;
+    setup.num_ranged_players = 0;
+    setup.players_cards[0][0] = known_cards_num[0];
+    setup.players_cards[0][1] = known_cards_num[1];
+    setup.num_board_cards = num_known_cards - 2;
+    for(int i = 2; i < num_known_cards; i++){
+        setup.board_cards[i - 2] = known_cards_num[i];
+    }
     
 
     /* Create a deck with all the cards except those that are known. */
 
-    int random_vec[num_unknown_cards]; // Baralla
-    for(int i = 0, founded = 0; i < TOTAL_CARDS; i++){
-        char equal = 0;
-        for(int j = 0; j < (num_known_cards);j++){
-            if(known_cards_num[j] == i){
-                equal = 1;
-                founded++;
-                break;
-            }
+    uint64_t known_mask = 0;
+    for(int i = 0; i < num_known_cards; i++){
+        known_mask |= 1ULL << known_cards_num[i];
+    }
+    build_unknown_cards(&setup, known_mask);
+    if(!setup_dealable(&setup)) return -1;
+
+
+    /* Opponents with a range receive a combo of it in every game, the rest receive random cards. Their samplers are
+       too large for the stack, so they are built in the arena. */
+
+    if(ranges != NULL){
+        if(arena == NULL) arena = thread_arena();
+        int dealable = (arena != NULL);
+
+        for(int i = 1; i < num_players && dealable; i++){
+            setup.ranges[i] = NULL;
+            if(ranges[i - 1] == NULL) continue;
+            dealable = (build_range_sampler(&arena->samplers[i], ranges[i - 1], known_mask) == 0);
+            setup.ranges[i] = &arena->samplers[i];
+            setup.num_ranged_players++;
+        }
+
+        if(!dealable || (setup.num_ranged_players > 0 && !ranges_dealable(&setup))){
+            return -1;
         }
-        if(equal == 0) random_vec[i - founded] = i;
-        
     }
 
 
-    // players_cards[0][0..1] = user cards
+    /* Preflop queries are answered from the precomputed tables, if they are loaded */
+
+    int precomputed_games, precomputed_exact;
+    const preflop_entry_t *entry = find_preflop_entry(&setup, num_games, options, &precomputed_games, &precomputed_exact);
+    if(entry != NULL){
+        precomputed_probabilities(entry, precomputed_games, precomputed_exact, 2, probabilities, &result->info);
+        return 0;
+    }
 
-    int players_cards[num_players][2];
 
-    players_cards[0][0] = known_cards_num[0];
-    players_cards[0][1] = known_cards_num[1];
+    /* Spots already solved, up to a relabelling of the suits, are answered from the result cache, if it is enabled */
 
+    result_cache_key_t cache_key;
+    int use_cache = (setup.num_ranged_players == 0) && result_cache_enabled();
+    if(use_cache){
+        setup_cache_key(&setup, SIM_MODE_PLAYER, num_games, options, &cache_key);
+        if(result_cache_get(&cache_key, 2, probabilities, &result->info)) return 0;
+    }
 
 
     /* --- Game simulations --- */
 
-    int num_of_wins[num_players];
-    int num_of_draws[num_players];
-    int num_of_hand_types_user[NUM_OF_HAND_TYPES];
-    int num_of_hand_types_opponents[NUM_OF_HAND_TYPES];
+    game_counters_t counters;
 
-    /* Counter arrays initialization */
+    int stopped = compute_counters(&setup, SIM_MODE_PLAYER, num_games, options, &counters, &result->info);
 
-    for(int i = 0; i < NUM_OF_HAND_TYPES;i++){
-        num_of_hand_types_user[i] = 0;
-        num_of_hand_types_opponents[i] = 0;
+    player_probabilities(&counters, num_players, probabilities);
+
+    if(use_cache && !stopped) result_cache_put(&cache_key, 2, probabilities, &result->info);
+
+    return 0;
+}
+
+
+/**
+ * @brief Calculation of the probability of winning, losing, and tying for each player from a spectator's perspective.
+ * The spectator is aware of the cards held by all the players and those on the table.
+ *
+ * Probabilities are derived from simulating poker games. Games are played with all the active players' cards and the
+ * community cards, discarding the cards of players who have folded from the deck and randomly selecting the community
+ * cards that have not yet appeared.
+ *
+ * @param player_cards Cards of the active players. players_cards[0..1] = first player's cards,
+ * players_cards[2..3] = second player's cards, and so on.
+ * @param board_cards Community cards.
+ * @param discarded_cards Discarded cards. These are the cards that were in the hands of players who
+ * no longer play (have folded).
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_board_cards Number of community cards.
+ * @param num_players Number of players.
+ * @param num_games Number of games to simulate.
+ * @return A matrix with as many rows as there are players and three columns. In row "i," you will find the probabilities
+ * of winning (rtn[i][0]), losing (rtn[i][1]), and tying (rtn[i][2]) for player "i." and for rtn[i][3...11] the probabilities
+ * of having each of the different types of poker hands. NULL if the number of players or community cards is out of
+ * range or there are not enough cards to deal the missing community cards.
+ */
+double** simulate_spectator(char* players_cards[], char* board_cards[], char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games){
+    return simulate_spectator_ex(players_cards, board_cards, discarded_cards, num_discarded_cards, num_board_cards, num_players, num_games, NULL, NULL);
+}
+
+
+/**
+ * @brief Multi-threaded version of simulate_spectator(). The games are split across num_threads threads, each one with
+ * its own copy of the deck, its own random state and its own counters, which are merged at the end.
+ *
+ * @param player_cards Cards of the active players. players_cards[0..1] = first player's cards,
+ * players_cards[2..3] = second player's cards, and so on.
+ * @param board_cards Community cards.
+ * @param discarded_cards Discarded cards.
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_board_cards Number of community cards.
+ * @param num_players Number of players.
+ * @param num_games Number of games to simulate.
+ * @param num_threads The number of threads that simulate the games. With 1 the games are simulated in the calling thread.
+ * @return The same matrix returned by simulate_spectator().
+ */
+double** simulate_spectator_mt(char* players_cards[], char* board_cards[], char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games, int num_threads){
+    sim_options_t options;
+    sim_default_options(&options);
+    options.num_threads = num_threads;
+    return simulate_spectator_ex(players_cards, board_cards, discarded_cards, num_discarded_cards, num_board_cards, num_players, num_games, &options, NULL);
+}
+
+
+/**
+ * @brief Version of simulate_spectator() that takes the options of the simulation: number of threads, random number
+ * generator, seed and method. With the same seed and number of threads the results are reproducible.
+ *
+ * By default (SIM_METHOD_AUTO) the games are enumerated exactly, instead of simulated, when the number of
+ * possible games is not greater than num_games, e.g. on the turn, on the river or heads-up on the flop.
+ *
+ * @param player_cards Cards of the active players. players_cards[0..1] = first player's cards,
+ * players_cards[2..3] = second player's cards, and so on.
+ * @param board_cards Community cards.
+ * @param discarded_cards Discarded cards.
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_board_cards Number of community cards.
+ * @param num_players Number of players.
+ * @param num_games Number of games to simulate.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param info Where the method used and the number of games are stored. It can be NULL.
+ * @return The same matrix returned by simulate_spectator().
+ */
+double** simulate_spectator_ex(char* players_cards[], char* board_cards[], char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games, const sim_options_t *options, sim_info_t *info){
+
+    // Memory allocation for the probabilities
+
+    /*  
+        [...][0] Victory
+        [...][1] Defeat
+        [...][2] Tie
+
+        [...][3] Straight Flush
+        [...][4] Four of a Kind
+        [...][5] Full Houses
+        [...][6] Flush
+        [...][7] Straight
+        [...][8] Three of a Kind
+        [...][9] Two Pair
+        [...][10] One Pair
+        [...][11] High Card
+     */
+
+
+    
+    sim_result_t result;
+
+    if(simulate_spectator_into(players_cards, board_cards, discarded_cards, num_discarded_cards, num_board_cards, num_players, num_games, options, &result) == -1){
+        return NULL;
     }
+
+    double** probabilities = (double**) malloc(num_players * sizeof(double*));
+    for(int i = 0; i < num_players;i++) probabilities[i] = (double*) malloc((3 + NUM_OF_HAND_TYPES) * sizeof(double));
+
     for(int i = 0; i < num_players; i++){
-        num_of_wins[i] = 0;
-        num_of_draws[i] = 0;
-    } 
+        memcpy(probabilities[i], result.probabilities[i], (3 + NUM_OF_HAND_TYPES) * sizeof(double));
+    }
+    if(info != NULL) *info = result.info;
+
+    return probabilities;
+}
+
+
+/**
+ * @brief Version of simulate_spectator_ex() that writes the probabilities into a result owned by the caller instead of
+ * allocating a matrix: row i of result->probabilities is the row of player i of the matrix of simulate_spectator().
+ * The scratch space of the simulation (setup, deck, scores and counters) lives on the stack, so with one thread
+ * and the result cache disabled the call never touches the heap.
+ *
+ * @param player_cards Cards of the active players. players_cards[0..1] = first player's cards,
+ * players_cards[2..3] = second player's cards, and so on.
+ * @param board_cards Community cards.
+ * @param discarded_cards Discarded cards.
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_board_cards Number of community cards.
+ * @param num_players Number of players.
+ * @param num_games Number of games to simulate.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param result Where the probabilities, their number of rows and the information of the simulation are stored.
+ * @return 0 for success, -1 if the number of players or community cards is out of range or there are not enough
+ * cards to deal the missing community cards.
+ */
+int simulate_spectator_into(char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players, int num_games,
+                            const sim_options_t *options, sim_result_t *result){
+    double *probabilities[MAX_PLAYERS];
 
+    result->num_rows = 0;
+    if(num_players < 2 || num_players > MAX_PLAYERS || !valid_board_size(num_board_cards)) return -1;
 
-    for(int it = 0; it < num_games;it++){
+    for(int i = 0; i < num_players; i++) probabilities[i] = result->probabilities[i];
 
-        /* We shuffle the deck */
 
-        shuffle(random_vec,num_unknown_cards);
+    /* We convert the cards strings into integers from 0 to 51 */
+    /* All the players' cards are known, only the community cards are random */
 
-        /* Dealing cards to the opponents */
+    game_setup_t setup;
+    build_spectator_setup(&setup, players_cards, board_cards, discarded_cards, num_discarded_cards, num_board_cards, num_players);
+    if(!setup_dealable(&setup)) return -1;
+    result->num_rows = num_players;
 
-        int given_cards = 0;
 
-        for(int i = 1; i < num_players;i++){
-            players_cards[i][0] = random_vec[given_cards++];
-            players_cards[i][1] = random_vec[given_cards++];
-        }
+    /* Heads-up preflop matchups are answered from the precomputed tables, if they are loaded */
+
+    int precomputed_games, precomputed_exact;
+    const preflop_entry_t *entry = find_preflop_entry(&setup, num_games, options, &precomputed_games, &precomputed_exact);
+    if(entry != NULL){
+        precomputed_probabilities(entry, precomputed_games, precomputed_exact, num_players, probabilities, &result->info);
+        return 0;
+    }
+
+
+    /* Spots already solved, up to a relabelling of the suits, are answered from the result cache, if it is enabled */
+
+    result_cache_key_t cache_key;
+    int use_cache = result_cache_enabled();
+    if(use_cache){
+        setup_cache_key(&setup, SIM_MODE_SPECTATOR, num_games, options, &cache_key);
+        if(result_cache_get(&cache_key, num_players, probabilities, &result->info)) return 0;
+    }
+
+
+    /* --- Game simulations --- */
 
+    game_counters_t counters;
 
-       /* We calculate the best hand (score) for each player and the winner. */
+    int stopped = compute_counters(&setup, SIM_MODE_SPECTATOR, num_games, options, &counters, &result->info);
 
-        unsigned short best_score_game = 0xFFFF;
-        unsigned short player_i_best_score[num_players];
-        for(int i = 0; i < num_players;i++) player_i_best_score[i] = 0xFFFF;
-        int winner = -1;
+    spectator_probabilities(&counters, num_players, probabilities);
+
+    if(use_cache && !stopped) result_cache_put(&cache_key, num_players, probabilities, &result->info);
+
+    return 0;
+}
+
+
+
+
+/**
+ * @brief Probabilities of a spectator's spot at every later street, in a single pass over its runouts. A preflop spot
+ * reports the flop, the turn and the river, a flop spot the turn and the river, and a turn spot the river. The rows
+ * of every street are those of simulate_spectator() with the hand of every player as it stands on that street (see
+ * sim_streets_result_t); the river rows are the equity of the spot.
+ *
+ * Every street comes from the same runouts, so the streets are consistent with each other. A flop or turn spot is
+ * solved exactly: the turns and rivers are enumerated, and the flop is scored once, each turn once for all of its
+ * rivers (grouped by the turn card) and each complete board once. Preflop, every flop is enumerated like that with
+ * SIM_METHOD_EXACT, or with SIM_METHOD_AUTO if all the runouts are at most num_games. Otherwise num_games random
+ * runouts are sampled with Monte Carlo and each one is scored at the flop, the turn and the river. Preflop, the
+ * flops or runouts are split across options->num_threads threads. The options used are listed at sim_options_t.
+ *
+ * @param players_cards Cards of the players, as in simulate_spectator().
+ * @param board_cards Community cards.
+ * @param discarded_cards Discarded cards.
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_board_cards Number of community cards: 0, 3 or 4.
+ * @param num_players Number of players.
+ * @param num_games Runouts (complete boards) to simulate with Monte Carlo.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param result Where the probabilities and the information of every street are stored.
+ * @return 0 for success, -1 if the number of players is out of range, num_board_cards is not 0, 3 or 4, there are not
+ * enough cards or memory can not be allocated.
+ */
+int simulate_spectator_streets(char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players, int num_games,
+                               const sim_options_t *options, sim_streets_result_t *result){
+    if(num_players < 2 || num_players > MAX_PLAYERS) return -1;
+    if(num_board_cards != 0 && num_board_cards != 3 && num_board_cards != 4) return -1;
+
+    game_setup_t setup;
+    build_spectator_setup(&setup, players_cards, board_cards, discarded_cards, num_discarded_cards, num_board_cards, num_players);
+    if(!setup_dealable(&setup)) return -1;
+    setup.variance_method = SIM_VR_NONE;
+
+    sim_options_t default_options;
+    if(options == NULL){
+        sim_default_options(&default_options);
+        options = &default_options;
+    }
+
+    /* Whether the runouts are enumerated or sampled */
+
+    int n = setup.num_unknown_cards;
+    double num_exact_runouts = 1.0;
+    for(int i = 0; i < 5 - num_board_cards; i++) num_exact_runouts = num_exact_runouts * (double) (n - i) / (double) (i + 1);
+
+    int exact = (num_board_cards > 0) || options->method == SIM_METHOD_EXACT ||
+                (options->method != SIM_METHOD_MONTE_CARLO && num_exact_runouts <= (double) num_games);
+
+    // A flop or turn spot has a single enumeration
+    int num_threads = (num_board_cards > 0) ? 1 : options->num_threads;
+
+    streets_thread_t *streets = (streets_thread_t *) run_threads(sizeof(streets_thread_t), &setup, exact, num_games, num_threads, options,
+                                                                 streets_thread, merge_streets);
+    if(streets == NULL) return -1;
+
+    /* Probabilities and information of every street after the spot */
+
+    int first_street = (num_board_cards == 0) ? 0 : num_board_cards - 2;
+
+    result->num_streets = SIM_MAX_STREETS - first_street;
+    result->num_rows = num_players;
+
+    for(int k = 0; k < result->num_streets; k++){
+        int s = first_street + k;
+        double *probabilities[MAX_PLAYERS];
+        sim_info_t *info = &result->info[k];
+
+        for(int i = 0; i < num_players; i++) probabilities[i] = result->probabilities[k][i];
+        spectator_probabilities(&streets->counters[s], num_players, probabilities);
+
+        result->num_board_cards[k] = 3 + s;
+        fill_info(info, exact ? SIM_METHOD_EXACT : SIM_METHOD_MONTE_CARLO, &setup, &streets->counters[s]);
+        info->num_games = streets->num_runouts;
+    }
+
+    free(streets);
+    return 0;
+}
+
+
+/**
+ * @brief Probabilities of a player's spot against 1, 2, ..., max_opponents opponents with random cards, in a single
+ * pass. Every game deals the largest table once and scores the opponents one after another: the result of the player
+ * against the first k opponents is the result of a game with k opponents, because the opponents' cards are
+ * exchangeable, so every k is counted from the same games. The games cost as much as those of the largest table
+ * alone, instead of those of all the tables.
+ *
+ * results[k - 1] is what simulate_player_into() returns with k + 1 players: the row of the player, the row of the
+ * opponents' hand types and the information with the standard errors of the player. The estimates of different k are
+ * correlated, since they come from the same games.
+ *
+ * The games are always simulated with Monte Carlo, split across options->num_threads threads. The options used are
+ * listed at sim_options_t.
+ *
+ * @param known_cards Cards that are known, as in simulate_player().
+ * @param num_known_cards The number of known cards.
+ * @param max_opponents Opponents of the largest table, in [1,MAX_PLAYERS-1].
+ * @param num_games The number of games to be simulated.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param results Where the results are stored, max_opponents of them.
+ * @return 0 for success, -1 if max_opponents or the number of known cards is out of range, there are not enough
+ * cards or memory can not be allocated.
+ */
+int simulate_player_sweep(char* known_cards[], int num_known_cards, int max_opponents, int num_games, const sim_options_t *options, sim_result_t results[]){
+    if(max_opponents < 1 || max_opponents > MAX_PLAYERS - 1) return -1;
+    if(num_known_cards < 2 || !valid_board_size(num_known_cards - 2)) return -1;
+
+    /* Only the user's cards are known, the opponents of the largest table receive random cards in every game */
+
+    game_setup_t setup;
+    setup.num_players = max_opponents + 1;
+    setup.num_known_players = 1;
+    setup.num_ranged_players = 0;
+    setup.variance_method = SIM_VR_NONE;
+    setup.players_cards[0][0] = cardtype_to_num(known_cards[0]);
+    setup.players_cards[0][1] = cardtype_to_num(known_cards[1]);
+    setup.num_board_cards = num_known_cards - 2;
+    for(int i = 2; i < num_known_cards; i++){
+        setup.board_cards[i - 2] = cardtype_to_num(known_cards[i]);
+    }
+
+    uint64_t known_mask = (1ULL << setup.players_cards[0][0]) | (1ULL << setup.players_cards[0][1]);
+    for(int i = 0; i < setup.num_board_cards; i++){
+        known_mask |= 1ULL << setup.board_cards[i];
+    }
+    build_unknown_cards(&setup, known_mask);
+
+    if(2 * max_opponents + 5 - setup.num_board_cards > setup.num_unknown_cards) return -1;
+
+    sim_options_t default_options;
+    if(options == NULL){
+        sim_default_options(&default_options);
+        options = &default_options;
+    }
+
+    /* Simulation, split across the threads */
+
+    sweep_thread_t *sweep = (sweep_thread_t *) run_threads(sizeof(sweep_thread_t), &setup, 0, num_games, options->num_threads, options,
+                                                           sweep_thread, merge_sweep);
+    if(sweep == NULL) return -1;
+
+    /* Result of every table: the counters of its first k opponents, with the wins and ties against them */
+
+    for(int k = 1; k <= max_opponents; k++){
+        sim_result_t *result = &results[k - 1];
+        double *probabilities[2] = { result->probabilities[0], result->probabilities[1] };
+
+        memset(result->probabilities, 0, 2 * sizeof(result->probabilities[0]));
+        result->num_rows = 2;
+
+        sweep->counters.num_of_wins[0] = sweep->sweep_wins[k];
+        sweep->counters.num_of_draws[0] = sweep->sweep_draws[k];
+        setup.num_players = k + 1;
+
+        player_probabilities(&sweep->counters, k + 1, probabilities);
+        fill_info(&result->info, SIM_METHOD_MONTE_CARLO, &setup, &sweep->counters);
+    }
+
+    free(sweep);
+    return 0;
+}
+
+
+/**
+ * @brief Probabilities of every hero holding on a board against num_players - 1 opponents with random cards, in a
+ * single run. Every sample deals the missing community cards and the opponents' cards once, scores the opponents once,
+ * and then scores against them every holding whose cards were not dealt. Conditioned on not being dealt two cards,
+ * the rest of the deal is uniform, so the games of every holding are distributed as those of simulate_player() with
+ * that holding, and each holding plays a fraction of the samples: about (n - 2 - d) * (n - 3 - d) / (n * (n - 1)),
+ * with n unknown cards and d dealt cards per sample. A holding of a player that already knows the board (or part of
+ * it) only costs a mask test and an eval_with_hole() per sample, instead of a whole simulation.
+ *
+ * The holdings of every starting hand class of preflop_class() are also averaged, each compatible holding that played
+ * at least one game with the same weight. A holding the samples always blocked has no estimate, so it is left out
+ * instead of counting as a row of zeros.
+ *
+ * The games are always simulated with Monte Carlo, split across options->num_threads threads. The options used are
+ * listed at sim_options_t.
+ *
+ * @param board_cards Community cards.
+ * @param num_board_cards Number of community cards: 0, 3, 4 or 5.
+ * @param discarded_cards Discarded cards, that neither the holdings nor the opponents can hold.
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_players Number of players, the hero included.
+ * @param num_games Samples of community cards and opponents' cards.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param result Where the probabilities of every holding and of every class are stored.
+ * @return 0 for success, -1 if the number of players or community cards is out of range, there are not enough
+ * cards or memory can not be allocated.
+ */
+int simulate_holdings(char* board_cards[], int num_board_cards, char* discarded_cards[], int num_discarded_cards, int num_players, int num_games,
+                      const sim_options_t *options, sim_holdings_result_t *result){
+    if(num_players < 2 || num_players > MAX_PLAYERS) return -1;
+    if(num_board_cards < 0 || num_board_cards > 5 || num_board_cards == 1 || num_board_cards == 2) return -1;
+
+    /* Setup of the opponents: players [0..num_players-2] with unknown cards */
+
+    game_setup_t setup;
+    setup.num_players = num_players - 1;
+    setup.num_known_players = 0;
+    setup.num_ranged_players = 0;
+    setup.num_board_cards = num_board_cards;
+    setup.variance_method = SIM_VR_NONE;
+
+    uint64_t known_mask = 0;
+    for(int i = 0; i < num_discarded_cards; i++){
+        known_mask |= 1ULL << cardtype_to_num(discarded_cards[i]);
+    }
+    for(int i = 0; i < num_board_cards; i++){
+        setup.board_cards[i] = cardtype_to_num(board_cards[i]);
+        known_mask |= 1ULL << setup.board_cards[i];
+    }
+    build_unknown_cards(&setup, known_mask);
+
+    // The hero needs two cards that the sample did not deal
+    if(2 * setup.num_players + 5 - num_board_cards + 2 > setup.num_unknown_cards) return -1;
+
+    sim_options_t default_options;
+    if(options == NULL){
+        sim_default_options(&default_options);
+        options = &default_options;
+    }
+
+    /* Holdings that do not use a known card */
+
+    holdings_t holdings;
+    holdings.setup = &setup;
+    holdings.num_holdings = 0;
+
+    for(int c2 = 1; c2 < TOTAL_CARDS; c2++){
+        for(int c1 = 0; c1 < c2; c1++){
+            int index = holding_index(c1, c2);
+            result->cards[index][0] = c1;
+            result->cards[index][1] = c2;
+
+            uint64_t mask = (1ULL << c1) | (1ULL << c2);
+            if(mask & known_mask) continue;
+
+            int h = holdings.num_holdings++;
+            holdings.index[h] = index;
+            holdings.cards[h][0] = deck[c1];
+            holdings.cards[h][1] = deck[c2];
+            holdings.masks[h] = mask;
+        }
+    }
+
+    /* Simulation, split across the threads */
+
+    holdings_thread_t *threads_data = (holdings_thread_t *) run_threads(sizeof(holdings_thread_t), &holdings, 0, num_games, options->num_threads, options,
+                                                                        holdings_thread, merge_holdings);
+    if(threads_data == NULL) return -1;
+    const holding_counters_t *counters = threads_data->counters;
+
+    /* Probabilities of every holding and of every class */
+
+    result->num_holdings = holdings.num_holdings;
+    result->num_samples = num_games;
+    memset(result->num_games, 0, sizeof(result->num_games));
+    memset(result->probabilities, 0, sizeof(result->probabilities));
+    memset(result->win_std_error, 0, sizeof(result->win_std_error));
+    memset(result->class_num_holdings, 0, sizeof(result->class_num_holdings));
+    memset(result->class_probabilities, 0, sizeof(result->class_probabilities));
+
+    for(int h = 0; h < holdings.num_holdings; h++){
+        int index = holdings.index[h];
+        int games = counters[h].num_of_games;
+        double *probabilities = result->probabilities[index];
+
+        result->num_games[index] = games;
+        if(games > 0){
+            probabilities[0] = (double) counters[h].num_of_wins / games * 100;
+            probabilities[2] = (double) counters[h].num_of_draws / games * 100;
+            probabilities[1] = 100 - probabilities[0] - probabilities[2];
+            for(int j = 0; j < NUM_OF_HAND_TYPES; j++){
+                probabilities[3 + j] = (double) counters[h].num_of_hand_types[j] / games * 100;
+            }
+            double p = probabilities[0] / 100;
+            result->win_std_error[index] = 100 * sqrt(p * (1 - p) / games);
+        }
+        if(games == 0) continue;
+
+        int c = preflop_class(result->cards[index][0], result->cards[index][1]);
+        result->class_num_holdings[c]++;
+        for(int j = 0; j < 3 + NUM_OF_HAND_TYPES; j++){
+            result->class_probabilities[c][j] += probabilities[j];
+        }
+    }
+
+    for(int c = 0; c < SIM_NUM_HOLDING_CLASSES; c++){
+        if(result->class_num_holdings[c] == 0) continue;
+        for(int j = 0; j < 3 + NUM_OF_HAND_TYPES; j++){
+            result->class_probabilities[c][j] /= result->class_num_holdings[c];
+        }
+    }
+
+    free(threads_data);
+    return 0;
+}
+
+
+/**
+ * @brief Index of a holding in sim_holdings_result_t: the holdings are sorted by their higher card and then by their
+ * lower card, so {0,1} is 0, {0,2} is 1, {1,2} is 2 and {50,51} is 1325.
+ *
+ * @param card1 A card of the holding, in [0,51].
+ * @param card2 The other card, in [0,51] and different from card1.
+ * @return Index of the holding, in [0,SIM_NUM_HOLDINGS-1].
+ */
+int holding_index(int card1, int card2){
+    int low = (card1 < card2) ? card1 : card2;
+    int high = (card1 < card2) ? card2 : card1;
+    return high * (high - 1) / 2 + low;
+}
+
+
+/**
+ * @brief Version of simulate_player_ex() for Omaha: every player has 4 hole cards, and a hand is made of exactly 2 of
+ * them and 3 community cards. The hands are scored with omaha_eval_with_hole(), which prepares the 10 triples of the
+ * board once per game.
+ *
+ * The games are simulated with Monte Carlo, split across options->num_threads threads. The options used are listed
+ * at sim_options_t.
+ *
+ * @param known_cards Cards that are known: known_cards[0..3] = player's cards, known_cards[4..n] = community cards.
+ * @param num_known_cards The number of known cards, 4 plus the number of community cards.
+ * @param num_players The number of players, in [2,OMAHA_MAX_PLAYERS].
+ * @param num_games The number of games to be simulated.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param info Where the method used, the number of games and the standard errors are stored. It can be NULL.
+ * @return The same matrix returned by simulate_player(), or NULL if num_players or the number of known cards is out of
+ * range, there are not enough cards or memory can not be allocated.
+ */
+double** simulate_player_omaha(char* known_cards[], int num_known_cards, int num_players, int num_games, const sim_options_t *options, sim_info_t *info){
+    if(num_players < 2 || num_players > OMAHA_MAX_PLAYERS) return NULL;
+    if(num_known_cards < OMAHA_HOLE_CARDS || !valid_board_size(num_known_cards - OMAHA_HOLE_CARDS)) return NULL;
+
+    /* Only the user's cards are known, the opponents receive random cards in every game */
+
+    omaha_setup_t setup;
+    setup.game.num_players = num_players;
+    setup.game.num_known_players = 1;
+    setup.game.num_ranged_players = 0;
+    setup.game.variance_method = SIM_VR_NONE;
+    setup.game.num_board_cards = num_known_cards - OMAHA_HOLE_CARDS;
+
+    uint64_t known_mask = 0;
+    for(int i = 0; i < num_known_cards; i++){
+        int card = cardtype_to_num(known_cards[i]);
+        if(i < OMAHA_HOLE_CARDS) setup.players_cards[0][i] = card;
+        else setup.game.board_cards[i - OMAHA_HOLE_CARDS] = card;
+        known_mask |= 1ULL << card;
+    }
+    build_unknown_cards(&setup.game, known_mask);
+
+    game_counters_t counters;
+    sim_info_t local_info;
+    if(run_omaha(&setup, num_games, options, &counters, (info != NULL) ? info : &local_info) == -1) return NULL;
+
+    double** probabilities = (double**) malloc(2 * sizeof(double*));
+    probabilities[0] = (double*) malloc((3 + NUM_OF_HAND_TYPES) * sizeof(double));
+    probabilities[1] = (double*) malloc((3 + NUM_OF_HAND_TYPES) * sizeof(double));
+
+    player_probabilities(&counters, num_players, probabilities);
+
+    return probabilities;
+}
+
+
+/**
+ * @brief Version of simulate_spectator_ex() for Omaha: every player has 4 hole cards, and a hand is made of exactly 2
+ * of them and 3 community cards, see simulate_player_omaha().
+ *
+ * By default (SIM_METHOD_AUTO) the boards are enumerated exactly, instead of simulated, when the number of possible
+ * boards is not greater than num_games, e.g. on the flop (about a thousand boards heads-up) or on the turn.
+ *
+ * @param players_cards Cards of the players, players_cards[4 * i .. 4 * i + 3] = cards of player i.
+ * @param board_cards Community cards.
+ * @param discarded_cards Discarded cards.
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_board_cards Number of community cards.
+ * @param num_players Number of players, in [2,OMAHA_MAX_PLAYERS].
+ * @param num_games The number of games to be simulated.
+ * @param options Options of the simulation, see sim_default_options(). NULL for the default options.
+ * @param info Where the method used, the number of games and the standard errors are stored. It can be NULL.
+ * @return The same matrix returned by simulate_spectator(), or NULL if num_players or num_board_cards is out of range,
+ * there are not enough cards or memory can not be allocated.
+ */
+double** simulate_spectator_omaha(char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players, int num_games,
+                                  const sim_options_t *options, sim_info_t *info){
+    if(num_players < 2 || num_players > OMAHA_MAX_PLAYERS || !valid_board_size(num_board_cards)) return NULL;
+
+    /* The cards of all the players are known */
+
+    omaha_setup_t setup;
+    setup.game.num_players = num_players;
+    setup.game.num_known_players = num_players;
+    setup.game.num_ranged_players = 0;
+    setup.game.variance_method = SIM_VR_NONE;
+    setup.game.num_board_cards = num_board_cards;
+
+    uint64_t known_mask = 0;
+    for(int i = 0; i < num_discarded_cards; i++){
+        known_mask |= 1ULL << cardtype_to_num(discarded_cards[i]);
+    }
+    for(int i = 0; i < num_players; i++){
+        for(int j = 0; j < OMAHA_HOLE_CARDS; j++){
+            setup.players_cards[i][j] = cardtype_to_num(players_cards[i * OMAHA_HOLE_CARDS + j]);
+            known_mask |= 1ULL << setup.players_cards[i][j];
+        }
+    }
+    for(int i = 0; i < num_board_cards; i++){
+        setup.game.board_cards[i] = cardtype_to_num(board_cards[i]);
+        known_mask |= 1ULL << setup.game.board_cards[i];
+    }
+    build_unknown_cards(&setup.game, known_mask);
+
+    game_counters_t counters;
+    sim_info_t local_info;
+    if(run_omaha(&setup, num_games, options, &counters, (info != NULL) ? info : &local_info) == -1) return NULL;
+
+    double** probabilities = (double**) malloc(num_players * sizeof(double*));
+    for(int i = 0; i < num_players; i++){
+        probabilities[i] = (double*) malloc((3 + NUM_OF_HAND_TYPES) * sizeof(double));
+    }
+
+    spectator_probabilities(&counters, num_players, probabilities);
+
+    return probabilities;
+}
+
+
+/**
+ * @brief Counters of an Omaha spot. The boards are enumerated when every player's cards are known and either
+ * SIM_METHOD_EXACT is requested or, with SIM_METHOD_AUTO, there are at most num_games of them; otherwise num_games
+ * games are simulated. Either way the work is split across options->num_threads threads.
+ *
+ * @param setup Setup of the spot.
+ * @param num_games Number of games to simulate.
+ * @param options Options of the simulation, NULL for the default options.
+ * @param counters Where the counters of all the games are stored.
+ * @param info Where the method used, the number of games and the standard errors are stored.
+ * @return 0 for success, -1 if there are not enough cards or memory can not be allocated.
+ */
+int run_omaha(const omaha_setup_t *setup, int num_games, const sim_options_t *options, game_counters_t *counters, sim_info_t *info){
+    const game_setup_t *game = &setup->game;
+    int num_missing = 5 - game->num_board_cards;
+
+    if(num_missing < 0 || OMAHA_HOLE_CARDS * (game->num_players - game->num_known_players) + num_missing > game->num_unknown_cards) return -1;
+
+    sim_options_t default_options;
+    if(options == NULL){
+        sim_default_options(&default_options);
+        options = &default_options;
+    }
+
+    /* Whether the boards are enumerated or sampled */
+
+    double num_boards = 1.0;
+    for(int i = 0; i < num_missing; i++) num_boards = num_boards * (double) (game->num_unknown_cards - i) / (double) (i + 1);
+
+    int exact = (game->num_known_players == game->num_players) && (options->method == SIM_METHOD_EXACT ||
+                (options->method == SIM_METHOD_AUTO && num_boards <= (double) num_games));
+
+    omaha_thread_t *omaha = (omaha_thread_t *) run_threads(sizeof(omaha_thread_t), setup, exact, num_games, options->num_threads, options,
+                                                           omaha_thread, merge_omaha);
+    if(omaha == NULL) return -1;
+
+    *counters = omaha->counters;
+    fill_info(info, exact ? SIM_METHOD_EXACT : SIM_METHOD_MONTE_CARLO, game, counters);
+
+    free(omaha);
+    return 0;
+}
+
+
+/**
+ * @brief Probabilities from a player's perspective, see simulate_player(). The opponents' hand types are
+ * accumulated into a single distribution.
+ *
+ * @param counters Counters of the games, the player is the player 0.
+ * @param num_players Number of players.
+ * @param probabilities Rows of the player ([0]) and of the opponents ([1]), with 3 + NUM_OF_HAND_TYPES columns.
+ */
+void player_probabilities(const game_counters_t *counters, int num_players, double *probabilities[2]){
+    // With the exact method, the games are all the possible ones
+    int num_games = counters->num_of_games;
+
+    int num_of_hand_types_opponents[NUM_OF_HAND_TYPES];
+
+    for(int i = 0; i < NUM_OF_HAND_TYPES;i++){
+        num_of_hand_types_opponents[i] = 0;
+        for(int j = 1; j < num_players; j++){
+            num_of_hand_types_opponents[i] += counters->num_of_hand_types[j][i];
+        }
+    }
+
+    // probabilities[0][0] = % victory
+    // probabilities[0][1] = % defeat
+    // probabilities[0][2] = % tie
+
+    probabilities[0][0] = ((double) counters->num_of_wins[0] / (double) num_games) * 100.0;
+    probabilities[0][1] = ((double) (num_games - counters->num_of_wins[0] - counters->num_of_draws[0]) / (double) num_games) * 100.0;
+    probabilities[0][2] = ((double) counters->num_of_draws[0] / (double) num_games) * 100.0;
+
+    for(int i = 0; i < NUM_OF_HAND_TYPES;i++){
+        probabilities[0][i + 3] = ((double) counters->num_of_hand_types[0][i] / (double) num_games) * 100.0;
+        probabilities[1][i + 3] = (((double) num_of_hand_types_opponents[i] / (double) (num_players - 1)) / (double) num_games) * 100.0;
+    }
+}
+
+
+/**
+ * @brief Probabilities from a spectator's perspective, see simulate_spectator().
+ *
+ * @param counters Counters of the games.
+ * @param num_players Number of players.
+ * @param probabilities Row of each player, with 3 + NUM_OF_HAND_TYPES columns.
+ */
+void spectator_probabilities(const game_counters_t *counters, int num_players, double *probabilities[]){
+    // With the exact method, the games are all the possible ones
+    int num_games = counters->num_of_games;
+
+    for(int i = 0; i < num_players;i++){
+        probabilities[i][0] = ((double) counters->num_of_wins[i] / (double) num_games) * 100.0;
+        probabilities[i][1] = ((double) (num_games - counters->num_of_wins[i] - counters->num_of_draws[i]) / (double) num_games) * 100.0;
+        probabilities[i][2] = ((double) counters->num_of_draws[i] / (double) num_games) * 100.0;
+        for(int j = 0; j < NUM_OF_HAND_TYPES;j++){
+            probabilities[i][j + 3] = ((double) counters->num_of_hand_types[i][j] / (double) num_games) * 100.0;
+        }
+    }
+}
+
+
+/**
+ * @brief Solving of a batch of scenarios. Cards are given already parsed and the results are written into the
+ * caller's array, so no strings are parsed and nothing is allocated per scenario. The scenarios are distributed
+ * across options->num_threads threads, each one solving a whole scenario at a time with one thread, which is what
+ * pays off for many small scenarios.
+ *
+ * The method, target standard error and generator of every scenario are those of options. Scenario i is seeded
+ * from options->seed and i, so with a fixed seed the results do not depend on the number of threads nor on the
+ * order in which the scenarios are solved.
+ *
+ * A scenario with a number of players outside [2, MAX_PLAYERS], an invalid number of community cards or a deck too
+ * small to deal its games gets a result with num_rows 0.
+ *
+ * @param scenarios Scenarios to solve.
+ * @param results Where the result of each scenario is stored, results[i] for scenarios[i].
+ * @param num_scenarios Number of scenarios.
+ * @param options Options of the batch, see sim_default_options(). NULL for the default options.
+ */
+void simulate_batch(const sim_scenario_t scenarios[], sim_result_t results[], int num_scenarios, const sim_options_t *options){
+    batch_t batch;
+
+    batch.scenarios = scenarios;
+    batch.results = results;
+    batch.num_scenarios = num_scenarios;
+    if(options != NULL) batch.options = *options;
+    else sim_default_options(&batch.options);
+    batch.fixed_seed = (batch.options.seed != SIM_SEED_FROM_CLOCK);
+    batch.options.seed = resolve_seed(batch.options.seed);
+    batch.options.progress = NULL;  // Scenarios are solved concurrently, there is no single simulation in progress
+    atomic_init(&batch.next_scenario, 0);
+
+    int num_threads = batch.options.num_threads;
+    if(num_threads > num_scenarios) num_threads = num_scenarios;
+    if(num_threads < 1) num_threads = 1;
+
+    pthread_t threads[num_threads];
+    char started[num_threads];
+
+    // The calling thread is one of the workers
+    started[0] = 0;
+    for(int i = 1; i < num_threads; i++){
+        started[i] = (pthread_create(&threads[i], NULL, batch_thread, &batch) == 0);
+    }
+
+    batch_thread(&batch);
+
+    for(int i = 1; i < num_threads; i++){
+        if(started[i]) pthread_join(threads[i], NULL);
+    }
+}
+
+
+/**
+ * @brief Body of a thread of a batch: it solves scenarios until none is left.
+ *
+ * @param arg Pointer to the batch_t of the batch.
+ * @return NULL.
+ */
+void *batch_thread(void *arg){
+    batch_t *batch = (batch_t *) arg;
+    int i;
+
+    while((i = atomic_fetch_add(&batch->next_scenario, 1)) < batch->num_scenarios){
+        solve_scenario(&batch->scenarios[i], &batch->results[i], &batch->options, batch->fixed_seed, i);
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Solving of a scenario of a batch in the calling thread. Invalid scenarios get a result with num_rows 0.
+ *
+ * @param scenario Scenario to solve.
+ * @param result Where the result is stored.
+ * @param batch_options Options of the batch, with the seed already resolved.
+ * @param fixed_seed Whether the seed of the batch was given by the caller. Otherwise the result cache takes any
+ * result of the scenario, whatever its seed.
+ * @param index Position of the scenario in the batch, it selects its seed.
+ */
+void solve_scenario(const sim_scenario_t *scenario, sim_result_t *result, const sim_options_t *batch_options, int fixed_seed, int index){
+    game_setup_t setup;
+    uint64_t known_mask = scenario->discarded_cards;
+
+    // Invalid scenarios get a result without rows
+    memset(result, 0, sizeof(sim_result_t));
+    if(scenario->num_players < 2 || scenario->num_players > MAX_PLAYERS || !valid_board_size(scenario->num_board_cards)) return;
+
+    setup.num_players = scenario->num_players;
+    setup.num_known_players = (scenario->mode == SIM_MODE_PLAYER) ? 1 : scenario->num_players;
+    setup.num_ranged_players = 0;
+    for(int i = 0; i < setup.num_known_players; i++){
+        setup.players_cards[i][0] = scenario->players_cards[i][0];
+        setup.players_cards[i][1] = scenario->players_cards[i][1];
+        known_mask |= (1ULL << setup.players_cards[i][0]) | (1ULL << setup.players_cards[i][1]);
+    }
+    setup.num_board_cards = scenario->num_board_cards;
+    for(int i = 0; i < setup.num_board_cards; i++){
+        setup.board_cards[i] = scenario->board_cards[i];
+        known_mask |= 1ULL << setup.board_cards[i];
+    }
+    build_unknown_cards(&setup, known_mask);
+    if(!setup_dealable(&setup)) return;
+
+    sim_options_t options = *batch_options;
+    options.num_threads = 1;
+    options.seed = batch_options->seed + (uint64_t) (index + 1) * GOLDEN_GAMMA;
+    if(options.seed == SIM_SEED_FROM_CLOCK) options.seed = GOLDEN_GAMMA;
+
+    double *rows[MAX_PLAYERS];
+    for(int i = 0; i < scenario->num_players; i++) rows[i] = result->probabilities[i];
+
+    int num_rows = (scenario->mode == SIM_MODE_PLAYER) ? 2 : scenario->num_players;
+    result->num_rows = num_rows;
+    int precomputed_games, precomputed_exact;
+    const preflop_entry_t *entry = find_preflop_entry(&setup, scenario->num_games, &options, &precomputed_games, &precomputed_exact);
+    if(entry != NULL){
+        precomputed_probabilities(entry, precomputed_games, precomputed_exact, num_rows, rows, &result->info);
+        return;
+    }
+
+    result_cache_key_t cache_key;
+    int use_cache = result_cache_enabled();
+    if(use_cache){
+        sim_options_t key_options = options;
+        if(!fixed_seed) key_options.seed = SIM_SEED_FROM_CLOCK;
+        setup_cache_key(&setup, scenario->mode, scenario->num_games, &key_options, &cache_key);
+        if(result_cache_get(&cache_key, num_rows, rows, &result->info)) return;
+    }
+
+    game_counters_t counters;
+
+    compute_counters(&setup, scenario->mode, scenario->num_games, &options, &counters, &result->info);
+
+    if(scenario->mode == SIM_MODE_PLAYER) player_probabilities(&counters, scenario->num_players, rows);
+    else spectator_probabilities(&counters, scenario->num_players, rows);
+
+    if(use_cache) result_cache_put(&cache_key, num_rows, rows, &result->info);
+}
+
+
+/**
+ * @brief Obtaining the counters of a setup, either by simulating num_games games or by enumerating all the possible
+ * games exactly. With SIM_METHOD_AUTO the exact enumeration is chosen when it is cheaper: an enumerated game costs
+ * the evaluation of the players' hands, while a simulated game also deals its cards, so enumeration wins whenever
+ * there are not more possible games than games to simulate.
+ *
+ * @param setup Setup of the games.
+ * @param mode Perspective of the setup, it selects the rows given to the progress callback.
+ * @param num_games Number of games to simulate with the Monte Carlo method.
+ * @param options Options of the simulation. NULL for the default options.
+ * @param counters Counters where the results of all the games are stored.
+ * @param info Where the method used and the number of games are stored. It can be NULL.
+ * @return 1 if the progress callback stopped the simulation, 0 otherwise.
+ */
+int compute_counters(const game_setup_t *setup, sim_mode_t mode, int num_games, const sim_options_t *options, game_counters_t *counters, sim_info_t *info){
+    sim_method_t method = (options != NULL) ? options->method : SIM_METHOD_AUTO;
+    if(method == SIM_METHOD_PRECOMPUTED) method = SIM_METHOD_AUTO;  // The tables were already searched
+    int stopped = 0;
+    double num_exact_games = count_exact_games(setup);
+    game_setup_t vr_setup;
+
+    // The counters of the exact method must not overflow, and it does not enumerate ranges
+    if(num_exact_games > (double) INT_MAX || setup->num_ranged_players > 0){
+        method = SIM_METHOD_MONTE_CARLO;
+    } else if(method == SIM_METHOD_AUTO){
+        method = (num_exact_games <= (double) num_games) ? SIM_METHOD_EXACT : SIM_METHOD_MONTE_CARLO;
+    }
+
+    if(method == SIM_METHOD_EXACT){
+        enumeration_t enumeration;
+        enumeration.setup = setup;
+        enumeration.used = 0;
+        enumeration.counters = counters;
+        for(int i = 0; i < setup->num_known_players; i++){
+            enumeration.players_cards[i][0] = deck[setup->players_cards[i][0]];
+            enumeration.players_cards[i][1] = deck[setup->players_cards[i][1]];
+        }
+        for(int i = 0; i < setup->num_board_cards; i++){
+            enumeration.board[i] = deck[setup->board_cards[i]];
+        }
+
+        memset(counters, 0, sizeof(game_counters_t));
+        SIM_TIMER_START(enumerate_timer);
+        enumerate_board(&enumeration, setup->num_board_cards, 0);
+        SIM_TIMER_STOP(enumerate_timer, enumerate_cycles);
+        SIM_ADD(games, counters->num_of_games);
+        SIM_FLUSH_STATS();
+    } else {
+        sim_options_t default_options;
+        if(options == NULL){
+            sim_default_options(&default_options);
+            options = &default_options;
+        }
+
+        int num_threads = (options->num_threads < 1) ? 1 : options->num_threads;
+        rng_t rngs[num_threads];
+
+        seed_generators(options, rngs, num_threads);
+
+        vr_setup = *setup;
+        prepare_variance_reduction(&vr_setup, options->variance_reduction, &rngs[0]);
+        setup = &vr_setup;
+
+        memset(counters, 0, sizeof(game_counters_t));
+
+        if(options->target_std_error > 0.0 || options->progress != NULL){
+            stopped = run_adaptive_simulation(setup, mode, num_games, options, num_threads, rngs, counters);
+        } else {
+            run_simulation(setup, num_games, num_threads, rngs, counters);
+        }
+    }
+
+    if(info != NULL){
+        fill_info(info, method, setup, counters);
+    }
+
+    // The stratified estimates replace the counters once their variances are known
+    if(method == SIM_METHOD_MONTE_CARLO) apply_stratification(setup, counters);
+
+    return stopped;
+}
+
+
+/**
+ * @brief Search of a setup in the precomputed preflop tables (see load_preflop_tables()). They answer the games
+ * with no community cards and either a single known player against random opponents, or two known players and
+ * no discarded cards. They are used with SIM_METHOD_PRECOMPUTED, and with SIM_METHOD_AUTO simulated entries are
+ * only used if they were simulated with at least the requested number of games.
+ *
+ * @param setup Setup of the games.
+ * @param requested_games Number of games requested to simulate.
+ * @param options Options of the simulation. NULL for the default options.
+ * @param num_games Where the number of games behind the entry is stored.
+ * @param exact Where 1 is stored if the entry was enumerated exactly, 0 if it was simulated.
+ * @return Entry of the setup, NULL if the setup is not in the loaded tables.
+ */
+const preflop_entry_t *find_preflop_entry(const game_setup_t *setup, int requested_games, const sim_options_t *options, int *num_games, int *exact){
+    sim_method_t method = (options != NULL) ? options->method : SIM_METHOD_AUTO;
+    if((method != SIM_METHOD_AUTO && method != SIM_METHOD_PRECOMPUTED) || setup->num_board_cards != 0 || setup->num_ranged_players > 0 ||
+       setup->num_unknown_cards != TOTAL_CARDS - 2 * setup->num_known_players){
+        return NULL;
+    }
+
+    const int (*cards)[2] = setup->players_cards;
+
+    if(setup->num_known_players == 1){
+        const preflop_entry_t *entry = preflop_class_entry(cards[0][0], cards[0][1], setup->num_players - 1, num_games);
+        *exact = 0;
+        return (entry != NULL && (*num_games >= requested_games || method == SIM_METHOD_PRECOMPUTED)) ? entry : NULL;
+    }
+
+    if(setup->num_known_players == 2 && setup->num_players == 2){
+        *exact = 1;
+        *num_games = (int) count_exact_games(setup);
+        return preflop_matchup_entry(cards[0][0], cards[0][1], cards[1][0], cards[1][1]);
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Probabilities and information of a setup found in the precomputed preflop tables.
+ *
+ * @param entry Entry of the setup.
+ * @param num_games Number of games behind the entry.
+ * @param exact 1 if the entry was enumerated exactly, 0 if it was simulated.
+ * @param num_rows Rows of probabilities to fill, at most 2.
+ * @param probabilities Rows of probabilities, with 3 + NUM_OF_HAND_TYPES columns.
+ * @param info Where the method used, the number of games and the standard errors are stored. It can be NULL.
+ */
+void precomputed_probabilities(const preflop_entry_t *entry, int num_games, int exact, int num_rows, double *probabilities[], sim_info_t *info){
+    for(int i = 0; i < num_rows; i++){
+        for(int j = 0; j < 3 + NUM_OF_HAND_TYPES; j++){
+            probabilities[i][j] = entry->probabilities[i][j];
+        }
+    }
+
+    if(info == NULL) return;
+
+    info->method = SIM_METHOD_PRECOMPUTED;
+    info->num_games = num_games;
+    info->variance_method = SIM_VR_NONE;
+    info->variance_reduction = 1.0;
+    for(int i = 0; i < MAX_PLAYERS; i++){
+        info->win_std_error[i] = 0.0;
+        info->tie_std_error[i] = 0.0;
+    }
+
+    // Only the first row of a simulated entry belongs to a player with known cards
+    if(!exact && num_games > 0){
+        double p_win = entry->probabilities[0][0] / 100.0, p_tie = entry->probabilities[0][2] / 100.0;
+        info->win_std_error[0] = sqrt(p_win * (1.0 - p_win) / num_games) * 100.0;
+        info->tie_std_error[0] = sqrt(p_tie * (1.0 - p_tie) / num_games) * 100.0;
+    }
+}
+
+
+/**
+ * @brief Canonical key of a setup for the result cache (see canonical_spot_key()). The discarded cards are the ones
+ * that are neither known nor in the deck of unknown cards.
+ *
+ * @param setup Setup of the games.
+ * @param mode Perspective of the setup.
+ * @param num_games Number of games requested.
+ * @param options Options of the simulation. NULL for the default options.
+ * @param key Where the key is stored.
+ */
+void setup_cache_key(const game_setup_t *setup, sim_mode_t mode, int num_games, const sim_options_t *options, result_cache_key_t *key){
+    uint64_t discarded_cards = (1ULL << TOTAL_CARDS) - 1;
+
+    for(int i = 0; i < setup->num_unknown_cards; i++) discarded_cards &= ~(1ULL << setup->unknown_cards[i]);
+    for(int i = 0; i < setup->num_board_cards; i++) discarded_cards &= ~(1ULL << setup->board_cards[i]);
+    for(int i = 0; i < setup->num_known_players; i++){
+        discarded_cards &= ~((1ULL << setup->players_cards[i][0]) | (1ULL << setup->players_cards[i][1]));
+    }
+
+    canonical_spot_key(key, mode, setup->num_players, setup->num_known_players, setup->players_cards,
+                       setup->board_cards, setup->num_board_cards, discarded_cards, num_games, options);
+}
+
+
+/**
+ * @brief Filling of the information about how the counters were obtained. The standard errors of the win and tie
+ * probabilities are the square roots of the variances of their estimators (see estimator_variance()), in percentage
+ * points: those of a proportion, sqrt(p * (1 - p) / n), without variance reduction. They are 0 with the exact method.
+ * The variance reduction compares with plain Monte Carlo of the same cost, so the preparation of the technique
+ * (setup->preparation_games) counts against it.
+ *
+ * @param info Information to fill.
+ * @param method Method used.
+ * @param setup Setup of the games.
+ * @param counters Counters of the games, before apply_stratification().
+ */
+void fill_info(sim_info_t *info, sim_method_t method, const game_setup_t *setup, const game_counters_t *counters){
+    info->method = method;
+    info->num_games = counters->num_of_games;
+    info->variance_method = (method == SIM_METHOD_MONTE_CARLO) ? setup->variance_method : SIM_VR_NONE;
+    info->variance_reduction = 1.0;
+
+    for(int i = 0; i < MAX_PLAYERS; i++){
+        info->win_std_error[i] = 0.0;
+        info->tie_std_error[i] = 0.0;
+        if(method == SIM_METHOD_MONTE_CARLO && i < setup->num_players && counters->num_of_games > 0){
+            info->win_std_error[i] = sqrt(estimator_variance(setup, counters, i, 0)) * 100.0;
+            info->tie_std_error[i] = sqrt(estimator_variance(setup, counters, i, 1)) * 100.0;
+        }
+    }
+
+    if(info->variance_method != SIM_VR_NONE && counters->num_of_games > 0){
+        double n = (double) counters->num_of_games;
+        double p_win = counters->num_of_wins[0] / n;
+        double variance = estimator_variance(setup, counters, 0, 0);
+        // The games of plain Monte Carlo with the same cost as these games and the preparation of the technique
+        double cost = n / (n + setup->preparation_games);
+        if(variance > 0.0) info->variance_reduction = p_win * (1.0 - p_win) / n / variance * cost;
+        else if(p_win > 0.0 && p_win < 1.0) info->variance_reduction = INFINITY;   // Every stratum was fully determined
+    }
+}
+
+
+/**
+ * @brief Adaptive simulation: games are simulated in chunks until the standard errors of the win and tie probabilities
+ * of every player with known cards are not greater than options->target_std_error, until max_games games, or until
+ * the progress callback asks to stop.
+ *
+ * After each chunk, the games still needed are predicted from the current probabilities. The next chunk simulates
+ * them, but never more than the games already simulated, so a noisy early estimate can at most double the work.
+ * With a progress callback, chunks also end every options->progress_games games and every options->progress_ms
+ * milliseconds (the games of a chunk are predicted from the games per millisecond so far), and the callback is called
+ * after every chunk. The first estimate is reported after ADAPTIVE_MIN_CHUNK games at most, unless only
+ * progress_games is set.
+ *
+ * @param setup Setup of the games.
+ * @param mode Perspective of the setup, it selects the rows given to the progress callback.
+ * @param max_games Maximum number of games to simulate.
+ * @param options Options of the simulation: target standard error (in percentage points) and progress callback.
+ * @param num_threads Number of threads.
+ * @param rngs Random number generator of each thread, they keep their state between chunks.
+ * @param counters Counters where the results of all the games are added.
+ * @return 1 if the progress callback stopped the simulation, 0 otherwise.
+ */
+int run_adaptive_simulation(const game_setup_t *setup, sim_mode_t mode, int max_games, const sim_options_t *options, int num_threads, rng_t rngs[], game_counters_t *counters){
+    int report = (options->progress != NULL);
+    int interval_games = report ? options->progress_games : 0;
+    double interval_ms = report ? options->progress_ms : 0.0;
+    if(report && interval_games <= 0 && interval_ms <= 0.0) interval_ms = PROGRESS_DEFAULT_MS;
+
+    int chunk = ADAPTIVE_MIN_CHUNK;
+    if(interval_games > 0 && (interval_ms <= 0.0 || interval_games < chunk)) chunk = interval_games;
+    if(chunk > max_games) chunk = max_games;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    while(chunk > 0){
+        run_simulation(setup, chunk, num_threads, rngs, counters);
+
+        int played = counters->num_of_games;
+        if(report && report_progress(setup, mode, counters, options)) return 1;
+
+        double next_chunk = (double) (max_games - played);
+
+        if(options->target_std_error > 0.0){
+            double needed = games_for_std_error(setup, counters, options->target_std_error);
+            if(needed <= (double) played) break;
+
+            double adaptive_chunk = needed - (double) played;
+            if(adaptive_chunk > (double) played) adaptive_chunk = (double) played;
+            if(adaptive_chunk < ADAPTIVE_MIN_CHUNK) adaptive_chunk = ADAPTIVE_MIN_CHUNK;
+            if(adaptive_chunk < next_chunk) next_chunk = adaptive_chunk;
+        }
+
+        if(interval_games > 0 && (double) interval_games < next_chunk) next_chunk = (double) interval_games;
+
+        if(interval_ms > 0.0){
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            double elapsed_ms = (double) (now.tv_sec - start.tv_sec) * 1e3 + (double) (now.tv_nsec - start.tv_nsec) / 1e6;
+            double timed_chunk = (elapsed_ms > 0.0) ? (double) played / elapsed_ms * interval_ms : next_chunk;
+            if(timed_chunk < LOCKSTEP_GAMES) timed_chunk = LOCKSTEP_GAMES;
+            if(timed_chunk < next_chunk) next_chunk = timed_chunk;
+        }
+
+        chunk = (int) next_chunk;
+    }
+
+    return 0;
+}
+
+
+/**
+ * @brief Call to the progress callback of the options with the probabilities of the games simulated so far.
+ *
+ * @param setup Setup of the games.
+ * @param mode Perspective of the setup: the rows of simulate_player() or those of simulate_spectator().
+ * @param counters Counters of the games simulated so far.
+ * @param options Options of the simulation, with the progress callback.
+ * @return 1 if the callback asks to stop the simulation, 0 otherwise.
+ */
+int report_progress(const game_setup_t *setup, sim_mode_t mode, const game_counters_t *counters, const sim_options_t *options){
+    double rows[MAX_PLAYERS][3 + NUM_OF_HAND_TYPES];
+    double *probabilities[MAX_PLAYERS];
+    int num_rows = (mode == SIM_MODE_PLAYER) ? 2 : setup->num_players;
+
+    memset(rows, 0, sizeof(rows));
+    for(int i = 0; i < num_rows; i++) probabilities[i] = rows[i];
+
+    sim_info_t info;
+    fill_info(&info, SIM_METHOD_MONTE_CARLO, setup, counters);
+
+    game_counters_t estimate = *counters;
+    apply_stratification(setup, &estimate);
+
+    if(mode == SIM_MODE_PLAYER) player_probabilities(&estimate, setup->num_players, probabilities);
+    else spectator_probabilities(&estimate, setup->num_players, probabilities);
+
+    return options->progress(probabilities, num_rows, &info, options->progress_data) != 0;
+}
+
+
+/**
+ * @brief Number of games needed so that the standard errors of the win and tie probabilities of every player with
+ * known cards are not greater than target_std_error. Proportions are estimated as (x + 2) / (n + 4), so that an
+ * outcome not seen yet (e.g. no ties) does not look like a proportion with no variance. With variance reduction,
+ * the games of plain Monte Carlo are scaled by the reduction measured so far.
+ *
+ * @param setup Setup of the games.
+ * @param counters Counters of the games simulated so far.
+ * @param target_std_error Target standard error, in percentage points.
+ * @return Number of games needed.
+ */
+double games_for_std_error(const game_setup_t *setup, const game_counters_t *counters, double target_std_error){
+    double target = target_std_error / 100.0;
+    double n = (double) counters->num_of_games;
+    double needed = 0.0;
+
+    for(int i = 0; i < setup->num_known_players; i++){
+        int outcomes[2] = { counters->num_of_wins[i], counters->num_of_draws[i] };
+        for(int j = 0; j < 2; j++){
+            double p = ((double) outcomes[j] + 2.0) / (n + 4.0);
+            double games = p * (1.0 - p) / (target * target);
+            if(setup->variance_method != SIM_VR_NONE && n > 0.0){
+                double p_plain = (double) outcomes[j] / n;
+                double variance = estimator_variance(setup, counters, i, j);
+                if(variance > 0.0 && p_plain > 0.0 && p_plain < 1.0) games *= variance * n / (p_plain * (1.0 - p_plain));
+            }
+            if(games > needed) needed = games;
+        }
+    }
+
+    return needed;
+}
+
+
+
+/**
+ * @brief Number of different games of a setup: the combinations of the missing community cards, times the
+ * combinations of two cards of every player whose cards are unknown, from the cards that remain.
+ *
+ * @param setup Setup of the games.
+ * @return Number of different games, as a double because it can be huge.
+ */
+double count_exact_games(const game_setup_t *setup){
+    double num_games = 1.0;
+    int n = setup->num_unknown_cards;
+
+    for(int i = 0; i < 5 - setup->num_board_cards; i++){
+        num_games = num_games * (double) (n - i) / (double) (i + 1);
+    }
+    n -= 5 - setup->num_board_cards;
+
+    for(int i = setup->num_known_players; i < setup->num_players; i++, n -= 2){
+        num_games *= (double) n * (double) (n - 1) / 2.0;
+    }
+
+    return num_games;
+}
+
+
+/**
+ * @brief Exact enumeration of the missing community cards. Cards are taken in increasing position of the deck
+ * of unknown cards, so every combination is visited once. When the board is complete, the cards of the players
+ * whose cards are unknown are enumerated.
+ *
+ * @param enumeration State of the enumeration.
+ * @param board_pos Position of the board being filled.
+ * @param start First position of the deck that can fill it.
+ */
+void enumerate_board(enumeration_t *enumeration, int board_pos, int start){
+    const game_setup_t *setup = enumeration->setup;
+
+    if(board_pos == 5){
+        // The board is the same for all the holdings of the players, so it is prepared once
+        enumeration->board_state = eval_prepare(enumeration->board);
+        for(int i = 0; i < setup->num_known_players; i++){
+            enumeration->scores[i] = eval_with_hole(&enumeration->board_state, enumeration->players_cards[i][0], enumeration->players_cards[i][1]);
+        }
+        enumerate_players(enumeration, setup->num_known_players);
+        return;
+    }
+
+    for(int i = start; i < setup->num_unknown_cards; i++){
+        enumeration->used |= 1ULL << i;
+        enumeration->board[board_pos] = deck[setup->unknown_cards[i]];
+        enumerate_board(enumeration, board_pos + 1, i + 1);
+        enumeration->used &= ~(1ULL << i);
+    }
+}
+
+
+/**
+ * @brief Exact enumeration of the cards of the players whose cards are unknown, once the board is complete.
+ * Every player receives every pair of cards not dealt yet, and each complete game is scored.
+ *
+ * @param enumeration State of the enumeration.
+ * @param player Player whose cards are being enumerated.
+ */
+void enumerate_players(enumeration_t *enumeration, int player){
+    const game_setup_t *setup = enumeration->setup;
+
+    if(player == setup->num_players){
+        tally_game(enumeration->scores, setup->num_players, enumeration->counters);
+        return;
+    }
+
+    for(int i = 0; i < setup->num_unknown_cards; i++){
+        if((enumeration->used >> i) & 1) continue;
+        for(int j = i + 1; j < setup->num_unknown_cards; j++){
+            if((enumeration->used >> j) & 1) continue;
+            enumeration->used |= (1ULL << i) | (1ULL << j);
+            enumeration->players_cards[player][0] = deck[setup->unknown_cards[i]];
+            enumeration->players_cards[player][1] = deck[setup->unknown_cards[j]];
+            enumeration->scores[player] = eval_with_hole(&enumeration->board_state, enumeration->players_cards[player][0], enumeration->players_cards[player][1]);
+            enumerate_players(enumeration, player + 1);
+            enumeration->used &= ~((1ULL << i) | (1ULL << j));
+        }
+    }
+}
+
+
+/**
+ * @brief Seeding of the random number generator of every thread. The generator of thread i is seeded with
+ * options->seed and then jumped i times (xoshiro256**) or set to the stream i (PCG32), so the streams of different
+ * threads never overlap.
+ *
+ * @param options Options of the simulation.
+ * @param rngs Generators to seed.
+ * @param num_threads Number of threads.
+ */
+void seed_generators(const sim_options_t *options, rng_t rngs[], int num_threads){
+    uint64_t seed = resolve_seed(options->seed);
+
+    for(int i = 0; i < num_threads; i++){
+        rng_seed(&rngs[i], options->rng, seed, (uint64_t) i);
+    }
+}
+
+
+/**
+ * @brief Seed of a simulation: the given one, or one taken from the clock with SIM_SEED_FROM_CLOCK.
+ *
+ * @param seed Seed of the options of the simulation.
+ * @return Seed to use.
+ */
+uint64_t resolve_seed(uint64_t seed){
+    if(seed == SIM_SEED_FROM_CLOCK){
+        seed = ((uint64_t) time(NULL) << 32) ^ (uint64_t) clock() ^ (uint64_t) (uintptr_t) &seed;
+    }
+    return seed;
+}
+
+
+/**
+ * @brief Simulation of num_games games of a setup, split across num_threads threads. Each thread simulates its
+ * share of the games over its own copy of the deck and with its own random number generator, and its counters are
+ * added to the result. If a thread can not be created, its share of the games is simulated by the calling thread.
+ *
+ * @param setup Setup of the games: players' known cards, community cards and deck of unknown cards.
+ * @param num_games Number of games to simulate.
+ * @param num_threads Number of threads.
+ * @param rngs Random number generator of each thread, their state is updated so that they can be used again.
+ * @param counters Counters where the results of all the games are added.
+ */
+void run_simulation(const game_setup_t *setup, int num_games, int num_threads, rng_t rngs[], game_counters_t *counters){
+    simulation_thread_t threads_data[num_threads];
+    pthread_t threads[num_threads];
+    char started[num_threads];
+    long first_game = counters->num_of_games;
+
+    for(int i = 0; i < num_threads; i++){
+        threads_data[i].setup = setup;
+        threads_data[i].num_games = num_games / num_threads + (i < num_games % num_threads);
+        threads_data[i].first_game = first_game;
+        threads_data[i].rng = rngs[i];
+        first_game += threads_data[i].num_games;
+        // The first share is always simulated by the calling thread
+        started[i] = (i > 0) && (threads_data[i].num_games > 0) &&
+                     (pthread_create(&threads[i], NULL, simulation_thread, &threads_data[i]) == 0);
+    }
+
+    for(int i = 0; i < num_threads; i++){
+        if(!started[i]) simulation_thread(&threads_data[i]);
+    }
+
+    for(int i = 0; i < num_threads; i++){
+        if(started[i]) pthread_join(threads[i], NULL);
+        rngs[i] = threads_data[i].rng;
+        add_counters(counters, &threads_data[i].counters, setup->num_players);
+
+        if(setup->variance_method == SIM_VR_NONE) continue;
+
+        for(int p = 0; p < setup->num_known_players; p++){
+            for(int s = 0; s < MAX_STRATA; s++){
+                counters->stratum_games[p][s] += threads_data[i].counters.stratum_games[p][s];
+                counters->stratum_wins[p][s] += threads_data[i].counters.stratum_wins[p][s];
+                counters->stratum_draws[p][s] += threads_data[i].counters.stratum_draws[p][s];
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief Run of a work split across threads, as run_simulation() does with the games of a setup, for the simulations
+ * with their own state per thread: simulate_spectator_streets(), simulate_player_sweep(), simulate_holdings() and the
+ * Omaha ones. The state of every thread starts with a thread_share_t, which is filled with the work, the share of the
+ * games or of the enumeration of the thread and its generator, seeded as seed_generators() does. The first share is
+ * always computed by the calling thread, and so is the share of a thread that can not be created. Then the states of
+ * the other threads are added into that of the first one.
+ *
+ * @param thread_size Size of the state of a thread.
+ * @param work Work of the threads, thread_share_t.work.
+ * @param exact 1 if every thread enumerates its share, 0 if it simulates its share of num_games games.
+ * @param num_games Number of games to simulate, without exact.
+ * @param num_threads Number of threads. Without exact, there are never more threads than games.
+ * @param options Options of the simulation, with the generator and the seed.
+ * @param body Body of a thread, it receives the state of the thread and resets its counters.
+ * @param merge Addition of the counters of the state of a thread into the state of the first one.
+ * @return State of the first thread with the counters of all of them, to be released with free(). NULL if memory
+ * can not be allocated.
+ */
+void *run_threads(size_t thread_size, const void *work, int exact, int num_games, int num_threads, const sim_options_t *options,
+                  thread_body_fn body, thread_merge_fn merge){
+    if(num_threads < 1) num_threads = 1;
+    if(!exact && num_threads > num_games) num_threads = (num_games > 0) ? num_games : 1;
+
+    // The counters of every state start at a cache line, and thread_size is a multiple of it
+    char *threads_data = (char *) aligned_alloc(CACHE_LINE_SIZE, num_threads * thread_size);
+    if(threads_data == NULL) return NULL;
+    pthread_t threads[num_threads];
+    char started[num_threads];
+    rng_t rngs[num_threads];
+
+    seed_generators(options, rngs, num_threads);
+
+    for(int i = 0; i < num_threads; i++){
+        thread_share_t *share = (thread_share_t *) (threads_data + i * thread_size);
+        share->work = work;
+        share->exact = exact;
+        share->thread = i;
+        share->num_threads = num_threads;
+        share->num_games = num_games / num_threads + (i < num_games % num_threads);
+        share->rng = rngs[i];
+        // The first share is always computed by the calling thread
+        started[i] = (i > 0) && (pthread_create(&threads[i], NULL, body, share) == 0);
+    }
+
+    for(int i = 0; i < num_threads; i++){
+        if(!started[i]) body(threads_data + i * thread_size);
+    }
+
+    for(int i = 0; i < num_threads; i++){
+        if(started[i]) pthread_join(threads[i], NULL);
+        if(i > 0) merge(threads_data, threads_data + i * thread_size);
+    }
+
+    return threads_data;
+}
+
+
+/**
+ * @brief Addition of the games, wins, ties and hand types of some counters into others.
+ *
+ * @param total Counters where the others are added.
+ * @param counters Counters to add.
+ * @param num_players Number of players of the counters.
+ */
+void add_counters(game_counters_t *total, const game_counters_t *counters, int num_players){
+    total->num_of_games += counters->num_of_games;
+    for(int p = 0; p < num_players; p++){
+        total->num_of_wins[p] += counters->num_of_wins[p];
+        total->num_of_draws[p] += counters->num_of_draws[p];
+        for(int j = 0; j < NUM_OF_HAND_TYPES; j++){
+            total->num_of_hand_types[p][j] += counters->num_of_hand_types[p][j];
+        }
+    }
+}
+
+
+/**
+ * @brief Body of a simulation thread. It simulates the games assigned to the thread over its own copy of the deck.
+ *
+ * @param arg Pointer to the simulation_thread_t of the thread.
+ * @return NULL.
+ */
+void *simulation_thread(void *arg){
+    simulation_thread_t *thread = (simulation_thread_t *) arg;
+    const game_setup_t *setup = thread->setup;
+
+    int random_vec[TOTAL_CARDS]; // Deck of the thread
+    memcpy(random_vec, setup->unknown_cards, setup->num_unknown_cards * sizeof(int));
+
+    memset(&thread->counters, 0, sizeof(game_counters_t));
+
+    SIM_PERF_BEGIN(perf_fds);
+    if(setup->variance_method != SIM_VR_NONE){
+        play_variance_reduced_games(setup, random_vec, thread->num_games, thread->first_game, &thread->rng, &thread->counters);
+    } else {
+        play_games(setup, random_vec, thread->num_games, &thread->rng, &thread->counters);
+    }
+    SIM_PERF_END(perf_fds);
+    SIM_FLUSH_STATS();
+
+    return NULL;
+}
+
+
+/**
+ * @brief Setup of a spectator's spot: the cards of all the players and the community cards are known, and the deck
+ * of unknown cards has every other card but the discarded ones.
+ *
+ * @param setup Setup to fill.
+ * @param players_cards Cards of the players, as in simulate_spectator().
+ * @param board_cards Community cards.
+ * @param discarded_cards Discarded cards.
+ * @param num_discarded_cards Number of discarded cards.
+ * @param num_board_cards Number of community cards.
+ * @param num_players Number of players.
+ */
+void build_spectator_setup(game_setup_t *setup, char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players){
+    setup->num_players = num_players;
+    setup->num_known_players = num_players;
+    setup->num_ranged_players = 0;
+    setup->num_board_cards = num_board_cards;
+
+    uint64_t known_mask = 0;
+
+    for(int i = 0; i < num_discarded_cards;i++){
+        known_mask |= 1ULL << cardtype_to_num(discarded_cards[i]);
+    }
+
+    for(int i = 0; i < (num_players);i++){
+        setup->players_cards[i][0] = cardtype_to_num(players_cards[i * 2]);
+        setup->players_cards[i][1] = cardtype_to_num(players_cards[i * 2 + 1]);
+        known_mask |= (1ULL << setup->players_cards[i][0]) | (1ULL << setup->players_cards[i][1]);
+    }
+
+    for(int i = 0; i < num_board_cards;i++){
+        setup->board_cards[i] = cardtype_to_num(board_cards[i]);
+        known_mask |= 1ULL << setup->board_cards[i];
+    }
+
+    /* Create a deck with all the cards except the ones the spectator knows */
+
+    build_unknown_cards(setup, known_mask);
+}
+
+
+/**
+ * @brief Creation of the deck of unknown cards of a setup: all the cards whose bit is not set in known_mask,
+ * in increasing order.
+ *
+ * @param setup Setup whose unknown_cards and num_unknown_cards are filled.
+ * @param known_mask Mask of known cards, bit i set if card i (in [0,51]) is known.
+ */
+void build_unknown_cards(game_setup_t *setup, uint64_t known_mask){
+    setup->num_unknown_cards = 0;
+    for(int i = 0; i < TOTAL_CARDS; i++){
+        if(!((known_mask >> i) & 1)) setup->unknown_cards[setup->num_unknown_cards++] = i;
+    }
+}
+
+
+/**
+ * @brief Check of the number of community cards of a call: only the preflop, flop, turn and river are valid.
+ *
+ * @param num_board_cards Number of community cards.
+ * @return 1 if num_board_cards is 0, 3, 4 or 5, 0 otherwise.
+ */
+int valid_board_size(int num_board_cards){
+    return num_board_cards == 0 || (num_board_cards >= 3 && num_board_cards <= 5);
+}
+
+
+/**
+ * @brief Check that the deck of unknown cards of a setup holds every card a game consumes: two for every player
+ * whose cards are unknown and the missing community cards.
+ *
+ * @param setup Setup whose deck of unknown cards is filled.
+ * @return 1 if the games of the setup can be dealt, 0 otherwise.
+ */
+int setup_dealable(const game_setup_t *setup){
+    int needed = 2 * (setup->num_players - setup->num_known_players) + 5 - setup->num_board_cards;
+    return needed <= setup->num_unknown_cards;
+}
+
+
+/**
+ * @brief Simulation of games. In every game only the cards the game consumes are dealt from the deck: two cards
+ * for every player whose cards are unknown and the missing community cards. Then the best hand of every player is
+ * compared.
+ *
+ * When the CPU has vector instructions, games are dealt LOCKSTEP_GAMES at a time and the hands of all their players
+ * are scored with a single call to get_scores7_batch(), which evaluates several hands per instruction. Otherwise
+ * the board of each game is prepared once with eval_prepare() and every player only adds their two hole cards.
+ *
+ * @param setup Setup of the games.
+ * @param random_vec Deck of unknown cards, the dealt cards are moved to its first positions in every game.
+ * @param num_games Number of games to simulate.
+ * @param rng Random number generator of the thread.
+ * @param counters Counters of wins, ties and hand types of each player.
+ */
+void play_games(const game_setup_t *setup, int random_vec[], int num_games, rng_t *rng, game_counters_t *counters){
+    int num_players = setup->num_players;
+    int players_cards[MAX_PLAYERS][2];
+    int board[5];
+    int hands[7 * LOCKSTEP_GAMES * MAX_PLAYERS];     // Card j of hand h at hands[j * num_hands + h]
+    unsigned short scores[LOCKSTEP_GAMES * MAX_PLAYERS];
+
+    for(int i = 0; i < setup->num_known_players; i++){
+        players_cards[i][0] = deck[setup->players_cards[i][0]];
+        players_cards[i][1] = deck[setup->players_cards[i][1]];
+    }
+    for(int i = 0; i < setup->num_board_cards; i++){
+        board[i] = deck[setup->board_cards[i]];
+    }
+
+    int num_dealt_cards = 2 * (num_players - setup->num_known_players - setup->num_ranged_players) + (5 - setup->num_board_cards);
+
+    // Position of every card in the deck, only kept up to date when there are ranges
+    unsigned char positions[TOTAL_CARDS];
+    for(int i = 0; i < setup->num_unknown_cards; i++) positions[random_vec[i]] = (unsigned char) i;
+
+    if(get_scores_batch_kind() == EVAL_BATCH_SCALAR){
+        for(int it = 0; it < num_games; it++){
+            SIM_TIMER_START(deal_timer);
+            if(setup->num_ranged_players > 0) deal_ranged_game(setup, random_vec, positions, num_dealt_cards, rng, players_cards, board);
+            else deal_game(setup, random_vec, num_dealt_cards, rng, players_cards, board);
+            SIM_TIMER_STOP(deal_timer, deal_cycles);
+
+            SIM_TIMER_START(evaluate_timer);
+            eval_board_t board_state = eval_prepare(board);
+            for(int i = 0; i < num_players; i++){
+                scores[i] = eval_with_hole(&board_state, players_cards[i][0], players_cards[i][1]);
+            }
+            SIM_TIMER_STOP(evaluate_timer, evaluate_cycles);
+
+            SIM_TIMER_START(tally_timer);
+            tally_game(scores, num_players, counters);
+            SIM_TIMER_STOP(tally_timer, tally_cycles);
+        }
+        SIM_ADD(games, num_games);
+        return;
+    }
+
+    for(int played = 0; played < num_games; played += LOCKSTEP_GAMES){
+        int num_lockstep_games = (num_games - played < LOCKSTEP_GAMES) ? num_games - played : LOCKSTEP_GAMES;
+        int num_hands = num_lockstep_games * num_players;
+
+        SIM_TIMER_START(deal_timer);
+        for(int game = 0; game < num_lockstep_games; game++){
+            if(setup->num_ranged_players > 0) deal_ranged_game(setup, random_vec, positions, num_dealt_cards, rng, players_cards, board);
+            else deal_game(setup, random_vec, num_dealt_cards, rng, players_cards, board);
+
+            for(int i = 0, h = game * num_players; i < num_players; i++, h++){
+                hands[h] = players_cards[i][0];
+                hands[num_hands + h] = players_cards[i][1];
+                for(int j = 0; j < 5; j++){
+                    hands[(j + 2) * num_hands + h] = board[j];
+                }
+            }
+        }
+
+        SIM_TIMER_STOP(deal_timer, deal_cycles);
+
+        SIM_TIMER_START(evaluate_timer);
+        get_scores7_batch(hands, scores, num_hands);
+        SIM_TIMER_STOP(evaluate_timer, evaluate_cycles);
+
+        SIM_TIMER_START(tally_timer);
+        for(int game = 0; game < num_lockstep_games; game++){
+            tally_game(scores + game * num_players, num_players, counters);
+        }
+        SIM_TIMER_STOP(tally_timer, tally_cycles);
+    }
+    SIM_ADD(games, num_games);
+}
+
+
+/**
+ * @brief Simulation of games with variance reduction (see sim_variance_reduction_t). Games are dealt like in
+ * play_games() and scored one at a time with eval_prepare() and eval_with_hole(). Besides the usual counters, the
+ * outcome of every player with known cards is added to the counters of the technique:
+ *
+ * - SIM_VR_STRATIFIED: game g of the simulation has the unknown card g % num_unknown_cards on the board, so every
+ *   possible next community card is dealt in the same number of games (give or take one), which is its probability.
+ * - SIM_VR_CONTROL_VARIATE: the outcome is added to the stratum of the hand type of the player.
+ * - SIM_VR_QUASI_RANDOM: game g of the simulation is point g / QMC_REPLICATES of the replicate g % QMC_REPLICATES
+ *   (see deal_quasi_random_cards()), and the outcome is added to the stratum of the replicate.
+ *
+ * @param setup Setup of the games, with its variance reduction prepared by prepare_variance_reduction().
+ * @param random_vec Deck of unknown cards, the dealt cards are moved to its first positions in every game.
+ * @param num_games Number of games to simulate.
+ * @param first_game Number of the first of these games in the whole simulation, it selects the strata and points.
+ * @param rng Random number generator of the thread.
+ * @param counters Counters of wins, ties and hand types of each player, and those of the variance reduction.
+ */
+void play_variance_reduced_games(const game_setup_t *setup, int random_vec[], int num_games, long first_game, rng_t *rng, game_counters_t *counters){
+    int num_players = setup->num_players;
+    int num_unknown_cards = setup->num_unknown_cards;
+    int players_cards[MAX_PLAYERS][2];
+    int board[5];
+    unsigned short scores[MAX_PLAYERS];
+
+    for(int i = 0; i < setup->num_known_players; i++){
+        players_cards[i][0] = deck[setup->players_cards[i][0]];
+        players_cards[i][1] = deck[setup->players_cards[i][1]];
+    }
+    for(int i = 0; i < setup->num_board_cards; i++){
+        board[i] = deck[setup->board_cards[i]];
+    }
+
+    int num_dealt_cards = 2 * (num_players - setup->num_known_players) + (5 - setup->num_board_cards);
+
+    for(int it = 0; it < num_games; it++){
+        int stratum = 0;
+
+        SIM_TIMER_START(deal_timer);
+        if(setup->variance_method == SIM_VR_STRATIFIED){
+            // The card of the stratum is kept at the end of the deck, then swapped in as the last dealt card
+            stratum = (int) ((first_game + it) % num_unknown_cards);
+            int card = setup->unknown_cards[stratum], pos = 0;
+            while(random_vec[pos] != card) pos++;
+            random_vec[pos] = random_vec[num_unknown_cards - 1];
+            deal_cards(random_vec, num_unknown_cards - 1, num_dealt_cards - 1, rng);
+            random_vec[num_unknown_cards - 1] = random_vec[num_dealt_cards - 1];
+            random_vec[num_dealt_cards - 1] = card;
+            place_dealt_cards(setup, random_vec, NULL, players_cards, board);
+        } else if(setup->variance_method == SIM_VR_QUASI_RANDOM){
+            long game = first_game + it;
+            stratum = (int) (game % QMC_REPLICATES);
+            deal_quasi_random_cards(setup, (uint64_t) (game / QMC_REPLICATES), setup->qmc_shifts[stratum], random_vec);
+            place_dealt_cards(setup, random_vec, NULL, players_cards, board);
+        } else {
+            deal_cards(random_vec, num_unknown_cards, num_dealt_cards, rng);
+            place_dealt_cards(setup, random_vec, NULL, players_cards, board);
+        }
+        SIM_TIMER_STOP(deal_timer, deal_cycles);
+
+        SIM_TIMER_START(evaluate_timer);
+        eval_board_t board_state = eval_prepare(board);
+        for(int i = 0; i < num_players; i++){
+            scores[i] = eval_with_hole(&board_state, players_cards[i][0], players_cards[i][1]);
+        }
+        SIM_TIMER_STOP(evaluate_timer, evaluate_cycles);
+
+        SIM_TIMER_START(tally_timer);
+        tally_game(scores, num_players, counters);
+
+        unsigned short best_score = 0xFFFF;
+        int num_of_winners = 0;
+        for(int i = 0; i < num_players; i++){
+            if(scores[i] < best_score){
+                best_score = scores[i];
+                num_of_winners = 0;
+            }
+            if(scores[i] == best_score) num_of_winners++;
+        }
+
+        for(int i = 0; i < setup->num_known_players; i++){
+            int win = (scores[i] == best_score && num_of_winners == 1);
+            int draw = (scores[i] == best_score && num_of_winners > 1);
+
+
+            if(setup->variance_method == SIM_VR_CONTROL_VARIATE) stratum = score_hand_to_num[scores[i]];
+            counters->stratum_games[i][stratum]++;
+            counters->stratum_wins[i][stratum] += win;
+            counters->stratum_draws[i][stratum] += draw;
+        }
+        SIM_TIMER_STOP(tally_timer, tally_cycles);
+    }
+    SIM_ADD(games, num_games);
+}
+
+
+/**
+ * @brief Placing of the cards dealt to the first positions of the deck, in the order of deal_game(): two cards for
+ * every player whose cards are unknown and then the missing community cards.
+ *
+ * @param setup Setup of the games.
+ * @param dealt Dealt cards, in [0,51].
+ * @param map If not NULL, every dealt card c is replaced by map[c].
+ * @param players_cards Cactus Kev encoded cards of every player, those of the players with unknown cards are replaced.
+ * @param board Cactus Kev encoded community cards, the missing ones are replaced.
+ */
+static inline void place_dealt_cards(const game_setup_t *setup, const int dealt[], const int map[], int players_cards[][2], int board[5]){
+    int given_cards = 0;
+
+    for(int i = setup->num_known_players; i < setup->num_players; i++){
+        for(int j = 0; j < 2; j++, given_cards++){
+            players_cards[i][j] = deck[(map != NULL) ? map[dealt[given_cards]] : dealt[given_cards]];
+        }
+    }
+    for(int j = setup->num_board_cards; j < 5; j++, given_cards++){
+        board[j] = deck[(map != NULL) ? map[dealt[given_cards]] : dealt[given_cards]];
+    }
+}
+
+
+/**
+ * @brief Dealing of the cards of a game from a point of the quasi-random sequence. Coordinate d of the point is the
+ * scrambled radical inverse of its index in the d-th prime base (a Halton sequence), shifted modulo 1 by the shift
+ * of the replicate (Cranley-Patterson rotation). The coordinates drive a Fisher-Yates shuffle of the unknown cards
+ * in increasing order, so each one draws a card among those not drawn yet: the missing community cards take the
+ * first dimensions, whose bases are the smallest and the most uniform, and the unknown players' cards the next ones.
+ *
+ * @param setup Setup of the games, with its quasi-random sequence prepared by prepare_variance_reduction().
+ * @param index Index of the point in the sequence.
+ * @param shifts Random shift of every dimension of the replicate.
+ * @param dealt Where the dealt cards (in [0,51]) are stored, in the order of place_dealt_cards().
+ */
+static inline void deal_quasi_random_cards(const game_setup_t *setup, uint64_t index, const double shifts[], int dealt[]){
+    int cards[TOTAL_CARDS];
+    int num_cards = setup->num_unknown_cards;
+    int num_board_dealt = 5 - setup->num_board_cards;
+    int num_players_dealt = 2 * (setup->num_players - setup->num_known_players);
+
+    memcpy(cards, setup->unknown_cards, num_cards * sizeof(int));
+
+    for(int d = 0; d < num_board_dealt + num_players_dealt; d++){
+        double u = scrambled_radical_inverse(index, QMC_PRIMES[d], setup->qmc_multipliers[d]) + shifts[d];
+        if(u >= 1.0) u -= 1.0;
+
+        int j = d + (int) (u * (double) (num_cards - d));
+        if(j >= num_cards) j = num_cards - 1;
+        int card = cards[j];
+        cards[j] = cards[d];
+        cards[d] = card;
+
+        // The community cards go after the players' cards in the dealing order
+        dealt[(d < num_board_dealt) ? num_players_dealt + d : d - num_board_dealt] = card;
+    }
+}
+
+
+/**
+ * @brief Radical inverse of an index in a base with its digits scrambled: every digit k becomes
+ * (multiplier * k) mod base before being mirrored around the radix point. Zero digits stay zero, so the trailing
+ * ones add nothing and the result is exact.
+ *
+ * @param index Index to invert.
+ * @param base Prime base.
+ * @param multiplier Scrambling multiplier in [1,base-1], 1 for the plain Halton sequence.
+ * @return Radical inverse in [0,1).
+ */
+static inline double scrambled_radical_inverse(uint64_t index, int base, int multiplier){
+    double inverse_base = 1.0 / (double) base;
+    double factor = inverse_base, result = 0.0;
+
+    while(index > 0){
+        int digit = (int) (index % (uint64_t) base);
+        result += factor * (double) ((digit * multiplier) % base);
+        index /= (uint64_t) base;
+        factor *= inverse_base;
+    }
+
+    return result;
+}
+
+
+/**
+ * @brief Preparation of the variance reduction of a Monte Carlo simulation. It falls back to SIM_VR_NONE when the
+ * technique is unknown or does not apply: with players with ranges, stratification with the board complete, and
+ * control variates without players with known cards.
+ *
+ * The control variate needs the exact distribution of the hand types of every player with known cards, see
+ * hand_type_probabilities(). The quasi-random sequence draws a random digit scrambling for every dimension but the
+ * first one (base 2 has a single permutation that keeps zero) and a random shift of every dimension for each replicate.
+ *
+ * @param setup Setup of the games, whose variance_method and the data of the technique are filled.
+ * @param method Variance reduction requested.
+ * @param rng Random number generator for the scrambling and shifts of the quasi-random sequence.
+ */
+void prepare_variance_reduction(game_setup_t *setup, sim_variance_reduction_t method, rng_t *rng){
+    if(setup->num_ranged_players > 0 || (method == SIM_VR_STRATIFIED && setup->num_board_cards == 5) ||
+       (method != SIM_VR_STRATIFIED && method != SIM_VR_CONTROL_VARIATE && method != SIM_VR_QUASI_RANDOM) ||
+       (method == SIM_VR_CONTROL_VARIATE && setup->num_known_players == 0)){
+        method = SIM_VR_NONE;
+    }
+    setup->variance_method = method;
+    setup->preparation_games = 0.0;
+
+    if(method == SIM_VR_CONTROL_VARIATE){
+        hand_type_probabilities(setup);
+    } else if(method == SIM_VR_QUASI_RANDOM){
+        for(int d = 0; d < QMC_MAX_DIMENSIONS; d++){
+            setup->qmc_multipliers[d] = 1 + (int) rng_bounded(rng, (uint32_t) (QMC_PRIMES[d] - 1));
+        }
+        for(int r = 0; r < QMC_REPLICATES; r++){
+            for(int d = 0; d < QMC_MAX_DIMENSIONS; d++){
+                setup->qmc_shifts[r][d] = (double) rng_next32(rng) * (1.0 / 4294967296.0);
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief Exact distribution of the hand types of every player with known cards. The missing community cards are
+ * equally likely to be any of the unknown cards whatever the cards of the other players, so the distribution of a
+ * player only depends on its hole cards, the board and the cards that cannot come (the known cards of the others and
+ * the discarded ones). It is enumerated with enumerate_board() as if there were only the players with known cards:
+ * preflop, C(50,5) = 2118760 boards for a single known player, which costs far more than a typical simulation.
+ *
+ * The distributions are kept in a cache keyed on the canonical spot of the player (see type_cache_key()), so preflop
+ * every one of the 169 classes of starting hands is enumerated once per process. Only the players missing from the
+ * cache are enumerated, and the hands scored are charged to setup->preparation_games.
+ *
+ * @param setup Setup of the games, whose type_probabilities and preparation_games are filled.
+ */
+void hand_type_probabilities(game_setup_t *setup){
+    uint64_t keys[MAX_PLAYERS][3];
+    int missing[MAX_PLAYERS], num_missing = 0;
+
+    pthread_mutex_lock(&type_cache_lock);
+    for(int i = 0; i < setup->num_known_players; i++){
+        type_cache_key(setup, i, keys[i]);
+        const type_cache_entry_t *entry = &type_cache[type_cache_slot(keys[i])];
+        if(entry->hole_cards == keys[i][0] && entry->board_cards == keys[i][1] && entry->dead_cards == keys[i][2]){
+            memcpy(setup->type_probabilities[i], entry->probabilities, sizeof(entry->probabilities));
+        } else {
+            missing[num_missing++] = i;
+        }
+    }
+    pthread_mutex_unlock(&type_cache_lock);
+
+    if(num_missing == 0) return;
+
+    game_setup_t known_setup = *setup;
+    game_counters_t counters;
+    enumeration_t enumeration;
+
+    known_setup.num_players = num_missing;
+    known_setup.num_known_players = num_missing;
+    enumeration.setup = &known_setup;
+    enumeration.used = 0;
+    enumeration.counters = &counters;
+    for(int j = 0; j < num_missing; j++){
+        known_setup.players_cards[j][0] = setup->players_cards[missing[j]][0];
+        known_setup.players_cards[j][1] = setup->players_cards[missing[j]][1];
+        enumeration.players_cards[j][0] = deck[known_setup.players_cards[j][0]];
+        enumeration.players_cards[j][1] = deck[known_setup.players_cards[j][1]];
+    }
+    for(int i = 0; i < setup->num_board_cards; i++){
+        enumeration.board[i] = deck[setup->board_cards[i]];
+    }
+
+    memset(&counters, 0, sizeof(game_counters_t));
+    enumerate_board(&enumeration, setup->num_board_cards, 0);
+
+    // A game of plain Monte Carlo scores a hand of every player
+    setup->preparation_games = (double) counters.num_of_games * num_missing / setup->num_players;
+
+    pthread_mutex_lock(&type_cache_lock);
+    for(int j = 0; j < num_missing; j++){
+        int i = missing[j];
+        type_cache_entry_t *entry = &type_cache[type_cache_slot(keys[i])];
+        for(int t = 0; t < NUM_OF_HAND_TYPES; t++){
+            setup->type_probabilities[i][t] = (double) counters.num_of_hand_types[j][t] / (double) counters.num_of_games;
+        }
+        entry->hole_cards = keys[i][0];
+        entry->board_cards = keys[i][1];
+        entry->dead_cards = keys[i][2];
+        memcpy(entry->probabilities, setup->type_probabilities[i], sizeof(entry->probabilities));
+    }
+    pthread_mutex_unlock(&type_cache_lock);
+}
+
+
+/**
+ * @brief Canonical key of the hand type distribution of a player with known cards: the masks of its hole cards, of
+ * the board and of the cards that cannot come, under the suit relabelling that makes them the smallest. Hand types
+ * do not change when the suits are relabelled, so all the spots with the same key share the distribution.
+ *
+ * @param setup Setup of the games.
+ * @param player Player with known cards.
+ * @param key Where the masks of the hole cards, the board and the dead cards are stored, in this order.
+ */
+void type_cache_key(const game_setup_t *setup, int player, uint64_t key[3]){
+    uint64_t hole = (1ULL << setup->players_cards[player][0]) | (1ULL << setup->players_cards[player][1]);
+    uint64_t board = 0, dead = (1ULL << TOTAL_CARDS) - 1;
+
+    for(int i = 0; i < setup->num_board_cards; i++) board |= 1ULL << setup->board_cards[i];
+    for(int i = 0; i < setup->num_unknown_cards; i++) dead &= ~(1ULL << setup->unknown_cards[i]);
+    dead &= ~(hole | board);
+
+    for(int p = 0; p < NUM_SUIT_PERMUTATIONS; p++){
+        uint64_t candidate[3] = { permute_suits(hole, SUIT_PERMUTATIONS[p]), permute_suits(board, SUIT_PERMUTATIONS[p]),
+                                  permute_suits(dead, SUIT_PERMUTATIONS[p]) };
+        int smaller = (candidate[0] != key[0]) ? (candidate[0] < key[0]) :
+                      (candidate[1] != key[1]) ? (candidate[1] < key[1]) : (candidate[2] < key[2]);
+        if(p == 0 || smaller){
+            key[0] = candidate[0];
+            key[1] = candidate[1];
+            key[2] = candidate[2];
+        }
+    }
+}
+
+
+/**
+ * @brief Slot of a key in the cache of hand type distributions.
+ *
+ * @param key Key of the distribution, see type_cache_key().
+ * @return Slot in [0,TYPE_CACHE_SIZE-1].
+ */
+static inline int type_cache_slot(const uint64_t key[3]){
+    uint64_t state = key[0] ^ rotl64(key[1], 21) ^ rotl64(key[2], 42);
+    return (int) (splitmix64(&state) & (TYPE_CACHE_SIZE - 1));
+}
+
+
+/**
+ * @brief Variance of the estimator of the win or tie probability of a player, given the variance reduction of the
+ * setup. With n games and proportion p:
+ *
+ * - SIM_VR_NONE: p * (1 - p) / n.
+ * - SIM_VR_STRATIFIED and SIM_VR_CONTROL_VARIATE: see stratified_estimate().
+ * - SIM_VR_QUASI_RANDOM: sample variance of the proportions of the independently shifted replicates, divided by
+ *   their number. The points of a replicate are not independent, so it is the only valid error estimate.
+ *
+ * Players with unknown cards have no variance reduction.
+ *
+ * @param setup Setup of the games.
+ * @param counters Counters of the games, before apply_stratification().
+ * @param player Player of the estimator.
+ * @param draws 0 for the win probability, 1 for the tie probability.
+ * @return Variance of the estimator, as a proportion (not in percentage points).
+ */
+double estimator_variance(const game_setup_t *setup, const game_counters_t *counters, int player, int draws){
+    double n = (double) counters->num_of_games;
+    if(n <= 0.0) return 0.0;
+
+    const int *outcomes = draws ? counters->num_of_draws : counters->num_of_wins;
+    double p = (double) outcomes[player] / n;
+    double variance = p * (1.0 - p) / n;
+
+    if(player >= setup->num_known_players) return variance;
+
+    switch(setup->variance_method){
+        case SIM_VR_STRATIFIED:
+        case SIM_VR_CONTROL_VARIATE:
+            stratified_estimate(setup, counters, player, draws, &variance);
+            return variance;
+        case SIM_VR_QUASI_RANDOM: {
+            const int *replicate_outcomes = draws ? counters->stratum_draws[player] : counters->stratum_wins[player];
+            double proportions[QMC_REPLICATES], mean = 0.0, sum = 0.0;
+            int num_replicates = 0;
+            for(int r = 0; r < QMC_REPLICATES; r++){
+                int games = counters->stratum_games[player][r];
+                if(games == 0) continue;
+                proportions[num_replicates] = (double) replicate_outcomes[r] / (double) games;
+                mean += proportions[num_replicates++];
+            }
+            if(num_replicates < 2) return variance;
+            mean /= (double) num_replicates;
+            for(int r = 0; r < num_replicates; r++) sum += (proportions[r] - mean) * (proportions[r] - mean);
+            return sum / (double) (num_replicates * (num_replicates - 1));
+        }
+        default:
+            return variance;
+    }
+}
+
+
+/**
+ * @brief Stratified estimate of the win or tie probability of a player with known cards: p = sum of w_s * p_s over
+ * the strata s, where w_s is the probability of the stratum and p_s the proportion of its games. Strata not seen yet
+ * take the proportion of all the games. With allocation proportional to w_s, its variance is approximately the sum
+ * of w_s * p_s * (1 - p_s), divided by n.
+ *
+ * With SIM_VR_STRATIFIED the strata are the unknown cards, each with probability 1 / num_unknown_cards; weighting
+ * them removes the bias of the strata that received one game more than others. With SIM_VR_CONTROL_VARIATE they are
+ * the hand types of the player, with their exact probabilities: for a categorical control, post-stratification is
+ * the optimal linear control variate. With SIM_VR_QUASI_RANDOM they are the replicates, so the estimate is the mean
+ * of their estimates (its variance is that of estimator_variance(), not the one computed here).
+ *
+ * @param setup Setup of the games.
+ * @param counters Counters of the games, before apply_stratification().
+ * @param player Player with known cards.
+ * @param draws 0 for the win probability, 1 for the tie probability.
+ * @param variance Where the variance of the estimate is stored.
+ * @return Estimate of the probability.
+ */
+double stratified_estimate(const game_setup_t *setup, const game_counters_t *counters, int player, int draws, double *variance){
+    int control = (setup->variance_method == SIM_VR_CONTROL_VARIATE);
+    int num_strata = control ? NUM_OF_HAND_TYPES : setup->num_unknown_cards;
+    if(setup->variance_method == SIM_VR_QUASI_RANDOM) num_strata = QMC_REPLICATES;
+    const int *games = counters->stratum_games[player];
+    const int *outcomes = draws ? counters->stratum_draws[player] : counters->stratum_wins[player];
+    int total_games = 0, total_outcomes = 0;
+
+    for(int s = 0; s < num_strata; s++){
+        total_games += games[s];
+        total_outcomes += outcomes[s];
+    }
+
+    double pooled = (total_games > 0) ? (double) total_outcomes / (double) total_games : 0.0;
+    double p = 0.0, sum = 0.0;
+
+    for(int s = 0; s < num_strata; s++){
+        double w = control ? setup->type_probabilities[player][s] : 1.0 / (double) num_strata;
+        double p_s = (games[s] > 0) ? (double) outcomes[s] / (double) games[s] : pooled;
+        p += w * p_s;
+        sum += w * p_s * (1.0 - p_s);
+    }
+
+    *variance = (total_games > 0) ? sum / (double) total_games : 0.0;
+    return p;
+}
+
+
+/**
+ * @brief Replacement of the counters of the players with known cards by the stratified estimates (see
+ * stratified_estimate()), scaled to the number of games. With the control variate the hand types are replaced by
+ * their exact probabilities too. It does nothing with SIM_VR_NONE.
+ *
+ * @param setup Setup of the games.
+ * @param counters Counters of the games, updated.
+ */
+void apply_stratification(const game_setup_t *setup, game_counters_t *counters){
+    if(setup->variance_method == SIM_VR_NONE || counters->num_of_games == 0){
+        return;
+    }
+
+    double n = (double) counters->num_of_games;
+    double variance;
+
+    for(int i = 0; i < setup->num_known_players; i++){
+        int wins = (int) lround(stratified_estimate(setup, counters, i, 0, &variance) * n);
+        int draws = (int) lround(stratified_estimate(setup, counters, i, 1, &variance) * n);
+        if(wins + draws > counters->num_of_games) draws = counters->num_of_games - wins;
+        counters->num_of_wins[i] = wins;
+        counters->num_of_draws[i] = draws;
+        if(setup->variance_method != SIM_VR_CONTROL_VARIATE) continue;
+        for(int t = 0; t < NUM_OF_HAND_TYPES; t++){
+            counters->num_of_hand_types[i][t] = (int) lround(setup->type_probabilities[i][t] * n);
+        }
+    }
+}
+
+
+/**
+ * @brief Body of a thread of simulate_spectator_streets(). A flop or turn spot enumerates the runouts of the flop or
+ * turn on the board. Preflop, the thread enumerates the runouts of its share of the flops, or samples its share of
+ * the random runouts.
+ *
+ * @param arg Pointer to the streets_thread_t of the thread.
+ * @return NULL.
+ */
+void *streets_thread(void *arg){
+    streets_thread_t *thread = (streets_thread_t *) arg;
+    const game_setup_t *setup = (const game_setup_t *) thread->share.work;
+    int n = setup->num_unknown_cards;
+    int cards[TOTAL_CARDS];
+
+    memset(thread->counters, 0, sizeof(thread->counters));
+    thread->num_runouts = 0;
+
+    if(setup->num_board_cards > 0){
+        enumerate_runouts(setup, setup->board_cards, setup->unknown_cards, n, thread);
+        return NULL;
+    }
+
+    if(!thread->share.exact){
+        memcpy(cards, setup->unknown_cards, n * sizeof(int));
+        play_runouts(setup, cards, thread->share.num_games, &thread->share.rng, thread);
+        return NULL;
+    }
+
+    int flop_index = 0;
+    for(int i = 0; i < n; i++){
+        for(int j = i + 1; j < n; j++){
+            for(int k = j + 1; k < n; k++){
+                if(flop_index++ % thread->share.num_threads != thread->share.thread) continue;
+
+                int flop[3] = { setup->unknown_cards[i], setup->unknown_cards[j], setup->unknown_cards[k] };
+                int num_remaining = 0;
+                for(int c = 0; c < n; c++){
+                    if(c != i && c != j && c != k) cards[num_remaining++] = setup->unknown_cards[c];
+                }
+                enumerate_runouts(setup, flop, cards, num_remaining, thread);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Addition of the runouts and the counters of every street of a thread of simulate_spectator_streets() into
+ * those of another one.
+ *
+ * @param total Pointer to the streets_thread_t where the counters are added.
+ * @param thread Pointer to the streets_thread_t whose counters are added.
+ */
+void merge_streets(void *total, const void *thread){
+    streets_thread_t *streets = (streets_thread_t *) total;
+    const streets_thread_t *other = (const streets_thread_t *) thread;
+    const game_setup_t *setup = (const game_setup_t *) streets->share.work;
+
+    streets->num_runouts += other->num_runouts;
+    for(int s = 0; s < SIM_MAX_STREETS; s++){
+        add_counters(&streets->counters[s], &other->counters[s], setup->num_players);
+    }
+}
+
+
+/**
+ * @brief Exact enumeration of the runouts of a flop (or of the turn of a turn spot), added to the counters of every
+ * street after the spot. With t remaining cards, the flop is scored once for its t * (t - 1) ordered runouts; each
+ * turn once for its t - 1 rivers, with get_score6(); and each complete board once with eval_prepare(), with weight 2
+ * because it is the runout of two turns.
+ *
+ * @param setup Setup of the spot.
+ * @param board_cards Known community cards, in [0,51]: the flop, or the turn too in a turn spot.
+ * @param remaining Cards that can come on the turn and the river, in [0,51].
+ * @param num_remaining Number of remaining cards.
+ * @param thread Thread whose counters are updated.
+ */
+void enumerate_runouts(const game_setup_t *setup, const int board_cards[], const int remaining[], int num_remaining, streets_thread_t *thread){
+    int num_players = setup->num_players;
+    game_counters_t *counters = thread->counters;
+    int players_cards[MAX_PLAYERS][2];
+    int board[5];
+    int hand[6];
+    unsigned short scores[MAX_PLAYERS];
+
+    for(int i = 0; i < num_players; i++){
+        players_cards[i][0] = deck[setup->players_cards[i][0]];
+        players_cards[i][1] = deck[setup->players_cards[i][1]];
+    }
+    for(int i = 0; i < ((setup->num_board_cards == 4) ? 4 : 3); i++){
+        board[i] = deck[board_cards[i]];
+    }
+
+    if(setup->num_board_cards == 4){
+        for(int r = 0; r < num_remaining; r++){
+            board[4] = deck[remaining[r]];
+            eval_board_t board_state = eval_prepare(board);
+            for(int i = 0; i < num_players; i++){
+                scores[i] = eval_with_hole(&board_state, players_cards[i][0], players_cards[i][1]);
+            }
+            tally_game(scores, num_players, &counters[2]);
+        }
+        thread->num_runouts += num_remaining;
+        return;
+    }
+
+    if(setup->num_board_cards == 0){
+        for(int i = 0; i < num_players; i++){
+            int flop_hand[5] = { players_cards[i][0], players_cards[i][1], board[0], board[1], board[2] };
+            scores[i] = get_score(flop_hand);
+        }
+        tally_weighted_game(scores, num_players, num_remaining * (num_remaining - 1), &counters[0]);
+    }
+
+    for(int t = 0; t < num_remaining; t++){
+        board[3] = deck[remaining[t]];
+        for(int i = 0; i < num_players; i++){
+            hand[0] = players_cards[i][0];
+            hand[1] = players_cards[i][1];
+            for(int j = 0; j < 4; j++) hand[j + 2] = board[j];
+            scores[i] = get_score6(hand);
+        }
+        tally_weighted_game(scores, num_players, num_remaining - 1, &counters[1]);
+
+        for(int r = t + 1; r < num_remaining; r++){
+            board[4] = deck[remaining[r]];
+            eval_board_t board_state = eval_prepare(board);
+            for(int i = 0; i < num_players; i++){
+                scores[i] = eval_with_hole(&board_state, players_cards[i][0], players_cards[i][1]);
+            }
+            tally_weighted_game(scores, num_players, 2, &counters[2]);
+        }
+    }
+    thread->num_runouts += num_remaining * (num_remaining - 1) / 2;
+}
+
+
+/**
+ * @brief Simulation of random runouts of a preflop spot. Every runout deals the five community cards and is scored at
+ * the flop, the turn (with get_score6()) and the river.
+ *
+ * @param setup Setup of the spot.
+ * @param random_vec Deck of unknown cards, the dealt cards are moved to its first positions in every runout.
+ * @param num_games Number of runouts to simulate.
+ * @param rng Random number generator of the thread.
+ * @param thread Thread whose counters are updated.
+ */
+void play_runouts(const game_setup_t *setup, int random_vec[], int num_games, rng_t *rng, streets_thread_t *thread){
+    int num_players = setup->num_players;
+    int players_cards[MAX_PLAYERS][2];
+    int board[5];
+    int hand[6];
+    unsigned short scores[MAX_PLAYERS];
+
+    for(int i = 0; i < num_players; i++){
+        players_cards[i][0] = deck[setup->players_cards[i][0]];
+        players_cards[i][1] = deck[setup->players_cards[i][1]];
+    }
+
+    for(int it = 0; it < num_games; it++){
+        deal_cards(random_vec, setup->num_unknown_cards, 5, rng);
+        for(int j = 0; j < 5; j++) board[j] = deck[random_vec[j]];
+
+        // The first 5 cards of the hole cards and the turn are those of the flop
+        unsigned short turn_scores[MAX_PLAYERS];
+        for(int i = 0; i < num_players; i++){
+            hand[0] = players_cards[i][0];
+            hand[1] = players_cards[i][1];
+            for(int j = 0; j < 4; j++) hand[j + 2] = board[j];
+            scores[i] = get_score(hand);
+            turn_scores[i] = get_score6(hand);
+        }
+        tally_game(scores, num_players, &thread->counters[0]);
+        tally_game(turn_scores, num_players, &thread->counters[1]);
+
+        eval_board_t board_state = eval_prepare(board);
+        for(int i = 0; i < num_players; i++){
+            scores[i] = eval_with_hole(&board_state, players_cards[i][0], players_cards[i][1]);
+        }
+        tally_game(scores, num_players, &thread->counters[2]);
+    }
+    thread->num_runouts += num_games;
+}
+
+
+/**
+ * @brief Body of a thread of simulate_player_sweep(). It simulates the games assigned to the thread over its own copy
+ * of the deck.
+ *
+ * @param arg Pointer to the sweep_thread_t of the thread.
+ * @return NULL.
+ */
+void *sweep_thread(void *arg){
+    sweep_thread_t *thread = (sweep_thread_t *) arg;
+    const game_setup_t *setup = (const game_setup_t *) thread->share.work;
+
+    int random_vec[TOTAL_CARDS]; // Deck of the thread
+    memcpy(random_vec, setup->unknown_cards, setup->num_unknown_cards * sizeof(int));
+
+    memset(&thread->counters, 0, sizeof(game_counters_t));
+    memset(thread->sweep_wins, 0, sizeof(thread->sweep_wins));
+    memset(thread->sweep_draws, 0, sizeof(thread->sweep_draws));
+    play_sweep_games(setup, random_vec, thread->share.num_games, &thread->share.rng, thread);
+
+    return NULL;
+}
+
+
+/**
+ * @brief Addition of the counters of a thread of simulate_player_sweep() into those of another one.
+ *
+ * @param total Pointer to the sweep_thread_t where the counters are added.
+ * @param thread Pointer to the sweep_thread_t whose counters are added.
+ */
+void merge_sweep(void *total, const void *thread){
+    sweep_thread_t *sweep = (sweep_thread_t *) total;
+    const sweep_thread_t *other = (const sweep_thread_t *) thread;
+    const game_setup_t *setup = (const game_setup_t *) sweep->share.work;
+
+    add_counters(&sweep->counters, &other->counters, setup->num_players);
+    for(int p = 0; p < setup->num_players; p++){
+        sweep->sweep_wins[p] += other->sweep_wins[p];
+        sweep->sweep_draws[p] += other->sweep_draws[p];
+    }
+}
+
+
+/**
+ * @brief Simulation of the games of simulate_player_sweep(). Every game deals the largest table, and the opponents
+ * are scored in order while the best score among the first k of them is kept: the player wins against them if it
+ * beats that score and ties if it matches it.
+ *
+ * @param setup Setup of the largest table.
+ * @param random_vec Deck of unknown cards, the dealt cards are moved to its first positions in every game.
+ * @param num_games Number of games to simulate.
+ * @param rng Random number generator of the thread.
+ * @param thread Thread whose counters are updated.
+ */
+void play_sweep_games(const game_setup_t *setup, int random_vec[], int num_games, rng_t *rng, sweep_thread_t *thread){
+    int num_players = setup->num_players;
+    int num_dealt_cards = 2 * (num_players - 1) + 5 - setup->num_board_cards;
+    int players_cards[MAX_PLAYERS][2];
+    int board[5];
+    game_counters_t *counters = &thread->counters;
+
+    players_cards[0][0] = deck[setup->players_cards[0][0]];
+    players_cards[0][1] = deck[setup->players_cards[0][1]];
+    for(int j = 0; j < setup->num_board_cards; j++) board[j] = deck[setup->board_cards[j]];
+
+    for(int it = 0; it < num_games; it++){
+        deal_game(setup, random_vec, num_dealt_cards, rng, players_cards, board);
+
+        eval_board_t board_state = eval_prepare(board);
+        unsigned short score = eval_with_hole(&board_state, players_cards[0][0], players_cards[0][1]);
+        unsigned short best_opponent = USHRT_MAX;
+        counters->num_of_hand_types[0][score_hand_to_num[score]]++;
+
+        for(int k = 1; k < num_players; k++){
+            unsigned short opponent = eval_with_hole(&board_state, players_cards[k][0], players_cards[k][1]);
+            if(opponent < best_opponent) best_opponent = opponent;
+            counters->num_of_hand_types[k][score_hand_to_num[opponent]]++;
+            thread->sweep_wins[k] += (score < best_opponent);
+            thread->sweep_draws[k] += (score == best_opponent);
+        }
+    }
+    counters->num_of_games += num_games;
+}
 
-        for(int player_i = 0; player_i < num_players; player_i++){
 
-            int seven_card_hand[7];
-            
-            /* We put the cards of the player we are processing into our hand */
+/**
+ * @brief Body of a thread of an Omaha simulation. It enumerates its share of the boards, or simulates its games over
+ * its own copy of the deck.
+ *
+ * @param arg Pointer to the omaha_thread_t of the thread.
+ * @return NULL.
+ */
+void *omaha_thread(void *arg){
+    omaha_thread_t *thread = (omaha_thread_t *) arg;
+    const omaha_setup_t *setup = (const omaha_setup_t *) thread->share.work;
+    const game_setup_t *game = &setup->game;
 
-            seven_card_hand[0] = players_cards[player_i][0];
-            seven_card_hand[1] = players_cards[player_i][1];
+    memset(&thread->counters, 0, sizeof(game_counters_t));
 
-            /* We collect the cards on the table (if there are any) into the hand */
+    if(thread->share.exact){
+        enumerate_omaha_boards(setup, thread);
+        return NULL;
+    }
 
-            for(int j = 2; j < num_known_cards;j++){
-                seven_card_hand[j] = known_cards_num[j];
-            }
+    int random_vec[TOTAL_CARDS]; // Deck of the thread
+    memcpy(random_vec, game->unknown_cards, game->num_unknown_cards * sizeof(int));
+    play_omaha_games(setup, random_vec, thread->share.num_games, &thread->share.rng, &thread->counters);
 
-            /* If there are cards missing to complete a 7-card hand, we add some from the random vector */
+    return NULL;
+}
 
-            for(int j = num_known_cards, k = 0; j < 7; j++, k++){
-                // It is important that all players receive the same cards at this point
-                seven_card_hand[j] = random_vec[given_cards + k];
-            }
 
-            /* We calculate the score of the hand for each group of 5 cards from the 7-card hand of player_i */
-            
-            int cards[5];
-            int player_i_best_hand;
-            
+/**
+ * @brief Addition of the counters of a thread of an Omaha simulation into those of another one.
+ *
+ * @param total Pointer to the omaha_thread_t where the counters are added.
+ * @param thread Pointer to the omaha_thread_t whose counters are added.
+ */
+void merge_omaha(void *total, const void *thread){
+    omaha_thread_t *omaha = (omaha_thread_t *) total;
+    const omaha_setup_t *setup = (const omaha_setup_t *) omaha->share.work;
 
-            for(int i = 0; i < PERMUTATIONS; i++){
+    add_counters(&omaha->counters, &((const omaha_thread_t *) thread)->counters, setup->game.num_players);
+}
 
-                
-                
-                for(int j = 0; j < 5;j++){
-                    cards[j] = deck[seven_card_hand[groups_5[i][j]]];
-                }
-                
 
-                int rank = get_score(cards);
+/**
+ * @brief Simulation of Omaha games. In every game only the cards the game consumes are dealt from the deck: four
+ * cards for every player whose cards are unknown and the missing community cards.
+ *
+ * @param setup Setup of the games.
+ * @param random_vec Deck of unknown cards, the dealt cards are moved to its first positions in every game.
+ * @param num_games Number of games to simulate.
+ * @param rng Random number generator of the thread.
+ * @param counters Counters of wins, ties and hand types of each player.
+ */
+void play_omaha_games(const omaha_setup_t *setup, int random_vec[], int num_games, rng_t *rng, game_counters_t *counters){
+    const game_setup_t *game = &setup->game;
+    int num_dealt_cards = OMAHA_HOLE_CARDS * (game->num_players - game->num_known_players) + 5 - game->num_board_cards;
+    int players_cards[OMAHA_MAX_PLAYERS][OMAHA_HOLE_CARDS];
+    int board[5];
+
+    for(int i = 0; i < game->num_known_players; i++){
+        for(int j = 0; j < OMAHA_HOLE_CARDS; j++) players_cards[i][j] = deck[setup->players_cards[i][j]];
+    }
+    for(int j = 0; j < game->num_board_cards; j++) board[j] = deck[game->board_cards[j]];
 
-                if(rank < player_i_best_score[player_i]){
-                    player_i_best_score[player_i] = rank;
-                    player_i_best_hand = i;
-                }
+    for(int it = 0; it < num_games; it++){
+        deal_cards(random_vec, game->num_unknown_cards, num_dealt_cards, rng);
 
-            }
+        int given_cards = 0;
+        for(int i = game->num_known_players; i < game->num_players; i++){
+            for(int j = 0; j < OMAHA_HOLE_CARDS; j++) players_cards[i][j] = deck[random_vec[given_cards++]];
+        }
+        for(int j = game->num_board_cards; j < 5; j++){
+            board[j] = deck[random_vec[given_cards++]];
+        }
 
-            if(player_i == 0){
-                num_of_hand_types_user[score_hand_to_num[player_i_best_score[player_i]]]++;
-            } else {
-                num_of_hand_types_opponents[score_hand_to_num[player_i_best_score[player_i]]]++;
-            }
+        tally_omaha_game(setup, players_cards, board, counters);
+    }
+}
 
-            if(player_i_best_score[player_i] < best_score_game){
-                best_score_game = player_i_best_score[player_i];
-                winner = player_i;
-            }
-            
-            
-        }
 
-        /* We sum up the wins and ties */
+/**
+ * @brief Exact enumeration of the missing community cards of an Omaha spectator's spot. The boards are numbered in
+ * lexicographic order of the positions of their cards in the deck of unknown cards, and the thread scores those
+ * whose number modulo num_threads is its own.
+ *
+ * @param setup Setup of the spot, with the cards of every player known.
+ * @param thread Thread whose counters are updated.
+ */
+void enumerate_omaha_boards(const omaha_setup_t *setup, omaha_thread_t *thread){
+    const game_setup_t *game = &setup->game;
+    int num_missing = 5 - game->num_board_cards;
+    int n = game->num_unknown_cards;
+    int players_cards[OMAHA_MAX_PLAYERS][OMAHA_HOLE_CARDS];
+    int board[5];
+    int positions[5];
+
+    for(int i = 0; i < game->num_players; i++){
+        for(int j = 0; j < OMAHA_HOLE_CARDS; j++) players_cards[i][j] = deck[setup->players_cards[i][j]];
+    }
+    for(int j = 0; j < game->num_board_cards; j++) board[j] = deck[game->board_cards[j]];
+    for(int j = 0; j < num_missing; j++) positions[j] = j;
 
-        int num_of_winners = 0;
-        for(int i = 0; i < num_players;i++){
-            if(player_i_best_score[i] == best_score_game){ num_of_winners++; }
-        }
-        
-        if(num_of_winners == 1){
-            num_of_wins[winner]++;
-        } else {
-            for(int i = 0; i < num_players;i++){
-                if(player_i_best_score[i] == best_score_game){ num_of_draws[i]++; }
-            }
+    for(long board_index = 0; ; board_index++){
+        if(board_index % thread->share.num_threads == thread->share.thread){
+            for(int j = 0; j < num_missing; j++) board[game->num_board_cards + j] = deck[game->unknown_cards[positions[j]]];
+            tally_omaha_game(setup, players_cards, board, &thread->counters);
         }
 
-        
-        
+        // Next combination of positions
+        int j = num_missing - 1;
+        while(j >= 0 && positions[j] == n - num_missing + j) j--;
+        if(j < 0) break;
+        positions[j]++;
+        for(int k = j + 1; k < num_missing; k++) positions[k] = positions[k - 1] + 1;
     }
+}
 
 
-    
-    // probabilities[0][0] = % victory
-    // probabilities[0][1] = % defeat
-    // probabilities[0][2] = % tie
-    
-    probabilities[0][0] = ((double) num_of_wins[0] / (double) num_games) * 100.0;
-    probabilities[0][1] = ((double) (num_games - num_of_wins[0] - num_of_draws[0]) / (double) num_games) * 100.0;
-    probabilities[0][2] = ((double) num_of_draws[0] / (double) num_games) * 100.0;
+/**
+ * @brief Scoring of an Omaha game: the board is prepared once with omaha_prepare() and every player's best hand is
+ * scored with omaha_eval_with_hole().
+ *
+ * @param setup Setup of the games.
+ * @param players_cards Cactus Kev encoded cards of every player.
+ * @param board Cactus Kev encoded community cards.
+ * @param counters Counters of wins, ties and hand types of each player.
+ */
+static inline void tally_omaha_game(const omaha_setup_t *setup, int players_cards[][OMAHA_HOLE_CARDS], const int board[5], game_counters_t *counters){
+    unsigned short scores[OMAHA_MAX_PLAYERS];
+    omaha_board_t board_state = omaha_prepare(board);
 
-    for(int i = 0; i < NUM_OF_HAND_TYPES;i++){
-        probabilities[0][i + 3] = ((double) num_of_hand_types_user[i] / (double) num_games) * 100.0;
-        probabilities[1][i + 3] = (((double) num_of_hand_types_opponents[i] / (double) (num_players - 1)) / (double) num_games) * 100.0;
+    for(int i = 0; i < setup->game.num_players; i++){
+        scores[i] = omaha_eval_with_hole(&board_state, players_cards[i]);
     }
+    tally_game(scores, setup->game.num_players, counters);
+}
 
 
-    return probabilities;
+/**
+ * @brief Body of a thread of simulate_holdings(). It simulates the samples assigned to the thread over its own copy
+ * of the deck.
+ *
+ * @param arg Pointer to the holdings_thread_t of the thread.
+ * @return NULL.
+ */
+void *holdings_thread(void *arg){
+    holdings_thread_t *thread = (holdings_thread_t *) arg;
+    const holdings_t *holdings = (const holdings_t *) thread->share.work;
+    const game_setup_t *setup = holdings->setup;
+
+    int random_vec[TOTAL_CARDS]; // Deck of the thread
+    memcpy(random_vec, setup->unknown_cards, setup->num_unknown_cards * sizeof(int));
 
+    memset(thread->counters, 0, sizeof(thread->counters));
+    play_holdings(setup, holdings, random_vec, thread->share.num_games, &thread->share.rng, thread->counters);
 
+    return NULL;
 }
 
 
 /**
- * @brief Calculation of the probability of winning, losing, and tying for each player from a spectator's perspective.
- * The spectator is aware of the cards held by all the players and those on the table.
- *
- * Probabilities are derived from simulating poker games. Games are played with all the active players' cards and the
- * community cards, discarding the cards of players who have folded from the deck and randomly selecting the community
- * cards that have not yet appeared.
+ * @brief Addition of the counters of every holding of a thread of simulate_holdings() into those of another one.
  *
- * @param player_cards Cards of the active players. players_cards[0..1] = first player's cards,
- * players_cards[2..3] = second player's cards, and so on.
- * @param board_cards Community cards.
- * @param discarded_cards Discarded cards. These are the cards that were in the hands of players who
- * no longer play (have folded).
- * @param num_discarded_cards Number of discarded cards.
- * @param num_board_cards Number of community cards.
- * @param num_players Number of players.
- * @param num_games Number of games to simulate.
- * @return A matrix with as many rows as there are players and three columns. In row "i," you will find the probabilities
- * of winning (rtn[i][0]), losing (rtn[i][1]), and tying (rtn[i][2]) for player "i." and for rtn[i][3...11] the probabilities
- * of having each of the different types of poker hands.
+ * @param total Pointer to the holdings_thread_t where the counters are added.
+ * @param thread Pointer to the holdings_thread_t whose counters are added.
  */
-double** simulate_spectator(char* players_cards[], char* board_cards[], char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games){
+void merge_holdings(void *total, const void *thread){
+    holding_counters_t *counters = ((holdings_thread_t *) total)->counters;
+    const holding_counters_t *thread_counters = ((const holdings_thread_t *) thread)->counters;
+    const holdings_t *holdings = (const holdings_t *) ((holdings_thread_t *) total)->share.work;
+
+    for(int h = 0; h < holdings->num_holdings; h++){
+        counters[h].num_of_games += thread_counters[h].num_of_games;
+        counters[h].num_of_wins += thread_counters[h].num_of_wins;
+        counters[h].num_of_draws += thread_counters[h].num_of_draws;
+        for(int j = 0; j < NUM_OF_HAND_TYPES; j++){
+            counters[h].num_of_hand_types[j] += thread_counters[h].num_of_hand_types[j];
+        }
+    }
+}
 
-    // Memory allocation for the probabilities
 
-    /*  
-        [...][0] Victory
-        [...][1] Defeat
-        [...][2] Tie
+/**
+ * @brief Simulation of the samples of simulate_holdings(). Every sample deals the opponents' cards and the missing
+ * community cards, prepares the board once and scores the opponents once. Every holding that does not use a dealt
+ * card then plays the game: it wins if it beats the best opponent and ties if it matches it.
+ *
+ * @param setup Setup of the opponents.
+ * @param holdings Hero holdings.
+ * @param random_vec Deck of unknown cards, the dealt cards are moved to its first positions in every sample.
+ * @param num_games Number of samples.
+ * @param rng Random number generator of the thread.
+ * @param counters Counters of every holding.
+ */
+void play_holdings(const game_setup_t *setup, const holdings_t *holdings, int random_vec[], int num_games, rng_t *rng, holding_counters_t counters[]){
+    int num_opponents = setup->num_players;
+    int num_dealt_cards = 2 * num_opponents + 5 - setup->num_board_cards;
+    int players_cards[MAX_PLAYERS][2];
+    int board[5];
 
-        [...][3] Straight Flush
-        [...][4] Four of a Kind
-        [...][5] Full Houses
-        [...][6] Flush
-        [...][7] Straight
-        [...][8] Three of a Kind
-        [...][9] Two Pair
-        [...][10] One Pair
-        [...][11] High Card
-     */
+    for(int j = 0; j < setup->num_board_cards; j++) board[j] = deck[setup->board_cards[j]];
 
+    for(int it = 0; it < num_games; it++){
+        deal_game(setup, random_vec, num_dealt_cards, rng, players_cards, board);
 
-    
-    double** probabilities = (double**) malloc(num_players * sizeof(double*));
-    for(int i = 0; i < num_players;i++) probabilities[i] = (double*) malloc((3 + NUM_OF_HAND_TYPES) * sizeof(double));
+        uint64_t dealt_mask = 0;
+        for(int j = 0; j < num_dealt_cards; j++) dealt_mask |= 1ULL << random_vec[j];
 
+        eval_board_t board_state = eval_prepare(board);
+        unsigned short best_opponent = USHRT_MAX;
+        for(int i = 0; i < num_opponents; i++){
+            unsigned short score = eval_with_hole(&board_state, players_cards[i][0], players_cards[i][1]);
+            if(score < best_opponent) best_opponent = score;
+        }
 
-    srand (time(NULL));
+        for(int h = 0; h < holdings->num_holdings; h++){
+            if(holdings->masks[h] & dealt_mask) continue;
 
-    
-    int num_known_cards = num_players * 2 + num_board_cards + num_discarded_cards;
-    
-    int num_unknown_cards = TOTAL_CARDS - num_known_cards; 
-    
-    int players_cards_num[num_players][2];
-    int board_cards_num[num_board_cards];
-    int discarded_cards_num[num_discarded_cards];
-    int seven_card_hand[num_players][7];
+            unsigned short score = eval_with_hole(&board_state, holdings->cards[h][0], holdings->cards[h][1]);
+            counters[h].num_of_games++;
+            counters[h].num_of_wins += (score < best_opponent);
+            counters[h].num_of_draws += (score == best_opponent);
+            counters[h].num_of_hand_types[score_hand_to_num[score]]++;
+        }
+    }
+}
 
 
-    /* We convert the cards strings into integers from 0 to 51 */
-    /* We add to each player's hand of 7 cards the cards that are known */
+/**
+ * @brief Dealing of the cards of a game. Only the cards the game consumes are dealt from the deck, to its first
+ * positions: two cards for every player whose cards are unknown and the missing community cards.
+ *
+ * @param setup Setup of the games.
+ * @param random_vec Deck of unknown cards.
+ * @param num_dealt_cards Number of cards the game consumes.
+ * @param rng Random number generator of the thread.
+ * @param players_cards Cactus Kev encoded cards of every player, those of the players with unknown cards are replaced.
+ * @param board Cactus Kev encoded community cards, the missing ones are replaced.
+ */
+static inline void deal_game(const game_setup_t *setup, int random_vec[], int num_dealt_cards, rng_t *rng, int players_cards[][2], int board[5]){
 
+    /* We deal the cards of this game to the first positions of the deck */
 
-    for(int i = 0; i < num_discarded_cards;i++){
-        discarded_cards_num[i] = cardtype_to_num(discarded_cards[i]);
-    }
+    deal_cards(random_vec,setup->num_unknown_cards,num_dealt_cards,rng);
 
-    for(int i = 0; i < (num_players);i++){
-        players_cards_num[i][0] = cardtype_to_num(players_cards[i * 2]);
-        players_cards_num[i][1] = cardtype_to_num(players_cards[i * 2 + 1]);
-        seven_card_hand[i][0] = players_cards_num[i][0];
-        seven_card_hand[i][1] = players_cards_num[i][1];
-    }
+    /* Dealing cards to the players whose cards are unknown */
 
-    for(int i = 0; i < num_board_cards;i++){
-        board_cards_num[i] = cardtype_to_num(board_cards[i]);
-        for(int j = 0; j < num_players;j++){
-            seven_card_hand[j][i + 2] = board_cards_num[i];
-        }
+    int given_cards = 0;
+
+    for(int i = setup->num_known_players; i < setup->num_players;i++){
+        players_cards[i][0] = deck[random_vec[given_cards++]];
+        players_cards[i][1] = deck[random_vec[given_cards++]];
     }
 
+    /* If there are community cards missing, we add some from the random vector */
+    // It is important that all players receive the same cards at this point
 
-    
+    for(int j = setup->num_board_cards; j < 5; j++){
+        board[j] = deck[random_vec[given_cards++]];
+    }
+}
 
-    /* Create a deck with all the cards except the ones the spectator knows */
 
-    int random_vec[num_unknown_cards]; // Deck
-    for(int i = 0, founded = 0; i < TOTAL_CARDS; i++){
-        char equal = 0;
-        for(int j = 0; j < (num_board_cards);j++){
-            if(board_cards_num[j] == i){
-                equal = 1;
-                founded++;
-                break;
-            }
-        }
-        if(equal == 0){
-            for(int j = 0; j < (num_players);j++){
-                if(players_cards_num[j][0] == i || players_cards_num[j][1] == i){
-                    equal = 1;
-                    founded++;
-                    break;
-                }
-            }
-        }
-        if(equal == 0){
-            for(int j = 0; j < (num_discarded_cards);j++){
-                if(discarded_cards_num[j] == i){
-                    equal = 1;
-                    founded++;
-                    break;
-                }
-            }   
+/**
+ * @brief Dealing of the cards of a game with ranges. Every player with a range receives a combo of it, whose cards
+ * are swapped to the first positions of the deck. The cards of the players without range and the missing community
+ * cards are then dealt to the next positions, as in deal_game().
+ *
+ * @param setup Setup of the games.
+ * @param random_vec Deck of unknown cards.
+ * @param positions Position of every card in random_vec, kept up to date.
+ * @param num_dealt_cards Number of random cards the game consumes, besides those of the ranges.
+ * @param rng Random number generator of the thread.
+ * @param players_cards Cactus Kev encoded cards of every player, those of the players with unknown cards are replaced.
+ * @param board Cactus Kev encoded community cards, the missing ones are replaced.
+ */
+static inline void deal_ranged_game(const game_setup_t *setup, int random_vec[], unsigned char positions[], int num_dealt_cards, rng_t *rng, int players_cards[][2], int board[5]){
+    int combos[MAX_PLAYERS];
+    int given_cards = 0;
+
+    draw_range_combos(setup, rng, combos);
+
+    /* The cards of the ranges are swapped to the first positions of the deck */
+
+    for(int i = setup->num_known_players; i < setup->num_players; i++){
+        if(setup->ranges[i] == NULL) continue;
+        for(int j = 0; j < 2; j++){
+            int card = setup->ranges[i]->cards[combos[i]][j];
+            int from = positions[card], other = random_vec[given_cards];
+            random_vec[given_cards] = card;
+            random_vec[from] = other;
+            positions[card] = (unsigned char) given_cards;
+            positions[other] = (unsigned char) from;
+            players_cards[i][j] = deck[card];
+            given_cards++;
         }
-        
-        if(equal == 0) random_vec[i - founded] = i;
-        
     }
 
+    /* The rest of the cards are dealt after them, keeping track of their positions */
 
+    int n = setup->num_unknown_cards;
+    for(int i = given_cards; i < given_cards + num_dealt_cards && i + 1 < n; i++){
+        int j = i + (int) rng_bounded(rng, (uint32_t) (n - i));
+        int t = random_vec[j];
+        random_vec[j] = random_vec[i];
+        random_vec[i] = t;
+        positions[random_vec[i]] = (unsigned char) i;
+        positions[random_vec[j]] = (unsigned char) j;
+    }
 
-    /* --- Game simulations --- */
-
-    int num_of_wins[num_players];
-    int num_of_draws[num_players];
-    int num_of_hand_types[num_players][NUM_OF_HAND_TYPES];
-    for(int i = 0; i < num_players; i++){
-        num_of_wins[i] = 0;
-        num_of_draws[i] = 0;
-        for(int j = 0; j < NUM_OF_HAND_TYPES;j++) num_of_hand_types[i][j] = 0;
-    } 
-
-
-    for(int it = 0; it < num_games;it++){
+    for(int i = setup->num_known_players; i < setup->num_players; i++){
+        if(setup->ranges[i] != NULL) continue;
+        players_cards[i][0] = deck[random_vec[given_cards++]];
+        players_cards[i][1] = deck[random_vec[given_cards++]];
+    }
 
-        // We shuffle the deck
-        shuffle(random_vec,num_unknown_cards);
+    for(int j = setup->num_board_cards; j < 5; j++){
+        board[j] = deck[random_vec[given_cards++]];
+    }
+}
 
 
-        
+/**
+ * @brief Drawing of a combo for every player with a range, such that no two players share a card. All the combos
+ * are drawn from the alias tables and the deal is drawn again while they overlap, which gives exactly the
+ * distribution of the ranges conditioned on the cards being different.
+ *
+ * @param setup Setup of the games, with ranges that can be dealt (see ranges_dealable()).
+ * @param rng Random number generator of the thread.
+ * @param combos Where the combo of every player with a range is stored, combos[i] for player i.
+ */
+static inline void draw_range_combos(const game_setup_t *setup, rng_t *rng, int combos[]){
+    while(!try_range_combos(setup, rng, combos));
+}
 
-       /* Calculating the best hand (score) for each player and the winner */
 
-        unsigned short best_score_game = 0xFFFF;
-        unsigned short player_i_best_score[num_players];
-        for(int i = 0; i < num_players;i++) player_i_best_score[i] = 0xFFFF;
-        int winner = -1;
+/**
+ * @brief A single deal of the ranges: a combo for every player with a range, drawn from its alias table.
+ *
+ * @param setup Setup of the games.
+ * @param rng Random number generator.
+ * @param combos Where the combo of every player with a range is stored, combos[i] for player i.
+ * @return 1 if no two players share a card, 0 if the deal must be rejected.
+ */
+static inline int try_range_combos(const game_setup_t *setup, rng_t *rng, int combos[]){
+    uint64_t used_cards = 0;
+    for(int i = setup->num_known_players; i < setup->num_players; i++){
+        const range_sampler_t *sampler = setup->ranges[i];
+        if(sampler == NULL) continue;
+        combos[i] = draw_alias(sampler, rng);
+        if(sampler->masks[combos[i]] & used_cards) return 0;
+        used_cards |= sampler->masks[combos[i]];
+    }
+    return 1;
+}
 
-        for(int player_i = 0; player_i < num_players; player_i++){
 
+/**
+ * @brief Drawing of a combo from the alias table of a range: a random column, then either its combo or its alias.
+ *
+ * @param sampler Sampler of the range.
+ * @param rng Random number generator of the thread.
+ * @return Position of the combo in the sampler.
+ */
+static inline int draw_alias(const range_sampler_t *sampler, rng_t *rng){
+    int column = (int) rng_bounded(rng, (uint32_t) sampler->num_combos);
+    return ((uint64_t) rng_next32(rng) < sampler->thresholds[column]) ? column : sampler->aliases[column];
+}
 
-            /* If there are cards left to complete the hand of 7 cards, we add some from the random vector. */
 
-            for(int j = (num_board_cards + 2), k = 0; j < 7; j++, k++){
-                // It is important that all players receive the same cards at this point
-                seven_card_hand[player_i][j] = random_vec[k];
-            }
+/**
+ * @brief Whether the ranges can be dealt by rejection in reasonable time. Up to RANGE_PROBE_DEALS deals are drawn
+ * with a fixed seed, so that the answer does not depend on the seed of the simulation, and at least
+ * RANGE_MIN_ACCEPTED of them must be accepted. The probe stops as soon as they are, which takes a few hundred deals
+ * for most ranges.
+ *
+ * @param setup Setup of the games.
+ * @return 1 if the ranges can be dealt, 0 if they never or almost never can.
+ */
+int ranges_dealable(const game_setup_t *setup){
+    int combos[MAX_PLAYERS];
+    rng_t rng;
+    int accepted = 0;
+
+    rng_seed(&rng, RNG_XOSHIRO256SS, RANGE_PROBE_SEED, 0);
+    for(int i = 0; i < RANGE_PROBE_DEALS && accepted < RANGE_MIN_ACCEPTED; i++){
+        accepted += try_range_combos(setup, &rng, combos);
+    }
+    return accepted >= RANGE_MIN_ACCEPTED;
+}
 
-            /* We calculate the score of the hand for each group of 5 cards from the 7-card hand of player_i*/
-            
-            int cards[5];
-            int player_i_best_hand;
-            
 
-            for(int i = 0; i < PERMUTATIONS; i++){
-                
-                for(int j = 0; j < 5;j++){
-                    cards[j] = deck[seven_card_hand[player_i][groups_5[i][j]]];
-                }
+/**
+ * @brief Addition of the result of a game to the counters: hand type of every player, and the winner or the players
+ * that tie.
+ *
+ * @param player_i_best_score Score of the best hand of every player.
+ * @param num_players Number of players.
+ * @param counters Counters where the result of the game is added.
+ */
+static inline void tally_game(const unsigned short player_i_best_score[], int num_players, game_counters_t *counters){
+    tally_weighted_game(player_i_best_score, num_players, 1, counters);
+}
 
-                int rank = get_score(cards);
 
-                if(rank < player_i_best_score[player_i]){
-                    player_i_best_score[player_i] = rank;
-                    player_i_best_hand = i;
-                }
+/**
+ * @brief Addition of the result of a game that stands for several games to the counters, see tally_game().
+ *
+ * @param player_i_best_score Score of the best hand of every player.
+ * @param num_players Number of players.
+ * @param weight Number of games with this result.
+ * @param counters Counters where the result of the games is added.
+ */
+static inline void tally_weighted_game(const unsigned short player_i_best_score[], int num_players, int weight, game_counters_t *counters){
 
-            }
+   /* We find the best hand (score) of the game and the winner. */
 
-            num_of_hand_types[player_i][score_hand_to_num[player_i_best_score[player_i]]]++;
+    unsigned short best_score_game = 0xFFFF;
+    int winner = -1;
 
-            if(player_i_best_score[player_i] < best_score_game){
-                best_score_game = player_i_best_score[player_i];
-                winner = player_i;
-            }
-            
-        }
+    for(int player_i = 0; player_i < num_players; player_i++){
 
-        /* We sum up the wins and ties */
+        counters->num_of_hand_types[player_i][score_hand_to_num[player_i_best_score[player_i]]] += weight;
 
-        int num_of_winners = 0;
-        for(int i = 0; i < num_players;i++){
-            if(player_i_best_score[i] == best_score_game){ num_of_winners++; }
-        }
-        
-        if(num_of_winners == 1){
-            num_of_wins[winner]++;
-        } else {
-            for(int i = 0; i < num_players;i++){
-                if(player_i_best_score[i] == best_score_game){ num_of_draws[i]++; }
-            }
+        if(player_i_best_score[player_i] < best_score_game){
+            best_score_game = player_i_best_score[player_i];
+            winner = player_i;
         }
-
-
-        
     }
 
+    /* We sum up the wins and ties */
+
+    int num_of_winners = 0;
     for(int i = 0; i < num_players;i++){
-        probabilities[i][0] = ((double) num_of_wins[i] / (double) num_games) * 100.0;
-        probabilities[i][1] = ((double) (num_games - num_of_wins[i] - num_of_draws[i]) / (double) num_games) * 100.0;
-        probabilities[i][2] = ((double) num_of_draws[i] / (double) num_games) * 100.0;
-        for(int j = 0; j < NUM_OF_HAND_TYPES;j++){
-            probabilities[i][j + 3] = ((double) num_of_hand_types[i][j] / (double) num_games) * 100.0;
+        if(player_i_best_score[i] == best_score_game){ num_of_winners++; }
+    }
+    
+    if(num_of_winners == 1){
+        counters->num_of_wins[winner] += weight;
+    } else {
+        for(int i = 0; i < num_players;i++){
+            if(player_i_best_score[i] == best_score_game){ counters->num_of_draws[i] += weight; }
         }
     }
 
-    return probabilities;
-
-
+    counters->num_of_games += weight;
 }
 
 
@@ -518,7 +3414,8 @@ double** simulate_spectator(char* players_cards[], char* board_cards[], char* di
  * @brief  Necessary initializations for the proper functioning of the simulator.
  * Initialization of tables and the encoded deck.
  *  
- * @param  csv_file Address of the CSV file where equivalence classes of hands are stored.
+ * @param  csv_file Address of the CSV file where equivalence classes of hands are stored. NULL to use the tables
+ * compiled into the program (see tools/generate_tables.c), which needs no file and is almost instantaneous.
  * @return -1 if reading csv_file fails, 0 if success.
  */
 int init_simulator(const char *csv_file){
@@ -665,25 +3562,217 @@ int cardtype_to_num(char* card_type){
 
 
 /**
- *  @brief  Shuffles an array of ints, using the benpfaff's method:
- *  https://benpfaff.org/writings/clc/shuffle.html
+ *  @brief  Deals k random cards from a deck with a partial Fisher-Yates shuffle: only the first k positions are
+ *  drawn, with rng_bounded(), so the cost grows with the dealt cards and not with the size of the deck.
+ *  The deck is left as a permutation of its cards, and a partial shuffle of any permutation gives a uniformly
+ *  random sequence of k cards, so it does not need to be restored between games.
  * 
- * @param array array to be sorted
- * @param  n  size of the array to be sorted
+ * @param array deck of cards, the dealt cards are left in array[0..k-1]
+ * @param  n  size of the deck
+ * @param  k  number of cards to deal, at most n
+ * @param  rng random number generator
  */
-void shuffle(int *array, size_t n)
+void deal_cards(int *array, size_t n, size_t k, rng_t *rng)
 {
-    if (n > 1) 
+    for (size_t i = 0; i < k && i + 1 < n; i++) 
     {
-        size_t i;
-        for (i = 0; i < n - 1; i++) 
-        {
-          size_t j = i + rand() / (RAND_MAX / (n - i) + 1);
-          int t = array[j];
-          array[j] = array[i];
-          array[i] = t;
+        size_t j = i + rng_bounded(rng, (uint32_t) (n - i));
+        int t = array[j];
+        array[j] = array[i];
+        array[i] = t;
+    }
+}
+
+
+/**
+ *  @brief  Default options of a simulation: automatic choice between exact enumeration and Monte Carlo,
+ *  fixed number of games, one thread, xoshiro256** generator seeded from the clock, no variance reduction and no
+ *  progress callback.
+ *
+ * @param options Options to initialize.
+ */
+void sim_default_options(sim_options_t *options){
+    options->method = SIM_METHOD_AUTO;
+    options->target_std_error = 0.0;
+    options->num_threads = 1;
+    options->rng = RNG_XOSHIRO256SS;
+    options->seed = SIM_SEED_FROM_CLOCK;
+    options->variance_reduction = SIM_VR_NONE;
+    options->progress = NULL;
+    options->progress_data = NULL;
+    options->progress_games = 0;
+    options->progress_ms = 0.0;
+}
+
+
+/**
+ * @brief Creation of an arena for the simulations that write into a result owned by the caller, see
+ * simulate_player_ranges_into(). It is the only allocation they need, so a caller that keeps an arena per thread
+ * makes the steady state of its simulations free of allocations.
+ *
+ * @return Arena, NULL if it can not be allocated.
+ */
+sim_arena_t *sim_arena_create(){
+    return (sim_arena_t *) malloc(sizeof(sim_arena_t));
+}
+
+
+/**
+ * @brief Release of an arena created by sim_arena_create().
+ *
+ * @param arena Arena to free. It can be NULL.
+ */
+void sim_arena_destroy(sim_arena_t *arena){
+    free(arena);
+}
+
+
+/**
+ * @brief Arena of the calling thread, created by the first call of the thread and freed when it exits.
+ *
+ * @return Arena of the thread, NULL if it can not be allocated.
+ */
+sim_arena_t *thread_arena(){
+    static pthread_once_t key_once = PTHREAD_ONCE_INIT;
+    pthread_once(&key_once, create_arena_key);
+
+    sim_arena_t *arena = (sim_arena_t *) pthread_getspecific(arena_key);
+    if(arena == NULL){
+        arena = sim_arena_create();
+        if(arena != NULL && pthread_setspecific(arena_key, arena) != 0){
+            sim_arena_destroy(arena);
+            arena = NULL;
+        }
+    }
+    return arena;
+}
+
+
+/**
+ * @brief Creation of the key of the arenas of the threads, whose destructor frees the arena of a thread that exits.
+ */
+void create_arena_key(){
+    pthread_key_create(&arena_key, (void (*)(void *)) sim_arena_destroy);
+}
+
+
+/**
+ *  @brief  Rotation to the left of a 64-bit integer.
+ *
+ * @param x value to rotate
+ * @param k number of bits, in [1,63]
+ * @return Rotated value.
+ */
+static inline uint64_t rotl64(uint64_t x, int k){
+    return (x << k) | (x >> (64 - k));
+}
+
+
+/**
+ *  @brief  SplitMix64 generator, used to expand a 64-bit seed into the state of the other generators.
+ *  https://prng.di.unimi.it/splitmix64.c
+ *
+ * @param x state of the generator
+ * @return Next 64-bit number.
+ */
+static inline uint64_t splitmix64(uint64_t *x){
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+
+/**
+ *  @brief  Initialization of a random number generator.
+ *
+ *  xoshiro256** (https://prng.di.unimi.it/) is seeded with SplitMix64 and then advanced stream * 2^128 numbers with
+ *  its jump function. PCG32 (https://www.pcg-random.org/) uses stream to select its increment.
+ *  Different streams of the same seed never overlap.
+ *
+ * @param rng generator to initialize
+ * @param kind algorithm of the generator
+ * @param seed seed of the generator
+ * @param stream independent stream of the seed, e.g. the number of the thread
+ */
+void rng_seed(rng_t *rng, rng_kind_t kind, uint64_t seed, uint64_t stream){
+    static const uint64_t JUMP[4] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+    rng->kind = kind;
+
+    if(kind == RNG_PCG32){
+        rng->state[0] = 0;
+        rng->state[1] = (stream << 1) | 1;
+        rng_next32(rng);
+        rng->state[0] += splitmix64(&seed);
+        rng_next32(rng);
+        return;
+    }
+
+    for(int i = 0; i < 4; i++) rng->state[i] = splitmix64(&seed);
+
+    for(uint64_t s = 0; s < stream; s++){
+        uint64_t jumped[4] = { 0, 0, 0, 0 };
+        for(int i = 0; i < 4; i++){
+            for(int b = 0; b < 64; b++){
+                if(JUMP[i] & (1ULL << b)){
+                    for(int j = 0; j < 4; j++) jumped[j] ^= rng->state[j];
+                }
+                rng_next32(rng);
+            }
         }
+        for(int j = 0; j < 4; j++) rng->state[j] = jumped[j];
+    }
+}
+
+
+/**
+ *  @brief  Next 32-bit random number of a generator.
+ *
+ * @param rng random number generator
+ * @return Uniform random number in [0, 2^32).
+ */
+uint32_t rng_next32(rng_t *rng){
+    uint64_t *s = rng->state;
+
+    if(rng->kind == RNG_PCG32){
+        uint64_t old_state = s[0];
+        s[0] = old_state * 6364136223846793005ULL + s[1];
+        uint32_t xorshifted = (uint32_t) (((old_state >> 18) ^ old_state) >> 27);
+        uint32_t rot = (uint32_t) (old_state >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
     }
+
+    uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return (uint32_t) (result >> 32);
 }
 
 
+/**
+ *  @brief  Unbiased random number in [0, range), with Lemire's multiply-and-reject method:
+ *  https://arxiv.org/abs/1805.10941
+ *  The rejection only happens with probability (2^32 mod range) / 2^32, tiny for the ranges of a deck.
+ *
+ * @param rng random number generator
+ * @param range upper bound (not included), greater than 0
+ * @return Uniform random number in [0, range).
+ */
+uint32_t rng_bounded(rng_t *rng, uint32_t range){
+    uint64_t m = (uint64_t) rng_next32(rng) * range;
+    uint32_t low = (uint32_t) m;
+    if(low < range){
+        uint32_t threshold = -range % range;
+        while(low < threshold){
+            m = (uint64_t) rng_next32(rng) * range;
+            low = (uint32_t) m;
+        }
+    }
+    return (uint32_t) (m >> 32);
+}
@@ -9,6 +9,152 @@
 
 #pragma once
 #include "hand_evaluator.h"
+#include <stdint.h>
+
+#define MAX_PLAYERS 23 // 23 * 2 hole cards + 5 community cards = 51 cards
+#define NUM_OF_HAND_TYPES 9
+#define SIM_SEED_FROM_CLOCK 0
+
+/* Random number generators available for the simulations */
+
+typedef enum {
+    RNG_XOSHIRO256SS,   // xoshiro256** (default)
+    RNG_PCG32           // PCG32 (XSH RR)
+} rng_kind_t;
+
+typedef struct {
+    uint64_t state[4];
+    rng_kind_t kind;
+} rng_t;
+
+/* Methods to obtain the probabilities */
+
+typedef enum {
+    SIM_METHOD_AUTO,            // Exact enumeration when it is cheaper than the requested games, Monte Carlo otherwise
+    SIM_METHOD_MONTE_CARLO,     // Simulation of random games
+    SIM_METHOD_EXACT,           // Enumeration of all the possible games (Monte Carlo if there are more than INT_MAX)
+    SIM_METHOD_PRECOMPUTED      // Preflop tables loaded by load_preflop_tables(), AUTO if the setup is not in them
+} sim_method_t;
+
+/* Variance reduction of the Monte Carlo method. Every technique estimates the same probabilities with a lower
+   variance per game, reported in sim_info_t. None of them is applied to players with ranges. The values are kept
+   stable because they are stored in the keys of saved result caches: 2 belonged to an antithetic pairing of mirrored
+   deals, which was removed because it never reduced the variance. */
+
+typedef enum {
+    SIM_VR_NONE = 0,            // Plain Monte Carlo
+    SIM_VR_STRATIFIED = 1,      // The games are split evenly among the possible next community cards
+    SIM_VR_CONTROL_VARIATE = 3, // Wins and ties are weighted by the exact probabilities of the hand types of the known players
+    SIM_VR_QUASI_RANDOM = 4     // Cards are dealt from a scrambled Halton sequence with random shifts instead of shuffles
+} sim_variance_reduction_t;
+
+/* Information about how the probabilities of a simulation were obtained */
+
+typedef struct {
+    sim_method_t method;    // SIM_METHOD_MONTE_CARLO, SIM_METHOD_EXACT or SIM_METHOD_PRECOMPUTED
+    int num_games;          // Simulated games, or enumerated games with the exact method
+    double win_std_error[MAX_PLAYERS];  // Standard error of the win probability of each player (percentage points)
+    double tie_std_error[MAX_PLAYERS];  // Standard error of the tie probability of each player (percentage points)
+    sim_variance_reduction_t variance_method;   // Variance reduction applied, SIM_VR_NONE if the spot does not allow it
+    double variance_reduction;  // Variance of plain Monte Carlo over the variance of the estimator, for the win
+                                // probability of player 0 with the same cost: the games plus the hands the
+                                // technique scored to prepare (1 without variance reduction, INFINITY if the
+                                // estimator has no variance)
+} sim_info_t;
+
+/* Callback of a Monte Carlo simulation in progress. It receives the rows of probabilities of the games simulated so
+   far, the same rows the simulation returns, and their information. It returns nonzero to stop the simulation, which
+   then returns the estimate of the games already simulated. It is not called when the result comes from the result
+   cache, the precomputed preflop tables or exact enumeration. */
+
+typedef int (*sim_progress_fn)(double *probabilities[], int num_rows, const sim_info_t *info, void *data);
+
+/* Options of a simulation, see sim_default_options(). simulate_spectator_streets(), simulate_holdings(),
+   simulate_player_sweep() and the Omaha simulations only use the threads, generator and seed of the options, and the
+   method where they can enumerate: there is no target standard error, variance reduction, progress callback, result
+   cache or precomputed table. */
+
+typedef struct {
+    sim_method_t method;    // Method to obtain the probabilities
+    double target_std_error;// If greater than 0, Monte Carlo stops as soon as the standard errors of the win and tie
+                            // probabilities (percentage points) reach it, and num_games is the maximum number of games
+    int num_threads;        // Threads that simulate the games
+    rng_kind_t rng;         // Random number generator of every thread
+    uint64_t seed;          // Seed of the simulation, SIM_SEED_FROM_CLOCK to use a different one in every call
+    sim_variance_reduction_t variance_reduction;    // Variance reduction of Monte Carlo
+    sim_progress_fn progress;   // If not NULL, Monte Carlo calls it with the estimate so far (ignored by simulate_batch())
+    void *progress_data;        // Passed to progress
+    int progress_games;         // Games between two calls to progress, 0 for no limit
+    double progress_ms;         // Milliseconds between two calls to progress, 0 for no limit
+} sim_options_t;
+
+/* Perspective of a scenario of a batch */
+
+typedef enum {
+    SIM_MODE_PLAYER,        // Only the cards of player 0 are known, as in simulate_player()
+    SIM_MODE_SPECTATOR      // The cards of all the players are known, as in simulate_spectator()
+} sim_mode_t;
+
+/* Scenario of a batch, see simulate_batch(). Cards are integers in [0,51], see cardtype_to_num(). */
+
+typedef struct {
+    sim_mode_t mode;
+    int num_players;
+    int num_games;                      // Games to simulate (maximum games with a target standard error)
+    int players_cards[MAX_PLAYERS][2];  // Only players_cards[0] is used with SIM_MODE_PLAYER
+    int board_cards[5];
+    int num_board_cards;
+    uint64_t discarded_cards;           // Bit i set if card i was discarded (SIM_MODE_SPECTATOR)
+} sim_scenario_t;
+
+/* Result of a scenario of a batch or of a simulation into a result owned by the caller. The rows of probabilities
+   are those of the matrices returned by simulate_player() (rows 0 and 1) or simulate_spectator() (one row per player). */
+
+typedef struct {
+    double probabilities[MAX_PLAYERS][3 + NUM_OF_HAND_TYPES];
+    int num_rows;           // Rows of probabilities filled, 0 if the scenario or call is invalid
+    sim_info_t info;
+} sim_result_t;
+
+/* Probabilities of a spectator's spot at every later street, see simulate_spectator_streets(). The rows of a street
+   are those of simulate_spectator(), one per player, with the hand of every player as it stands on the board of the
+   street: best hand, hand type and win, defeat or tie if the cards were shown down there. The river rows are the
+   equity of the spot. */
+
+#define SIM_MAX_STREETS 3       // Flop, turn and river
+
+typedef struct {
+    int num_streets;            // Streets after the spot: 3 from preflop, 2 from the flop, 1 from the turn
+    int num_rows;               // Rows of every street, one per player
+    int num_board_cards[SIM_MAX_STREETS];   // Community cards of every street: 3, 4 or 5
+    double probabilities[SIM_MAX_STREETS][MAX_PLAYERS][3 + NUM_OF_HAND_TYPES];
+    sim_info_t info[SIM_MAX_STREETS];
+} sim_streets_result_t;
+
+/* Probabilities of every hero holding on a board against random opponents, see simulate_holdings(). It is large,
+   so it is better allocated on the heap. */
+
+#define SIM_NUM_HOLDINGS 1326           // Hands of two cards of the deck, see holding_index()
+#define SIM_NUM_HOLDING_CLASSES 169     // Starting hand classes, see preflop_class()
+
+typedef struct {
+    int num_holdings;                   // Holdings that do not use a known card
+    int num_samples;                    // Boards and opponents' cards sampled
+    int cards[SIM_NUM_HOLDINGS][2];     // Cards of every holding, in [0,51] and the lower one first
+    int num_games[SIM_NUM_HOLDINGS];    // Samples that did not use the cards of the holding, 0 if it uses a known card
+    double probabilities[SIM_NUM_HOLDINGS][3 + NUM_OF_HAND_TYPES];  // Row of the player of simulate_player()
+    double win_std_error[SIM_NUM_HOLDINGS];     // Percentage points
+    int class_num_holdings[SIM_NUM_HOLDING_CLASSES];    // Holdings of every class with at least one game
+    double class_probabilities[SIM_NUM_HOLDING_CLASSES][3 + NUM_OF_HAND_TYPES]; // Mean over those holdings
+} sim_holdings_result_t;
+
+/* Largest Omaha table: 4 hole cards per player and 5 community cards, see simulate_player_omaha() */
+
+#define OMAHA_MAX_PLAYERS 11
+
+/* Scratch space of the simulations that is too large for the stack, see sim_arena_create() */
+
+typedef struct sim_arena sim_arena_t;
 
 /* These functions are meant to be called from outside the current module. */ 
 
@@ -17,4 +163,32 @@ int cardtype_to_num(char* card_type);
 
 
 double** simulate_player(char* known_cards[], int num_known_cards, int num_players, int num_games);
-double** simulate_spectator(char* players_cards[], char* board_cards[],char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games);
\ No newline at end of file
+double** simulate_spectator(char* players_cards[], char* board_cards[],char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games);
+
+double** simulate_player_mt(char* known_cards[], int num_known_cards, int num_players, int num_games, int num_threads);
+double** simulate_spectator_mt(char* players_cards[], char* board_cards[],char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games, int num_threads);
+
+void sim_default_options(sim_options_t *options);
+double** simulate_player_ex(char* known_cards[], int num_known_cards, int num_players, int num_games, const sim_options_t *options, sim_info_t *info);
+double** simulate_spectator_ex(char* players_cards[], char* board_cards[],char* discarded_cards[],int num_discarded_cards, int num_board_cards, int num_players, int num_games, const sim_options_t *options, sim_info_t *info);
+
+int simulate_player_into(char* known_cards[], int num_known_cards, int num_players, int num_games, const sim_options_t *options, sim_result_t *result);
+int simulate_spectator_into(char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players, int num_games,
+                            const sim_options_t *options, sim_result_t *result);
+int simulate_spectator_streets(char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players, int num_games,
+                               const sim_options_t *options, sim_streets_result_t *result);
+int simulate_holdings(char* board_cards[], int num_board_cards, char* discarded_cards[], int num_discarded_cards, int num_players, int num_games,
+                      const sim_options_t *options, sim_holdings_result_t *result);
+int holding_index(int card1, int card2);
+double** simulate_player_omaha(char* known_cards[], int num_known_cards, int num_players, int num_games, const sim_options_t *options, sim_info_t *info);
+double** simulate_spectator_omaha(char* players_cards[], char* board_cards[], char* discarded_cards[], int num_discarded_cards, int num_board_cards, int num_players, int num_games,
+                                  const sim_options_t *options, sim_info_t *info);
+int simulate_player_sweep(char* known_cards[], int num_known_cards, int max_opponents, int num_games, const sim_options_t *options, sim_result_t results[]);
+sim_arena_t *sim_arena_create();
+void sim_arena_destroy(sim_arena_t *arena);
+
+void simulate_batch(const sim_scenario_t scenarios[], sim_result_t results[], int num_scenarios, const sim_options_t *options);
+
+void rng_seed(rng_t *rng, rng_kind_t kind, uint64_t seed, uint64_t stream);
+uint32_t rng_next32(rng_t *rng);
+uint32_t rng_bounded(rng_t *rng, uint32_t range);
\ No newline at end of file
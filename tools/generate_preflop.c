@@ -0,0 +1,265 @@
+/******************************************************************************
+ * File: generate_preflop.c
+ * Description: Generator of the preflop tables loaded by load_preflop_tables().
+ * Every starting hand class (169) is simulated against 1..PREFLOP_MAX_OPPONENTS
+ * random opponents with a fixed seed, so the tables are reproducible. With
+ * --matchups, every heads-up matchup of two known hands (one per permutation
+ * of the suits) is also enumerated exactly, which takes hours of CPU time.
+ *
+ * The scenarios are solved in parallel with simulate_batch(). Build and run
+ * from the root directory of the project:
+ *      gcc -O2 -o generate_preflop tools/generate_preflop.c src/hand_evaluator.c src/simulation.c src/preflop_tables.c src/result_cache.c src/hand_ranges.c src/instrument.c -pthread -lm
+ *      ./generate_preflop data/preflop_tables.bin 2000000 8 [--matchups]
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../src/preflop_tables.h"
+
+#define PREFLOP_SEED 0x5EED5EED5EED5EEDULL
+#define MATCHUPS_PER_BATCH 1024
+
+/* A heads-up matchup: its key and the cards of one of the matchups with that key */
+
+typedef struct {
+    uint32_t key;
+    int cards[4];
+} matchup_t;
+
+int compare_matchups(const void *a, const void *b);
+int collect_matchups(matchup_t **matchups);
+void store_entry(preflop_entry_t *entry, const sim_result_t *result);
+int write_class_entries(FILE *out, int class_games, int num_threads);
+int write_matchups(FILE *out, const matchup_t *matchups, int num_matchups, int num_threads);
+
+
+int main(int argc, char *argv[]){
+
+    if(argc < 4 || argc > 5 || (argc == 5 && strcmp(argv[4], "--matchups") != 0)){
+        fprintf(stderr,"Usage: %s <output file> <games per class entry> <threads> [--matchups]\n", argv[0]);
+        return 1;
+    }
+
+    int class_games = atoi(argv[2]);
+    int num_threads = atoi(argv[3]);
+    if(class_games < 1 || num_threads < 1){
+        fprintf(stderr,"Error: the games and the threads must be positive.\n");
+        return 1;
+    }
+
+    if(init_simulator(NULL) == -1){
+        return 1;
+    }
+
+    matchup_t *matchups = NULL;
+    int num_matchups = 0;
+    if(argc == 5){
+        num_matchups = collect_matchups(&matchups);
+        if(num_matchups == -1){
+            fprintf(stderr,"Error allocating the matchups.\n");
+            return 1;
+        }
+    }
+
+    FILE *out = fopen(argv[1], "wb");
+    if(out == NULL){
+        fprintf(stderr,"Error when creating %s.\n", argv[1]);
+        return 1;
+    }
+
+    preflop_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PREFLOP_MAGIC, sizeof(header.magic));
+    header.max_opponents = PREFLOP_MAX_OPPONENTS;
+    header.class_games = (uint32_t) class_games;
+    header.num_matchups = (uint32_t) num_matchups;
+
+    int error = fwrite(&header, sizeof(header), 1, out) != 1 ||
+                write_class_entries(out, class_games, num_threads) == -1 ||
+                write_matchups(out, matchups, num_matchups, num_threads) == -1;
+
+    if(fclose(out) != 0 || error){
+        fprintf(stderr,"Error when writing %s.\n", argv[1]);
+        return 1;
+    }
+
+    free(matchups);
+    return 0;
+}
+
+
+/**
+ * @brief Comparison of two matchups by key, for qsort().
+ *
+ * @param a First matchup.
+ * @param b Second matchup.
+ * @return Negative, zero or positive if the key of a is lower, equal or greater than the key of b.
+ */
+int compare_matchups(const void *a, const void *b){
+    uint32_t key_a = ((const matchup_t *) a)->key, key_b = ((const matchup_t *) b)->key;
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+
+/**
+ * @brief Collection of all the heads-up matchups, one per key, sorted by key.
+ *
+ * @param matchups Where the allocated array of matchups is stored.
+ * @return Number of matchups, -1 if they can not be allocated.
+ */
+int collect_matchups(matchup_t **matchups){
+    int max_matchups = (TOTAL_CARDS * (TOTAL_CARDS - 1) / 2) * ((TOTAL_CARDS - 2) * (TOTAL_CARDS - 3) / 2);
+    matchup_t *all = malloc(max_matchups * sizeof(matchup_t));
+    if(all == NULL) return -1;
+
+    int n = 0;
+    for(int a = 0; a < TOTAL_CARDS; a++)
+    for(int b = a + 1; b < TOTAL_CARDS; b++)
+    for(int c = 0; c < TOTAL_CARDS; c++)
+    for(int d = c + 1; d < TOTAL_CARDS; d++){
+        if(c == a || c == b || d == a || d == b) continue;
+        all[n].key = preflop_matchup_key(a, b, c, d);
+        all[n].cards[0] = a;
+        all[n].cards[1] = b;
+        all[n].cards[2] = c;
+        all[n].cards[3] = d;
+        n++;
+    }
+
+    qsort(all, n, sizeof(matchup_t), compare_matchups);
+
+    int num_unique = 0;
+    for(int i = 0; i < n; i++){
+        if(num_unique == 0 || all[i].key != all[num_unique - 1].key){
+            all[num_unique++] = all[i];
+        }
+    }
+
+    *matchups = all;
+    return num_unique;
+}
+
+
+/**
+ * @brief Storing of the first two rows of probabilities of a result in an entry.
+ *
+ * @param entry Entry where the rows are stored.
+ * @param result Result of a scenario.
+ */
+void store_entry(preflop_entry_t *entry, const sim_result_t *result){
+    for(int i = 0; i < 2; i++){
+        for(int j = 0; j < 3 + NUM_OF_HAND_TYPES; j++){
+            entry->probabilities[i][j] = (float) result->probabilities[i][j];
+        }
+    }
+}
+
+
+/**
+ * @brief Simulation and writing of the class entries, [PREFLOP_NUM_CLASSES][PREFLOP_MAX_OPPONENTS]. Every class is
+ * simulated with one of its hands: pairs with clubs and diamonds, suited hands with clubs and offsuit hands with
+ * the highest card of clubs and the lowest of diamonds.
+ *
+ * @param out File where the entries are written.
+ * @param class_games Games simulated for every entry.
+ * @param num_threads Threads of the simulation.
+ * @return -1 if the entries can not be allocated or written, 0 for success.
+ */
+int write_class_entries(FILE *out, int class_games, int num_threads){
+    int num_entries = PREFLOP_NUM_CLASSES * PREFLOP_MAX_OPPONENTS;
+    sim_scenario_t *scenarios = calloc(num_entries, sizeof(sim_scenario_t));
+    sim_result_t *results = malloc(num_entries * sizeof(sim_result_t));
+    preflop_entry_t *entries = malloc(num_entries * sizeof(preflop_entry_t));
+    if(scenarios == NULL || results == NULL || entries == NULL) return -1;
+
+    for(int row = 0; row < NUM_RANKS; row++)
+    for(int col = 0; col < NUM_RANKS; col++){
+        int class = row * NUM_RANKS + col;
+        int suited = row > col;
+        int high = (row > col) ? row : col, low = (row > col) ? col : row;
+
+        for(int o = 0; o < PREFLOP_MAX_OPPONENTS; o++){
+            sim_scenario_t *scenario = &scenarios[class * PREFLOP_MAX_OPPONENTS + o];
+            scenario->mode = SIM_MODE_PLAYER;
+            scenario->num_players = o + 2;
+            scenario->num_games = class_games;
+            scenario->players_cards[0][0] = high;
+            scenario->players_cards[0][1] = suited ? low : NUM_RANKS + low;
+        }
+    }
+
+    sim_options_t options;
+    sim_default_options(&options);
+    options.method = SIM_METHOD_MONTE_CARLO;
+    options.num_threads = num_threads;
+    options.seed = PREFLOP_SEED;
+
+    fprintf(stderr,"Simulating %d class entries with %d games each...\n", num_entries, class_games);
+    simulate_batch(scenarios, results, num_entries, &options);
+
+    for(int i = 0; i < num_entries; i++){
+        store_entry(&entries[i], &results[i]);
+    }
+
+    int written = fwrite(entries, sizeof(preflop_entry_t), num_entries, out);
+
+    free(scenarios);
+    free(results);
+    free(entries);
+    return (written == num_entries) ? 0 : -1;
+}
+
+
+/**
+ * @brief Enumeration and writing of the matchup table: the sorted keys, then the entries in the same order.
+ *
+ * @param out File where the table is written.
+ * @param matchups Matchups sorted by key.
+ * @param num_matchups Number of matchups.
+ * @param num_threads Threads of the enumeration.
+ * @return -1 if the entries can not be allocated or written, 0 for success.
+ */
+int write_matchups(FILE *out, const matchup_t *matchups, int num_matchups, int num_threads){
+    if(num_matchups == 0) return 0;
+
+    for(int i = 0; i < num_matchups; i++){
+        if(fwrite(&matchups[i].key, sizeof(uint32_t), 1, out) != 1) return -1;
+    }
+
+    sim_scenario_t *scenarios = calloc(MATCHUPS_PER_BATCH, sizeof(sim_scenario_t));
+    sim_result_t *results = malloc(MATCHUPS_PER_BATCH * sizeof(sim_result_t));
+    if(scenarios == NULL || results == NULL) return -1;
+
+    sim_options_t options;
+    sim_default_options(&options);
+    options.method = SIM_METHOD_EXACT;
+    options.num_threads = num_threads;
+
+    for(int first = 0; first < num_matchups; first += MATCHUPS_PER_BATCH){
+        int n = (num_matchups - first < MATCHUPS_PER_BATCH) ? num_matchups - first : MATCHUPS_PER_BATCH;
+
+        for(int i = 0; i < n; i++){
+            const int *cards = matchups[first + i].cards;
+            scenarios[i].mode = SIM_MODE_SPECTATOR;
+            scenarios[i].num_players = 2;
+            scenarios[i].players_cards[0][0] = cards[0];
+            scenarios[i].players_cards[0][1] = cards[1];
+            scenarios[i].players_cards[1][0] = cards[2];
+            scenarios[i].players_cards[1][1] = cards[3];
+        }
+
+        fprintf(stderr,"Enumerating matchups %d-%d of %d...\n", first + 1, first + n, num_matchups);
+        simulate_batch(scenarios, results, n, &options);
+
+        for(int i = 0; i < n; i++){
+            preflop_entry_t entry;
+            store_entry(&entry, &results[i]);
+            if(fwrite(&entry, sizeof(preflop_entry_t), 1, out) != 1) return -1;
+        }
+    }
+
+    free(scenarios);
+    free(results);
+    return 0;
+}
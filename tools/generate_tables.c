@@ -0,0 +1,143 @@
+/******************************************************************************
+ * File: generate_tables.c
+ * Description: Generator of src/lookup_tables.h, the header with the lookup
+ * tables of the hand evaluator as static const arrays. They are built from
+ * the CSV file of hand equivalence classes exactly as init_simulator() builds
+ * them, and loaded by init_simulator(NULL) without reading any file.
+ *
+ * The evaluator is compiled without the built-in tables, so the generator
+ * does not depend on its own output. Build and run from the root directory
+ * of the project whenever data/eq_classes.csv or the tables change:
+ *      gcc -O2 -DNO_BUILTIN_TABLES -o generate_tables tools/generate_tables.c src/hand_evaluator.c
+ *      ./generate_tables data/eq_classes.csv src/lookup_tables.h
+ ****************************************************************************/
+
+#include <stdio.h>
+#include "../src/hand_evaluator.h"
+
+#define HIGHEST_5CARD_BIT_RANK (0x1F00 + 1)
+#define PRIME_PROD_TABLE_SIZE 4888
+#define PRIME_PROD_HASH_TABLE_BITS 13
+#define PRIME_PROD_HASH_BUCKET_BITS 11
+#define FLUSH7_TABLE_SIZE (0x1FFF + 1)
+#define NOFLUSH7_TABLE_BITS 16
+#define NOFLUSH7_BUCKET_BITS 14
+#define VALUES_PER_LINE 16
+
+
+/* Look up tables of hand_evaluator.c */
+
+extern unsigned short flushes_table[];
+extern unsigned short unique5_table[];
+extern int prime_product_table[];
+extern unsigned short prime_product_score_table[];
+extern unsigned short prime_product_hash_table[];
+extern unsigned short prime_product_displacements[];
+extern unsigned int prime_product_salt;
+extern unsigned short flush7_table[];
+extern unsigned short noflush7_table[];
+extern unsigned short noflush7_displacements[];
+extern unsigned int noflush7_salt;
+extern const char *hand_names[];
+
+void write_ushort_array(FILE *out, const char *type, const char *name, const char *size, const unsigned short values[], int num_values);
+void write_int_array(FILE *out, const char *name, const char *size, const int values[], int num_values);
+void write_string_array(FILE *out, const char *name, const char *size, const char *values[], int num_values);
+
+
+int main(int argc, char *argv[]){
+
+    if(argc != 3){
+        fprintf(stderr,"Usage: %s <equivalence classes CSV> <output header>\n", argv[0]);
+        return 1;
+    }
+
+    if(create_lookup_tables(argv[1]) == -1){
+        return 1;
+    }
+
+    FILE *out = fopen(argv[2], "w");
+    if(out == NULL){
+        fprintf(stderr,"Error when creating %s.\n", argv[2]);
+        return 1;
+    }
+
+    fprintf(out, "/******************************************************************************\n");
+    fprintf(out, " * File: lookup_tables.h\n");
+    fprintf(out, " * Description: Lookup tables of the hand evaluator, loaded by init_simulator(NULL).\n");
+    fprintf(out, " * GENERATED by tools/generate_tables.c from %s, do not edit.\n", argv[1]);
+    fprintf(out, " ****************************************************************************/\n\n");
+    fprintf(out, "#pragma once\n\n");
+    fprintf(out, "#define BUILTIN_PRIME_PRODUCT_SALT %uU\n", prime_product_salt);
+    fprintf(out, "#define BUILTIN_NOFLUSH7_SALT %uU\n\n", noflush7_salt);
+
+    write_ushort_array(out, "unsigned short", "builtin_flushes_table", "HIGHEST_5CARD_BIT_RANK", flushes_table, HIGHEST_5CARD_BIT_RANK);
+    write_ushort_array(out, "unsigned short", "builtin_unique5_table", "HIGHEST_5CARD_BIT_RANK", unique5_table, HIGHEST_5CARD_BIT_RANK);
+    write_int_array(out, "builtin_prime_product_table", "PRIME_PROD_TABLE_SIZE", prime_product_table, PRIME_PROD_TABLE_SIZE);
+    write_ushort_array(out, "unsigned short", "builtin_prime_product_score_table", "PRIME_PROD_TABLE_SIZE", prime_product_score_table, PRIME_PROD_TABLE_SIZE);
+    write_ushort_array(out, "unsigned short", "builtin_prime_product_hash_table", "1 << PRIME_PROD_HASH_TABLE_BITS", prime_product_hash_table, 1 << PRIME_PROD_HASH_TABLE_BITS);
+    write_ushort_array(out, "unsigned short", "builtin_prime_product_displacements", "1 << PRIME_PROD_HASH_BUCKET_BITS", prime_product_displacements, 1 << PRIME_PROD_HASH_BUCKET_BITS);
+    write_ushort_array(out, "unsigned short", "builtin_flush7_table", "FLUSH7_TABLE_SIZE", flush7_table, FLUSH7_TABLE_SIZE);
+    write_ushort_array(out, "unsigned short", "builtin_noflush7_table", "1 << NOFLUSH7_TABLE_BITS", noflush7_table, 1 << NOFLUSH7_TABLE_BITS);
+    write_ushort_array(out, "unsigned short", "builtin_noflush7_displacements", "1 << NOFLUSH7_BUCKET_BITS", noflush7_displacements, 1 << NOFLUSH7_BUCKET_BITS);
+    write_string_array(out, "builtin_hand_names", "NUM_OF_EQUIVALENCES", hand_names, NUM_OF_EQUIVALENCES);
+
+    fclose(out);
+    return 0;
+}
+
+
+/**
+ * @brief Writing of an array of unsigned shorts as a static const C array.
+ *
+ * @param out File where the array is written.
+ * @param type C type of the elements.
+ * @param name Name of the array.
+ * @param size Size of the array, as it is written in the declaration.
+ * @param values Values of the array.
+ * @param num_values Number of values.
+ */
+void write_ushort_array(FILE *out, const char *type, const char *name, const char *size, const unsigned short values[], int num_values){
+    fprintf(out, "static const %s %s[%s] = {", type, name, size);
+    for(int i = 0; i < num_values; i++){
+        fprintf(out, "%s%u%s", (i % VALUES_PER_LINE == 0) ? "\n    " : "", values[i], (i < num_values - 1) ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+
+/**
+ * @brief Writing of an array of ints as a static const C array.
+ *
+ * @param out File where the array is written.
+ * @param name Name of the array.
+ * @param size Size of the array, as it is written in the declaration.
+ * @param values Values of the array.
+ * @param num_values Number of values.
+ */
+void write_int_array(FILE *out, const char *name, const char *size, const int values[], int num_values){
+    fprintf(out, "static const int %s[%s] = {", name, size);
+    for(int i = 0; i < num_values; i++){
+        fprintf(out, "%s%d%s", (i % VALUES_PER_LINE == 0) ? "\n    " : "", values[i], (i < num_values - 1) ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+
+/**
+ * @brief Writing of an array of strings as a static const C array. The strings of the equivalence
+ * table contain no quotes nor backslashes, so they are written as they are.
+ *
+ * @param out File where the array is written.
+ * @param name Name of the array.
+ * @param size Size of the array, as it is written in the declaration.
+ * @param values Strings of the array.
+ * @param num_values Number of strings.
+ */
+void write_string_array(FILE *out, const char *name, const char *size, const char *values[], int num_values){
+    fprintf(out, "static const char *const %s[%s] = {\n", name, size);
+    for(int i = 0; i < num_values; i++){
+        fprintf(out, "    \"%s\"%s\n", values[i], (i < num_values - 1) ? "," : "");
+    }
+    fprintf(out, "};\n\n");
+}